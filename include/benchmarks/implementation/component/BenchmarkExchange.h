@@ -40,14 +40,26 @@ namespace cupcfd
 				 **/
 				std::shared_ptr<cupcfd::comm::ExchangePattern<T>> patternPtr;
 
+				/**
+				 * The number of data arrays to exchange with the pattern per repetition.
+				 * If greater than one, the cost of exchanging each array individually is compared against
+				 * batching all of the arrays into a single exchange with an ExchangePatternMultiField.
+				 **/
+				I nFields;
+
 				// === Constructors/Deconstructors ===
 
 				/**
 				 * Constructor:
 				 *
 				 * Sets up the benchmark for the provided exchange pattern
+				 *
+				 * @param benchmarkName The name of the benchmark, used as the overall timer identifier
+				 * @param repetitions The number of times to run the benchmark
+				 * @param nFields The number of data arrays to exchange per repetition
+				 * @param patternPtr The pattern to use for the exchanges
 				 */
-				BenchmarkExchange(std::string benchmarkName, I repetitions, std::shared_ptr<cupcfd::comm::ExchangePattern<T>> patternPtr);
+				BenchmarkExchange(std::string benchmarkName, I repetitions, I nFields, std::shared_ptr<cupcfd::comm::ExchangePattern<T>> patternPtr);
 
 				/**
 				 *
@@ -38,14 +38,25 @@ namespace cupcfd
 
 				std::shared_ptr<cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>> meshPtr;
 
+				/**
+				 * Whether to run the thread-parallel (face coloured) versions of the face loop kernels
+				 * rather than the serial versions.
+				 **/
+				bool colouredFaceLoops;
+
 				// === Constructors/Deconstructors ===
 
 				/**
+				 * Constructor:
 				 *
+				 * @param benchmarkName The name of the benchmark, used as the overall timer identifier
+				 * @param meshPtr The mesh to run the kernels on
+				 * @param repetitions The number of times to run the benchmark
+				 * @param colouredFaceLoops Whether to run the thread-parallel face loop kernels
 				 */
 				BenchmarkKernels(std::string benchmarkName,
 											 std::shared_ptr<cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>> meshPtr,
-											 I repetitions);
+											 I repetitions, bool colouredFaceLoops = false);
 
 				/**
 				 *
@@ -60,6 +71,14 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes GradientPhiGaussDolfynBenchmark();
 
+				/**
+				 * Benchmark the gradient kernel together with the exchange of the ghost cell values it reads,
+				 * with the exchange overlapped with the interior faces of the face loop.
+				 * The fraction of the exchange that was overlapped is logged as a parameter.
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes GradientPhiGaussDolfynOverlapBenchmark();
+
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes FluxMassDolfynFaceLoopBenchmark();
 
@@ -18,6 +18,7 @@
 #include "ParticleSystemSimple.h"
 #include <string>
 #include "Distribution.h"
+#include "MeshConfig.h"
 
 namespace cupcfd
 {
@@ -41,6 +42,18 @@ namespace cupcfd
 				/** Distribution of dt for each timestep **/
 				cupcfd::distributions::Distribution<I,T> * dtDist;
 
+				/** Configuration of the mesh, used to rebalance it. nullptr if rebalancing is disabled. **/
+				cupcfd::geometry::mesh::MeshConfig<I,T,L> * meshConfig;
+
+				/** Ratio of the largest to the average particle load across processes above which the mesh is rebalanced **/
+				T rebalanceThreshold;
+
+				/** Number of timesteps between checks of the particle load imbalance **/
+				I rebalanceInterval;
+
+				/** Weight of a cell without particles, relative to the weight of one particle, when rebalancing **/
+				T rebalanceCellCost;
+
 				// === Constructors/Deconstructors ===
 
 				/**
@@ -59,6 +72,33 @@ namespace cupcfd
 
 				// === Concrete Methods ===
 
+				/**
+				 * Rebalance the mesh by particle load during the benchmark. Every rebalanceInterval timesteps,
+				 * the ratio of the largest to the average number of active particles per process is checked,
+				 * and if it is above rebalanceThreshold the particle system is rebalanced.
+				 *
+				 * @param meshConfig The configuration the mesh of the particle system was built from
+				 * @param rebalanceThreshold The imbalance ratio above which the mesh is rebalanced
+				 * @param rebalanceInterval The number of timesteps between checks of the imbalance
+				 * @param rebalanceCellCost The weight of a cell without particles, relative to one particle
+				 *
+				 * @return Nothing
+				 */
+				void setRebalance(cupcfd::geometry::mesh::MeshConfig<I,T,L>& meshConfig,
+								  T rebalanceThreshold, I rebalanceInterval, T rebalanceCellCost);
+
+				/**
+				 * Compute the ratio of the largest to the average number of active particles per process.
+				 *
+				 * @param imbalance A pointer to the location where the ratio will be stored. This is 1 if there
+				 * are no active particles.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getParticleImbalance(T * imbalance);
+
 				// === Inherited Overridden Methods ===
 				void setupBenchmark();
 				void recordParameters();
@@ -13,6 +13,8 @@
 #ifndef CUPCFD_BENCHMARK_BENCHMARK_PARTICLESYSTEM_SIMPLE_IPP_H
 #define CUPCFD_BENCHMARK_BENCHMARK_PARTICLESYSTEM_SIMPLE_IPP_H
 
+#include "Reduce.h"
+
 #include "tt_interface_c.h"
 
 namespace cupcfd
@@ -26,7 +28,11 @@ namespace cupcfd
 																		std::shared_ptr<cupcfd::particles::ParticleSystemSimple<M,I,T,L>> particleSystemPtr)
 		: Benchmark<I,T>(benchmarkName, repetitions),
 		  particleSystemPtr(particleSystemPtr),
-		  nTimesteps(nTimesteps)
+		  nTimesteps(nTimesteps),
+		  meshConfig(nullptr),
+		  rebalanceThreshold(T(0)),
+		  rebalanceInterval(1),
+		  rebalanceCellCost(T(1))
 		{
 			this->dtDist = dtDist.clone();
 		}
@@ -34,6 +40,43 @@ namespace cupcfd
 		template <class M, class I, class T, class L>
 		BenchmarkParticleSystemSimple<M,I,T,L>::~BenchmarkParticleSystemSimple() {
 			delete this->dtDist;
+			delete this->meshConfig;
+		}
+
+		template <class M, class I, class T, class L>
+		void BenchmarkParticleSystemSimple<M,I,T,L>::setRebalance(cupcfd::geometry::mesh::MeshConfig<I,T,L>& meshConfig,
+																	T rebalanceThreshold, I rebalanceInterval, T rebalanceCellCost) {
+			delete this->meshConfig;
+			this->meshConfig = meshConfig.clone();
+			this->rebalanceThreshold = rebalanceThreshold;
+			this->rebalanceInterval = rebalanceInterval;
+			this->rebalanceCellCost = rebalanceCellCost;
+		}
+
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes BenchmarkParticleSystemSimple<M,I,T,L>::getParticleImbalance(T * imbalance) {
+			cupcfd::error::eCodes status;
+
+			cupcfd::comm::Communicator& comm = *(this->particleSystemPtr->mesh->cellConnGraph->comm);
+
+			I nActive = this->particleSystemPtr->getNActiveParticles();
+			I maxActive;
+			I totalActive;
+
+			status = cupcfd::comm::allReduceMax(&nActive, 1, &maxActive, 1, comm);
+			CHECK_ECODE(status)
+
+			status = cupcfd::comm::allReduceAdd(&nActive, 1, &totalActive, 1, comm);
+			CHECK_ECODE(status)
+
+			if(totalActive == 0) {
+				*imbalance = T(1);
+			}
+			else {
+				*imbalance = (T(maxActive) * T(comm.size)) / T(totalActive);
+			}
+
+			return cupcfd::error::E_SUCCESS;
 		}
 
 		template <class M, class I, class T, class L>
@@ -43,7 +86,11 @@ namespace cupcfd
 
 		template <class M, class I, class T, class L>
 		void BenchmarkParticleSystemSimple<M,I,T,L>::recordParameters() {
-			// Nothing to do currently
+			if(this->meshConfig != nullptr) {
+				TreeTimerLogParameterDouble("RebalanceThreshold", double(this->rebalanceThreshold));
+				TreeTimerLogParameterInt("RebalanceInterval", this->rebalanceInterval);
+				TreeTimerLogParameterDouble("RebalanceCellCost", double(this->rebalanceCellCost));
+			}
 		}
 
 		template <class M, class I, class T, class L>
@@ -72,6 +119,24 @@ namespace cupcfd
 						MPI_Abort(MPI_COMM_WORLD, status);
 					}
 					this->stopBenchmarkBlock("ParticleSystemTimestep");
+
+					// Rebalance the cells and particles if the particle load has become too uneven
+					if(this->meshConfig != nullptr && ((j + 1) % this->rebalanceInterval) == 0) {
+						T imbalance;
+						status = this->getParticleImbalance(&imbalance);
+						CHECK_ECODE(status)
+
+						if(imbalance > this->rebalanceThreshold) {
+							this->startBenchmarkBlock("ParticleSystemRebalance");
+							TreeTimerLogParameterDouble("ParticleImbalance", double(imbalance));
+							status = particleSystemPtr->rebalance(*(this->meshConfig), this->rebalanceCellCost);
+							if (status != cupcfd::error::E_SUCCESS) {
+								std::cout << "ERROR: rebalance() failed" << std::endl;
+								MPI_Abort(MPI_COMM_WORLD, status);
+							}
+							this->stopBenchmarkBlock("ParticleSystemRebalance");
+						}
+					}
 				}
 			}
 
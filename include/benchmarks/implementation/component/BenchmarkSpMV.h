@@ -0,0 +1,145 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the BenchmarkSpMV class.
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_SPMV_INCLUDE_H
+#define CUPCFD_BENCHMARK_BENCHMARK_SPMV_INCLUDE_H
+
+#include "Benchmark.h"
+
+#include <memory>
+
+#include "DistributedSparseMatrixCSR.h"
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixSELL.h"
+#include "SparseMatrixBCSR.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		/**
+		 * Get the number of bytes of a CSR matrix read by a matrix-vector product
+		 * (values, column indexes and row pointers).
+		 *
+		 * @param matrix The matrix
+		 *
+		 * @return The number of bytes
+		 */
+		template <class I, class T>
+		inline double getMatrixBytes(cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix);
+
+		/**
+		 * Get the number of bytes of a SELL matrix read by a matrix-vector product
+		 * (values and column indexes including padding, chunk pointers and the row order).
+		 *
+		 * @param matrix The matrix
+		 *
+		 * @return The number of bytes
+		 */
+		template <class I, class T>
+		inline double getMatrixBytes(cupcfd::data_structures::SparseMatrixSELL<I,T>& matrix);
+
+		/**
+		 * Get the number of bytes of a block CSR matrix read by a matrix-vector product
+		 * (block values, block column indexes and block row pointers).
+		 *
+		 * @param matrix The matrix
+		 *
+		 * @return The number of bytes
+		 */
+		template <class I, class T>
+		inline double getMatrixBytes(cupcfd::data_structures::SparseMatrixBCSR<I,T>& matrix);
+
+		/**
+		 * Benchmark of the distributed sparse matrix-vector product (y = Ax).
+		 *
+		 * The owned rows of the distributed matrix are stored as two matrices in the format C - one of the
+		 * owned columns, which is multiplied while the ghost x entries are exchanged, and one of the ghost
+		 * columns, whose product is added once they have arrived.
+		 *
+		 * Alongside the time, the achieved GFLOP/s and effective memory bandwidth (GB/s) of each process
+		 * are recorded, so the results can be placed against the roofline of the machine. The traffic
+		 * model assumes that every stored matrix entry (including any padding or explicit zeroes of the
+		 * format) and index is read once, and every entry of x (including the ghost entries) and y is
+		 * accessed once - i.e. perfect reuse of x in cache. The GFLOP/s only count the non-zeroes of the
+		 * matrix, so they can be compared across formats.
+		 *
+		 * @tparam C The specialisation class of the local matrices
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The datatype of the matrix and vectors
+		 */
+		template <class C, class I, class T>
+		class BenchmarkSpMV : public Benchmark<I,T>
+		{
+			public:
+				// === Members ===
+
+				/** Shared Pointer to the distributed matrix, which provides the exchange of the ghost x entries **/
+				std::shared_ptr<cupcfd::data_structures::DistributedSparseMatrixCSR<I,T>> matrixPtr;
+
+				/** Shared Pointer to the owned columns of the owned rows **/
+				std::shared_ptr<C> ownedMatrixPtr;
+
+				/** Shared Pointer to the ghost columns of the owned rows **/
+				std::shared_ptr<C> ghostMatrixPtr;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Constructor.
+				 *
+				 * @param benchmarkName The name of the benchmark, used for the overall benchmark timer
+				 * @param repetitions The number of matrix-vector products to time
+				 * @param matrixPtr The distributed matrix to multiply with
+				 * @param ownedMatrixPtr The owned columns of the distributed matrix (see DistributedSparseMatrixCSR::splitLocalMatrix)
+				 * @param ghostMatrixPtr The ghost columns of the distributed matrix (see DistributedSparseMatrixCSR::splitLocalMatrix)
+				 */
+				BenchmarkSpMV(std::string benchmarkName, I repetitions,
+							  std::shared_ptr<cupcfd::data_structures::DistributedSparseMatrixCSR<I,T>> matrixPtr,
+							  std::shared_ptr<C> ownedMatrixPtr, std::shared_ptr<C> ghostMatrixPtr);
+
+				/**
+				 * Deconstructor
+				 */
+				~BenchmarkSpMV();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Get the number of floating point operations computed by this process per matrix-vector product
+				 * (a multiply and an add per non-zero).
+				 *
+				 * @return The number of floating point operations
+				 */
+				inline double getFlopsPerMultiply();
+
+				/**
+				 * Get the number of bytes moved to or from memory by this process per matrix-vector product,
+				 * according to the traffic model of the benchmark.
+				 *
+				 * @return The number of bytes
+				 */
+				inline double getBytesPerMultiply();
+
+				// === Inherited Overridden Methods ===
+				void setupBenchmark();
+				void recordParameters();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes runBenchmark();
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "BenchmarkSpMV.ipp"
+
+#endif
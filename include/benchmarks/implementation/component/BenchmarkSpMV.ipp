@@ -0,0 +1,54 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the BenchmarkSpMV class.
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_SPMV_IPP_H
+#define CUPCFD_BENCHMARK_BENCHMARK_SPMV_IPP_H
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		template <class I, class T>
+		inline double getMatrixBytes(cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix) {
+			return (double(matrix.A.size()) * double(sizeof(T) + sizeof(I))) + (double(matrix.IA.size()) * double(sizeof(I)));
+		}
+
+		template <class I, class T>
+		inline double getMatrixBytes(cupcfd::data_structures::SparseMatrixSELL<I,T>& matrix) {
+			return (double(matrix.getNStoredEntries()) * double(sizeof(T) + sizeof(I)))
+				   + (double(matrix.chunkPtr.size() + matrix.rowOrder.size()) * double(sizeof(I)));
+		}
+
+		template <class I, class T>
+		inline double getMatrixBytes(cupcfd::data_structures::SparseMatrixBCSR<I,T>& matrix) {
+			return (double(matrix.A.size()) * double(sizeof(T)))
+				   + (double(matrix.JA.size() + matrix.IA.size()) * double(sizeof(I)));
+		}
+
+		template <class C, class I, class T>
+		inline double BenchmarkSpMV<C,I,T>::getFlopsPerMultiply() {
+			return 2.0 * double(this->matrixPtr->localA.nnz);
+		}
+
+		template <class C, class I, class T>
+		inline double BenchmarkSpMV<C,I,T>::getBytesPerMultiply() {
+			double mLocal = double(this->matrixPtr->mLocal);
+			double nX = double(this->matrixPtr->xHalo.size());
+
+			// Both matrices, x (owned and ghost) and y
+			return getMatrixBytes(*(this->ownedMatrixPtr)) + getMatrixBytes(*(this->ghostMatrixPtr))
+				   + (nX * double(sizeof(T))) + (mLocal * double(sizeof(T)));
+		}
+	}
+}
+
+#endif
@@ -43,12 +43,15 @@ namespace cupcfd
 				/** Exchange Pattern Configuration for the Pattern to build **/
 				cupcfd::comm::ExchangePatternConfig patternConfig;
 
+				/** Number of data arrays to exchange per repetition **/
+				I nFields;
+
 				// === Constructors/Deconstructors ===
 
 				/**
 				 *
 				 */
-				BenchmarkConfigExchange(std::string benchmarkName, I repetitions, cupcfd::comm::ExchangePatternConfig& patternConfig);
+				BenchmarkConfigExchange(std::string benchmarkName, I repetitions, cupcfd::comm::ExchangePatternConfig& patternConfig, I nFields = 1);
 
 				/**
 				 *
@@ -38,7 +38,7 @@ namespace cupcfd
 			std::shared_ptr<cupcfd::comm::ExchangePattern<T>> patternPtr(pattern);
 
 			// Build the Exchange Benchmark
-			*bench = new BenchmarkExchange<I,T>(this->benchmarkName, this->repetitions, patternPtr);
+			*bench = new BenchmarkExchange<I,T>(this->benchmarkName, this->repetitions, this->nFields, patternPtr);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -42,12 +42,15 @@ namespace cupcfd
 				/** Number of repetitions per benchmark time/run **/
 				I repetitions;
 
+				/** Whether to run the thread-parallel (face coloured) versions of the face loop kernels **/
+				bool colouredFaceLoops;
+
 				// === Constructors/Deconstructors ===
 
 				/**
 				 *
 				 */
-				BenchmarkConfigKernels(const std::string benchmarkName, const I repetitions);
+				BenchmarkConfigKernels(const std::string benchmarkName, const I repetitions, const bool colouredFaceLoops = false);
 
 				/**
 				 *
@@ -22,7 +22,7 @@ namespace cupcfd
 		cupcfd::error::eCodes BenchmarkConfigKernels<I,T>::buildBenchmark(BenchmarkKernels<M,I,T,L> ** bench,
 												  std::shared_ptr<M> meshPtr)
 		{
-			*bench = new BenchmarkKernels<M,I,T,L>(this->benchmarkName, meshPtr, this->repetitions);
+			*bench = new BenchmarkKernels<M,I,T,L>(this->benchmarkName, meshPtr, this->repetitions, this->colouredFaceLoops);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -18,6 +18,7 @@
 #include "DistributionConfig.h"
 #include "ParticleSystemSimpleConfig.h"
 #include "BenchmarkParticleSystemSimple.h"
+#include "MeshConfig.h"
 
 #include <string>
 #include <memory>
@@ -58,6 +59,16 @@ namespace cupcfd
 				/** **/
 				cupcfd::particles::ParticleSystemSimpleConfig<M,I,T,L> * particleSystemConfig;
 
+				/** Ratio of the largest to the average particle load across processes above which the mesh is
+				 * rebalanced. A value of 0 disables rebalancing. **/
+				T rebalanceThreshold;
+
+				/** Number of timesteps between checks of the particle load imbalance **/
+				I rebalanceInterval;
+
+				/** Weight of a cell without particles, relative to the weight of one particle, when rebalancing **/
+				T rebalanceCellCost;
+
 				// === Constructors/Deconstructors ===
 
 				/**
@@ -79,6 +90,19 @@ namespace cupcfd
 
 				// === Concrete Methods ===
 
+				/**
+				 * Rebalance the mesh by particle load during the benchmark. Every rebalanceInterval timesteps, the
+				 * ratio of the largest to the average number of active particles per process is checked, and if it
+				 * is above rebalanceThreshold, the cells and their particles are redistributed.
+				 *
+				 * @param rebalanceThreshold The imbalance ratio above which the mesh is rebalanced, or 0 to disable
+				 * @param rebalanceInterval The number of timesteps between checks of the imbalance
+				 * @param rebalanceCellCost The weight of a cell without particles, relative to one particle
+				 *
+				 * @return Nothing
+				 */
+				void setRebalance(T rebalanceThreshold, I rebalanceInterval, T rebalanceCellCost);
+
 				// === Overloaded Inherited Methods ===
 
 				void operator=(const BenchmarkConfigParticleSystemSimple<M,I,T,L>& source);
@@ -89,6 +113,22 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes buildBenchmark(BenchmarkParticleSystemSimple<M,I,T,L> ** bench,
 													std::shared_ptr<M> meshPtr);
+
+				/**
+				 * Build the benchmark, with the configuration of the mesh so that it can be rebalanced
+				 * if rebalancing is enabled.
+				 *
+				 * @param bench A pointer to the location where the newly created benchmark pointer will be stored
+				 * @param meshPtr The mesh the particle system is located in
+				 * @param meshConfig The configuration meshPtr was built from
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildBenchmark(BenchmarkParticleSystemSimple<M,I,T,L> ** bench,
+													std::shared_ptr<M> meshPtr,
+													cupcfd::geometry::mesh::MeshConfig<I,T,L>& meshConfig);
 		};
 	}
 }
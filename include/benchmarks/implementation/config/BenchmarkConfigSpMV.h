@@ -0,0 +1,129 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the BenchmarkConfigSpMV class
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_CONFIG_SPMV_INCLUDE_H
+#define CUPCFD_BENCHMARK_BENCHMARK_CONFIG_SPMV_INCLUDE_H
+
+#include "Benchmark.h"
+#include "BenchmarkConfig.h"
+#include "BenchmarkSpMV.h"
+#include "ExchangePatternConfig.h"
+#include "SparseMatrixSourceConfig.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		enum BenchSpMVMatrixFormat {
+			BENCH_SPMV_FORMAT_CSR,		// Compressed Sparse Row
+			BENCH_SPMV_FORMAT_SELL,		// Sliced ELLPACK (SELL-C-sigma)
+			BENCH_SPMV_FORMAT_BCSR		// Block Compressed Sparse Row
+		};
+
+		/**
+		 * Configuration for a BenchmarkSpMV benchmark.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The datatype of the matrix and vectors
+		 */
+		template <class I, class T>
+		class BenchmarkConfigSpMV
+		{
+			public:
+				// === Members ===
+
+				/** Benchmark Name **/
+				std::string benchmarkName;
+
+				/** Number of repetitions per benchmark time/run **/
+				I repetitions;
+
+				/** Configuration detailing where to find a data source for the Matrix **/
+				cupcfd::data_structures::SparseMatrixSourceConfig<I,T> * matrixSourceConfig;
+
+				/** Exchange Pattern Configuration for the exchange of the ghost x entries **/
+				cupcfd::comm::ExchangePatternConfig patternConfig;
+
+				/** Sparse matrix format to store the local rows in **/
+				BenchSpMVMatrixFormat format;
+
+				/** Number of rows per chunk of a SELL matrix **/
+				I chunkSize;
+
+				/** Number of rows in each window sorted by length for a SELL matrix **/
+				I sigma;
+
+				/** Number of rows and columns in each block of a BCSR matrix **/
+				I blockSize;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Constructor.
+				 *
+				 * @param benchmarkName The name of the benchmark
+				 * @param repetitions The number of matrix-vector products to time
+				 * @param matrixSourceConfig Configuration of the data source of the (square) matrix
+				 * @param patternConfig Configuration of the exchange pattern for the ghost x entries
+				 * @param format The sparse matrix format to store the local rows in
+				 * @param chunkSize The number of rows per chunk (SELL only)
+				 * @param sigma The number of rows in each window sorted by row length (SELL only)
+				 * @param blockSize The number of rows and columns in each block (BCSR only)
+				 */
+				BenchmarkConfigSpMV(std::string benchmarkName, I repetitions,
+									cupcfd::data_structures::SparseMatrixSourceConfig<I,T>& matrixSourceConfig,
+									cupcfd::comm::ExchangePatternConfig& patternConfig,
+									BenchSpMVMatrixFormat format, I chunkSize, I sigma, I blockSize);
+
+				/**
+				 *
+				 */
+				BenchmarkConfigSpMV(const BenchmarkConfigSpMV<I,T>& source);
+
+				/**
+				 *
+				 */
+				~BenchmarkConfigSpMV();
+
+				// === Concrete Methods ===
+
+				// === Overloaded Inherited Methods ===
+
+				void operator=(const BenchmarkConfigSpMV<I,T>& source);
+
+				__attribute__((warn_unused_result))
+				BenchmarkConfigSpMV<I,T> * clone();
+
+				/**
+				 * Build the benchmark. The rows of the matrix are split evenly into contiguous blocks
+				 * across the processes of MPI_COMM_WORLD, and each process only loads its own rows.
+				 * The benchmark created is a BenchmarkSpMV specialised for the configured matrix format.
+				 * This is a collective operation.
+				 *
+				 * @param bench A pointer to the location where the new benchmark will be created
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS Success
+				 * @retval cupcfd::error::E_MATRIX_INVALID_COL_SIZE The matrix is not square
+				 * @retval cupcfd::error::E_MATRIX_INVALID_BLOCK_SIZE The chunk size, sigma or block size
+				 * of the matrix format is less than 1
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildBenchmark(Benchmark<I,T> ** bench);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "BenchmarkConfigSpMV.ipp"
+
+#endif
@@ -49,7 +49,8 @@ namespace cupcfd
 		 *
 		 *
 		 * Optional:
-		 * None
+		 * NFields: Integer. Defines the number of data arrays to exchange per repetition (default 1). If greater
+		 * than 1, exchanging each array separately is timed against a single batched exchange of all arrays.
 		 *
 		 * No configuration is provided for the exchange pattern (i.e. sizes, processes) since it is currently defined by
 		 * the Mesh being used for the benchmark run. Rather than define a nested mesh JSON (and thus have to rebuild the mesh)
@@ -100,6 +101,19 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes getExchangePatternConfig(cupcfd::comm::ExchangePatternConfig ** patternConfig);
 
+				/**
+				 * Get the number of data arrays to exchange per repetition.
+				 *
+				 * @param nFields A pointer to the location the number of fields will be stored at
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The value was found
+				 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The field was not present
+				 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The value was less than 1
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getNFields(I * nFields);
+
 
 				// === Overloaded Methods ===
 				__attribute__((warn_unused_result))
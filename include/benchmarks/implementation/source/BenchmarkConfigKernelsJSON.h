@@ -43,7 +43,9 @@ namespace cupcfd
 		 * Repetitions: Integer. Defines the number of times to run the benchmark
 		 *
 		 * Optional:
-		 * None
+		 * FaceLoop: String. Either "Serial" (default) or "Coloured". "Coloured" runs the thread-parallel versions of the
+		 * face loop kernels, which process the faces of each colour of the mesh face colouring concurrently using OpenMP.
+		 * The number of threads is set by the OpenMP runtime (e.g. OMP_NUM_THREADS).
 		 *
 		 * No configuration is provided for the mesh data since it is currently defined by
 		 * the mesh configuration being used for the benchmark run.
@@ -89,6 +91,19 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes getBenchmarkRepetitions(I * repetitions);
 
+				/**
+				 * Get whether the thread-parallel (face coloured) face loop kernels should be used
+				 *
+				 * @param colouredFaceLoops A pointer to the location to store the result
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS Success
+				 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The FaceLoop field was not found
+				 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The FaceLoop field is not a recognised value
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getColouredFaceLoops(bool * colouredFaceLoops);
+
 
 				// === Overloaded Methods ===
 				__attribute__((warn_unused_result))
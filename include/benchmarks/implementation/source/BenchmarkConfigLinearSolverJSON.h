@@ -48,7 +48,9 @@ namespace cupcfd
 		 * LinearSolver: Contains a JSON record for a linear solver to use for benchmarking.
 		 * Accepted record field names:
 		 * "LinearSolverPETSc" - Field name for a record that contains all fields needed to define a
-		 * LinearSolverConfigPETScJSON record. (See LinearSolverConfigPETScJSON.h")
+		 * LinearSolverConfigPETScJSON record. (See LinearSolverConfigPETScJSON.h"). Only accepted if built with PETSc.
+		 * "LinearSolverNative" - Field name for a record that contains all fields needed to define a
+		 * LinearSolverConfigNativeJSON record. (See LinearSolverConfigNativeJSON.h")
 		 *
 		 * SparseMatrix: Contains a JSON record for a SparseMatrix source to use with the linear solver for benchmarking.
 		 * Accepted record field names:
@@ -90,6 +90,25 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes getParticleSystemConfig(cupcfd::particles::ParticleSystemSimpleConfig<M,I,T,L> ** particleSystemConfig);
 
+				/**
+				 * Retrieve the rebalancing settings from the optional "Rebalance" field, which holds a "Threshold"
+				 * (the ratio of the largest to the average particle load above which the mesh is rebalanced), and
+				 * optionally an "Interval" (timesteps between checks, default 1) and a "CellCost" (weight of a cell
+				 * without particles relative to one particle, default 1).
+				 *
+				 * @param rebalanceThreshold A pointer to the location where the threshold will be stored
+				 * @param rebalanceInterval A pointer to the location where the interval will be stored
+				 * @param rebalanceCellCost A pointer to the location where the cell cost will be stored
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The "Rebalance" field was not found
+				 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The threshold is not greater than 1, the interval is
+				 * less than 1 or the cell cost is not greater than 0
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getRebalance(T * rebalanceThreshold, I * rebalanceInterval, T * rebalanceCellCost);
+
 				/**
 				 *
 				 */
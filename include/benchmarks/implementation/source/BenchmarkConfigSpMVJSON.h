@@ -0,0 +1,183 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Declaration for the BenchmarkConfigSpMVJSON class.
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_CONFIG_SPMV_JSON_INCLUDE_H
+#define CUPCFD_BENCHMARK_BENCHMARK_CONFIG_SPMV_JSON_INCLUDE_H
+
+// C++ Std Lib
+#include <string>
+
+// Error Codes
+#include "Error.h"
+
+#include "BenchmarkConfigSpMV.h"
+
+#include "ExchangePatternConfig.h"
+#include "SparseMatrixSourceConfig.h"
+
+// JsonCPP - Supplied as standalone in include/io/jsoncpp
+#include "json.h"
+#include "json-forwards.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		/**
+		 * Defines a interface for accessing SpMV Benchmark configuration
+		 * options from a JSON data source.
+		 *
+		 * === Fields ===
+		 *
+		 * Required:
+		 * BenchmarkName: String. Defines the benchmark name - also used for the overall benchmark timer identifier so
+		 * should be unique amongst benchmarks
+		 *
+		 * Repetitions: Integer. Defines the number of matrix-vector products to time
+		 *
+		 * SparseMatrix: A nested JSON record containing a SparseMatrixFile record that matches the pattern defined in
+		 * SparseMatrixSourceFileConfigJSON. The matrix must be square.
+		 *
+		 * Optional:
+		 * ExchangePattern: A nested JSON record that matches the pattern defined in ExchangePatternConfigSourceJSON.
+		 * This selects which exchange method to use for the ghost x entries (default NBTwoSided).
+		 *
+		 * MatrixFormat: String. The sparse matrix format to store the local rows in - "CSR" (default), "SELL" or "BCSR".
+		 *
+		 * SELLChunkSize: Integer. The number of rows per chunk of a SELL matrix (default 8).
+		 *
+		 * SELLSigma: Integer. The number of rows in each window sorted by row length for a SELL matrix (default 1).
+		 *
+		 * BlockSize: Integer. The number of rows and columns in each block of a BCSR matrix (default 3).
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The datatype of the matrix and vectors
+		 */
+		template <class I, class T>
+		class BenchmarkConfigSpMVJSON
+		{
+			public:
+				// === Members ===
+
+				/** Json Data Store containing fields for this JSON source **/
+				Json::Value configData;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Parse the JSON record provided for fields belonging to Configuration for BenchmarkSpMV JSON.
+				 * The fields are presumed to start from level 0 (i.e. they are not nested inside other objects)
+				 *
+				 * @param parseJSON The contents of a JSON record with the appropriate fields.
+				 */
+				BenchmarkConfigSpMVJSON(Json::Value& parseJSON);
+
+				/**
+				 * Deconstructor
+				 */
+				~BenchmarkConfigSpMVJSON();
+
+				// === Concrete Methods ===
+
+				/**
+				 *
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getBenchmarkName(std::string& benchmarkName);
+
+				/**
+				 *
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getBenchmarkRepetitions(I * repetitions);
+
+				/**
+				 *
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getSparseMatrixSourceConfig(cupcfd::data_structures::SparseMatrixSourceConfig<I,T> ** matrixSourceConfig);
+
+				/**
+				 * Get the configuration of the exchange pattern to use for the ghost x entries.
+				 *
+				 * @param patternConfig A pointer to the location where the new configuration will be created
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The configuration was built
+				 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The field was not present
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getExchangePatternConfig(cupcfd::comm::ExchangePatternConfig ** patternConfig);
+
+				/**
+				 * Get the sparse matrix format to store the local rows in.
+				 *
+				 * @param format A pointer to the location where the format will be stored
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The format was found
+				 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The field was not present
+				 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The field was not a known format
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getMatrixFormat(BenchSpMVMatrixFormat * format);
+
+				/**
+				 * Get the number of rows per chunk of a SELL matrix.
+				 *
+				 * @param chunkSize A pointer to the location where the chunk size will be stored
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The chunk size was found
+				 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The field was not present
+				 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The field was not a positive integer
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getSELLChunkSize(I * chunkSize);
+
+				/**
+				 * Get the number of rows in each window sorted by row length for a SELL matrix.
+				 *
+				 * @param sigma A pointer to the location where sigma will be stored
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS Sigma was found
+				 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The field was not present
+				 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The field was not a positive integer
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getSELLSigma(I * sigma);
+
+				/**
+				 * Get the number of rows and columns in each block of a BCSR matrix.
+				 *
+				 * @param blockSize A pointer to the location where the block size will be stored
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The block size was found
+				 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The field was not present
+				 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The field was not a positive integer
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getBlockSize(I * blockSize);
+
+				// === Overloaded Methods ===
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildBenchmarkConfig(BenchmarkConfigSpMV<I,T> ** config);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "BenchmarkConfigSpMVJSON.ipp"
+
+#endif
@@ -0,0 +1,25 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Header Level Definitions for the BenchmarkConfigSpMVJSON class.
+ */
+
+#ifndef CUPCFD_BENCHMARK_BENCHMARK_CONFIG_SPMV_JSON_IPP_H
+#define CUPCFD_BENCHMARK_BENCHMARK_CONFIG_SPMV_JSON_IPP_H
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		// Currently includes nothing here.
+		// Left as a placeholder.
+	}
+}
+
+#endif
@@ -97,13 +97,15 @@ namespace cupcfd
 												T * recvbuf, int * recvcounts, int *rdispls,
 												MPI_Comm comm) {
 				int mpi_err;
+				cupcfd::error::eCodes status;
 				
 				MPI_Datatype dType;
 				#pragma GCC diagnostic push
 				#pragma GCC diagnostic ignored "-Wuninitialized"
 				#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 				T dummy;
-				cupcfd::comm::mpi::getMPIType(dummy, &dType);
+				status = cupcfd::comm::mpi::getMPIType(dummy, &dType);
+				CHECK_ECODE(status)
 				#pragma GCC diagnostic pop
 
 				mpi_err = MPI_Alltoallv(sendbuf, sendcounts, sdispls, dType,
@@ -276,6 +276,58 @@ namespace cupcfd
 														int * rRanks, int nRRanks,
 														MPI_Comm comm,
 														MPI_Request * requests, int nRequests);
+
+			/**
+			 * Create persistent requests for the exchange of data between a set of processes.
+			 *
+			 * This sets up the same sends and receives as the ExchangeVMPIIsendIrecv variant that uses
+			 * preallocated requests, but uses MPI_Send_init/MPI_Recv_init rather than Isend/Irecv.
+			 * No communication takes place - the requests are inactive until started with
+			 * the MPI Startall wrapper, and can be restarted once completed (e.g. via the MPI Waitall wrapper).
+			 *
+			 * The buffers are bound to the requests, so the same buffers must be used for
+			 * packing/unpacking for as long as the requests exist. Requests for ranks with a count
+			 * of zero are not created.
+			 *
+			 * The requests must be released with MPI_Request_free when no longer required.
+			 *
+			 * @param sendBuffer Packed buffer of send data
+			 * @param nSendBuffer Number of elements in sendBuffer of type T
+			 * @param sendCount Array containing number of elements to send to rank of corresponding index in sRanks
+			 * @param nSendCount Number of elements in sendCount. Must be the same as nSRanks.
+			 * @param recvBuffer Packed buffer for receiving data
+			 * @param nRecvBuffer Number of elements in recvBuffer
+			 * @param recvCount Array containing number of elements to recv from rank of corresponding index in rRanks
+			 * @param nRecvCount Number of elements in recvCount.  Must be the same as nRRanks.
+			 * @param sRanks Array of ranks to send data to
+			 * @param nSRanks Number of elements in sRanks
+			 * @param rRanks Array of ranks to receive data from
+			 * @param nRRanks Number of elements in rRanks
+			 * @param comm MPI Communicator
+			 * @param requests The requests array for storing the persistent requests.
+			 * @param nRequests The size of the requests array. Must be large enough to hold all requests.
+			 * @param nCreated The number of requests created will be stored here.
+			 *
+			 * @tparam T The datatype of the data to be communicated. May be a supported primitive type or a class
+			 * that inherits from CustomMPIType.
+			 *
+			 * @retval E_SUCCESS The requests were created successfully.
+			 * @retval E_ARRAY_SIZE_UNDERSIZED One of the provided arrays is too small.
+			 * @retval E_MPI_DATATYPE_UNREGISTERED Datatype T does not have a datatype
+			 * registered with the MPI library.
+			 * @retval E_MPI_ERR An MPI Error was encountered.
+			 */
+			template <class T>
+			__attribute__((warn_unused_result))
+			cupcfd::error::eCodes ExchangeVMPISendRecvInit(T * sendBuffer, int nSendBuffer,
+															int * sendCount, int nSendCount,
+															T * recvBuffer, int nRecvBuffer,
+															int * recvCount, int nRecvCount,
+															int * sRanks, int nSRanks,
+															int * rRanks, int nRRanks,
+															MPI_Comm comm,
+															MPI_Request * requests, int nRequests,
+															int * nCreated);
 		}
 	}
 }
@@ -277,6 +277,98 @@ namespace cupcfd
 			}
 
 
+			template <class T>
+			cupcfd::error::eCodes ExchangeVMPISendRecvInit(T * sendBuffer, int nSendBuffer,
+															int * sendCount, int nSendCount,
+															T * recvBuffer, int nRecvBuffer,
+															int * recvCount, int nRecvCount,
+															int * sRanks, int nSRanks,
+															int * rRanks, int nRRanks,
+															MPI_Comm comm,
+															MPI_Request * requests, int nRequests,
+															int * nCreated) {
+				cupcfd::error::eCodes status;
+
+				if (nSendCount < nSRanks) {
+					return cupcfd::error::E_ARRAY_SIZE_UNDERSIZED;
+				}
+
+				if (nRecvCount < nRRanks) {
+					return cupcfd::error::E_ARRAY_SIZE_UNDERSIZED;
+				}
+
+				int sendSize = 0;
+				int recvSize = 0;
+				int nRequired = 0;
+
+				for(int i = 0; i < nSRanks; i++) {
+					if(sendCount[i] > 0) {
+						sendSize += sendCount[i];
+						nRequired++;
+					}
+				}
+
+				for(int i = 0; i < nRRanks; i++) {
+					if(recvCount[i] > 0) {
+						recvSize += recvCount[i];
+						nRequired++;
+					}
+				}
+
+				if (nSendBuffer < sendSize || nRecvBuffer < recvSize || nRequests < nRequired) {
+					return cupcfd::error::E_ARRAY_SIZE_UNDERSIZED;
+				}
+
+				int err;
+				int offset;
+				int reqPtr;
+
+				// Get the datatype based on the type of the dummy variable
+				MPI_Datatype dType;
+				#pragma GCC diagnostic push
+				#pragma GCC diagnostic ignored "-Wuninitialized"
+				#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+				T dummy;
+				status = cupcfd::comm::mpi::getMPIType(dummy, &dType);
+				CHECK_ECODE(status)
+				#pragma GCC diagnostic pop
+
+				int tag = 79;
+
+				// Setup the persistent recvs
+				offset = 0;
+				reqPtr = 0;
+				for(int i = 0; i < nRRanks; i++) {
+					if(recvCount[i] > 0) {
+						err = MPI_Recv_init(recvBuffer + offset, recvCount[i], dType, rRanks[i], tag, comm, requests + reqPtr);
+						offset += recvCount[i];
+						reqPtr++;
+
+						if(err != MPI_SUCCESS) {
+							return cupcfd::error::E_MPI_ERR;
+						}
+					}
+				}
+
+				// Setup the persistent sends
+				offset = 0;
+				for(int i = 0; i < nSRanks; i++) {
+					if(sendCount[i] > 0) {
+						err = MPI_Send_init(sendBuffer + offset, sendCount[i], dType, sRanks[i], tag, comm, requests + reqPtr);
+						offset += sendCount[i];
+						reqPtr++;
+
+						if(err != MPI_SUCCESS) {
+							return cupcfd::error::E_MPI_ERR;
+						}
+					}
+				}
+
+				*nCreated = reqPtr;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 /*
 			template <class T>
 			cupcfd::error::eCodes ExchangeVMPIPut(T * sendBuffer, int nSendBuffer,
@@ -0,0 +1,342 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the ExchangePatternMultiField class.
+ */
+
+#ifndef CUPCFD_COMM_EXCHANGE_PATTERN_MULTI_FIELD_INCLUDE_H
+#define CUPCFD_COMM_EXCHANGE_PATTERN_MULTI_FIELD_INCLUDE_H
+
+#include "ExchangePattern.h"
+#include "Communicator.h"
+#include "mpi.h"
+#include "Error.h"
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace cupcfd
+{
+	namespace comm
+	{
+		/**
+		 * Type-erased handle for a data array registered with an ExchangePatternMultiField.
+		 *
+		 * This permits arrays of different datatypes to be packed into, and unpacked from, the
+		 * same byte buffer. The elements are copied bytewise, so the datatypes must be trivially copyable.
+		 */
+		class ExchangeField
+		{
+			public:
+				/** Size of a single data element in bytes **/
+				int elementSize;
+
+				/** Alignment of a single data element in bytes **/
+				int elementAlign;
+
+				/** Size of the registered data array in number of elements **/
+				int nData;
+
+				/**
+				 * Constructor.
+				 *
+				 * @param elementSize The size of a single data element in bytes
+				 * @param elementAlign The alignment of a single data element in bytes
+				 * @param nData The size of the registered data array in number of elements
+				 */
+				ExchangeField(int elementSize, int elementAlign, int nData);
+
+				/**
+				 * Deconstructor
+				 */
+				virtual ~ExchangeField();
+
+				/**
+				 * Copy the elements at the provided local indexes from the registered
+				 * data array into the buffer, in order.
+				 *
+				 * @param buffer The location to pack to
+				 * @param localIdx The local indexes of the elements to pack
+				 * @param nLocalIdx The number of elements to pack
+				 *
+				 * @return Nothing
+				 */
+				virtual void pack(char * buffer, const int * localIdx, int nLocalIdx) = 0;
+
+				/**
+				 * Copy elements from the buffer, in order, to the provided local indexes of
+				 * the registered data array.
+				 *
+				 * @param buffer The location to unpack from
+				 * @param localIdx The local indexes to unpack the elements to
+				 * @param nLocalIdx The number of elements to unpack
+				 *
+				 * @return Nothing
+				 */
+				virtual void unpack(const char * buffer, const int * localIdx, int nLocalIdx) = 0;
+		};
+
+		/**
+		 * Typed ExchangeField for a data array of type F.
+		 *
+		 * @tparam F The datatype of the registered array. Can be a primitive type or
+		 * a fixed size, trivially copyable class such as EuclideanVector.
+		 */
+		template <class F>
+		class ExchangeFieldArray : public ExchangeField
+		{
+			static_assert(std::is_trivially_copyable<F>::value, "ExchangeFieldArray: fields are sent as bytes, so must be trivially copyable");
+
+			public:
+				/** The registered data array. This is not owned by the field. **/
+				F * data;
+
+				/**
+				 * Constructor.
+				 *
+				 * @param data The data array to register
+				 * @param nData The size of the data array in number of elements
+				 */
+				ExchangeFieldArray(F * data, int nData);
+
+				/**
+				 * Deconstructor
+				 */
+				~ExchangeFieldArray();
+
+				// Inherited Methods
+				inline void pack(char * buffer, const int * localIdx, int nLocalIdx);
+				inline void unpack(const char * buffer, const int * localIdx, int nLocalIdx);
+		};
+
+		/**
+		 * Exchanges multiple data arrays with the same exchange pattern in a single round
+		 * of messages.
+		 *
+		 * Each ExchangePattern<T> exchanges one array of one type per exchangeStart/exchangeStop pair,
+		 * so exchanging N fields pays N rounds of message latency to the same neighbours.
+		 * This class reuses the send/recv neighbour data of an initialised pattern, and packs every
+		 * registered array into one buffer such that only one message is sent to, and received from,
+		 * each neighbour rank per exchange.
+		 *
+		 * The message for each neighbour consists of a block for each field in the order they were
+		 * registered. Each block starts at an offset aligned for the type of its field, and each message
+		 * starts at a multiple of the largest fundamental alignment, so that fields of different types
+		 * (e.g. int, double, EuclideanVector<double,3>) can be mixed.
+		 *
+		 * Example of Usage:
+		 *
+		 *  ExchangePatternMultiField multiField;
+		 *  multiField.init(pattern);
+		 *  multiField.registerField(u, nCells);
+		 *  multiField.registerField(p, nCells);
+		 *  multiField.registerField(dPhidx, nCells);
+		 *
+		 *  multiField.exchangeStart();
+		 *  multiField.exchangeStop();
+		 *
+		 * Registered arrays are not copied, and must remain valid for as long as they are registered.
+		 */
+		class ExchangePatternMultiField
+		{
+			public:
+				// === Members ===
+
+				/** Communicator of ranks copied from the source pattern **/
+				cupcfd::comm::Communicator comm;
+
+				/** Distinct processes we are sending to **/
+				int * sProc;
+
+				/** Number of distinct processes we are sending to **/
+				int nSProc;
+
+				/** Offsets into sendLocalIdx for each sending process (size nSProc + 1) **/
+				int * sXAdj;
+
+				/** Local indexes of the elements to send, grouped by destination process **/
+				int * sendLocalIdx;
+
+				/** Size of sendLocalIdx **/
+				int nSendLocalIdx;
+
+				/** Distinct processes we are receiving from **/
+				int * rProc;
+
+				/** Number of distinct processes we are receiving from **/
+				int nRProc;
+
+				/** Offsets into recvLocalIdx for each receiving process (size nRProc + 1) **/
+				int * rXAdj;
+
+				/** Local indexes to unpack received elements to, grouped by source process **/
+				int * recvLocalIdx;
+
+				/** Size of recvLocalIdx **/
+				int nRecvLocalIdx;
+
+				/** The registered fields, in registration order **/
+				std::vector<std::unique_ptr<ExchangeField>> fields;
+
+				/** Byte offset of the message for each sending process in sendBuffer (size nSProc + 1) **/
+				std::vector<int> sendDispls;
+
+				/** Byte offset of the message for each receiving process in recvBuffer (size nRProc + 1) **/
+				std::vector<int> recvDispls;
+
+				/** Packed send data for all fields **/
+				std::vector<char> sendBuffer;
+
+				/** Packed recv data for all fields **/
+				std::vector<char> recvBuffer;
+
+				/** Non Blocking MPI - Requests **/
+				std::vector<MPI_Request> requests;
+
+				/** Number of requests active in the current exchange **/
+				int nActiveRequests;
+
+				/** Whether the buffers are sized for the currently registered fields **/
+				bool buffersValid;
+
+				/** Whether an exchange has been started and not yet stopped **/
+				bool exchangeActive;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Default Constructor:
+				 * initialises internal sizes to 0 and arrays to nullptr
+				 * so they can be detected as unallocated.
+				 */
+				ExchangePatternMultiField();
+
+				/**
+				 * Deconstructor.
+				 * Cleans up internally allocated arrays.
+				 */
+				~ExchangePatternMultiField();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Initialise from an existing, initialised, exchange pattern.
+				 *
+				 * The neighbour ranks and resolved local indexes of the pattern are copied, so the
+				 * pattern does not have to outlive this object. The datatype of the pattern does not
+				 * have to match that of any of the registered fields.
+				 *
+				 * @param pattern The initialised pattern to copy the exchange information from.
+				 *
+				 * @tparam P The datatype of the source pattern
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_FINALIZED This object has already been initialised
+				 */
+				template <class P>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes init(ExchangePattern<P>& pattern);
+
+				/**
+				 * Register a data array to be exchanged by this object.
+				 *
+				 * The array must be large enough to contain every local index used by the pattern.
+				 *
+				 * @param data The data array to register
+				 * @param nData The size of the data array in number of elements
+				 *
+				 * @tparam F The datatype of the data array
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_NULL_PTR The data array is a nullptr
+				 * @retval cupcfd::error::E_INVALID_INDEX The data array is smaller than the largest local index used by the pattern
+				 * @retval cupcfd::error::E_EXCHANGE_ACTIVE An exchange is in progress
+				 */
+				template <class F>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes registerField(F * data, int nData);
+
+				/**
+				 * Remove all registered data arrays.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_EXCHANGE_ACTIVE An exchange is in progress
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes clearFields();
+
+				/**
+				 * Get the number of registered data arrays.
+				 *
+				 * @return The number of registered fields
+				 */
+				inline int getNFields();
+
+				/**
+				 * Pack the send buffer with the data of every registered field.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes packSendBuffer();
+
+				/**
+				 * Unpack the recv buffer into every registered field.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes unpackRecvBuffer();
+
+				/**
+				 * Pack the send buffer and begin the exchange of all registered fields.
+				 * One message is posted per neighbour rank, regardless of the number of fields.
+				 *
+				 * It is safe to modify the registered arrays after this function is complete.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_NO_DATA No fields have been registered
+				 * @retval cupcfd::error::E_EXCHANGE_ACTIVE An exchange is already in progress
+				 * @retval cupcfd::error::E_MPI_ERR An MPI call returned an error
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes exchangeStart();
+
+				/**
+				 * Complete an active exchange, and unpack the received data into every registered field.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_MPI_ERR An MPI call returned an error
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes exchangeStop();
+
+			private:
+				/**
+				 * Compute the message displacements for the registered fields and size the buffers.
+				 *
+				 * @return Nothing
+				 */
+				void setupBuffers();
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "ExchangePatternMultiField.ipp"
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the ExchangePatternMultiField class.
+ */
+
+#ifndef CUPCFD_COMM_EXCHANGE_PATTERN_MULTI_FIELD_IPP_H
+#define CUPCFD_COMM_EXCHANGE_PATTERN_MULTI_FIELD_IPP_H
+
+#include "ArrayDrivers.h"
+
+#include <cstring>
+
+namespace cupcfd
+{
+	namespace comm
+	{
+		// === ExchangeFieldArray ===
+
+		template <class F>
+		ExchangeFieldArray<F>::ExchangeFieldArray(F * data, int nData)
+		: ExchangeField(sizeof(F), alignof(F), nData),
+		  data(data)
+		{
+
+		}
+
+		template <class F>
+		ExchangeFieldArray<F>::~ExchangeFieldArray() {
+			// Nothing to do - the data array is not owned by this object
+		}
+
+		template <class F>
+		inline void ExchangeFieldArray<F>::pack(char * buffer, const int * localIdx, int nLocalIdx) {
+			const F * src = this->data;
+
+			for(int i = 0; i < nLocalIdx; i++) {
+				std::memcpy(buffer + (i * sizeof(F)), src + localIdx[i], sizeof(F));
+			}
+		}
+
+		template <class F>
+		inline void ExchangeFieldArray<F>::unpack(const char * buffer, const int * localIdx, int nLocalIdx) {
+			F * dst = this->data;
+
+			for(int i = 0; i < nLocalIdx; i++) {
+				std::memcpy(dst + localIdx[i], buffer + (i * sizeof(F)), sizeof(F));
+			}
+		}
+
+		// === ExchangePatternMultiField ===
+
+		template <class P>
+		cupcfd::error::eCodes ExchangePatternMultiField::init(ExchangePattern<P>& pattern) {
+			if(this->sXAdj != nullptr) {
+				return cupcfd::error::E_FINALIZED;
+			}
+
+			this->comm = pattern.comm;
+
+			// Copy the neighbour data and resolved local indexes. This is independent of the pattern datatype.
+			this->nSProc = pattern.nSProc;
+			this->sProc = cupcfd::utility::drivers::duplicate(pattern.sProc, pattern.nSProc);
+			this->sXAdj = cupcfd::utility::drivers::duplicate(pattern.sXAdj, pattern.nSXAdj);
+			this->nSendLocalIdx = pattern.nSendLocalIdx;
+			this->sendLocalIdx = cupcfd::utility::drivers::duplicate(pattern.sendLocalIdx, pattern.nSendLocalIdx);
+
+			this->nRProc = pattern.nRProc;
+			this->rProc = cupcfd::utility::drivers::duplicate(pattern.rProc, pattern.nRProc);
+			this->rXAdj = cupcfd::utility::drivers::duplicate(pattern.rXAdj, pattern.nRXAdj);
+			this->nRecvLocalIdx = pattern.nRecvLocalIdx;
+			this->recvLocalIdx = cupcfd::utility::drivers::duplicate(pattern.recvLocalIdx, pattern.nRecvLocalIdx);
+
+			// One request per neighbour, regardless of how many fields are registered
+			this->requests.resize(this->nSProc + this->nRProc);
+
+			this->buffersValid = false;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class F>
+		cupcfd::error::eCodes ExchangePatternMultiField::registerField(F * data, int nData) {
+			// The buffers are in use until the exchange is stopped
+			if(this->exchangeActive) {
+				return cupcfd::error::E_EXCHANGE_ACTIVE;
+			}
+
+			if(data == nullptr) {
+				return cupcfd::error::E_NULL_PTR;
+			}
+
+			// Error Check: Every local index used by the pattern must exist in the data array
+			for(int i = 0; i < this->nSendLocalIdx; i++) {
+				if(this->sendLocalIdx[i] < 0 || this->sendLocalIdx[i] >= nData) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+			}
+
+			for(int i = 0; i < this->nRecvLocalIdx; i++) {
+				if(this->recvLocalIdx[i] < 0 || this->recvLocalIdx[i] >= nData) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+			}
+
+			this->fields.emplace_back(new ExchangeFieldArray<F>(data, nData));
+			this->buffersValid = false;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		inline int ExchangePatternMultiField::getNFields() {
+			return cupcfd::utility::drivers::safeConvertSizeT<int>(this->fields.size());
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,111 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the ExchangePatternNeighbourCollective class.
+ */
+
+#ifndef CUPCFD_COMM_EXCHANGE_PATTERN_NEIGHBOUR_COLLECTIVE_INCLUDE_H
+#define CUPCFD_COMM_EXCHANGE_PATTERN_NEIGHBOUR_COLLECTIVE_INCLUDE_H
+
+#include "ExchangePattern.h"
+#include "mpi.h"
+
+namespace cupcfd
+{
+	namespace comm
+	{
+		// This extends the exchange pattern object to perform the exchange with an MPI-3
+		// neighbourhood collective (MPI_Ineighbor_alltoallv).
+		// At init, a distributed graph communicator is built from the send/recv processes of the
+		// pattern, such that the MPI library is aware of the full neighbour topology and is free
+		// to optimise the exchange schedule.
+		template <class T>
+		class ExchangePatternNeighbourCollective : public ExchangePattern<T>
+		{
+			public:
+				/**
+				 * Distributed graph communicator. The destinations are the processes in sProc,
+				 * and the sources are the processes in rProc, in the same order.
+				 **/
+				MPI_Comm graphComm = MPI_COMM_NULL;
+
+				/** Non Blocking MPI - Request for the active neighbourhood collective **/
+				MPI_Request request = MPI_REQUEST_NULL;
+
+				/** Size of sendBuffer in number of elements of type T **/
+				int nSendBuffer;
+
+				/** Buffer for storing packed data to be sent when communicating **/
+				T * sendBuffer;
+
+				/** Size of recvBuffer in number of elements of type T **/
+				int nRecvBuffer;
+
+				/** Buffer for storing packed data received when communicating **/
+				T * recvBuffer;
+
+				/**
+				 * Size of send messages. Matched up by index to the processes in sProc.
+				**/
+				int * sendCounts;
+
+				/** Offset of each send message in sendBuffer. Matched up by index to the processes in sProc. **/
+				int * sendDispls;
+
+				/** Size of sendCounts/sendDispls in number of elements **/
+				int nSendCounts;
+
+				/**
+				 * Size of recv messages. Matched up by index to the processes in rProc.
+				**/
+				int * recvCounts;
+
+				/** Offset of each recv message in recvBuffer. Matched up by index to the processes in rProc. **/
+				int * recvDispls;
+
+				/** Size of recvCounts/recvDispls in number of elements **/
+				int nRecvCounts;
+
+				/**
+				 * Default Constructor:
+				 * initialises internal sizes to 0 and arrays/buffers to nullptr
+				 * so they can be detected as unallocated.
+				 */
+				ExchangePatternNeighbourCollective();
+
+				/**
+				 * Deconstructor.
+				 * Frees the graph communicator and cleans up internally allocated buffers/arrays.
+				 */
+				~ExchangePatternNeighbourCollective();
+
+				// Inherited Methods
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes init(cupcfd::comm::Communicator& comm,
+						  int * mapLocalToExchangeIDX, int nMapLocalToExchangeIDX,
+						  int * exchangeIDXSend, int nExchangeIDXSend,
+						  int * tRanks, int nTRanks);
+
+				T * getSendBuffer();
+
+				T * getRecvBuffer();
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes exchangeStart(T * sourceData, int nData);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes exchangeStop(T * sinkData, int nData);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "ExchangePatternNeighbourCollective.ipp"
+
+#endif
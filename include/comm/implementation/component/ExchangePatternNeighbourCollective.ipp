@@ -0,0 +1,25 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the ExchangePatternNeighbourCollective class.
+ */
+
+#ifndef CUPCFD_COMM_EXCHANGE_PATTERN_NEIGHBOUR_COLLECTIVE_IPP_H
+#define CUPCFD_COMM_EXCHANGE_PATTERN_NEIGHBOUR_COLLECTIVE_IPP_H
+
+namespace cupcfd
+{
+	namespace comm
+	{
+		// Nothing to include here for now.
+		// Left as a placeholder.
+	}
+}
+
+#endif
@@ -93,11 +93,9 @@ namespace cupcfd
 						  int * exchangeIDXSend, int nExchangeIDXSend,
 						  int * tRanks, int nTRanks);
 
-				__attribute__((warn_unused_result))
-				cupcfd::error::eCodes packSendBuffer(T * data, int nData);
-				
-				__attribute__((warn_unused_result))
-				cupcfd::error::eCodes unpackRecvBuffer(T * data, int nData);
+				T * getSendBuffer();
+
+				T * getRecvBuffer();
 
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes exchangeStart(T * sourceData, int nData);
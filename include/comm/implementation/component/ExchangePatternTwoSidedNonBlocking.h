@@ -87,11 +87,9 @@ namespace cupcfd
 						  int * exchangeIDXSend, int nExchangeIDXSend,
 						  int * tRanks, int nTRanks);
 
-				__attribute__((warn_unused_result))
-				cupcfd::error::eCodes packSendBuffer(T * data, int nData);
+				T * getSendBuffer();
 
-				__attribute__((warn_unused_result))
-				cupcfd::error::eCodes unpackRecvBuffer(T * data, int nData);
+				T * getRecvBuffer();
 
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes exchangeStart(T * sourceData, int nData);
@@ -0,0 +1,105 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the ExchangePatternTwoSidedPersistent class.
+ */
+
+#ifndef CUPCFD_COMM_EXCHANGE_PATTERN_TWO_SIDED_PERSISTENT_INCLUDE_H
+#define CUPCFD_COMM_EXCHANGE_PATTERN_TWO_SIDED_PERSISTENT_INCLUDE_H
+
+#include "ExchangePattern.h"
+#include "mpi.h"
+
+namespace cupcfd
+{
+	namespace comm
+	{
+		// This extends the exchange pattern object to use persistent two-sided
+		// non blocking comms (i.e. Send_init/Recv_init + Startall).
+		// Since the neighbours, message sizes and buffers of a pattern do not change
+		// after init, the requests are created once at init and restarted for every exchange,
+		// rather than being reposted with Isend/Irecv each time.
+		template <class T>
+		class ExchangePatternTwoSidedPersistent : public ExchangePattern<T>
+		{
+			public:
+
+				/** Persistent MPI Requests - created at init, started by every exchange **/
+				MPI_Request * requests;
+				int nRequests;
+
+				/** Size of sendBuffer in number of elements of type T **/
+				int nSendBuffer;
+
+				/** Buffer for storing packed data to be sent when communicating. Bound to the send requests. **/
+				T * sendBuffer;
+
+				/** Size of recvBuffer in number of elements of type T **/
+				int nRecvBuffer;
+
+				/** Buffer for storing packed data received when communicating. Bound to the recv requests. **/
+				T * recvBuffer;
+
+				/**
+				 * Size of send messages - These can be derived from the CSR arrays
+				 * but we'd prefer to only compute them once.
+				 * Matched up by index to the processes in sProc.
+				**/
+				int * sendCounts;
+
+				/** Size of sendCounts in number of elements **/
+				int nSendCounts;
+
+				/**
+				 * Size of recv messages - These can be derived from the CSR arrays
+				 * but we'd prefer to only compute them once.
+				 * Matched up by index to the processes in rProc.
+				**/
+				int * recvCounts;
+
+				/** Size of recvCounts in number of elements **/
+				int nRecvCounts;
+
+				/**
+				 * Default Constructor:
+				 * initialises internal sizes to 0 and arrays/buffers to nullptr
+				 * so they can be detected as unallocated.
+				 */
+				ExchangePatternTwoSidedPersistent();
+
+				/**
+				 * Deconstructor.
+				 * Frees the persistent requests and cleans up internally allocated buffers/arrays.
+				 */
+				~ExchangePatternTwoSidedPersistent();
+
+				// Inherited Methods
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes init(cupcfd::comm::Communicator& comm,
+						  int * mapLocalToExchangeIDX, int nMapLocalToExchangeIDX,
+						  int * exchangeIDXSend, int nExchangeIDXSend,
+						  int * tRanks, int nTRanks);
+
+				T * getSendBuffer();
+
+				T * getRecvBuffer();
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes exchangeStart(T * sourceData, int nData);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes exchangeStop(T * sinkData, int nData);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "ExchangePatternTwoSidedPersistent.ipp"
+
+#endif
@@ -16,6 +16,9 @@
 #include "mpi.h"
 #include "CustomMPIType.h"
 
+#include <type_traits>
+#include <utility>
+
 // Error Codes
 #include "Error.h"
 
@@ -79,6 +82,43 @@ namespace cupcfd
 			 */
 			__attribute__((warn_unused_result))
 			cupcfd::error::eCodes getMPIType(cupcfd::comm::mpi::CustomMPIType& customObject, MPI_Datatype * mpiType);
+
+			/**
+			 * Identifies classes that provide their MPI Datatype through a static method of the form
+			 * static cupcfd::error::eCodes getMPIType(MPI_Datatype * dType), rather than by inheriting
+			 * from CustomMPIType. This avoids a vtable pointer in small types that are stored in bulk.
+			 *
+			 * @tparam C The class to test
+			 */
+			template <class C, class = void>
+			struct HasStaticMPIType : std::false_type
+			{
+			};
+
+			template <class C>
+			struct HasStaticMPIType<C, std::void_t<decltype(C::getMPIType(std::declval<MPI_Datatype *>()))>>
+			: std::integral_constant<bool, !std::is_base_of<cupcfd::comm::mpi::CustomMPIType, C>::value>
+			{
+			};
+
+			/**
+			 * Gets the MPI Datatype for any class that registers its datatype via static methods
+			 * (see HasStaticMPIType).
+			 *
+			 * @param dummy A dummy variable. Value does not matter, it merely informs the type for specialised methods.
+			 * @param mpiType A pointer to where the retrieved MPI_Datatype will be stored.
+			 *
+			 * @tparam C The class of the object
+			 *
+			 * @return An error status indicating the success or failure of the operation
+			 * @retval E_SUCCESS Operation was completed successfully
+			 * @retval cupcfd::error::E_MPI_DATATYPE_UNREGISTERED The class has not yet registered its datatype with
+			 * the MPI library
+			 */
+			template <class C>
+			__attribute__((warn_unused_result))
+			inline typename std::enable_if<HasStaticMPIType<C>::value, cupcfd::error::eCodes>::type
+			getMPIType(const C& dummy __attribute__((unused)), MPI_Datatype * mpiType);
 		} // namespace mpi
 	} // namespace comm
 } // namespace cupcfd
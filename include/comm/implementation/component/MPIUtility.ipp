@@ -19,8 +19,11 @@ namespace cupcfd
 	{
 		namespace mpi
 		{
-			// Nothing to include here for now.
-			// Left as a placeholder.		
+			template <class C>
+			inline typename std::enable_if<HasStaticMPIType<C>::value, cupcfd::error::eCodes>::type
+			getMPIType(const C& dummy __attribute__((unused)), MPI_Datatype * mpiType) {
+				return C::getMPIType(mpiType);
+			}
 		}
 	}
 }
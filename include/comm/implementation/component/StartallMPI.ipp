@@ -0,0 +1,39 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for MPI Startall Operations
+ *
+ */
+
+#ifndef CUPCFD_COMM_MPI_STARTALL_IPP_H
+#define CUPCFD_COMM_MPI_STARTALL_IPP_H
+
+namespace cupcfd
+{
+	namespace comm
+	{
+		namespace mpi
+		{
+			inline cupcfd::error::eCodes StartallMPI(MPI_Request * requests, int nRequests)
+			{
+				int err;
+
+				err = MPI_Startall(nRequests, requests);
+				if(err != MPI_SUCCESS)
+				{
+					return cupcfd::error::E_MPI_ERR;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+		}
+	}
+}
+
+#endif
@@ -22,7 +22,7 @@ namespace cupcfd
 	{
 		namespace mpi
 		{
-			cupcfd::error::eCodes WaitallMPI(MPI_Request * requests, int nRequests)
+			inline cupcfd::error::eCodes WaitallMPI(MPI_Request * requests, int nRequests)
 			{
 				int err;
 
@@ -27,7 +27,9 @@ namespace cupcfd
 		enum ExchangeMethod
 		{
 			EXCHANGE_NONBLOCKING_ONE_SIDED,
-			EXCHANGE_NONBLOCKING_TWO_SIDED
+			EXCHANGE_NONBLOCKING_TWO_SIDED,
+			EXCHANGE_NONBLOCKING_TWO_SIDED_PERSISTENT,
+			EXCHANGE_NONBLOCKING_NEIGHBOUR_COLLECTIVE
 		};
 
 
@@ -113,6 +115,23 @@ namespace cupcfd
 				 */
 				inline ExchangePatternConfig * clone();
 
+				/**
+				 * Creates an ExchangePattern object of the configured exchange method.
+				 * The pattern is not initialised, so this can be used for exchanges that
+				 * are not based on a distributed graph.
+				 *
+				 * @param pattern A pointer to where the pointer for the newly created ExchangePattern will be stored.
+				 *
+				 * @tparam T The type of the data to be exchanged.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_CONFIG_INVALID_OPTION The exchange method is not recognised
+				 */
+				template <class T>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes createExchangePattern(ExchangePattern<T>** pattern);
+
 				/**
 				 * Builds an ExchangePattern object, and sets up the exchange pattern
 				 * based on the exchange of ghost cell data between the distributed regions of the graph.
@@ -15,6 +15,8 @@
 
 #include "ExchangePatternOneSidedNonBlocking.h"
 #include "ExchangePatternTwoSidedNonBlocking.h"
+#include "ExchangePatternTwoSidedPersistent.h"
+#include "ExchangePatternNeighbourCollective.h"
 
 #include "ArrayDrivers.h"
 
@@ -38,11 +40,8 @@ namespace cupcfd
 			return new ExchangePatternConfig(*this);
 		}
 		
-		template <class I, class T, class N>
-		cupcfd::error::eCodes ExchangePatternConfig::buildExchangePattern(ExchangePattern<T> ** pattern, 
-																			cupcfd::data_structures::DistributedAdjacencyList<I, N>& graph) {
-			cupcfd::error::eCodes status;
-
+		template <class T>
+		cupcfd::error::eCodes ExchangePatternConfig::createExchangePattern(ExchangePattern<T> ** pattern) {
 			// Create a pattern of an appropriate type.
 			ExchangeMethod method = this->getExchangeMethod();
 
@@ -52,6 +51,27 @@ namespace cupcfd
 			else if(method == EXCHANGE_NONBLOCKING_TWO_SIDED) {
 				*pattern = new ExchangePatternTwoSidedNonBlocking<T>();
 			}
+			else if(method == EXCHANGE_NONBLOCKING_TWO_SIDED_PERSISTENT) {
+				*pattern = new ExchangePatternTwoSidedPersistent<T>();
+			}
+			else if(method == EXCHANGE_NONBLOCKING_NEIGHBOUR_COLLECTIVE) {
+				*pattern = new ExchangePatternNeighbourCollective<T>();
+			}
+			else {
+				return cupcfd::error::E_CONFIG_INVALID_OPTION;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T, class N>
+		cupcfd::error::eCodes ExchangePatternConfig::buildExchangePattern(ExchangePattern<T> ** pattern, 
+																			cupcfd::data_structures::DistributedAdjacencyList<I, N>& graph) {
+			cupcfd::error::eCodes status;
+
+			// Create a pattern of an appropriate type.
+			status = this->createExchangePattern(pattern);
+			CHECK_ECODE(status)
 
 			// Items needed to initialise the exchange pattern
 			// (a) Communicator (taken from graph)
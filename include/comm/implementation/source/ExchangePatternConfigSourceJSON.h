@@ -38,8 +38,9 @@ namespace cupcfd
 		 * === Fields ===
 		 *
 		 * Required:
-		 * Method: String - Valid Entries are "NBOneSided", "NBTwoSided".
-		 * Chooses between one sided and two sided non-blocking communications for
+		 * Method: String - Valid Entries are "NBOneSided", "NBTwoSided", "NBTwoSidedPersistent", "NBNeighbourCollective".
+		 * Chooses between one sided, two sided, two sided persistent (i.e. requests created once
+		 * and restarted per exchange) and neighbourhood collective non-blocking communications for
 		 * performing the exchange
 		 *
 		 * Optional:
@@ -0,0 +1,113 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for overlapping computation with an ExchangePattern data exchange.
+ */
+
+#ifndef CUPCFD_COMM_EXCHANGE_OVERLAP_INCLUDE_H
+#define CUPCFD_COMM_EXCHANGE_OVERLAP_INCLUDE_H
+
+#include "ExchangePattern.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace comm
+	{
+		/**
+		 * Accumulates the time spent in each phase of one or more overlapped exchanges (see exchangeOverlap).
+		 *
+		 * The overlap fraction is the proportion of the time between starting and finishing the exchange
+		 * that was spent on the interior work rather than waiting in exchangeStop. If the exchange would
+		 * have outlasted the interior work this is the fraction of the exchange latency that was hidden.
+		 * It approaches 1 once the interior work covers the whole exchange.
+		 */
+		class ExchangeOverlapTiming
+		{
+			public:
+				// === Members ===
+
+				/** Time spent in exchangeStart (packing and posting the exchange), in seconds **/
+				double startTime;
+
+				/** Time spent on the work that does not depend on the exchanged data, in seconds **/
+				double interiorTime;
+
+				/** Time spent in exchangeStop (waiting for and unpacking the exchange), in seconds **/
+				double waitTime;
+
+				/** Time spent on the work that depends on the exchanged data, in seconds **/
+				double haloTime;
+
+				/** Number of exchanges timed **/
+				int nExchanges;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Constructor.
+				 * Sets all times to zero.
+				 */
+				ExchangeOverlapTiming();
+
+				/**
+				 * Deconstructor
+				 */
+				~ExchangeOverlapTiming();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Set all times to zero.
+				 *
+				 * @return Nothing
+				 */
+				void reset();
+
+				/**
+				 * Get the fraction of the exchange that was overlapped with the interior work.
+				 *
+				 * @return The overlap fraction, between 0 and 1. Zero if nothing has been timed.
+				 */
+				__attribute__((warn_unused_result))
+				double getOverlapFraction();
+		};
+
+		/**
+		 * Exchange data with an ExchangePattern while doing work that does not depend on the exchanged data.
+		 *
+		 * The exchange is started, interiorWork is run, the exchange is completed (so data holds the exchanged
+		 * values) and finally haloWork is run. The exchange is always completed, even if interiorWork fails.
+		 *
+		 * @param pattern The exchange pattern to use
+		 * @param data The data array to send from and receive into
+		 * @param nData The size of data in elements of type T
+		 * @param interiorWork Callable returning a cupcfd::error::eCodes, for the work that can run during the exchange
+		 * @param haloWork Callable returning a cupcfd::error::eCodes, for the work that needs the exchanged data
+		 * @param timing Timing to add the time of each phase to. May be nullptr.
+		 *
+		 * @tparam T The datatype of the data to be communicated
+		 * @tparam F The type of interiorWork
+		 * @tparam G The type of haloWork
+		 *
+		 * @return An error status indicating the success or failure of the operation
+		 * @retval cupcfd::error::E_SUCCESS Success
+		 * @retval Otherwise the first error returned by the exchange or either of the work callables
+		 */
+		template <class T, class F, class G>
+		__attribute__((warn_unused_result))
+		cupcfd::error::eCodes exchangeOverlap(ExchangePattern<T>& pattern, T * data, int nData,
+											  F interiorWork, G haloWork, ExchangeOverlapTiming * timing);
+	}
+}
+
+// Include Header Level Definitions
+#include "ExchangeOverlap.ipp"
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for overlapping computation with an ExchangePattern data exchange.
+ */
+
+#ifndef CUPCFD_COMM_EXCHANGE_OVERLAP_IPP_H
+#define CUPCFD_COMM_EXCHANGE_OVERLAP_IPP_H
+
+#include "mpi.h"
+
+namespace cupcfd
+{
+	namespace comm
+	{
+		template <class T, class F, class G>
+		cupcfd::error::eCodes exchangeOverlap(ExchangePattern<T>& pattern, T * data, int nData,
+											  F interiorWork, G haloWork, ExchangeOverlapTiming * timing) {
+			cupcfd::error::eCodes status;
+			cupcfd::error::eCodes workStatus;
+
+			double t0 = MPI_Wtime();
+
+			status = pattern.exchangeStart(data, nData);
+			CHECK_ECODE(status)
+
+			double t1 = MPI_Wtime();
+
+			workStatus = interiorWork();
+
+			double t2 = MPI_Wtime();
+
+			// Always complete the exchange so that it is not left active if the interior work failed
+			status = pattern.exchangeStop(data, nData);
+			CHECK_ECODE(status)
+
+			if(workStatus != cupcfd::error::E_SUCCESS) {
+				return workStatus;
+			}
+
+			double t3 = MPI_Wtime();
+
+			workStatus = haloWork();
+			if(workStatus != cupcfd::error::E_SUCCESS) {
+				return workStatus;
+			}
+
+			double t4 = MPI_Wtime();
+
+			if(timing != nullptr) {
+				timing->startTime += t1 - t0;
+				timing->interiorTime += t2 - t1;
+				timing->waitTime += t3 - t2;
+				timing->haloTime += t4 - t3;
+				timing->nExchanges++;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
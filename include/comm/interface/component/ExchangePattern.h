@@ -156,6 +156,23 @@ namespace cupcfd
 				/** CSR Data - Size of sAdjncy (should be number of receiving elements) **/
 				int nRAdjncy;
 
+				// === Resolved Local Index Data ===
+				// The exchange indexes in sAdjncy/rAdjncy are translated to local indexes once at init,
+				// so packing/unpacking is a plain gather/scatter rather than a map lookup per element.
+				// The exchangeToLocal/localToExchange maps are retained for setup-time queries only.
+
+				/** Local indexes of the data elements to pack into the send buffer, matching sAdjncy by position **/
+				int * sendLocalIdx;
+
+				/** Size of sendLocalIdx (should be the same as nSAdjncy) **/
+				int nSendLocalIdx;
+
+				/** Local indexes to unpack the recv buffer elements to, matching rAdjncy by position **/
+				int * recvLocalIdx;
+
+				/** Size of recvLocalIdx (should be the same as nRAdjncy) **/
+				int nRecvLocalIdx;
+
 				// === Constructors/Deconstructors ===
 
 				/**
@@ -191,6 +208,10 @@ namespace cupcfd
 				 * @param nExchangeIDXSend The size of the exchangeIDXSend array
 				 * @param tRanks The target ranks for the elements in exchangeIDXSend to be sent to, paired by index
 				 * @param nTRanks The size of the tRanks array
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_INVALID_INDEX An exchange index to be sent or received has no local index mapping
 				 */
 				__attribute__((warn_unused_result))
 				virtual cupcfd::error::eCodes init(cupcfd::comm::Communicator& comm,
@@ -221,10 +242,12 @@ namespace cupcfd
 				 * @tparam T The datatype of the data to be communicated.
 				 * Can be a supported primitive type or a CustomMPIType.
 				 *
-				 * @return Nothing
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_INVALID_INDEX A local index to pack is outside the data array (DEBUG only)
 				 */
 				__attribute__((warn_unused_result))
-				virtual cupcfd::error::eCodes packSendBuffer(T * data, int nData) = 0;
+				virtual cupcfd::error::eCodes packSendBuffer(T * data, int nData);
 
 				/**
 				 * Unpack the recv buffer into the provided data array,
@@ -250,10 +273,32 @@ namespace cupcfd
 				 * @tparam T The datatype of the data to be communicated.
 				 * Can be a supported primitive type or a CustomMPIType.
 				 *
-				 * @return Nothing
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_INVALID_INDEX A local index to unpack to is outside the data array (DEBUG only)
 				 */
 				__attribute__((warn_unused_result))
-				virtual cupcfd::error::eCodes unpackRecvBuffer(T * data, int nData) = 0;
+				virtual cupcfd::error::eCodes unpackRecvBuffer(T * data, int nData);
+
+				/**
+				 * Get the buffer that packSendBuffer packs into. It holds nSendLocalIdx elements,
+				 * grouped by destination process in the order of sAdjncy.
+				 *
+				 * @tparam T The datatype of the data to be communicated.
+				 *
+				 * @return A pointer to the send buffer
+				 */
+				virtual T * getSendBuffer() = 0;
+
+				/**
+				 * Get the buffer that unpackRecvBuffer unpacks from. It holds nRecvLocalIdx elements,
+				 * grouped by source process in the order of rAdjncy.
+				 *
+				 * @tparam T The datatype of the data to be communicated.
+				 *
+				 * @return A pointer to the recv buffer
+				 */
+				virtual T * getRecvBuffer() = 0;
 
 				/**
 				 * Begin a data exchange using the stored pattern.
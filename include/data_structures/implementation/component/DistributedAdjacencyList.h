@@ -23,6 +23,7 @@
 #include "AdjacencyList.h"
 #include "AdjacencyListCSR.h"
 #include "AdjacencyListVector.h"
+#include "HashMap.h"
 #include "Error.h"
 #include "ExchangePattern.h"
 #include "ExchangePatternTwoSidedNonBlocking.h"
@@ -91,14 +92,14 @@ namespace cupcfd
 				/** Final Local Connectivity Graph **/
 				cupcfd::data_structures::AdjacencyListCSR<I, T> connGraph;
 
-				// ToDo: Make these unordered_maps for performance improvement
-				// May require changing the unit tests since the order from get functions would no longer be guaranteed.
+				// ToDo: nodeDistType is iterated in node order by getLocalNodes/getGhostNodes, so remains a std::map
+				// for now. Changing it would require changing the unit tests since the order from get functions would no longer be guaranteed.
 
 				/** Map node to a local/ghost type **/
 				std::map<T, nodeType> nodeDistType;
 
 				/** Map node to the process that owns it **/
-				std::map<T, I> nodeOwner;
+				IndexMap<T, I> nodeOwner;
 
 				/** Track the neighbouring process ranks **/
 				std::vector<I> neighbourRanks;
@@ -138,10 +139,10 @@ namespace cupcfd
 				 */
 
 				/** Map a node (not the localID) to a global id. **/
-				std::map<T, I> nodeToGlobal;
+				IndexMap<T, I> nodeToGlobal;
 
 				/** Map a global id to a node (not the localID). **/
-				std::map<I, T> globalToNode;
+				IndexMap<I, T> globalToNode;
 
 				/** Store the number of graph nodes on a process - only valids after finalizing. **/
 				std::vector<I> processNodeCounts;
@@ -361,6 +362,41 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes sortNodesByLocal();
 
+				/**
+				 * Renumber the local nodes of a finalized graph, so that their local indexes follow the order
+				 * provided. Ghost nodes keep their existing local indexes after the local nodes.
+				 *
+				 * @param nodes The node data of every local node, in the new local index order
+				 * @param nNodes The size of nodes in the number of elements of type T. Must match the number of local nodes.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_DISTGRAPH_UNFINALIZED The graph is not finalized
+				 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH nNodes does not match the number of local nodes
+				 * @retval cupcfd::error::E_INVALID_INDEX A node is not a local node, or is listed more than once
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes reorderLocalNodes(T * nodes, I nNodes);
+
+				/**
+				 * Rebuild the local connectivity graph with the local nodes in the order provided, followed by
+				 * the ghost nodes in ascending node order. Used by sortNodesByLocal and reorderLocalNodes.
+				 *
+				 * @param localNodes The node data of every local node, in the new local index order
+				 * @param nLocalNodes The size of localNodes in the number of elements of type T
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes rebuildLocalGraph(T * localNodes, I nLocalNodes);
+
 				//template <class T>
 				//cupcfd::adjacency_list::eCodes getNodeOwner(DistributedAdjacencyList<I, T>& list, T node, int * process);
 
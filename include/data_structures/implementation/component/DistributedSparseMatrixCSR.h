@@ -0,0 +1,229 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the DistributedSparseMatrixCSR class
+ *
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_MATRICES_DISTRIBUTED_SPARSEMATRIXCSR_INCLUDE_H
+#define CUPCFD_DATA_STRUCTURES_MATRICES_DISTRIBUTED_SPARSEMATRIXCSR_INCLUDE_H
+
+#include <vector>
+
+#include "Communicator.h"
+#include "Error.h"
+#include "ExchangeOverlap.h"
+#include "ExchangePattern.h"
+#include "ExchangePatternConfig.h"
+#include "SparseMatrix.h"
+#include "SparseMatrixCSR.h"
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		/**
+		 * A square sparse matrix in the CSR format whose rows are distributed across the processes of a
+		 * communicator, for computing distributed matrix-vector products (y = Ax).
+		 *
+		 * Each process owns a contiguous block of rows, with the blocks in rank order. The entries of the
+		 * x and y vectors are distributed in the same way as the rows. The columns of the local rows are
+		 * renumbered so that the owned columns come first, followed by the ghost columns (the columns whose
+		 * x entries are owned by another process).
+		 *
+		 * The local rows are split into interior rows, which only have owned columns, and halo rows, which
+		 * have at least one ghost column. The interior rows are computed while the ghost x entries are being
+		 * exchanged, and the halo rows once they have arrived.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the stored matrix data
+		 */
+		template <class I, class T>
+		class DistributedSparseMatrixCSR
+		{
+			public:
+				// === Members ===
+
+				/** The communicator of the processes the rows are distributed over **/
+				cupcfd::comm::Communicator comm;
+
+				/** Number of rows (and columns) of the full matrix **/
+				I mGlobal;
+
+				/** The rows owned by rank r are rowRanges[r] to rowRanges[r+1] - 1 (base index of 0) **/
+				std::vector<I> rowRanges;
+
+				/** Number of rows owned by this process **/
+				I mLocal;
+
+				/**
+				 * The owned rows of the matrix, with local row and column indexes and a base index of 0.
+				 * Owned columns are numbered 0 to mLocal - 1, ghost column i is numbered mLocal + i.
+				 * Each row is sorted by column, so the owned columns come first.
+				 **/
+				SparseMatrixCSR<I,T> localA;
+
+				/** The global column index of each ghost column, in ascending order **/
+				std::vector<I> ghostGlobalIDs;
+
+				/** The local rows that only have owned columns **/
+				std::vector<I> interiorRows;
+
+				/** The local rows that have at least one ghost column **/
+				std::vector<I> haloRows;
+
+				/**
+				 * For each non-zero of the owned rows in the matrix used at construction (in its CSR order), the
+				 * position of the non-zero in localA. Used to copy in the values of a matrix with the same structure.
+				 **/
+				std::vector<I> valueMap;
+
+				/** Exchange of the ghost x entries. Null if the communicator has a single process. **/
+				cupcfd::comm::ExchangePattern<T> * haloPattern;
+
+				/** Work vector holding the owned x entries followed by the ghost x entries **/
+				std::vector<T> xHalo;
+
+				/** Time spent in each phase of the exchange/compute overlap, accumulated over every multiply **/
+				cupcfd::comm::ExchangeOverlapTiming timing;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Build a distributed matrix from the rows of a matrix stored on this process.
+				 * This is a collective operation.
+				 *
+				 * @param comm The communicator to distribute the matrix over
+				 * @param matrix A matrix with the dimensions of the full matrix, that stores (at least) the
+				 * rows owned by this process. Any other rows are ignored.
+				 * @param rowStart The first row owned by this process (base index of 0)
+				 * @param rowEnd One past the last row owned by this process (base index of 0)
+				 * @param patternConfig The configuration of the exchange pattern to use for the ghost x entries
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored matrix data
+				 */
+				DistributedSparseMatrixCSR(cupcfd::comm::Communicator& comm, SparseMatrixCSR<I,T>& matrix,
+										   I rowStart, I rowEnd, cupcfd::comm::ExchangePatternConfig& patternConfig);
+
+				/**
+				 * Deconstructor
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored matrix data
+				 */
+				~DistributedSparseMatrixCSR();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Build the local rows, the ghost column list and the exchange pattern.
+				 * This is a collective operation.
+				 *
+				 * @param matrix A matrix with the dimensions of the full matrix that stores the owned rows
+				 * @param rowStart The first row owned by this process (base index of 0)
+				 * @param rowEnd One past the last row owned by this process (base index of 0)
+				 * @param patternConfig The configuration of the exchange pattern to use for the ghost x entries
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS Success
+				 * @retval cupcfd::error::E_MATRIX_INVALID_COL_SIZE The matrix is not square
+				 * @retval cupcfd::error::E_MATRIX_ROW_OOB The row ranges of the processes do not cover the
+				 * matrix in rank order
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setup(SparseMatrixCSR<I,T>& matrix, I rowStart, I rowEnd,
+											cupcfd::comm::ExchangePatternConfig& patternConfig);
+
+				/**
+				 * Get the rank of the process that owns a row (and the x and y entries of that row).
+				 *
+				 * @param row The global row index (base index of 0)
+				 *
+				 * @return The owning rank
+				 */
+				inline int getRowOwner(I row);
+
+				/**
+				 * Copy in the values of a matrix with the same non-zero structure as the matrix used at construction.
+				 * This is not a collective operation.
+				 *
+				 * @param matrix The matrix to copy the values of the owned rows from
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS Success
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The owned rows of the matrix have a different
+				 * number of non-zeroes to the matrix used at construction
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValues(SparseMatrixCSR<I,T>& matrix);
+
+				/**
+				 * Compute y = Ax, overlapping the exchange of the ghost x entries with the interior rows.
+				 * This is a collective operation.
+				 *
+				 * @param x The owned entries of x
+				 * @param nX The number of entries in x. Must be mLocal.
+				 * @param y The array to store the owned entries of y in
+				 * @param nY The number of entries in y. Must be mLocal.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS Success
+				 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH x or y are not of size mLocal
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes multiply(T * x, I nX, T * y, I nY);
+
+				/**
+				 * Split the owned rows into the entries of the owned columns and the entries of the ghost columns,
+				 * so that they can be converted into another sparse matrix format and multiplied with the
+				 * templated multiply. Both matrices have mLocal rows and a base index of 0.
+				 * This is not a collective operation.
+				 *
+				 * @param ownedA The matrix to store the owned columns in (mLocal columns)
+				 * @param ghostA The matrix to store the ghost columns in. Ghost column i is column i of this
+				 * matrix. If there are no ghost columns, it has a single empty column.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS Success
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes splitLocalMatrix(SparseMatrixCSR<I,T>& ownedA, SparseMatrixCSR<I,T>& ghostA);
+
+				/**
+				 * Compute y = Ax using the owned and ghost column matrices built by splitLocalMatrix (in any
+				 * sparse matrix format). The product of the owned columns is computed while the ghost x entries
+				 * are exchanged, and the product of the ghost columns is added once they have arrived.
+				 * This is a collective operation.
+				 *
+				 * @param ownedA The owned columns of the owned rows
+				 * @param ghostA The ghost columns of the owned rows
+				 * @param x The owned entries of x
+				 * @param nX The number of entries in x. Must be mLocal.
+				 * @param y The array to store the owned entries of y in
+				 * @param nY The number of entries in y. Must be mLocal.
+				 *
+				 * @tparam C The specialisation class of the sparse matrices
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS Success
+				 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH x or y are not of size mLocal, or the
+				 * matrices do not have the sizes built by splitLocalMatrix
+				 */
+				template <class C>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes multiply(SparseMatrix<C,I,T>& ownedA, SparseMatrix<C,I,T>& ghostA, T * x, I nX, T * y, I nY);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "DistributedSparseMatrixCSR.ipp"
+
+#endif
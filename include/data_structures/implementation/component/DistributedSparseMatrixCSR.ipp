@@ -0,0 +1,73 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the DistributedSparseMatrixCSR class
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_MATRICES_DISTRIBUTED_SPARSEMATRIXCSR_IPP_H
+#define CUPCFD_DATA_STRUCTURES_MATRICES_DISTRIBUTED_SPARSEMATRIXCSR_IPP_H
+
+#include <algorithm>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		template <class I, class T>
+		inline int DistributedSparseMatrixCSR<I,T>::getRowOwner(I row) {
+			// Ranks that own no rows have the same start as the next rank, so take the last range starting at or before row
+			return int(std::upper_bound(this->rowRanges.begin(), this->rowRanges.end() - 1, row) - this->rowRanges.begin()) - 1;
+		}
+
+		template <class I, class T>
+		template <class C>
+		cupcfd::error::eCodes DistributedSparseMatrixCSR<I,T>::multiply(SparseMatrix<C,I,T>& ownedA, SparseMatrix<C,I,T>& ghostA,
+																		 T * x, I nX, T * y, I nY) {
+			cupcfd::error::eCodes status;
+
+			if(nX != this->mLocal || nY != this->mLocal) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			I nGhost = I(this->ghostGlobalIDs.size());
+
+			std::copy(x, x + this->mLocal, this->xHalo.begin());
+
+			auto interiorWork = [&]() -> cupcfd::error::eCodes {
+				return ownedA.multiply(x, nX, y, nY);
+			};
+
+			// Rows without ghost columns are empty in ghostA, so adding its product only changes the halo rows
+			auto haloWork = [&]() -> cupcfd::error::eCodes {
+				if(nGhost == 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				return ghostA.multiplyAdd(this->xHalo.data() + this->mLocal, nGhost, y, nY);
+			};
+
+			if(this->haloPattern == nullptr) {
+				status = interiorWork();
+				CHECK_ECODE(status)
+
+				status = haloWork();
+				CHECK_ECODE(status)
+			}
+			else {
+				status = cupcfd::comm::exchangeOverlap(*(this->haloPattern), this->xHalo.data(), int(this->xHalo.size()),
+													   interiorWork, haloWork, &(this->timing));
+				CHECK_ECODE(status)
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,243 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the HashMap class and the IndexMap alias
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_HASH_MAP_INCLUDE_H
+#define CUPCFD_DATA_STRUCTURES_HASH_MAP_INCLUDE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		/**
+		 * Open-addressing (linear probing) hash map for mapping labels/IDs to indexes.
+		 *
+		 * This is intended as a drop-in replacement for the std::map lookups used to translate
+		 * mesh and graph labels into local indexes, and so provides the subset of the std::map
+		 * interface used for that purpose (find, operator[], at, count, iteration, clear, size).
+		 * All entries are stored in a single contiguous array, so a lookup is typically a single
+		 * cache line access rather than a walk of a tree of separately allocated nodes.
+		 *
+		 * Differences to std::map:
+		 * - Iteration order is unspecified (it is not sorted by key)
+		 * - Inserting a new key may invalidate all iterators and references
+		 * - Entries cannot be erased individually (only cleared)
+		 *
+		 * @tparam K The type of the keys. Must be hashable via std::hash.
+		 * @tparam V The type of the values. Must be default constructible.
+		 */
+		template <class K, class V>
+		class HashMap
+		{
+			public:
+				/** Stored key/value pair, matching std::map so that iter->first/iter->second can be used **/
+				typedef std::pair<K,V> value_type;
+
+				/**
+				 * Forward iterator over the occupied entries of the map.
+				 *
+				 * @tparam C Whether this is a const iterator
+				 */
+				template <bool C>
+				class Iterator
+				{
+					public:
+						typedef typename std::conditional<C, const HashMap<K,V>, HashMap<K,V>>::type map_type;
+						typedef typename std::conditional<C, const value_type, value_type>::type entry_type;
+
+						/** The map being iterated over **/
+						map_type * map;
+
+						/** Current slot index **/
+						std::size_t slot;
+
+						Iterator(map_type * map, std::size_t slot);
+
+						/** Permit conversion of a non-const iterator to a const iterator **/
+						template <bool D, class = typename std::enable_if<C && !D>::type>
+						Iterator(const Iterator<D>& source);
+
+						inline entry_type& operator*() const;
+						inline entry_type * operator->() const;
+						inline Iterator& operator++();
+						inline Iterator operator++(int);
+						inline bool operator==(const Iterator& other) const;
+						inline bool operator!=(const Iterator& other) const;
+				};
+
+				typedef Iterator<false> iterator;
+				typedef Iterator<true> const_iterator;
+
+				// === Members ===
+
+				/** Entry storage, size is always a power of 2 **/
+				std::vector<value_type> slots;
+
+				/** Whether each slot holds an entry **/
+				std::vector<unsigned char> occupied;
+
+				/** Number of stored entries **/
+				std::size_t nEntries;
+
+				/** Number of bits used for a slot index (log2 of the number of slots) **/
+				unsigned int nBits;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Default constructor - creates an empty map
+				 */
+				HashMap();
+
+				/**
+				 * Deconstructor
+				 */
+				~HashMap();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Find the entry for a key
+				 *
+				 * @param key The key to search for
+				 *
+				 * @return An iterator to the entry, or end() if the key is not present
+				 */
+				inline iterator find(const K& key);
+				inline const_iterator find(const K& key) const;
+
+				/**
+				 * Retrieve a reference to the value for a key, inserting a default constructed value
+				 * if the key is not present (as per std::map).
+				 *
+				 * @param key The key to retrieve the value of
+				 *
+				 * @return A reference to the value
+				 */
+				inline V& operator[](const K& key);
+
+				/**
+				 * Retrieve a reference to the value for a key, without inserting.
+				 *
+				 * @param key The key to retrieve the value of
+				 *
+				 * @throws std::out_of_range If the key is not present
+				 *
+				 * @return A reference to the value
+				 */
+				inline V& at(const K& key);
+				inline const V& at(const K& key) const;
+
+				/**
+				 * Count the number of entries with a key
+				 *
+				 * @param key The key to search for
+				 *
+				 * @return 1 if the key is present, 0 otherwise
+				 */
+				inline std::size_t count(const K& key) const;
+
+				/**
+				 * Get the number of entries in the map
+				 *
+				 * @return The number of entries
+				 */
+				inline std::size_t size() const;
+
+				/**
+				 * Check whether the map is empty
+				 *
+				 * @return Whether the map has no entries
+				 */
+				inline bool empty() const;
+
+				/**
+				 * Remove all entries and release the entry storage
+				 *
+				 * @return Nothing
+				 */
+				void clear();
+
+				/**
+				 * Resize the storage such that at least n entries can be stored without further resizing
+				 *
+				 * @param n The number of entries to reserve space for
+				 *
+				 * @return Nothing
+				 */
+				void reserve(std::size_t n);
+
+				inline iterator begin();
+				inline iterator end();
+				inline const_iterator begin() const;
+				inline const_iterator end() const;
+
+			private:
+				/**
+				 * Find the slot that holds key, or the empty slot it would be inserted at
+				 *
+				 * @param key The key to search for
+				 *
+				 * @return The slot index
+				 */
+				inline std::size_t findSlot(const K& key) const;
+
+				/**
+				 * Map a key to its preferred slot
+				 *
+				 * @param key The key to hash
+				 *
+				 * @return The slot index
+				 */
+				inline std::size_t hashSlot(const K& key) const;
+
+				/**
+				 * Rebuild the storage with a new number of slots
+				 *
+				 * @param bits log2 of the new number of slots
+				 *
+				 * @return Nothing
+				 */
+				void rehash(unsigned int bits);
+		};
+
+		/**
+		 * Map type used for label to local index lookups in the mesh builders and graphs.
+		 *
+		 * This is a HashMap by default. Defining CUPCFD_ORDERED_INDEX_MAPS (via the CMake option
+		 * USE_ORDERED_INDEX_MAPS) selects std::map instead, for any code or tests that rely on iterating
+		 * the lookups in key order.
+		 *
+		 * @tparam K The type of the keys
+		 * @tparam V The type of the values
+		 */
+		#ifdef CUPCFD_ORDERED_INDEX_MAPS
+			template <class K, class V>
+			using IndexMap = std::map<K,V>;
+		#else
+			template <class K, class V>
+			using IndexMap = HashMap<K,V>;
+		#endif
+	}
+}
+
+// Include Header Level Definitions
+#include "HashMap.ipp"
+
+#endif
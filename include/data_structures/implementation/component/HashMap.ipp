@@ -0,0 +1,285 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the HashMap class
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_HASH_MAP_IPP_H
+#define CUPCFD_DATA_STRUCTURES_HASH_MAP_IPP_H
+
+#include <stdexcept>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		// === Iterator ===
+
+		template <class K, class V>
+		template <bool C>
+		HashMap<K,V>::Iterator<C>::Iterator(map_type * map, std::size_t slot)
+		: map(map),
+		  slot(slot)
+		{
+
+		}
+
+		template <class K, class V>
+		template <bool C>
+		template <bool D, class>
+		HashMap<K,V>::Iterator<C>::Iterator(const Iterator<D>& source)
+		: map(source.map),
+		  slot(source.slot)
+		{
+
+		}
+
+		template <class K, class V>
+		template <bool C>
+		inline typename HashMap<K,V>::template Iterator<C>::entry_type& HashMap<K,V>::Iterator<C>::operator*() const {
+			return this->map->slots[this->slot];
+		}
+
+		template <class K, class V>
+		template <bool C>
+		inline typename HashMap<K,V>::template Iterator<C>::entry_type * HashMap<K,V>::Iterator<C>::operator->() const {
+			return &(this->map->slots[this->slot]);
+		}
+
+		template <class K, class V>
+		template <bool C>
+		inline typename HashMap<K,V>::template Iterator<C>& HashMap<K,V>::Iterator<C>::operator++() {
+			std::size_t nSlots = this->map->slots.size();
+
+			this->slot++;
+			while(this->slot < nSlots && !(this->map->occupied[this->slot])) {
+				this->slot++;
+			}
+
+			return *this;
+		}
+
+		template <class K, class V>
+		template <bool C>
+		inline typename HashMap<K,V>::template Iterator<C> HashMap<K,V>::Iterator<C>::operator++(int) {
+			Iterator tmp(*this);
+			++(*this);
+			return tmp;
+		}
+
+		template <class K, class V>
+		template <bool C>
+		inline bool HashMap<K,V>::Iterator<C>::operator==(const Iterator& other) const {
+			return (this->slot == other.slot) && (this->map == other.map);
+		}
+
+		template <class K, class V>
+		template <bool C>
+		inline bool HashMap<K,V>::Iterator<C>::operator!=(const Iterator& other) const {
+			return !(*this == other);
+		}
+
+		// === Constructors/Deconstructors ===
+
+		template <class K, class V>
+		HashMap<K,V>::HashMap()
+		: nEntries(0),
+		  nBits(0)
+		{
+
+		}
+
+		template <class K, class V>
+		HashMap<K,V>::~HashMap() {
+
+		}
+
+		// === Concrete Methods ===
+
+		template <class K, class V>
+		inline std::size_t HashMap<K,V>::hashSlot(const K& key) const {
+			// Fibonacci hashing - spreads sequential or strided labels across the table, and
+			// takes the high bits of the product which are the best mixed.
+			std::uint64_t h = (std::uint64_t) std::hash<K>()(key);
+			h = h * UINT64_C(11400714819323198485);
+
+			return (std::size_t) (h >> (64 - this->nBits));
+		}
+
+		template <class K, class V>
+		inline std::size_t HashMap<K,V>::findSlot(const K& key) const {
+			// Should only be called with a non-empty table, which always has at least one free slot
+			std::size_t mask = this->slots.size() - 1;
+			std::size_t slot = this->hashSlot(key);
+
+			while(this->occupied[slot] && !(this->slots[slot].first == key)) {
+				slot = (slot + 1) & mask;
+			}
+
+			return slot;
+		}
+
+		template <class K, class V>
+		void HashMap<K,V>::rehash(unsigned int bits) {
+			std::vector<value_type> oldSlots;
+			std::vector<unsigned char> oldOccupied;
+
+			oldSlots.swap(this->slots);
+			oldOccupied.swap(this->occupied);
+
+			this->nBits = bits;
+			this->slots.resize(std::size_t(1) << bits);
+			this->occupied.assign(std::size_t(1) << bits, 0);
+
+			for(std::size_t i = 0; i < oldSlots.size(); i++) {
+				if(oldOccupied[i]) {
+					std::size_t slot = this->findSlot(oldSlots[i].first);
+					this->slots[slot] = std::move(oldSlots[i]);
+					this->occupied[slot] = 1;
+				}
+			}
+		}
+
+		template <class K, class V>
+		void HashMap<K,V>::reserve(std::size_t n) {
+			// Keep the load factor at or below 0.5 to keep probe sequences short
+			unsigned int bits = (this->nBits > 3) ? this->nBits : 3;
+			while((std::size_t(1) << bits) < (n * 2)) {
+				bits++;
+			}
+
+			if(bits > this->nBits) {
+				this->rehash(bits);
+			}
+		}
+
+		template <class K, class V>
+		inline typename HashMap<K,V>::iterator HashMap<K,V>::find(const K& key) {
+			if(this->nEntries == 0) {
+				return this->end();
+			}
+
+			std::size_t slot = this->findSlot(key);
+			if(!(this->occupied[slot])) {
+				return this->end();
+			}
+
+			return iterator(this, slot);
+		}
+
+		template <class K, class V>
+		inline typename HashMap<K,V>::const_iterator HashMap<K,V>::find(const K& key) const {
+			if(this->nEntries == 0) {
+				return this->end();
+			}
+
+			std::size_t slot = this->findSlot(key);
+			if(!(this->occupied[slot])) {
+				return this->end();
+			}
+
+			return const_iterator(this, slot);
+		}
+
+		template <class K, class V>
+		inline V& HashMap<K,V>::operator[](const K& key) {
+			if(this->nEntries > 0) {
+				std::size_t slot = this->findSlot(key);
+				if(this->occupied[slot]) {
+					return this->slots[slot].second;
+				}
+			}
+
+			// Insert - grow first if needed so the load factor stays at or below 0.5
+			this->reserve(this->nEntries + 1);
+
+			std::size_t slot = this->findSlot(key);
+			this->slots[slot] = value_type(key, V());
+			this->occupied[slot] = 1;
+			this->nEntries++;
+
+			return this->slots[slot].second;
+		}
+
+		template <class K, class V>
+		inline V& HashMap<K,V>::at(const K& key) {
+			iterator it = this->find(key);
+			if(it == this->end()) {
+				throw std::out_of_range("HashMap::at - key not found");
+			}
+
+			return it->second;
+		}
+
+		template <class K, class V>
+		inline const V& HashMap<K,V>::at(const K& key) const {
+			const_iterator it = this->find(key);
+			if(it == this->end()) {
+				throw std::out_of_range("HashMap::at - key not found");
+			}
+
+			return it->second;
+		}
+
+		template <class K, class V>
+		inline std::size_t HashMap<K,V>::count(const K& key) const {
+			return (this->find(key) == this->end()) ? 0 : 1;
+		}
+
+		template <class K, class V>
+		inline std::size_t HashMap<K,V>::size() const {
+			return this->nEntries;
+		}
+
+		template <class K, class V>
+		inline bool HashMap<K,V>::empty() const {
+			return this->nEntries == 0;
+		}
+
+		template <class K, class V>
+		void HashMap<K,V>::clear() {
+			this->slots = std::vector<value_type>();
+			this->occupied = std::vector<unsigned char>();
+			this->nEntries = 0;
+			this->nBits = 0;
+		}
+
+		template <class K, class V>
+		inline typename HashMap<K,V>::iterator HashMap<K,V>::begin() {
+			iterator it(this, 0);
+			if(!(this->slots.empty()) && !(this->occupied[0])) {
+				++it;
+			}
+
+			return it;
+		}
+
+		template <class K, class V>
+		inline typename HashMap<K,V>::iterator HashMap<K,V>::end() {
+			return iterator(this, this->slots.size());
+		}
+
+		template <class K, class V>
+		inline typename HashMap<K,V>::const_iterator HashMap<K,V>::begin() const {
+			const_iterator it(this, 0);
+			if(!(this->slots.empty()) && !(this->occupied[0])) {
+				++it;
+			}
+
+			return it;
+		}
+
+		template <class K, class V>
+		inline typename HashMap<K,V>::const_iterator HashMap<K,V>::end() const {
+			return const_iterator(this, this->slots.size());
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,225 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the SparseMatrixBCSR class.
+ *
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXBCSR_INCLUDE_H
+#define CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXBCSR_INCLUDE_H
+
+#include <vector>
+#include "SparseMatrix.h"
+#include "SparseMatrixCOO.h"
+#include "SparseMatrixCSR.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		/**
+		 * Stores Sparse Matrix data in a Block CSR Format.
+		 *
+		 * The matrix is divided into dense square blocks of blockSize x blockSize values, and the non-zero
+		 * blocks are stored in a CSR format over block rows and block columns. Only one column index is
+		 * stored per block, and each block is stored row-major, which suits coupled systems with several
+		 * unknowns per cell (e.g. blocks of 3 for u/v/w, or 5 for the full set of flow variables).
+		 *
+		 * Every value in a stored block is part of the non-zero structure (including explicit zeroes), so
+		 * setting one value of a block adds the whole block. If the matrix size is not a multiple of the
+		 * block size, the values of the last block row/column that lie outside the matrix are never used.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the stored node data
+		 */
+		template <class I, class T>
+		class SparseMatrixBCSR : public SparseMatrix<SparseMatrixBCSR<I,T>,I,T>
+		{
+			public:
+				// === Members ===
+
+				/** Number of rows and columns in each block **/
+				I blockSize;
+
+				/** Index Pointers into JA for each block row **/
+				std::vector<I> IA;
+
+				/** Block column index of each block (base index of 0), sorted within each block row **/
+				std::vector<I> JA;
+
+				/** Block values, blockSize * blockSize per block, row-major within each block **/
+				std::vector<T> A;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Construct a SparseMatrixBCSR object.
+				 * Create a default matrix with a size of 1,1, a base index of 0 and a block size of 1
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixBCSR();
+
+				/**
+				 * Create a sparse matrix BCSR object of a specific size, with
+				 * a base index of 0 and a block size of 1
+				 *
+				 * @param m Number of rows
+				 * @param n Number of columns
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixBCSR(I m, I n);
+
+				/**
+				 * Create a sparse matrix BCSR object of a specific size and
+				 * base index, with a block size of 1
+				 *
+				 * @param m Number of rows
+				 * @param n Number of columns
+				 * @param baseIndex The base index to use for the matrix indexing scheme
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixBCSR(I m, I n, I baseIndex);
+
+				/**
+				 * Create a sparse matrix BCSR object of a specific size, base index
+				 * and block size
+				 *
+				 * @param m Number of rows
+				 * @param n Number of columns
+				 * @param baseIndex The base index to use for the matrix indexing scheme
+				 * @param blockSize The number of rows and columns in each block (must be 1 or greater)
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixBCSR(I m, I n, I baseIndex, I blockSize);
+
+				/**
+				 * Create a sparse matrix BCSR object with the same size, base index and values
+				 * as a CSR matrix.
+				 *
+				 * @param matrix The matrix to copy
+				 * @param blockSize The number of rows and columns in each block (must be 1 or greater)
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixBCSR(SparseMatrixCSR<I,T>& matrix, I blockSize);
+
+				/**
+				 * Create a sparse matrix BCSR object with the same size, base index and values
+				 * as a COO matrix.
+				 *
+				 * @param matrix The matrix to copy
+				 * @param blockSize The number of rows and columns in each block (must be 1 or greater)
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixBCSR(SparseMatrixCOO<I,T>& matrix, I blockSize);
+
+				/**
+				 * Deconstructor for the SparseMatrixBCSR object.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				~SparseMatrixBCSR();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Rebuild this matrix from CSR arrays. The size and base index of the matrix are kept.
+				 *
+				 * @param rowPtr The offset of each row into cols and vals (m + 1 entries)
+				 * @param cols The column index of each value, starting from the matrix base index
+				 * @param vals The values
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_MATRIX_INVALID_BLOCK_SIZE The block size is less than 1
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildFromCSRArrays(const I * rowPtr, const I * cols, const T * vals);
+
+				/**
+				 * Get the number of stored blocks.
+				 *
+				 * @return The number of blocks
+				 */
+				inline I getNBlocks();
+
+				/**
+				 * Compute y = Ax (or y = y + Ax) for a block size fixed at compile time, so the loops
+				 * over each block can be unrolled. The size of the matrix must be a multiple of B.
+				 *
+				 * @param x The vector to multiply by
+				 * @param y The vector to store (or add) the product in
+				 * @param add Whether to add the product to y rather than overwrite it
+				 *
+				 * @tparam B The block size
+				 */
+				template <int B>
+				inline void multiplyFixedBlocks(const T * x, T * y, bool add);
+
+				/**
+				 * Compute y = Ax (or y = y + Ax) for any block size and matrix size.
+				 *
+				 * @param x The vector to multiply by
+				 * @param y The vector to store (or add) the product in
+				 * @param add Whether to add the product to y rather than overwrite it
+				 */
+				inline void multiplyBlocks(const T * x, T * y, bool add);
+
+				// === CRTP Methods ===
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes resize(I rows, I columns);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes clear();
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes setElement(I row, I col, T val);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes getElement(I row, I col, T * val);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes getNonZeroRowIndexes(I ** rowIndexes, I * nRowIndexes);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes getRowColumnIndexes(I row, I ** columnIndexes, I * nColumnIndexes);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes getRowNNZValues(I row, T ** nnzValues, I * nNNZValues);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes multiply(T * x, I nX, T * y, I nY);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes multiplyAdd(T * x, I nX, T * y, I nY);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "SparseMatrixBCSR.ipp"
+
+#endif
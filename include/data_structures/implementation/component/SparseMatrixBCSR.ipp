@@ -0,0 +1,406 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the SparseMatrixBCSR class.
+ *
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXBCSR_IPP_H
+#define CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXBCSR_IPP_H
+
+#include <cstdlib>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		template <class I, class T>
+		SparseMatrixBCSR<I,T>::SparseMatrixBCSR()
+		: SparseMatrix<SparseMatrixBCSR<I,T>,I,T>(),
+		  blockSize(1)
+		{
+			cupcfd::error::eCodes status;
+
+			status = this->clear();
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		SparseMatrixBCSR<I,T>::SparseMatrixBCSR(I m, I n)
+		: SparseMatrix<SparseMatrixBCSR<I,T>,I,T>(m, n),
+		  blockSize(1)
+		{
+			cupcfd::error::eCodes status;
+
+			status = this->clear();
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		SparseMatrixBCSR<I,T>::SparseMatrixBCSR(I m, I n, I baseIndex)
+		: SparseMatrix<SparseMatrixBCSR<I,T>,I,T>(m, n, baseIndex),
+		  blockSize(1)
+		{
+			cupcfd::error::eCodes status;
+
+			status = this->clear();
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		SparseMatrixBCSR<I,T>::SparseMatrixBCSR(I m, I n, I baseIndex, I blockSize)
+		: SparseMatrix<SparseMatrixBCSR<I,T>,I,T>(m, n, baseIndex),
+		  blockSize(blockSize)
+		{
+			cupcfd::error::eCodes status = cupcfd::error::E_SUCCESS;
+
+			if(blockSize < 1) {
+				status = cupcfd::error::E_MATRIX_INVALID_BLOCK_SIZE;
+			}
+			HARD_CHECK_ECODE(status)
+
+			status = this->clear();
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		SparseMatrixBCSR<I,T>::SparseMatrixBCSR(SparseMatrixCSR<I,T>& matrix, I blockSize)
+		: SparseMatrix<SparseMatrixBCSR<I,T>,I,T>(matrix.m, matrix.n, matrix.baseIndex),
+		  blockSize(blockSize)
+		{
+			cupcfd::error::eCodes status;
+
+			status = this->buildFromCSRArrays(matrix.IA.data(), matrix.JA.data(), matrix.A.data());
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		SparseMatrixBCSR<I,T>::SparseMatrixBCSR(SparseMatrixCOO<I,T>& matrix, I blockSize)
+		: SparseMatrix<SparseMatrixBCSR<I,T>,I,T>(matrix.m, matrix.n, matrix.baseIndex),
+		  blockSize(blockSize)
+		{
+			cupcfd::error::eCodes status;
+
+			// Go through the CSR arrays, which are built from the COO entries in one pass
+			SparseMatrixCSR<I,T> csr(matrix);
+
+			status = this->buildFromCSRArrays(csr.IA.data(), csr.JA.data(), csr.A.data());
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		SparseMatrixBCSR<I,T>::~SparseMatrixBCSR()
+		{
+			// Nothing to do currently, vectors will cleanup themselves on destructor call
+		}
+
+		template <class I, class T>
+		inline I SparseMatrixBCSR<I,T>::getNBlocks() {
+			return I(this->JA.size());
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixBCSR<I,T>::resize(I rows, I columns) {
+			cupcfd::error::eCodes status;
+
+			if(rows < 1) return cupcfd::error::E_MATRIX_INVALID_ROW_SIZE;
+			if(columns < 1) return cupcfd::error::E_MATRIX_INVALID_COL_SIZE;
+
+			this->m = rows;
+			this->n = columns;
+
+			// Clear the matrix, which also sets up the block row pointers for the new size
+			status = this->clear();
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixBCSR<I,T>::clear() {
+			I mb = (this->m + this->blockSize - 1) / this->blockSize;
+
+			this->IA.assign(mb + 1, 0);
+			this->JA.clear();
+			this->A.clear();
+
+			this->nnz = 0;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixBCSR<I,T>::setElement(I row, I col, T val) {
+			if((row < this->baseIndex) || (row >= this->baseIndex + this->m)) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			if((col < this->baseIndex) || (col >= this->baseIndex + this->n)) {
+				return cupcfd::error::E_MATRIX_COL_OOB;
+			}
+
+			const I b = this->blockSize;
+			I r = row - this->baseIndex;
+			I c = col - this->baseIndex;
+			I br = r / b;
+			I bc = c / b;
+
+			// Block columns are sorted within each block row
+			I k;
+			for(k = this->IA[br]; k < this->IA[br + 1]; k++) {
+				if(this->JA[k] >= bc) {
+					break;
+				}
+			}
+
+			if(k == this->IA[br + 1] || this->JA[k] != bc) {
+				// Insert a new zero block, and shift the block row pointers past it
+				this->JA.insert(this->JA.begin() + k, bc);
+				this->A.insert(this->A.begin() + (k * b * b), b * b, T(0));
+
+				for(std::size_t i = br + 1; i < this->IA.size(); i++) {
+					this->IA[i] = this->IA[i] + 1;
+				}
+
+				// Every entry of the block that lies inside the matrix is now part of the non-zero structure
+				I blockRows = (this->m - (br * b) < b) ? (this->m - (br * b)) : b;
+				I blockCols = (this->n - (bc * b) < b) ? (this->n - (bc * b)) : b;
+				this->nnz = this->nnz + (blockRows * blockCols);
+			}
+
+			this->A[(k * b * b) + ((r % b) * b) + (c % b)] = val;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixBCSR<I,T>::getElement(I row, I col, T * val) {
+			if((row < this->baseIndex) || (row >= this->baseIndex + this->m)) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			if((col < this->baseIndex) || (col >= this->baseIndex + this->n)) {
+				return cupcfd::error::E_MATRIX_COL_OOB;
+			}
+
+			const I b = this->blockSize;
+			I r = row - this->baseIndex;
+			I c = col - this->baseIndex;
+			I br = r / b;
+			I bc = c / b;
+
+			for(I k = this->IA[br]; k < this->IA[br + 1]; k++) {
+				if(this->JA[k] == bc) {
+					*val = this->A[(k * b * b) + ((r % b) * b) + (c % b)];
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				if(this->JA[k] > bc) {
+					break;
+				}
+			}
+
+			// Not a non-zero value
+			*val = 0;
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixBCSR<I,T>::getNonZeroRowIndexes(I ** rowIndexes, I * nRowIndexes) {
+			const I b = this->blockSize;
+
+			// A row has non-zero values if its block row has any blocks
+			I count = 0;
+			for(I i = 0; i < this->m; i++) {
+				if(this->IA[(i / b) + 1] > this->IA[i / b]) {
+					count = count + 1;
+				}
+			}
+
+			*nRowIndexes = count;
+			*rowIndexes = (I *) malloc(sizeof(I) * count);
+
+			count = 0;
+			for(I i = 0; i < this->m; i++) {
+				if(this->IA[(i / b) + 1] > this->IA[i / b]) {
+					(*rowIndexes)[count] = i + this->baseIndex;
+					count = count + 1;
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixBCSR<I,T>::getRowColumnIndexes(I row, I ** columnIndexes, I * nColumnIndexes) {
+			if((row - this->baseIndex) >= this->m || (row - this->baseIndex) < 0) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			const I b = this->blockSize;
+			I br = (row - this->baseIndex) / b;
+
+			// Every column of each block in the block row, up to the edge of the matrix
+			I count = 0;
+			for(I k = this->IA[br]; k < this->IA[br + 1]; k++) {
+				count = count + ((this->n - (this->JA[k] * b) < b) ? (this->n - (this->JA[k] * b)) : b);
+			}
+
+			*nColumnIndexes = count;
+			*columnIndexes = (I *) malloc(sizeof(I) * count);
+
+			count = 0;
+			for(I k = this->IA[br]; k < this->IA[br + 1]; k++) {
+				for(I j = 0; j < b && (this->JA[k] * b) + j < this->n; j++) {
+					(*columnIndexes)[count] = (this->JA[k] * b) + j + this->baseIndex;
+					count = count + 1;
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixBCSR<I,T>::getRowNNZValues(I row, T ** nnzValues, I * nNNZValues) {
+			if((row - this->baseIndex) >= this->m || (row - this->baseIndex) < 0) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			const I b = this->blockSize;
+			I r = row - this->baseIndex;
+			I br = r / b;
+
+			I count = 0;
+			for(I k = this->IA[br]; k < this->IA[br + 1]; k++) {
+				count = count + ((this->n - (this->JA[k] * b) < b) ? (this->n - (this->JA[k] * b)) : b);
+			}
+
+			*nNNZValues = count;
+			*nnzValues = (T *) malloc(sizeof(T) * count);
+
+			count = 0;
+			for(I k = this->IA[br]; k < this->IA[br + 1]; k++) {
+				const T * blockRow = this->A.data() + (k * b * b) + ((r % b) * b);
+
+				for(I j = 0; j < b && (this->JA[k] * b) + j < this->n; j++) {
+					(*nnzValues)[count] = blockRow[j];
+					count = count + 1;
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		template <int B>
+		inline void SparseMatrixBCSR<I,T>::multiplyFixedBlocks(const T * x, T * y, bool add) {
+			const I * IA = this->IA.data();
+			const I * JA = this->JA.data();
+			const T * A = this->A.data();
+			I mb = I(this->IA.size()) - 1;
+
+			for(I br = 0; br < mb; br++) {
+				T sum[B];
+
+				for(int i = 0; i < B; i++) {
+					sum[i] = 0;
+				}
+
+				for(I k = IA[br]; k < IA[br + 1]; k++) {
+					const T * block = A + (k * B * B);
+					const T * xBlock = x + (JA[k] * B);
+
+					for(int i = 0; i < B; i++) {
+						for(int j = 0; j < B; j++) {
+							sum[i] = sum[i] + block[(i * B) + j] * xBlock[j];
+						}
+					}
+				}
+
+				T * yBlock = y + (br * B);
+
+				for(int i = 0; i < B; i++) {
+					yBlock[i] = add ? (yBlock[i] + sum[i]) : sum[i];
+				}
+			}
+		}
+
+		template <class I, class T>
+		inline void SparseMatrixBCSR<I,T>::multiplyBlocks(const T * x, T * y, bool add) {
+			const I b = this->blockSize;
+			I mb = I(this->IA.size()) - 1;
+
+			for(I br = 0; br < mb; br++) {
+				// The last block row/column may extend past the edge of the matrix
+				I blockRows = (this->m - (br * b) < b) ? (this->m - (br * b)) : b;
+
+				for(I i = 0; i < blockRows; i++) {
+					T sum = 0;
+
+					for(I k = this->IA[br]; k < this->IA[br + 1]; k++) {
+						const T * blockRow = this->A.data() + (k * b * b) + (i * b);
+						I colStart = this->JA[k] * b;
+						I blockCols = (this->n - colStart < b) ? (this->n - colStart) : b;
+
+						for(I j = 0; j < blockCols; j++) {
+							sum = sum + blockRow[j] * x[colStart + j];
+						}
+					}
+
+					y[(br * b) + i] = add ? (y[(br * b) + i] + sum) : sum;
+				}
+			}
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixBCSR<I,T>::multiply(T * x, I nX, T * y, I nY) {
+			if(nX != this->n || nY != this->m) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			// Use an unrolled kernel for the common block sizes when no blocks cross the edge of the matrix
+			if((this->m % this->blockSize == 0) && (this->n % this->blockSize == 0)) {
+				switch(this->blockSize) {
+					case 2: this->template multiplyFixedBlocks<2>(x, y, false); return cupcfd::error::E_SUCCESS;
+					case 3: this->template multiplyFixedBlocks<3>(x, y, false); return cupcfd::error::E_SUCCESS;
+					case 4: this->template multiplyFixedBlocks<4>(x, y, false); return cupcfd::error::E_SUCCESS;
+					case 5: this->template multiplyFixedBlocks<5>(x, y, false); return cupcfd::error::E_SUCCESS;
+					default: break;
+				}
+			}
+
+			this->multiplyBlocks(x, y, false);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixBCSR<I,T>::multiplyAdd(T * x, I nX, T * y, I nY) {
+			if(nX != this->n || nY != this->m) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			if((this->m % this->blockSize == 0) && (this->n % this->blockSize == 0)) {
+				switch(this->blockSize) {
+					case 2: this->template multiplyFixedBlocks<2>(x, y, true); return cupcfd::error::E_SUCCESS;
+					case 3: this->template multiplyFixedBlocks<3>(x, y, true); return cupcfd::error::E_SUCCESS;
+					case 4: this->template multiplyFixedBlocks<4>(x, y, true); return cupcfd::error::E_SUCCESS;
+					case 5: this->template multiplyFixedBlocks<5>(x, y, true); return cupcfd::error::E_SUCCESS;
+					default: break;
+				}
+			}
+
+			this->multiplyBlocks(x, y, true);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
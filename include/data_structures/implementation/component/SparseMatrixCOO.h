@@ -22,6 +22,10 @@ namespace cupcfd
 {
 	namespace data_structures
 	{
+		// Forward declaration for the conversion constructor, since SparseMatrixCSR.h includes this header
+		template <class I, class T>
+		class SparseMatrixCSR;
+
 		/**
 		 * Stores Sparse Matrix data in a COO Format
 		 *
@@ -79,6 +83,17 @@ namespace cupcfd
 				 */
 				SparseMatrixCOO(I m, I n, I baseIndex);
 
+				/**
+				 * Create a sparse matrix COO object with the same size, base index and
+				 * non-zero values as a CSR matrix.
+				 *
+				 * @param matrix The CSR matrix to copy
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixCOO(SparseMatrixCSR<I,T>& matrix);
+
 
 				/**
 				 * Deconstructor for the SparseMatrixCOO object.
@@ -110,6 +125,12 @@ namespace cupcfd
 
 				__attribute__((warn_unused_result))
 				inline cupcfd::error::eCodes getRowNNZValues(I row, T ** nnzValues, I * nNNZValues);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes multiply(T * x, I nX, T * y, I nY);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes multiplyAdd(T * x, I nX, T * y, I nY);
 		};
 	}
 }
@@ -42,6 +42,23 @@ namespace cupcfd
 			// Nothing to do beyond parent constructor
 		}
 
+		template <class I, class T>
+		SparseMatrixCOO<I,T>::SparseMatrixCOO(SparseMatrixCSR<I,T>& matrix)
+		: SparseMatrix<SparseMatrixCOO<I,T>,I,T>(matrix.m, matrix.n, matrix.baseIndex)
+		{
+			// The CSR rows are stored in order and sorted by column, so the entries can be
+			// appended directly and stay in the sorted order used by setElement
+			this->row.reserve(matrix.JA.size());
+			this->col.assign(matrix.JA.begin(), matrix.JA.end());
+			this->val.assign(matrix.A.begin(), matrix.A.end());
+
+			for(I i = 0; i < matrix.m; i++) {
+				this->row.insert(this->row.end(), matrix.IA[i + 1] - matrix.IA[i], i + matrix.baseIndex);
+			}
+
+			this->nnz = matrix.nnz;
+		}
+
 		template <class I, class T>
 		SparseMatrixCOO<I,T>::~SparseMatrixCOO() {
 			// Nothing to do currently, vectors will cleanup themselves on destructor call
@@ -342,6 +359,34 @@ namespace cupcfd
 			// Done without error
 			return cupcfd::error::E_SUCCESS;
 		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixCOO<I,T>::multiply(T * x, I nX, T * y, I nY) {
+			if(nX != this->n || nY != this->m) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			for(I i = 0; i < this->m; i++) {
+				y[i] = 0;
+			}
+
+			return this->multiplyAdd(x, nX, y, nY);
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixCOO<I,T>::multiplyAdd(T * x, I nX, T * y, I nY) {
+			if(nX != this->n || nY != this->m) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			std::size_t nVal = this->val.size();
+
+			for(std::size_t i = 0; i < nVal; i++) {
+				y[this->row[i] - this->baseIndex] = y[this->row[i] - this->baseIndex] + this->val[i] * x[this->col[i] - this->baseIndex];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
@@ -16,6 +16,7 @@
 
 #include <vector>
 #include "SparseMatrix.h"
+#include "SparseMatrixCOO.h"
 #include "Error.h"
 
 namespace cupcfd
@@ -81,6 +82,17 @@ namespace cupcfd
 				 */
 				SparseMatrixCSR(I m, I n, I baseIndex);
 
+				/**
+				 * Create a sparse matrix CSR object with the same size, base index and
+				 * non-zero values as a COO matrix. The CSR arrays are built in one pass
+				 * rather than by inserting each element in turn.
+				 *
+				 * @param matrix The COO matrix to copy
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixCSR(SparseMatrixCOO<I,T>& matrix);
 
 				/**
 				 * Deconstructor for the SparseMatrixCSR object.
@@ -90,6 +102,35 @@ namespace cupcfd
 				 */
 				~SparseMatrixCSR();
 
+				// === Concrete Methods ===
+
+				/**
+				 * Replace the contents of the matrix with a set of (row, column, value) triplets.
+				 *
+				 * The triplets are grouped by row with a counting sort and each row is then sorted by column,
+				 * so this is O(nnz log(nnz per row)) rather than the O(nnz^2) of repeated setElement calls.
+				 * The triplets do not need to be in any order. Where a position is given more than once the
+				 * values are either summed, or the last one given is kept as setElement would.
+				 *
+				 * The matrix is left unchanged if an error is returned.
+				 *
+				 * @param rows The row index of each triplet, using the matrix base index
+				 * @param cols The column index of each triplet, using the matrix base index
+				 * @param vals The value of each triplet
+				 * @param nVals The number of triplets
+				 * @param sumDuplicates Whether to sum the values of repeated positions rather than keep the last
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS Success
+				 * @retval cupcfd::error::E_MATRIX_ROW_OOB A row index is outside the matrix
+				 * @retval cupcfd::error::E_MATRIX_COL_OOB A column index is outside the matrix
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildFromTriplets(const I * rows, const I * cols, const T * vals, I nVals, bool sumDuplicates);
+
 				// === CRTP Methods ===
 
 				__attribute__((warn_unused_result))
@@ -112,7 +153,30 @@ namespace cupcfd
 
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes getRowNNZValues(I row, T ** nnzValues, I * nNNZValues);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes multiply(T * x, I nX, T * y, I nY);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes multiplyAdd(T * x, I nX, T * y, I nY);
 		};
+
+		/**
+		 * Find whether a SparseMatrix is stored in the CSR format, since the CRTP base class
+		 * does not allow a dynamic_cast. Call with the matrix cast to its implementation class C.
+		 *
+		 * @param matrix The matrix to check
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the stored node data
+		 *
+		 * @return A pointer to the matrix as a SparseMatrixCSR, or a nullptr if it is stored in another format
+		 */
+		template <class I, class T>
+		inline SparseMatrixCSR<I,T> * getCSRMatrix(SparseMatrixCSR<I,T>& matrix);
+
+		template <class C, class I, class T>
+		inline SparseMatrixCSR<I,T> * getCSRMatrix(SparseMatrix<C,I,T>& matrix);
 	}
 }
 
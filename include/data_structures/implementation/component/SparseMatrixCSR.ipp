@@ -81,6 +81,18 @@ namespace cupcfd
 			this->IA.push_back(0);
 		}
 
+		template <class I, class T>
+		SparseMatrixCSR<I,T>::SparseMatrixCSR(SparseMatrixCOO<I,T>& matrix)
+		: SparseMatrix<SparseMatrixCSR<I,T>,I,T>(matrix.m, matrix.n, matrix.baseIndex)
+		{
+			cupcfd::error::eCodes status;
+
+			this->IA.assign(this->m + 1, 0);
+
+			status = this->buildFromTriplets(matrix.row.data(), matrix.col.data(), matrix.val.data(), I(matrix.val.size()), false);
+			HARD_CHECK_ECODE(status)
+		}
+
 		template <class I, class T>
 		SparseMatrixCSR<I,T>::~SparseMatrixCSR()
 		{
@@ -208,7 +220,7 @@ namespace cupcfd
 				// Done
 				return cupcfd::error::E_SUCCESS;
 			}
-			else if(status == cupcfd::error::E_SEARCH_SUCCESS) {
+			else if(status == cupcfd::error::E_SUCCESS || status == cupcfd::error::E_SEARCH_SUCCESS) {
 				// Value already exists, so we just need to overwrite
 				this->A[start + colFoundIndex] = val;
 				return cupcfd::error::E_SUCCESS;
@@ -260,7 +272,7 @@ namespace cupcfd
 				*val = 0.0;
 				return cupcfd::error::E_SUCCESS;
 			}
-			else if(status == cupcfd::error::E_SEARCH_SUCCESS) {
+			else if(status == cupcfd::error::E_SUCCESS || status == cupcfd::error::E_SEARCH_SUCCESS) {
 				// colFoundIndex should hold the offset where the non-zero value is stored since the column
 				// and nnz are stored at the same indexes in their respective vectors
 				*val = this->A[start + colFoundIndex];
@@ -346,6 +358,54 @@ namespace cupcfd
 			// Done without error
 			return cupcfd::error::E_SUCCESS;
 		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixCSR<I,T>::multiply(T * x, I nX, T * y, I nY) {
+			if(nX != this->n || nY != this->m) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			for(I i = 0; i < this->m; i++) {
+				T sum = 0;
+
+				for(I k = this->IA[i]; k < this->IA[i + 1]; k++) {
+					sum = sum + this->A[k] * x[this->JA[k] - this->baseIndex];
+				}
+
+				y[i] = sum;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixCSR<I,T>::multiplyAdd(T * x, I nX, T * y, I nY) {
+			if(nX != this->n || nY != this->m) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			for(I i = 0; i < this->m; i++) {
+				T sum = 0;
+
+				for(I k = this->IA[i]; k < this->IA[i + 1]; k++) {
+					sum = sum + this->A[k] * x[this->JA[k] - this->baseIndex];
+				}
+
+				y[i] = y[i] + sum;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline SparseMatrixCSR<I,T> * getCSRMatrix(SparseMatrixCSR<I,T>& matrix) {
+			return &matrix;
+		}
+
+		template <class C, class I, class T>
+		inline SparseMatrixCSR<I,T> * getCSRMatrix(SparseMatrix<C,I,T>&) {
+			return nullptr;
+		}
 	}
 }
 
@@ -0,0 +1,227 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the SparseMatrixSELL class.
+ *
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXSELL_INCLUDE_H
+#define CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXSELL_INCLUDE_H
+
+#include <vector>
+#include "SparseMatrix.h"
+#include "SparseMatrixCOO.h"
+#include "SparseMatrixCSR.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		/**
+		 * Stores Sparse Matrix data in the Sliced ELLPACK format (SELL-C-sigma).
+		 *
+		 * The rows are grouped into chunks of chunkSize (C) rows. Each chunk is stored as a dense
+		 * chunkSize x width block in column-major order, where width is the length of the longest row in
+		 * the chunk, so the matrix-vector product processes chunkSize rows at a time with unit stride
+		 * accesses that can be vectorised. Shorter rows are padded with zeroes.
+		 *
+		 * To reduce the padding, the rows inside each window of sigma rows are sorted by descending
+		 * length before they are grouped into chunks. rowOrder records which row is stored at each position.
+		 * A sigma of 1 keeps the original row order.
+		 *
+		 * Column indexes are stored with a base index of 0, regardless of the base index of the matrix.
+		 * Rows are only sorted when the matrix is built from another matrix - elements added by setElement
+		 * keep the existing row order.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the stored node data
+		 */
+		template <class I, class T>
+		class SparseMatrixSELL : public SparseMatrix<SparseMatrixSELL<I,T>,I,T>
+		{
+			public:
+				// === Members ===
+
+				/** Number of rows per chunk (C) **/
+				I chunkSize;
+
+				/** Number of rows in each window that is sorted by row length (sigma) **/
+				I sigma;
+
+				/** The row (with a base index of 0) stored at each position **/
+				std::vector<I> rowOrder;
+
+				/** The position each row (with a base index of 0) is stored at **/
+				std::vector<I> rowPosition;
+
+				/** Number of non-zero values in each row (with a base index of 0) **/
+				std::vector<I> rowLength;
+
+				/** Offset of each chunk into JA and A. The width of chunk c is (chunkPtr[c+1] - chunkPtr[c]) / chunkSize. **/
+				std::vector<I> chunkPtr;
+
+				/** Column indexes (base index of 0). Padding entries have a column of 0. **/
+				std::vector<I> JA;
+
+				/** Matrix values. Padding entries have a value of 0. **/
+				std::vector<T> A;
+
+				/** Scratch space of chunkSize values, used by the matrix-vector product to accumulate the rows of a chunk **/
+				std::vector<T> chunkSum;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Construct a SparseMatrixSELL object.
+				 * Create a default matrix with a size of 1,1, a base index of 0, a chunk size of 8 and a sigma of 1
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixSELL();
+
+				/**
+				 * Create a sparse matrix SELL object of a specific size, with
+				 * a base index of 0, a chunk size of 8 and a sigma of 1
+				 *
+				 * @param m Number of rows
+				 * @param n Number of columns
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixSELL(I m, I n);
+
+				/**
+				 * Create a sparse matrix SELL object of a specific size and
+				 * base index, with a chunk size of 8 and a sigma of 1
+				 *
+				 * @param m Number of rows
+				 * @param n Number of columns
+				 * @param baseIndex The base index to use for the matrix indexing scheme
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixSELL(I m, I n, I baseIndex);
+
+				/**
+				 * Create a sparse matrix SELL object of a specific size, base index,
+				 * chunk size and sigma
+				 *
+				 * @param m Number of rows
+				 * @param n Number of columns
+				 * @param baseIndex The base index to use for the matrix indexing scheme
+				 * @param chunkSize The number of rows per chunk (must be 1 or greater)
+				 * @param sigma The number of rows in each window sorted by row length (must be 1 or greater)
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixSELL(I m, I n, I baseIndex, I chunkSize, I sigma);
+
+				/**
+				 * Create a sparse matrix SELL object with the same size, base index and values
+				 * as a CSR matrix.
+				 *
+				 * @param matrix The matrix to copy
+				 * @param chunkSize The number of rows per chunk (must be 1 or greater)
+				 * @param sigma The number of rows in each window sorted by row length (must be 1 or greater)
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixSELL(SparseMatrixCSR<I,T>& matrix, I chunkSize, I sigma);
+
+				/**
+				 * Create a sparse matrix SELL object with the same size, base index and values
+				 * as a COO matrix.
+				 *
+				 * @param matrix The matrix to copy
+				 * @param chunkSize The number of rows per chunk (must be 1 or greater)
+				 * @param sigma The number of rows in each window sorted by row length (must be 1 or greater)
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				SparseMatrixSELL(SparseMatrixCOO<I,T>& matrix, I chunkSize, I sigma);
+
+				/**
+				 * Deconstructor for the SparseMatrixSELL object.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 */
+				~SparseMatrixSELL();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Rebuild this matrix from CSR arrays, sorting the rows in each sigma window by length.
+				 * The size and base index of the matrix are kept.
+				 *
+				 * @param rowPtr The offset of each row into cols and vals (m + 1 entries)
+				 * @param cols The column index of each value, starting from the matrix base index.
+				 * Each row must be sorted by column.
+				 * @param vals The values
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_MATRIX_INVALID_BLOCK_SIZE The chunk size or sigma is less than 1
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildFromCSRArrays(const I * rowPtr, const I * cols, const T * vals);
+
+				/**
+				 * Get the total number of entries stored, including padding.
+				 *
+				 * @return The number of stored entries
+				 */
+				inline I getNStoredEntries();
+
+				// === CRTP Methods ===
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes resize(I rows, I columns);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes clear();
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes setElement(I row, I col, T val);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes getElement(I row, I col, T * val);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes getNonZeroRowIndexes(I ** rowIndexes, I * nRowIndexes);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes getRowColumnIndexes(I row, I ** columnIndexes, I * nColumnIndexes);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes getRowNNZValues(I row, T ** nnzValues, I * nNNZValues);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes multiply(T * x, I nX, T * y, I nY);
+
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes multiplyAdd(T * x, I nX, T * y, I nY);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "SparseMatrixSELL.ipp"
+
+#endif
@@ -0,0 +1,405 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the SparseMatrixSELL class.
+ *
+ */
+
+#ifndef CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXSELL_IPP_H
+#define CUPCFD_DATA_STRUCTURES_MATRICES_SPARSEMATRIXSELL_IPP_H
+
+#include <cstdlib>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		template <class I, class T>
+		SparseMatrixSELL<I,T>::SparseMatrixSELL()
+		: SparseMatrix<SparseMatrixSELL<I,T>,I,T>(),
+		  chunkSize(8),
+		  sigma(1)
+		{
+			cupcfd::error::eCodes status;
+
+			status = this->clear();
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		SparseMatrixSELL<I,T>::SparseMatrixSELL(I m, I n)
+		: SparseMatrix<SparseMatrixSELL<I,T>,I,T>(m, n),
+		  chunkSize(8),
+		  sigma(1)
+		{
+			cupcfd::error::eCodes status;
+
+			status = this->clear();
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		SparseMatrixSELL<I,T>::SparseMatrixSELL(I m, I n, I baseIndex)
+		: SparseMatrix<SparseMatrixSELL<I,T>,I,T>(m, n, baseIndex),
+		  chunkSize(8),
+		  sigma(1)
+		{
+			cupcfd::error::eCodes status;
+
+			status = this->clear();
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		SparseMatrixSELL<I,T>::SparseMatrixSELL(I m, I n, I baseIndex, I chunkSize, I sigma)
+		: SparseMatrix<SparseMatrixSELL<I,T>,I,T>(m, n, baseIndex),
+		  chunkSize(chunkSize),
+		  sigma(sigma)
+		{
+			cupcfd::error::eCodes status = cupcfd::error::E_SUCCESS;
+
+			if(chunkSize < 1 || sigma < 1) {
+				status = cupcfd::error::E_MATRIX_INVALID_BLOCK_SIZE;
+			}
+			HARD_CHECK_ECODE(status)
+
+			status = this->clear();
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		SparseMatrixSELL<I,T>::SparseMatrixSELL(SparseMatrixCSR<I,T>& matrix, I chunkSize, I sigma)
+		: SparseMatrix<SparseMatrixSELL<I,T>,I,T>(matrix.m, matrix.n, matrix.baseIndex),
+		  chunkSize(chunkSize),
+		  sigma(sigma)
+		{
+			cupcfd::error::eCodes status;
+
+			status = this->buildFromCSRArrays(matrix.IA.data(), matrix.JA.data(), matrix.A.data());
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		SparseMatrixSELL<I,T>::SparseMatrixSELL(SparseMatrixCOO<I,T>& matrix, I chunkSize, I sigma)
+		: SparseMatrix<SparseMatrixSELL<I,T>,I,T>(matrix.m, matrix.n, matrix.baseIndex),
+		  chunkSize(chunkSize),
+		  sigma(sigma)
+		{
+			cupcfd::error::eCodes status;
+
+			// Go through the CSR arrays, which are built from the COO entries in one pass
+			SparseMatrixCSR<I,T> csr(matrix);
+
+			status = this->buildFromCSRArrays(csr.IA.data(), csr.JA.data(), csr.A.data());
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		SparseMatrixSELL<I,T>::~SparseMatrixSELL()
+		{
+			// Nothing to do currently, vectors will cleanup themselves on destructor call
+		}
+
+		template <class I, class T>
+		inline I SparseMatrixSELL<I,T>::getNStoredEntries() {
+			return this->chunkPtr.back();
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T>::resize(I rows, I columns) {
+			cupcfd::error::eCodes status;
+
+			if(rows < 1) return cupcfd::error::E_MATRIX_INVALID_ROW_SIZE;
+			if(columns < 1) return cupcfd::error::E_MATRIX_INVALID_COL_SIZE;
+
+			this->m = rows;
+			this->n = columns;
+
+			// Clear the matrix, which also sets up the row and chunk arrays for the new size
+			status = this->clear();
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T>::clear() {
+			I nChunks = (this->m + this->chunkSize - 1) / this->chunkSize;
+
+			// Every row is empty and stored in its original position
+			this->rowOrder.resize(this->m);
+			this->rowPosition.resize(this->m);
+
+			for(I i = 0; i < this->m; i++) {
+				this->rowOrder[i] = i;
+				this->rowPosition[i] = i;
+			}
+
+			this->rowLength.assign(this->m, 0);
+
+			// Every chunk has a width of zero
+			this->chunkPtr.assign(nChunks + 1, 0);
+			this->JA.clear();
+			this->A.clear();
+			this->chunkSum.assign(this->chunkSize, T(0));
+
+			this->nnz = 0;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T>::setElement(I row, I col, T val) {
+			if((row < this->baseIndex) || (row >= this->baseIndex + this->m)) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			if((col < this->baseIndex) || (col >= this->baseIndex + this->n)) {
+				return cupcfd::error::E_MATRIX_COL_OOB;
+			}
+
+			I r = row - this->baseIndex;
+			I c = col - this->baseIndex;
+			I pos = this->rowPosition[r];
+			I chunk = pos / this->chunkSize;
+			I lane = pos % this->chunkSize;
+			I start = this->chunkPtr[chunk] + lane;
+			I len = this->rowLength[r];
+
+			// The row is stored in every chunkSize'th entry from start, sorted by column
+			I j;
+			for(j = 0; j < len; j++) {
+				I k = start + (j * this->chunkSize);
+
+				if(this->JA[k] == c) {
+					// Value already exists, so we just need to overwrite
+					this->A[k] = val;
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				if(this->JA[k] > c) {
+					break;
+				}
+			}
+
+			// Insert a new value at slot j of the row. If the row already fills the chunk, widen the chunk
+			// by appending a column of padding (chunkSize entries) to the end of it.
+			I width = (this->chunkPtr[chunk + 1] - this->chunkPtr[chunk]) / this->chunkSize;
+
+			if(len == width) {
+				this->JA.insert(this->JA.begin() + this->chunkPtr[chunk + 1], this->chunkSize, I(0));
+				this->A.insert(this->A.begin() + this->chunkPtr[chunk + 1], this->chunkSize, T(0));
+
+				for(std::size_t i = chunk + 1; i < this->chunkPtr.size(); i++) {
+					this->chunkPtr[i] = this->chunkPtr[i] + this->chunkSize;
+				}
+			}
+
+			for(I s = len; s > j; s--) {
+				this->JA[start + (s * this->chunkSize)] = this->JA[start + ((s - 1) * this->chunkSize)];
+				this->A[start + (s * this->chunkSize)] = this->A[start + ((s - 1) * this->chunkSize)];
+			}
+
+			this->JA[start + (j * this->chunkSize)] = c;
+			this->A[start + (j * this->chunkSize)] = val;
+
+			this->rowLength[r] = len + 1;
+			this->nnz = this->nnz + 1;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T>::getElement(I row, I col, T * val) {
+			if((row < this->baseIndex) || (row >= this->baseIndex + this->m)) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			if((col < this->baseIndex) || (col >= this->baseIndex + this->n)) {
+				return cupcfd::error::E_MATRIX_COL_OOB;
+			}
+
+			I r = row - this->baseIndex;
+			I c = col - this->baseIndex;
+			I pos = this->rowPosition[r];
+			I start = this->chunkPtr[pos / this->chunkSize] + (pos % this->chunkSize);
+
+			for(I j = 0; j < this->rowLength[r]; j++) {
+				I k = start + (j * this->chunkSize);
+
+				if(this->JA[k] == c) {
+					*val = this->A[k];
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				if(this->JA[k] > c) {
+					break;
+				}
+			}
+
+			// Not a non-zero value
+			*val = 0;
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T>::getNonZeroRowIndexes(I ** rowIndexes, I * nRowIndexes) {
+			I count = 0;
+			for(I i = 0; i < this->m; i++) {
+				if(this->rowLength[i] > 0) {
+					count = count + 1;
+				}
+			}
+
+			*nRowIndexes = count;
+			*rowIndexes = (I *) malloc(sizeof(I) * count);
+
+			count = 0;
+			for(I i = 0; i < this->m; i++) {
+				if(this->rowLength[i] > 0) {
+					(*rowIndexes)[count] = i + this->baseIndex;
+					count = count + 1;
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T>::getRowColumnIndexes(I row, I ** columnIndexes, I * nColumnIndexes) {
+			if((row - this->baseIndex) >= this->m || (row - this->baseIndex) < 0) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			I r = row - this->baseIndex;
+			I pos = this->rowPosition[r];
+			I start = this->chunkPtr[pos / this->chunkSize] + (pos % this->chunkSize);
+
+			*nColumnIndexes = this->rowLength[r];
+			*columnIndexes = (I *) malloc(sizeof(I) * this->rowLength[r]);
+
+			for(I j = 0; j < this->rowLength[r]; j++) {
+				(*columnIndexes)[j] = this->JA[start + (j * this->chunkSize)] + this->baseIndex;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T>::getRowNNZValues(I row, T ** nnzValues, I * nNNZValues) {
+			if((row - this->baseIndex) >= this->m || (row - this->baseIndex) < 0) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			I r = row - this->baseIndex;
+			I pos = this->rowPosition[r];
+			I start = this->chunkPtr[pos / this->chunkSize] + (pos % this->chunkSize);
+
+			*nNNZValues = this->rowLength[r];
+			*nnzValues = (T *) malloc(sizeof(T) * this->rowLength[r]);
+
+			for(I j = 0; j < this->rowLength[r]; j++) {
+				(*nnzValues)[j] = this->A[start + (j * this->chunkSize)];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T>::multiply(T * x, I nX, T * y, I nY) {
+			if(nX != this->n || nY != this->m) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			const I chunkSize = this->chunkSize;
+			const I * JA = this->JA.data();
+			const T * A = this->A.data();
+			I nChunks = I(this->chunkPtr.size()) - 1;
+
+			// Accumulate the rows of a chunk together, so the inner loop over the rows of the chunk has unit stride.
+			// The scratch space is kept by the matrix, so nothing is allocated for each product.
+			T * sum = this->chunkSum.data();
+
+			for(I chunk = 0; chunk < nChunks; chunk++) {
+				I start = this->chunkPtr[chunk];
+				I width = (this->chunkPtr[chunk + 1] - start) / chunkSize;
+
+				for(I r = 0; r < chunkSize; r++) {
+					sum[r] = 0;
+				}
+
+				for(I j = 0; j < width; j++) {
+					const I * cols = JA + start + (j * chunkSize);
+					const T * vals = A + start + (j * chunkSize);
+
+					for(I r = 0; r < chunkSize; r++) {
+						sum[r] = sum[r] + vals[r] * x[cols[r]];
+					}
+				}
+
+				I rowStart = chunk * chunkSize;
+				I nRows = (this->m - rowStart < chunkSize) ? (this->m - rowStart) : chunkSize;
+
+				for(I r = 0; r < nRows; r++) {
+					y[this->rowOrder[rowStart + r]] = sum[r];
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		inline cupcfd::error::eCodes SparseMatrixSELL<I,T>::multiplyAdd(T * x, I nX, T * y, I nY) {
+			if(nX != this->n || nY != this->m) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			const I chunkSize = this->chunkSize;
+			const I * JA = this->JA.data();
+			const T * A = this->A.data();
+			I nChunks = I(this->chunkPtr.size()) - 1;
+
+			T * sum = this->chunkSum.data();
+
+			for(I chunk = 0; chunk < nChunks; chunk++) {
+				I start = this->chunkPtr[chunk];
+				I width = (this->chunkPtr[chunk + 1] - start) / chunkSize;
+
+				// Chunks of empty rows add nothing
+				if(width == 0) {
+					continue;
+				}
+
+				for(I r = 0; r < chunkSize; r++) {
+					sum[r] = 0;
+				}
+
+				for(I j = 0; j < width; j++) {
+					const I * cols = JA + start + (j * chunkSize);
+					const T * vals = A + start + (j * chunkSize);
+
+					for(I r = 0; r < chunkSize; r++) {
+						sum[r] = sum[r] + vals[r] * x[cols[r]];
+					}
+				}
+
+				I rowStart = chunk * chunkSize;
+				I nRows = (this->m - rowStart < chunkSize) ? (this->m - rowStart) : chunkSize;
+
+				for(I r = 0; r < nRows; r++) {
+					y[this->rowOrder[rowStart + r]] = y[this->rowOrder[rowStart + r]] + sum[r];
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+#endif
@@ -13,8 +13,9 @@
 #ifndef CUPCFD_DATA_STRUCTURES_ADJACENCY_LIST_INCLUDE_H
 #define CUPCFD_DATA_STRUCTURES_ADJACENCY_LIST_INCLUDE_H
 
-#include <map>
+#include <vector>
 #include "Error.h"
+#include "HashMap.h"
 
 namespace cupcfd
 {
@@ -45,13 +46,17 @@ namespace cupcfd
 
 				// Boost has a bi-directional map for one-to-one relationships
 				// However, trying to avoid hard requirement for boost beyond
-				// unit testing, so will use two maps as an alternative.
+				// unit testing, so will use a map and an array as an alternative.
 
 				/** Map Nodes to an internal Index **/
-				std::map<T,I> nodeToIDX;
+				IndexMap<T,I> nodeToIDX;
 
-				/** Map Internal Index to Nodes **/
-				std::map<I,T> IDXToNode;
+				/**
+				 * Map Internal Index to Nodes.
+				 * Internal indexes are assigned in the order nodes are added (0 to nNodes - 1), so
+				 * this is stored densely, indexed by the internal index.
+				 **/
+				std::vector<T> IDXToNode;
 
 				// Constructors/Deconstructors
 
@@ -244,6 +244,51 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				inline cupcfd::error::eCodes getRowNNZValues(I rowIndex, T ** nnzValues, I * nNNZValues);
 
+				/**
+				 * Compute the matrix-vector product y = Ax.
+				 * x is indexed by column and y by row, both offset by the matrix base index
+				 * (i.e. x[0] is the entry for column baseIndex).
+				 *
+				 * @param x The vector to multiply by
+				 * @param nX The number of entries in x. Must be the number of columns.
+				 * @param y The array to store the product in
+				 * @param nY The number of entries in y. Must be the number of rows.
+				 *
+				 * @tparam C The type of the implementation class for the SparseMatrix.
+				 * This must inherit from this class passing itself as template parameter C, as well as
+				 * providing implementation for the CRTP methods to passthrough to.
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH x or y do not match the size of the matrix
+				 */
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes multiply(T * x, I nX, T * y, I nY);
+
+				/**
+				 * Add the matrix-vector product to a vector, y = y + Ax.
+				 * x is indexed by column and y by row, both offset by the matrix base index.
+				 *
+				 * @param x The vector to multiply by
+				 * @param nX The number of entries in x. Must be the number of columns.
+				 * @param y The vector to add the product to
+				 * @param nY The number of entries in y. Must be the number of rows.
+				 *
+				 * @tparam C The type of the implementation class for the SparseMatrix.
+				 * This must inherit from this class passing itself as template parameter C, as well as
+				 * providing implementation for the CRTP methods to passthrough to.
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored node data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH x or y do not match the size of the matrix
+				 */
+				__attribute__((warn_unused_result))
+				inline cupcfd::error::eCodes multiplyAdd(T * x, I nX, T * y, I nY);
+
 				// === Concrete Methods ===
 
 				/**
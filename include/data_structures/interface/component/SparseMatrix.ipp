@@ -99,6 +99,18 @@ namespace cupcfd
 		{
 			return static_cast<C*>(this)->getRowNNZValues(rowIndex, nnzValues, nNNZValues);
 		}
+
+		template <class C, class I, class T>
+		inline cupcfd::error::eCodes SparseMatrix<C,I,T>::multiply(T * x, I nX, T * y, I nY)
+		{
+			return static_cast<C*>(this)->multiply(x, nX, y, nY);
+		}
+
+		template <class C, class I, class T>
+		inline cupcfd::error::eCodes SparseMatrix<C,I,T>::multiplyAdd(T * x, I nX, T * y, I nY)
+		{
+			return static_cast<C*>(this)->multiplyAdd(x, nX, y, nY);
+		}
 	}
 }
 
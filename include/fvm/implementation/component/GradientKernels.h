@@ -30,6 +30,8 @@
 
 #include "EuclideanVector.h"
 #include "UnstructuredMeshInterface.h"
+#include "ExchangePattern.h"
+#include "ExchangeOverlap.h"
 #include "Error.h"
 
 namespace cupcfd
@@ -52,6 +54,73 @@ namespace cupcfd
 													T * phiBoundary, I nPhiBoundary,
 													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell, I nDPhidxCell,
 													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell, I nDPhidxoCell);
+
+		/**
+		 * Compute the face interpolated value of a single face and accumulate it into the gradients of the cells of the face.
+		 * This is the body of the face loop of GradientPhiGaussDolfyn.
+		 *
+		 * @param faceID The local ID of the face
+		 *
+		 * @tparam M The implementing class of the UnstructuredMeshInterface
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/mesh/stateful data
+		 * @tparam L The label datatype of the unstructured mesh
+		 */
+		template <class M, class I, class T, class L>
+		__attribute__((warn_unused_result))
+		inline cupcfd::error::eCodes GradientPhiGaussDolfynFace(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh, I faceID,
+													T * phiCell, I nPhiCell,
+													T * phiBoundary, I nPhiBoundary,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell, I nDPhidxCell,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell, I nDPhidxoCell);
+
+		/**
+		 * Thread-parallel version of GradientPhiGaussDolfyn.
+		 *
+		 * The faces of each colour of the mesh face colouring are processed concurrently using OpenMP, and
+		 * the colours are processed in order. If the face colouring has not been built, this runs
+		 * GradientPhiGaussDolfyn instead.
+		 *
+		 * @tparam M The implementing class of the UnstructuredMeshInterface
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/mesh/stateful data
+		 * @tparam L The label datatype of the unstructured mesh
+		 */
+		template <class M, class I, class T, class L>
+		__attribute__((warn_unused_result))
+		cupcfd::error::eCodes GradientPhiGaussDolfynColoured(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh, I nGradient,
+													T * phiCell, I nPhiCell,
+													T * phiBoundary, I nPhiBoundary,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell, I nDPhidxCell,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell, I nDPhidxoCell);
+
+		/**
+		 * Version of GradientPhiGaussDolfyn that also updates the ghost cell values of phiCell, overlapping the
+		 * exchange with the face loop.
+		 *
+		 * The exchange of phiCell is started, the interior faces of the mesh (which only access locally owned cells)
+		 * are processed, and the halo faces are processed once the exchange has completed. Since phiCell does not
+		 * change between gradient iterations, only the first iteration exchanges data.
+		 *
+		 * If the halo face split has not been built, the exchange is completed before running GradientPhiGaussDolfyn.
+		 *
+		 * @param phiExchange The exchange pattern of the cell data, built from the mesh cell connectivity graph
+		 * @param timing Timing to add the time of each phase of the exchange to. May be nullptr.
+		 *
+		 * @tparam M The implementing class of the UnstructuredMeshInterface
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/mesh/stateful data
+		 * @tparam L The label datatype of the unstructured mesh
+		 */
+		template <class M, class I, class T, class L>
+		__attribute__((warn_unused_result))
+		cupcfd::error::eCodes GradientPhiGaussDolfynOverlap(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+													cupcfd::comm::ExchangePattern<T>& phiExchange, I nGradient,
+													T * phiCell, I nPhiCell,
+													T * phiBoundary, I nPhiBoundary,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell, I nDPhidxCell,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell, I nDPhidxoCell,
+													cupcfd::comm::ExchangeOverlapTiming * timing);
 	}
 }
 
@@ -36,20 +36,86 @@ namespace cupcfd
 	namespace fvm
 	{
 		template <class M, class I, class T, class L>
-		cupcfd::error::eCodes GradientPhiGaussDolfyn(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh, I nGradient,
+		inline cupcfd::error::eCodes GradientPhiGaussDolfynFace(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh, I faceID,
 													T * phiCell, I nPhiCell,
 													T * phiBoundary, I nPhiBoundary,
-													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell, I nDPhidxCell,
-													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell, I nDPhidxoCell) {
-			T facn, facp, fact;
-			// T xp, xn, xf, xnorm, xpac, xnac, delp, deln;
-			T phiFace, vol;
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell, I nDPhidxCell __attribute__((unused)),
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell, I nDPhidxoCell __attribute__((unused))) {
+			const cupcfd::geometry::mesh::UnstructuredMeshKernelView<I,T>& view = mesh.kernelView;
+
+			T facn, facp;
+			T phiFace;
 			I ip, ib, in;
 
 			cupcfd::geometry::euclidean::EuclideanPoint<T,3> xac;
 			cupcfd::geometry::euclidean::EuclideanVector<T,3> dPhidxac;
 			cupcfd::geometry::euclidean::EuclideanVector<T,3> corrTmp;
 
+			I i = faceID;
+
+			// Get Cell 1 Index
+			ip = view.faceCell1[i];
+
+			// Get Cell 2 Index
+			in = view.faceCell2[i];
+
+			bool isBoundary = view.faceIsBoundary[i];
+
+			if(!isBoundary) {
+				facn = view.faceLambda[i];
+				facp = 1.0 - facn;
+
+				xac = (view.cellCenter(in) * facn) + (view.cellCenter(ip) * facp);
+
+				dPhidxac = (dPhidxoCell[in] * facn) + (dPhidxoCell[ip] * facp);
+
+				#ifdef DEBUG
+					if (ip >= nPhiCell || in >= nPhiCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+				#endif
+				phiFace = (phiCell[in] * facn) + (phiCell[ip] * facp);
+
+				corrTmp = view.faceCenter(i) - xac;
+
+				phiFace += dPhidxac.dotProduct(corrTmp);
+
+				dPhidxCell[ip] += (phiFace * view.faceNorm(i));
+				dPhidxCell[in] += (phiFace * view.faceNorm(i));
+			}
+			else {
+				ib = view.faceBoundaryID[i];
+				#ifdef DEBUG
+					if (ib >= nPhiBoundary) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+				#endif
+				phiFace = phiBoundary[ib];
+
+				dPhidxCell[ip] += (phiFace * view.faceNorm(i));
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes GradientPhiGaussDolfyn(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh, I nGradient,
+													T * phiCell, I nPhiCell,
+													T * phiBoundary, I nPhiBoundary,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell, I nDPhidxCell,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell, I nDPhidxoCell) {
+			const cupcfd::geometry::mesh::UnstructuredMeshKernelView<I,T>& view = mesh.kernelView;
+
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!view.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
+			cupcfd::error::eCodes status;
+			T fact;
+
+			const T * __restrict__ cellVolume = view.cellVolume;
+
 			I nFac = mesh.properties.lFaces;
 			// I nCel = mesh.properties.lOCells;
 
@@ -70,59 +136,202 @@ namespace cupcfd
 				}
 
 				// Face Loop
-				for(I i = 0; i < nFac; i++) {			
-					// Get Cell 1 Index
-					ip = mesh.getFaceCell1ID(i);
+				for(I i = 0; i < nFac; i++) {
+					status = GradientPhiGaussDolfynFace(mesh, i, phiCell, nPhiCell, phiBoundary, nPhiBoundary,
+														dPhidxCell, nDPhidxCell, dPhidxoCell, nDPhidxoCell);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				// Cell Loop
+				// Loop over local cells only? Or ghost cells too?
+				// Since faces can access ghost cells, presume these must be updated
+				// for ghost cells also.
+				for(I i = 0; i < mesh.properties.lTCells; i++) {
+					fact = 1.0/cellVolume[i];
+					dPhidxCell[i] *= fact;
+				}
+
+				// Copy
+				for(I i = 0; i < nDPhidxoCell; i++) {
+					dPhidxoCell[i] = dPhidxCell[i];
+				}
+			}
+			
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes GradientPhiGaussDolfynColoured(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh, I nGradient,
+													T * phiCell, I nPhiCell,
+													T * phiBoundary, I nPhiBoundary,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell, I nDPhidxCell,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell, I nDPhidxoCell) {
+			const cupcfd::geometry::mesh::UnstructuredMeshKernelView<I,T>& view = mesh.kernelView;
+
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!view.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
 
-					// Get Cell 2 Index
-					in = mesh.getFaceCell2ID(i);
+			if(!mesh.faceColouring.built) {
+				return GradientPhiGaussDolfyn(mesh, nGradient, phiCell, nPhiCell, phiBoundary, nPhiBoundary,
+											  dPhidxCell, nDPhidxCell, dPhidxoCell, nDPhidxoCell);
+			}
+
+			cupcfd::error::eCodes status = cupcfd::error::E_SUCCESS;
 
-					bool isBoundary;
-					mesh.getFaceIsBoundary(i, &isBoundary);
+			const T * __restrict__ cellVolume = view.cellVolume;
 
-					if(!isBoundary) {
-						facn = mesh.getFaceLambda(i);
-						facp = 1.0 - facn;
+			I nColours = mesh.faceColouring.nColours;
+			I * colourXAdj = mesh.faceColouring.colourXAdj;
+			I * colourFaces = mesh.faceColouring.colourFaces;
+			I nCells = mesh.properties.lTCells;
 
-						xac = (mesh.getCellCenter(in) * facn) + (mesh.getCellCenter(ip) * facp);
+			#pragma omp parallel
+			{
+				// Zero Cell Values
+				#pragma omp for
+				for (I i = 0; i < nDPhidxoCell; i++) {
+					dPhidxoCell[i].cmp[0] = (T) 0;
+					dPhidxoCell[i].cmp[1] = (T) 0;
+					dPhidxoCell[i].cmp[2] = (T) 0;
+				}
 
-						dPhidxac = (dPhidxoCell[in] * facn) + (dPhidxoCell[ip] * facp);
+				// Gradient Loop
+				for(I iGrad = 0; iGrad < nGradient; iGrad++) {
+					// Reset
+					#pragma omp for
+					for (I i = 0; i < nDPhidxCell; i++) {
+						dPhidxCell[i].cmp[0] = (T) 0;
+						dPhidxCell[i].cmp[1] = (T) 0;
+						dPhidxCell[i].cmp[2] = (T) 0;
+					}
 
-						#ifdef DEBUG
-							if (ip >= nPhiCell || in >= nPhiCell) {
-								return cupcfd::error::E_INVALID_INDEX;
+					// Face Loop - no two faces of a colour share a cell, and the implicit barrier at the end
+					// of each loop orders the colours
+					for(I c = 0; c < nColours; c++) {
+						#pragma omp for
+						for(I j = colourXAdj[c]; j < colourXAdj[c+1]; j++) {
+							cupcfd::error::eCodes faceStatus;
+							faceStatus = GradientPhiGaussDolfynFace(mesh, colourFaces[j], phiCell, nPhiCell, phiBoundary, nPhiBoundary,
+																	dPhidxCell, nDPhidxCell, dPhidxoCell, nDPhidxoCell);
+							if(faceStatus != cupcfd::error::E_SUCCESS) {
+								#pragma omp critical
+								status = faceStatus;
 							}
-						#endif
-						phiFace = (phiCell[in] * facn) + (phiCell[ip] * facp);
+						}
+					}
 
-						corrTmp = mesh.getFaceCenter(i) - xac;
+					// Cell Loop
+					#pragma omp for
+					for(I i = 0; i < nCells; i++) {
+						dPhidxCell[i] *= (T) (1.0/cellVolume[i]);
+					}
 
-						phiFace += dPhidxac.dotProduct(corrTmp);
+					// Copy
+					#pragma omp for
+					for(I i = 0; i < nDPhidxoCell; i++) {
+						dPhidxoCell[i] = dPhidxCell[i];
+					}
+				}
+			}
+
+			return status;
+		}
 
-						dPhidxCell[ip] += (phiFace * mesh.getFaceNorm(i));
-						dPhidxCell[in] += (phiFace * mesh.getFaceNorm(i));
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes GradientPhiGaussDolfynOverlap(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+													cupcfd::comm::ExchangePattern<T>& phiExchange, I nGradient,
+													T * phiCell, I nPhiCell,
+													T * phiBoundary, I nPhiBoundary,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell, I nDPhidxCell,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell, I nDPhidxoCell,
+													cupcfd::comm::ExchangeOverlapTiming * timing) {
+			const cupcfd::geometry::mesh::UnstructuredMeshKernelView<I,T>& view = mesh.kernelView;
+
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!view.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
+			cupcfd::error::eCodes status;
+
+			if(!mesh.haloFaces.built) {
+				status = phiExchange.exchangeStart(phiCell, nPhiCell);
+				CHECK_ECODE(status)
+				status = phiExchange.exchangeStop(phiCell, nPhiCell);
+				CHECK_ECODE(status)
+
+				return GradientPhiGaussDolfyn(mesh, nGradient, phiCell, nPhiCell, phiBoundary, nPhiBoundary,
+											  dPhidxCell, nDPhidxCell, dPhidxoCell, nDPhidxoCell);
+			}
+
+			const T * __restrict__ cellVolume = view.cellVolume;
+
+			I nInteriorFaces = mesh.haloFaces.nInteriorFaces;
+			I * interiorFaces = mesh.haloFaces.interiorFaces;
+			I nHaloFaces = mesh.haloFaces.nHaloFaces;
+			I * haloFaces = mesh.haloFaces.haloFaces;
+
+			auto interiorLoop = [&]() {
+				for(I j = 0; j < nInteriorFaces; j++) {
+					cupcfd::error::eCodes faceStatus;
+					faceStatus = GradientPhiGaussDolfynFace(mesh, interiorFaces[j], phiCell, nPhiCell, phiBoundary, nPhiBoundary,
+															dPhidxCell, nDPhidxCell, dPhidxoCell, nDPhidxoCell);
+					if(faceStatus != cupcfd::error::E_SUCCESS) {
+						return faceStatus;
 					}
-					else {
-						ib = mesh.getFaceBoundaryID(i);
-						#ifdef DEBUG
-							if (ib >= nPhiBoundary) {
-								return cupcfd::error::E_INVALID_INDEX;
-							}
-						#endif
-						phiFace = phiBoundary[ib];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			};
 
-						dPhidxCell[ip] += (phiFace * mesh.getFaceNorm(i));
+			auto haloLoop = [&]() {
+				for(I j = 0; j < nHaloFaces; j++) {
+					cupcfd::error::eCodes faceStatus;
+					faceStatus = GradientPhiGaussDolfynFace(mesh, haloFaces[j], phiCell, nPhiCell, phiBoundary, nPhiBoundary,
+															dPhidxCell, nDPhidxCell, dPhidxoCell, nDPhidxoCell);
+					if(faceStatus != cupcfd::error::E_SUCCESS) {
+						return faceStatus;
 					}
 				}
 
+				return cupcfd::error::E_SUCCESS;
+			};
+
+			// Zero Cell Values
+			for (I i = 0; i < nDPhidxoCell; i++) {
+				dPhidxoCell[i].cmp[0] = (T) 0;
+				dPhidxoCell[i].cmp[1] = (T) 0;
+				dPhidxoCell[i].cmp[2] = (T) 0;
+			}
+
+			// Gradient Loop
+			for(I iGrad = 0; iGrad < nGradient; iGrad++) {
+				// Reset
+				for (I i = 0; i < nDPhidxCell; i++) {
+					dPhidxCell[i].cmp[0] = (T) 0;
+					dPhidxCell[i].cmp[1] = (T) 0;
+					dPhidxCell[i].cmp[2] = (T) 0;
+				}
+
+				// Face Loop - the ghost values of phiCell are only read by the halo faces
+				if(iGrad == 0) {
+					status = cupcfd::comm::exchangeOverlap(phiExchange, phiCell, (int) nPhiCell, interiorLoop, haloLoop, timing);
+					CHECK_ECODE(status)
+				}
+				else {
+					status = interiorLoop();
+					CHECK_ECODE(status)
+					status = haloLoop();
+					CHECK_ECODE(status)
+				}
+
 				// Cell Loop
-				// Loop over local cells only? Or ghost cells too?
-				// Since faces can access ghost cells, presume these must be updated
-				// for ghost cells also.
 				for(I i = 0; i < mesh.properties.lTCells; i++) {
-					mesh.getCellVolume(i, &vol);
-					fact = 1.0/vol;
-					dPhidxCell[i] *= fact;
+					dPhidxCell[i] *= (T) (1.0/cellVolume[i]);
 				}
 
 				// Copy
@@ -130,7 +339,7 @@ namespace cupcfd
 					dPhidxoCell[i] = dPhidxCell[i];
 				}
 			}
-			
+
 			return cupcfd::error::E_SUCCESS;
 		}
 	}
@@ -80,6 +80,98 @@ namespace cupcfd
 													T * tCell, I nTCell,
 													T * tBoundary, I nTBoundary);
 
+		/**
+		 * Compute the mass flux of a single face. This is the body of the face loop of FluxMassDolfynFaceLoop.
+		 *
+		 * @param faceID The local ID of the face
+		 *
+		 * @tparam M The implementing class of the UnstructuredMeshInterface
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/mesh/stateful data
+		 * @tparam L The label datatype of the unstructured mesh
+		 */
+		template <class M, class I, class T, class L>
+		__attribute__((warn_unused_result))
+		inline cupcfd::error::eCodes FluxMassDolfynFace(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh, I faceID,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx, I nDudx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx, I nDvdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx, I nDwdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dpdx, I nDpdx,
+													T * denCell, I nDenCell,
+													T * denBoundary, I nDenBoundary,
+													T * uCell, I nUCell,
+													T * vCell, I nVCell,
+													T * wCell, I nWCell,
+													T * massFlux, I nMassFlux,
+													T * p, I nP,
+													T * ar, I nAr,
+													T * su, I nSu,
+													T * rface, I nRFace,
+													T small,
+													I * icinl,
+													I * icout,
+													I * icsym,
+													I * icwal,
+													bool solveTurbEnergy,
+													bool solveTurbDiss,
+													bool solveVisc,
+													bool solveEnthalpy,
+													T * teCell, I nTeCell,
+													T * teBoundary, I nTeBoundary,
+													T * edCell, I nEdCell,
+													T * edBoundary, I nEdBoundary,
+													T * viseffCell, I nViseffCell,
+													T * viseffBoundary, I nViseffBoundary,
+													T * tCell, I nTCell,
+													T * tBoundary, I nTBoundary);
+
+		/**
+		 * Thread-parallel version of FluxMassDolfynFaceLoop.
+		 *
+		 * The faces of each colour of the mesh face colouring are processed concurrently using OpenMP, and
+		 * the colours are processed in order. The boundary type counters are reduced across threads.
+		 * If the face colouring has not been built, this runs FluxMassDolfynFaceLoop instead.
+		 *
+		 * @tparam M The implementing class of the UnstructuredMeshInterface
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/mesh/stateful data
+		 * @tparam L The label datatype of the unstructured mesh
+		 */
+		template <class M, class I, class T, class L>
+		__attribute__((warn_unused_result))
+		cupcfd::error::eCodes FluxMassDolfynFaceLoopColoured(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx, I nDudx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx, I nDvdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx, I nDwdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dpdx, I nDpdx,
+													T * denCell, I nDenCell,
+													T * denBoundary, I nDenBoundary,
+													T * uCell, I nUCell,
+													T * vCell, I nVCell,
+													T * wCell, I nWCell,
+													T * massFlux, I nMassFlux,
+													T * p, I nP,
+													T * ar, I nAr,
+													T * su, I nSu,
+													T * rface, I nRFace,
+													T small,
+													I * icinl,
+													I * icout,
+													I * icsym,
+													I * icwal,
+													bool solveTurbEnergy,
+													bool solveTurbDiss,
+													bool solveVisc,
+													bool solveEnthalpy,
+													T * teCell, I nTeCell,
+													T * teBoundary, I nTeBoundary,
+													T * edCell, I nEdCell,
+													T * edBoundary, I nEdBoundary,
+													T * viseffCell, I nViseffCell,
+													T * viseffBoundary, I nViseffBoundary,
+													T * tCell, I nTCell,
+													T * tBoundary, I nTBoundary);
+
 		/**
 		 *
 		 * @tparam M The implementing class of the UnstructuredMeshInterface
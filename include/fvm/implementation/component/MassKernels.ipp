@@ -34,7 +34,7 @@ namespace cupcfd
 	namespace fvm
 	{
 		template <class M, class I, class T, class L>
-		cupcfd::error::eCodes FluxMassDolfynFaceLoop(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+		inline cupcfd::error::eCodes FluxMassDolfynFace(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh, I faceID,
 													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx, I nDudx,
 													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx, I nDvdx,
 													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx, I nDwdx,
@@ -66,6 +66,8 @@ namespace cupcfd
 													T * viseffBoundary, I nViseffBoundary,
 													T * tCell, I nTCell,
 													T * tBoundary, I nTBoundary) {
+			const cupcfd::geometry::mesh::UnstructuredMeshKernelView<I,T>& view = mesh.kernelView;
+
 			I ip, in, ib, ir;
 			T facn, facp;
 			T denf;
@@ -92,220 +94,367 @@ namespace cupcfd
 			T dpx, dpy, dpz;
 			T dens;
 
-			for(int i = 0; i < mesh.properties.lFaces; i++) {
-				ip = mesh.getFaceCell1ID(i);
-				in = mesh.getFaceCell2ID(i);
+			I i = faceID;
 
-				bool isBoundary = mesh.getFaceIsBoundary(i);
+			ip = view.faceCell1[i];
+			in = view.faceCell2[i];
 
+			bool isBoundary = view.faceIsBoundary[i];
+
+			#ifdef DEBUG
+				if (i >= nMassFlux) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+			#endif
+			if(!isBoundary) {
 				#ifdef DEBUG
-					if (i >= nMassFlux) {
+					if (in >= nDudx || ip >= nDudx) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (in >= nDvdx || ip >= nDvdx) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (in >= nDwdx || ip >= nDwdx) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (in >= nDpdx || ip >= nDpdx) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (in >= nDenCell || ip >= nDenCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (in >= nUCell || ip >= nUCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (in >= nVCell || ip >= nVCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (in >= nWCell || ip >= nWCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (in >= nP || ip >= nP) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (in >= nAr || ip >= nAr) {
 						return cupcfd::error::E_INVALID_INDEX;
 					}
 				#endif
-				if(!isBoundary) {
-					#ifdef DEBUG
-						if (in >= nDudx || ip >= nDudx) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (in >= nDvdx || ip >= nDvdx) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (in >= nDwdx || ip >= nDwdx) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (in >= nDpdx || ip >= nDpdx) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (in >= nDenCell || ip >= nDenCell) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (in >= nUCell || ip >= nUCell) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (in >= nVCell || ip >= nVCell) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (in >= nWCell || ip >= nWCell) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (in >= nP || ip >= nP) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (in >= nAr || ip >= nAr) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-					#endif
 
-					facn = mesh.getFaceLambda(i);
-					facp = 1.0 - facn;
-					dudxac = dudx[in] * facn + dudx[ip] * facp;
-					dvdxac = dvdx[in] * facn + dvdx[ip] * facp;
-					dwdxac = dwdx[in] * facn + dwdx[ip] * facp;
+				facn = view.faceLambda[i];
+				facp = 1.0 - facn;
+				dudxac = dudx[in] * facn + dudx[ip] * facp;
+				dvdxac = dvdx[in] * facn + dvdx[ip] * facp;
+				dwdxac = dwdx[in] * facn + dwdx[ip] * facp;
 
-					denf = denCell[in] * facn + denCell[ip] * facp;
-					xac = mesh.getCellCenter(in) * facn + mesh.getCellCenter(ip) * facp;
-					xface = mesh.getFaceCenter(i);
-					delta = xface - xac;
+				denf = denCell[in] * facn + denCell[ip] * facp;
+				xac = view.cellCenter(in) * facn + view.cellCenter(ip) * facp;
+				xface = view.faceCenter(i);
+				delta = xface - xac;
 
-					uFace = uCell[in]*facn + uCell[ip]*facp + dudxac.dotProduct(delta);
-					vFace = vCell[in]*facn + vCell[ip]*facp + dvdxac.dotProduct(delta);
-					wFace = wCell[in]*facn + wCell[ip]*facp + dwdxac.dotProduct(delta);
+				uFace = uCell[in]*facn + uCell[ip]*facp + dudxac.dotProduct(delta);
+				vFace = vCell[in]*facn + vCell[ip]*facp + dvdxac.dotProduct(delta);
+				wFace = wCell[in]*facn + wCell[ip]*facp + dwdxac.dotProduct(delta);
 
-					massFlux[i] = denf * (uFace * mesh.getFaceNorm(i).cmp[0] +
-										vFace * mesh.getFaceNorm(i).cmp[1] +
-										wFace * mesh.getFaceNorm(i).cmp[2]);
+				massFlux[i] = denf * (uFace * view.faceNormX[i] +
+									vFace * view.faceNormY[i] +
+									wFace * view.faceNormZ[i]);
 
-					xnorm = mesh.getFaceNorm(i);
-					xnorm.normalise();
+				xnorm = view.faceNorm(i);
+				xnorm.normalise();
 
-					xpac = mesh.getFaceXpac(i);
-					xnac = mesh.getFaceXnac(i);
+				xpac = view.faceXpac(i);
+				xnac = view.faceXnac(i);
 
-					delp = xpac - mesh.getCellCenter(ip);
-					pip = p[ip] + dpdx[ip].dotProduct(delp);
+				delp = xpac - view.cellCenter(ip);
+				pip = p[ip] + dpdx[ip].dotProduct(delp);
 
-					deln = xpac - mesh.getCellCenter(in);
-					pin = p[in] + dpdx[ip].dotProduct(deln);
+				deln = xpac - view.cellCenter(in);
+				pin = p[in] + dpdx[ip].dotProduct(deln);
 
-					xpn = xnac - xpac;
-					xpn2 = mesh.getCellCenter(in) - mesh.getCellCenter(ip);
+				xpn = xnac - xpac;
+				xpn2 = view.cellCenter(in) - view.cellCenter(ip);
 
-					apv1 = denCell[ip] * ar[ip];
-					apv2 = denCell[in] * ar[in];
-					apv = apv2 * facn + apv1 * facp;
+				apv1 = denCell[ip] * ar[ip];
+				apv2 = denCell[in] * ar[in];
+				apv = apv2 * facn + apv1 * facp;
 
-					factv = mesh.getCellVolume(in) * facn + mesh.getCellVolume(ip) * facp;
-					apv *= mesh.getFaceArea(i) * factv/xpn2.dotProduct(xnorm);
+				factv = view.cellVolume[in] * facn + view.cellVolume[ip] * facp;
+				apv *= view.faceArea[i] * factv/xpn2.dotProduct(xnorm);
 
-					dpx = (dpdx[in].cmp[0] * facn + dpdx[ip].cmp[0] * facp) * xpn.cmp[0];
-					dpy = (dpdx[in].cmp[1] * facn + dpdx[ip].cmp[1] * facp) * xpn.cmp[1];
-					dpz = (dpdx[in].cmp[2] * facn + dpdx[ip].cmp[2] * facp) * xpn.cmp[2];
+				dpx = (dpdx[in].cmp[0] * facn + dpdx[ip].cmp[0] * facp) * xpn.cmp[0];
+				dpy = (dpdx[in].cmp[1] * facn + dpdx[ip].cmp[1] * facp) * xpn.cmp[1];
+				dpz = (dpdx[in].cmp[2] * facn + dpdx[ip].cmp[2] * facp) * xpn.cmp[2];
 
-					fact = apv;
+				fact = apv;
 
-					#ifdef DEBUG
-						if ( ((i*2)+1) >= nRFace) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-					#endif
-					rface[(i*2)] = -fact;
-					rface[(i*2)+1] = -fact;
+				#ifdef DEBUG
+					if ( ((i*2)+1) >= nRFace) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+				#endif
+				rface[(i*2)] = -fact;
+				rface[(i*2)+1] = -fact;
 
-					massFlux[i] = massFlux[i] - fact * ((pin-pip) - dpx - dpy - dpz);
+				massFlux[i] = massFlux[i] - fact * ((pin-pip) - dpx - dpy - dpz);
+			}
+			else {
+				ip = view.faceCell1[i];
+				ib = view.faceBoundaryID[i];
+				ir = mesh.getBoundaryRegionID(ib);
+				it = mesh.getRegionType(ir);
+
+				#ifdef DEBUG
+					if (ip >= nSu) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ip >= nUCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ip >= nVCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ip >= nWCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ip >= nDenCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ib >= nDenBoundary) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ib >= nTeBoundary) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ib >= nTeCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ib >= nEdBoundary) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ib >= nViseffBoundary) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ib >= nTBoundary) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ip >= nEdCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ip >= nViseffCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ip >= nTCell) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+				#endif
+
+				if(it == cupcfd::geometry::mesh::RTYPE_INLET) {
+					*icinl = *icinl + 1;
+					xac = view.faceCenter(i);
+
+					// Ignoring User Option
+					uIn = mesh.getRegionUVW(ir);
+					dens = mesh.getRegionDen(ir);
+
+					norm = view.faceNorm(i);
+					massFlux[i] = dens * uIn.dotProduct(norm);
+					su[ip] = su[ip] - massFlux[i];
 				}
-				else {
-					ip = mesh.getFaceCell1ID(i);
-					ib = mesh.getFaceBoundaryID(i);
-					ir = mesh.getBoundaryRegionID(ib);
-					it = mesh.getRegionType(ir);
+				else if(it == cupcfd::geometry::mesh::RTYPE_OUTLET) {
+					*icout = *icout + 1;
+					delta = view.faceCenter(i) - view.cellCenter(ip);
+					uFace = uCell[ip];
+					vFace = vCell[ip];
+					wFace = wCell[ip];
 
-					#ifdef DEBUG
-						if (ip >= nSu) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ip >= nUCell) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ip >= nVCell) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ip >= nWCell) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ip >= nDenCell) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ib >= nDenBoundary) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ib >= nTeBoundary) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ib >= nTeCell) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ib >= nEdBoundary) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ib >= nViseffBoundary) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ib >= nTBoundary) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ip >= nEdCell) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ip >= nViseffCell) {
-							return cupcfd::error::E_INVALID_INDEX;
+					denf = denCell[ip];
+					denBoundary[ib] = denf;
+
+					norm = view.faceNorm(i);
+					massFlux[i] = denf * (uFace * norm.cmp[0] +
+										 vFace * norm.cmp[1] +
+										 wFace * norm.cmp[2]);
+
+					if(massFlux[i] < 0.0) {
+						massFlux[i] = small;
+
+						if(solveTurbEnergy) {
+							teBoundary[ib] = teCell[ip];
 						}
-						if (ip >= nTCell) {
-							return cupcfd::error::E_INVALID_INDEX;
+
+						if(solveTurbDiss) {
+							edBoundary[ib] = edCell[ip];
 						}
-					#endif
 
-					if(it == cupcfd::geometry::mesh::RTYPE_INLET) {
-						*icinl = *icinl + 1;
-						xac = mesh.getFaceCenter(i);
+						if(solveVisc) {
+							viseffBoundary[ib] = viseffCell[ip];
+						}
 
-						// Ignoring User Option
-						uIn = mesh.getRegionUVW(ir);
-						dens = mesh.getRegionDen(ir);
+						if(solveEnthalpy) {
+							tBoundary[ib] = tCell[ip];
+						}
 
-						norm = mesh.getFaceNorm(i);
-						massFlux[i] = dens * uIn.dotProduct(norm);
-						su[ip] = su[ip] - massFlux[i];
+						// Skip SolveScalars
 					}
-					else if(it == cupcfd::geometry::mesh::RTYPE_OUTLET) {
-						*icout = *icout + 1;
-						delta = mesh.getFaceCenter(i) - mesh.getCellCenter(ip);
-						uFace = uCell[ip];
-						vFace = vCell[ip];
-						wFace = wCell[ip];
-
-						denf = denCell[ip];
-						denBoundary[ib] = denf;
+				}
+				else if(it == cupcfd::geometry::mesh::RTYPE_SYMP) {
+					*icsym = *icsym + 1;
+					massFlux[i] = 0.0;
+				}
+				else if(it == cupcfd::geometry::mesh::RTYPE_WALL) {
+					*icwal = *icwal + 1;
+					massFlux[i] = 0.0;
+				}
+			}
 
-						norm = mesh.getFaceNorm(i);
-						massFlux[i] = denf * (uFace * norm.cmp[0] +
-											 vFace * norm.cmp[1] +
-											 wFace * norm.cmp[2]);
+			return cupcfd::error::E_SUCCESS;
+		}
 
-						if(massFlux[i] < 0.0) {
-							massFlux[i] = small;
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes FluxMassDolfynFaceLoop(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx, I nDudx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx, I nDvdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx, I nDwdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dpdx, I nDpdx,
+													T * denCell, I nDenCell,
+													T * denBoundary, I nDenBoundary,
+													T * uCell, I nUCell,
+													T * vCell, I nVCell,
+													T * wCell, I nWCell,
+													T * massFlux, I nMassFlux,
+													T * p, I nP,
+													T * ar, I nAr,
+													T * su, I nSu,
+													T * rface, I nRFace,
+													T small,
+													I * icinl,
+													I * icout,
+													I * icsym,
+													I * icwal,
+													bool solveTurbEnergy,
+													bool solveTurbDiss,
+													bool solveVisc,
+													bool solveEnthalpy,
+													T * teCell, I nTeCell,
+													T * teBoundary, I nTeBoundary,
+													T * edCell, I nEdCell,
+													T * edBoundary, I nEdBoundary,
+													T * viseffCell, I nViseffCell,
+													T * viseffBoundary, I nViseffBoundary,
+													T * tCell, I nTCell,
+													T * tBoundary, I nTBoundary) {
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!mesh.kernelView.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
 
-							if(solveTurbEnergy) {
-								teBoundary[ib] = teCell[ip];
-							}
+			cupcfd::error::eCodes status;
+
+			for(I i = 0; i < mesh.properties.lFaces; i++) {
+				status = FluxMassDolfynFace(mesh, i, dudx, nDudx, dvdx, nDvdx, dwdx, nDwdx, dpdx, nDpdx, denCell,
+							nDenCell, denBoundary, nDenBoundary, uCell, nUCell, vCell, nVCell, wCell, nWCell,
+							massFlux, nMassFlux, p, nP, ar, nAr, su, nSu, rface, nRFace, small, icinl, icout,
+							icsym, icwal, solveTurbEnergy, solveTurbDiss, solveVisc, solveEnthalpy, teCell,
+							nTeCell, teBoundary, nTeBoundary, edCell, nEdCell, edBoundary, nEdBoundary,
+							viseffCell, nViseffCell, viseffBoundary, nViseffBoundary, tCell, nTCell,
+							tBoundary, nTBoundary);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+			}
 
-							if(solveTurbDiss) {
-								edBoundary[ib] = edCell[ip];
-							}
+			return cupcfd::error::E_SUCCESS;
+		}
 
-							if(solveVisc) {
-								viseffBoundary[ib] = viseffCell[ip];
-							}
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes FluxMassDolfynFaceLoopColoured(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx, I nDudx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx, I nDvdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx, I nDwdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dpdx, I nDpdx,
+													T * denCell, I nDenCell,
+													T * denBoundary, I nDenBoundary,
+													T * uCell, I nUCell,
+													T * vCell, I nVCell,
+													T * wCell, I nWCell,
+													T * massFlux, I nMassFlux,
+													T * p, I nP,
+													T * ar, I nAr,
+													T * su, I nSu,
+													T * rface, I nRFace,
+													T small,
+													I * icinl,
+													I * icout,
+													I * icsym,
+													I * icwal,
+													bool solveTurbEnergy,
+													bool solveTurbDiss,
+													bool solveVisc,
+													bool solveEnthalpy,
+													T * teCell, I nTeCell,
+													T * teBoundary, I nTeBoundary,
+													T * edCell, I nEdCell,
+													T * edBoundary, I nEdBoundary,
+													T * viseffCell, I nViseffCell,
+													T * viseffBoundary, I nViseffBoundary,
+													T * tCell, I nTCell,
+													T * tBoundary, I nTBoundary) {
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!mesh.kernelView.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
 
-							if(solveEnthalpy) {
-								tBoundary[ib] = tCell[ip];
-							}
+			if(!mesh.faceColouring.built) {
+				return FluxMassDolfynFaceLoop(mesh, dudx, nDudx, dvdx, nDvdx, dwdx, nDwdx, dpdx, nDpdx,
+						denCell, nDenCell, denBoundary, nDenBoundary, uCell, nUCell, vCell, nVCell, wCell,
+						nWCell, massFlux, nMassFlux, p, nP, ar, nAr, su, nSu, rface, nRFace, small, icinl,
+						icout, icsym, icwal, solveTurbEnergy, solveTurbDiss, solveVisc, solveEnthalpy,
+						teCell, nTeCell, teBoundary, nTeBoundary, edCell, nEdCell, edBoundary, nEdBoundary,
+						viseffCell, nViseffCell, viseffBoundary, nViseffBoundary, tCell, nTCell, tBoundary,
+						nTBoundary);
+			}
 
-							// Skip SolveScalars
+			cupcfd::error::eCodes status = cupcfd::error::E_SUCCESS;
+
+			I nColours = mesh.faceColouring.nColours;
+			I * colourXAdj = mesh.faceColouring.colourXAdj;
+			I * colourFaces = mesh.faceColouring.colourFaces;
+
+			// Boundary condition counters are accumulated per thread and then reduced
+			I nInl = 0;
+			I nOut = 0;
+			I nSym = 0;
+			I nWal = 0;
+
+			// No two faces of a colour share a cell, and the implicit barrier at the end of each loop orders the colours
+			#pragma omp parallel reduction(+:nInl,nOut,nSym,nWal)
+			{
+				for(I c = 0; c < nColours; c++) {
+					#pragma omp for
+					for(I j = colourXAdj[c]; j < colourXAdj[c+1]; j++) {
+						cupcfd::error::eCodes faceStatus;
+						faceStatus = FluxMassDolfynFace(mesh, colourFaces[j], dudx, nDudx, dvdx, nDvdx,
+									dwdx, nDwdx, dpdx, nDpdx, denCell, nDenCell, denBoundary, nDenBoundary,
+									uCell, nUCell, vCell, nVCell, wCell, nWCell, massFlux, nMassFlux, p, nP,
+									ar, nAr, su, nSu, rface, nRFace, small, &nInl, &nOut, &nSym, &nWal,
+									solveTurbEnergy, solveTurbDiss, solveVisc, solveEnthalpy, teCell,
+									nTeCell, teBoundary, nTeBoundary, edCell, nEdCell, edBoundary,
+									nEdBoundary, viseffCell, nViseffCell, viseffBoundary, nViseffBoundary,
+									tCell, nTCell, tBoundary, nTBoundary);
+						if(faceStatus != cupcfd::error::E_SUCCESS) {
+							#pragma omp critical
+							status = faceStatus;
 						}
 					}
-					else if(it == cupcfd::geometry::mesh::RTYPE_SYMP) {
-						*icsym = *icsym + 1;
-						massFlux[i] = 0.0;
-					}
-					else if(it == cupcfd::geometry::mesh::RTYPE_WALL) {
-						*icwal = *icwal + 1;
-						massFlux[i] = 0.0;
-					}
 				}
 			}
 
-			return cupcfd::error::E_SUCCESS;
+			*icinl = *icinl + nInl;
+			*icout = *icout + nOut;
+			*icsym = *icsym + nSym;
+			*icwal = *icwal + nWal;
+
+			return status;
 		}
 
 		template <class M, class I, class T, class L>
@@ -371,6 +520,13 @@ namespace cupcfd
 		template <class M, class I, class T, class L>
 		cupcfd::error::eCodes FluxMassDolfynBoundaryLoop3(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
 										 T flowin, T * ratearea) {
+			const cupcfd::geometry::mesh::UnstructuredMeshKernelView<I,T>& view = mesh.kernelView;
+
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!view.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
 			cupcfd::geometry::mesh::RType it;
 			T areaout;
 			I ib, ir, i;
@@ -383,7 +539,7 @@ namespace cupcfd
 
 				if(it == cupcfd::geometry::mesh::RTYPE_OUTLET) {
 					i = mesh.getBoundaryFaceID(ib);
-					areaout = areaout + mesh.getFaceArea(i);
+					areaout = areaout + view.faceArea[i];
 				}
 			}
 
@@ -401,6 +557,13 @@ namespace cupcfd
 														 T * denBoundary, I nDenBoundary,
 														 T ratearea,
 														 T * flowout) {
+			const cupcfd::geometry::mesh::UnstructuredMeshKernelView<I,T>& view = mesh.kernelView;
+
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!view.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
 			cupcfd::geometry::mesh::RType it;
 			cupcfd::geometry::euclidean::EuclideanVector<T,3> xnorm;
 
@@ -436,10 +599,10 @@ namespace cupcfd
 					#endif
 
 					split = mesh.getRegionSplvl(ir);
-					massFlux[i] = ratearea * mesh.getFaceArea(i) * split;
-					faceFlux = massFlux[i]/denBoundary[ib]/mesh.getFaceArea(i);
+					massFlux[i] = ratearea * view.faceArea[i] * split;
+					faceFlux = massFlux[i]/denBoundary[ib]/view.faceArea[i];
 
-					xnorm = mesh.getFaceNorm(i);
+					xnorm = view.faceNorm(i);
 					xnorm.normalise();
 
 					uBoundary[ib] = faceFlux * xnorm.cmp[0];
@@ -464,6 +627,13 @@ namespace cupcfd
 														T fact, bool solveU, bool solveV, bool solveW,
 														T * flowFact, I nFlowFact,
 														T * flowout2) {
+			const cupcfd::geometry::mesh::UnstructuredMeshKernelView<I,T>& view = mesh.kernelView;
+
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!view.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
 			cupcfd::geometry::mesh::RType it;
 			I ib, ir;
 
@@ -507,7 +677,7 @@ namespace cupcfd
 						wBoundary[ib] = wBoundary[ib] * fact;
 					}
 
-					int ip = mesh.getFaceCell1ID(i);
+					int ip = view.faceCell1[i];
 					#ifdef DEBUG
 						if (ip >= nSu) {
 							return cupcfd::error::E_INVALID_INDEX;
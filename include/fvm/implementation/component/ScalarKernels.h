@@ -65,6 +65,72 @@ namespace cupcfd
 														int ivar, int VarT, T Sigma_T, T Prandtl,
 														int VarTE, T Sigma_k, int VarED, T Sigma_e,
 														T Sigma_s, T Schmidt, T GammaBlend, T Small, T Large, T TMCmu);
+
+		/**
+		 * Compute the scalar fluxes of a single face. This is the body of the face loop of FluxScalarDolfynFaceLoop.
+		 *
+		 * @param faceID The local ID of the face
+		 *
+		 * @tparam M The implementing class of the UnstructuredMeshInterface
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/mesh/stateful data
+		 * @tparam L The label datatype of the unstructured mesh
+		 */
+		template <class M, class I, class T, class L>
+		__attribute__((warn_unused_result))
+		inline cupcfd::error::eCodes FluxScalarDolfynFace(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh, I faceID,
+														T * PhiCell, I nPhiCell,
+														T * PhiBoundary, I nPhiBoundary,
+														T * VisEff, I nVisEff,
+														T * Au, I nAu,
+														T * Su, I nSu,
+														T * Den, I nDen,
+														T * MassFlux, I nMassFlux,
+														T * TE, I nTE,
+														T * CpBoundary, I nCpBoundary,
+														T * visEffBoundary, I nVisEffBoundary,
+														T * RFace, I nRFace,
+														cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidx, int ndPhidx,
+														bool SolveTurb, bool SolveEnthalpy,
+														// T sigma, T sigma2, 
+														T vislam,
+														int ivar, int VarT, T Sigma_T, T Prandtl,
+														int VarTE, T Sigma_k, int VarED, T Sigma_e,
+														T Sigma_s, T Schmidt, T GammaBlend, T Small, T Large, T TMCmu);
+
+		/**
+		 * Thread-parallel version of FluxScalarDolfynFaceLoop.
+		 *
+		 * The faces of each colour of the mesh face colouring are processed concurrently using OpenMP, and
+		 * the colours are processed in order. If the face colouring has not been built, this runs
+		 * FluxScalarDolfynFaceLoop instead.
+		 *
+		 * @tparam M The implementing class of the UnstructuredMeshInterface
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/mesh/stateful data
+		 * @tparam L The label datatype of the unstructured mesh
+		 */
+		template <class M, class I, class T, class L>
+		__attribute__((warn_unused_result))
+		cupcfd::error::eCodes FluxScalarDolfynFaceLoopColoured(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+														T * PhiCell, I nPhiCell,
+														T * PhiBoundary, I nPhiBoundary,
+														T * VisEff, I nVisEff,
+														T * Au, I nAu,
+														T * Su, I nSu,
+														T * Den, I nDen,
+														T * MassFlux, I nMassFlux,
+														T * TE, I nTE,
+														T * CpBoundary, I nCpBoundary,
+														T * visEffBoundary, I nVisEffBoundary,
+														T * RFace, I nRFace,
+														cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidx, int ndPhidx,
+														bool SolveTurb, bool SolveEnthalpy,
+														// T sigma, T sigma2, 
+														T vislam,
+														int ivar, int VarT, T Sigma_T, T Prandtl,
+														int VarTE, T Sigma_k, int VarED, T Sigma_e,
+														T Sigma_s, T Schmidt, T GammaBlend, T Small, T Large, T TMCmu);
 	}
 }
 
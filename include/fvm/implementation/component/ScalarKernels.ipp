@@ -34,7 +34,7 @@ namespace cupcfd
 	namespace fvm
 	{
 		template <class M, class I, class T, class L>
-		cupcfd::error::eCodes FluxScalarDolfynFaceLoop(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+		inline cupcfd::error::eCodes FluxScalarDolfynFace(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh, I faceID,
 														T * PhiCell, I nPhiCell,
 														T * PhiBoundary, I nPhiBoundary,
 														T * VisEff, I nVisEff,
@@ -52,9 +52,11 @@ namespace cupcfd
 														T vislam,
 														int ivar, int VarT, T Sigma_T, T Prandtl,
 														int VarTE, T Sigma_k, int VarED, T Sigma_e,
-														T Sigma_s, T Schmidt, T GammaBlend, T Small, T Large, T TMCmu) {
+														T Sigma_s, T Schmidt, T GammaBlend, T Small, T Large __attribute__((unused)), T TMCmu) {
+			const cupcfd::geometry::mesh::UnstructuredMeshKernelView<I,T>& view = mesh.kernelView;
+
 			cupcfd::geometry::mesh::RType it;
-			I i, ip, in, ib, ir;
+			I ip, in, ib, ir;
 			T facn, facp;
 
 			// T Phiac;
@@ -67,7 +69,7 @@ namespace cupcfd
 			T s2, dn;
 			T Tdif;
 
-			T blend, peclet, Resist, Hcoef, SLres, Cmu25, Tplus, utau;
+			T blend, Resist, Hcoef, SLres, Cmu25, Tplus, utau;
 
 			cupcfd::geometry::euclidean::EuclideanPoint<T,3> Xac;
 			cupcfd::geometry::euclidean::EuclideanPoint<T,3> tmpPoint;
@@ -78,196 +80,233 @@ namespace cupcfd
 			cupcfd::geometry::euclidean::EuclideanVector<T,3> dPhidxac;
 			cupcfd::geometry::euclidean::EuclideanVector<T,3> d2, d3, ds;
 
-			T pe0, pe1;
-			T QTransferIn, QTransferOut;
-			T Atot, qmin, qmax, qtot, hmin, hmax, htot;
+			// This is set by the DiffScheme in the original, which is not ported, so start each face
+			// from zero rather than the value of the previously visited face
+			T PhiFace = T(0);
 
-			// This is set by the DiffScheme in the original
-			T PhiFace;
+			// The original also accumulates the Peclet number range and wall heat transfer totals across
+			// the face loop for reporting. These were never returned, and are left off so that faces
+			// can be processed independently.
 
+			I i = faceID;
 
-			pe0 = Large;
-			pe1 = Large;
-			QTransferIn = 0.0;
-			QTransferOut = 0.0;
-			Atot = 0.0;
-			qmin = Large;
-			qmax = -Large;
-			qtot = 0.0;
-			hmin = Large;
-			hmax = -Large;
-			htot = 0.0;
+			#ifndef NDEBUG
+				if (i >= nMassFlux) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+			#endif
 
-			for(i = 0; i < mesh.properties.lFaces; i++) {
-				#ifndef NDEBUG
-					if (i >= nMassFlux) {
-						return cupcfd::error::E_INVALID_INDEX;
-					}
-				#endif
+			ip = view.faceCell1[i];
+			in = view.faceCell2[i];
 
-				ip = mesh.getFaceCell1ID(i);
-				in = mesh.getFaceCell2ID(i);
+			#ifndef NDEBUG
+				if (ip >= nVisEff || in >= nVisEff) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				if (ip >= nAu) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				if (ip >= nSu || in >= nSu) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				if (ip >= ndPhidx || in >= ndPhidx) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+			#endif
+
+			bool isBoundary = view.faceIsBoundary[i];
 
+			if(!isBoundary) {
 				#ifndef NDEBUG
-					if (ip >= nVisEff || in >= nVisEff) {
-						return cupcfd::error::E_INVALID_INDEX;
-					}
-					if (ip >= nAu) {
-						return cupcfd::error::E_INVALID_INDEX;
-					}
-					if (ip >= nSu || in >= nSu) {
-						return cupcfd::error::E_INVALID_INDEX;
-					}
-					if (ip >= ndPhidx || in >= ndPhidx) {
+					if (ip >= nPhiCell || in >= nPhiCell) {
 						return cupcfd::error::E_INVALID_INDEX;
 					}
 				#endif
 
-				bool isBoundary = mesh.getFaceIsBoundary(i);
+				facn = view.faceLambda[i];
+				facp = 1.0 - facn;
+
+				Xac = view.cellCenter(in) * facn + view.cellCenter(ip) * facp;
+
+				// Phiac = PhiCell[in] * facn + PhiCell[ip] * facp;
+				Visac = VisEff[in] * facn + VisEff[ip] * facp;
 
-				if(!isBoundary) {
-					#ifndef NDEBUG
-						if (ip >= nPhiCell || in >= nPhiCell) {
-							return cupcfd::error::E_INVALID_INDEX;
+
+				if(SolveTurb) {
+						Visac = Visac - VisLam;
+
+						if(ivar == VarT) {
+							Visac = ( VisLam + Visac / Sigma_T )/Prandtl;
+						}
+						else if( ivar == VarTE ) {
+							Visac = VisLam + Visac / Sigma_k;
 						}
-					#endif
+						else if( ivar == VarED ) {
+							Visac = VisLam + Visac / Sigma_e;
+						}
+						else {
+							Visac = ( VisLam + Visac / Sigma_s )/Schmidt;
+						}
+				}
+				else {
+						if( ivar == VarT ) {
+							Visac  = Visac / Prandtl;
+						}
+						else {
+							Visac  = Visac / Schmidt;
+						}
+				}
 
-					facn = mesh.getFaceLambda(i);
-					facp = 1.0 - facn;
 
-					Xac = mesh.getCellCenter(in) * facn + mesh.getCellCenter(ip) * facp;
+				dPhidxac = dPhidx[in] * facn + dPhidx[ip] * facp;
 
-					// Phiac = PhiCell[in] * facn + PhiCell[ip] * facp;
-					Visac = VisEff[in] * facn + VisEff[ip] * facp;
+				cupcfd::geometry::euclidean::EuclideanVector<T,3> tmp;
+				tmpPoint = view.faceCenter(i);
+				tmpVec = tmpPoint - Xac;
 
+				// T delta = dPhidxac.dotProduct(tmpVec);
 
-					if(SolveTurb) {
-							Visac = Visac - VisLam;
+				Xpn = view.cellCenter(in) - view.cellCenter(ip);
+				VisFace  = Visac * view.faceRLencos[i];
 
-							if(ivar == VarT) {
-								Visac = ( VisLam + Visac / Sigma_T )/Prandtl;
-							}
-							else if( ivar == VarTE ) {
-								Visac = VisLam + Visac / Sigma_k;
-							}
-							else if( ivar == VarED ) {
-								Visac = VisLam + Visac / Sigma_e;
-							}
-							else {
-								Visac = ( VisLam + Visac / Sigma_s )/Schmidt;
-							}
-					}
-					else {
-							if( ivar == VarT ) {
-								Visac  = Visac / Prandtl;
-							}
-							else {
-								Visac  = Visac / Schmidt;
-							}
-					}
+				//call SelectDiffSchemeScalar(i,iScheme,ip,in, &
+				//                            Phi,dPhidx,PhiFace)
 
+				fce = MassFlux[i] * PhiFace;
 
-					dPhidxac = dPhidx[in] * facn + dPhidx[ip] * facp;
+				cupcfd::geometry::euclidean::EuclideanVector<T,3> norm;
+				norm = view.faceNorm(i);
+				fde1 = Visac * dPhidxac.dotProduct(norm);
 
-					cupcfd::geometry::euclidean::EuclideanVector<T,3> tmp;
-					tmpPoint = mesh.getFaceCenter(i);
-					tmpVec = tmpPoint - Xac;
+				d1  = Xpn.dotProduct(norm);
+				s2  = view.faceArea[i] * view.faceArea[i];
 
-					// T delta = dPhidxac.dotProduct(tmpVec);
+				d2  = Xpn * s2/d1;
+				d3  = norm - d2;
 
-					Xpn = mesh.getCellCenter(in) - mesh.getCellCenter(ip);
-					VisFace  = Visac * mesh.getFaceRLencos(i);
+				// fde2 = Visac * d3.dotProduct(dPhidxac);
 
-					//call SelectDiffSchemeScalar(i,iScheme,ip,in, &
-					//                            Phi,dPhidx,PhiFace)
+				fci = fmin(MassFlux[i], 0.0) * PhiCell[in] + fmax(MassFlux[i], 0.0) * PhiCell[ip];
 
-					fce = MassFlux[i] * PhiFace;
+				fdi = VisFace * dPhidxac.dotProduct(Xpn);
 
-					cupcfd::geometry::euclidean::EuclideanVector<T,3> norm;
-					norm = mesh.getFaceNorm(i);
-					fde1 = Visac * dPhidxac.dotProduct(norm);
+				#ifndef NDEBUG
+					if ((i*2)+1 >= nRFace) {
+						return cupcfd::error::E_INVALID_INDEX;
+					} 
+				#endif
+				RFace[(i*2)] = -VisFace - fmax(MassFlux[i], 0.0);
+				RFace[(i*2)+1] = -VisFace + fmin(MassFlux[i], 0.0);
 
-					d1  = Xpn.dotProduct(norm);
-					s2  = mesh.getFaceArea(i) * mesh.getFaceArea(i);
+				blend = GammaBlend * (fce - fci);
+				Su[ip] = Su[ip] - blend + fde1 - fdi;
+				Su[in] = Su[in] + blend - fde1 + fdi;
 
-					d2  = Xpn * s2/d1;
-					d3  = norm - d2;
+				// T length = (T)Xpn.length();
+				// peclet = MassFlux[i]/ mesh.getFaceArea(i) * length/(Visac + Small);
+				// pe0 = fmin(pe0, peclet);
+				// pe1 = fmax(pe1, peclet);
+			}
+			else {
+				#ifndef NDEBUG
+					if (ip >= nDen) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+				#endif
 
-					// fde2 = Visac * d3.dotProduct(dPhidxac);
+				ib = view.faceBoundaryID[i];
+				ir = mesh.getBoundaryRegionID(ib);
+				it = mesh.getRegionType(ir);
+				ip = view.faceCell1[i];
 
-					fci = fmin(MassFlux[i], 0.0) * PhiCell[in] + fmax(MassFlux[i], 0.0) * PhiCell[ip];
+				#ifndef NDEBUG
+					if (ib >= nPhiBoundary) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					if (ib >= nVisEffBoundary) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+				#endif
 
-					fdi = VisFace * dPhidxac.dotProduct(Xpn);
+				if( it == cupcfd::geometry::mesh::RTYPE_INLET) {
 
-					#ifndef NDEBUG
-						if ((i*2)+1 >= nRFace) {
-							return cupcfd::error::E_INVALID_INDEX;
-						} 
-					#endif
-					RFace[(i*2)] = -VisFace - fmax(MassFlux[i], 0.0);
-					RFace[(i*2)+1] = -VisFace + fmin(MassFlux[i], 0.0);
-
-					blend = GammaBlend * (fce - fci);
-					Su[ip] = Su[ip] - blend + fde1 - fdi;
-					Su[in] = Su[in] + blend - fde1 + fdi;
-
-					T length = (T)Xpn.length();
-					peclet = MassFlux[i]/ mesh.getFaceArea(i) * length/(Visac + Small);
-					pe0 = fmin(pe0, peclet);
-					pe1 = fmax(pe1, peclet);
+				dPhidxac = dPhidx[ip];
+				Xac = view.faceCenter(i);
+
+				// Will Skip User items for Now
+				if( ivar == VarT ) {
+					//PhiFace  = Reg(ir)%T;
+				}
+				else if( ivar == VarTE ) {
+					//PhiFace  = Reg(ir)%k;
 				}
+				else if( ivar == VarED ) {
+					//PhiFace  = Reg(ir)%e
+				}
+				// Skip Other handling for now
+				//else if( ivar > NVar )
+				//{
+					//PhiFace  = ScReg(ir,(iVar-Nvar))%value
+				//}
 				else {
-					#ifndef NDEBUG
-						if (ip >= nDen) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-					#endif
-
-					ib = mesh.getFaceBoundaryID(i);
-					ir = mesh.getBoundaryRegionID(ib);
-					it = mesh.getRegionType(ir);
-					ip = mesh.getFaceCell1ID(i);
-
-					#ifndef NDEBUG
-						if (ib >= nPhiBoundary) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ib >= nVisEffBoundary) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-					#endif
+					// ToDo: Error Case - Need to change handling, doesn't originally set to 0.0
+					PhiFace = T (0);
+				}
 
-					if( it == cupcfd::geometry::mesh::RTYPE_INLET) {
+				Visac = visEffBoundary[ib];
 
-					dPhidxac = dPhidx[ip];
-					Xac = mesh.getFaceCenter(i);
+				if( SolveTurb ) {
+					Visac = Visac - VisLam;
 
-					// Will Skip User items for Now
 					if( ivar == VarT ) {
-						//PhiFace  = Reg(ir)%T;
+						Visac = ( VisLam + Visac / Sigma_T )/Prandtl;
 					}
 					else if( ivar == VarTE ) {
-						//PhiFace  = Reg(ir)%k;
+						Visac = VisLam + Visac / Sigma_k;
 					}
 					else if( ivar == VarED ) {
-						//PhiFace  = Reg(ir)%e
+						Visac = VisLam + Visac / Sigma_e;
+					}
+					else {
+						Visac = ( VisLam + Visac / Sigma_s )/Schmidt;
+					}
+				}
+				else {
+					if( ivar == VarT ) {
+						Visac  = Visac / Prandtl;
 					}
-					// Skip Other handling for now
-					//else if( ivar > NVar )
-					//{
-						//PhiFace  = ScReg(ir,(iVar-Nvar))%value
-					//}
 					else {
-						// ToDo: Error Case - Need to change handling, doesn't originally set to 0.0
-						PhiFace = T (0);
+						Visac  = Visac / Schmidt;
 					}
+				}
+
+				Xpn = Xac - view.cellCenter(ip);
+				VisFace = Visac * view.faceRLencos[i];
+
+				norm = view.faceNorm(i);
+				fde = Visac * dPhidxac.dotProduct(norm);
+
+				fce = MassFlux[i] * PhiFace;
+				// fde = fde; Original Dolfyn code has this assignment. Odd.
 
-					Visac = visEffBoundary[ib];
+				fci = fmin( MassFlux[i] , 0.0 ) * PhiFace + fmax(MassFlux[i], 0.0) * PhiCell[ip];
+				fdi = VisFace * dPhidxac.dotProduct(Xpn);
+				f   = -VisFace + fmin(MassFlux[i], 0.0);
 
-					if( SolveTurb ) {
+				Au[ip] = Au[ip] - f;
+				Su[ip] = Su[ip] + fde - fdi - f*PhiFace;
+				PhiBoundary[ib] = PhiFace;
+
+				}
+				else if( it == cupcfd::geometry::mesh::RTYPE_OUTLET) {
+					dPhidxac = dPhidx[ip];
+					Xac = view.faceCenter(i);
+					Visac = VisEff[ip];
+
+					if(SolveTurb) {
 						Visac = Visac - VisLam;
 
-						if( ivar == VarT ) {
+						if(ivar == VarT) {
 							Visac = ( VisLam + Visac / Sigma_T )/Prandtl;
 						}
 						else if( ivar == VarTE ) {
@@ -281,186 +320,241 @@ namespace cupcfd
 						}
 					}
 					else {
-						if( ivar == VarT ) {
-							Visac  = Visac / Prandtl;
-						}
-						else {
-							Visac  = Visac / Schmidt;
-						}
+					if( ivar == VarT ) {
+						Visac  = Visac / Prandtl;
+					}
+					else {
+						Visac  = Visac / Schmidt;
+					}
 					}
 
-					Xpn = Xac - mesh.getCellCenter(ip);
-					VisFace = Visac * mesh.getFaceRLencos(i);
-
-					norm = mesh.getFaceNorm(i);
-					fde = Visac * dPhidxac.dotProduct(norm);
+					Xpn      = Xac - view.cellCenter(ip);
+					PhiFace  = PhiCell[ip] + dPhidx[ip].dotProduct(Xpn);
+					VisFace  = Visac * view.faceRLencos[i];
 
 					fce = MassFlux[i] * PhiFace;
-					// fde = fde; Original Dolfyn code has this assignment. Odd.
+					norm = view.faceNorm(i);
+					fde = Visac * dPhidxac.dotProduct(norm);
 
-					fci = fmin( MassFlux[i] , 0.0 ) * PhiFace + fmax(MassFlux[i], 0.0) * PhiCell[ip];
+					fci = MassFlux[i] * PhiCell[ip];
 					fdi = VisFace * dPhidxac.dotProduct(Xpn);
-					f   = -VisFace + fmin(MassFlux[i], 0.0);
 
-					Au[ip] = Au[ip] - f;
-					Su[ip] = Su[ip] + fde - fdi - f*PhiFace;
+					Su[ip] = Su[ip]  + fde - fdi;
 					PhiBoundary[ib] = PhiFace;
-
-					}
-					else if( it == cupcfd::geometry::mesh::RTYPE_OUTLET) {
-						dPhidxac = dPhidx[ip];
-						Xac = mesh.getFaceCenter(i);
-						Visac = VisEff[ip];
-
-						if(SolveTurb) {
-							Visac = Visac - VisLam;
-
-							if(ivar == VarT) {
-								Visac = ( VisLam + Visac / Sigma_T )/Prandtl;
-							}
-							else if( ivar == VarTE ) {
-								Visac = VisLam + Visac / Sigma_k;
+				}
+				else if(it == cupcfd::geometry::mesh::RTYPE_SYMP) {
+				ds = view.faceCenter(i) - view.cellCenter(ip);
+				PhiBoundary[ib] = PhiCell[ip] + dPhidx[ip].dotProduct(ds);
+				}
+				else if(it == cupcfd::geometry::mesh::RTYPE_WALL) {
+					if(SolveEnthalpy && ivar == VarT) {
+						#ifndef NDEBUG
+							if (ib >= nCpBoundary) {
+								return cupcfd::error::E_INVALID_INDEX;
 							}
-							else if( ivar == VarED ) {
-								Visac = VisLam + Visac / Sigma_e;
+						#endif
+
+						if(mesh.getRegionAdiab(ir)) {
+							PhiBoundary[ib] = PhiCell[ip];
+							mesh.setBoundaryQ(ib, 0.0);
+						}
+						else {
+							if(mesh.getRegionFlux(ir)) {
+								PhiFlux = mesh.getRegionT(ir);
 							}
 							else {
-								Visac = ( VisLam + Visac / Sigma_s )/Schmidt;
+								PhiFace = mesh.getRegionT(ir);
+								PhiBoundary[ib] = PhiFace;
 							}
-						}
-						else {
-						if( ivar == VarT ) {
-							Visac  = Visac / Prandtl;
-						}
-						else {
-							Visac  = Visac / Schmidt;
-						}
-						}
-
-						Xpn      = Xac - mesh.getCellCenter(ip);
-						PhiFace  = PhiCell[ip] + dPhidx[ip].dotProduct(Xpn);
-						VisFace  = Visac * mesh.getFaceRLencos(i);
-
-						fce = MassFlux[i] * PhiFace;
-						norm = mesh.getFaceNorm(i);
-						fde = Visac * dPhidxac.dotProduct(norm);
 
-						fci = MassFlux[i] * PhiCell[ip];
-						fdi = VisFace * dPhidxac.dotProduct(Xpn);
-
-						Su[ip] = Su[ip]  + fde - fdi;
-						PhiBoundary[ib] = PhiFace;
-					}
-					else if(it == cupcfd::geometry::mesh::RTYPE_SYMP) {
-					ds = mesh.getFaceCenter(i) - mesh.getCellCenter(ip);
-					PhiBoundary[ib] = PhiCell[ip] + dPhidx[ip].dotProduct(ds);
-					}
-					else if(it == cupcfd::geometry::mesh::RTYPE_WALL) {
-						if(SolveEnthalpy && ivar == VarT) {
-							#ifndef NDEBUG
-								if (ib >= nCpBoundary) {
-									return cupcfd::error::E_INVALID_INDEX;
-								}
-							#endif
+							Visac  = visEffBoundary[ib];
+							dn     = mesh.getBoundaryDistance(ib);
+							Resist = mesh.getRegionR(ir);
 
-							if(mesh.getRegionAdiab(ir)) {
-								PhiBoundary[ib] = PhiCell[ip];
-								mesh.setBoundaryQ(ib, 0.0);
+							if(!SolveTurb ) {
+								VisFace = VisLam / Prandtl / dn;
+								Hcoef = 1.0/(1.0/VisFace + Resist*CpBoundary[ib]) * view.faceArea[i];
 							}
 							else {
-								if(mesh.getRegionFlux(ir)) {
-									PhiFlux = mesh.getRegionT(ir);
-								}
-								else {
-									PhiFace = mesh.getRegionT(ir);
-									PhiBoundary[ib] = PhiFace;
-								}
+								#ifndef NDEBUG
+									if (ip >= nTE) {
+										return cupcfd::error::E_INVALID_INDEX;
+									}
+								#endif
 
-								Visac  = visEffBoundary[ib];
-								dn     = mesh.getBoundaryDistance(ib);
-								Resist = mesh.getRegionR(ir);
+								SLres = 9.24 * (pow((Prandtl/Sigma_T), 0.75) - 1.0 ) * (1.0 + 0.28 * exp(-0.007 * Prandtl/Sigma_T));
+								Cmu25 = pow(TMCmu,0.25);
+								Tplus = Sigma_T * (mesh.getBoundaryUPlus(ib) + SLres);
+								utau  = Cmu25 * sqrt(TE[ip]);
 
-								if(!SolveTurb ) {
+								if( mesh.getBoundaryYPlus(ib) < mesh.getRegionYLog(ir)) {
 									VisFace = VisLam / Prandtl / dn;
-									Hcoef = 1.0/(1.0/VisFace + Resist*CpBoundary[ib]) * mesh.getFaceArea(i);
+									Hcoef   = 1.0/( 1.0/VisFace + Resist*CpBoundary[ib]) * view.faceArea[i];
 								}
 								else {
-									#ifndef NDEBUG
-										if (ip >= nTE) {
-											return cupcfd::error::E_INVALID_INDEX;
-										}
-									#endif
-
-									SLres = 9.24 * (pow((Prandtl/Sigma_T), 0.75) - 1.0 ) * (1.0 + 0.28 * exp(-0.007 * Prandtl/Sigma_T));
-									Cmu25 = pow(TMCmu,0.25);
-									Tplus = Sigma_T * (mesh.getBoundaryUPlus(ib) + SLres);
-									utau  = Cmu25 * sqrt(TE[ip]);
-
-									if( mesh.getBoundaryYPlus(ib) < mesh.getRegionYLog(ir)) {
-										VisFace = VisLam / Prandtl / dn;
-										Hcoef   = 1.0/( 1.0/VisFace + Resist*CpBoundary[ib]) * mesh.getFaceArea(i);
-									}
-									else {
-										VisFace = Den[ip] * utau/(Tplus + Small);
-										Hcoef   = 1.0/(1.0/VisFace + Resist*CpBoundary[ib]) * mesh.getFaceArea(i);
-									}
+									VisFace = Den[ip] * utau/(Tplus + Small);
+									Hcoef   = 1.0/(1.0/VisFace + Resist*CpBoundary[ib]) * view.faceArea[i];
 								}
+							}
 
-								if(mesh.getRegionFlux(ir)) {
-									PhiFace = PhiCell[ip] + PhiFlux / (Hcoef * CpBoundary[ib]/ mesh.getFaceArea(i));
-									PhiBoundary[ib] = PhiFace;
-								}
+							if(mesh.getRegionFlux(ir)) {
+								PhiFace = PhiCell[ip] + PhiFlux / (Hcoef * CpBoundary[ib]/ view.faceArea[i]);
+								PhiBoundary[ib] = PhiFace;
+							}
 
-								Au[ip] = Au[ip] + Hcoef;
-								Su[ip] = Su[ip] + Hcoef * PhiFace;
+							Au[ip] = Au[ip] + Hcoef;
+							Su[ip] = Su[ip] + Hcoef * PhiFace;
 
-								Tdif = (PhiFace - PhiCell[ip]);
-								T tmpVal;
+							Tdif = (PhiFace - PhiCell[ip]);
+							T tmpVal;
 
-								tmpVal =  Hcoef * CpBoundary[ib] / mesh.getFaceArea(i);
-								mesh.setBoundaryH(ib, tmpVal);
+							tmpVal =  Hcoef * CpBoundary[ib] / view.faceArea[i];
+							mesh.setBoundaryH(ib, tmpVal);
 
-								tmpVal = mesh.getBoundaryH(ib) * Tdif;
-								mesh.setBoundaryQ(ib, tmpVal);
+							tmpVal = mesh.getBoundaryH(ib) * Tdif;
+							mesh.setBoundaryQ(ib, tmpVal);
 
-								tmpVal = VisFace * CpBoundary[ib];
-								mesh.setBoundaryH(ib, tmpVal);
+							tmpVal = VisFace * CpBoundary[ib];
+							mesh.setBoundaryH(ib, tmpVal);
 
-								mesh.setBoundaryT(ib, PhiFace);
+							mesh.setBoundaryT(ib, PhiFace);
 
-								if(mesh.getBoundaryQ(ib) > 0.0) {
-									QTransferIn = QTransferIn + mesh.getBoundaryQ(ib) * mesh.getFaceArea(i);
-								}
-								else {
-									QTransferOut = QTransferOut + mesh.getBoundaryQ(ib) * mesh.getFaceArea(i);
-								}
+							// if(mesh.getBoundaryQ(ib) > 0.0) {
+								// QTransferIn = QTransferIn + mesh.getBoundaryQ(ib) * mesh.getFaceArea(i);
+							// }
+							// else {
+								// QTransferOut = QTransferOut + mesh.getBoundaryQ(ib) * mesh.getFaceArea(i);
+							// }
 
-								qmin = fmin(qmin, mesh.getBoundaryQ(ib));
-								qmax = fmax(qmax, mesh.getBoundaryQ(ib));
-								hmin = fmin(hmin, mesh.getBoundaryH(ib));
-								hmax = fmax(hmax, mesh.getBoundaryH(ib));
+							// qmin = fmin(qmin, mesh.getBoundaryQ(ib));
+							// qmax = fmax(qmax, mesh.getBoundaryQ(ib));
+							// hmin = fmin(hmin, mesh.getBoundaryH(ib));
+							// hmax = fmax(hmax, mesh.getBoundaryH(ib));
 
-								Atot = Atot + mesh.getFaceArea(i);
-								qtot = qtot + mesh.getBoundaryQ(ib) * mesh.getFaceArea(i);
-								htot = htot + mesh.getBoundaryH(ib) * mesh.getFaceArea(i);
-							}
-						}
-						// Skip these for now
-						//else if( SolveTurb )
-						//{
-						//}
-						//else if( SolveScalars && iVar > Nvar )
-						//{
-						//   PhiBoundary[ib] = PhiCell[ip];
-						//}
-						else {
+							// Atot = Atot + mesh.getFaceArea(i);
+							// qtot = qtot + mesh.getBoundaryQ(ib) * mesh.getFaceArea(i);
+							// htot = htot + mesh.getBoundaryH(ib) * mesh.getFaceArea(i);
 						}
 					}
+					// Skip these for now
+					//else if( SolveTurb )
+					//{
+					//}
+					//else if( SolveScalars && iVar > Nvar )
+					//{
+					//   PhiBoundary[ib] = PhiCell[ip];
+					//}
+					else {
+					}
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes FluxScalarDolfynFaceLoop(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+														T * PhiCell, I nPhiCell,
+														T * PhiBoundary, I nPhiBoundary,
+														T * VisEff, I nVisEff,
+														T * Au, I nAu,
+														T * Su, I nSu,
+														T * Den, I nDen,
+														T * MassFlux, I nMassFlux,
+														T * TE, I nTE,
+														T * CpBoundary, I nCpBoundary,
+														T * visEffBoundary, I nVisEffBoundary,
+														T * RFace, I nRFace,
+														cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidx, int ndPhidx,
+														bool SolveTurb, bool SolveEnthalpy,
+														// T sigma, T sigma2, 
+														T vislam,
+														int ivar, int VarT, T Sigma_T, T Prandtl,
+														int VarTE, T Sigma_k, int VarED, T Sigma_e,
+														T Sigma_s, T Schmidt, T GammaBlend, T Small, T Large, T TMCmu) {
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!mesh.kernelView.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
+			cupcfd::error::eCodes status;
+
+			for(I i = 0; i < mesh.properties.lFaces; i++) {
+				status = FluxScalarDolfynFace(mesh, i, PhiCell, nPhiCell, PhiBoundary, nPhiBoundary, VisEff,
+							nVisEff, Au, nAu, Su, nSu, Den, nDen, MassFlux, nMassFlux, TE, nTE, CpBoundary,
+							nCpBoundary, visEffBoundary, nVisEffBoundary, RFace, nRFace, dPhidx, ndPhidx,
+							SolveTurb, SolveEnthalpy, vislam, ivar, VarT, Sigma_T, Prandtl, VarTE, Sigma_k,
+							VarED, Sigma_e, Sigma_s, Schmidt, GammaBlend, Small, Large, TMCmu);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
 				}
 			}
 
 			return cupcfd::error::E_SUCCESS;
 		}
+
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes FluxScalarDolfynFaceLoopColoured(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+														T * PhiCell, I nPhiCell,
+														T * PhiBoundary, I nPhiBoundary,
+														T * VisEff, I nVisEff,
+														T * Au, I nAu,
+														T * Su, I nSu,
+														T * Den, I nDen,
+														T * MassFlux, I nMassFlux,
+														T * TE, I nTE,
+														T * CpBoundary, I nCpBoundary,
+														T * visEffBoundary, I nVisEffBoundary,
+														T * RFace, I nRFace,
+														cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidx, int ndPhidx,
+														bool SolveTurb, bool SolveEnthalpy,
+														// T sigma, T sigma2, 
+														T vislam,
+														int ivar, int VarT, T Sigma_T, T Prandtl,
+														int VarTE, T Sigma_k, int VarED, T Sigma_e,
+														T Sigma_s, T Schmidt, T GammaBlend, T Small, T Large, T TMCmu) {
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!mesh.kernelView.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
+			if(!mesh.faceColouring.built) {
+				return FluxScalarDolfynFaceLoop(mesh, PhiCell, nPhiCell, PhiBoundary, nPhiBoundary, VisEff,
+						nVisEff, Au, nAu, Su, nSu, Den, nDen, MassFlux, nMassFlux, TE, nTE, CpBoundary,
+						nCpBoundary, visEffBoundary, nVisEffBoundary, RFace, nRFace, dPhidx, ndPhidx,
+						SolveTurb, SolveEnthalpy, vislam, ivar, VarT, Sigma_T, Prandtl, VarTE, Sigma_k,
+						VarED, Sigma_e, Sigma_s, Schmidt, GammaBlend, Small, Large, TMCmu);
+			}
+
+			cupcfd::error::eCodes status = cupcfd::error::E_SUCCESS;
+
+			I nColours = mesh.faceColouring.nColours;
+			I * colourXAdj = mesh.faceColouring.colourXAdj;
+			I * colourFaces = mesh.faceColouring.colourFaces;
+
+			// No two faces of a colour share a cell, and the implicit barrier at the end of each loop orders the colours
+			#pragma omp parallel
+			{
+				for(I c = 0; c < nColours; c++) {
+					#pragma omp for
+					for(I j = colourXAdj[c]; j < colourXAdj[c+1]; j++) {
+						cupcfd::error::eCodes faceStatus;
+						faceStatus = FluxScalarDolfynFace(mesh, colourFaces[j], PhiCell, nPhiCell,
+									PhiBoundary, nPhiBoundary, VisEff, nVisEff, Au, nAu, Su, nSu, Den, nDen,
+									MassFlux, nMassFlux, TE, nTE, CpBoundary, nCpBoundary, visEffBoundary,
+									nVisEffBoundary, RFace, nRFace, dPhidx, ndPhidx, SolveTurb,
+									SolveEnthalpy, vislam, ivar, VarT, Sigma_T, Prandtl, VarTE, Sigma_k,
+									VarED, Sigma_e, Sigma_s, Schmidt, GammaBlend, Small, Large, TMCmu);
+						if(faceStatus != cupcfd::error::E_SUCCESS) {
+							#pragma omp critical
+							status = faceStatus;
+						}
+					}
+				}
+			}
+
+			return status;
+		}
 	}
 }
 
@@ -66,6 +66,80 @@ namespace cupcfd
 													T * av, I nAv,
 													T * aw, I nAw);
 
+		/**
+		 * Compute the momentum fluxes of a single face. This is the body of the face loop of FluxUVWDolfynFaceLoop1.
+		 *
+		 * @param faceID The local ID of the face
+		 *
+		 * @tparam M The implementing class of the UnstructuredMeshInterface
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/mesh/stateful data
+		 * @tparam L The label datatype of the unstructured mesh
+		 */
+		template <class M, class I, class T, class L>
+		__attribute__((warn_unused_result))
+		inline cupcfd::error::eCodes FluxUVWDolfynFace1(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh, I faceID,
+													T gammaBlend,
+													T small,
+													// T large,
+													T * uCell, I nUCell,
+													T * vCell, I nVCell,
+													T * wCell, I nWCell,
+													T * uBoundary, I nUBoundary,
+													T * vBoundary, I nVBoundary,
+													T * wBoundary, I nWBoundary,
+													T * visEffCell, I nVisEffCell,
+													T * visEffBoundary, I nVisEffBoundary,
+													T * massFlux, I nMassFlux,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx, I nDudx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx, I nDvdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx, I nDwdx,
+													T * rFace, I nRFace,
+													T * su, I nSu,
+													T * sv, I nSv,
+													T * sw, I nSw,
+													T * au, I nAu,
+													T * av, I nAv,
+													T * aw, I nAw);
+
+		/**
+		 * Thread-parallel version of FluxUVWDolfynFaceLoop1.
+		 *
+		 * The faces of each colour of the mesh face colouring are processed concurrently using OpenMP, and
+		 * the colours are processed in order. If the face colouring has not been built, this runs
+		 * FluxUVWDolfynFaceLoop1 instead.
+		 *
+		 * @tparam M The implementing class of the UnstructuredMeshInterface
+		 * @tparam I The datatype of the indexing scheme
+		 * @tparam T The datatype of computation/mesh/stateful data
+		 * @tparam L The label datatype of the unstructured mesh
+		 */
+		template <class M, class I, class T, class L>
+		__attribute__((warn_unused_result))
+		cupcfd::error::eCodes FluxUVWDolfynFaceLoop1Coloured(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+													T gammaBlend,
+													T small,
+													// T large,
+													T * uCell, I nUCell,
+													T * vCell, I nVCell,
+													T * wCell, I nWCell,
+													T * uBoundary, I nUBoundary,
+													T * vBoundary, I nVBoundary,
+													T * wBoundary, I nWBoundary,
+													T * visEffCell, I nVisEffCell,
+													T * visEffBoundary, I nVisEffBoundary,
+													T * massFlux, I nMassFlux,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx, I nDudx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx, I nDvdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx, I nDwdx,
+													T * rFace, I nRFace,
+													T * su, I nSu,
+													T * sv, I nSv,
+													T * sw, I nSw,
+													T * au, I nAu,
+													T * av, I nAv,
+													T * aw, I nAw);
+
 		/**
 		 *
 		 */
@@ -36,7 +36,7 @@
 	namespace fvm
 	{
 		template <class M, class I, class T, class L>
-		cupcfd::error::eCodes FluxUVWDolfynFaceLoop1(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+		inline cupcfd::error::eCodes FluxUVWDolfynFace1(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh, I faceID,
 													T gammaBlend,
 													T small,
 													// T large,
@@ -59,6 +59,8 @@
 													T * au, I nAu,
 													T * av, I nAv,
 													T * aw, I nAw) {
+			const cupcfd::geometry::mesh::UnstructuredMeshKernelView<I,T>& view = mesh.kernelView;
+
 			// T pe0 = 9999.0;
 			// T pe1 = -9999.0;
 			// T totalForce = 0.0;
@@ -72,7 +74,11 @@
 			// T uac, vac, wac;
 			T visac;
 			T visFace;
-			T uFace, vFace, wFace;
+			// The face values are set by SelectDiffSchemeVector in the original, which is not ported,
+			// so start each face from zero rather than the value of the previously visited face
+			T uFace = T(0);
+			T vFace = T(0);
+			T wFace = T(0);
 			T fuce, fvce, fwce;
 			T sx, sy, sz;
 			T fude1, fvde1, fwde1;
@@ -95,423 +101,537 @@
 			cupcfd::geometry::euclidean::EuclideanPoint<T,3> center3;
 
 
-			for(I i = 0; i < mesh.properties.lFaces; i++) {
-				#ifdef DEBUG
-					if (i >= nMassFlux) {
+			I i = faceID;
+
+			#ifdef DEBUG
+				if (i >= nMassFlux) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+			#endif
+
+			// Get Cell 1 Index
+			ip = view.faceCell1[i];
+
+			// Get Cell 2 Index
+			in = view.faceCell2[i];
+
+			#ifdef DEBUG
+				if (ip >= nUCell || in >= nUCell) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				if (ip >= nVCell || in >= nVCell) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				if (ip >= nWCell || in >= nWCell) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				if (ip >= nVisEffCell || in >= nVisEffCell) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				if (ip >= nDudx || in >= nDudx) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				if (ip >= nDvdx || in >= nDvdx) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				if (ip >= nDwdx || in >= nDwdx) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				if (ip >= nSu || in >= nSu) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				if (ip >= nSv || in >= nSv) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				if (ip >= nSw || in >= nSw) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+			#endif
+
+			bool isBoundary = view.faceIsBoundary[i];
+
+			if(!isBoundary) {
+
+				// Non-Boundary Face
+				facn = view.faceLambda[i];
+				facp = 1.0 - facn;
+
+				xac = (view.cellCenter(in) * facn) + (view.cellCenter(ip) * facp);
+				// uac = uCell[in] * facn + uCell[ip] * facp;
+				// vac = vCell[in] * facn + vCell[ip] * facp;
+				// wac = wCell[in] * facn + wCell[ip] * facp;
+
+				dudxac = dudx[in] * facn + dudx[ip] * facp;
+				dvdxac = dvdx[in] * facn + dvdx[ip] * facp;
+				dwdxac = dwdx[in] * facn + dwdx[ip] * facp;
+
+				visac = visEffCell[in] * facn + visEffCell[ip] * facp;
+				xpn = view.cellCenter(in) - view.cellCenter(ip);
+				visFace = visac * view.faceRLencos[i];
+
+				   //    call SelectDiffSchemeVector(i,iScheme,iP,iN,     &
+				   //                                U,V,W,               &
+					//			   dUdX,dVdX,dWdX,      &
+					//			   UFace,VFace,Wface)
+
+
+				fuce = massFlux[i] * uFace;
+				fvce = massFlux[i] * vFace;
+				fwce = massFlux[i] * wFace;
+
+				norm = view.faceNorm(i);
+				sx = norm.cmp[0];
+				sy = norm.cmp[1];
+				sz = norm.cmp[2];
+
+				fude1 = (dudxac.cmp[0] + dudxac.cmp[0]) * sx + (dudxac.cmp[1] + dvdxac.cmp[0]) * sy + (dudxac.cmp[2] + dwdxac.cmp[0]) * sz;
+				fvde1 = (dudxac.cmp[1] + dvdxac.cmp[0]) * sx + (dvdxac.cmp[1] + dvdxac.cmp[1]) * sy + (dvdxac.cmp[2] + dwdxac.cmp[1]) * sz;
+				fwde1 = (dudxac.cmp[2] + dwdxac.cmp[0]) * sx + (dwdxac.cmp[1] + dvdxac.cmp[2]) * sy + (dwdxac.cmp[2] + dwdxac.cmp[2]) * sz;
+
+				fude = visac * fude1;
+				fvde = visac * fvde1;
+				fwde = visac * fwde1;
+
+				fmin = std::min(massFlux[i], T(0.0));
+				fmax = std::max(massFlux[i], T(0.0));
+
+				fuci = fmin * uCell[in] + fmax * uCell[ip];
+				fvci = fmin * vCell[in] + fmax * vCell[ip];
+				fwci = fmin * wCell[in] + fmax * wCell[ip];
+
+				fudi = visFace * dudxac.dotProduct(xpn);
+				fvdi = visFace * dvdxac.dotProduct(xpn);
+				fwdi = visFace * dwdxac.dotProduct(xpn);
+
+				#ifndef NDEBUG
+					if ((i*2)+1 >= nRFace) {
 						return cupcfd::error::E_INVALID_INDEX;
 					}
 				#endif
+				rFace[i*2] = -visFace - std::max(massFlux[i], T(0.0));
+				rFace[(i*2)+1] = -visFace + std::min(massFlux[i], T(0.0));
+
+				blendU = gammaBlend * (fuce - fuci);
+				blendV = gammaBlend * (fvce - fvci);
+				blendW = gammaBlend * (fwce - fwci);
 
-				// Get Cell 1 Index
-				ip = mesh.getFaceCell1ID(i);
+				su[ip] = su[ip] - blendU + fude - fudi;
+				su[in] = su[in] + blendU - fude + fudi;
 
-				// Get Cell 2 Index
-				in = mesh.getFaceCell2ID(i);
+				sv[ip] = sv[ip] - blendV + fvde - fvdi;
+				sv[in] = sv[in] + blendV - fvde + fvdi;
+
+				sw[ip] = sw[ip] - blendW + fwde - fwdi;
+				sw[in] = sw[in] + blendW - fwde + fwdi;
+
+				// T xpn_length = (T)xpn.length();
+				// Leave these off for now, may reenable at later point
+				// T peclet;
+				// peclet = massFlux[i]/mesh.getFaceArea(i) * xpn_length/(visac+small);
+				//pe0 = min(pe0, peclet);
+				//pe1 = max(pe1, peclet);
+			}
+			else {
+				ib = view.faceBoundaryID[i];
+				ir = mesh.getBoundaryRegionID(ib);
+				it = mesh.getRegionType(ir);
+				ip = view.faceCell1[i];
 
 				#ifdef DEBUG
-					if (ip >= nUCell || in >= nUCell) {
-						return cupcfd::error::E_INVALID_INDEX;
-					}
-					if (ip >= nVCell || in >= nVCell) {
-						return cupcfd::error::E_INVALID_INDEX;
-					}
-					if (ip >= nWCell || in >= nWCell) {
+					if (ib >= nUBoundary) {
 						return cupcfd::error::E_INVALID_INDEX;
 					}
-					if (ip >= nVisEffCell || in >= nVisEffCell) {
+					if (ib >= nVBoundary) {
 						return cupcfd::error::E_INVALID_INDEX;
 					}
-					if (ip >= nDudx || in >= nDudx) {
+					if (ib >= nWBoundary) {
 						return cupcfd::error::E_INVALID_INDEX;
 					}
-					if (ip >= nDvdx || in >= nDvdx) {
+					if (ib >= nVisEffBoundary) {
 						return cupcfd::error::E_INVALID_INDEX;
 					}
-					if (ip >= nDwdx || in >= nDwdx) {
+					if (ip >= nAu) {
 						return cupcfd::error::E_INVALID_INDEX;
 					}
-					if (ip >= nSu || in >= nSu) {
+					if (ip >= nAv) {
 						return cupcfd::error::E_INVALID_INDEX;
 					}
-					if (ip >= nSv || in >= nSv) {
-						return cupcfd::error::E_INVALID_INDEX;
-					}
-					if (ip >= nSw || in >= nSw) {
+					if (ip >= nAw) {
 						return cupcfd::error::E_INVALID_INDEX;
 					}
 				#endif
 
-				bool isBoundary = mesh.getFaceIsBoundary(i);
-
-				if(!isBoundary) {
+				// Boundary Face
 
-					// Non-Boundary Face
-					facn = mesh.getFaceLambda(i);
-					facp = 1.0 - facn;
+				if(it == cupcfd::geometry::mesh::RTYPE_INLET) {
+					// Skip/Ignore User/UserInlet for now
 
-					xac = (mesh.getCellCenter(in) * facn) + (mesh.getCellCenter(ip) * facp);
-					// uac = uCell[in] * facn + uCell[ip] * facp;
-					// vac = vCell[in] * facn + vCell[ip] * facp;
-					// wac = wCell[in] * facn + wCell[ip] * facp;
+					dudxac = dudx[ip];
+					dvdxac = dvdx[ip];
+					dwdxac = dwdx[ip];
 
-					dudxac = dudx[in] * facn + dudx[ip] * facp;
-					dvdxac = dvdx[in] * facn + dvdx[ip] * facp;
-					dwdxac = dwdx[in] * facn + dwdx[ip] * facp;
+					xac = view.faceCenter(i);
 
-					visac = visEffCell[in] * facn + visEffCell[ip] * facp;
-					xpn = mesh.getCellCenter(in) - mesh.getCellCenter(ip);
-					visFace = visac * mesh.getFaceRLencos(i);
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> uvw = mesh.getRegionUVW(ir);
 
-					   //    call SelectDiffSchemeVector(i,iScheme,iP,iN,     &
-					   //                                U,V,W,               &
-						//			   dUdX,dVdX,dWdX,      &
-						//			   UFace,VFace,Wface)
+					uFace = uvw.cmp[0];
+					vFace = uvw.cmp[1];
+					wFace = uvw.cmp[2];
 
+					visac = visEffBoundary[ib];
+					xpn = xac - view.cellCenter(ip);
+					visFace = visac * view.faceRLencos[i];
 
 					fuce = massFlux[i] * uFace;
 					fvce = massFlux[i] * vFace;
 					fwce = massFlux[i] * wFace;
 
-					mesh.getFaceNorm(i, norm);
+					norm = view.faceNorm(i);
 					sx = norm.cmp[0];
 					sy = norm.cmp[1];
 					sz = norm.cmp[2];
 
-					fude1 = (dudxac.cmp[0] + dudxac.cmp[0]) * sx + (dudxac.cmp[1] + dvdxac.cmp[0]) * sy + (dudxac.cmp[2] + dwdxac.cmp[0]) * sz;
-					fvde1 = (dudxac.cmp[1] + dvdxac.cmp[0]) * sx + (dvdxac.cmp[1] + dvdxac.cmp[1]) * sy + (dvdxac.cmp[2] + dwdxac.cmp[1]) * sz;
-					fwde1 = (dudxac.cmp[2] + dwdxac.cmp[0]) * sx + (dwdxac.cmp[1] + dvdxac.cmp[2]) * sy + (dwdxac.cmp[2] + dwdxac.cmp[2]) * sz;
+					fude = (dudxac.cmp[0] + dudxac.cmp[0]) * sx + (dudxac.cmp[1] + dvdxac.cmp[0]) * sy + (dudxac.cmp[2] + dwdxac.cmp[0]) * sz;
+					fvde = (dudxac.cmp[1] + dvdxac.cmp[0]) * sx + (dvdxac.cmp[1] + dvdxac.cmp[1]) * sy + (dvdxac.cmp[2] + dwdxac.cmp[1]) * sz;
+					fwde = (dudxac.cmp[2] + dwdxac.cmp[0]) * sx + (dwdxac.cmp[1] + dvdxac.cmp[2]) * sy + (dwdxac.cmp[2] + dwdxac.cmp[2]) * sz;
 
-					fude = visac * fude1;
-					fvde = visac * fvde1;
-					fwde = visac * fwde1;
+					fude = visac * fude;
+					fvde = visac * fvde;
+					fwde = visac * fwde;
 
 					fmin = std::min(massFlux[i], T(0.0));
 					fmax = std::max(massFlux[i], T(0.0));
 
-					fuci = fmin * uCell[in] + fmax * uCell[ip];
-					fvci = fmin * vCell[in] + fmax * vCell[ip];
-					fwci = fmin * wCell[in] + fmax * wCell[ip];
+					fuci = fmin * uFace + fmax * uCell[ip];
+					fvci = fmin * vFace + fmax * vCell[ip];
+					fwci = fmin * wFace + fmax * wCell[ip];
 
 					fudi = visFace * dudxac.dotProduct(xpn);
 					fvdi = visFace * dvdxac.dotProduct(xpn);
 					fwdi = visFace * dwdxac.dotProduct(xpn);
 
-					#ifndef NDEBUG
-						if ((i*2)+1 >= nRFace) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-					#endif
-					rFace[i*2] = -visFace - std::max(massFlux[i], T(0.0));
-					rFace[(i*2)+1] = -visFace + std::min(massFlux[i], T(0.0));
-
-					blendU = gammaBlend * (fuce - fuci);
-					blendV = gammaBlend * (fvce - fvci);
-					blendW = gammaBlend * (fwce - fwci);
+					f = -visFace + std::min(massFlux[i], T(0.0));
 
-					su[ip] = su[ip] - blendU + fude - fudi;
-					su[in] = su[in] + blendU - fude + fudi;
+					au[ip] = au[ip] - f;
+					su[ip] = su[ip] - f * uFace + fude - fudi;
+					uBoundary[ib] = uFace;
 
-					sv[ip] = sv[ip] - blendV + fvde - fvdi;
-					sv[in] = sv[in] + blendV - fvde + fvdi;
+					av[ip] = av[ip] - f;
+					sv[ip] = sv[ip] - f * vFace + fvde - fvdi;
+					vBoundary[ib] = vFace;
 
-					sw[ip] = sw[ip] - blendW + fwde - fwdi;
-					sw[in] = sw[in] + blendW - fwde + fwdi;
-
-					// T xpn_length = (T)xpn.length();
-					// Leave these off for now, may reenable at later point
-					// T peclet;
-					// peclet = massFlux[i]/mesh.getFaceArea(i) * xpn_length/(visac+small);
-					//pe0 = min(pe0, peclet);
-					//pe1 = max(pe1, peclet);
+					aw[ip] = aw[ip] - f;
+					sw[ip] = sw[ip] - f * wFace + fwde - fwdi;
+					wBoundary[ib] = wFace;
 				}
-				else {
-					ib = mesh.getFaceBoundaryID(i);
-					ir = mesh.getBoundaryRegionID(ib);
-					it = mesh.getRegionType(ir);
-					ip = mesh.getFaceCell1ID(i);
-
-					#ifdef DEBUG
-						if (ib >= nUBoundary) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ib >= nVBoundary) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ib >= nWBoundary) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ib >= nVisEffBoundary) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ip >= nAu) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ip >= nAv) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-						if (ip >= nAw) {
-							return cupcfd::error::E_INVALID_INDEX;
-						}
-					#endif
-
-					// Boundary Face
+				else if(it == cupcfd::geometry::mesh::RTYPE_OUTLET) {
 
-					if(it == cupcfd::geometry::mesh::RTYPE_INLET) {
-						// Skip/Ignore User/UserInlet for now
+					dudxac = dudx[ip];
+					dvdxac = dvdx[ip];
+					dwdxac = dwdx[ip];
 
-						dudxac = dudx[ip];
-						dvdxac = dvdx[ip];
-						dwdxac = dwdx[ip];
+					xac = view.faceCenter(i);
+					visac = visEffCell[ip];
 
-						xac = mesh.getFaceCenter(i);
+					xpn = xac - view.cellCenter(ip);
 
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> uvw = mesh.getRegionUVW(ir);
+					uFace = uCell[ip];
+					vFace = vCell[ip];
+					wFace = wCell[ip];
 
-						uFace = uvw.cmp[0];
-						vFace = uvw.cmp[1];
-						wFace = uvw.cmp[2];
+					visFace = visac * view.faceRLencos[i];
 
-						visac = visEffBoundary[ib];
-						xpn = xac - mesh.getCellCenter(ip);
-						visFace = visac * mesh.getFaceRLencos(i);
+					fuce = massFlux[i] * uFace;
+					fvce = massFlux[i] * vFace;
+					fwce = massFlux[i] * wFace;
 
-						fuce = massFlux[i] * uFace;
-						fvce = massFlux[i] * vFace;
-						fwce = massFlux[i] * wFace;
+					norm = view.faceNorm(i);
+					sx = norm.cmp[0];
+					sy = norm.cmp[1];
+					sz = norm.cmp[2];
 
-						norm = mesh.getFaceNorm(i);
-						sx = norm.cmp[0];
-						sy = norm.cmp[1];
-						sz = norm.cmp[2];
+					fude = (dudxac.cmp[0] + dudxac.cmp[0]) * sx + (dudxac.cmp[1] + dvdxac.cmp[0]) * sy + (dudxac.cmp[2] + dwdxac.cmp[0]) * sz;
+					fvde = (dvdxac.cmp[0] + dudxac.cmp[1]) * sx + (dvdxac.cmp[1] + dvdxac.cmp[1]) * sy + (dvdxac.cmp[2] + dwdxac.cmp[1]) * sz;
+					fwde = (dwdxac.cmp[0] + dudxac.cmp[2]) * sx + (dwdxac.cmp[1] + dvdxac.cmp[2]) * sy + (dwdxac.cmp[2] + dwdxac.cmp[2]) * sz;
 
-						fude = (dudxac.cmp[0] + dudxac.cmp[0]) * sx + (dudxac.cmp[1] + dvdxac.cmp[0]) * sy + (dudxac.cmp[2] + dwdxac.cmp[0]) * sz;
-						fvde = (dudxac.cmp[1] + dvdxac.cmp[0]) * sx + (dvdxac.cmp[1] + dvdxac.cmp[1]) * sy + (dvdxac.cmp[2] + dwdxac.cmp[1]) * sz;
-						fwde = (dudxac.cmp[2] + dwdxac.cmp[0]) * sx + (dwdxac.cmp[1] + dvdxac.cmp[2]) * sy + (dwdxac.cmp[2] + dwdxac.cmp[2]) * sz;
+					fude = visac * fude;
+					fvde = visac * fvde;
+					fwde = visac * fwde;
 
-						fude = visac * fude;
-						fvde = visac * fvde;
-						fwde = visac * fwde;
+					fmin = std::min(massFlux[i], T(0.0));
+					fmax = std::max(massFlux[i], T(0.0));
 
-						fmin = std::min(massFlux[i], T(0.0));
-						fmax = std::max(massFlux[i], T(0.0));
+					fuci = fmin * uFace + fmax * uCell[ip];
+					fvci = fmin * vFace + fmax * vCell[ip];
+					fwci = fmin * wFace + fmax * wCell[ip];
 
-						fuci = fmin * uFace + fmax * uCell[ip];
-						fvci = fmin * vFace + fmax * vCell[ip];
-						fwci = fmin * wFace + fmax * wCell[ip];
+					fudi = visFace * dudxac.dotProduct(xpn);
+					fvdi = visFace * dvdxac.dotProduct(xpn);
+					fwdi = visFace * dwdxac.dotProduct(xpn);
 
-						fudi = visFace * dudxac.dotProduct(xpn);
-						fvdi = visFace * dvdxac.dotProduct(xpn);
-						fwdi = visFace * dwdxac.dotProduct(xpn);
+					if(massFlux[i] < 0.0) {
+						massFlux[i] = small;
+					}
 
-						f = -visFace + std::min(massFlux[i], T(0.0));
+					f = -visFace + std::min(massFlux[i], T(0.0));
 
-						au[ip] = au[ip] - f;
-						su[ip] = su[ip] - f * uFace + fude - fudi;
-						uBoundary[ib] = uFace;
+					au[ip] = au[ip] - f;
+					su[ip] = su[ip] -f * uFace + fude - fudi;
+					uBoundary[ib] = uFace;
 
-						av[ip] = av[ip] - f;
-						sv[ip] = sv[ip] - f * vFace + fvde - fvdi;
-						vBoundary[ib] = vFace;
+					av[ip] = av[ip] - f;
+					sv[ip] = sv[ip] - f * vFace + fvde - fvdi;
+					vBoundary[ib] = vFace;
 
-						aw[ip] = aw[ip] - f;
-						sw[ip] = sw[ip] - f * wFace + fwde - fwdi;
-						wBoundary[ib] = wFace;
-					}
-					else if(it == cupcfd::geometry::mesh::RTYPE_OUTLET) {
-
-						dudxac = dudx[ip];
-						dvdxac = dvdx[ip];
-						dwdxac = dwdx[ip];
+					aw[ip] = aw[ip] - f;
+					sw[ip] = sw[ip] - f * wFace + fwde - fwdi;
+					wBoundary[ib] = wFace;
+				}
+				else if(it == cupcfd::geometry::mesh::RTYPE_SYMP) {
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> tmp;
 
-						xac = mesh.getFaceCenter(i);
-						visac = visEffCell[ip];
+					xac = view.faceCenter(i);
+					xpn = xac - view.cellCenter(ip);
 
-						xpn = xac - mesh.getCellCenter(ip);
+					dudxac = dudx[ip];
+					dvdxac = dvdx[ip];
+					dwdxac = dwdx[ip];
+					visac = visEffCell[ip];
 
-						uFace = uCell[ip];
-						vFace = vCell[ip];
-						wFace = wCell[ip];
+					visFace = visac * view.faceRLencos[i];
 
-						visFace = visac * mesh.getFaceRLencos(i);
+					// T rDotProduct;
+					T du, dv, dw, dp, dn;
 
-						fuce = massFlux[i] * uFace;
-						fvce = massFlux[i] * vFace;
-						fwce = massFlux[i] * wFace;
+					cupcfd::geometry::euclidean::EuclideanVector3D<T> xn;
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> un;
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> tauNN;
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> us;
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> force;
 
-						norm = mesh.getFaceNorm(i);
-						sx = norm.cmp[0];
-						sy = norm.cmp[1];
-						sz = norm.cmp[2];
+					du = dudxac.dotProduct(xpn);
+					dv = dvdxac.dotProduct(xpn);
+					dw = dwdxac.dotProduct(xpn);
 
-						fude = (dudxac.cmp[0] + dudxac.cmp[0]) * sx + (dudxac.cmp[1] + dvdxac.cmp[0]) * sy + (dudxac.cmp[2] + dwdxac.cmp[0]) * sz;
-						fvde = (dvdxac.cmp[0] + dudxac.cmp[1]) * sx + (dvdxac.cmp[1] + dvdxac.cmp[1]) * sy + (dvdxac.cmp[2] + dwdxac.cmp[1]) * sz;
-						fwde = (dwdxac.cmp[0] + dudxac.cmp[2]) * sx + (dwdxac.cmp[1] + dvdxac.cmp[2]) * sy + (dwdxac.cmp[2] + dwdxac.cmp[2]) * sz;
+					us.cmp[0] = uCell[ip] + du;
+					us.cmp[1] = vCell[ip] + dv;
+					us.cmp[2] = wCell[ip] + dw;
 
-						fude = visac * fude;
-						fvde = visac * fvde;
-						fwde = visac * fwde;
+					xn = 0.0 - view.faceNorm(i);
+					xn.normalise();
 
-						fmin = std::min(massFlux[i], T(0.0));
-						fmax = std::max(massFlux[i], T(0.0));
+					dp = us.dotProduct(xn);
+					un = dp * xn;
 
-						fuci = fmin * uFace + fmax * uCell[ip];
-						fvci = fmin * vFace + fmax * vCell[ip];
-						fwci = fmin * wFace + fmax * wCell[ip];
+					dn = mesh.getBoundaryDistance(ib);
+					tauNN = 2.0 * visac * un/dn;
+					force = tauNN * view.faceArea[i];
 
-						fudi = visFace * dudxac.dotProduct(xpn);
-						fvdi = visFace * dvdxac.dotProduct(xpn);
-						fwdi = visFace * dwdxac.dotProduct(xpn);
+					// Assume not initialisation
+					//if(!init)
+					//{
+					au[ip] = au[ip] + visFace;
+					av[ip] = av[ip] + visFace;
+					aw[ip] = aw[ip] + visFace;
 
-						if(massFlux[i] < 0.0) {
-							massFlux[i] = small;
-						}
+					su[ip] = su[ip] + visFace * uCell[ip] - force.cmp[0];
+					sv[ip] = sv[ip] + visFace * vCell[ip] - force.cmp[1];
+					sw[ip] = sw[ip] + visFace * wCell[ip] - force.cmp[2];
+					//}
 
-						f = -visFace + std::min(massFlux[i], T(0.0));
+					uBoundary[ib] = us.cmp[0];
+					vBoundary[ib] = us.cmp[1];
+					wBoundary[ib] = us.cmp[2];
+				}
+				else if(it == cupcfd::geometry::mesh::RTYPE_WALL) {
+					T coef;
+					T dp, dn;
+					T uvel;
 
-						au[ip] = au[ip] - f;
-						su[ip] = su[ip] -f * uFace + fude - fudi;
-						uBoundary[ib] = uFace;
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> uw;
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> un;
+					cupcfd::geometry::euclidean::EuclideanVector3D<T> xn;
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> up;
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> ut;
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> tauNT;
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> force;
+					cupcfd::geometry::euclidean::EuclideanVector<T,3> tmp;
 
-						av[ip] = av[ip] - f;
-						sv[ip] = sv[ip] - f * vFace + fvde - fvdi;
-						vBoundary[ib] = vFace;
+					xac = view.faceCenter(i);
+					uw = mesh.getRegionUVW(ir);
 
-						aw[ip] = aw[ip] - f;
-						sw[ip] = sw[ip] - f * wFace + fwde - fwdi;
-						wBoundary[ib] = wFace;
-					}
-					else if(it == cupcfd::geometry::mesh::RTYPE_SYMP) {
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> tmp;
+					dudxac = dudx[ip];
+					dvdxac = dvdx[ip];
+					dwdxac = dwdx[ip];
 
-						xac = mesh.getFaceCenter(i);
-						xpn = xac - mesh.getCellCenter(ip);
+					visac = visEffBoundary[ib];
 
-						dudxac = dudx[ip];
-						dvdxac = dvdx[ip];
-						dwdxac = dwdx[ip];
-						visac = visEffCell[ip];
+					xpn = view.faceCenter(i) - view.cellCenter(ip);
 
-						// T rDotProduct;
-						T du, dv, dw, dp, dn;
+					// ToDo: Do we want to force this to be a double here?
+					// May also wish for it to just be a float - move out to template?
+					T xpn_length = xpn.length();
+					coef = visac * view.faceArea[i] / xpn_length;
 
-						cupcfd::geometry::euclidean::EuclideanVector3D<T> xn;
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> un;
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> tauNN;
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> us;
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> force;
+					xn = view.faceNorm(i);
+					xn.normalise();
 
-						du = dudxac.dotProduct(xpn);
-						dv = dvdxac.dotProduct(xpn);
-						dw = dwdxac.dotProduct(xpn);
+					up.cmp[0] = uCell[ip];
+					up.cmp[1] = vCell[ip];
+					up.cmp[2] = wCell[ip];
 
-						us.cmp[0] = uCell[ip] + du;
-						us.cmp[1] = vCell[ip] + dv;
-						us.cmp[2] = wCell[ip] + dw;
+					up = up - uw;
 
-						xn = 0.0 - mesh.getFaceNorm(i);
-						xn.normalise();
+					dp = up.dotProduct(xn);
 
-						dp = us.dotProduct(xn);
-						un = dp * xn;
+					un = dp * xn;
+					ut = up - un;
+					uvel = fabs(ut.cmp[0]) + fabs(ut.cmp[1]) + fabs(ut.cmp[2]);
 
+					if(uvel > small) {
 						dn = mesh.getBoundaryDistance(ib);
-						tauNN = 2.0 * visac * un/dn;
-						force = tauNN * mesh.getFaceArea(i);
-
-						// Assume not initialisation
-						//if(!init)
-						//{
-						au[ip] = au[ip] + visFace;
-						av[ip] = av[ip] + visFace;
-						aw[ip] = aw[ip] + visFace;
-
-						su[ip] = su[ip] + visFace * uCell[ip] - force.cmp[0];
-						sv[ip] = sv[ip] + visFace * vCell[ip] - force.cmp[1];
-						sw[ip] = sw[ip] + visFace * wCell[ip] - force.cmp[2];
-						//}
-
-						uBoundary[ib] = us.cmp[0];
-						vBoundary[ib] = us.cmp[1];
-						wBoundary[ib] = us.cmp[2];
+						tauNT = visac * ut/dn;
+						force = tauNT * view.faceArea[i];
+						mesh.setBoundaryShear(ib, force);
+					}
+					else {
+						force.cmp[0] = 0.0;
+						force.cmp[1] = 0.0;
+						force.cmp[2] = 0.0;
+						mesh.setBoundaryShear(ib, force);
 					}
-					else if(it == cupcfd::geometry::mesh::RTYPE_WALL) {
-						T coef;
-						T dp, dn;
-						T uvel;
-
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> uw;
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> un;
-						cupcfd::geometry::euclidean::EuclideanVector3D<T> xn;
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> up;
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> ut;
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> tauNT;
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> force;
-						cupcfd::geometry::euclidean::EuclideanVector<T,3> tmp;
-
-						xac = mesh.getFaceCenter(i);
-						uw = mesh.getRegionUVW(ir);
-
-						dudxac = dudx[ip];
-						dvdxac = dvdx[ip];
-						dwdxac = dwdx[ip];
 
-						visac = visEffBoundary[ib];
+					// Assume not initialisation?
+					//if(!init)
+					//{
+					au[ip] = au[ip] + coef;
+					av[ip] = av[ip] + coef;
+					aw[ip] = aw[ip] + coef;
+
+					su[ip] = su[ip] + coef * uCell[ip] - force.cmp[0];
+					sv[ip] = sv[ip] + coef * vCell[ip] - force.cmp[1];
+					sw[ip] = sw[ip] + coef * wCell[ip] - force.cmp[2];
+					//}
+
+					uBoundary[ib] = uw.cmp[0];
+					vBoundary[ib] = uw.cmp[1];
+					wBoundary[ib] = uw.cmp[2];
+				}
+			}
 
-						xpn = mesh.getFaceCenter(i) - mesh.getCellCenter(ip);
+			return cupcfd::error::E_SUCCESS;
+		}
 
-						// ToDo: Do we want to force this to be a double here?
-						// May also wish for it to just be a float - move out to template?
-						T xpn_length = xpn.length();
-						coef = visac * mesh.getFaceArea(i) / xpn_length;
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes FluxUVWDolfynFaceLoop1(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+													T gammaBlend,
+													T small,
+													// T large,
+													T * uCell, I nUCell,
+													T * vCell, I nVCell,
+													T * wCell, I nWCell,
+													T * uBoundary, I nUBoundary,
+													T * vBoundary, I nVBoundary,
+													T * wBoundary, I nWBoundary,
+													T * visEffCell, I nVisEffCell,
+													T * visEffBoundary, I nVisEffBoundary,
+													T * massFlux, I nMassFlux,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx, I nDudx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx, I nDvdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx, I nDwdx,
+													T * rFace, I nRFace,
+													T * su, I nSu,
+													T * sv, I nSv,
+													T * sw, I nSw,
+													T * au, I nAu,
+													T * av, I nAv,
+													T * aw, I nAw) {
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!mesh.kernelView.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
 
-						xn = mesh.getFaceNorm(i);
-						xn.normalise();
+			cupcfd::error::eCodes status;
 
-						up.cmp[0] = uCell[ip];
-						up.cmp[1] = vCell[ip];
-						up.cmp[2] = wCell[ip];
+			for(I i = 0; i < mesh.properties.lFaces; i++) {
+				status = FluxUVWDolfynFace1(mesh, i, gammaBlend, small, uCell, nUCell, vCell, nVCell, wCell,
+							nWCell, uBoundary, nUBoundary, vBoundary, nVBoundary, wBoundary, nWBoundary,
+							visEffCell, nVisEffCell, visEffBoundary, nVisEffBoundary, massFlux, nMassFlux,
+							dudx, nDudx, dvdx, nDvdx, dwdx, nDwdx, rFace, nRFace, su, nSu, sv, nSv, sw, nSw,
+							au, nAu, av, nAv, aw, nAw);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+			}
 
-						up = up - uw;
+			return cupcfd::error::E_SUCCESS;
+		}
 
-						dp = up.dotProduct(xn);
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes FluxUVWDolfynFaceLoop1Coloured(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh,
+													T gammaBlend,
+													T small,
+													// T large,
+													T * uCell, I nUCell,
+													T * vCell, I nVCell,
+													T * wCell, I nWCell,
+													T * uBoundary, I nUBoundary,
+													T * vBoundary, I nVBoundary,
+													T * wBoundary, I nWBoundary,
+													T * visEffCell, I nVisEffCell,
+													T * visEffBoundary, I nVisEffBoundary,
+													T * massFlux, I nMassFlux,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dudx, I nDudx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dvdx, I nDvdx,
+													cupcfd::geometry::euclidean::EuclideanVector<T,3> * dwdx, I nDwdx,
+													T * rFace, I nRFace,
+													T * su, I nSu,
+													T * sv, I nSv,
+													T * sw, I nSw,
+													T * au, I nAu,
+													T * av, I nAv,
+													T * aw, I nAw) {
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!mesh.kernelView.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
 
-						un = dp * xn;
-						ut = up - un;
-						uvel = fabs(ut.cmp[0]) + fabs(ut.cmp[1]) + fabs(ut.cmp[2]);
+			if(!mesh.faceColouring.built) {
+				return FluxUVWDolfynFaceLoop1(mesh, gammaBlend, small, uCell, nUCell, vCell, nVCell, wCell,
+						nWCell, uBoundary, nUBoundary, vBoundary, nVBoundary, wBoundary, nWBoundary,
+						visEffCell, nVisEffCell, visEffBoundary, nVisEffBoundary, massFlux, nMassFlux, dudx,
+						nDudx, dvdx, nDvdx, dwdx, nDwdx, rFace, nRFace, su, nSu, sv, nSv, sw, nSw, au, nAu,
+						av, nAv, aw, nAw);
+			}
 
-						if(uvel > small) {
-							dn = mesh.getBoundaryDistance(ib);
-							tauNT = visac * ut/dn;
-							force = tauNT * mesh.getFaceArea(i);
-							mesh.setBoundaryShear(ib, force);
-						}
-						else {
-							force.cmp[0] = 0.0;
-							force.cmp[1] = 0.0;
-							force.cmp[2] = 0.0;
-							mesh.setBoundaryShear(ib, force);
+			cupcfd::error::eCodes status = cupcfd::error::E_SUCCESS;
+
+			I nColours = mesh.faceColouring.nColours;
+			I * colourXAdj = mesh.faceColouring.colourXAdj;
+			I * colourFaces = mesh.faceColouring.colourFaces;
+
+			// No two faces of a colour share a cell, and the implicit barrier at the end of each loop orders the colours
+			#pragma omp parallel
+			{
+				for(I c = 0; c < nColours; c++) {
+					#pragma omp for
+					for(I j = colourXAdj[c]; j < colourXAdj[c+1]; j++) {
+						cupcfd::error::eCodes faceStatus;
+						faceStatus = FluxUVWDolfynFace1(mesh, colourFaces[j], gammaBlend, small, uCell,
+									nUCell, vCell, nVCell, wCell, nWCell, uBoundary, nUBoundary, vBoundary,
+									nVBoundary, wBoundary, nWBoundary, visEffCell, nVisEffCell,
+									visEffBoundary, nVisEffBoundary, massFlux, nMassFlux, dudx, nDudx, dvdx,
+									nDvdx, dwdx, nDwdx, rFace, nRFace, su, nSu, sv, nSv, sw, nSw, au, nAu,
+									av, nAv, aw, nAw);
+						if(faceStatus != cupcfd::error::E_SUCCESS) {
+							#pragma omp critical
+							status = faceStatus;
 						}
-
-						// Assume not initialisation?
-						//if(!init)
-						//{
-						au[ip] = au[ip] + coef;
-						av[ip] = av[ip] + coef;
-						aw[ip] = aw[ip] + coef;
-
-						su[ip] = su[ip] + coef * uCell[ip] - force.cmp[0];
-						sv[ip] = sv[ip] + coef * vCell[ip] - force.cmp[1];
-						sw[ip] = sw[ip] + coef * wCell[ip] - force.cmp[2];
-						//}
-
-						uBoundary[ib] = uw.cmp[0];
-						vBoundary[ib] = uw.cmp[1];
-						wBoundary[ib] = uw.cmp[2];
 					}
 				}
 			}
 
-			return cupcfd::error::E_SUCCESS;
+			return status;
 		}
 
 		template <class M, class I, class T, class L>
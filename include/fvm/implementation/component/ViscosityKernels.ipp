@@ -113,6 +113,13 @@ namespace cupcfd
 																	T * den, I nDen,
 																	T * visEffCell, I nVisEffCell,
 																	T * visEffBoundary, I nVisEffBoundary) {
+			const cupcfd::geometry::mesh::UnstructuredMeshKernelView<I,T>& view = mesh.kernelView;
+
+			// The kernels read the mesh geometry from the kernel view, which is built when the mesh is finalized
+			if(!view.built) {
+				return cupcfd::error::E_UNFINALIZED;
+			}
+
 			T cmu = tmcmu;
 			T cmu25 = pow(cmu, 0.25);
 			// T visURF = 1.0;
@@ -134,7 +141,7 @@ namespace cupcfd
 				I i = mesh.getBoundaryFaceID(ib);
 				I ir = mesh.getBoundaryRegionID(ib);
 				cupcfd::geometry::mesh::RType it = mesh.getRegionType(ir);
-				I ip = mesh.getFaceCell1ID(i);
+				I ip = view.faceCell1[i];
 				// I in = mesh.getFaceCell2ID(i);
 
 				#ifdef DEBUG
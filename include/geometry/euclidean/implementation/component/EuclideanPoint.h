@@ -30,11 +30,14 @@ namespace cupcfd
 			 * Stores N-Dimensional Position Data in a Euclidean Space for a
 			 * templated datatype.
 			 *
+			 * The class holds no virtual methods, so is trivially copyable and
+			 * has the same size as its component array.
+			 *
 			 * @tparam T The data type of the coordinate system
 			 * @tparam N The dimension of the coordinate space (e.g. 2 for 2D, 3 for 3D...)
 			 */
 			template <class T, unsigned int N>
-			class EuclideanPoint : public cupcfd::comm::mpi::CustomMPIType
+			class EuclideanPoint
 			{
 				public:
 
@@ -67,7 +70,7 @@ namespace cupcfd
 					 * @param point The point to duplicate
 					 *
 					 */
-					EuclideanPoint(const EuclideanPoint &point);
+					EuclideanPoint(const EuclideanPoint &point) = default;
 
 					/**
 					 * Constructor - Sets dimensional coordinates of the point to those provided
@@ -88,9 +91,9 @@ namespace cupcfd
 					 *
 					 * @param source The point to copy the values from
 					 *
-					 * @return Returns nothing
+					 * @return This point
 					 */
-					inline void operator=(const EuclideanPoint<T,N>& source);
+					EuclideanPoint& operator=(const EuclideanPoint<T,N>& source) = default;
 
 					/**
 					 * Set both values of the coordinate to a fixed scalar
@@ -462,19 +465,51 @@ namespace cupcfd
 					 */
 					void print() const;
 
-					// === Inherited Overloads ===
+					// === MPI Datatype ===
+					// These are static, rather than overloads of CustomMPIType, so that the class holds no vtable
+					// pointer and remains trivially copyable. They are found by cupcfd::comm::mpi::getMPIType.
 
+					/**
+					 * Retrieve the MPI Datatype registered for this class
+					 *
+					 * @param dType A pointer to where the datatype will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_MPI_DATATYPE_UNREGISTERED The datatype has not been registered
+					 */
 					__attribute__((warn_unused_result))
-					inline cupcfd::error::eCodes getMPIType(MPI_Datatype * dType);
+					static inline cupcfd::error::eCodes getMPIType(MPI_Datatype * dType);
 
+					/**
+					 * Register a MPI Datatype for this class with the MPI library
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_MPI_DATATYPE_REGISTERED The datatype is already registered
+					 * @retval cupcfd::error::E_MPI_ERR An error was returned by the MPI library
+					 */
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes registerMPIType();
+					static cupcfd::error::eCodes registerMPIType();
 
+					/**
+					 * Free the MPI Datatype registered for this class
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_MPI_DATATYPE_UNREGISTERED The datatype is not registered
+					 * @retval cupcfd::error::E_MPI_ERR An error was returned by the MPI library
+					 */
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes deregisterMPIType();
+					static cupcfd::error::eCodes deregisterMPIType();
 
+					/**
+					 * Check whether the MPI Datatype for this class is registered
+					 *
+					 * @return Whether the datatype is registered
+					 */
 					__attribute__((warn_unused_result))
-					inline bool isRegistered();
+					static inline bool isRegistered();
 			};
 		} // namespace euclidean
 	} // namespace geometry
@@ -30,12 +30,6 @@ namespace cupcfd
 				}
 			}
 
-			template <class T, unsigned int N>
-			EuclideanPoint<T,N>::EuclideanPoint(const EuclideanPoint<T,N> &point) {
-				for(uint i = 0; i < N; i++) {
-					this->cmp[i] = point.cmp[i];
-				}
-			}
 			
 			template <class T, unsigned int N>
 			inline bool EuclideanPoint<T,N>::approximateEquals(const EuclideanPoint<T,N>& p, float pct_tolerance) {
@@ -51,13 +45,6 @@ namespace cupcfd
 				return true;
 			}
 			
-			template <class T, unsigned int N>
-			inline void EuclideanPoint<T,N>::operator=(const EuclideanPoint<T,N>& source) {
-				for(uint i = 0; i < N; i++) {
-					this->cmp[i] = source.cmp[i];
-				}
-			}
-			
 			template <class T, unsigned int N>
 			inline void EuclideanPoint<T,N>::operator=(const T scalar) {
 				for(uint i = 0; i < N; i++) {
@@ -85,7 +72,7 @@ namespace cupcfd
 						
 			template <class T, unsigned int N>
 			inline cupcfd::error::eCodes EuclideanPoint<T,N>::getMPIType(MPI_Datatype * dType) {
-				if(!(this->isRegistered())) {
+				if(!(EuclideanPoint<T,N>::isRegistered())) {
 					return cupcfd::error::E_MPI_DATATYPE_UNREGISTERED;
 				}
 			
@@ -107,7 +94,7 @@ namespace cupcfd
 			template <class T, unsigned int N>
 			cupcfd::error::eCodes EuclideanPoint<T,N>::registerMPIType() {
 				// Error Check - Only Register if currently unregistered
-				if(this->isRegistered()) {
+				if(EuclideanPoint<T,N>::isRegistered()) {
 					return cupcfd::error::E_MPI_DATATYPE_REGISTERED;
 				}
 
@@ -122,7 +109,7 @@ namespace cupcfd
 
 				// Get the mpi type of a euclidean vector component - all components should share the same type
 				MPI_Datatype componentType;
-				cupcfd::comm::mpi::getMPIType(this->cmp[0], &componentType);
+				cupcfd::comm::mpi::getMPIType(T(0), &componentType);
 				structTypes[0] = componentType;
 
 				displ[0] = (MPI_Aint) offsetOf(&EuclideanPoint::cmp);
@@ -176,7 +163,7 @@ namespace cupcfd
 				int mpiErr;
 
 				// Error Check - Only Deregister if currently registered
-				if(!this->isRegistered()) {
+				if(!EuclideanPoint<T,N>::isRegistered()) {
 					return cupcfd::error::E_MPI_DATATYPE_UNREGISTERED;
 				}
 
@@ -31,13 +31,14 @@ namespace cupcfd
 			 * Stores data and operators for vectors in a euclidean space.
 			 *
 			 * This classes is also suitable for parallel communication via
-			 * the MPI interfaces.
+			 * the MPI interfaces. The class holds no virtual methods, so is
+			 * trivially copyable and has the same size as its component array.
 			 *
 			 * @tparam T The data type of the coordinate system
 			 * @tparam N The dimension of the coordinate space (e.g. 2 for 2D, 3 for 3D...)
 			 */
 			template <class T, unsigned int N>
-			class EuclideanVector : public cupcfd::comm::mpi::CustomMPIType
+			class EuclideanVector
 			{
 				// Asserts
 				static_assert(N > 1, "Cannot have zero or negative dimension vectors");
@@ -69,9 +70,9 @@ namespace cupcfd
 					EuclideanVector(T scalar);
 
 					/**
-					 * Copy constructor. Sets all vector values to the scalar.
+					 * Copy constructor. Copies the vector values from another vector.
 					 */
-					EuclideanVector(const EuclideanVector& v);
+					EuclideanVector(const EuclideanVector& v) = default;
 
 					/**
 					 * Constructor. Sets the components to matching values of the provided params
@@ -84,20 +85,20 @@ namespace cupcfd
 					/**
 					 * Default Deconstructor
 					 */
-					~EuclideanVector();
+					~EuclideanVector() = default;
 
 					// === Static Methods ===
 
 					// === Concrete Methods ===
 
 					/**
-					 * Deep copies the x and y values from a source vector into this vector object
+					 * Deep copies the component values from a source vector into this vector object
 					 *
 					 * @param source The source vector to copy from
 					 *
-					 * @return Nothing
+					 * @return This vector
 					 */
-					inline void operator=(const EuclideanVector<T,N>& source);
+					EuclideanVector& operator=(const EuclideanVector<T,N>& source) = default;
 
 					/**
 					 * Sets each component of this vector to the scalar value
@@ -431,19 +432,51 @@ namespace cupcfd
 					void print() const;
 
 
-					// === Inherited Overloads ===
+					// === MPI Datatype ===
+					// These are static, rather than overloads of CustomMPIType, so that the class holds no vtable
+					// pointer and remains trivially copyable. They are found by cupcfd::comm::mpi::getMPIType.
 
+					/**
+					 * Retrieve the MPI Datatype registered for this class
+					 *
+					 * @param dType A pointer to where the datatype will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_MPI_DATATYPE_UNREGISTERED The datatype has not been registered
+					 */
 					__attribute__((warn_unused_result))
-					inline cupcfd::error::eCodes getMPIType(MPI_Datatype * dType);
+					static inline cupcfd::error::eCodes getMPIType(MPI_Datatype * dType);
 
+					/**
+					 * Register a MPI Datatype for this class with the MPI library
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_MPI_DATATYPE_REGISTERED The datatype is already registered
+					 * @retval cupcfd::error::E_MPI_ERR An error was returned by the MPI library
+					 */
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes registerMPIType();
+					static cupcfd::error::eCodes registerMPIType();
 
+					/**
+					 * Free the MPI Datatype registered for this class
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_MPI_DATATYPE_UNREGISTERED The datatype is not registered
+					 * @retval cupcfd::error::E_MPI_ERR An error was returned by the MPI library
+					 */
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes deregisterMPIType();
+					static cupcfd::error::eCodes deregisterMPIType();
 
+					/**
+					 * Check whether the MPI Datatype for this class is registered
+					 *
+					 * @return Whether the datatype is registered
+					 */
 					__attribute__((warn_unused_result))
-					inline bool isRegistered();
+					static inline bool isRegistered();
 			};
 
 			// ToDo: Would prefer to have this as a member of the vector class, but this function makes no sense
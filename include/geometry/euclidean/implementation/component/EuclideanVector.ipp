@@ -27,13 +27,6 @@ namespace cupcfd
 	{
 		namespace euclidean
 		{
-			template <class T, unsigned int N>
-			inline void EuclideanVector<T,N>::operator=(const EuclideanVector<T,N>& source) {
-				for(uint i = 0; i < N; i++) {
-					this->cmp[i] = source.cmp[i];
-				}
-			}
-
 			template <class T, unsigned int N>
 			inline void EuclideanVector<T,N>::operator=(const T scalar) {
 				for(uint i = 0; i < N; i++) {
@@ -214,7 +207,7 @@ namespace cupcfd
 
 			template <class T, unsigned int N>
 			inline cupcfd::error::eCodes EuclideanVector<T,N>::getMPIType(MPI_Datatype * dType) {
-				if(!(this->isRegistered())) {
+				if(!(EuclideanVector<T,N>::isRegistered())) {
 					return cupcfd::error::E_MPI_DATATYPE_UNREGISTERED;
 				}
 			
@@ -37,6 +37,7 @@
 
 // Error Codes
 #include "Error.h"
+#include "HashMap.h"
 
 // C++ Library
 #include <vector>
@@ -162,35 +163,35 @@ namespace cupcfd
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> vertexBuildIDToLocalID;
+					cupcfd::data_structures::IndexMap<L, I> vertexBuildIDToLocalID;
 
 					/**
 					 * Scratch Space - Map Scheme Build Boundary Label to Local ID
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> boundaryBuildIDToLocalID;
+					cupcfd::data_structures::IndexMap<L, I> boundaryBuildIDToLocalID;
 
 					/**
 					 * Scratch Space - Map Scheme Build Region Label to Local ID
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> regionBuildIDToLocalID;
+					cupcfd::data_structures::IndexMap<L, I> regionBuildIDToLocalID;
 
 					/**
 					 * Scratch Space - Map Scheme Build Cell Label to Local ID
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> cellBuildIDToLocalID;
+					cupcfd::data_structures::IndexMap<L, I> cellBuildIDToLocalID;
 
 					/**
 					 * Scratch Space - Map Scheme Build Face Label to Local ID
 					 * Used as a temporary structure prior to finalising to lookup the locally assigned ID
 					 * from the global ID of the index scheme used to build the mesh.
 					 */
-					std::map<L, I> faceBuildIDToLocalID;
+					cupcfd::data_structures::IndexMap<L, I> faceBuildIDToLocalID;
 
 					// === Constructors/Deconstructors ===
 
@@ -524,6 +525,26 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes updateCellLocalIndexes();
 
+					/**
+					 * Renumber the local faces so that they are grouped by the lower numbered of their two cells,
+					 * following the cell order of the connectivity graph. The face data, the face build ID map and
+					 * the boundary -> face mappings are all updated to the new numbering.
+					 *
+					 * This does nothing unless a cell reordering has been applied by reorderCells, since faces
+					 * are otherwise kept in the order they were added.
+					 *
+					 * This should be called after updateCellLocalIndexes and before updateCellFaceMap.
+					 *
+					 * @tparam I The type of the indexing scheme (integer based)
+					 * @tparam T The type of the stored array data
+					 * @tparam L The type of the cell labels
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes reorderFaces();
+
 					/**
 					 * This updates the internal CSR members responsible for storing the cell->face mappings,
 					 * as well as the number of stored faces and vertices per cell.
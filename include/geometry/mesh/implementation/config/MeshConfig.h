@@ -16,6 +16,9 @@
 // Error Codes
 #include "Error.h"
 
+// C++ Library
+#include <string>
+
 // Partitioner Configuration Objects
 #include "PartitionerConfig.h"
 #include "MeshSourceConfig.h"
@@ -54,11 +57,34 @@ namespace cupcfd
 					/** Stores the mesh data source configuration**/
 					MeshSourceConfig<I,T,L> * meshSourceConfig;
 
+					/** The renumbering of the local cells and faces to apply when the mesh is finalized **/
+					MeshReorderType reorderType;
+
+					/**
+					 * Path of the checkpoint of the partitioned mesh. If empty, no checkpoint is used.
+					 * Otherwise the mesh is reloaded from the checkpoint if it was completely written by the same number
+					 * of processes from a mesh of the same size as the mesh source, and is built from the mesh source
+					 * and written to the checkpoint if not.
+					 **/
+					std::string checkpointPath;
+
+					/** Whether the last mesh build reloaded the mesh from the checkpoint **/
+					bool checkpointLoaded;
+
+					/** Whether the mesh source recorded its reads during the last mesh build **/
+					bool sourceReadRecorded;
+
+					/** Bytes read by this process from the mesh source during the last mesh build **/
+					unsigned long long sourceBytesRead;
+
+					/** Time spent by this process reading from the mesh source during the last mesh build, in seconds **/
+					double sourceReadTime;
+
 					// === Constructor/Deconstructor ===
 
 					/**
 					 * Constructor
-					 * Sets values/configuration to those provided.
+					 * Sets values/configuration to those provided. No cell reordering is selected.
 					 *
 					 * @param partConfig Partitioner Configuration
 					 */
@@ -114,6 +140,54 @@ namespace cupcfd
 					 */
 					inline void setMeshSourceConfig(MeshSourceConfig<I,T,L>& meshSourceConfig);
 
+					/**
+					 * Get the renumbering of the local cells that will be applied when the mesh is finalized
+					 *
+					 * @return The reordering type
+					 */
+					__attribute__((warn_unused_result))
+					inline MeshReorderType getReorderType();
+
+					/**
+					 * Set the renumbering of the local cells that will be applied when the mesh is finalized
+					 *
+					 * @param reorderType The reordering type
+					 *
+					 * @return Nothing
+					 */
+					inline void setReorderType(MeshReorderType reorderType);
+
+					/**
+					 * Get the path of the checkpoint of the partitioned mesh
+					 *
+					 * @return The checkpoint path, or an empty string if no checkpoint is used
+					 */
+					__attribute__((warn_unused_result))
+					inline std::string getCheckpointPath();
+
+					/**
+					 * Set the path of the checkpoint of the partitioned mesh
+					 *
+					 * @param checkpointPath The checkpoint path, or an empty string to not use a checkpoint
+					 *
+					 * @return Nothing
+					 */
+					inline void setCheckpointPath(std::string checkpointPath);
+
+					/**
+					 * Get the volume of data read by this process from the mesh source during the last call
+					 * to buildUnstructuredMesh, and the time spent reading it.
+					 *
+					 * @param bytesRead A pointer to where the number of bytes read will be stored
+					 * @param readTime A pointer to where the time spent reading, in seconds, will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_NOT_IMPLEMENTED No mesh has been built, or the mesh source does not record its reads
+					 */
+					__attribute__((warn_unused_result))
+					inline cupcfd::error::eCodes getSourceReadStatistics(unsigned long long * bytesRead, double * readTime);
+
 					/**
 					 * Deep copy from source to this configuration
 					 *
@@ -137,6 +211,14 @@ namespace cupcfd
 					 * It will be populated with data from sources specified in the configuration, and partitioned
 					 * using the partitioner specified in the config.
 					 *
+					 * If a checkpoint path is set and every process finds that the checkpoint was completely written by
+					 * the same number of processes from a mesh with the same number of cells and faces as the mesh
+					 * source, the mesh is instead reloaded from the checkpoint, without reading the mesh data of the
+					 * source or partitioning. Otherwise, the checkpoint is written once the mesh has been built.
+					 *
+					 * If the mesh source can decompose the mesh itself (e.g. a generated structured mesh with a block
+					 * decomposition), its assignment of cells is used and the partitioner is not run.
+					 *
 					 * ToDo: This should probably be moved out into a static function with additional parameters
 					 * for partitioners etc.
 					 *
@@ -155,6 +237,63 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes buildUnstructuredMesh(M ** mesh,
 																cupcfd::comm::Communicator& comm);
+
+					/**
+					 * Compute a new assignment of the owned cells of an existing mesh to processes, so that the
+					 * total cell weight on each process is balanced. The cell connectivity graph of the mesh is
+					 * partitioned with the partitioner specified in the config, which must support node weights.
+					 *
+					 * This is a blocking call - all ranks that store part of the mesh must call it.
+					 *
+					 * @param mesh The finalized mesh whose cells should be reassigned
+					 * @param cellWeights The weight of each owned cell, indexed by local cell ID. Every weight
+					 * must be greater than zero.
+					 * @param nCellWeights The size of cellWeights in the number of elements of type double.
+					 * Must be the number of owned cells.
+					 * @param cellRanks The location where the new rank of each owned cell will be stored,
+					 * indexed by local cell ID.
+					 * @param nCellRanks The size of cellRanks in the number of elements of type I.
+					 * Must be the number of owned cells.
+					 *
+					 * @tparam M The type of the implementing class for the UnstructuredMeshInterface type.
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH cellWeights or cellRanks is not sized to the owned cells
+					 * @retval cupcfd::error::E_NOT_IMPLEMENTED The configured partitioner does not support node weights
+					 */
+					template <class M>
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes repartitionUnstructuredMesh(M& mesh,
+																	  double * cellWeights, I nCellWeights,
+																	  I * cellRanks, I nCellRanks);
+
+					/**
+					 * Construct a new Mesh object that moves the owned cells of an existing mesh to new ranks,
+					 * such as those computed by repartitionUnstructuredMesh. The cell data is read again from
+					 * the mesh source specified in the configuration, and the new mesh is finalized, so its
+					 * cell connectivity graph and exchange patterns are rebuilt for the new distribution.
+					 *
+					 * This is a blocking call - all ranks that store part of the mesh must call it.
+					 *
+					 * @param mesh A pointer to the location where the newly created mesh pointer should be stored.
+					 * @param currentMesh The finalized mesh whose cells are being moved
+					 * @param cellRanks The new rank of each owned cell of currentMesh, indexed by local cell ID
+					 * @param nCellRanks The size of cellRanks in the number of elements of type I.
+					 * Must be the number of owned cells.
+					 * @param comm The communicator containing all ranks that store part of the mesh
+					 *
+					 * @tparam M The type of the implementing class for the UnstructuredMeshInterface type.
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH cellRanks is not sized to the owned cells
+					 */
+					template <class M>
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes buildUnstructuredMesh(M ** mesh, M& currentMesh,
+																I * cellRanks, I nCellRanks,
+																cupcfd::comm::Communicator& comm);
 			};
 		}
 	}
@@ -13,7 +13,13 @@
 #ifndef CUPCFD_CONFIG_MESH_CONFIG_IPP_H
 #define CUPCFD_CONFIG_MESH_CONFIG_IPP_H
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
+
+#include "AllToAll.h"
+#include "Reduce.h"
+#include "MeshSourceCheckpoint.h"
 
 namespace euc = cupcfd::geometry::euclidean;
 
@@ -51,11 +57,45 @@ namespace cupcfd
 
 				this->meshSourceConfig = meshSourceConfig.clone();
 			}
+
+			template <class I, class T, class L>
+			inline MeshReorderType MeshConfig<I,T,L>::getReorderType() {
+				return this->reorderType;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshConfig<I,T,L>::setReorderType(MeshReorderType reorderType) {
+				this->reorderType = reorderType;
+			}
 					
+			template <class I, class T, class L>
+			inline std::string MeshConfig<I,T,L>::getCheckpointPath() {
+				return this->checkpointPath;
+			}
+
+			template <class I, class T, class L>
+			inline void MeshConfig<I,T,L>::setCheckpointPath(std::string checkpointPath) {
+				this->checkpointPath = checkpointPath;
+			}
+
+			template <class I, class T, class L>
+			inline cupcfd::error::eCodes MeshConfig<I,T,L>::getSourceReadStatistics(unsigned long long * bytesRead, double * readTime) {
+				if(!this->sourceReadRecorded) {
+					return cupcfd::error::E_NOT_IMPLEMENTED;
+				}
+
+				*bytesRead = this->sourceBytesRead;
+				*readTime = this->sourceReadTime;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			template <class I, class T, class L>
 			inline void MeshConfig<I,T,L>::operator=(const MeshConfig<I,T,L>& source) {				
 				this->setPartitionerConfig(*(source.partConfig));
 				this->setMeshSourceConfig(*(source.meshSourceConfig));
+				this->reorderType = source.reorderType;
+				this->checkpointPath = source.checkpointPath;
 			}
 			
 			// ToDo: Might wish to consider splitting this up and putting parts of it in MeshSource so that a
@@ -71,47 +111,140 @@ namespace cupcfd
 				cupcfd::error::eCodes status;
 
 				// ==========================================================
-				// (1) Setup Stage: Identify which cells this process 'owns'
+				// (0) Check for a checkpoint of this mesh written by the same number of processes
 				// ==========================================================
 
-				// (1) Build the mesh source
 				MeshSource<I,T,L> * source;
-				status = this->meshSourceConfig->buildMeshSource(&source);
-				CHECK_ECODE(status)
-
-				// (2) Build a naive connectivity graph
-				cupcfd::data_structures::DistributedAdjacencyList<I,I> naiveConnGraph(comm);
-				status = source->buildDistributedAdjacencyList(naiveConnGraph, comm);
-				CHECK_ECODE(status)
-				
-				// (3) Use the partitioner config to build a partitioner
-				cupcfd::partitioner::PartitionerInterface<I,I> * partitioner;
-				status = this->partConfig->buildPartitioner(&partitioner, naiveConnGraph);
-				CHECK_ECODE(status)
-				
-				// (4) Run the partitioner and store the results
-				//partitioner->initialise(*naiveConnGraph, comm.size);
-				status = partitioner->partition();
-				CHECK_ECODE(status)
-
-				// I * assignedCellLabels;
+				cupcfd::partitioner::PartitionerInterface<I,I> * partitioner = nullptr;
 				I * assignedCellLabels = NULL;
 				I nAssignedCellLabels;
 
-				// ToDo: The use of comm inside the partitioner for this alongside the nparts
-				// above needs some tidying up....
-				status = partitioner->assignRankNodes(&assignedCellLabels, &nAssignedCellLabels);
+				// The mesh source is built even if a checkpoint exists, since the checkpoint must match its size
+				status = this->meshSourceConfig->buildMeshSource(&source, comm);
 				CHECK_ECODE(status)
 
+				this->checkpointLoaded = false;
+
+				if(!this->checkpointPath.empty()) {
+					I sourceCells;
+					I sourceFaces;
+
+					status = source->getCellCount(&sourceCells);
+					if(status != cupcfd::error::E_SUCCESS) {
+						delete source;
+						return status;
+					}
+
+					status = source->getFaceCount(&sourceFaces);
+					if(status != cupcfd::error::E_SUCCESS) {
+						delete source;
+						return status;
+					}
+
+					int checkpointValid = 0;
+					int checkpointRanks;
+					int checkpointCells;
+					int checkpointFaces;
+
+					status = MeshSourceCheckpoint<I,T>::getCheckpointRankCount(this->checkpointPath, &checkpointRanks);
+					if(status == cupcfd::error::E_SUCCESS && checkpointRanks == comm.size) {
+						status = MeshSourceCheckpoint<I,T>::getCheckpointMeshSize(this->checkpointPath, &checkpointCells, &checkpointFaces);
+						checkpointValid = (status == cupcfd::error::E_SUCCESS
+										   && checkpointCells == sourceCells && checkpointFaces == sourceFaces) ? 1 : 0;
+					}
+
+					// Each process checks the file by itself, so all must agree before the collective reload
+					int allCheckpointValid;
+					status = cupcfd::comm::allReduceMin(&checkpointValid, 1, &allCheckpointValid, 1, comm);
+					if(status != cupcfd::error::E_SUCCESS) {
+						delete source;
+						return status;
+					}
+
+					this->checkpointLoaded = (allCheckpointValid == 1);
+				}
+
+				if(this->checkpointLoaded) {
+					// The checkpoint holds the cells assigned to each process, so reload them directly
+					// without reading the rest of the mesh source or partitioning
+					delete source;
+
+					MeshSourceCheckpoint<I,T> * checkpoint = new MeshSourceCheckpoint<I,T>(this->checkpointPath, comm);
+					status = checkpoint->getOwnedCellLabels(&assignedCellLabels, &nAssignedCellLabels);
+					CHECK_ECODE(status)
+					source = checkpoint;
+				}
+				else {
+					// ==========================================================
+					// (1) Setup Stage: Identify which cells this process 'owns'
+					// ==========================================================
+
+					// If the source can decompose the mesh itself, use its assignment directly
+					status = source->getCellDecomposition(&assignedCellLabels, &nAssignedCellLabels, comm);
+					if(status != cupcfd::error::E_NOT_IMPLEMENTED) {
+						CHECK_ECODE(status)
+					}
+					else {
+						// (2) Build a naive connectivity graph
+						cupcfd::data_structures::DistributedAdjacencyList<I,I> naiveConnGraph(comm);
+						status = source->buildDistributedAdjacencyList(naiveConnGraph, comm);
+						CHECK_ECODE(status)
+
+						// (3) Use the partitioner config to build a partitioner
+						status = this->partConfig->buildPartitioner(&partitioner, naiveConnGraph);
+						CHECK_ECODE(status)
+
+						// Geometric partitioners use the cell centers rather than the connectivity
+						if(partitioner->usesNodeCoordinates()) {
+							I nNodes = partitioner->nNodes;
+							std::vector<euc::EuclideanPoint<T,3>> centers(nNodes);
+							std::vector<double> coords(nNodes * 3);
+
+							status = source->getCellCenter(centers.data(), nNodes, partitioner->nodes, nNodes);
+							CHECK_ECODE(status)
+
+							for(I i = 0; i < nNodes; i++) {
+								coords[i * 3] = double(centers[i].cmp[0]);
+								coords[i * 3 + 1] = double(centers[i].cmp[1]);
+								coords[i * 3 + 2] = double(centers[i].cmp[2]);
+							}
+
+							status = partitioner->setNodeCoordinates(coords.data(), nNodes * 3);
+							CHECK_ECODE(status)
+						}
+
+						// (4) Run the partitioner and store the results
+						//partitioner->initialise(*naiveConnGraph, comm.size);
+						status = partitioner->partition();
+						CHECK_ECODE(status)
+
+						// ToDo: The use of comm inside the partitioner for this alongside the nparts
+						// above needs some tidying up....
+						status = partitioner->assignRankNodes(&assignedCellLabels, &nAssignedCellLabels);
+						CHECK_ECODE(status)
+					}
+				}
+
 				// (5) Create the Mesh using the MeshSource and the assigned labels
 				// Create the Mesh Object based on the template type M
 				// This should inherit from UnstructuredMeshInterface so the type constraint is satisfied
 				*mesh = new M(comm);
 				status = (*mesh)->addData(*source, assignedCellLabels, nAssignedCellLabels);
 				CHECK_ECODE(status)
+
+				// All reads from the source are complete
+				status = source->getReadStatistics(&this->sourceBytesRead, &this->sourceReadTime);
+				this->sourceReadRecorded = (status == cupcfd::error::E_SUCCESS);
+				(*mesh)->reordering.type = this->reorderType;
 				status = (*mesh)->finalize();
 				CHECK_ECODE(status)
-				
+
+				// (6) Store the partitioned mesh so that later runs can reload it
+				if(!this->checkpointPath.empty() && !this->checkpointLoaded) {
+					status = MeshSourceCheckpoint<I,T>::writeCheckpoint(**mesh, this->checkpointPath);
+					CHECK_ECODE(status)
+				}
+
 				// Cleanup
 				delete partitioner;
 				delete source;
@@ -119,6 +252,150 @@ namespace cupcfd
 
 				return cupcfd::error::E_SUCCESS;
 			}
+
+			template <class I, class T, class L>
+			template <class M>
+			cupcfd::error::eCodes MeshConfig<I,T,L>::repartitionUnstructuredMesh(M& mesh,
+																				  double * cellWeights, I nCellWeights,
+																				  I * cellRanks, I nCellRanks) {
+				cupcfd::error::eCodes status;
+
+				I nOwnedCells = mesh.properties.lOCells;
+
+				if(nCellWeights != nOwnedCells || nCellRanks != nOwnedCells) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				// (1) Build a partitioner for the connectivity graph of the owned cells
+				cupcfd::partitioner::PartitionerInterface<I,I> * partitioner = nullptr;
+				status = this->partConfig->buildPartitioner(&partitioner, *(mesh.cellConnGraph));
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				// The partitioner nodes are the cell labels, so find the local ID of each
+				I nNodes = partitioner->nNodes;
+				std::vector<I> nodeCellID(nNodes);
+
+				for(I i = 0; i < nNodes; i++) {
+					mesh.getCellID(partitioner->nodes[i], &(nodeCellID[i]));
+				}
+
+				// (2) Weight each node by its cell
+				std::vector<double> weights(nNodes);
+				for(I i = 0; i < nNodes; i++) {
+					weights[i] = cellWeights[nodeCellID[i]];
+				}
+
+				status = partitioner->setNodeWeights(weights.data(), nNodes);
+				if(status != cupcfd::error::E_SUCCESS) {
+					delete partitioner;
+					return status;
+				}
+
+				// Geometric partitioners use the cell centers rather than the connectivity
+				if(partitioner->usesNodeCoordinates()) {
+					std::vector<double> coords(nNodes * 3);
+
+					for(I i = 0; i < nNodes; i++) {
+						euc::EuclideanPoint<T,3> center;
+						mesh.getCellCenter(nodeCellID[i], center);
+						coords[i * 3] = double(center.cmp[0]);
+						coords[i * 3 + 1] = double(center.cmp[1]);
+						coords[i * 3 + 2] = double(center.cmp[2]);
+					}
+
+					status = partitioner->setNodeCoordinates(coords.data(), nNodes * 3);
+					if(status != cupcfd::error::E_SUCCESS) {
+						delete partitioner;
+						return status;
+					}
+				}
+
+				// (3) Partition and store the new rank of each cell
+				status = partitioner->partition();
+				if(status != cupcfd::error::E_SUCCESS) {
+					delete partitioner;
+					return status;
+				}
+
+				for(I i = 0; i < nNodes; i++) {
+					cellRanks[nodeCellID[i]] = partitioner->result[i];
+				}
+
+				delete partitioner;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T, class L>
+			template <class M>
+			cupcfd::error::eCodes MeshConfig<I,T,L>::buildUnstructuredMesh(M ** mesh, M& currentMesh,
+																			  I * cellRanks, I nCellRanks,
+																			  cupcfd::comm::Communicator& comm) {
+				cupcfd::error::eCodes status;
+
+				I nOwnedCells = currentMesh.properties.lOCells;
+
+				if(nCellRanks != nOwnedCells) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				// (1) Send the label of each owned cell to its new rank
+				std::vector<I> ownedCellLabels(nOwnedCells);
+				for(auto iter = currentMesh.cellBuildIDToLocalID.begin(); iter != currentMesh.cellBuildIDToLocalID.end(); iter++) {
+					if(iter->second < nOwnedCells) {
+						ownedCellLabels[iter->second] = iter->first;
+					}
+				}
+
+				I * assignedCellLabels = nullptr;
+				I nAssignedCellLabels = 0;
+
+				if(comm.size > 1) {
+					std::vector<int> processIDs(cellRanks, cellRanks + nOwnedCells);
+
+					status = cupcfd::comm::AllToAll(ownedCellLabels.data(), nOwnedCells,
+													processIDs.data(), nOwnedCells,
+													&assignedCellLabels, &nAssignedCellLabels, comm);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+				else {
+					nAssignedCellLabels = nOwnedCells;
+					assignedCellLabels = (I *) malloc(sizeof(I) * nAssignedCellLabels);
+					std::copy(ownedCellLabels.begin(), ownedCellLabels.end(), assignedCellLabels);
+				}
+
+				// (2) Build the new mesh from the mesh source with the assigned labels. Finalizing it rebuilds
+				// the cell connectivity graph and the exchange patterns of the ghost cells.
+				MeshSource<I,T,L> * source;
+				status = this->meshSourceConfig->buildMeshSource(&source, comm);
+				if(status != cupcfd::error::E_SUCCESS) {
+					free(assignedCellLabels);
+					return status;
+				}
+
+				*mesh = new M(comm);
+				status = (*mesh)->addData(*source, assignedCellLabels, nAssignedCellLabels);
+
+				if(status == cupcfd::error::E_SUCCESS) {
+					(*mesh)->reordering.type = this->reorderType;
+					status = (*mesh)->finalize();
+				}
+
+				delete source;
+				free(assignedCellLabels);
+
+				if(status != cupcfd::error::E_SUCCESS) {
+					delete *mesh;
+					*mesh = nullptr;
+					return status;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
 		}
 	}
 }
@@ -122,6 +122,23 @@ namespace cupcfd
 					
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes buildMeshSource(MeshSource<I,T,I> ** source);
+
+					/**
+					 * Build a mesh source for all processes of a communicator. This is a collective operation.
+					 *
+					 * For HDF5 files, the file is opened once across the communicator (with MPI-IO if
+					 * available) rather than independently by each process.
+					 *
+					 * @param source A pointer to where the newly created MeshSource object pointer will be stored.
+					 * @param comm The communicator of all processes that will read from the source
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_FILE_MISSING The file could not be accessed
+					 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The file format is not recognised
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes buildMeshSource(MeshSource<I,T,I> ** source, cupcfd::comm::Communicator& comm);
 			};
 		}
 	}
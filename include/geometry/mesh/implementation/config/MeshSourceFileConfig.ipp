@@ -99,6 +99,32 @@ namespace cupcfd
 
 				return cupcfd::error::E_SUCCESS;
 			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceFileConfig<I,T>::buildMeshSource(MeshSource<I,T,I> ** source, cupcfd::comm::Communicator& comm)
+			{
+				std::string filePath = this->getSourceFilePath();
+
+				// Check File is Accessible
+				std::ifstream accessTest(filePath);
+				if(!accessTest.good())
+				{
+					return cupcfd::error::E_FILE_MISSING;
+				}
+
+				if(this->getFileFormat() == cupcfd::geometry::mesh::MESH_FILE_FORMAT_HDF5)
+				{
+					// Opened once for all ranks of the communicator, and held open until the source is deleted
+					*source = new cupcfd::geometry::mesh::MeshHDF5Source<I,T>(filePath, comm);
+				}
+				else
+				{
+					// Unexpected File Format
+					return cupcfd::error::E_INVALID_FILE_FORMAT;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
 		}
 	}
 }
@@ -61,6 +61,18 @@ namespace cupcfd
 					/** Maximum spatial position in the Z dimension **/
 					T sMaxZ;
 
+					/** Whether the generated source decomposes the cells into a block per process **/
+					bool blockDecomposition;
+
+					/** Number of blocks in the X dimension of the decomposition (zero to choose automatically) **/
+					I blockX;
+
+					/** Number of blocks in the Y dimension of the decomposition (zero to choose automatically) **/
+					I blockY;
+
+					/** Number of blocks in the Z dimension of the decomposition (zero to choose automatically) **/
+					I blockZ;
+
 
 					// === Constructors/Deconstructors ===
 
@@ -312,6 +324,33 @@ namespace cupcfd
 					 */
 					inline void setSpatialMaxZ(T sMaxZ);
 
+					/**
+					 * Get whether the generated source decomposes the cells into a block per process.
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return True if the block decomposition is enabled
+					 */
+					__attribute__((warn_unused_result))
+					inline bool getBlockDecomposition();
+
+					/**
+					 * Enable the block decomposition of the generated source, so that the cells are assigned to
+					 * processes directly rather than by a partitioner.
+					 * If the block counts are all zero, they are chosen when the mesh is built to suit the number of processes.
+					 *
+					 * @param blockX Number of blocks in the X dimension
+					 * @param blockY Number of blocks in the Y dimension
+					 * @param blockZ Number of blocks in the Z dimension
+					 *
+					 * @tparam I The type of the indexing scheme/ cell labels
+					 * @tparam T The type of the stored array data
+					 *
+					 * @return Nothing
+					 */
+					inline void setBlockDecomposition(I blockX, I blockY, I blockZ);
+
 					// === Overloaded Methods ===
 
 					inline void operator=(const MeshSourceStructGenConfig<I,T>& source);
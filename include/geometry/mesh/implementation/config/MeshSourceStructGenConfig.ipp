@@ -129,6 +129,21 @@ namespace cupcfd
 				this->sMaxZ = sMaxZ;
 			}
 
+			template <class I, class T>
+			inline bool MeshSourceStructGenConfig<I,T>::getBlockDecomposition()
+			{
+				return this->blockDecomposition;
+			}
+
+			template <class I, class T>
+			inline void MeshSourceStructGenConfig<I,T>::setBlockDecomposition(I blockX, I blockY, I blockZ)
+			{
+				this->blockDecomposition = true;
+				this->blockX = blockX;
+				this->blockY = blockY;
+				this->blockZ = blockZ;
+			}
+
 			// === Overridden Inherited Methods ===
 			
 			template <class I, class T>
@@ -147,6 +162,10 @@ namespace cupcfd
 				this->sMaxX = source.sMaxX;
 				this->sMaxY = source.sMaxY;
 				this->sMaxZ = source.sMaxZ;
+				this->blockDecomposition = source.blockDecomposition;
+				this->blockX = source.blockX;
+				this->blockY = source.blockY;
+				this->blockZ = source.blockZ;
 			}
 			
 			template <class I, class T>
@@ -167,7 +186,13 @@ namespace cupcfd
 				sMinZ = this->getSpatialMinZ();
 				sMaxZ = this->getSpatialMaxZ();
 
-				*source = new cupcfd::geometry::mesh::MeshStructGenSource<I,T>(nX, nY, nZ, sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ);
+				MeshStructGenSource<I,T> * structSource = new MeshStructGenSource<I,T>(nX, nY, nZ, sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ);
+
+				if(this->getBlockDecomposition()) {
+					structSource->setBlockDecomposition(this->blockX, this->blockY, this->blockZ);
+				}
+
+				*source = structSource;
 
 				return cupcfd::error::E_SUCCESS;
 			}
@@ -119,6 +119,8 @@ namespace cupcfd
 
 					/**
 					 * Retrieve and create a dynamically allocated Partitioner Configuration
+					 * from the "Partitioner" field. It should contain one of "NaivePartitioner", "MetisPartitioner",
+					 * "ParmetisPartitioner", "SFCPartitioner" or "RCBPartitioner".
 					 */
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes getPartitionerConfig(cupcfd::partitioner::PartitionerConfig<I,I> ** partConfig);
@@ -130,6 +132,35 @@ namespace cupcfd
 					// MeshSourceConfig<I,T,L> * getMeshSourceConfig();
 					cupcfd::error::eCodes getMeshSourceConfig(MeshSourceConfig<I,T,L>** config);
 
+					/**
+					 * Retrieve the renumbering of the local cells to apply when the mesh is finalized,
+					 * from the "Reordering" field. Valid values are "None", "RCM", "Morton" and "Hilbert".
+					 *
+					 * @param reorderType A pointer to the location where the reordering type will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The "Reordering" field was not found
+					 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The "Reordering" field does not hold a valid value
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getReordering(MeshReorderType * reorderType);
+
+					/**
+					 * Retrieve the path of the checkpoint of the partitioned mesh, from the "Checkpoint" field.
+					 * The checkpoint is only reloaded if it was written by the same number of processes, so the
+					 * path should be changed (or the checkpoint removed) if the mesh source or partitioner change.
+					 *
+					 * @param checkpointPath A pointer to the location where the checkpoint path will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The "Checkpoint" field was not found
+					 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The "Checkpoint" field is not a non-empty string
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCheckpointPath(std::string * checkpointPath);
+
 					/**
 					 *
 					 */
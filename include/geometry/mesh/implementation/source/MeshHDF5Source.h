@@ -19,6 +19,9 @@
 // Parent Class
 #include "MeshSource.h"
 
+// HDF5 Interface
+#include "HDF5File.h"
+
 // Data Structures
 #include "AdjacencyListVector.h"
 #include "AdjacencyListCSR.h"
@@ -42,16 +45,35 @@ namespace cupcfd
 					// === Members ===
 					std::string fileName;
 
+					/** The open file. It is kept open for the lifetime of this object. **/
+					cupcfd::io::hdf5::HDF5File * file;
+
 					// === Constructors/Deconstructors ===
 
 					/**
 					 * Open the specified file and treat it as a HDF5 file
 					 * with a the specific HDF5 schema.
 					 *
+					 * The file is opened independently by this process.
+					 *
 					 * @param filePath The path to the file to open.
 					 */
 					MeshHDF5Source(std::string filePath);
 
+					/**
+					 * Open the specified file across all processes of a communicator and treat it
+					 * as a HDF5 file with a the specific HDF5 schema. This is a collective operation.
+					 *
+					 * If HDF5 was built with parallel support, the file is opened with the MPI-IO driver
+					 * and dataset reads are collective, so every process of the communicator must make the
+					 * same sequence of calls to this source (with empty label lists where they have nothing
+					 * to read).
+					 *
+					 * @param filePath The path to the file to open.
+					 * @param comm The communicator of all processes that will read from the file
+					 */
+					MeshHDF5Source(std::string filePath, cupcfd::comm::Communicator& comm);
+
 					/**
 					 * Deconstructor.
 					 */
@@ -95,6 +117,9 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes getAttribute(std::string attrName, double * out);
 
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getReadStatistics(unsigned long long * bytesRead, double * readTime);
+
 					// === Overloaded Inherited Virtual Methods ===
 
 					__attribute__((warn_unused_result))
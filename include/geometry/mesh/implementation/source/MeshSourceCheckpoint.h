@@ -0,0 +1,332 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the MeshSourceCheckpoint class
+ */
+
+#ifndef CUPCFD_GEOMETRY_MESH_MESH_SOURCE_CHECKPOINT_INCLUDE_H
+#define CUPCFD_GEOMETRY_MESH_MESH_SOURCE_CHECKPOINT_INCLUDE_H
+
+// C++ Library
+#include <string>
+#include <vector>
+
+// Parent Class
+#include "MeshSource.h"
+
+// HDF5 Interface
+#include "HDF5File.h"
+
+// Communicator
+#include "Communicator.h"
+
+// Data Structures
+#include "HashMap.h"
+
+namespace euc = cupcfd::geometry::euclidean;
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			/**
+			 * A mesh source that reloads a partitioned mesh from a checkpoint written by writeCheckpoint.
+			 *
+			 * The checkpoint is a HDF5 file with one dataset per mesh array. Each dataset holds the data of
+			 * every process that wrote the checkpoint, one contiguous block per process in rank order, with
+			 * the size of each block stored in the "/rank" group. Each process of the run that reloads the
+			 * checkpoint reads back the block written by the process of the same rank, so the checkpoint can
+			 * only be reloaded on the same number of processes that wrote it.
+			 *
+			 * A block holds the cells owned by the process (followed by its ghost cells), and the faces,
+			 * boundaries, vertices and regions needed to rebuild its part of the mesh. Reloading the mesh
+			 * by adding the owned cells from this source to a mesh with addData avoids both reading the full
+			 * mesh source and partitioning it again: the cell connectivity graph and its exchange patterns
+			 * are rebuilt from the faces held by each process.
+			 *
+			 * Since this source only holds the data of this process, only the components of this process can
+			 * be looked up by label, and the indexes of the label getters are positions within the block of
+			 * this process. The counts are those of the full mesh.
+			 *
+			 * Uses the same type as the indexing scheme for the labelling scheme.
+			 *
+			 * @tparam I The type of the indexing scheme
+			 * @tparam T The type of the stored mesh data
+			 */
+			template <class I, class T>
+			class MeshSourceCheckpoint : public MeshSource<I,T,I>
+			{
+				public:
+					// === Members ===
+
+					/** Path to the checkpoint file **/
+					std::string fileName;
+
+					/** Number of cells, faces, vertices, boundaries and regions in the full mesh **/
+					I nCells;
+					I nFaces;
+					I nVertices;
+					I nBoundaries;
+					I nRegions;
+
+					/** Maximum number of faces per cell in the full mesh **/
+					I nMaxFaces;
+
+					/** Number of cells owned by this process. These are the first cells of cellLabel **/
+					I nOwnedCells;
+
+					/** Bytes read from the checkpoint file by this process **/
+					unsigned long long bytesRead;
+
+					/** Time spent reading the checkpoint file by this process, in seconds **/
+					double readTime;
+
+					/** Cell Data of the owned and then ghost cells **/
+					std::vector<I> cellLabel;
+					std::vector<T> cellCenter;
+					std::vector<T> cellVolume;
+
+					/** Face labels of each owned cell, in CSR format **/
+					std::vector<I> cellFaceXAdj;
+					std::vector<I> cellFaceAdj;
+
+					/** Face Data. Boundary faces have no second cell, and non-boundary faces have no boundary (-1) **/
+					std::vector<I> faceLabel;
+					std::vector<I> faceIsBoundary;
+					std::vector<I> faceCell1;
+					std::vector<I> faceCell2;
+					std::vector<I> faceBoundary;
+					std::vector<T> faceLambda;
+					std::vector<T> faceArea;
+					std::vector<T> faceCenter;
+					std::vector<T> faceNormal;
+
+					/** Vertex labels of each face, in CSR format **/
+					std::vector<I> faceVertexXAdj;
+					std::vector<I> faceVertexAdj;
+
+					/** Boundary Data **/
+					std::vector<I> boundaryLabel;
+					std::vector<I> boundaryFace;
+					std::vector<I> boundaryRegion;
+					std::vector<T> boundaryDistance;
+
+					/** Vertex labels of each boundary, in CSR format **/
+					std::vector<I> boundaryVertexXAdj;
+					std::vector<I> boundaryVertexAdj;
+
+					/** Vertex Data **/
+					std::vector<I> vertexLabel;
+					std::vector<T> vertexCoords;
+
+					/** Region Data **/
+					std::vector<I> regionLabel;
+
+					/** Map from the labels of the components held by this process to their position in the arrays above **/
+					cupcfd::data_structures::IndexMap<I,I> cellLabelToIndex;
+					cupcfd::data_structures::IndexMap<I,I> faceLabelToIndex;
+					cupcfd::data_structures::IndexMap<I,I> boundaryLabelToIndex;
+					cupcfd::data_structures::IndexMap<I,I> vertexLabelToIndex;
+
+					// === Constructors/Deconstructors ===
+
+					/**
+					 * Read the block of this process from a checkpoint file.
+					 * This is a collective operation over comm, which must have the same number of processes as the
+					 * communicator of the mesh the checkpoint was written from.
+					 *
+					 * The whole block is read when the source is constructed, with a single read of each dataset,
+					 * so the file is not held open.
+					 *
+					 * @param filePath The path to the checkpoint file
+					 * @param comm The communicator of all processes reloading the mesh
+					 */
+					MeshSourceCheckpoint(std::string filePath, cupcfd::comm::Communicator& comm);
+
+					/**
+					 * Deconstructor.
+					 */
+					~MeshSourceCheckpoint();
+
+					// === Concrete Methods ===
+
+					/**
+					 * Write a finalized mesh to a checkpoint file that can be reloaded with this source.
+					 * This is a collective operation over the communicator of the mesh.
+					 *
+					 * @param mesh The mesh to write
+					 * @param filePath The path of the checkpoint file. Any existing file is replaced.
+					 *
+					 * @tparam M The type of the implementing class for the UnstructuredMeshInterface type.
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_UNFINALIZED The mesh has not been finalized
+					 * @retval cupcfd::error::E_HDF5_ERROR The checkpoint could not be written on one or more processes
+					 */
+					template <class M>
+					__attribute__((warn_unused_result))
+					static cupcfd::error::eCodes writeCheckpoint(M& mesh, std::string filePath);
+
+					/**
+					 * Get the number of processes that wrote a checkpoint file.
+					 *
+					 * @param filePath The path to the checkpoint file
+					 * @param nRanks A pointer to where the number of processes will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_FILE_MISSING The file does not exist
+					 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The checkpoint was not completely written
+					 */
+					__attribute__((warn_unused_result))
+					static cupcfd::error::eCodes getCheckpointRankCount(std::string filePath, int * nRanks);
+
+					/**
+					 * Get the global number of cells and faces of the mesh a checkpoint file was written from,
+					 * so that the checkpoint can be matched against the mesh source.
+					 *
+					 * @param filePath The path to the checkpoint file
+					 * @param nCells A pointer to where the number of cells will be stored
+					 * @param nFaces A pointer to where the number of faces will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_FILE_MISSING The file does not exist
+					 * @retval cupcfd::error::E_INVALID_FILE_FORMAT The checkpoint was not completely written
+					 */
+					__attribute__((warn_unused_result))
+					static cupcfd::error::eCodes getCheckpointMeshSize(std::string filePath, int * nCells, int * nFaces);
+
+					/**
+					 * Get the labels of the cells owned by this process when the checkpoint was written.
+					 *
+					 * @param labels A pointer to where the pointer to a newly allocated array of labels will be stored.
+					 * The array should be freed by the caller.
+					 * @param nLabels A pointer to where the number of labels will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getOwnedCellLabels(I ** labels, I * nLabels);
+
+					/**
+					 * Get the number of bytes read from the checkpoint file by this process, and the time taken to read them.
+					 *
+					 * @param bytesRead A pointer to where the number of bytes read will be stored
+					 * @param readTime A pointer to where the read time (in seconds) will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getReadStatistics(unsigned long long * bytesRead, double * readTime);
+
+					// === Overloaded Inherited Virtual Methods ===
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellLabels(I * labels, I nLabels, I * indexes, I nIndexes);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceLabels(I * labels, I nLabels, I * indexes, I nIndexes);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getVertexLabels(I * labels, I nLabels, I * indexes, I nIndexes);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryLabels(I * labels, I nLabels, I * indexes, I nIndexes);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getRegionLabels(I * labels, I nLabels, I * indexes, I nIndexes);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellCount(I * cellCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceCount(I * faceCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryCount(I * boundaryCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getRegionCount(I * regionCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getVertexCount(I * vertexCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getMaxFaceCount(I * maxFaceCount);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getMaxVertexCount(I * maxVertexCount);
+
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellNFaces(I * nFaces, I nNFaces, I * cellLabels, I nCellLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellVolume(T * cellVol, I nCellVol, I * cellLabels, I nCellLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellCenter(euc::EuclideanPoint<T,3> * cellCenter, I nCellCenter, I * cellLabels, I nCellLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellFaceLabels(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData, I * cellLabels, I nCellLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceIsBoundary(bool * isBoundary, I nIsBoundary, I * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceNVertices(I * nVertices, I nNVertices, I * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceBoundaryLabels(I * faceBoundaryLabels, I nFaceBoundaryLabels, I * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceCell1Labels(I * faceCell1Labels, I nFaceCell1Labels, I * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceCell2Labels(I * faceCell2Labels, I nFaceCell2Labels, I * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceLambda(T * faceLambda, I nFaceLambda, I * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceArea(T * faceArea, I nFaceArea, I * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceNormal(euc::EuclideanVector<T,3> * faceNormal, I nFaceNormal, I * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceCenter(euc::EuclideanPoint<T,3> * faceCenter, I nFaceCenter, I * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getFaceVerticesLabelsCSR(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData,  I * faceLabels, I nFaceLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getVertexCoords(euc::EuclideanPoint<T,3> * vertCoords, I nVertCoords, I * vertexLabels, I nVertexLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryFaceLabels(I * boundaryFaceLabels, I nBoundaryFaceLabels, I * boundaryLabels, I nBoundaryLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryNVertices(I * nVertices, I nNVertices, I * boundaryLabels, I nBoundaryLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryRegionLabels(I * boundaryRegionLabels, I nBoundaryRegionLabels, I * boundaryLabels, I nBoundaryLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryVerticesLabelsCSR(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData,  I * boundaryLabels, I nBoundaryLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBoundaryDistance(T * boundaryDistance, I nBoundaryDistance, I * boundaryLabels, I nBoundaryLabels);
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getRegionName(std::string * names, I nNames, I * regionLabels, I nRegionLabels);
+
+				private:
+					/**
+					 * Find the vertex labels of a face or boundary.
+					 *
+					 * The mesh build looks up the vertices of a boundary through the face with the same label
+					 * as the boundary, which may be a face held by another process. If there is no face with
+					 * the label held by this process, the vertices of the boundary with the label are used
+					 * instead, since these were copied from that face when the mesh was built.
+					 *
+					 * @param label The label of the face
+					 * @param vertices A pointer to where a pointer to the first vertex label will be stored
+					 * @param nVertices A pointer to where the number of vertices will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_MESH_INVALID_FACE_LABEL Neither a face or boundary of this label is held by this process
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes findFaceVertices(I label, const I ** vertices, I * nVertices);
+			};
+		} // namespace mesh
+	} // namespace geometry
+} // namespace cupcfd
+
+// Include Header Level Definitions
+#include "MeshSourceCheckpoint.ipp"
+
+#endif
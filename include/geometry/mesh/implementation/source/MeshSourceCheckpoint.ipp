@@ -0,0 +1,243 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Header Level Definitions for the MeshSourceCheckpoint class
+ */
+
+#ifndef CUPCFD_GEOMETRY_MESH_MESH_SOURCE_CHECKPOINT_IPP_H
+#define CUPCFD_GEOMETRY_MESH_MESH_SOURCE_CHECKPOINT_IPP_H
+
+#include "HDF5Writer.h"
+#include "ArrayDrivers.h"
+#include "EuclideanVector3D.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T>
+			template <class M>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::writeCheckpoint(M& mesh, std::string filePath) {
+				if(!mesh.finalized) {
+					return cupcfd::error::E_UNFINALIZED;
+				}
+
+				cupcfd::comm::Communicator& comm = *(mesh.cellConnGraph->comm);
+
+				I nOwnedCells = mesh.properties.lOCells;
+				I nLCells = mesh.properties.lTCells;
+				I nLFaces = mesh.properties.lFaces;
+				I nLBoundaries = mesh.properties.lBoundaries;
+				I nLVertices = mesh.properties.lVertices;
+				I nLRegions = mesh.properties.lRegions;
+
+				// (1) Recover the build labels of each component from their local IDs
+				std::vector<I> cellLabel(nLCells);
+				for(auto iter = mesh.cellBuildIDToLocalID.begin(); iter != mesh.cellBuildIDToLocalID.end(); iter++) {
+					cellLabel[iter->second] = iter->first;
+				}
+
+				std::vector<I> faceLabel(nLFaces);
+				for(auto iter = mesh.faceBuildIDToLocalID.begin(); iter != mesh.faceBuildIDToLocalID.end(); iter++) {
+					faceLabel[iter->second] = iter->first;
+				}
+
+				std::vector<I> boundaryLabel(nLBoundaries);
+				for(auto iter = mesh.boundaryBuildIDToLocalID.begin(); iter != mesh.boundaryBuildIDToLocalID.end(); iter++) {
+					boundaryLabel[iter->second] = iter->first;
+				}
+
+				std::vector<I> vertexLabel(nLVertices);
+				for(auto iter = mesh.vertexBuildIDToLocalID.begin(); iter != mesh.vertexBuildIDToLocalID.end(); iter++) {
+					vertexLabel[iter->second] = iter->first;
+				}
+
+				std::vector<I> regionLabel(nLRegions);
+				for(auto iter = mesh.regionBuildIDToLocalID.begin(); iter != mesh.regionBuildIDToLocalID.end(); iter++) {
+					regionLabel[iter->second] = iter->first;
+				}
+
+				// (2) Cell Data. The owned cells have the lowest local IDs, so are written first.
+				std::vector<T> cellCenter(nLCells * 3);
+				std::vector<T> cellVolume(nLCells);
+				for(I i = 0; i < nLCells; i++) {
+					euc::EuclideanPoint<T,3> center;
+					mesh.getCellCenter(i, center);
+					cellCenter[i * 3] = center.cmp[0];
+					cellCenter[i * 3 + 1] = center.cmp[1];
+					cellCenter[i * 3 + 2] = center.cmp[2];
+					cellVolume[i] = mesh.getCellVolume(i);
+				}
+
+				// Only the owned cells are guaranteed to store all of their faces
+				std::vector<I> cellNFaces(nOwnedCells);
+				std::vector<I> cellFaces;
+				for(I i = 0; i < nOwnedCells; i++) {
+					cellNFaces[i] = mesh.getCellNFaces(i);
+					for(I j = 0; j < cellNFaces[i]; j++) {
+						cellFaces.push_back(faceLabel[mesh.getCellFaceID(i, j)]);
+					}
+				}
+
+				// (3) Face Data
+				std::vector<I> faceIsBoundary(nLFaces);
+				std::vector<I> faceCell1(nLFaces);
+				std::vector<I> faceCell2(nLFaces);
+				std::vector<I> faceBoundary(nLFaces);
+				std::vector<T> faceLambda(nLFaces);
+				std::vector<T> faceArea(nLFaces);
+				std::vector<T> faceCenter(nLFaces * 3);
+				std::vector<T> faceNormal(nLFaces * 3);
+				std::vector<I> faceNVertices(nLFaces);
+				std::vector<I> faceVertices;
+
+				for(I i = 0; i < nLFaces; i++) {
+					faceCell1[i] = cellLabel[mesh.getFaceCell1ID(i)];
+
+					faceIsBoundary[i] = mesh.getFaceIsBoundary(i) ? 1 : 0;
+
+					if(faceIsBoundary[i] != 0) {
+						faceCell2[i] = I(-1);
+						faceBoundary[i] = boundaryLabel[mesh.getFaceBoundaryID(i)];
+					}
+					else {
+						faceCell2[i] = cellLabel[mesh.getFaceCell2ID(i)];
+						faceBoundary[i] = I(-1);
+					}
+
+					faceLambda[i] = mesh.getFaceLambda(i);
+					faceArea[i] = mesh.getFaceArea(i);
+
+					euc::EuclideanPoint<T,3> center;
+					mesh.getFaceCenter(i, center);
+					euc::EuclideanVector3D<T> norm = mesh.getFaceNorm(i);
+
+					for(I j = 0; j < 3; j++) {
+						faceCenter[i * 3 + j] = center.cmp[j];
+						faceNormal[i * 3 + j] = norm.cmp[j];
+					}
+
+					faceNVertices[i] = mesh.getFaceNVertices(i);
+					for(I j = 0; j < faceNVertices[i]; j++) {
+						faceVertices.push_back(vertexLabel[mesh.getFaceVertex(i, j)]);
+					}
+				}
+
+				// (4) Boundary Data
+				std::vector<I> boundaryFace(nLBoundaries);
+				std::vector<I> boundaryRegion(nLBoundaries);
+				std::vector<T> boundaryDistance(nLBoundaries);
+				std::vector<I> boundaryNVertices(nLBoundaries);
+				std::vector<I> boundaryVertices;
+
+				for(I i = 0; i < nLBoundaries; i++) {
+					I faceID = mesh.getBoundaryFaceID(i);
+					boundaryFace[i] = (faceID < 0) ? I(-1) : faceLabel[faceID];
+					boundaryRegion[i] = regionLabel[mesh.getBoundaryRegionID(i)];
+					boundaryDistance[i] = mesh.getBoundaryDistance(i);
+
+					// Boundaries store up to four vertices, with any unused entries set to -1
+					boundaryNVertices[i] = 0;
+					for(I j = 0; j < 4; j++) {
+						I vertexID = mesh.getBoundaryVertex(i, j);
+						if(vertexID < 0) {
+							break;
+						}
+
+						boundaryVertices.push_back(vertexLabel[vertexID]);
+						boundaryNVertices[i] = boundaryNVertices[i] + 1;
+					}
+				}
+
+				// (5) Vertex Data
+				std::vector<T> vertexCoords(nLVertices * 3);
+				for(I i = 0; i < nLVertices; i++) {
+					euc::EuclideanPoint<T,3> pos;
+					mesh.getVertexPos(i, pos);
+					vertexCoords[i * 3] = pos.cmp[0];
+					vertexCoords[i * 3 + 1] = pos.cmp[1];
+					vertexCoords[i * 3 + 2] = pos.cmp[2];
+				}
+
+				// (6) Write, one dataset per array, with the size of the block of each process stored in "/rank"
+				// Each write is agreed across the processes, and does nothing once one has failed, so the status of
+				// the writer only needs to be checked before the checkpoint is marked as complete
+				cupcfd::io::hdf5::HDF5Writer writer(filePath, comm.comm);
+
+				if(writer.status != cupcfd::error::E_SUCCESS) {
+					return writer.status;
+				}
+
+				writer.writeAttribute("ncells", mesh.properties.nCells);
+				writer.writeAttribute("nfaces", mesh.properties.nFaces);
+				writer.writeAttribute("nvertices", mesh.properties.nVertices);
+				writer.writeAttribute("nboundaries", mesh.properties.nBoundaries);
+				// Every process loads all of the regions, so the local count is also the global count
+				writer.writeAttribute("nregions", nLRegions);
+				writer.writeAttribute("maxfaces", mesh.properties.nMaxFaces);
+
+				I nCellFaces = cupcfd::utility::drivers::safeConvertSizeT<I>(cellFaces.size());
+				I nFaceVertices = cupcfd::utility::drivers::safeConvertSizeT<I>(faceVertices.size());
+				I nBoundaryVertices = cupcfd::utility::drivers::safeConvertSizeT<I>(boundaryVertices.size());
+
+				writer.writeDataSet("/rank", "nownedcells", &nOwnedCells, 1, 1);
+				writer.writeDataSet("/rank", "ncells", &nLCells, 1, 1);
+				writer.writeDataSet("/rank", "ncellfaces", &nCellFaces, 1, 1);
+				writer.writeDataSet("/rank", "nfaces", &nLFaces, 1, 1);
+				writer.writeDataSet("/rank", "nfacevertices", &nFaceVertices, 1, 1);
+				writer.writeDataSet("/rank", "nboundaries", &nLBoundaries, 1, 1);
+				writer.writeDataSet("/rank", "nboundaryvertices", &nBoundaryVertices, 1, 1);
+				writer.writeDataSet("/rank", "nvertices", &nLVertices, 1, 1);
+				writer.writeDataSet("/rank", "nregions", &nLRegions, 1, 1);
+
+				writer.writeDataSet("/cell", "label", cellLabel.data(), nLCells, 1);
+				writer.writeDataSet("/cell", "center", cellCenter.data(), nLCells, 3);
+				writer.writeDataSet("/cell", "vol", cellVolume.data(), nLCells, 1);
+				writer.writeDataSet("/cell", "nfaces", cellNFaces.data(), nOwnedCells, 1);
+				writer.writeDataSet("/cell", "cface", cellFaces.data(), nCellFaces, 1);
+
+				writer.writeDataSet("/face", "label", faceLabel.data(), nLFaces, 1);
+				writer.writeDataSet("/face", "isbnd", faceIsBoundary.data(), nLFaces, 1);
+				writer.writeDataSet("/face", "cell1", faceCell1.data(), nLFaces, 1);
+				writer.writeDataSet("/face", "cell2", faceCell2.data(), nLFaces, 1);
+				writer.writeDataSet("/face", "bnd", faceBoundary.data(), nLFaces, 1);
+				writer.writeDataSet("/face", "lambda", faceLambda.data(), nLFaces, 1);
+				writer.writeDataSet("/face", "area", faceArea.data(), nLFaces, 1);
+				writer.writeDataSet("/face", "center", faceCenter.data(), nLFaces, 3);
+				writer.writeDataSet("/face", "norm", faceNormal.data(), nLFaces, 3);
+				writer.writeDataSet("/face", "nvertices", faceNVertices.data(), nLFaces, 1);
+				writer.writeDataSet("/face", "vertices", faceVertices.data(), nFaceVertices, 1);
+
+				writer.writeDataSet("/boundary", "label", boundaryLabel.data(), nLBoundaries, 1);
+				writer.writeDataSet("/boundary", "face", boundaryFace.data(), nLBoundaries, 1);
+				writer.writeDataSet("/boundary", "region", boundaryRegion.data(), nLBoundaries, 1);
+				writer.writeDataSet("/boundary", "distance", boundaryDistance.data(), nLBoundaries, 1);
+				writer.writeDataSet("/boundary", "nvertices", boundaryNVertices.data(), nLBoundaries, 1);
+				writer.writeDataSet("/boundary", "vertices", boundaryVertices.data(), nBoundaryVertices, 1);
+
+				writer.writeDataSet("/vert", "label", vertexLabel.data(), nLVertices, 1);
+				writer.writeDataSet("/vert", "coords", vertexCoords.data(), nLVertices, 3);
+
+				writer.writeDataSet("/region", "label", regionLabel.data(), nLRegions, 1);
+
+				// The rank count is written last and marks the checkpoint as complete, so a checkpoint
+				// left partially written by a failed run is never reloaded
+				if(writer.status != cupcfd::error::E_SUCCESS) {
+					return writer.status;
+				}
+
+				return writer.writeAttribute("nranks", comm.size);
+			}
+		}
+	}
+}
+
+#endif
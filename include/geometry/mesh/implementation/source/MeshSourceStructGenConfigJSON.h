@@ -127,6 +127,24 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes getMeshSpatialZMax(T * sMaxZ);
 
+					/**
+					 * Get the block decomposition of the generated mesh across processes from the "BlockDecomposition" field.
+					 * The field is either a boolean, where true chooses the number of blocks automatically, or an object
+					 * with the number of blocks in each dimension in its "BlockX", "BlockY" and "BlockZ" fields.
+					 *
+					 * @param enabled A pointer to where whether the block decomposition is enabled will be stored
+					 * @param blockX A pointer to where the number of blocks in the X dimension will be stored (zero if automatic)
+					 * @param blockY A pointer to where the number of blocks in the Y dimension will be stored (zero if automatic)
+					 * @param blockZ A pointer to where the number of blocks in the Z dimension will be stored (zero if automatic)
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The field was not found
+					 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The field is not a boolean, or an object with three positive block counts
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getMeshBlockDecomposition(bool * enabled, I * blockX, I * blockY, I * blockZ);
+
 					/**
 					 *
 					 */
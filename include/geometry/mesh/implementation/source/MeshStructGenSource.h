@@ -46,6 +46,11 @@ namespace cupcfd
 			 * The positional coordinates used for these are node center and face center respectively.
 			 *
 			 * Uses the same type as the indexing scheme for the labelling scheme.
+			 *
+			 * If a block decomposition is enabled, the source can also assign the cells to processes itself
+			 * by dividing the grid into pX x pY x pZ blocks, one per process. The cells of a block, and the
+			 * neighbours of each cell, are computed from the cell coordinates, so no global structures are
+			 * built and no partitioner is needed.
 			 */
 			template <class I, class T>
 			class MeshStructGenSource : public MeshSource<I,T,I>
@@ -89,6 +94,18 @@ namespace cupcfd
 					/** Z Spatial Divisions **/
 					T dSz;
 
+					/** Whether this source decomposes the cells across processes into blocks **/
+					bool blockDecomposition;
+
+					/** The number of blocks in the X dimension of the decomposition. Zero if chosen automatically. **/
+					I pX;
+
+					/** The number of blocks in the Y dimension of the decomposition. Zero if chosen automatically. **/
+					I pY;
+
+					/** The number of blocks in the Z dimension of the decomposition. Zero if chosen automatically. **/
+					I pZ;
+
 					// === Constructors/Deconstructors ===
 
 					/**
@@ -175,8 +192,75 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					I calculateZCoord(I label, I xMin, I xMax, I yMin, I yMax, I zMin, I zMax);
 
+					/**
+					 * Enable the block decomposition of the grid across processes.
+					 *
+					 * If pX, pY and pZ are all zero, the number of blocks in each dimension is chosen when
+					 * the decomposition is requested, to minimise the number of faces between blocks.
+					 *
+					 * @param pX The number of blocks in the X dimension
+					 * @param pY The number of blocks in the Y dimension
+					 * @param pZ The number of blocks in the Z dimension
+					 *
+					 * @return Nothing
+					 */
+					void setBlockDecomposition(I pX, I pY, I pZ);
+
+					/**
+					 * Get the number of blocks in each dimension of the decomposition across a number of processes.
+					 *
+					 * @param nRanks The number of processes, one per block
+					 * @param pX A pointer to where the number of blocks in the X dimension will be stored
+					 * @param pY A pointer to where the number of blocks in the Y dimension will be stored
+					 * @param pZ A pointer to where the number of blocks in the Z dimension will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The set block counts do not multiply to nRanks, or the
+					 * grid cannot be divided into nRanks non-empty blocks
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getBlockGrid(I nRanks, I * pX, I * pY, I * pZ);
+
+					/**
+					 * Get the range of cell coordinates of a block in one dimension.
+					 * Any remainder of cells is spread across the lowest blocks.
+					 *
+					 * @param block The block coordinate in this dimension
+					 * @param nBlocks The number of blocks in this dimension
+					 * @param nCells The number of cells in this dimension
+					 * @param start A pointer to where the first cell coordinate of the block will be stored
+					 * @param end A pointer to where one past the last cell coordinate of the block will be stored
+					 *
+					 * @return Nothing
+					 */
+					void getBlockRange(I block, I nBlocks, I nCells, I * start, I * end);
+
 					// === Overloaded Inherited Virtual Methods ===
 
+					using MeshSource<I,T,I>::buildDistributedAdjacencyList;
+
+					/**
+					 * Build the connectivity graph of the provided cells.
+					 * The neighbours of each cell are computed from its coordinates, rather than looked up through its faces.
+					 *
+					 * @copydoc MeshSource::buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,I>&, L*, I)
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,I>& graph,
+																		I * cellLabels, I nCellLabels);
+
+					/**
+					 * Get the labels of the cells in the block of this process.
+					 * The labels are in ascending order.
+					 *
+					 * @copydoc MeshSource::getCellDecomposition
+					 * @retval cupcfd::error::E_NOT_IMPLEMENTED The block decomposition is not enabled
+					 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The grid cannot be divided into a block per process
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes getCellDecomposition(I ** cellLabels, I * nCellLabels, cupcfd::comm::Communicator& comm);
+
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes getCellLabels(I * labels, I nLabels, I * indexes, I nIndexes);
 					__attribute__((warn_unused_result))
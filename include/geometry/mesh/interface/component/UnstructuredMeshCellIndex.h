@@ -0,0 +1,182 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Declarations for the UnstructuredMeshCellIndex Class
+ */
+
+#ifndef CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_CELL_INDEX_INCLUDE_H
+#define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_CELL_INDEX_INCLUDE_H
+
+#include "Error.h"
+#include "EuclideanPoint.h"
+
+namespace euc = cupcfd::geometry::euclidean;
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			/**
+			 * Per-rank spatial index over the axis-aligned bounding boxes of the locally owned cells
+			 * of an unstructured mesh.
+			 *
+			 * The bounds of all indexed cells are divided into a uniform grid of bins, with the number
+			 * of bins chosen such that there is approximately one cell per bin. Each bin stores (in CSR
+			 * format) the IDs of the cells whose bounding box overlaps it, in ascending order.
+			 *
+			 * Locating the cell that contains a point therefore only requires testing the few cells stored in
+			 * the bin that contains the point, rather than every local cell. Lookups do not allocate memory.
+			 *
+			 * @tparam I Type of mesh index scheme
+			 * @tparam T Type of mesh euclidean space
+			 */
+			template <class I, class T>
+			class UnstructuredMeshCellIndex
+			{
+				public:
+					// === Members ===
+
+					/** Whether the index has been built **/
+					bool built;
+
+					/** Number of indexed cells **/
+					I nCells;
+
+					/** Lower corner of the bounds of all indexed cells **/
+					T lower[3];
+
+					/** Upper corner of the bounds of all indexed cells **/
+					T upper[3];
+
+					/** Number of bins in each dimension **/
+					I nBins[3];
+
+					/** Number of bins per unit length in each dimension **/
+					T binScale[3];
+
+					/** Bounding box of each cell, stored as (xmin, ymin, zmin, xmax, ymax, zmax) **/
+					T * cellBounds;
+
+					/** Size of cellBounds **/
+					I nCellBounds;
+
+					/** Offset of the first cell ID of each bin in binCells (size number of bins + 1) **/
+					I * binXAdj;
+
+					/** Size of binXAdj **/
+					I nBinXAdj;
+
+					/** Cell IDs stored in each bin, grouped by bin **/
+					I * binCells;
+
+					/** Size of binCells **/
+					I nBinCells;
+
+					// === Constructor/Deconstructors ===
+
+					/**
+					 * Default constructor. Sets up an empty, unbuilt, index.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 */
+					UnstructuredMeshCellIndex();
+
+					/**
+					 * Deconstructor. Cleans up internally allocated arrays.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 */
+					~UnstructuredMeshCellIndex();
+
+					// === Concrete Methods ===
+
+					/**
+					 * Free any internal arrays and return the index to the unbuilt state.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return Nothing
+					 */
+					void reset();
+
+					/**
+					 * Build the index from the bounding boxes of a set of cells.
+					 * Any existing index is discarded.
+					 *
+					 * The cell ID of each box is its position in the provided array.
+					 *
+					 * @param bounds The bounding box of each cell, stored as (xmin, ymin, zmin, xmax, ymax, zmax)
+					 * @param nBounds The size of bounds. Must be a multiple of 6.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH nBounds is not a multiple of 6
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes build(const T * bounds, I nBounds);
+
+					/**
+					 * Retrieve the IDs of the cells whose bounding box overlaps the bin containing the point.
+					 *
+					 * The cell that contains the point, if any, is guaranteed to be within the candidates,
+					 * but the candidates may also contain cells that do not contain the point.
+					 *
+					 * @param point The point to find candidate cells for
+					 * @param cells A pointer that will be set to point to the candidate cell IDs, in ascending order.
+					 * This points to internal storage, and should not be freed.
+					 * @param nCandidates A pointer to the location to store the number of candidate cells.
+					 * This is zero if the point lies outside of the bounds of all indexed cells.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return Nothing
+					 */
+					inline void getCandidateCells(const euc::EuclideanPoint<T,3>& point, const I ** cells, I * nCandidates);
+
+					/**
+					 * Test whether a point lies within (or on) the bounding box of an indexed cell.
+					 *
+					 * @param cellID The ID of the cell
+					 * @param point The point to test
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return Whether the point is within the bounding box of the cell
+					 */
+					inline bool isPointInCellBounds(I cellID, const euc::EuclideanPoint<T,3>& point);
+
+				private:
+					/**
+					 * Compute the bin index of a coordinate in a dimension, clamped to the valid bin range.
+					 *
+					 * @param dim The dimension (0 to 2)
+					 * @param x The coordinate
+					 *
+					 * @return The bin index in that dimension
+					 */
+					inline I getBinCoord(int dim, T x);
+			};
+		}
+	}
+}
+
+// Include Header Level Definitions
+#include "UnstructuredMeshCellIndex.ipp"
+
+#endif
@@ -0,0 +1,73 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Header Level Definitions for the UnstructuredMeshCellIndex Class
+ */
+
+#ifndef CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_CELL_INDEX_IPP_H
+#define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_CELL_INDEX_IPP_H
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T>
+			inline I UnstructuredMeshCellIndex<I,T>::getBinCoord(int dim, T x) {
+				I bin = (I) ((x - this->lower[dim]) * this->binScale[dim]);
+
+				if(bin < 0) {
+					return 0;
+				}
+
+				if(bin >= this->nBins[dim]) {
+					return this->nBins[dim] - 1;
+				}
+
+				return bin;
+			}
+
+			template <class I, class T>
+			inline void UnstructuredMeshCellIndex<I,T>::getCandidateCells(const euc::EuclideanPoint<T,3>& point,
+																		   const I ** cells, I * nCandidates) {
+				*nCandidates = 0;
+
+				if(!this->built || this->nCells == 0) {
+					return;
+				}
+
+				// Points outside the bounds of all cells cannot be inside any cell
+				for(int d = 0; d < 3; d++) {
+					if(point.cmp[d] < this->lower[d] || point.cmp[d] > this->upper[d]) {
+						return;
+					}
+				}
+
+				I bin = (((this->getBinCoord(2, point.cmp[2]) * this->nBins[1])
+						 + this->getBinCoord(1, point.cmp[1])) * this->nBins[0])
+						 + this->getBinCoord(0, point.cmp[0]);
+
+				*cells = this->binCells + this->binXAdj[bin];
+				*nCandidates = this->binXAdj[bin + 1] - this->binXAdj[bin];
+			}
+
+			template <class I, class T>
+			inline bool UnstructuredMeshCellIndex<I,T>::isPointInCellBounds(I cellID, const euc::EuclideanPoint<T,3>& point) {
+				const T * bounds = this->cellBounds + (cellID * 6);
+
+				return (point.cmp[0] >= bounds[0] && point.cmp[0] <= bounds[3] &&
+						point.cmp[1] >= bounds[1] && point.cmp[1] <= bounds[4] &&
+						point.cmp[2] >= bounds[2] && point.cmp[2] <= bounds[5]);
+			}
+		}
+	}
+}
+
+#endif
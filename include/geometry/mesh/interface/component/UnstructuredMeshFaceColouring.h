@@ -0,0 +1,109 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Declarations for the UnstructuredMeshFaceColouring Class
+ */
+
+#ifndef CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_FACE_COLOURING_INCLUDE_H
+#define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_FACE_COLOURING_INCLUDE_H
+
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			/**
+			 * Stores a colouring of the local faces of an unstructured mesh, such that no two faces of the
+			 * same colour share a cell (including ghost cells).
+			 *
+			 * Face loops that scatter results into both of the cells of a face can therefore process all of
+			 * the faces of a single colour concurrently without write conflicts, provided the colours themselves
+			 * are processed one after another.
+			 *
+			 * The faces are stored grouped by colour in CSR format, and in ascending local face ID within a colour.
+			 *
+			 * This class only stores the data - it is populated by UnstructuredMeshInterface::buildFaceColouring.
+			 *
+			 * @tparam I Type of mesh index scheme
+			 */
+			template <class I>
+			class UnstructuredMeshFaceColouring
+			{
+				public:
+					// === Members ===
+
+					/** Whether the colouring has been populated **/
+					bool built;
+
+					/** Number of colours **/
+					I nColours;
+
+					/** Offset of the first face of each colour in colourFaces (size number of colours + 1) **/
+					I * colourXAdj;
+
+					/** Size of colourXAdj **/
+					I nColourXAdj;
+
+					/** Local face IDs, grouped by colour **/
+					I * colourFaces;
+
+					/** Size of colourFaces **/
+					I nColourFaces;
+
+					// === Constructor/Deconstructors ===
+
+					/**
+					 * Default constructor. Sets up an empty, unbuilt, colouring.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 */
+					UnstructuredMeshFaceColouring();
+
+					/**
+					 * Deconstructor. Cleans up internally allocated arrays.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 */
+					~UnstructuredMeshFaceColouring();
+
+					// === Concrete Methods ===
+
+					/**
+					 * Free any internal arrays and return the colouring to the unbuilt state.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 *
+					 * @return Nothing
+					 */
+					void reset();
+
+					/**
+					 * Discard any existing data and allocate the arrays for the provided number of faces and colours.
+					 * The contents of the arrays are left unset.
+					 *
+					 * @param nFaces The number of faces to store
+					 * @param nColours The number of colours
+					 *
+					 * @tparam I Type of mesh index scheme
+					 *
+					 * @return Nothing
+					 */
+					void allocate(I nFaces, I nColours);
+			};
+		}
+	}
+}
+
+// Include Header Level Definitions
+#include "UnstructuredMeshFaceColouring.ipp"
+
+#endif
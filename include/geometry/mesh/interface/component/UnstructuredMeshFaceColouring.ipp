@@ -0,0 +1,28 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Header Level Definitions for the UnstructuredMeshFaceColouring Class
+ */
+
+#ifndef CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_FACE_COLOURING_IPP_H
+#define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_FACE_COLOURING_IPP_H
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			// Currently nothing included here.
+			// Left as a placeholder.
+		}
+	}
+}
+
+#endif
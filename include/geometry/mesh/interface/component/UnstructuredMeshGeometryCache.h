@@ -0,0 +1,129 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Declarations for the UnstructuredMeshGeometryCache Class
+ */
+
+#ifndef CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_GEOMETRY_CACHE_INCLUDE_H
+#define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_GEOMETRY_CACHE_INCLUDE_H
+
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			/**
+			 * Stores geometric invariants of a static unstructured mesh that are otherwise recomputed
+			 * from the vertex positions on every access, such as when tracking particles through cells.
+			 *
+			 * The data is stored in flat arrays indexed by the local cell/face IDs of the mesh:
+			 * (a) The diameter (maximum inter-vertex distance) of each locally owned cell
+			 * (b) The vertex positions of the triangle fan of each local face, in CSR format
+			 * (c) The unit normal and first edge length of the plane of the first triangle of each face
+			 *
+			 * This class only stores the data - it is populated by UnstructuredMeshInterface::buildGeometryCache.
+			 *
+			 * @tparam I Type of mesh index scheme
+			 * @tparam T Type of mesh euclidean space
+			 */
+			template <class I, class T>
+			class UnstructuredMeshGeometryCache
+			{
+				public:
+					// === Members ===
+
+					/** Whether the cache has been populated **/
+					bool built;
+
+					/** Diameter of each locally owned cell **/
+					T * cellDiameter;
+
+					/** Size of cellDiameter **/
+					I nCellDiameter;
+
+					/** Offset of the first triangle of each face (size number of faces + 1) **/
+					I * faceTriXAdj;
+
+					/** Size of faceTriXAdj **/
+					I nFaceTriXAdj;
+
+					/** Vertex positions of each triangle, stored as 3 vertices of (x, y, z) per triangle **/
+					T * triVertices;
+
+					/** Size of triVertices **/
+					I nTriVertices;
+
+					/** Unit normal of the plane of the first triangle of each face, stored as (x, y, z) **/
+					T * faceNormalUnit;
+
+					/** Size of faceNormalUnit **/
+					I nFaceNormalUnit;
+
+					/** Length of the first edge of each face, used to scale plane tolerances **/
+					T * faceEdgeLength;
+
+					/** Size of faceEdgeLength **/
+					I nFaceEdgeLength;
+
+					// === Constructor/Deconstructors ===
+
+					/**
+					 * Default constructor. Sets up an empty, unbuilt, cache.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 */
+					UnstructuredMeshGeometryCache();
+
+					/**
+					 * Deconstructor. Cleans up internally allocated arrays.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 */
+					~UnstructuredMeshGeometryCache();
+
+					// === Concrete Methods ===
+
+					/**
+					 * Free any internal arrays and return the cache to the unbuilt state.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return Nothing
+					 */
+					void reset();
+
+					/**
+					 * Discard any existing data and allocate the arrays for a mesh of the provided size.
+					 * The contents of the arrays are left unset.
+					 *
+					 * @param nCells The number of cells to store diameters for
+					 * @param nFaces The number of faces to store triangle fans and planes for
+					 * @param nTriangles The total number of triangles across all faces
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return Nothing
+					 */
+					void allocate(I nCells, I nFaces, I nTriangles);
+			};
+		}
+	}
+}
+
+// Include Header Level Definitions
+#include "UnstructuredMeshGeometryCache.ipp"
+
+#endif
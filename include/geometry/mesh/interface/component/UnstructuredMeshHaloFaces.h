@@ -0,0 +1,106 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Declarations for the UnstructuredMeshHaloFaces Class
+ */
+
+#ifndef CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_HALO_FACES_INCLUDE_H
+#define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_HALO_FACES_INCLUDE_H
+
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			/**
+			 * Stores a split of the local faces of an unstructured mesh into the interior faces, which only
+			 * access locally owned cells, and the halo faces, which access at least one ghost cell.
+			 *
+			 * Face loops can process the interior faces while the ghost cell data is still being exchanged,
+			 * and only need to wait for the exchange to complete before processing the halo faces.
+			 *
+			 * Boundary faces are interior faces, since their only cell is always locally owned.
+			 * Both lists are stored in ascending local face ID.
+			 *
+			 * This class only stores the data - it is populated by UnstructuredMeshInterface::buildHaloFaces.
+			 *
+			 * @tparam I Type of mesh index scheme
+			 */
+			template <class I>
+			class UnstructuredMeshHaloFaces
+			{
+				public:
+					// === Members ===
+
+					/** Whether the split has been populated **/
+					bool built;
+
+					/** Local face IDs of the faces that only access locally owned cells **/
+					I * interiorFaces;
+
+					/** Size of interiorFaces **/
+					I nInteriorFaces;
+
+					/** Local face IDs of the faces that access at least one ghost cell **/
+					I * haloFaces;
+
+					/** Size of haloFaces **/
+					I nHaloFaces;
+
+					// === Constructor/Deconstructors ===
+
+					/**
+					 * Default constructor. Sets up an empty, unbuilt, split.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 */
+					UnstructuredMeshHaloFaces();
+
+					/**
+					 * Deconstructor. Cleans up internally allocated arrays.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 */
+					~UnstructuredMeshHaloFaces();
+
+					// === Concrete Methods ===
+
+					/**
+					 * Free any internal arrays and return the split to the unbuilt state.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 *
+					 * @return Nothing
+					 */
+					void reset();
+
+					/**
+					 * Discard any existing data and allocate the arrays for the provided number of interior and halo faces.
+					 * The contents of the arrays are left unset.
+					 *
+					 * @param nInteriorFaces The number of interior faces to store
+					 * @param nHaloFaces The number of halo faces to store
+					 *
+					 * @tparam I Type of mesh index scheme
+					 *
+					 * @return Nothing
+					 */
+					void allocate(I nInteriorFaces, I nHaloFaces);
+			};
+		}
+	}
+}
+
+// Include Header Level Definitions
+#include "UnstructuredMeshHaloFaces.ipp"
+
+#endif
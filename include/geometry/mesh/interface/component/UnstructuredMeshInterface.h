@@ -33,6 +33,12 @@
 
 #include "Error.h"
 #include "UnstructuredMeshProperties.h"
+#include "UnstructuredMeshCellIndex.h"
+#include "UnstructuredMeshGeometryCache.h"
+#include "UnstructuredMeshFaceColouring.h"
+#include "UnstructuredMeshHaloFaces.h"
+#include "UnstructuredMeshKernelView.h"
+#include "UnstructuredMeshReordering.h"
 #include "Communicator.h"
 #include "DistributedAdjacencyList.h"
 #include "EuclideanVector.h"
@@ -140,6 +146,45 @@ namespace cupcfd
 					 **/
 					bool finalized;
 
+					/**
+					 * Spatial index over the locally owned cells, used to accelerate point location.
+					 * Built during finalize.
+					 **/
+					UnstructuredMeshCellIndex<I,T> cellIndex;
+
+					/**
+					 * Cached geometric invariants of the local cells and faces, used by particle tracking.
+					 * Built during finalize.
+					 **/
+					UnstructuredMeshGeometryCache<I,T> geometryCache;
+
+					/**
+					 * Colouring of the local faces such that no two faces of a colour share a cell, used to
+					 * thread face loops that scatter into both cells of a face.
+					 * Built during finalize.
+					 **/
+					UnstructuredMeshFaceColouring<I> faceColouring;
+
+					/**
+					 * Split of the local faces into those that only access locally owned cells and those that
+					 * access ghost cells, used to overlap face loops with the exchange of ghost cell data.
+					 * Built during finalize.
+					 **/
+					UnstructuredMeshHaloFaces<I> haloFaces;
+
+					/**
+					 * Flat copy of the face and cell geometry/connectivity of the local mesh, read by the
+					 * finite volume kernels.
+					 * Built during finalize.
+					 **/
+					UnstructuredMeshKernelView<I,T> kernelView;
+
+					/**
+					 * The renumbering to apply to the local cells during finalize, and its effect on the
+					 * locality of the cell numbering. The type should be set before finalize.
+					 **/
+					UnstructuredMeshReordering<I,T> reordering;
+
 					// === Constructors/Deconstructors
 
 					/**
@@ -2640,7 +2685,8 @@ namespace cupcfd
 					/**
 					 * Sets up a mesh and populates it with data from a source of mesh data.
 					 *
-					 * Due to the finalization stage, all members of comm must call this constructor.
+					 * All members of comm must call this, including any that are assigned no cells, since the
+					 * reads from the source may be collective. The mesh must be finalized afterwards.
 					 *
 					 * @param data The souce of mesh data to load into the unstructured mesh
 					 * @param assignedCellLabels The labels to load from the data source on this rank
@@ -2683,6 +2729,9 @@ namespace cupcfd
 					 *
 					 * If the point sits on a edge and/or vertex, it will report the first cell encountered as the cell.
 					 *
+					 * If the spatial index has been built (see buildCellIndex), only the cells whose bounding box contains
+					 * the point are tested, otherwise every locally owned cell is tested. Cells are treated as convex.
+					 *
 					 * Note: In distributed setups, this means that more than one rank may find a cell containing the point
 					 * if it is on the edge or vertex of a boundary. In such a case this process will still report
 					 * a cell for each, but the error code will indicate the shared nature. It is left to the callee
@@ -2698,6 +2747,171 @@ namespace cupcfd
 					 */
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes findCellID(euc::EuclideanPoint<T,3>& point,  I * localCellID, I * globalCellID);
+
+					/**
+					 * Find the local and global cell IDs of the cells that contain each of a set of points.
+					 *
+					 * The same caveats regarding points on edges or vertices apply as for findCellID.
+					 *
+					 * @param points The points we wish to find the cell container IDs for
+					 * @param nPoints The number of points
+					 * @param localCellIDs The array to store the local ID of the cell for each point. Set to -1 for points
+					 * that are not located in a cell on this rank. Must be at least of size nPoints.
+					 * @param globalCellIDs The array to store the global ID of the cell for each point. Set to -1 for points
+					 * that are not located in a cell on this rank. Must be at least of size nPoints.
+					 * @param nFound A pointer to the location to store the number of points that were found on this rank
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes findCellIDs(euc::EuclideanPoint<T,3> * points, I nPoints,
+													  I * localCellIDs, I * globalCellIDs, I * nFound);
+
+					/**
+					 * Test whether a point is located inside (or on the boundary of) a locally owned cell.
+					 *
+					 * The cell is treated as convex: the point is inside if, for every face of the cell, it is on
+					 * the same side of the face plane as the centroid of the cell vertices. This is computed directly
+					 * from the vertex positions, and so does not allocate any memory.
+					 *
+					 * @param cellID The local ID of the cell
+					 * @param point The point to test
+					 *
+					 * @return Whether the point is inside the cell
+					 */
+					bool isPointInCell(I cellID, const euc::EuclideanPoint<T,3>& point);
+
+					/**
+					 * (Re)build the spatial index of the locally owned cells from the current vertex positions.
+					 *
+					 * This is called automatically during finalize, but should be called again if vertex positions are
+					 * modified afterwards. Until the index is built, findCellID tests every local cell.
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes buildCellIndex();
+
+					/**
+					 * (Re)build the cache of geometric invariants from the current vertex positions.
+					 *
+					 * This is called automatically during finalize, but should be called again if vertex positions are
+					 * modified afterwards. Until the cache is built, the accessors that use it compute their values
+					 * directly from the mesh.
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes buildGeometryCache();
+
+					/**
+					 * (Re)build the colouring of the local faces from the current face to cell connectivity.
+					 *
+					 * Faces are coloured greedily in local face order, with each face given the lowest colour not
+					 * already used by another face of either of its cells. Both locally owned and ghost cells are
+					 * considered, since face loops write to both.
+					 *
+					 * This is called automatically during finalize. Until the colouring is built, the coloured
+					 * variants of the face loop kernels fall back to their serial versions.
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes buildFaceColouring();
+
+					/**
+					 * (Re)build the split of the local faces into interior faces, whose cells are all locally owned,
+					 * and halo faces, which have a ghost cell.
+					 *
+					 * This is called automatically during finalize.
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes buildHaloFaces();
+
+					/**
+					 * (Re)build the flat kernel view of the face and cell geometry/connectivity from the current mesh.
+					 *
+					 * This is called automatically during finalize, but should be called again if the face or cell
+					 * geometry is modified afterwards, since the finite volume kernels read the view rather than the mesh.
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes buildKernelView();
+
+					/**
+					 * Renumber the locally owned cells according to the selected reordering type, by reordering
+					 * the local nodes of the cell connectivity graph. Ghost cells keep their numbering after the
+					 * local cells.
+					 *
+					 * This is called automatically during finalize, after the connectivity graph is finalized but
+					 * before the cell data is placed in graph order, and so should not be called elsewhere.
+					 * The mean cell graph bandwidth is recorded before and after, including when no reordering
+					 * is selected.
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_INVALID_INDEX The cell data does not match the connectivity graph
+					 */
+					__attribute__((warn_unused_result))
+					cupcfd::error::eCodes reorderCells();
+
+					/**
+					 * Get the diameter of a cell, i.e. the maximum distance between any two of its vertices.
+					 *
+					 * @param cellID The local ID of the cell on this process
+					 *
+					 * @return The diameter of the cell
+					 */
+					__attribute__((warn_unused_result))
+					T getCellDiameter(I cellID);
+
+					/**
+					 * Get the number of triangles in the triangle fan of a face.
+					 * The fan is formed of the triangles (v0, vj, vj+1) of the face vertices in order.
+					 *
+					 * @param faceID The local ID of the face
+					 *
+					 * @return The number of triangles
+					 */
+					__attribute__((warn_unused_result))
+					inline I getFaceNTriangles(I faceID);
+
+					/**
+					 * Get the vertex positions of a triangle in the triangle fan of a face.
+					 *
+					 * @param faceID The local ID of the face
+					 * @param triID The index of the triangle in the fan of the face (0 to getFaceNTriangles - 1)
+					 * @param a The point to update with the first vertex (the first vertex of the face)
+					 * @param b The point to update with the second vertex
+					 * @param c The point to update with the third vertex
+					 *
+					 * @return Nothing
+					 */
+					inline void getFaceTriangle(I faceID, I triID, euc::EuclideanPoint<T,3>& a,
+												euc::EuclideanPoint<T,3>& b, euc::EuclideanPoint<T,3>& c);
+
+					/**
+					 * Determine whether a vector is parallel to the plane of a face, as defined by the
+					 * first triangle of its triangle fan.
+					 *
+					 * Uses the same tolerance as EuclideanPlane3D::isVectorParallel.
+					 *
+					 * @param faceID The local ID of the face
+					 * @param vec The vector to test
+					 *
+					 * @return Whether the vector is parallel to the face
+					 */
+					__attribute__((warn_unused_result))
+					bool isVectorParallelToFace(I faceID, const euc::EuclideanVector<T,3>& vec);
 			};
 		}
 	}
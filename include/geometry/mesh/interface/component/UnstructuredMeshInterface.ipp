@@ -30,10 +30,16 @@
 #define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_INTERFACE_IPP_H
 
 #include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include "TriPrism.h"
 #include "Tetrahedron.h"
 #include "QuadPyramid.h"
 #include "Hexahedron.h"
+#include "EuclideanPlane3D.h"
+#include "ArithmeticKernels.h"
+#include "ArrayDrivers.h"
 
 namespace euc = cupcfd::geometry::euclidean;
 namespace shapes = cupcfd::geometry::shapes;
@@ -1464,6 +1470,23 @@ namespace cupcfd
 			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::addData(MeshSource<I,T,L>& data, L * assignedCellLabels, I nAssignedCellLabels) {
 				cupcfd::error::eCodes status;
 
+				// =================================
+				// (0)  Global Mesh Sizes
+				// =================================
+
+				status = data.getCellCount(&(this->properties.nCells));
+				CHECK_ECODE(status)
+				status = data.getFaceCount(&(this->properties.nFaces));
+				CHECK_ECODE(status)
+				status = data.getVertexCount(&(this->properties.nVertices));
+				CHECK_ECODE(status)
+				status = data.getBoundaryCount(&(this->properties.nBoundaries));
+				CHECK_ECODE(status)
+				status = data.getRegionCount(&(this->properties.nRegions));
+				CHECK_ECODE(status)
+				status = data.getMaxFaceCount(&(this->properties.nMaxFaces));
+				CHECK_ECODE(status)
+
 				// =================================
 				// (1)  Data Label Stage
 				// =================================
@@ -1482,382 +1505,366 @@ namespace cupcfd
 				I ghCells = partGraph.nLGhNodes;
 				I nCells = lCells + ghCells;
 					
-				if(lCells > 0) {
-					// (c) Get the labels from the partition graph
-					I * cellLabels = (I *) malloc(sizeof(I) * nCells);
-					status = partGraph.getLocalNodes(cellLabels, lCells);
-					CHECK_ECODE(status)
-					status = partGraph.getGhostNodes(cellLabels + lCells, ghCells);
-					CHECK_ECODE(status)
+				// Every process goes through the same reads even if it owns no cells, since the reads of the source
+				// may be collective (e.g. collective MPI-IO). A process without cells just reads nothing.
+				// (c) Get the labels from the partition graph
+				I * cellLabels = (I *) malloc(sizeof(I) * nCells);
+				status = partGraph.getLocalNodes(cellLabels, lCells);
+				CHECK_ECODE(status)
+				status = partGraph.getGhostNodes(cellLabels + lCells, ghCells);
+				CHECK_ECODE(status)
 
-					// (d) Get the labels of all faces associated with only *local* cells - faces that are between local-> ghost will be caught in this.
+				// (d) Get the labels of all faces associated with only *local* cells - faces that are between local-> ghost will be caught in this.
 
-					// (di) Get number of faces per cell
-					I nCellFacesSum;
-					I * nCellFaces = (I *) malloc(sizeof(I) * lCells);
-					status = data.getCellNFaces(nCellFaces, lCells, cellLabels, lCells);
-					CHECK_ECODE(status)
+				// (di) Get number of faces per cell
+				I nCellFacesSum;
+				I * nCellFaces = (I *) malloc(sizeof(I) * lCells);
+				status = data.getCellNFaces(nCellFaces, lCells, cellLabels, lCells);
+				CHECK_ECODE(status)
 
-					// (dii) Summed number of faces per cell - needed for CSR sizes
-					cupcfd::utility::drivers::sum(nCellFaces, lCells, &nCellFacesSum);
-					free(nCellFaces);
+				// (dii) Summed number of faces per cell - needed for CSR sizes
+				cupcfd::utility::drivers::sum(nCellFaces, lCells, &nCellFacesSum);
+				free(nCellFaces);
 
-					// d(iii) Get Face Labels for each Cell in CSR Format - this will omit the non-existant faces when the faces per cell is below max faces
-					I * cellFaceLabelInd = (I *) malloc(sizeof(I) * (lCells+1));
-					I * cellFaceLabelData = (I *) malloc(sizeof(I) * nCellFacesSum);
-					status = data.getCellFaceLabels(cellFaceLabelInd, lCells+1, cellFaceLabelData, nCellFacesSum, cellLabels, lCells);
-					CHECK_ECODE(status)
+				// d(iii) Get Face Labels for each Cell in CSR Format - this will omit the non-existant faces when the faces per cell is below max faces
+				I * cellFaceLabelInd = (I *) malloc(sizeof(I) * (lCells+1));
+				I * cellFaceLabelData = (I *) malloc(sizeof(I) * nCellFacesSum);
+				status = data.getCellFaceLabels(cellFaceLabelInd, lCells+1, cellFaceLabelData, nCellFacesSum, cellLabels, lCells);
+				CHECK_ECODE(status)
 
-					// (div) Remove duplicate face labels from where cells share faces
-					// This leaves a single label per each face that is attached to a local cell
-					I * faceLabelsDistinct;
-					I nFaceLabelsDistinct;
-					status = cupcfd::utility::drivers::distinctArray(cellFaceLabelData, nCellFacesSum, &faceLabelsDistinct, &nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+				// (div) Remove duplicate face labels from where cells share faces
+				// This leaves a single label per each face that is attached to a local cell
+				I * faceLabelsDistinct;
+				I nFaceLabelsDistinct;
+				status = cupcfd::utility::drivers::distinctArray(cellFaceLabelData, nCellFacesSum, &faceLabelsDistinct, &nFaceLabelsDistinct);
+				CHECK_ECODE(status)
 
-					// (e) Get the labels of any boundaries associated with these faces
-					// (ei) Reduce down to only faces that are boundaries
-					bool * faceLabelIsBoundary = (bool *) malloc(sizeof(bool) * nFaceLabelsDistinct);
-					status = data.getFaceIsBoundary(faceLabelIsBoundary, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+				// (e) Get the labels of any boundaries associated with these faces
+				// (ei) Reduce down to only faces that are boundaries
+				bool * faceLabelIsBoundary = (bool *) malloc(sizeof(bool) * nFaceLabelsDistinct);
+				status = data.getFaceIsBoundary(faceLabelIsBoundary, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
+				CHECK_ECODE(status)
 
-					int nFaceBoundaries = 0;
-					for(int i = 0; i < nFaceLabelsDistinct; i++) {
-						if(faceLabelIsBoundary[i] == true) {
-							nFaceBoundaries++;
-						}
+				int nFaceBoundaries = 0;
+				for(int i = 0; i < nFaceLabelsDistinct; i++) {
+					if(faceLabelIsBoundary[i] == true) {
+						nFaceBoundaries++;
 					}
-					
-					I * faceWithBoundary = (I *) malloc(sizeof(I) * nFaceBoundaries);
+				}
+				
+				I * faceWithBoundary = (I *) malloc(sizeof(I) * nFaceBoundaries);
 
-					I nFaceWithoutBoundary = nFaceLabelsDistinct - nFaceBoundaries;
-					I * faceWithoutBoundary = (I *) malloc(sizeof(I) * nFaceWithoutBoundary);
+				I nFaceWithoutBoundary = nFaceLabelsDistinct - nFaceBoundaries;
+				I * faceWithoutBoundary = (I *) malloc(sizeof(I) * nFaceWithoutBoundary);
 
-					I ptr = 0;
-					I ptr2 = 0;
-					for(int i = 0; i < nFaceLabelsDistinct; i++) {
-						if(faceLabelIsBoundary[i] == true) {
-							faceWithBoundary[ptr] = faceLabelsDistinct[i];
-							ptr++;
-						}
-						else {
-							faceWithoutBoundary[ptr2] = faceLabelsDistinct[i];
-							ptr2++;
-						}
+				I ptr = 0;
+				I ptr2 = 0;
+				for(int i = 0; i < nFaceLabelsDistinct; i++) {
+					if(faceLabelIsBoundary[i] == true) {
+						faceWithBoundary[ptr] = faceLabelsDistinct[i];
+						ptr++;
 					}
-					free(faceLabelIsBoundary);
-					
-					// (eii) Get the boundary labels for these faces
-					I nBoundaryLabels = nFaceBoundaries;
-					I * boundaryLabels = (I *) malloc(sizeof(I) * nBoundaryLabels);
-					status = data.getFaceBoundaryLabels(boundaryLabels, nBoundaryLabels, faceWithBoundary, nFaceBoundaries);
-					CHECK_ECODE(status)
-
-					// (eiii) Boundary faces should be unique, but as a precaution remove repeats
-					I * boundaryLabelsDistinct;
-					I nBoundaryLabelsDistinct;
-					status = cupcfd::utility::drivers::distinctArray(boundaryLabels, nBoundaryLabels, &boundaryLabelsDistinct, &nBoundaryLabelsDistinct);
-					CHECK_ECODE(status)
+					else {
+						faceWithoutBoundary[ptr2] = faceLabelsDistinct[i];
+						ptr2++;
+					}
+				}
+				free(faceLabelIsBoundary);
+				
+				// (eii) Get the boundary labels for these faces
+				I nBoundaryLabels = nFaceBoundaries;
+				I * boundaryLabels = (I *) malloc(sizeof(I) * nBoundaryLabels);
+				status = data.getFaceBoundaryLabels(boundaryLabels, nBoundaryLabels, faceWithBoundary, nFaceBoundaries);
+				CHECK_ECODE(status)
 
-					// (f) Get the distinct labels of any vertexes associated with the retrieved faces and boundaries
+				// (eiii) Boundary faces should be unique, but as a precaution remove repeats
+				I * boundaryLabelsDistinct;
+				I nBoundaryLabelsDistinct;
+				status = cupcfd::utility::drivers::distinctArray(boundaryLabels, nBoundaryLabels, &boundaryLabelsDistinct, &nBoundaryLabelsDistinct);
+				CHECK_ECODE(status)
 
-					// (fi) Get the number of vertices per face and sum to get the CSR size
-					I * faceVerticesCount = (I *) malloc(sizeof(I) * nFaceLabelsDistinct);
+				// (f) Get the distinct labels of any vertexes associated with the retrieved faces and boundaries
 
-					status = data.getFaceNVertices(faceVerticesCount, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+				// (fi) Get the number of vertices per face and sum to get the CSR size
+				I * faceVerticesCount = (I *) malloc(sizeof(I) * nFaceLabelsDistinct);
 
-					I faceVerticesCountTotal;
-					cupcfd::utility::drivers::sum(faceVerticesCount, nFaceLabelsDistinct, &faceVerticesCountTotal);
-					free(faceVerticesCount);
+				status = data.getFaceNVertices(faceVerticesCount, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
+				CHECK_ECODE(status)
 
-					// (fii) Get the number of vertices per boundary and sum to get the CSR size
-					I * boundaryVerticesCount = (I *) malloc(sizeof(I) * nBoundaryLabelsDistinct);
+				I faceVerticesCountTotal;
+				cupcfd::utility::drivers::sum(faceVerticesCount, nFaceLabelsDistinct, &faceVerticesCountTotal);
+				free(faceVerticesCount);
 
-					status = data.getFaceNVertices(boundaryVerticesCount, nBoundaryLabelsDistinct, boundaryLabelsDistinct, nBoundaryLabelsDistinct);
-					CHECK_ECODE(status)
+				// (fii) Get the number of vertices per boundary and sum to get the CSR size
+				I * boundaryVerticesCount = (I *) malloc(sizeof(I) * nBoundaryLabelsDistinct);
 
-					I boundaryVerticesCountTotal;
-					cupcfd::utility::drivers::sum(boundaryVerticesCount, nBoundaryLabelsDistinct, &boundaryVerticesCountTotal);
-					free(boundaryVerticesCount);
+				status = data.getFaceNVertices(boundaryVerticesCount, nBoundaryLabelsDistinct, boundaryLabelsDistinct, nBoundaryLabelsDistinct);
+				CHECK_ECODE(status)
 
-					// (fiii) Get the vertex labels for the face and boundary lists - CSR format.
-					// Store the vertices labels in a combined array for both.
+				I boundaryVerticesCountTotal;
+				cupcfd::utility::drivers::sum(boundaryVerticesCount, nBoundaryLabelsDistinct, &boundaryVerticesCountTotal);
+				free(boundaryVerticesCount);
 
-					I * vertLabelData = (I *) malloc(sizeof(I) * (faceVerticesCountTotal + boundaryVerticesCountTotal));
+				// (fiii) Get the vertex labels for the face and boundary lists - CSR format.
+				// Store the vertices labels in a combined array for both.
 
-					I * faceVertLabelCSRInd = (I *) malloc(sizeof(I) * (nFaceLabelsDistinct+1));
+				I * vertLabelData = (I *) malloc(sizeof(I) * (faceVerticesCountTotal + boundaryVerticesCountTotal));
 
-					status = data.getFaceVerticesLabelsCSR(faceVertLabelCSRInd, nFaceLabelsDistinct+1,
-															  vertLabelData, faceVerticesCountTotal,
-															  faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+				I * faceVertLabelCSRInd = (I *) malloc(sizeof(I) * (nFaceLabelsDistinct+1));
 
-					I * bndVertLabelCSRInd = (I *) malloc(sizeof(I) * (nBoundaryLabelsDistinct+1));
+				status = data.getFaceVerticesLabelsCSR(faceVertLabelCSRInd, nFaceLabelsDistinct+1,
+														  vertLabelData, faceVerticesCountTotal,
+														  faceLabelsDistinct, nFaceLabelsDistinct);
+				CHECK_ECODE(status)
 
-					status = data.getFaceVerticesLabelsCSR(bndVertLabelCSRInd, nBoundaryLabelsDistinct+1,
-															  vertLabelData + faceVerticesCountTotal, boundaryVerticesCountTotal,
-															  boundaryLabelsDistinct, nBoundaryLabelsDistinct);
-					CHECK_ECODE(status)
+				I * bndVertLabelCSRInd = (I *) malloc(sizeof(I) * (nBoundaryLabelsDistinct+1));
 
-					// (fiv) Get distinct vertex labels
-					I * vertexLabelsDistinct;
-					I nVertexLabelsDistinct;
-					status = cupcfd::utility::drivers::distinctArray(vertLabelData, faceVerticesCountTotal + boundaryVerticesCountTotal,
-																	&vertexLabelsDistinct, &nVertexLabelsDistinct);
-					CHECK_ECODE(status)
+				status = data.getFaceVerticesLabelsCSR(bndVertLabelCSRInd, nBoundaryLabelsDistinct+1,
+														  vertLabelData + faceVerticesCountTotal, boundaryVerticesCountTotal,
+														  boundaryLabelsDistinct, nBoundaryLabelsDistinct);
+				CHECK_ECODE(status)
 
-					// (f) Get the labels of any regions associated with the boundaries
-					//  Since we're loading all regions, just make an label list of 0->regionCount-1 since we'll just read all since
-					// their numbers are typically far far fewer
-					I nRegions;
-					status = data.getRegionCount(&nRegions);
-					CHECK_ECODE(status)
-					I * regionIndices = (I *) malloc(sizeof(I) * nRegions);
-					I * regionLabels = (I *) malloc(sizeof(I) * nRegions);
+				// (fiv) Get distinct vertex labels
+				I * vertexLabelsDistinct;
+				I nVertexLabelsDistinct;
+				status = cupcfd::utility::drivers::distinctArray(vertLabelData, faceVerticesCountTotal + boundaryVerticesCountTotal,
+																&vertexLabelsDistinct, &nVertexLabelsDistinct);
+				CHECK_ECODE(status)
 
-					for(I i = 0; i < nRegions; i++) {
-						regionIndices[i] = i;
-					}
+				// (f) Get the labels of any regions associated with the boundaries
+				//  Since we're loading all regions, just make an label list of 0->regionCount-1 since we'll just read all since
+				// their numbers are typically far far fewer
+				I nRegions;
+				status = data.getRegionCount(&nRegions);
+				CHECK_ECODE(status)
+				I * regionIndices = (I *) malloc(sizeof(I) * nRegions);
+				I * regionLabels = (I *) malloc(sizeof(I) * nRegions);
 
-					status = data.getRegionLabels(regionLabels, nRegions, regionIndices,nRegions);
-					CHECK_ECODE(status)
-					free(regionIndices);
-					
-					// ====================================
-					// (2)  Data Load and Mesh Build Stage
-					// ====================================
-					// Now all the appropriate labels are known, start constructing the Mesh by reading in data
-					// Order should be in that of least dependancy - i.e.:
-					// (i) Vertices
-					// (ii) Regions
-					// (iii) Cells
-					// (iv) Boundaries (Need vertices)
-					// (v) Faces (Needs vertices, cells, boundaries)
-
-					// === Read Vertices Data ===
-					//Final Vertices Labels are stored in vertexLabelsDistinct
-					euc::EuclideanPoint<T,3> * pointTmpStore = (euc::EuclideanPoint<T,3> *) malloc(sizeof(euc::EuclideanPoint<T,3>) * nVertexLabelsDistinct);
-					status = data.getVertexCoords(pointTmpStore, nVertexLabelsDistinct, vertexLabelsDistinct, nVertexLabelsDistinct);
-					CHECK_ECODE(status)
+				for(I i = 0; i < nRegions; i++) {
+					regionIndices[i] = i;
+				}
 
-					// Add Vertices to Mesh
-					for(I i = 0; i < nVertexLabelsDistinct; i++) {
-						status = this->addVertex(vertexLabelsDistinct[i], pointTmpStore[i]);
-						CHECK_ECODE(status)
-					}
+				status = data.getRegionLabels(regionLabels, nRegions, regionIndices,nRegions);
+				CHECK_ECODE(status)
+				free(regionIndices);
+				
+				// ====================================
+				// (2)  Data Load and Mesh Build Stage
+				// ====================================
+				// Now all the appropriate labels are known, start constructing the Mesh by reading in data
+				// Order should be in that of least dependancy - i.e.:
+				// (i) Vertices
+				// (ii) Regions
+				// (iii) Cells
+				// (iv) Boundaries (Need vertices)
+				// (v) Faces (Needs vertices, cells, boundaries)
+
+				// === Read Vertices Data ===
+				//Final Vertices Labels are stored in vertexLabelsDistinct
+				euc::EuclideanPoint<T,3> * pointTmpStore = (euc::EuclideanPoint<T,3> *) malloc(sizeof(euc::EuclideanPoint<T,3>) * nVertexLabelsDistinct);
+				status = data.getVertexCoords(pointTmpStore, nVertexLabelsDistinct, vertexLabelsDistinct, nVertexLabelsDistinct);
+				CHECK_ECODE(status)
 
-					free(pointTmpStore);
+				// Add Vertices to Mesh
+				for(I i = 0; i < nVertexLabelsDistinct; i++) {
+					status = this->addVertex(vertexLabelsDistinct[i], pointTmpStore[i]);
+					CHECK_ECODE(status)
+				}
 
-					// === Read Region Data ===
-					// ToDo: Read Region Names - Needs fixing of reading strings from HDF5
+				free(pointTmpStore);
 
-					// Add Regions to Mesh
-					for(I i = 0; i < nRegions; i++) {
-						// ToDo: Fix the region name
-						std::string name = "Default";
-						status = this->addRegion(regionLabels[i], name);
-						CHECK_ECODE(status)
-					}
-					
-					// === Read Boundary Data ===
-					// Final labels in boundaryLabelsDistinct
+				// === Read Region Data ===
+				// ToDo: Read Region Names - Needs fixing of reading strings from HDF5
 
-					// Region Labels
-					I nBoundaryRegionLabels = nBoundaryLabelsDistinct;
-					I * boundaryRegionLabels = (I *) malloc(sizeof(I) * nBoundaryRegionLabels);
-					status = data.getBoundaryRegionLabels(boundaryRegionLabels, nBoundaryRegionLabels, boundaryLabelsDistinct, nBoundaryLabelsDistinct);
+				// Add Regions to Mesh
+				for(I i = 0; i < nRegions; i++) {
+					// ToDo: Fix the region name
+					std::string name = "Default";
+					status = this->addRegion(regionLabels[i], name);
 					CHECK_ECODE(status)
+				}
+				
+				// === Read Boundary Data ===
+				// Final labels in boundaryLabelsDistinct
 
-					// Vertices Labels
-					// Can reuse previous read starting at vertLabelData[faceVerticesCountTotal]
+				// Region Labels
+				I nBoundaryRegionLabels = nBoundaryLabelsDistinct;
+				I * boundaryRegionLabels = (I *) malloc(sizeof(I) * nBoundaryRegionLabels);
+				status = data.getBoundaryRegionLabels(boundaryRegionLabels, nBoundaryRegionLabels, boundaryLabelsDistinct, nBoundaryLabelsDistinct);
+				CHECK_ECODE(status)
 
-					// Boundary Distance
-					T * bDistance = (T *) malloc(sizeof(T) * nBoundaryLabelsDistinct);
-					status = data.getBoundaryDistance(bDistance, nBoundaryLabelsDistinct, boundaryLabelsDistinct, nBoundaryLabelsDistinct);
-					CHECK_ECODE(status)
+				// Vertices Labels
+				// Can reuse previous read starting at vertLabelData[faceVerticesCountTotal]
 
-					// Add Boundaries to Mesh
-					for(I i = 0; i < nBoundaryLabelsDistinct; i++) {
-						I bLabel = boundaryLabelsDistinct[i];
-						I rLabel = boundaryRegionLabels[i];
+				// Boundary Distance
+				T * bDistance = (T *) malloc(sizeof(T) * nBoundaryLabelsDistinct);
+				status = data.getBoundaryDistance(bDistance, nBoundaryLabelsDistinct, boundaryLabelsDistinct, nBoundaryLabelsDistinct);
+				CHECK_ECODE(status)
 
-						I vertDataPtr = faceVerticesCountTotal + bndVertLabelCSRInd[i];
-						I rangeSize = bndVertLabelCSRInd[i+1] - bndVertLabelCSRInd[i];
+				// Add Boundaries to Mesh
+				for(I i = 0; i < nBoundaryLabelsDistinct; i++) {
+					I bLabel = boundaryLabelsDistinct[i];
+					I rLabel = boundaryRegionLabels[i];
 
-						status = this->addBoundary(bLabel, rLabel, vertLabelData + vertDataPtr, rangeSize, bDistance[i]);
-						CHECK_ECODE(status)
-					}
+					I vertDataPtr = faceVerticesCountTotal + bndVertLabelCSRInd[i];
+					I rangeSize = bndVertLabelCSRInd[i+1] - bndVertLabelCSRInd[i];
 
-					free(boundaryRegionLabels);
-					free(bDistance);
-					
-					// === Read Cell Data ===
-					// Read Cell Data for local *and* ghost cells
-					// Final labels in cellLabels: Segmented into [local|Ghost cells] for 0->lCells-1 and lCells->lCells+ghCells-1
-					pointTmpStore = (euc::EuclideanPoint<T,3> *) malloc(sizeof(euc::EuclideanPoint<T,3>) * nCells);
-					T * cellVol = (T *) malloc(sizeof(T) * nCells);
-
-					// Read Cell Center
-					status = data.getCellCenter(pointTmpStore, nCells, cellLabels, nCells);
+					status = this->addBoundary(bLabel, rLabel, vertLabelData + vertDataPtr, rangeSize, bDistance[i]);
 					CHECK_ECODE(status)
+				}
 
-					// Read Cell Volume
-					status = data.getCellVolume(cellVol, nCells, cellLabels, nCells);
-					CHECK_ECODE(status)
+				free(boundaryRegionLabels);
+				free(bDistance);
+				
+				// === Read Cell Data ===
+				// Read Cell Data for local *and* ghost cells
+				// Final labels in cellLabels: Segmented into [local|Ghost cells] for 0->lCells-1 and lCells->lCells+ghCells-1
+				pointTmpStore = (euc::EuclideanPoint<T,3> *) malloc(sizeof(euc::EuclideanPoint<T,3>) * nCells);
+				T * cellVol = (T *) malloc(sizeof(T) * nCells);
+
+				// Read Cell Center
+				status = data.getCellCenter(pointTmpStore, nCells, cellLabels, nCells);
+				CHECK_ECODE(status)
 
-					// Add Cells to Mesh
-					// Local Cells
-					for(I i = 0; i < lCells; i++) {
-						status = this->addCell(cellLabels[i], pointTmpStore[i], cellVol[i], true);
-						CHECK_ECODE(status)
-					}
+				// Read Cell Volume
+				status = data.getCellVolume(cellVol, nCells, cellLabels, nCells);
+				CHECK_ECODE(status)
 
-					// Ghost Cells
-					for(I i = lCells; i < (lCells + ghCells); i++) {
-						status = this->addCell(cellLabels[i], pointTmpStore[i], cellVol[i], false);
-						CHECK_ECODE(status)
-					}
+				// Add Cells to Mesh
+				// Local Cells
+				for(I i = 0; i < lCells; i++) {
+					status = this->addCell(cellLabels[i], pointTmpStore[i], cellVol[i], true);
+					CHECK_ECODE(status)
+				}
 
-					free(pointTmpStore);
-					free(cellVol);
+				// Ghost Cells
+				for(I i = lCells; i < (lCells + ghCells); i++) {
+					status = this->addCell(cellLabels[i], pointTmpStore[i], cellVol[i], false);
+					CHECK_ECODE(status)
+				}
 
-					// === Read Face Data ===
-					// Final Face Labels in faceLabelsDistinct
+				free(pointTmpStore);
+				free(cellVol);
 
-					// Cell 1 Labels
-					// For boundary and non-boundary faces
-					I * fCell1Labels = (I *) malloc(sizeof(I) * nFaceLabelsDistinct);
-					status = data.getFaceCell1Labels(fCell1Labels, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+				// === Read Face Data ===
+				// Final Face Labels in faceLabelsDistinct
 
-					// Cell 2 Labels
-					// For non-boundary faces only
-					I * fCell2Labels = (I *) malloc(sizeof(I) * nFaceWithoutBoundary);
-					status = data.getFaceCell2Labels(fCell2Labels, nFaceWithoutBoundary, faceWithoutBoundary, nFaceWithoutBoundary);
-					CHECK_ECODE(status)
+				// Cell 1 Labels
+				// For boundary and non-boundary faces
+				I * fCell1Labels = (I *) malloc(sizeof(I) * nFaceLabelsDistinct);
+				status = data.getFaceCell1Labels(fCell1Labels, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
+				CHECK_ECODE(status)
 
-					// Vertex Labels
-					// Reuse previously read values
+				// Cell 2 Labels
+				// For non-boundary faces only
+				I * fCell2Labels = (I *) malloc(sizeof(I) * nFaceWithoutBoundary);
+				status = data.getFaceCell2Labels(fCell2Labels, nFaceWithoutBoundary, faceWithoutBoundary, nFaceWithoutBoundary);
+				CHECK_ECODE(status)
 
-					// Boundary Labels
-					// Boundary faces only
-					I * fBndLabels = (I *) malloc(sizeof(I) * nFaceBoundaries);
-					status = data.getFaceBoundaryLabels(fBndLabels, nFaceBoundaries, faceWithBoundary, nFaceBoundaries);
-					CHECK_ECODE(status)
+				// Vertex Labels
+				// Reuse previously read values
 
-					// Is Boundary
-					bool * fIsBoundary = (bool *) malloc(sizeof(bool) * nFaceLabelsDistinct);
-					status = data.getFaceIsBoundary(fIsBoundary, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+				// Boundary Labels
+				// Boundary faces only
+				I * fBndLabels = (I *) malloc(sizeof(I) * nFaceBoundaries);
+				status = data.getFaceBoundaryLabels(fBndLabels, nFaceBoundaries, faceWithBoundary, nFaceBoundaries);
+				CHECK_ECODE(status)
 
-					// Face Lambda
-					T * fLambda = (T *) malloc(sizeof(T) * nFaceLabelsDistinct);
-					status = data.getFaceLambda(fLambda, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+				// Is Boundary
+				bool * fIsBoundary = (bool *) malloc(sizeof(bool) * nFaceLabelsDistinct);
+				status = data.getFaceIsBoundary(fIsBoundary, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
+				CHECK_ECODE(status)
 
-					// Face Area
-					T * fArea = (T *) malloc(sizeof(T) * nFaceLabelsDistinct);
-					status = data.getFaceArea(fArea, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+				// Face Lambda
+				T * fLambda = (T *) malloc(sizeof(T) * nFaceLabelsDistinct);
+				status = data.getFaceLambda(fLambda, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
+				CHECK_ECODE(status)
 
-					// Face Center
-					euc::EuclideanPoint<T,3> * fCenter = (euc::EuclideanPoint<T,3> *) malloc(sizeof(euc::EuclideanPoint<T,3>) * nFaceLabelsDistinct);
-					status = data.getFaceCenter(fCenter, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+				// Face Area
+				T * fArea = (T *) malloc(sizeof(T) * nFaceLabelsDistinct);
+				status = data.getFaceArea(fArea, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
+				CHECK_ECODE(status)
 
-					// Face Normal
-					euc::EuclideanVector3D<T> * fNorm = (euc::EuclideanVector3D<T> *) malloc(sizeof(euc::EuclideanVector3D<T>) * nFaceLabelsDistinct);
-					status = data.getFaceNormal(fNorm, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
-					CHECK_ECODE(status)
+				// Face Center
+				euc::EuclideanPoint<T,3> * fCenter = (euc::EuclideanPoint<T,3> *) malloc(sizeof(euc::EuclideanPoint<T,3>) * nFaceLabelsDistinct);
+				status = data.getFaceCenter(fCenter, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
+				CHECK_ECODE(status)
 
-					// Add Face Data
-					ptr = 0;
-					ptr2 = 0;
-					for(I i = 0; i < nFaceLabelsDistinct; i++) {
-						euc::EuclideanPoint<T,3> xpac(T(0), T(0), T(0));
-						euc::EuclideanPoint<T,3> xnac(T(0), T(0), T(0));
-						T rlencos = 0.0;
+				// Face Normal
+				euc::EuclideanVector3D<T> * fNorm = (euc::EuclideanVector3D<T> *) malloc(sizeof(euc::EuclideanVector3D<T>) * nFaceLabelsDistinct);
+				status = data.getFaceNormal(fNorm, nFaceLabelsDistinct, faceLabelsDistinct, nFaceLabelsDistinct);
+				CHECK_ECODE(status)
 
-						// Vertex Index Pointer into VertLabelData
-						I vertDataPtr = faceVertLabelCSRInd[i];
+				// Add Face Data
+				ptr = 0;
+				ptr2 = 0;
+				for(I i = 0; i < nFaceLabelsDistinct; i++) {
+					euc::EuclideanPoint<T,3> xpac(T(0), T(0), T(0));
+					euc::EuclideanPoint<T,3> xnac(T(0), T(0), T(0));
+					T rlencos = 0.0;
 
-						// Number of vertices
-						I rangeSize = faceVertLabelCSRInd[i+1] - faceVertLabelCSRInd[i];
+					// Vertex Index Pointer into VertLabelData
+					I vertDataPtr = faceVertLabelCSRInd[i];
 
-						I fCell2OrBoundLabel;
+					// Number of vertices
+					I rangeSize = faceVertLabelCSRInd[i+1] - faceVertLabelCSRInd[i];
 
-						if(fIsBoundary[i]) {
-							// Sanity check to make sure we're on the right label
-							if(faceWithBoundary[ptr] != faceLabelsDistinct[i]) {
-								return cupcfd::error::E_ERROR;
-							}
+					I fCell2OrBoundLabel;
 
-							fCell2OrBoundLabel = fBndLabels[ptr];
-							ptr++;
+					if(fIsBoundary[i]) {
+						// Sanity check to make sure we're on the right label
+						if(faceWithBoundary[ptr] != faceLabelsDistinct[i]) {
+							return cupcfd::error::E_ERROR;
 						}
-						else {
-							// Sanity check to make sure we're on the right label
-							if(faceWithoutBoundary[ptr2] != faceLabelsDistinct[i]) {
-								return cupcfd::error::E_ERROR;
-							}
 
-							fCell2OrBoundLabel = fCell2Labels[ptr2];
-							ptr2++;
+						fCell2OrBoundLabel = fBndLabels[ptr];
+						ptr++;
+					}
+					else {
+						// Sanity check to make sure we're on the right label
+						if(faceWithoutBoundary[ptr2] != faceLabelsDistinct[i]) {
+							return cupcfd::error::E_ERROR;
 						}
 
-						status = this->addFace(faceLabelsDistinct[i], fCell1Labels[i], fCell2OrBoundLabel, fIsBoundary[i], fLambda[i], fNorm[i],
-												  vertLabelData + vertDataPtr, rangeSize, fCenter[i], xpac, xnac, rlencos, fArea[i]);
-						CHECK_ECODE(status)
+						fCell2OrBoundLabel = fCell2Labels[ptr2];
+						ptr2++;
 					}
 
-					// =================================
-					// Cleanup
-					// =================================
-
-					free(cellLabels);
-					free(boundaryLabels);
-					free(regionLabels);
-
-					free(cellFaceLabelInd);
-					free(cellFaceLabelData);
-					free(faceVertLabelCSRInd);
-					free(bndVertLabelCSRInd);
-					free(vertLabelData);
-
-					free(boundaryLabelsDistinct);
-					free(vertexLabelsDistinct);
-					free(faceLabelsDistinct);
-					free(faceWithBoundary);
-					free(faceWithoutBoundary);
-
-					free(fCell1Labels);
-					free(fCell2Labels);
-					free(fBndLabels);
-					free(fIsBoundary);
-					free(fLambda);
-					free(fArea);
-					free(fCenter);
-					free(fNorm);
-					
-					return cupcfd::error::E_SUCCESS;
+					status = this->addFace(faceLabelsDistinct[i], fCell1Labels[i], fCell2OrBoundLabel, fIsBoundary[i], fLambda[i], fNorm[i],
+											  vertLabelData + vertDataPtr, rangeSize, fCenter[i], xpac, xnac, rlencos, fArea[i]);
+					CHECK_ECODE(status)
 				}
 
 				// =================================
-				// (3)  Finalisation
+				// Cleanup
 				// =================================
-				// Some Mesh structures will need the finalisation stage to ensure that some properties are correct.
-				// E.g. Data is stored for mappings from face->other, but we may also need cell->face etc, so these will
-				// be computed as part of the finalisation stage.
-				// It is also the case that some data may be insufficient - e.g. ghost cells only store faces that adjoin
-				// locally owned cells so we may need to retrieve data from the process that owns it locally to find out how many
-				// faces, vertices etc it has. Additionally, if a mesh file format does not contain certain data, such as volumes,
-				// areas etc, we will need to compute it here to ensure the mesh properties are correct, and then also ensure that
-				// data is also propagated to any ghost cells that are unable to compute it locally (e.g. due to insufficient face data)
-
-				status = this->finalize();
-				CHECK_ECODE(status)
 
+				free(cellLabels);
+				free(boundaryLabels);
+				free(regionLabels);
+
+				free(cellFaceLabelInd);
+				free(cellFaceLabelData);
+				free(faceVertLabelCSRInd);
+				free(bndVertLabelCSRInd);
+				free(vertLabelData);
+
+				free(boundaryLabelsDistinct);
+				free(vertexLabelsDistinct);
+				free(faceLabelsDistinct);
+				free(faceWithBoundary);
+				free(faceWithoutBoundary);
+
+				free(fCell1Labels);
+				free(fCell2Labels);
+				free(fBndLabels);
+				free(fIsBoundary);
+				free(fLambda);
+				free(fArea);
+				free(fCenter);
+				free(fNorm);
+				
+				// The mesh is finalized by the caller once all of the data has been added
 				return cupcfd::error::E_SUCCESS;
 			}
 			
@@ -1870,92 +1877,708 @@ namespace cupcfd
 			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::findCellID(euc::EuclideanPoint<T,3>& point, 
 																					  I * localCellID,
 																					  I * globalCellID) {
-				// Loop over and test each locally owned cell until we find the cell the point is located in (if any on this rank)
-				// For each cell:
-				// (a) Get the number of vertices and faces each cell has
-				// (b) Determine the type of cell
-				// (c) Test whether the position of the source is inside the cell
-				// (ci) If so, updated the local and global cell IDs
-				// (cii) If not, continue until no cells left to test
+				// (a) Find the local cells that could contain the point.
+				// If the spatial index is built, this is only the cells whose bounding box overlaps the bin containing
+				// the point, otherwise we have to test every locally owned cell.
+				// (b) Test whether the point is inside each candidate cell
+				// (bi) If so, updated the local and global cell IDs
+				// (bii) If not, continue until no cells left to test
 				cupcfd::error::eCodes status;
-	
+
 				// Part (a)
-				I nCells = this->properties.lOCells;
-	
-				// Mesh should be sorted into local, then global cells so loop over the initial range for local cells
-				for(I i = 0; i < nCells; i++) {
+				const I * candidates = nullptr;
+				I nCandidates;
+
+				if(this->cellIndex.built) {
+					this->cellIndex.getCandidateCells(point, &candidates, &nCandidates);
+				}
+				else {
+					// Mesh should be sorted into local, then global cells so loop over the initial range for local cells
+					nCandidates = this->properties.lOCells;
+				}
+
+				for(I i = 0; i < nCandidates; i++) {
+					I cellID;
+
 					// Part (b)
-					// Get the number of vertices
-					I nVertices = this->getCellNVertices(i);
-	
-					// Get the number of faces
-					I nFaces = this->getCellNFaces(i);
-	
-					// Get the Cell Type
-					shapes::PolyhedronType pType = shapes::findPolyhedronType(nVertices, nFaces);
-	
-					bool inside;
-					
-					if(pType == shapes::POLYHEDRON_TETRAHEDRON) {
-						shapes::Tetrahedron<T> * shape1;
-						status = this->buildPolyhedron(i, &shape1);
-						CHECK_ECODE(status)
-						inside = shape1->isPointInside(point);
-						delete shape1;
-					}
-					else if(pType == shapes::POLYHEDRON_QUADPYRAMID) {
-						shapes::QuadPyramid<T> * shape2;
-						status = this->buildPolyhedron(i, &shape2);
-						CHECK_ECODE(status)
-						inside = shape2->isPointInside(point);
-						delete shape2;
-					}
-					else if(pType == shapes::POLYHEDRON_TRIPRISM) {
-						shapes::TriPrism<T> * shape3;
-						status = this->buildPolyhedron(i, &shape3);
-						CHECK_ECODE(status)
-						inside = shape3->isPointInside(point);
-						delete shape3;
-					}
-					else if(pType == shapes::POLYHEDRON_HEXAHEDRON) {
-						shapes::Hexahedron<T> * shape4;
-						status = this->buildPolyhedron(i, &shape4);
-						CHECK_ECODE(status)
-						inside = shape4->isPointInside(point);						
-						delete shape4;
-					}
-					else if(pType == shapes::POLYHEDRON_UNKNOWN) {
-						return cupcfd::error::E_ERROR;
+					if(candidates != nullptr) {
+						cellID = candidates[i];
+
+						// Cheap rejection before the full test
+						if(!this->cellIndex.isPointInCellBounds(cellID, point)) {
+							continue;
+						}
 					}
 					else {
-						return cupcfd::error::E_ERROR;
+						cellID = i;
 					}
-		
-					// (c) Test whether the position point is inside the cell - stored in 'inside'
-					// (ci) If so, update cell ID and stop
-					if(inside) {
-						// Local ID is just position in loop
-						*localCellID = i;
-	
+
+					// (bi) If so, update cell ID and stop
+					if(this->isPointInCell(cellID, point)) {
+						*localCellID = cellID;
+
 						// Need to retrieve global ID from the connectivity graph
 						// Get the Node for the localID
 						L node;
-						status = this->cellConnGraph->connGraph.getLocalIndexNode(i, &node);
+						status = this->cellConnGraph->connGraph.getLocalIndexNode(cellID, &node);
 						CHECK_ECODE(status)
 						*globalCellID = this->cellConnGraph->nodeToGlobal[node];
-	
+
 						// Exit Loop by exiting function
 						return cupcfd::error::E_SUCCESS;
 					}
-	
-					// (cii) If not, let loops continue
+
+					// (bii) If not, let loops continue
 				}
-	
+
 				// ToDo: Corner cases (point on edge, point on vertex)
-	
+
 				// No suitable cell was found in the loop
 				return cupcfd::error::E_GEOMETRY_NO_VALID_CELL;
-				
+			}
+
+			template <class M, class I, class T, class L>
+			inline I UnstructuredMeshInterface<M,I,T,L>::getFaceNTriangles(I faceID) {
+				if(this->geometryCache.built) {
+					return this->geometryCache.faceTriXAdj[faceID + 1] - this->geometryCache.faceTriXAdj[faceID];
+				}
+
+				I nFaceVertices = this->getFaceNVertices(faceID);
+				return (nFaceVertices > 2) ? nFaceVertices - 2 : 0;
+			}
+
+			template <class M, class I, class T, class L>
+			inline void UnstructuredMeshInterface<M,I,T,L>::getFaceTriangle(I faceID, I triID, euc::EuclideanPoint<T,3>& a,
+																			 euc::EuclideanPoint<T,3>& b, euc::EuclideanPoint<T,3>& c) {
+				if(this->geometryCache.built) {
+					const T * tri = this->geometryCache.triVertices + ((this->geometryCache.faceTriXAdj[faceID] + triID) * 9);
+
+					for(int d = 0; d < 3; d++) {
+						a.cmp[d] = tri[d];
+						b.cmp[d] = tri[3 + d];
+						c.cmp[d] = tri[6 + d];
+					}
+
+					return;
+				}
+
+				a = this->getVertexPos(this->getFaceVertex(faceID, 0));
+				b = this->getVertexPos(this->getFaceVertex(faceID, triID + 1));
+				c = this->getVertexPos(this->getFaceVertex(faceID, triID + 2));
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::findCellIDs(euc::EuclideanPoint<T,3> * points, I nPoints,
+																					   I * localCellIDs, I * globalCellIDs, I * nFound) {
+				cupcfd::error::eCodes status;
+
+				*nFound = 0;
+
+				for(I i = 0; i < nPoints; i++) {
+					status = this->findCellID(points[i], localCellIDs + i, globalCellIDs + i);
+
+					if(status == cupcfd::error::E_SUCCESS) {
+						*nFound = *nFound + 1;
+					}
+					else if(status == cupcfd::error::E_GEOMETRY_NO_VALID_CELL) {
+						localCellIDs[i] = -1;
+						globalCellIDs[i] = -1;
+					}
+					else {
+						return status;
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			bool UnstructuredMeshInterface<M,I,T,L>::isPointInCell(I cellID, const euc::EuclideanPoint<T,3>& point) {
+				I nFaces = this->getCellStoredNFaces(cellID);
+
+				// (a) Find a point that is inside the cell - the average of the face vertices will be
+				// for a convex cell, even with the duplicates from shared vertices
+				T inner[3] = {T(0), T(0), T(0)};
+				I nInner = 0;
+
+				for(I i = 0; i < nFaces; i++) {
+					I faceID = this->getCellFaceID(cellID, i);
+					I nFaceVertices = this->getFaceNVertices(faceID);
+
+					for(I j = 0; j < nFaceVertices; j++) {
+						euc::EuclideanPoint<T,3> pos = this->getVertexPos(this->getFaceVertex(faceID, j));
+						for(int d = 0; d < 3; d++) {
+							inner[d] += pos.cmp[d];
+						}
+						nInner++;
+					}
+				}
+
+				if(nInner == 0) {
+					return false;
+				}
+
+				for(int d = 0; d < 3; d++) {
+					inner[d] = inner[d] / T(nInner);
+				}
+
+				// (b) For each face, check that the point is on the same side of the face plane as the inner point.
+				// The plane normal is computed with Newell's method over the face vertices, so does not depend on
+				// the stored face normal orientation.
+				for(I i = 0; i < nFaces; i++) {
+					I faceID = this->getCellFaceID(cellID, i);
+					I nFaceVertices = this->getFaceNVertices(faceID);
+
+					T norm[3] = {T(0), T(0), T(0)};
+					T center[3] = {T(0), T(0), T(0)};
+
+					euc::EuclideanPoint<T,3> prev = this->getVertexPos(this->getFaceVertex(faceID, nFaceVertices - 1));
+					for(I j = 0; j < nFaceVertices; j++) {
+						euc::EuclideanPoint<T,3> curr = this->getVertexPos(this->getFaceVertex(faceID, j));
+
+						norm[0] += (prev.cmp[1] - curr.cmp[1]) * (prev.cmp[2] + curr.cmp[2]);
+						norm[1] += (prev.cmp[2] - curr.cmp[2]) * (prev.cmp[0] + curr.cmp[0]);
+						norm[2] += (prev.cmp[0] - curr.cmp[0]) * (prev.cmp[1] + curr.cmp[1]);
+
+						for(int d = 0; d < 3; d++) {
+							center[d] += curr.cmp[d];
+						}
+
+						prev = curr;
+					}
+
+					T normMag = std::sqrt((norm[0] * norm[0]) + (norm[1] * norm[1]) + (norm[2] * norm[2]));
+					if(normMag == T(0)) {
+						// Degenerate face, cannot separate anything
+						continue;
+					}
+
+					T innerDist = T(0);
+					T pointDist = T(0);
+					T scale = T(0);
+
+					for(int d = 0; d < 3; d++) {
+						center[d] = center[d] / T(nFaceVertices);
+						innerDist += (norm[d] / normMag) * (inner[d] - center[d]);
+						pointDist += (norm[d] / normMag) * (point.cmp[d] - center[d]);
+						scale = std::max(scale, std::abs(point.cmp[d] - center[d]));
+						scale = std::max(scale, std::abs(inner[d] - center[d]));
+					}
+
+					// Points within rounding distance of the face plane are treated as being on the face
+					T tolerance = std::numeric_limits<T>::epsilon() * T(64) * scale;
+
+					if(innerDist < T(0)) {
+						pointDist = -pointDist;
+					}
+
+					if(pointDist < -tolerance) {
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::buildCellIndex() {
+				cupcfd::error::eCodes status;
+
+				// Compute the bounding box of each locally owned cell from its face vertices
+				I nCells = this->properties.lOCells;
+				I nBounds = nCells * 6;
+				T * bounds = (T *) malloc(sizeof(T) * (nBounds > 0 ? nBounds : 1));
+
+				for(I i = 0; i < nCells; i++) {
+					T * cellBounds = bounds + (i * 6);
+					bool first = true;
+
+					for(int d = 0; d < 3; d++) {
+						cellBounds[d] = T(0);
+						cellBounds[d + 3] = T(0);
+					}
+
+					I nFaces = this->getCellStoredNFaces(i);
+					for(I j = 0; j < nFaces; j++) {
+						I faceID = this->getCellFaceID(i, j);
+						I nFaceVertices = this->getFaceNVertices(faceID);
+
+						for(I k = 0; k < nFaceVertices; k++) {
+							euc::EuclideanPoint<T,3> pos = this->getVertexPos(this->getFaceVertex(faceID, k));
+
+							for(int d = 0; d < 3; d++) {
+								if(first || pos.cmp[d] < cellBounds[d]) {
+									cellBounds[d] = pos.cmp[d];
+								}
+
+								if(first || pos.cmp[d] > cellBounds[d + 3]) {
+									cellBounds[d + 3] = pos.cmp[d];
+								}
+							}
+
+							first = false;
+						}
+					}
+				}
+
+				status = this->cellIndex.build(bounds, nBounds);
+				free(bounds);
+				CHECK_ECODE(status)
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::buildGeometryCache() {
+				// Clear any existing cache so the accessors compute directly from the mesh
+				this->geometryCache.reset();
+
+				I nCells = this->properties.lOCells;
+				I nFaces = this->properties.lFaces;
+
+				// (a) Count the triangles in the fan of each face
+				I nTriangles = 0;
+				for(I i = 0; i < nFaces; i++) {
+					nTriangles = nTriangles + this->getFaceNTriangles(i);
+				}
+
+				// The cache is not marked as built until it is populated, so the accessors used
+				// below still compute their values directly from the mesh
+				this->geometryCache.allocate(nCells, nFaces, nTriangles);
+
+				T * cellDiameter = this->geometryCache.cellDiameter;
+				I * faceTriXAdj = this->geometryCache.faceTriXAdj;
+				T * triVertices = this->geometryCache.triVertices;
+				T * faceNormalUnit = this->geometryCache.faceNormalUnit;
+				T * faceEdgeLength = this->geometryCache.faceEdgeLength;
+
+				// (b) Cell diameters
+				for(I i = 0; i < nCells; i++) {
+					cellDiameter[i] = this->getCellDiameter(i);
+				}
+
+				// (c) Face triangle fans and planes
+				euc::EuclideanPoint<T,3> a;
+				euc::EuclideanPoint<T,3> b;
+				euc::EuclideanPoint<T,3> c;
+
+				I ptr = 0;
+				for(I i = 0; i < nFaces; i++) {
+					faceTriXAdj[i] = ptr;
+
+					I nFaceTriangles = this->getFaceNTriangles(i);
+					for(I j = 0; j < nFaceTriangles; j++) {
+						this->getFaceTriangle(i, j, a, b, c);
+
+						for(int d = 0; d < 3; d++) {
+							triVertices[(ptr * 9) + d] = a.cmp[d];
+							triVertices[(ptr * 9) + 3 + d] = b.cmp[d];
+							triVertices[(ptr * 9) + 6 + d] = c.cmp[d];
+						}
+
+						// Plane of the first triangle, computed as per EuclideanPlane3D
+						if(j == 0) {
+							euc::EuclideanVector3D<T> normalUnit = euc::EuclideanPlane3D<T>::calculateNormal(a, b, c);
+							normalUnit.normalise();
+
+							for(int d = 0; d < 3; d++) {
+								faceNormalUnit[(i * 3) + d] = normalUnit.cmp[d];
+							}
+
+							euc::EuclideanVector3D<T> edge = b - a;
+							faceEdgeLength[i] = edge.length();
+						}
+
+						ptr++;
+					}
+
+					if(nFaceTriangles == 0) {
+						for(int d = 0; d < 3; d++) {
+							faceNormalUnit[(i * 3) + d] = T(0);
+						}
+						faceEdgeLength[i] = T(0);
+					}
+				}
+				faceTriXAdj[nFaces] = ptr;
+
+				this->geometryCache.built = true;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::buildFaceColouring() {
+				this->faceColouring.reset();
+
+				I nFaces = this->properties.lFaces;
+				I nCells = this->properties.lTCells;
+
+				// (a) Build the cell -> face mapping from the face -> cell mapping, so that it also covers ghost cells
+				I * cellXAdj = (I *) malloc(sizeof(I) * (nCells + 1));
+				for(I i = 0; i < nCells + 1; i++) {
+					cellXAdj[i] = 0;
+				}
+
+				for(I i = 0; i < nFaces; i++) {
+					cellXAdj[this->getFaceCell1ID(i) + 1]++;
+
+					if(!this->getFaceIsBoundary(i)) {
+						cellXAdj[this->getFaceCell2ID(i) + 1]++;
+					}
+				}
+
+				I maxCellFaces = 0;
+				for(I i = 0; i < nCells; i++) {
+					if(cellXAdj[i + 1] > maxCellFaces) {
+						maxCellFaces = cellXAdj[i + 1];
+					}
+
+					cellXAdj[i + 1] = cellXAdj[i + 1] + cellXAdj[i];
+				}
+
+				I * cellAdj = (I *) malloc(sizeof(I) * (nFaces > 0 ? (nFaces * 2) : 1));
+				I * cellPtr = (I *) malloc(sizeof(I) * (nCells > 0 ? nCells : 1));
+				for(I i = 0; i < nCells; i++) {
+					cellPtr[i] = cellXAdj[i];
+				}
+
+				for(I i = 0; i < nFaces; i++) {
+					I cellID = this->getFaceCell1ID(i);
+					cellAdj[cellPtr[cellID]] = i;
+					cellPtr[cellID]++;
+
+					if(!this->getFaceIsBoundary(i)) {
+						cellID = this->getFaceCell2ID(i);
+						cellAdj[cellPtr[cellID]] = i;
+						cellPtr[cellID]++;
+					}
+				}
+
+				// (b) Greedy colouring. A face conflicts with at most (maxCellFaces - 1) faces through each of
+				// its two cells, so at most (2 * maxCellFaces) - 1 colours are needed.
+				I maxColours = (maxCellFaces > 0) ? (2 * maxCellFaces) - 1 : 1;
+				I * faceColour = (I *) malloc(sizeof(I) * (nFaces > 0 ? nFaces : 1));
+				I * colourMark = (I *) malloc(sizeof(I) * maxColours);
+
+				for(I i = 0; i < nFaces; i++) {
+					faceColour[i] = -1;
+				}
+
+				for(I i = 0; i < maxColours; i++) {
+					colourMark[i] = -1;
+				}
+
+				I nColours = 0;
+				for(I i = 0; i < nFaces; i++) {
+					I faceCells[2] = {this->getFaceCell1ID(i), -1};
+					if(!this->getFaceIsBoundary(i)) {
+						faceCells[1] = this->getFaceCell2ID(i);
+					}
+
+					// Mark the colours already used by faces sharing a cell with this face
+					for(int j = 0; j < 2; j++) {
+						if(faceCells[j] < 0) {
+							continue;
+						}
+
+						for(I k = cellXAdj[faceCells[j]]; k < cellXAdj[faceCells[j] + 1]; k++) {
+							I colour = faceColour[cellAdj[k]];
+							if(colour > -1) {
+								colourMark[colour] = i;
+							}
+						}
+					}
+
+					I colour = 0;
+					while(colourMark[colour] == i) {
+						colour++;
+					}
+
+					faceColour[i] = colour;
+					if(colour + 1 > nColours) {
+						nColours = colour + 1;
+					}
+				}
+
+				// (c) Group the faces by colour
+				this->faceColouring.allocate(nFaces, nColours);
+				I * colourXAdj = this->faceColouring.colourXAdj;
+				I * colourFaces = this->faceColouring.colourFaces;
+
+				for(I i = 0; i < nColours + 1; i++) {
+					colourXAdj[i] = 0;
+				}
+
+				for(I i = 0; i < nFaces; i++) {
+					colourXAdj[faceColour[i] + 1]++;
+				}
+
+				for(I i = 0; i < nColours; i++) {
+					colourXAdj[i + 1] = colourXAdj[i + 1] + colourXAdj[i];
+				}
+
+				// Reuse colourMark as the insertion point of each colour
+				for(I i = 0; i < nColours; i++) {
+					colourMark[i] = colourXAdj[i];
+				}
+
+				for(I i = 0; i < nFaces; i++) {
+					colourFaces[colourMark[faceColour[i]]] = i;
+					colourMark[faceColour[i]]++;
+				}
+
+				free(cellXAdj);
+				free(cellAdj);
+				free(cellPtr);
+				free(faceColour);
+				free(colourMark);
+
+				this->faceColouring.built = true;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::buildHaloFaces() {
+				this->haloFaces.reset();
+
+				I nFaces = this->properties.lFaces;
+				I nOwnedCells = this->properties.lOCells;
+
+				// Locally owned cells are numbered before the ghost cells, so a face is a halo face if
+				// either of its cells is numbered at or after the owned cells
+				std::vector<bool> isHalo(nFaces, false);
+				I nHalo = 0;
+
+				for(I i = 0; i < nFaces; i++) {
+					if(this->getFaceCell1ID(i) >= nOwnedCells ||
+					   (!this->getFaceIsBoundary(i) && this->getFaceCell2ID(i) >= nOwnedCells)) {
+						isHalo[i] = true;
+						nHalo++;
+					}
+				}
+
+				this->haloFaces.allocate(nFaces - nHalo, nHalo);
+
+				I interiorPtr = 0;
+				I haloPtr = 0;
+				for(I i = 0; i < nFaces; i++) {
+					if(isHalo[i]) {
+						this->haloFaces.haloFaces[haloPtr] = i;
+						haloPtr++;
+					}
+					else {
+						this->haloFaces.interiorFaces[interiorPtr] = i;
+						interiorPtr++;
+					}
+				}
+
+				this->haloFaces.built = true;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::buildKernelView() {
+				I nFaces = this->properties.lFaces;
+				I nCells = this->properties.lTCells;
+
+				this->kernelView.allocate(nFaces, nCells);
+				UnstructuredMeshKernelView<I,T>& view = this->kernelView;
+
+				euc::EuclideanVector3D<T> norm;
+				euc::EuclideanPoint<T,3> point;
+
+				// (a) Face connectivity and geometry
+				for(I i = 0; i < nFaces; i++) {
+					view.faceCell1[i] = this->getFaceCell1ID(i);
+					view.faceIsBoundary[i] = this->getFaceIsBoundary(i);
+
+					// Only one of these is valid for each face - the other is left as -1 rather than being read from the mesh
+					view.faceCell2[i] = view.faceIsBoundary[i] ? -1 : this->getFaceCell2ID(i);
+					view.faceBoundaryID[i] = view.faceIsBoundary[i] ? this->getFaceBoundaryID(i) : -1;
+
+					view.faceLambda[i] = this->getFaceLambda(i);
+					view.faceArea[i] = this->getFaceArea(i);
+					view.faceRLencos[i] = this->getFaceRLencos(i);
+
+					this->getFaceNorm(i, norm);
+					view.faceNormX[i] = norm.cmp[0];
+					view.faceNormY[i] = norm.cmp[1];
+					view.faceNormZ[i] = norm.cmp[2];
+
+					this->getFaceCenter(i, point);
+					view.faceCenterX[i] = point.cmp[0];
+					view.faceCenterY[i] = point.cmp[1];
+					view.faceCenterZ[i] = point.cmp[2];
+
+					this->getFaceXpac(i, point);
+					view.faceXpacX[i] = point.cmp[0];
+					view.faceXpacY[i] = point.cmp[1];
+					view.faceXpacZ[i] = point.cmp[2];
+
+					this->getFaceXnac(i, point);
+					view.faceXnacX[i] = point.cmp[0];
+					view.faceXnacY[i] = point.cmp[1];
+					view.faceXnacZ[i] = point.cmp[2];
+				}
+
+				// (b) Cell geometry
+				for(I i = 0; i < nCells; i++) {
+					this->getCellCenter(i, point);
+					view.cellCenterX[i] = point.cmp[0];
+					view.cellCenterY[i] = point.cmp[1];
+					view.cellCenterZ[i] = point.cmp[2];
+
+					view.cellVolume[i] = this->getCellVolume(i);
+				}
+
+				view.built = true;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			cupcfd::error::eCodes UnstructuredMeshInterface<M,I,T,L>::reorderCells() {
+				cupcfd::error::eCodes status;
+
+				this->reordering.reset();
+
+				// Locally owned cells are the first nLONodes nodes of the graph, followed by the ghost cells
+				cupcfd::data_structures::AdjacencyListCSR<I,I>& graph = this->cellConnGraph->connGraph;
+				I nLocal = this->cellConnGraph->nLONodes;
+
+				status = computeGraphBandwidth(graph.xadj.data(), cupcfd::utility::drivers::safeConvertSizeT<I>(graph.xadj.size()),
+											   graph.adjncy.data(), cupcfd::utility::drivers::safeConvertSizeT<I>(graph.adjncy.size()),
+											   nLocal, &(this->reordering.cellBandwidthBefore));
+				CHECK_ECODE(status)
+
+				if(this->reordering.type == MESH_REORDER_NONE) {
+					this->reordering.cellBandwidthAfter = this->reordering.cellBandwidthBefore;
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// order[i] is the current graph index of the local cell that will be numbered i
+				std::vector<I> order(nLocal);
+
+				if(this->reordering.type == MESH_REORDER_RCM) {
+					status = computeOrderingRCM(graph.xadj.data(), cupcfd::utility::drivers::safeConvertSizeT<I>(graph.xadj.size()),
+												graph.adjncy.data(), cupcfd::utility::drivers::safeConvertSizeT<I>(graph.adjncy.size()),
+												order.data(), nLocal);
+					CHECK_ECODE(status)
+				}
+				else {
+					// The cell data is still stored in the order it was added at this stage, so the center of
+					// each graph node is found through the build label
+					std::vector<T> x(nLocal);
+					std::vector<T> y(nLocal);
+					std::vector<T> z(nLocal);
+					euc::EuclideanPoint<T,3> center;
+
+					for(I i = 0; i < nLocal; i++) {
+						L label = graph.IDXToNode[i];
+						auto it = static_cast<M*>(this)->cellBuildIDToLocalID.find(label);
+						if(it == static_cast<M*>(this)->cellBuildIDToLocalID.end()) {
+							return cupcfd::error::E_INVALID_INDEX;
+						}
+
+						this->getCellCenter(it->second, center);
+						x[i] = center.cmp[0];
+						y[i] = center.cmp[1];
+						z[i] = center.cmp[2];
+					}
+
+					if(this->reordering.type == MESH_REORDER_MORTON) {
+						status = computeOrderingMorton(x.data(), y.data(), z.data(), nLocal, order.data(), nLocal);
+					}
+					else {
+						status = computeOrderingHilbert(x.data(), y.data(), z.data(), nLocal, order.data(), nLocal);
+					}
+					CHECK_ECODE(status)
+				}
+
+				// Apply the ordering to the connectivity graph by node, since the graph is rebuilt
+				std::vector<I> nodes(nLocal);
+				for(I i = 0; i < nLocal; i++) {
+					nodes[i] = graph.IDXToNode[order[i]];
+				}
+
+				status = this->cellConnGraph->reorderLocalNodes(nodes.data(), nLocal);
+				CHECK_ECODE(status)
+
+				status = computeGraphBandwidth(graph.xadj.data(), cupcfd::utility::drivers::safeConvertSizeT<I>(graph.xadj.size()),
+											   graph.adjncy.data(), cupcfd::utility::drivers::safeConvertSizeT<I>(graph.adjncy.size()),
+											   nLocal, &(this->reordering.cellBandwidthAfter));
+				CHECK_ECODE(status)
+
+				this->reordering.applied = true;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class M, class I, class T, class L>
+			T UnstructuredMeshInterface<M,I,T,L>::getCellDiameter(I cellID) {
+				if(this->geometryCache.built && cellID < this->geometryCache.nCellDiameter) {
+					return this->geometryCache.cellDiameter[cellID];
+				}
+
+				// Compute the maximum distance between any pair of vertices across the faces of the cell.
+				// Shared vertices are visited more than once, which does not change the result.
+				T diameter = T(0);
+				I nFaces = this->getCellStoredNFaces(cellID);
+
+				for(I f1 = 0; f1 < nFaces; f1++) {
+					I faceID1 = this->getCellFaceID(cellID, f1);
+					I nFaceVertices1 = this->getFaceNVertices(faceID1);
+
+					for(I j1 = 0; j1 < nFaceVertices1; j1++) {
+						euc::EuclideanPoint<T,3> pos1 = this->getVertexPos(this->getFaceVertex(faceID1, j1));
+
+						for(I f2 = f1; f2 < nFaces; f2++) {
+							I faceID2 = this->getCellFaceID(cellID, f2);
+							I nFaceVertices2 = this->getFaceNVertices(faceID2);
+
+							for(I j2 = 0; j2 < nFaceVertices2; j2++) {
+								euc::EuclideanVector3D<T> dist = pos1 - this->getVertexPos(this->getFaceVertex(faceID2, j2));
+								T length = dist.length();
+
+								if(length > diameter) {
+									diameter = length;
+								}
+							}
+						}
+					}
+				}
+
+				return diameter;
+			}
+
+			template <class M, class I, class T, class L>
+			bool UnstructuredMeshInterface<M,I,T,L>::isVectorParallelToFace(I faceID, const euc::EuclideanVector<T,3>& vec) {
+				T dotP;
+				T edgeLength;
+
+				if(this->geometryCache.built) {
+					const T * normalUnit = this->geometryCache.faceNormalUnit + (faceID * 3);
+					dotP = (normalUnit[0] * vec.cmp[0]) + (normalUnit[1] * vec.cmp[1]) + (normalUnit[2] * vec.cmp[2]);
+					edgeLength = this->geometryCache.faceEdgeLength[faceID];
+				}
+				else {
+					euc::EuclideanPoint<T,3> a;
+					euc::EuclideanPoint<T,3> b;
+					euc::EuclideanPoint<T,3> c;
+					this->getFaceTriangle(faceID, 0, a, b, c);
+
+					euc::EuclideanPlane3D<T> plane(a, b, c);
+					return plane.isVectorParallel(vec);
+				}
+
+				// Same tolerance as EuclideanPlane3D::isVectorParallel - a relatively negligible distance from the plane
+				if(cupcfd::utility::arithmetic::kernels::isEqual(dotP, T(0))) {
+					return true;
+				}
+
+				return (std::fabs(dotP) < (T(1e-10) * edgeLength));
 			}
 		
 		}
@@ -0,0 +1,224 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Declarations for the UnstructuredMeshKernelView Class
+ */
+
+#ifndef CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_KERNEL_VIEW_INCLUDE_H
+#define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_KERNEL_VIEW_INCLUDE_H
+
+#include "EuclideanPoint.h"
+#include "EuclideanVector.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			/**
+			 * Stores a flat copy of the face and cell geometry/connectivity of an unstructured mesh that is read
+			 * by the finite volume kernels, independent of the storage layout of the mesh implementation.
+			 *
+			 * Each value is stored in its own contiguous array indexed by the local face/cell ID, with vector
+			 * quantities split into separate x, y and z arrays. None of the arrays alias each other, so kernels
+			 * may access them through __restrict__ qualified pointers. Face arrays are of size nFaces, and
+			 * cell arrays are of size nCells (all local cells, including ghost cells).
+			 *
+			 * The view is a snapshot of the geometry at the time it is built, and so is not updated by any later
+			 * changes to the mesh. Stateful boundary and region values are not included, and are still accessed
+			 * through the mesh.
+			 *
+			 * This class only stores the data - it is populated by UnstructuredMeshInterface::buildKernelView.
+			 *
+			 * @tparam I Type of mesh index scheme
+			 * @tparam T Type of mesh euclidean space
+			 */
+			template <class I, class T>
+			class UnstructuredMeshKernelView
+			{
+				public:
+					// === Members ===
+
+					/** Whether the view has been populated **/
+					bool built;
+
+					/** Number of local faces, and the size of each of the face arrays **/
+					I nFaces;
+
+					/** Number of local cells (including ghost cells), and the size of each of the cell arrays **/
+					I nCells;
+
+					/** Local ID of the first cell of each face **/
+					I * faceCell1;
+
+					/** Local ID of the second cell of each face (only valid for non-boundary faces) **/
+					I * faceCell2;
+
+					/** Local ID of the boundary of each face (only valid for boundary faces) **/
+					I * faceBoundaryID;
+
+					/** Whether each face is a boundary face **/
+					bool * faceIsBoundary;
+
+					/** Interpolation factor of each face **/
+					T * faceLambda;
+
+					/** Area of each face **/
+					T * faceArea;
+
+					/** RLencos of each face **/
+					T * faceRLencos;
+
+					/** Normal of each face **/
+					T * faceNormX;
+					T * faceNormY;
+					T * faceNormZ;
+
+					/** Center of each face **/
+					T * faceCenterX;
+					T * faceCenterY;
+					T * faceCenterZ;
+
+					/** Xpac of each face **/
+					T * faceXpacX;
+					T * faceXpacY;
+					T * faceXpacZ;
+
+					/** Xnac of each face **/
+					T * faceXnacX;
+					T * faceXnacY;
+					T * faceXnacZ;
+
+					/** Center of each cell **/
+					T * cellCenterX;
+					T * cellCenterY;
+					T * cellCenterZ;
+
+					/** Volume of each cell **/
+					T * cellVolume;
+
+					// === Constructor/Deconstructors ===
+
+					/**
+					 * Default constructor. Sets up an empty, unbuilt, view.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 */
+					UnstructuredMeshKernelView();
+
+					/**
+					 * Deconstructor. Cleans up internally allocated arrays.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 */
+					~UnstructuredMeshKernelView();
+
+					/**
+					 * The view owns its arrays, so it can not be copied (a copy would free them twice).
+					 */
+					UnstructuredMeshKernelView(const UnstructuredMeshKernelView<I,T>& source) = delete;
+					UnstructuredMeshKernelView<I,T>& operator=(const UnstructuredMeshKernelView<I,T>& source) = delete;
+
+					// === Concrete Methods ===
+
+					/**
+					 * Free any internal arrays and return the view to the unbuilt state.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return Nothing
+					 */
+					void reset();
+
+					/**
+					 * Discard any existing data and allocate the arrays for a mesh of the provided size.
+					 * The contents of the arrays are left unset.
+					 *
+					 * @param nFaces The number of local faces
+					 * @param nCells The number of local cells, including ghost cells
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return Nothing
+					 */
+					void allocate(I nFaces, I nCells);
+
+					/**
+					 * Assemble the normal of a face from the separate component arrays
+					 *
+					 * @param faceID The local ID of the face
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return The face normal
+					 */
+					inline cupcfd::geometry::euclidean::EuclideanVector<T,3> faceNorm(I faceID) const;
+
+					/**
+					 * Assemble the center of a face from the separate component arrays
+					 *
+					 * @param faceID The local ID of the face
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return The face center
+					 */
+					inline cupcfd::geometry::euclidean::EuclideanPoint<T,3> faceCenter(I faceID) const;
+
+					/**
+					 * Assemble the xpac point of a face from the separate component arrays
+					 *
+					 * @param faceID The local ID of the face
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return The face xpac point
+					 */
+					inline cupcfd::geometry::euclidean::EuclideanPoint<T,3> faceXpac(I faceID) const;
+
+					/**
+					 * Assemble the xnac point of a face from the separate component arrays
+					 *
+					 * @param faceID The local ID of the face
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return The face xnac point
+					 */
+					inline cupcfd::geometry::euclidean::EuclideanPoint<T,3> faceXnac(I faceID) const;
+
+					/**
+					 * Assemble the center of a cell from the separate component arrays
+					 *
+					 * @param cellID The local ID of the cell
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return The cell center
+					 */
+					inline cupcfd::geometry::euclidean::EuclideanPoint<T,3> cellCenter(I cellID) const;
+			};
+		}
+	}
+}
+
+// Include Header Level Definitions
+#include "UnstructuredMeshKernelView.ipp"
+
+#endif
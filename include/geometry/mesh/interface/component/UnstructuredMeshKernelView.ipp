@@ -0,0 +1,50 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Header Level Definitions for the UnstructuredMeshKernelView Class
+ */
+
+#ifndef CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_KERNEL_VIEW_IPP_H
+#define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_KERNEL_VIEW_IPP_H
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T>
+			inline cupcfd::geometry::euclidean::EuclideanVector<T,3> UnstructuredMeshKernelView<I,T>::faceNorm(I faceID) const {
+				return cupcfd::geometry::euclidean::EuclideanVector<T,3>(this->faceNormX[faceID], this->faceNormY[faceID], this->faceNormZ[faceID]);
+			}
+
+			template <class I, class T>
+			inline cupcfd::geometry::euclidean::EuclideanPoint<T,3> UnstructuredMeshKernelView<I,T>::faceCenter(I faceID) const {
+				return cupcfd::geometry::euclidean::EuclideanPoint<T,3>(this->faceCenterX[faceID], this->faceCenterY[faceID], this->faceCenterZ[faceID]);
+			}
+
+			template <class I, class T>
+			inline cupcfd::geometry::euclidean::EuclideanPoint<T,3> UnstructuredMeshKernelView<I,T>::faceXpac(I faceID) const {
+				return cupcfd::geometry::euclidean::EuclideanPoint<T,3>(this->faceXpacX[faceID], this->faceXpacY[faceID], this->faceXpacZ[faceID]);
+			}
+
+			template <class I, class T>
+			inline cupcfd::geometry::euclidean::EuclideanPoint<T,3> UnstructuredMeshKernelView<I,T>::faceXnac(I faceID) const {
+				return cupcfd::geometry::euclidean::EuclideanPoint<T,3>(this->faceXnacX[faceID], this->faceXnacY[faceID], this->faceXnacZ[faceID]);
+			}
+
+			template <class I, class T>
+			inline cupcfd::geometry::euclidean::EuclideanPoint<T,3> UnstructuredMeshKernelView<I,T>::cellCenter(I cellID) const {
+				return cupcfd::geometry::euclidean::EuclideanPoint<T,3>(this->cellCenterX[cellID], this->cellCenterY[cellID], this->cellCenterZ[cellID]);
+			}
+		}
+	}
+}
+
+#endif
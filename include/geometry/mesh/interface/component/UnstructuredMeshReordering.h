@@ -0,0 +1,240 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Declarations for the UnstructuredMeshReordering Class, and the cell ordering methods it selects between
+ */
+
+#ifndef CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_REORDERING_INCLUDE_H
+#define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_REORDERING_INCLUDE_H
+
+#include "Error.h"
+
+#include <cstdint>
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			/**
+			 * Methods for renumbering the locally owned cells of a mesh during finalize
+			 */
+			enum MeshReorderType
+			{
+				/** Keep the order of the connectivity graph (ascending cell label) **/
+				MESH_REORDER_NONE,
+
+				/** Reverse Cuthill-McKee ordering of the local cell graph **/
+				MESH_REORDER_RCM,
+
+				/** Morton (Z-order) space-filling curve ordering of the cell centers **/
+				MESH_REORDER_MORTON,
+
+				/** Hilbert space-filling curve ordering of the cell centers **/
+				MESH_REORDER_HILBERT
+			};
+
+			/**
+			 * Stores the cell reordering selected for an unstructured mesh, and the locality of the
+			 * cell numbering before and after it was applied.
+			 *
+			 * Locality is measured as the mean bandwidth of the local cell graph, i.e. the mean of
+			 * |i - j| over all edges between locally owned cells i and j. A lower value means that the
+			 * two cells of a face are, on average, closer together in memory.
+			 *
+			 * This class only stores the data - the reordering is applied by UnstructuredMeshInterface::reorderCells.
+			 *
+			 * @tparam I Type of mesh index scheme
+			 * @tparam T Type of mesh euclidean space
+			 */
+			template <class I, class T>
+			class UnstructuredMeshReordering
+			{
+				public:
+					// === Members ===
+
+					/** The reordering to apply during finalize **/
+					MeshReorderType type;
+
+					/** Whether the reordering has been applied **/
+					bool applied;
+
+					/** Mean bandwidth of the local cell graph before reordering **/
+					T cellBandwidthBefore;
+
+					/** Mean bandwidth of the local cell graph after reordering **/
+					T cellBandwidthAfter;
+
+					// === Constructor/Deconstructors ===
+
+					/**
+					 * Default constructor. No reordering is selected.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 */
+					UnstructuredMeshReordering();
+
+					/**
+					 * Deconstructor.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 */
+					~UnstructuredMeshReordering();
+
+					// === Concrete Methods ===
+
+					/**
+					 * Return to the unapplied state. The selected type is kept.
+					 *
+					 * @tparam I Type of mesh index scheme
+					 * @tparam T Type of mesh euclidean space
+					 *
+					 * @return Nothing
+					 */
+					void reset();
+			};
+
+			/**
+			 * Compute the mean bandwidth of a graph stored in CSR format, considering only
+			 * the edges between the first nNodes nodes.
+			 *
+			 * @param xadj The CSR offsets of each node in adjncy
+			 * @param nXAdj The size of xadj in elements of type I (at least nNodes + 1)
+			 * @param adjncy The adjacent nodes of each node
+			 * @param nAdjncy The size of adjncy in elements of type I
+			 * @param nNodes The number of nodes to consider
+			 * @param bandwidth A pointer to the location to store the result. Zero if there are no edges.
+			 *
+			 * @tparam I Type of mesh index scheme
+			 * @tparam T Type of the result
+			 *
+			 * @return An error status indicating the success or failure of the operation
+			 * @retval cupcfd::error::E_SUCCESS Success
+			 * @retval cupcfd::error::E_ARRAY_SIZE_UNDERSIZED xadj is too small for nNodes
+			 */
+			template <class I, class T>
+			__attribute__((warn_unused_result))
+			cupcfd::error::eCodes computeGraphBandwidth(const I * xadj, I nXAdj, const I * adjncy, I nAdjncy,
+														I nNodes, T * bandwidth);
+
+			/**
+			 * Compute a Reverse Cuthill-McKee ordering of the first nNodes nodes of a graph stored in CSR format.
+			 * Edges to nodes outside of this range are ignored.
+			 *
+			 * Each connected component is numbered in turn by a breadth first search from its node of lowest degree,
+			 * visiting the neighbours of each node in order of increasing degree. The complete ordering is then reversed.
+			 *
+			 * @param xadj The CSR offsets of each node in adjncy
+			 * @param nXAdj The size of xadj in elements of type I (at least nNodes + 1)
+			 * @param adjncy The adjacent nodes of each node
+			 * @param nAdjncy The size of adjncy in elements of type I
+			 * @param order The array to store the ordering in. order[i] is the current index of the node to place at i.
+			 * @param nOrder The size of order in elements of type I. This is the number of nodes to order.
+			 *
+			 * @tparam I Type of mesh index scheme
+			 *
+			 * @return An error status indicating the success or failure of the operation
+			 * @retval cupcfd::error::E_SUCCESS Success
+			 * @retval cupcfd::error::E_ARRAY_SIZE_UNDERSIZED xadj is too small for nOrder
+			 */
+			template <class I>
+			__attribute__((warn_unused_result))
+			cupcfd::error::eCodes computeOrderingRCM(const I * xadj, I nXAdj, const I * adjncy, I nAdjncy,
+													 I * order, I nOrder);
+
+			/**
+			 * Compute the position of a grid cell along a Morton (Z-order) or Hilbert space-filling curve.
+			 *
+			 * @param X The grid position of the cell in each dimension, using the lowest nBits bits. This is
+			 * overwritten during the computation.
+			 * @param nBits The number of bits per dimension of the grid (at most 21)
+			 * @param hilbert Use the Hilbert curve if true, the Morton curve otherwise
+			 *
+			 * @return The position of the cell along the curve
+			 */
+			inline std::uint64_t computeCurveKey(std::uint32_t X[3], int nBits, bool hilbert);
+
+			/**
+			 * Compute an ordering of points along a Morton (Z-order) space-filling curve over their bounding box.
+			 *
+			 * @param x The x coordinate of each point
+			 * @param y The y coordinate of each point
+			 * @param z The z coordinate of each point
+			 * @param nPoints The number of points (and the size of x, y and z)
+			 * @param order The array to store the ordering in. order[i] is the current index of the point to place at i.
+			 * @param nOrder The size of order in elements of type I
+			 *
+			 * @tparam I Type of mesh index scheme
+			 * @tparam T Type of mesh euclidean space
+			 *
+			 * @return An error status indicating the success or failure of the operation
+			 * @retval cupcfd::error::E_SUCCESS Success
+			 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH nOrder does not match nPoints
+			 */
+			template <class I, class T>
+			__attribute__((warn_unused_result))
+			cupcfd::error::eCodes computeOrderingMorton(const T * x, const T * y, const T * z, I nPoints,
+														I * order, I nOrder);
+
+			/**
+			 * Compute an ordering of points along a Hilbert space-filling curve over their bounding box.
+			 *
+			 * Unlike the Morton curve, consecutive positions along the Hilbert curve are always adjacent, so it
+			 * generally gives better locality at a slightly higher cost to compute.
+			 *
+			 * @param x The x coordinate of each point
+			 * @param y The y coordinate of each point
+			 * @param z The z coordinate of each point
+			 * @param nPoints The number of points (and the size of x, y and z)
+			 * @param order The array to store the ordering in. order[i] is the current index of the point to place at i.
+			 * @param nOrder The size of order in elements of type I
+			 *
+			 * @tparam I Type of mesh index scheme
+			 * @tparam T Type of mesh euclidean space
+			 *
+			 * @return An error status indicating the success or failure of the operation
+			 * @retval cupcfd::error::E_SUCCESS Success
+			 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH nOrder does not match nPoints
+			 */
+			template <class I, class T>
+			__attribute__((warn_unused_result))
+			cupcfd::error::eCodes computeOrderingHilbert(const T * x, const T * y, const T * z, I nPoints,
+														 I * order, I nOrder);
+
+			/**
+			 * Compute an ordering of faces that groups them by the lower numbered of their two cells, so that face
+			 * loops walk through the cell data in order. Faces of the same cell are ordered by their other cell,
+			 * with boundary faces first.
+			 *
+			 * @param cell1 The first cell of each face
+			 * @param cell2 The second cell of each face, or a negative value for boundary faces
+			 * @param nFaces The number of faces (and the size of cell1 and cell2)
+			 * @param order The array to store the ordering in. order[i] is the current index of the face to place at i.
+			 * @param nOrder The size of order in elements of type I
+			 *
+			 * @tparam I Type of mesh index scheme
+			 *
+			 * @return An error status indicating the success or failure of the operation
+			 * @retval cupcfd::error::E_SUCCESS Success
+			 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH nOrder does not match nFaces
+			 */
+			template <class I>
+			__attribute__((warn_unused_result))
+			cupcfd::error::eCodes computeFaceOrderingByCell(const I * cell1, const I * cell2, I nFaces, I * order, I nOrder);
+		}
+	}
+}
+
+// Include Header Level Definitions
+#include "UnstructuredMeshReordering.ipp"
+
+#endif
@@ -0,0 +1,279 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Header Level Definitions for the cell ordering methods of UnstructuredMeshReordering
+ */
+
+#ifndef CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_REORDERING_IPP_H
+#define CUPCFD_GEOMETRY_UNSTRUCTURED_MESH_REORDERING_IPP_H
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T>
+			cupcfd::error::eCodes computeGraphBandwidth(const I * xadj, I nXAdj, const I * adjncy, I nAdjncy __attribute__((unused)),
+														I nNodes, T * bandwidth) {
+				if(nNodes > 0 && nXAdj < nNodes + 1) {
+					return cupcfd::error::E_ARRAY_SIZE_UNDERSIZED;
+				}
+
+				double sum = 0.0;
+				I nEdges = 0;
+
+				for(I i = 0; i < nNodes; i++) {
+					for(I j = xadj[i]; j < xadj[i + 1]; j++) {
+						I adj = adjncy[j];
+
+						if(adj < nNodes) {
+							sum = sum + ((adj > i) ? (adj - i) : (i - adj));
+							nEdges++;
+						}
+					}
+				}
+
+				*bandwidth = (nEdges > 0) ? T(sum / nEdges) : T(0);
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I>
+			cupcfd::error::eCodes computeOrderingRCM(const I * xadj, I nXAdj, const I * adjncy, I nAdjncy __attribute__((unused)),
+													 I * order, I nOrder) {
+				if(nOrder > 0 && nXAdj < nOrder + 1) {
+					return cupcfd::error::E_ARRAY_SIZE_UNDERSIZED;
+				}
+
+				// Degree of each node, counting only edges within the range being ordered
+				std::vector<I> degree(nOrder, 0);
+				for(I i = 0; i < nOrder; i++) {
+					for(I j = xadj[i]; j < xadj[i + 1]; j++) {
+						if(adjncy[j] < nOrder) {
+							degree[i]++;
+						}
+					}
+				}
+
+				// Candidate start nodes, in order of increasing degree
+				std::vector<I> byDegree(nOrder);
+				for(I i = 0; i < nOrder; i++) {
+					byDegree[i] = i;
+				}
+				std::stable_sort(byDegree.begin(), byDegree.end(), [&degree](I a, I b) { return degree[a] < degree[b]; });
+
+				std::vector<bool> visited(nOrder, false);
+				std::vector<I> neighbours;
+				I head = 0;
+				I tail = 0;
+
+				// The order array doubles as the breadth first search queue
+				for(I s = 0; s < nOrder; s++) {
+					I start = byDegree[s];
+					if(visited[start]) {
+						continue;
+					}
+
+					visited[start] = true;
+					order[tail] = start;
+					tail++;
+
+					while(head < tail) {
+						I node = order[head];
+						head++;
+
+						neighbours.clear();
+						for(I j = xadj[node]; j < xadj[node + 1]; j++) {
+							I adj = adjncy[j];
+							if(adj < nOrder && !visited[adj]) {
+								visited[adj] = true;
+								neighbours.push_back(adj);
+							}
+						}
+
+						std::stable_sort(neighbours.begin(), neighbours.end(), [&degree](I a, I b) { return degree[a] < degree[b]; });
+
+						for(auto it = neighbours.begin(); it != neighbours.end(); it++) {
+							order[tail] = *it;
+							tail++;
+						}
+					}
+				}
+
+				std::reverse(order, order + nOrder);
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			inline std::uint64_t computeCurveKey(std::uint32_t X[3], int nBits, bool hilbert) {
+				if(hilbert) {
+					// Convert the grid position to the transposed Hilbert index
+					// (J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004)
+					std::uint32_t M = std::uint32_t(1) << (nBits - 1);
+
+					for(std::uint32_t Q = M; Q > 1; Q >>= 1) {
+						std::uint32_t P = Q - 1;
+
+						for(int d = 0; d < 3; d++) {
+							if(X[d] & Q) {
+								X[0] ^= P;
+							}
+							else {
+								std::uint32_t t = (X[0] ^ X[d]) & P;
+								X[0] ^= t;
+								X[d] ^= t;
+							}
+						}
+					}
+
+					// Gray encode
+					for(int d = 1; d < 3; d++) {
+						X[d] ^= X[d - 1];
+					}
+
+					std::uint32_t t = 0;
+					for(std::uint32_t Q = M; Q > 1; Q >>= 1) {
+						if(X[2] & Q) {
+							t ^= Q - 1;
+						}
+					}
+
+					for(int d = 0; d < 3; d++) {
+						X[d] ^= t;
+					}
+				}
+
+				// Interleave the bits, most significant first. For the Morton curve this is the key
+				// directly, for the Hilbert curve this converts the transposed index into the key.
+				std::uint64_t key = 0;
+				for(int b = nBits - 1; b >= 0; b--) {
+					for(int d = 0; d < 3; d++) {
+						key = (key << 1) | ((X[d] >> b) & 1);
+					}
+				}
+
+				return key;
+			}
+
+			/**
+			 * Shared implementation of the space-filling curve orderings. Each point is quantised onto a
+			 * grid of 2^21 cells per dimension over the bounding box, and the points are sorted by the
+			 * position of their grid cell along the curve.
+			 */
+			template <class I, class T>
+			cupcfd::error::eCodes computeOrderingCurve(const T * x, const T * y, const T * z, I nPoints,
+													   I * order, I nOrder, bool hilbert) {
+				if(nOrder != nPoints) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				if(nPoints == 0) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				const int nBits = 21;
+				const T * coords[3] = {x, y, z};
+
+				T lower[3];
+				T upper[3];
+				for(int d = 0; d < 3; d++) {
+					lower[d] = coords[d][0];
+					upper[d] = coords[d][0];
+
+					for(I i = 1; i < nPoints; i++) {
+						lower[d] = std::min(lower[d], coords[d][i]);
+						upper[d] = std::max(upper[d], coords[d][i]);
+					}
+				}
+
+				// Use the same scale in every dimension so the curve is not distorted for elongated domains
+				T extent = T(0);
+				for(int d = 0; d < 3; d++) {
+					extent = std::max(extent, upper[d] - lower[d]);
+				}
+
+				const double maxCoord = double((std::uint32_t(1) << nBits) - 1);
+				double scale = (extent > T(0)) ? (maxCoord / double(extent)) : 0.0;
+
+				std::vector<std::pair<std::uint64_t, I>> keys(nPoints);
+
+				for(I i = 0; i < nPoints; i++) {
+					std::uint32_t X[3];
+
+					for(int d = 0; d < 3; d++) {
+						double pos = double(coords[d][i] - lower[d]) * scale;
+						X[d] = std::uint32_t(std::min(std::max(pos, 0.0), maxCoord));
+					}
+
+					keys[i] = std::make_pair(computeCurveKey(X, nBits, hilbert), i);
+				}
+
+				// Ties are broken by the current index, so the ordering is deterministic
+				std::sort(keys.begin(), keys.end());
+
+				for(I i = 0; i < nPoints; i++) {
+					order[i] = keys[i].second;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes computeOrderingMorton(const T * x, const T * y, const T * z, I nPoints,
+														I * order, I nOrder) {
+				return computeOrderingCurve(x, y, z, nPoints, order, nOrder, false);
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes computeOrderingHilbert(const T * x, const T * y, const T * z, I nPoints,
+														 I * order, I nOrder) {
+				return computeOrderingCurve(x, y, z, nPoints, order, nOrder, true);
+			}
+
+			template <class I>
+			cupcfd::error::eCodes computeFaceOrderingByCell(const I * cell1, const I * cell2, I nFaces, I * order, I nOrder) {
+				if(nOrder != nFaces) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				// Sort key of (lower cell, higher cell), with boundary faces having a higher cell of -1
+				std::vector<std::pair<std::pair<I, I>, I>> keys(nFaces);
+				for(I i = 0; i < nFaces; i++) {
+					I lo = cell1[i];
+					I hi = cell2[i];
+
+					if(hi < 0) {
+						hi = -1;
+					}
+					else if(hi < lo) {
+						std::swap(lo, hi);
+					}
+
+					keys[i] = std::make_pair(std::make_pair(lo, hi), i);
+				}
+
+				std::sort(keys.begin(), keys.end());
+
+				for(I i = 0; i < nFaces; i++) {
+					order[i] = keys[i].second;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+		}
+	}
+}
+
+#endif
@@ -16,6 +16,9 @@
 // Mesh Sources
 #include "MeshSource.h"
 
+// Communication
+#include "Communicator.h"
+
 // Error Codes
 #include "Error.h"
 
@@ -70,6 +73,27 @@ namespace cupcfd
 					 */
 					__attribute__((warn_unused_result))
 					virtual cupcfd::error::eCodes buildMeshSource(MeshSource<I,T,L> ** source) = 0;
+
+					// === Virtual Methods ===
+
+					/**
+					 * Build a mesh source based on the details specified in the configuration file,
+					 * for use by all processes of a communicator. This is a collective operation.
+					 *
+					 * Sources that can share their reads across processes (e.g. parallel file access)
+					 * should override this. By default it builds the same source as buildMeshSource(source).
+					 *
+					 * @param A pointer to where the newly created MeshSource object pointer will be stored.
+					 * @param comm The communicator of all processes that will read from the source
+					 *
+					 * @tparam I The type of the indexing system
+					 * @tparam T The type of the mesh structural data
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @return cupcfd::error::E_SUCCESS Success
+					 */
+					__attribute__((warn_unused_result))
+					virtual cupcfd::error::eCodes buildMeshSource(MeshSource<I,T,L> ** source, cupcfd::comm::Communicator& comm);
 			};
 		}
 	}
@@ -636,6 +636,9 @@ namespace cupcfd
 					 * The nodes assigned are determined by the provided labels. The node labels should
 					 * be unique to a rank - they should not be assigned on more than one rank.
 					 *
+					 * By default the edges are found from the cell faces and the cells either side of them.
+					 * Sources that can determine the neighbours of a cell directly may override this.
+					 *
 					 * @param graph A pointer to where the newly created graph object pointer will be stored.
 					 * @param comm The communicator of all processes that will be members of the distributed graph
 					 * @param source The source of the mesh data that contains the connectivity information.
@@ -650,7 +653,7 @@ namespace cupcfd
 					 * @retval cupcfd::error::E_SUCCESS The method completed successfully
 					 */
 					__attribute__((warn_unused_result))
-					cupcfd::error::eCodes buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,I>& graph,
+					virtual cupcfd::error::eCodes buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,I>& graph,
 																		L *cellLabels, I nCellLabels);
 
 					/**
@@ -691,6 +694,39 @@ namespace cupcfd
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,I>& graph,
 																		cupcfd::comm::Communicator& comm);
+
+					/**
+					 * Get the labels of the cells this process should own, if the source can decompose the mesh
+					 * across the processes of a communicator itself. This is a collective operation.
+					 *
+					 * Where this is available, the cells can be assigned directly without building a naive
+					 * connectivity graph and partitioning it.
+					 *
+					 * @param cellLabels A pointer to where the pointer to a newly allocated array of the cell labels
+					 * owned by this process will be stored. The array should be freed by the caller.
+					 * @param nCellLabels A pointer to where the number of cell labels will be stored
+					 * @param comm The communicator of all processes the mesh will be decomposed across
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_NOT_IMPLEMENTED This source does not provide a decomposition
+					 */
+					__attribute__((warn_unused_result))
+					virtual cupcfd::error::eCodes getCellDecomposition(L ** cellLabels, I * nCellLabels, cupcfd::comm::Communicator& comm);
+
+					/**
+					 * Get the volume of data read from the underlying storage by this source, and the time
+					 * spent reading it. This permits the read throughput of mesh loading to be reported.
+					 *
+					 * @param bytesRead A pointer to where the number of bytes read will be stored
+					 * @param readTime A pointer to where the time spent reading, in seconds, will be stored
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_NOT_IMPLEMENTED This source does not record its reads
+					 */
+					__attribute__((warn_unused_result))
+					virtual cupcfd::error::eCodes getReadStatistics(unsigned long long * bytesRead, double * readTime);
 			};
 		}
 	}
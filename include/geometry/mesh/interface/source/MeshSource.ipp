@@ -196,6 +196,21 @@ namespace cupcfd
 
 				return cupcfd::error::E_SUCCESS;
 			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSource<I,T,L>::getCellDecomposition(L ** cellLabels __attribute__((unused)),
+																		  I * nCellLabels __attribute__((unused)),
+																		  cupcfd::comm::Communicator& comm __attribute__((unused)))
+			{
+				return cupcfd::error::E_NOT_IMPLEMENTED;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSource<I,T,L>::getReadStatistics(unsigned long long * bytesRead __attribute__((unused)),
+																	   double * readTime __attribute__((unused)))
+			{
+				return cupcfd::error::E_NOT_IMPLEMENTED;
+			}
 		}
 	}
 }
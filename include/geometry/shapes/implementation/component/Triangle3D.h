@@ -109,6 +109,35 @@ namespace cupcfd
 												T& timeToIntersect, 
 												bool* onEdge,
 												bool verbose) const;
+
+					// === Static Methods ===
+
+					/**
+					 * Calculate intersection of a moving point with the triangle formed by three vertices,
+					 * without constructing a Triangle3D object.
+					 *
+					 * @param vertex0 The first vertex of the triangle
+					 * @param vertex1 The second vertex of the triangle
+					 * @param vertex2 The third vertex of the triangle
+					 * @param v0 The point position
+					 * @param velocity The point velocity
+					 * @param intersection Calculated intersection point
+					 * @param timeToIntersect Time to intersect
+					 * @param onEdge Is intersection point on triangle edge
+					 * @param verbose Enable debugging print statements.
+					 *
+					 * @return True if the ray intersects
+					 */
+					__attribute__((warn_unused_result))
+					static bool calculateIntersection(const euc::EuclideanPoint<T,3>& vertex0,
+													  const euc::EuclideanPoint<T,3>& vertex1,
+													  const euc::EuclideanPoint<T,3>& vertex2,
+													  const euc::EuclideanPoint<T,3>& v0,
+													  const euc::EuclideanVector<T,3>& velocity,
+													  euc::EuclideanPoint<T,3>& intersection,
+													  T& timeToIntersect,
+													  bool* onEdge,
+													  bool verbose);
 			};
 		}
 	}
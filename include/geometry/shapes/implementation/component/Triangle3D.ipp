@@ -78,10 +78,25 @@ namespace cupcfd
 														T& timeToIntersect, 
 														bool* onEdge,
 														bool verbose) const
+			{
+				return Triangle3D<T>::calculateIntersection(this->vertices[0], this->vertices[1], this->vertices[2],
+															v0, velocity, intersection, timeToIntersect, onEdge, verbose);
+			}
+
+			template <class T>
+			bool Triangle3D<T>::calculateIntersection(const euc::EuclideanPoint<T,3>& vertex0,
+													  const euc::EuclideanPoint<T,3>& vertex1,
+													  const euc::EuclideanPoint<T,3>& vertex2,
+													  const euc::EuclideanPoint<T,3>& v0,
+													  const euc::EuclideanVector<T,3>& velocity,
+													  euc::EuclideanPoint<T,3>& intersection,
+													  T& timeToIntersect,
+													  bool* onEdge,
+													  bool verbose)
 			{
 				// http://www.lighthouse3d.com/tutorials/maths/ray-triangle-intersection
-				euc::EuclideanVector3D<T> e1 = this->vertices[1] - this->vertices[0];
-				euc::EuclideanVector3D<T> e2 = this->vertices[2] - this->vertices[0];
+				euc::EuclideanVector3D<T> e1 = vertex1 - vertex0;
+				euc::EuclideanVector3D<T> e2 = vertex2 - vertex0;
 				
 				euc::EuclideanVector3D<T> vel(velocity);
 				euc::EuclideanVector3D<T> h = vel.crossProduct(e2);
@@ -90,7 +105,7 @@ namespace cupcfd
 
 				T f = T(1)/a;
 
-				euc::EuclideanVector3D<T> s = v0 - this->vertices[0];
+				euc::EuclideanVector3D<T> s = v0 - vertex0;
 
 				T u = f * s.dotProduct(h);
 
@@ -103,7 +118,7 @@ namespace cupcfd
 					t = T(0);
 				}
 
-				intersection = (T(1)-u-v)*this->vertices[0] + u*this->vertices[1] + v*this->vertices[2];
+				intersection = (T(1)-u-v)*vertex0 + u*vertex1 + v*vertex2;
 
 				if (u < T(0.0) || u > T(1.0)) {
 					return false;
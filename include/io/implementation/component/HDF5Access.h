@@ -19,6 +19,7 @@
 
 #include "HDF5Record.h"
 #include "HDF5Properties.h"
+#include "HDF5File.h"
 #include "Error.h"
 
 namespace cupcfd
@@ -38,6 +39,10 @@ namespace cupcfd
 			 * open/active file, group, datasets etc.
 			 * It also provides the access functions for retrieving data.
 			 * Currently only handles reading data, not writing data.
+			 *
+			 * Indexed reads coalesce the requested indexes into hyperslab blocks where possible.
+			 * Indexes that are not in ascending order (or contain duplicates) are read in ascending
+			 * order and then rearranged, so the data is always returned in the order requested.
 			 */
 			class HDF5Access
 			{
@@ -65,6 +70,12 @@ namespace cupcfd
 					/** Name of open file **/
 					std::string fileName;
 
+					/**
+					 * The open file this object accesses data through, or nullptr if this
+					 * object opened (and will close) the file itself.
+					 **/
+					HDF5File * file;
+
 					/**
 					 * Data record for HDF5 Data being accessed from file.
 					 * Contains record name, group name etc.
@@ -82,6 +93,19 @@ namespace cupcfd
 					 */
 					HDF5Access(std::string fileName, HDF5Record& record);
 
+					/**
+					 * Constructor: Tracks access to an already open file
+					 * for specified data record.
+					 *
+					 * The file is not closed when this object is destroyed, and dataset
+					 * reads use the transfer properties of the file (e.g. collective MPI-IO).
+					 * Reads are recorded in the read statistics of the file.
+					 *
+					 * @param file Open file to access data from
+					 * @param record Data record to access from file.
+					 */
+					HDF5Access(HDF5File& file, HDF5Record& record);
+
 					/**
 					 * Deconstructor:
 					 * Cleans up any open accessors, records etc.
@@ -90,6 +114,8 @@ namespace cupcfd
 
 					/**
 					 * Open the HDF5 file tracked by this object.
+					 * The file is opened read-only. If this object accesses an already
+					 * open HDF5File, that file is used instead.
 					 *
 					 * @return An error status indicating the success or failure of the operation
 					 * @retval cupcfd::error::E_SUCCESS Operation was successful
@@ -265,6 +291,15 @@ namespace cupcfd
 					 */
 					__attribute__((warn_unused_result))
 					cupcfd::error::eCodes readData(double ** sink, HDF5Properties& properties);
+
+				private:
+					/**
+					 * Open the file (if not already open), and the group, dataset/attribute
+					 * and dataspace of the tracked record.
+					 *
+					 * @return Nothing
+					 */
+					void openRecord();
 			};
 		}
 	}
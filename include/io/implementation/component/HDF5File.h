@@ -0,0 +1,140 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Declarations for HDF5File class.
+ */
+
+#ifndef CUPCFD_IO_HDF5_FILE_INCLUDE_H
+#define CUPCFD_IO_HDF5_FILE_INCLUDE_H
+
+#include "hdf5.h"
+#include "mpi.h"
+#include <string>
+
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace io
+	{
+		namespace hdf5
+		{
+			/**
+			 * HDF5File Class.
+			 * Holds a HDF5 file open for reading, so that many records can be accessed
+			 * through HDF5Access objects without reopening the file for each one.
+			 *
+			 * The file is always opened read-only. If HDF5 was built with parallel support and
+			 * a communicator is provided, the file is opened through the MPI-IO driver and
+			 * dataset reads may use collective transfers.
+			 *
+			 * The volume of data read through this file and the time spent reading it are
+			 * recorded, so that the read throughput can be reported.
+			 */
+			class HDF5File
+			{
+				public:
+					// === Members ===
+
+					/** HDF5 File ID of the open file **/
+					hid_t fileID;
+
+					/** HDF5 Dataset Transfer Property List used for dataset reads from this file **/
+					hid_t xferID;
+
+					/** Name of the open file **/
+					std::string fileName;
+
+					/**
+					 * Whether dataset reads use collective MPI-IO transfers.
+					 * If true, every rank of the communicator the file was opened with must make
+					 * the same sequence of dataset reads (ranks with nothing to read select no indexes).
+					 **/
+					bool collective;
+
+					/** Number of bytes read from this file since the last reset **/
+					unsigned long long bytesRead;
+
+					/** Time spent reading from this file since the last reset, in seconds **/
+					double readTime;
+
+					/** Number of reads made from this file since the last reset **/
+					unsigned long long nReads;
+
+					// === Constructors/Deconstructors ===
+
+					/**
+					 * Constructor: Open the specified file read-only for independent access
+					 * by this process.
+					 *
+					 * @param fileName File to open
+					 */
+					HDF5File(std::string fileName);
+
+					/**
+					 * Constructor: Open the specified file read-only across all processes of a
+					 * communicator. This is a collective operation over comm.
+					 *
+					 * If HDF5 was built with parallel support, the file is opened with the MPI-IO driver,
+					 * and dataset reads use collective transfers if collective is true. Otherwise the file
+					 * is opened independently by each process, as with the serial constructor.
+					 *
+					 * @param fileName File to open
+					 * @param comm The communicator of all processes that will read from the file
+					 * @param collective Whether dataset reads should use collective transfers
+					 */
+					HDF5File(std::string fileName, MPI_Comm comm, bool collective);
+
+					/**
+					 * Deconstructor:
+					 * Closes the file and the transfer property list.
+					 */
+					~HDF5File();
+
+					// === Concrete Methods ===
+
+					/**
+					 * Record a read of the specified size and duration.
+					 *
+					 * @param bytes The number of bytes read
+					 * @param time The time taken for the read, in seconds
+					 *
+					 * @return Nothing
+					 */
+					void recordRead(unsigned long long bytes, double time);
+
+					/**
+					 * Reset the recorded read statistics.
+					 *
+					 * @return Nothing
+					 */
+					void resetStatistics();
+
+					/**
+					 * Get the mean rate at which data has been read from this file since the last reset.
+					 *
+					 * @return The read rate in bytes per second, or zero if no time has been spent reading.
+					 */
+					double getReadRate();
+
+				private:
+					/**
+					 * Open the file with the specified file access property list.
+					 *
+					 * @param faplID The file access property list to open the file with
+					 *
+					 * @return Nothing
+					 */
+					void openFile(hid_t faplID);
+			};
+		}
+	}
+}
+
+#endif
@@ -39,9 +39,22 @@ namespace cupcfd
 					std::vector<unsigned long long> idx;
 					hid_t memspaceID;		// Active Memory Space
 
+					// Whether reads are restricted to the stored indexes (even if there are none)
+					bool indexed;
+
 					HDF5Properties(HDF5Access& access);
 					~HDF5Properties();
 
+					/**
+					 * Clear any stored indexes, and restrict reads to only those indexes added
+					 * afterwards. Until an index is added, a read will select no data rather
+					 * than the whole record.
+					 *
+					 * This permits a process with nothing to read to still take part in a
+					 * collective read.
+					 */
+					void selectNone();
+
 					/**
 					 *
 					 */
@@ -87,6 +100,29 @@ namespace cupcfd
 									unsigned long long v,
 									unsigned long long w);
 			};
+
+			/**
+			 * Coalesce a list of indexes into the rectangular blocks of a HDF5 hyperslab selection.
+			 *
+			 * Runs of indexes that are consecutive along the last dimension are merged into a single
+			 * block, and blocks that are identical apart from being consecutive along the second to last
+			 * dimension are merged in turn (e.g. whole rows, or a run of rows in the same column).
+			 *
+			 * The indexes must be in strictly ascending row-major order, so that a read of the union
+			 * of the blocks returns the data in the same order as the indexes.
+			 *
+			 * @param dim The dimension sizes of the record
+			 * @param idx The indexes in serialised form (dim.size() values per index)
+			 * @param nidx The number of indexes
+			 * @param start The starting index of each block in serialised form. Updated by this function.
+			 * @param count The size of each block in serialised form. Updated by this function.
+			 *
+			 * @return Nothing
+			 */
+			void coalesceHyperslabBlocks(const std::vector<unsigned long long>& dim,
+										 const unsigned long long * idx, unsigned long long nidx,
+										 std::vector<unsigned long long>& start,
+										 std::vector<unsigned long long>& count);
 		}
 	}
 }
@@ -0,0 +1,162 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Declarations for HDF5Writer class.
+ */
+
+#ifndef CUPCFD_IO_HDF5_WRITER_INCLUDE_H
+#define CUPCFD_IO_HDF5_WRITER_INCLUDE_H
+
+#include "hdf5.h"
+#include "mpi.h"
+#include <string>
+
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace io
+	{
+		namespace hdf5
+		{
+			/**
+			 * HDF5Writer Class.
+			 * Creates a HDF5 file shared by all processes of a communicator, and writes datasets to it
+			 * where each process contributes a contiguous block of rows.
+			 *
+			 * The rows of each dataset are ordered by rank, so the block written by a rank starts after
+			 * the blocks of all lower ranks.
+			 *
+			 * If HDF5 was built with parallel support, the file is held open with the MPI-IO driver and the
+			 * blocks are written with a single collective transfer. Otherwise the processes take turns to
+			 * open the file and write their block, in rank order.
+			 *
+			 * All methods are collective over the communicator, and every process must make the same
+			 * sequence of calls (with zero rows where a process has nothing to write).
+			 *
+			 * The result of each operation is agreed across the processes, so a failure on any process is
+			 * returned on every process. Once an operation has failed, later writes do nothing and return the
+			 * same error, so a sequence of writes can be checked once with status at the end.
+			 */
+			class HDF5Writer
+			{
+				public:
+					// === Members ===
+
+					/** Name of the file being written **/
+					std::string fileName;
+
+					/** The communicator of all processes writing to the file **/
+					MPI_Comm comm;
+
+					/** The rank of this process in comm **/
+					int rank;
+
+					/** The number of processes in comm **/
+					int size;
+
+					/** HDF5 File ID of the open file. Only held open if HDF5 was built with parallel support **/
+					hid_t fileID;
+
+					/** HDF5 Dataset Transfer Property List used for dataset writes **/
+					hid_t xferID;
+
+					/** The first error of the file creation or a write (the same on every process), or E_SUCCESS **/
+					cupcfd::error::eCodes status;
+
+					// === Constructors/Deconstructors ===
+
+					/**
+					 * Constructor: Create the specified file, replacing any existing file of the same name.
+					 * This is a collective operation over comm. If the file can not be created, status is set
+					 * to the error.
+					 *
+					 * @param fileName File to create
+					 * @param comm The communicator of all processes that will write to the file
+					 */
+					HDF5Writer(std::string fileName, MPI_Comm comm);
+
+					/**
+					 * Deconstructor:
+					 * Closes the file if it is open.
+					 */
+					~HDF5Writer();
+
+					// === Concrete Methods ===
+
+					/**
+					 * Write an integer attribute on the root group of the file.
+					 * Every process must provide the same value.
+					 *
+					 * @param attrName The name of the attribute
+					 * @param value The value of the attribute
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_HDF5_ERROR This or an earlier operation failed on any process
+					 */
+					cupcfd::error::eCodes writeAttribute(std::string attrName, int value);
+
+					/**
+					 * Write a dataset where this process contributes nRows rows of nCols values.
+					 * The dataset is one dimensional if nCols is one, otherwise it is two dimensional.
+					 *
+					 * The group is created if it does not already exist.
+					 *
+					 * @param groupName The name of the group containing the dataset
+					 * @param dataName The name of the dataset
+					 * @param data The rows of this process, stored in row-major order
+					 * @param nRows The number of rows this process contributes
+					 * @param nCols The number of values in each row. Must be the same on every process.
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 * @retval cupcfd::error::E_SUCCESS Success
+					 * @retval cupcfd::error::E_HDF5_ERROR This or an earlier operation failed on any process
+					 */
+					cupcfd::error::eCodes writeDataSet(std::string groupName, std::string dataName, const int * data,
+													   unsigned long long nRows, unsigned long long nCols);
+
+					/**
+					 * @copydoc writeDataSet(std::string, std::string, const int *, unsigned long long, unsigned long long)
+					 */
+					cupcfd::error::eCodes writeDataSet(std::string groupName, std::string dataName, const float * data,
+													   unsigned long long nRows, unsigned long long nCols);
+
+					/**
+					 * @copydoc writeDataSet(std::string, std::string, const int *, unsigned long long, unsigned long long)
+					 */
+					cupcfd::error::eCodes writeDataSet(std::string groupName, std::string dataName, const double * data,
+													   unsigned long long nRows, unsigned long long nCols);
+
+				private:
+					/**
+					 * Shared implementation of the dataset writes.
+					 *
+					 * @param typeID The HDF5 type of the data in memory and in the file
+					 *
+					 * @return An error status indicating the success or failure of the operation
+					 */
+					cupcfd::error::eCodes writeDataSet(std::string groupName, std::string dataName, hid_t typeID, const void * data,
+													   unsigned long long nRows, unsigned long long nCols);
+
+					/**
+					 * Agree on the result of an operation across the processes, and store the first error in status.
+					 *
+					 * @param localStatus The result of the operation on this process
+					 *
+					 * @return The local error if the operation failed on this process, E_HDF5_ERROR if it
+					 * only failed on another process, or E_SUCCESS
+					 */
+					cupcfd::error::eCodes agreeStatus(cupcfd::error::eCodes localStatus);
+			};
+		}
+	}
+}
+
+#endif
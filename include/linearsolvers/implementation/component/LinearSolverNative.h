@@ -0,0 +1,446 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the LinearSolverNative class
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_NATIVE_INCLUDE_H
+#define CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_NATIVE_INCLUDE_H
+
+// Base Class
+#include "LinearSolverInterface.h"
+
+// Data Structures
+#include "SparseMatrix.h"
+#include "SparseMatrixCSR.h"
+#include "DistributedSparseMatrixCSR.h"
+
+// Error Codes
+#include "Error.h"
+
+// Parallel Communicator
+#include "Communicator.h"
+
+#include <vector>
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		/**
+		 * The Krylov methods available for use by the native solver
+		 */
+		enum NativeSolverMethod
+		{
+			/** Conjugate Gradient - the matrix must be symmetric positive definite **/
+			NATIVE_SOLVER_CG,
+
+			/** Stabilised BiConjugate Gradient - for general (non-symmetric) matrices **/
+			NATIVE_SOLVER_BICGSTAB
+		};
+
+		/**
+		 * The preconditioners available for use by the native solver
+		 */
+		enum NativePreconditioner
+		{
+			/** No preconditioning **/
+			NATIVE_PC_NONE,
+
+			/** Jacobi (diagonal) preconditioning **/
+			NATIVE_PC_JACOBI,
+
+			/** Block Jacobi, with an ILU(0) factorisation of the diagonal block of each process **/
+			NATIVE_PC_BJACOBI_ILU0
+		};
+
+		/**
+		 * Linear solver that runs preconditioned CG or BiCGStab without any third party library.
+		 *
+		 * The rows of the system are split across the processes in contiguous blocks of (as near as possible)
+		 * equal size, in the same way as PETSc's PETSC_DECIDE. Matrix A is stored in a DistributedSparseMatrixCSR,
+		 * which holds the rows of each process with local column indexes - the columns of its own rows come first,
+		 * followed by the off-process ('ghost') columns in ascending global order. Its matrix-vector product
+		 * overlaps the exchange of the ghost column values with the rows that only use local columns.
+		 *
+		 * The solve stops once the residual norm is at most max(rTol * ||b||, eTol), or after maxIterations
+		 * iterations. As with LinearSolverPETSc, not converging is not treated as an error - the number of
+		 * iterations, the final residual norm and whether the solve converged are stored after each solve.
+		 *
+		 * @tparam C The implementation class of the Sparse Matrix
+		 * @tparam I The type of the indexing system
+		 * @tparam T The data type of the matrix non-zero data
+		 */
+		template <class C, class I, class T>
+		class LinearSolverNative : public LinearSolverInterface<C,I,T>
+		{
+			public:
+				// === Members ===
+
+				/** The Krylov method used by the solve **/
+				NativeSolverMethod method;
+
+				/** The preconditioner used by the solve **/
+				NativePreconditioner preconditioner;
+
+				/** Relative tolerance of the residual norm, relative to the norm of vector b **/
+				T rTol;
+
+				/** Absolute tolerance of the residual norm **/
+				T eTol;
+
+				/** Maximum number of iterations of a solve **/
+				I maxIterations;
+
+				/** Row Index Range across processes, indexed by rank (size of the communicator + 1) **/
+				std::vector<I> rowRanges;
+
+				/** Number of Local Rows **/
+				I mLocal;
+
+				/** Vector X - local rows only **/
+				std::vector<T> x;
+
+				/** Vector B - local rows only **/
+				std::vector<T> b;
+
+				/** Whether vector X has been setup **/
+				bool vectorXSetup;
+
+				/** Whether vector B has been setup **/
+				bool vectorBSetup;
+
+				/** Whether matrix A has been setup **/
+				bool matrixASetup;
+
+				/**
+				 * Matrix A, distributed over the rows of each process. Its localA holds the local rows with
+				 * local column indexes, with the ghost columns at the end of each row. nullptr until setup.
+				 */
+				cupcfd::data_structures::DistributedSparseMatrixCSR<I,T> * distA;
+
+				/** Position in the CSR arrays of distA->localA where the ghost columns of each local row start **/
+				std::vector<I> ghostStart;
+
+				/** Position in the CSR arrays of distA->localA of the diagonal of each local row, or -1 if it is not stored **/
+				std::vector<I> diagPos;
+
+				/** Whether any process stored rows of the setup matrix that it does not own **/
+				bool remoteRows;
+
+				/**
+				 * Position in distA->localA of each value of the local rows of the SparseMatrixCSR used for setup,
+				 * so that setValuesMatrixA can copy the values of a CSR matrix of the same structure in one pass.
+				 * Only used if csrMapped is true.
+				 */
+				std::vector<I> csrValueMap;
+
+				/** Whether csrValueMap is set **/
+				bool csrMapped;
+
+				/** Whether the preconditioner is up to date with the values of matrix A **/
+				bool pcSetup;
+
+				/** Inverse of the diagonal of the local rows of matrix A, for Jacobi preconditioning **/
+				std::vector<T> pcInvDiag;
+
+				/** ILU(0) factors of the diagonal block, in the same layout as the values of distA->localA **/
+				std::vector<T> pcILU;
+
+				/** Number of iterations of the last solve **/
+				I iterations;
+
+				/** Residual norm at the end of the last solve **/
+				T residualNorm;
+
+				/** Whether the last solve reached the tolerance **/
+				bool converged;
+
+				// Work vectors for the solve, each holding the local rows
+				std::vector<T> workR;
+				std::vector<T> workRHat;
+				std::vector<T> workP;
+				std::vector<T> workPHat;
+				std::vector<T> workV;
+				std::vector<T> workS;
+				std::vector<T> workSHat;
+				std::vector<T> workT;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Create the linear solver object and setup the internal configuration and data structures
+				 * (but not the data contents)
+				 *
+				 * The provided matrix is used to set the non-zero structure of matrix A - its data contents are not
+				 * transferred. As with LinearSolverPETSc, the matrix on each rank may only store a portion of the rows
+				 * as long as it uses global indexes and global row/column counts. Rows stored on a rank other than
+				 * the one that owns them are sent to their owner.
+				 *
+				 * Matrices used to set values later must have the same non-zero structure as the one provided here.
+				 *
+				 * @param comm The communicator to be used for the linear solve. If this is a serial
+				 * linear solver, ensure that this communicator is of size 1.
+				 * @param method The Krylov method to use
+				 * @param preconditioner The preconditioner to use
+				 * @param rTol The rTolerance to use
+				 * @param eTol The eTolerance to use
+				 * @param maxIterations The maximum number of iterations of a solve
+				 * @param matrix The matrix used to set the non-zero structure
+				 *
+				 * @tparam C The implementation class of the Sparse Matrix
+				 * @tparam I The type of the indexing system
+				 * @tparam T The data type of the matrix non-zero data
+				 */
+				LinearSolverNative(cupcfd::comm::Communicator& comm, NativeSolverMethod method, NativePreconditioner preconditioner,
+								   T rTol, T eTol, I maxIterations, cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
+
+				/**
+				 * Deconstructor
+				 */
+				~LinearSolverNative();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Get the rank that owns a row of the system.
+				 *
+				 * @param row The global (base zero) row index
+				 *
+				 * @return The rank that owns the row
+				 */
+				inline I getRowOwner(I row);
+
+				/**
+				 * Find the position of a non-zero value of a local row in the CSR arrays of distA->localA.
+				 *
+				 * @param row The local row index
+				 * @param col The global (base zero) column index
+				 *
+				 * @return The position of the value, or -1 if it is not in the non-zero structure of matrix A
+				 */
+				I getLocalPosition(I row, I col);
+
+				/**
+				 * Compute the product of the local rows of matrix A with a vector, using the overlapped
+				 * exchange and product of distA.
+				 *
+				 * This is collective across the communicator in parallel.
+				 *
+				 * @param vec The vector to multiply. Must have mLocal elements.
+				 * @param result The vector to store the product of the local rows in. Must have space for mLocal elements.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes multiplyMatrixA(std::vector<T>& vec, std::vector<T>& result);
+
+				/**
+				 * Compute the preconditioner from the current values of matrix A.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX A diagonal value (or ILU(0) pivot) is zero or missing on any process
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setupPreconditioner();
+
+				/**
+				 * Apply the preconditioner to the local rows of a vector.
+				 *
+				 * @param vec The vector to apply the preconditioner to
+				 * @param result The vector to store the result in. Must not be the same vector as vec.
+				 */
+				void applyPreconditioner(std::vector<T>& vec, std::vector<T>& result);
+
+				/**
+				 * Compute the dot products of pairs of vectors over the local rows, and sum them across the
+				 * communicator in one reduction.
+				 *
+				 * @param vecA The first vector of each pair
+				 * @param vecB The second vector of each pair
+				 * @param nPairs The number of pairs
+				 * @param results The array to store the dot product of each pair in
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes dotProducts(std::vector<T> ** vecA, std::vector<T> ** vecB, int nPairs, T * results);
+
+				/**
+				 * Solve with preconditioned CG
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes solveCG();
+
+				/**
+				 * Solve with right preconditioned BiCGStab
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes solveBiCGStab();
+
+				/**
+				 * Set values of a local vector from global indexes. Values for rows owned by another process are sent
+				 * to their owner, which makes this collective across the communicator in parallel.
+				 *
+				 * @param vec The local vector to set the values of
+				 * @param scalars The values to set
+				 * @param nScalars The number of values
+				 * @param indexes The global indexes of the values
+				 * @param nIndexes The number of indexes
+				 * @param indexBase The base of the indexes
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ARRAY_MISMATCH_SIZE The number of values and indexes do not match
+				 * @retval cupcfd::error::E_INVALID_INDEX An index is outside of the rows of the system
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setLocalVectorValues(std::vector<T>& vec, T * scalars, I nScalars,
+														   I * indexes, I nIndexes, I indexBase);
+
+				/**
+				 * Get the values of a local vector for all rows of the system. This is collective across the
+				 * communicator in parallel.
+				 *
+				 * @param vec The local vector to get the values of
+				 * @param result A pointer to the location where the array of values will be allocated
+				 * @param nResult A pointer to the location where the number of values will be stored
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getLocalVectorValues(std::vector<T>& vec, T ** result, I * nResult);
+
+				/**
+				 * Get the values of a local vector for global indexes. This is collective across the
+				 * communicator in parallel.
+				 *
+				 * @param vec The local vector to get the values of
+				 * @param result A pointer to the location where the array of values will be allocated
+				 * @param nResult A pointer to the location where the number of values will be stored
+				 * @param indexes The global indexes of the values
+				 * @param nIndexes The number of indexes
+				 * @param indexBase The base of the indexes
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_INVALID_INDEX An index is outside of the rows of the system
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getLocalVectorValues(std::vector<T>& vec, T ** result, I * nResult,
+														   I * indexes, I nIndexes, I indexBase);
+
+				// === Overloaded Inherited Methods ===
+				void resetVectorX();
+				void resetVectorB();
+				void resetMatrixA();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesVectorX(T scalar);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesVectorX(T * scalars, I nScalars, I * indexes, I nIndexes, I indexBase);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesVectorB(T scalar);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesVectorB(T * scalars, I nScalars, I * indexes, I nIndexes, I indexBase);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes clearVectorX();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes clearVectorB();
+				void reset();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setupVectorX();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setupVectorB();
+				/**
+				 * Create matrix A with the non-zero structure of the provided matrix, and build the halo exchange
+				 * for its ghost columns.
+				 *
+				 * @param matrix The matrix used to set the non-zero structure
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_LINEARSOLVER_ROW_SIZE_UNSET The number of rows is not set
+				 * @retval cupcfd::error::E_LINEARSOLVER_COL_SIZE_UNSET The number of columns is not set
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX The matrix is not square, or has an index
+				 * outside of the rows/columns of the system
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setupMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setup(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
+				/**
+				 * Set the values of matrix A from a matrix with the same non-zero structure as the one used in setup.
+				 *
+				 * For a SparseMatrixCSR with the same local structure as the setup matrix, the values are copied in
+				 * one pass. Otherwise each value is looked up in the local rows, and values of rows owned by another
+				 * process are sent to their owner.
+				 *
+				 * @param matrix The matrix to copy the values from
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX Matrix A is not setup, or the matrix has a value
+				 * outside of the non-zero structure of matrix A
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setValuesMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getValuesVectorX(T ** result, I * nResult);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getValuesVectorX(T ** result, I * nResult,
+																	I * indexes, I nIndexes, I indexBase);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getValuesVectorB(T ** result, I * nResult);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getValuesVectorB(T ** result, I * nResult,
+																	I * indexes, I nIndexes, I indexBase);
+				/**
+				 * Copy the values of matrix A into the non-zero positions of the provided matrix.
+				 * Only the positions in rows owned by this process are updated.
+				 *
+				 * @param matrix The matrix to copy the values to
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX Matrix A is not setup
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getValuesMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes clearMatrixA();
+				/**
+				 * Solve the system with the selected Krylov method and preconditioner, starting from the current
+				 * values of vector X.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR Vectors X or B are not setup
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX Matrix A is not setup, or the preconditioner
+				 * could not be computed from it
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes solve();
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "LinearSolverNative.ipp"
+
+#endif
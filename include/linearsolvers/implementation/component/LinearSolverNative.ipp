@@ -0,0 +1,36 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the LinearSolverNative class
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_NATIVE_IPP_H
+#define CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_NATIVE_IPP_H
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		template <class C, class I, class T>
+		inline I LinearSolverNative<C,I,T>::getRowOwner(I row) {
+			// The first nLarge ranks have one more row than the rest
+			I size = this->comm.size;
+			I blockSize = this->mGlobal / size;
+			I nLarge = this->mGlobal % size;
+
+			if(row < nLarge * (blockSize + 1)) {
+				return row / (blockSize + 1);
+			}
+
+			return nLarge + ((row - (nLarge * (blockSize + 1))) / blockSize);
+		}
+	}
+}
+
+#endif
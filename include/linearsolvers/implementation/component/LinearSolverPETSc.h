@@ -31,6 +31,8 @@
 // Third party
 #include "petsc.h"
 
+#include <vector>
+
 namespace cupcfd
 {
 	namespace linearsolvers
@@ -64,6 +66,25 @@ namespace cupcfd
 
 				LinearSolverPETScAlgorithm * algSolver;
 
+				/**
+				 * Whether matrix A was created directly from the CSR arrays of the setup matrix.
+				 * If so, setValuesMatrixA passes the values of each new matrix to PETSc in one pass
+				 * rather than row by row.
+				 */
+				bool csrHandoff;
+
+				/** Number of non-zero values stored locally in the CSR matrix used to create matrix A **/
+				I csrNNZ;
+
+				/** Local row pointers of the CSR handoff, only used if I is not the same type as PetscInt **/
+				std::vector<PetscInt> csrRowPtr;
+
+				/** Global column indexes of the CSR handoff, only used if I is not the same type as PetscInt **/
+				std::vector<PetscInt> csrColIndexes;
+
+				/** Staging buffer for non-zero values, only used if T is not the same type as PetscScalar **/
+				std::vector<PetscScalar> csrValues;
+
 				// === Constructors/Deconstructors ===
 
 				/**
@@ -81,6 +102,10 @@ namespace cupcfd
 				 * Matrix preallocation is done using the matrix provided, and as such the non-zero structure
 				 * of matrices used to set values must not differ from the one provided here in the constructor.
 				 *
+				 * If the matrix is a SparseMatrixCSR that uses a base index of zero, and the rows stored on each rank
+				 * are exactly the rows that PETSc assigns to that rank, its CSR arrays are handed to PETSc directly
+				 * to create matrix A, and later calls to setValuesMatrixA only pass the new values.
+				 *
 				 * Solvers can be reused for new sets of matrix values as long as the matrices have the same
 				 * non-zero structure (and thus avoid preallocation overheads). If subsequent matrices
 				 * have different non-zero structures, they should be used to create a new LinearSolverPETSc object.
@@ -138,10 +163,42 @@ namespace cupcfd
 				cupcfd::error::eCodes setupVectorX();
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes setupVectorB();
+				/**
+				 * Create matrix A with the non-zero structure of the provided matrix.
+				 *
+				 * In parallel, the number of non-zero values of each row in the diagonal and off-diagonal blocks
+				 * is counted for preallocation. Rows that are stored on a rank other than the one that PETSc assigns
+				 * them to have their counts sent to the owning rank. If the matrix qualifies for the CSR handoff on
+				 * every rank, matrix A is instead created directly from its CSR arrays.
+				 *
+				 * Vectors X and B must be setup first, since their ownership ranges are used for the matrix.
+				 *
+				 * @param matrix The matrix used to inform the non-zero data structure for memory allocation
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR Vectors X or B are not setup
+				 * @retval cupcfd::error::E_PETSC_ERROR PETSc reported an error
+				 */
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes setupMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes setup(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
+				/**
+				 * Set the values of matrix A from a matrix with the same non-zero structure as the one used in setup.
+				 *
+				 * If matrix A was created by the CSR handoff, the values are passed to PETSc in one pass with
+				 * MatUpdateMPIAIJWithArrays. Otherwise the values are set row by row - for a SparseMatrixCSR the rows
+				 * are read from its arrays in place.
+				 *
+				 * @param matrix The matrix to copy the values from
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX Matrix A is not setup, or it was created by the
+				 * CSR handoff and the matrix does not have the same local structure
+				 * @retval cupcfd::error::E_PETSC_ERROR PETSc reported an error
+				 */
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes setValuesMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix);
 				__attribute__((warn_unused_result))
@@ -0,0 +1,94 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declarations for the LinearSolverConfigNative class
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_CONFIG_NATIVE_INCLUDE_H
+#define CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_CONFIG_NATIVE_INCLUDE_H
+
+#include "Error.h"
+#include "LinearSolverNative.h"
+#include "SparseMatrix.h"
+
+#include "LinearSolverConfig.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		/**
+		 * Configuration for building a LinearSolverNative object
+		 */
+		template <class C, class I, class T>
+		class LinearSolverConfigNative : public LinearSolverConfig<C,I,T>
+		{
+			public:
+				// === Members ===
+
+				/** The Krylov method to use **/
+				NativeSolverMethod method;
+
+				/** The preconditioner to use **/
+				NativePreconditioner preconditioner;
+
+				/** Relative tolerance of the residual norm **/
+				T rTol;
+
+				/** Absolute tolerance of the residual norm **/
+				T eTol;
+
+				/** Maximum number of iterations of a solve **/
+				I maxIterations;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Create a configuration for a native linear solver
+				 *
+				 * @param method The Krylov method to use
+				 * @param preconditioner The preconditioner to use
+				 * @param eTol The eTolerance to use
+				 * @param rTol The rTolerance to use
+				 * @param maxIterations The maximum number of iterations of a solve
+				 */
+				LinearSolverConfigNative(NativeSolverMethod method, NativePreconditioner preconditioner,
+										 T eTol, T rTol, I maxIterations);
+
+				/**
+				 * Copy Constructor
+				 *
+				 * @param source The configuration to copy
+				 */
+				LinearSolverConfigNative(const LinearSolverConfigNative<C,I,T>& source);
+
+				/**
+				 * Deconstructor
+				 */
+				~LinearSolverConfigNative();
+
+				// === Methods ===
+
+				void operator=(const LinearSolverConfigNative<C,I,T>& source);
+				__attribute__((warn_unused_result))
+				LinearSolverConfigNative<C,I,T> * clone();
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildLinearSolver(LinearSolverInterface<C,I,T> ** solverSystem,
+															 cupcfd::data_structures::SparseMatrix<C,I,T>& matrix,
+															 cupcfd::comm::Communicator& solverComm);
+
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "LinearSolverConfigNative.ipp"
+
+#endif
@@ -0,0 +1,24 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the LinearSolverConfigNative class
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_CONFIG_NATIVE_IPP_H
+#define CUPCFD_LINEARSOLVERS_LINEAR_SOLVER_CONFIG_NATIVE_IPP_H
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		// Nothing here for now
+	}
+}
+
+#endif
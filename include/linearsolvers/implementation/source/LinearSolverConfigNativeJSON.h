@@ -0,0 +1,115 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Declaration for the LinearSolverConfigNativeJSON class.
+ */
+
+#ifndef CUPCFD_LINEARSOLVERS_SOURCE_LINEAR_SOLVER_CONFIG_NATIVE_SOURCE_JSON_INCLUDE_H
+#define CUPCFD_LINEARSOLVERS_SOURCE_LINEAR_SOLVER_CONFIG_NATIVE_SOURCE_JSON_INCLUDE_H
+
+// C++ Std Lib
+#include <string>
+#include <vector>
+
+// Error Codes
+#include "Error.h"
+
+#include "LinearSolverConfigNative.h"
+#include "LinearSolverNative.h"
+
+#include "LinearSolverConfigSource.h"
+
+// JsonCPP - Supplied as standalone in include/io/jsoncpp
+#include "json.h"
+#include "json-forwards.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		/**
+		 * Defines a interface for accessing native linear solver configuration
+		 * options from a JSON data source.
+		 *
+		 * === Fields ===
+		 *
+		 * Required:
+		 * Method: String. Accepted Values: "CG", "BiCGStab"
+		 * Defines the Krylov method to use for the linear solve
+		 * CG: Conjugate Gradient (the matrix must be symmetric positive definite)
+		 * BiCGStab: Stabilised BiConjugate Gradient
+		 *
+		 * Preconditioner: String. Accepted Values: "None", "Jacobi", "BlockJacobiILU0"
+		 * Defines the preconditioner to use for the linear solve
+		 *
+		 * eTol: Floating Point Number.
+		 * Define the value of the eTolerance to use for the solve.
+		 *
+		 * rTol: Floating point Number
+		 * Define the value of the rTolerance to use for the solve.
+		 *
+		 * Optional:
+		 * MaxIterations: Integer. Default 10000
+		 * Define the maximum number of iterations of a solve.
+		 *
+		 */
+		template <class C, class I, class T>
+		class LinearSolverConfigNativeJSON : public LinearSolverConfigSource<C,I,T>
+		{
+			public:
+				// === Members ===
+
+				/** Json Data Store containing fields for this JSON source **/
+				Json::Value configData;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Parse the JSON record provided for values belonging to a Native Linear Solver entry
+				 *
+				 * @param parseJSON The contents of a JSON record with the appropriate fields
+				 */
+				LinearSolverConfigNativeJSON(Json::Value& parseJSON);
+
+				/**
+				 * Deconstructor
+				 */
+				~LinearSolverConfigNativeJSON();
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getMethod(NativeSolverMethod * method);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getPreconditioner(NativePreconditioner * preconditioner);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getETol(T * eTol);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getRTol(T * rTol);
+
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getMaxIterations(I * maxIterations);
+
+				// === Concrete Methods ===
+
+				/**
+				 * Build a LinearSolverConfigNative object from the JSON fields.
+				 * If MaxIterations is not set, it defaults to 10000.
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildLinearSolverConfig(LinearSolverConfig<C,I,T> ** linearSolverConfig);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "LinearSolverConfigNativeJSON.ipp"
+
+#endif
@@ -40,6 +40,8 @@ namespace cupcfd
 			this->cellEntryFaceLocalID = source.cellEntryFaceLocalID;
 			this->lastCellGlobalID = source.lastCellGlobalID;
 			this->lastLastCellGlobalID = source.lastLastCellGlobalID;
+			this->cellLocalID = source.cellLocalID;
+			this->lastCellLocalID = source.lastCellLocalID;
 			this->particleID = source.particleID;
 			this->rank = source.rank;
 			this->lastRank = source.lastRank;
@@ -144,34 +146,33 @@ namespace cupcfd
 			// the direction we're crossing the face in)
 			I cell1LocalID = mesh.getFaceCell1ID(faceLocalID);
 			I cell2LocalID = mesh.getFaceCell2ID(faceLocalID);
-					
-			// Get the Global IDs
-			I node1, node2;
-			status = mesh.cellConnGraph->connGraph.getLocalIndexNode(cell1LocalID, &node1);
-			CHECK_ECODE(status)
-			status = mesh.cellConnGraph->connGraph.getLocalIndexNode(cell2LocalID, &node2);
-			CHECK_ECODE(status)
-					
-			I cell1GlobalID = mesh.cellConnGraph->nodeToGlobal[node1];
-			I cell2GlobalID = mesh.cellConnGraph->nodeToGlobal[node2];
-			if ((this->cellGlobalID != cell1GlobalID) && (this->cellGlobalID != cell2GlobalID)) {
-				std::cout << "ERROR: Attempting to move particle " << this->particleID << " between cells " << cell1GlobalID << " -> " << cell2GlobalID << ", BUT it is not in either, it is in cell " << this->cellGlobalID << std::endl;
-				return cupcfd::error::E_ERROR;
+
+			// The particle caches the local ID of its cell, so the direction can be found without
+			// translating either cell to a global ID
+			if(this->cellLocalID == I(-1)) {
+				status = this->resolveCellLocalID(mesh);
+				CHECK_ECODE(status)
 			}
-			
+
 			I fromCellLocalID;
-			I toCellGlobalID;
-			if(this->cellGlobalID == cell1GlobalID) {
+			I toCellLocalID;
+			if(this->cellLocalID == cell1LocalID) {
 				fromCellLocalID = cell1LocalID;
-				toCellGlobalID = cell2GlobalID;
-			} else if (this->cellGlobalID == cell2GlobalID) {
+				toCellLocalID = cell2LocalID;
+			} else if (this->cellLocalID == cell2LocalID) {
 				fromCellLocalID = cell2LocalID;
-				toCellGlobalID = cell1GlobalID;
+				toCellLocalID = cell1LocalID;
 			} else {
-				std::cout << "ERROR: cellGlobalID=" << this->cellGlobalID << " of particle " << this->particleID << " does not match with either cell that is either side of requested face update" << std::endl;
+				std::cout << "ERROR: Attempting to move particle " << this->particleID << " between local cells " << cell1LocalID << " -> " << cell2LocalID << ", BUT it is not in either, it is in cell " << this->cellGlobalID << std::endl;
 				return cupcfd::error::E_ERROR;
 			}
 
+			// Get the Global ID of the cell we are moving into
+			I toNode;
+			status = mesh.cellConnGraph->connGraph.getLocalIndexNode(toCellLocalID, &toNode);
+			CHECK_ECODE(status)
+			I toCellGlobalID = mesh.cellConnGraph->nodeToGlobal[toNode];
+
             // Error Check: The local face ID should be face accessible from the current cellGlobalID set for the particle
 			bool localFaceAccessible = false;
 			I nFaces = 0;
@@ -191,19 +192,17 @@ namespace cupcfd
 				return cupcfd::error::E_ERROR;
 			}
 
-			status = this->safelySetCellGlobalID(toCellGlobalID, faceLocalID);
+			status = this->safelySetCellGlobalID(toCellGlobalID, toCellLocalID, faceLocalID);
 			CHECK_ECODE(status)
 
 			// Update the Target Rank if we are crossing into a ghost cell
-			
-			T node = mesh.cellConnGraph->globalToNode[this->cellGlobalID];
-			bool isGhost = mesh.cellConnGraph->existsGhostNode(node);
-			
-			// Check it exists as a ghost node
+			// Locally owned cells are numbered before ghost cells, so this only needs the local ID
+			bool isGhost = (toCellLocalID >= mesh.properties.lOCells);
+
 			if(isGhost) {
 				// Update rank to be the rank that owns the ghost node
 				this->lastRank = this->rank;
-				this->rank = mesh.cellConnGraph->nodeOwner[node];
+				this->rank = mesh.cellConnGraph->nodeOwner[toNode];
 			}
 
 			return cupcfd::error::E_SUCCESS;
@@ -246,6 +245,7 @@ namespace cupcfd
 			// Reset cell travel history:
 			this->lastLastCellGlobalID = I(-1);
 			this->lastCellGlobalID = I(-1);
+			this->lastCellLocalID = I(-1);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -18,6 +18,7 @@
 #include "ParticleSimple.h"
 #include "ParticleEmitterSimple.h"
 #include "UnstructuredMeshInterface.h"
+#include "MeshConfig.h"
 
 #include "ParticleSystem.h"
 
@@ -94,6 +95,28 @@ namespace cupcfd
 				cupcfd::error::eCodes setActiveParticlesTravelTime(T travelTime);
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes generateEmitterParticles(T dt);
+
+				/**
+				 * Redistribute the cells of the mesh so that the particle load on each process is balanced, and
+				 * move the particles with their cells. Each owned cell is weighted by cellCost plus the number of
+				 * active particles in it, and the cells are reassigned with the partitioner of meshConfig.
+				 * The new mesh is built from the mesh source of meshConfig and replaces the mesh of this system.
+				 *
+				 * Emitters hold their own random number generator state, so the cells that contain an emitter
+				 * are kept on their current process.
+				 *
+				 * This is a blocking call - all processes that store part of the mesh must call it.
+				 *
+				 * @param meshConfig The configuration the mesh was built from
+				 * @param cellCost The weight of a cell without particles, relative to the weight of one particle.
+				 * Must be greater than zero.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_NOT_IMPLEMENTED The partitioner of meshConfig does not support node weights
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes rebalance(cupcfd::geometry::mesh::MeshConfig<I,T,L>& meshConfig, T cellCost);
 		};
 	}
 }
@@ -15,6 +15,7 @@
 #ifndef CUPCFD_PARTICLES_PARTICLE_SYSTEM_SIMPLE_IPP_H
 #define CUPCFD_PARTICLES_PARTICLE_SYSTEM_SIMPLE_IPP_H
 
+#include "AllToAll.h"
 #include "ArithmeticKernels.h"
 #include "SortDrivers.h"
 #include "ExchangeMPI.h"
@@ -22,6 +23,7 @@
 
 #include "tt_interface_c.h"
 
+#include <algorithm>
 #include <unistd.h>
 
 namespace arth = cupcfd::utility::arithmetic::kernels;
@@ -104,20 +106,35 @@ namespace cupcfd
 		
 		template <class M, class I, class T, class L>
 		cupcfd::error::eCodes ParticleSystemSimple<M,I,T,L>::removeInactiveParticles() {
-			// This is far too expensive for a vector, but will temporarily suffice for
-			// testing functionality
-		
 			// We should not need to update active/travel counters, particles removed here
 			// are already inactive and thus counters should have already been decreased.
-		
-			// Go through the system and mark any inactive particles
-			I loopCount = this->getNParticles();
-			
-			for (I i=loopCount-1; i>=0; i--) {
-				if (this->particles[i].getInactive())
-					this->particles.erase(this->particles.begin() + i);
+
+			// Single pass stable compaction: active particles are copied down over any inactive
+			// particles before them, preserving their order, and the tail is then removed in one go.
+			// This is O(n) regardless of how many particles are inactive, and does no copies if
+			// there are no inactive particles before the first active one.
+			I nParticles = this->getNParticles();
+
+			// Skip over the leading run of active particles, which do not move
+			I dst = 0;
+			while(dst < nParticles && !(this->particles[dst].getInactive())) {
+				dst++;
+			}
+
+			// Nothing to remove
+			if(dst == nParticles) {
+				return cupcfd::error::E_SUCCESS;
 			}
 
+			for(I src = dst + 1; src < nParticles; src++) {
+				if(!(this->particles[src].getInactive())) {
+					this->particles[dst] = this->particles[src];
+					dst++;
+				}
+			}
+
+			this->particles.erase(this->particles.begin() + dst, this->particles.end());
+
 			return cupcfd::error::E_SUCCESS;
 		}
 		
@@ -248,6 +265,11 @@ namespace cupcfd
 			// Add any particles we received to the system
 			TreeTimerEnterLoop("redetectEntryFaceID");
 			for(I i = 0; i < totalRecvCount; i++) {
+				// Local cell IDs are not communicated, so resolve them once on arrival. They are kept
+				// in sync by the particle as it moves from this point.
+				status = particleRecvBuffer[i].resolveCellLocalID(*(this->mesh));
+				CHECK_ECODE(status)
+
 				status = particleRecvBuffer[i].redetectEntryFaceID(*(this->mesh));
 				CHECK_ECODE(status)
 
@@ -468,15 +490,14 @@ namespace cupcfd
 					T stepDt;			// How much time this particle moves by in its current cell
 					I localFaceID;		// The mesh local ID of the face that the particle ends up at in its current cell
 					I localCellID;		// The local (not global) mesh cell ID that the particle is currently in
-					I cellNode;			// The node value in the connectivity graph of the cell that the particle is currently in
-										// (Needed to map between local ID and global ID since this label is arbitrary when building)
 
-					I cellGlobalID = this->particles[i].getCellGlobalID();
-				
-					// Get the Local Cell ID since ParticleSimple only stores the Mesh Global Cell ID
-					cellNode = this->mesh->cellConnGraph->globalToNode[cellGlobalID];
-					status = this->mesh->cellConnGraph->connGraph.getNodeLocalIndex(cellNode, &localCellID);
-					CHECK_ECODE(status)
+					// The particle caches its local cell ID - this only has to be resolved via the
+					// connectivity graph for particles that have not been placed against the mesh yet
+					if(this->particles[i].getCellLocalID() == I(-1)) {
+						status = this->particles[i].resolveCellLocalID(*(this->mesh));
+						CHECK_ECODE(status)
+					}
+					localCellID = this->particles[i].getCellLocalID();
 
 					// Note: For particles with no further travel time, the following steps must not change the state
 					// of the particle and system.
@@ -649,6 +670,128 @@ namespace cupcfd
 
 			return cupcfd::error::E_SUCCESS;
 		}
+
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes ParticleSystemSimple<M,I,T,L>::rebalance(cupcfd::geometry::mesh::MeshConfig<I,T,L>& meshConfig, T cellCost) {
+			cupcfd::error::eCodes status;
+
+			M& currentMesh = static_cast<M&>(*(this->mesh));
+			cupcfd::comm::Communicator& comm = *(currentMesh.cellConnGraph->comm);
+			I nOwnedCells = currentMesh.properties.lOCells;
+
+			status = this->removeInactiveParticles();
+			CHECK_ECODE(status)
+
+			// (1) Weight each owned cell by its cost and the particles in it
+			std::vector<double> cellWeights(nOwnedCells, double(cellCost));
+
+			for(I i = 0; i < this->getNParticles(); i++) {
+				if(this->particles[i].getCellLocalID() == I(-1)) {
+					status = this->particles[i].resolveCellLocalID(*(this->mesh));
+					CHECK_ECODE(status)
+				}
+
+				cellWeights[this->particles[i].getCellLocalID()] += 1.0;
+			}
+
+			// (2) Compute the new rank of each owned cell. Cells with an emitter stay on this process.
+			std::vector<I> cellRanks(nOwnedCells);
+			status = meshConfig.repartitionUnstructuredMesh(currentMesh, cellWeights.data(), nOwnedCells,
+															cellRanks.data(), nOwnedCells);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			for(std::size_t i = 0; i < this->emitters.size(); i++) {
+				cellRanks[this->emitters[i].localCellID] = comm.rank;
+			}
+
+			// (3) Build the mesh with the cells on their new ranks
+			M * newMesh;
+			status = meshConfig.buildUnstructuredMesh(&newMesh, currentMesh, cellRanks.data(), nOwnedCells, comm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			// (4) Send each particle to the new rank of its cell. Global cell IDs change with the
+			// distribution of the mesh, so the particles carry the cell labels instead. Copies are sent,
+			// so the particles of this process are left as they were if the rebalance fails.
+			I nParticles = this->getNParticles();
+			std::vector<ParticleSimple<I,T>> sendParticles(this->particles.begin(), this->particles.end());
+			std::vector<int> particleRanks(nParticles);
+
+			for(I i = 0; i < nParticles; i++) {
+				particleRanks[i] = cellRanks[sendParticles[i].getCellLocalID()];
+				sendParticles[i].setRank(particleRanks[i]);
+
+				status = sendParticles[i].convertCellGlobalIDsToLabels(*(this->mesh));
+				if(status != cupcfd::error::E_SUCCESS) {
+					delete newMesh;
+					return status;
+				}
+			}
+
+			std::vector<ParticleSimple<I,T>> recvParticles;
+
+			if(comm.size > 1) {
+				ParticleSimple<I,T> * particleRecvBuffer = nullptr;
+				int nParticleRecvBuffer = 0;
+
+				status = cupcfd::comm::AllToAll(sendParticles.data(), nParticles, particleRanks.data(), nParticles,
+												&particleRecvBuffer, &nParticleRecvBuffer, comm);
+				if(status != cupcfd::error::E_SUCCESS) {
+					delete newMesh;
+					return status;
+				}
+
+				recvParticles.assign(particleRecvBuffer, particleRecvBuffer + nParticleRecvBuffer);
+				free(particleRecvBuffer);
+			}
+			else {
+				recvParticles.swap(sendParticles);
+			}
+
+			// (5) Locate the received particles in the new mesh
+			for(std::size_t i = 0; i < recvParticles.size(); i++) {
+				status = recvParticles[i].convertCellLabelsToGlobalIDs(*newMesh);
+				if(status != cupcfd::error::E_SUCCESS) {
+					delete newMesh;
+					return status;
+				}
+
+				// The entry face is a local face ID, so find it again. Particles that have not moved
+				// since they were emitted have no entry face.
+				if(recvParticles[i].getLastCellGlobalID() != I(-1)) {
+					status = recvParticles[i].redetectEntryFaceID(*newMesh);
+					if(status != cupcfd::error::E_SUCCESS) {
+						delete newMesh;
+						return status;
+					}
+				}
+			}
+
+			// (6) Move the emitters to their cells in the new mesh
+			for(std::size_t i = 0; i < this->emitters.size(); i++) {
+				I label = currentMesh.cellConnGraph->globalToNode[this->emitters[i].globalCellID];
+				this->emitters[i].globalCellID = newMesh->cellConnGraph->nodeToGlobal[label];
+				this->emitters[i].localCellID = newMesh->getCellID(label);
+			}
+
+			// The old mesh is released here if nothing else holds it
+			this->mesh = std::shared_ptr<cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>>(newMesh);
+
+			// (7) Replace the particles with those received
+			this->particles.clear();
+			this->nActiveParticles = 0;
+			this->nTravelParticles = 0;
+
+			for(std::size_t i = 0; i < recvParticles.size(); i++) {
+				status = this->addParticle(recvParticles[i]);
+				CHECK_ECODE(status)
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
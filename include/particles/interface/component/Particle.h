@@ -174,6 +174,15 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				inline I getRank();
 
+				/**
+				 * Set the owner rank of the particle
+				 *
+				 * @param rank The owner rank of the particle
+				 *
+				 * @return Nothing
+				 */
+				inline void setRank(I rank);
+
 				/**
 				 * Get the cell ID of the particle
 				 *
@@ -190,6 +199,78 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				inline I getLastCellGlobalID() const;
 
+				/**
+				 * Get the cached mesh local ID of the cell the particle is currently in.
+				 *
+				 * This is not communicated with the particle, and is -1 until it has been resolved
+				 * against a mesh with resolveCellLocalID.
+				 *
+				 * @return The local cell ID, or -1 if it has not been resolved
+				 */
+				__attribute__((warn_unused_result))
+				inline I getCellLocalID() const;
+
+				/**
+				 * Resolve the cached mesh local IDs of the current and previous cells of the particle
+				 * from their global IDs.
+				 *
+				 * This performs the global to local lookups through the mesh connectivity graph, so
+				 * should only be used when a particle first arrives on a rank - the cached IDs are kept in
+				 * sync as the particle moves between cells after that point.
+				 * If the previous cell is not known to this rank, its local ID is set to -1.
+				 *
+				 * @param mesh The mesh the particle is located in
+				 *
+				 * @tparam M The implementation type of the mesh
+				 * @tparam L The type of the mesh cell labels
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ADJACENCY_LIST_NODE_MISSING The current cell of the particle is not known to this rank
+				 */
+				template <class M, class L>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes resolveCellLocalID(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh);
+
+				/**
+				 * Replace the global IDs of the current and previous cells of the particle with the labels of
+				 * those cells. Global cell IDs depend on how the cells of the mesh are distributed, so this
+				 * allows the cells to be identified in a mesh that has been redistributed, with
+				 * convertCellLabelsToGlobalIDs.
+				 * Previous cells that are not known to this rank are set to -1.
+				 *
+				 * @param mesh The mesh the particle is currently located in
+				 *
+				 * @tparam M The implementation type of the mesh
+				 * @tparam L The type of the mesh cell labels
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ADJACENCY_LIST_NODE_MISSING The current cell of the particle is not known to this rank
+				 */
+				template <class M, class L>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes convertCellGlobalIDsToLabels(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh);
+
+				/**
+				 * Replace the labels of the current and previous cells of the particle, as set by
+				 * convertCellGlobalIDsToLabels, with their global IDs in a mesh, and resolve the cached
+				 * local IDs of those cells.
+				 * Previous cells that are not known to this rank are set to -1.
+				 *
+				 * @param mesh The mesh the particle is now located in
+				 *
+				 * @tparam M The implementation type of the mesh
+				 * @tparam L The type of the mesh cell labels
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ADJACENCY_LIST_NODE_MISSING The current cell of the particle is not known to this rank
+				 */
+				template <class M, class L>
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes convertCellLabelsToGlobalIDs(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh);
+
 				/**
 				 * Get the ID of face through which particle entered current cell
 				 *
@@ -500,12 +581,13 @@ namespace cupcfd
 				 * back-and-forth
 				 *
 				 * @param cellGlobalID The cellID to set the particle cellID to
+				 * @param cellLocalID The mesh local ID of the same cell
 				 * @param cellEntryFaceLocalID ID of the face through which particle is entering cell
 				 *
 				 * @return Nothing
 				 */
 				__attribute__((warn_unused_result))
-				inline cupcfd::error::eCodes safelySetCellGlobalID(I cellGlobalID, I cellEntryFaceLocalID);
+				inline cupcfd::error::eCodes safelySetCellGlobalID(I cellGlobalID, I cellLocalID, I cellEntryFaceLocalID);
 
 				/**
 				 * Global ID of the cell in a mesh this particle is currently located in.
@@ -527,6 +609,18 @@ namespace cupcfd
 				 **/
 				I lastLastCellGlobalID;
 
+				/**
+				 * Cached mesh local ID of the cell identified by cellGlobalID, to avoid translating the global
+				 * ID through the connectivity graph maps on every update. Local IDs do not translate between
+				 * processes, so this is not communicated and must be resolved again on arrival at a rank.
+				 **/
+				I cellLocalID;
+
+				/**
+				 * Cached mesh local ID of the cell identified by lastCellGlobalID, or -1 if not known
+				 **/
+				I lastCellLocalID;
+
 				/**
 				 * Local ID of face used to enter cell
 				 **/
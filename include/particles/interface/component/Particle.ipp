@@ -35,6 +35,8 @@ namespace cupcfd
 		 cellGlobalID(-1),
 		 lastCellGlobalID(-1),
 		 lastLastCellGlobalID(-1),
+		 cellLocalID(-1),
+		 lastCellLocalID(-1),
 		 cellEntryFaceLocalID(-1)
 		{
 		
@@ -56,6 +58,8 @@ namespace cupcfd
 		 cellGlobalID(cellGlobalID),
 		 lastCellGlobalID(-1),
 		 lastLastCellGlobalID(-1),
+		 cellLocalID(-1),
+		 lastCellLocalID(-1),
 		 cellEntryFaceLocalID(-1)
 		{
 		
@@ -77,6 +81,11 @@ namespace cupcfd
 			return this->rank;
 		}
 
+		template <class P, class I, class T>
+		inline void Particle<P, I, T>::setRank(I rank) {
+			this->rank = rank;
+		}
+
 		template <class P, class I, class T>
 		inline void Particle<P, I, T>::setPos(cupcfd::geometry::euclidean::EuclideanPoint<T,3>& pos) {
 			this->pos = pos;
@@ -108,7 +117,7 @@ namespace cupcfd
 		}
 
 		template <class P, class I, class T>
-		inline cupcfd::error::eCodes Particle<P, I, T>::safelySetCellGlobalID(I cellGlobalID, I cellEntryFaceLocalID) {
+		inline cupcfd::error::eCodes Particle<P, I, T>::safelySetCellGlobalID(I cellGlobalID, I cellLocalID, I cellEntryFaceLocalID) {
 			if (this->cellGlobalID == cellGlobalID) {
 				std::cout << "ERROR: Attempting to update a particle " << this->particleID << " to be in cell " << cellGlobalID << " but it is already in that cell" << std::endl;
 				return cupcfd::error::E_ERROR;
@@ -123,6 +132,9 @@ namespace cupcfd
 			this->lastCellGlobalID = this->cellGlobalID;
 			this->cellGlobalID = cellGlobalID;
 
+			this->lastCellLocalID = this->cellLocalID;
+			this->cellLocalID = cellLocalID;
+
 			if (cellEntryFaceLocalID == I(-1)) {
 				std::cout << "ERROR: Particle::safelySetCellGlobalID() called with invalid value of 'cellEntryFaceLocalID'" << std::endl;
 				return cupcfd::error::E_ERROR;
@@ -142,6 +154,83 @@ namespace cupcfd
 			return this->lastCellGlobalID;
 		}
 
+		template <class P, class I, class T>
+		inline I Particle<P, I, T>::getCellLocalID() const {
+			return this->cellLocalID;
+		}
+
+		template <class P, class I, class T>
+		template <class M, class L>
+		cupcfd::error::eCodes Particle<P, I, T>::resolveCellLocalID(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh) {
+			cupcfd::error::eCodes status;
+
+			// Use find rather than [] so that unknown global IDs are not inserted into the graph maps
+			auto it = mesh.cellConnGraph->globalToNode.find(this->cellGlobalID);
+			if(it == mesh.cellConnGraph->globalToNode.end()) {
+				this->cellLocalID = I(-1);
+				this->lastCellLocalID = I(-1);
+				return cupcfd::error::E_ADJACENCY_LIST_NODE_MISSING;
+			}
+
+			status = mesh.cellConnGraph->connGraph.getNodeLocalIndex(it->second, &(this->cellLocalID));
+			CHECK_ECODE(status)
+
+			this->lastCellLocalID = I(-1);
+			if(this->lastCellGlobalID != I(-1)) {
+				it = mesh.cellConnGraph->globalToNode.find(this->lastCellGlobalID);
+				if(it != mesh.cellConnGraph->globalToNode.end()) {
+					status = mesh.cellConnGraph->connGraph.getNodeLocalIndex(it->second, &(this->lastCellLocalID));
+					CHECK_ECODE(status)
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class P, class I, class T>
+		template <class M, class L>
+		cupcfd::error::eCodes Particle<P, I, T>::convertCellGlobalIDsToLabels(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh) {
+			auto it = mesh.cellConnGraph->globalToNode.find(this->cellGlobalID);
+			if(it == mesh.cellConnGraph->globalToNode.end()) {
+				return cupcfd::error::E_ADJACENCY_LIST_NODE_MISSING;
+			}
+			this->cellGlobalID = it->second;
+
+			I * history[2] = {&(this->lastCellGlobalID), &(this->lastLastCellGlobalID)};
+			for(I * globalID : history) {
+				if(*globalID != I(-1)) {
+					it = mesh.cellConnGraph->globalToNode.find(*globalID);
+					*globalID = (it == mesh.cellConnGraph->globalToNode.end()) ? I(-1) : it->second;
+				}
+			}
+
+			// Local IDs are only valid for the mesh they were resolved against
+			this->cellLocalID = I(-1);
+			this->lastCellLocalID = I(-1);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class P, class I, class T>
+		template <class M, class L>
+		cupcfd::error::eCodes Particle<P, I, T>::convertCellLabelsToGlobalIDs(cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>& mesh) {
+			auto it = mesh.cellConnGraph->nodeToGlobal.find(this->cellGlobalID);
+			if(it == mesh.cellConnGraph->nodeToGlobal.end()) {
+				return cupcfd::error::E_ADJACENCY_LIST_NODE_MISSING;
+			}
+			this->cellGlobalID = it->second;
+
+			I * history[2] = {&(this->lastCellGlobalID), &(this->lastLastCellGlobalID)};
+			for(I * label : history) {
+				if(*label != I(-1)) {
+					it = mesh.cellConnGraph->nodeToGlobal.find(*label);
+					*label = (it == mesh.cellConnGraph->nodeToGlobal.end()) ? I(-1) : it->second;
+				}
+			}
+
+			return this->resolveCellLocalID(mesh);
+		}
+
 		template <class P, class I, class T>
 		inline I Particle<P, I, T>::getCellEntryFaceLocalID() const {
 			return this->cellEntryFaceLocalID;
@@ -214,40 +303,32 @@ namespace cupcfd
 			cupcfd::geometry::euclidean::EuclideanVector<T,3> velocity = this->velocity;
 
 			// Break the faces up into triangles and compute the intersection with the plane of each triangle and determine the time to reach
-			// Get the vertices/spatial coordinates for each face
-			I nFaceVertices = mesh.getFaceNVertices(faceID);
+			// The triangle fan of each face is cached by the mesh, so this does not have to walk the face vertices
+			I nFaceTriangles = mesh.getFaceNTriangles(faceID);
 
 			// Counters to ensure that face is being split into non-overlapping triangles:
 			I num_faces_contacting_particle_on_edge = I(0);
 			I num_faces_contacting_particle_within_tri = I(0);
 
-			I faceVertex0ID = mesh.getFaceVertex(faceID, 0);
-			for(I j = 1; j < (nFaceVertices-1); j++) {
-				I faceVertex1ID = mesh.getFaceVertex(faceID, j);
-				I faceVertex2ID = mesh.getFaceVertex(faceID, j+1);
-
-				cupcfd::geometry::euclidean::EuclideanPoint<T,3> faceVertex0 = mesh.getVertexPos(faceVertex0ID);
-				cupcfd::geometry::euclidean::EuclideanPoint<T,3> faceVertex1 = mesh.getVertexPos(faceVertex1ID);
-				cupcfd::geometry::euclidean::EuclideanPoint<T,3> faceVertex2 = mesh.getVertexPos(faceVertex2ID);
-
-				cupcfd::geometry::euclidean::EuclideanPlane3D<T> plane(faceVertex0, faceVertex1, faceVertex2);
+			// Check if velocity is parallel to face (i.e. the plane of its first triangle):
+			if (nFaceTriangles > 0 && mesh.isVectorParallelToFace(faceID, this->velocity)) {
+				return cupcfd::error::E_SUCCESS;
+			}
 
-				if (j==1) {
-					// On first triangle, check if velocity is parallel to face:
-					if (plane.isVectorParallel(this->velocity)) {
-						return cupcfd::error::E_SUCCESS;
-					}
-				}
+			cupcfd::geometry::euclidean::EuclideanPoint<T,3> faceVertex0;
+			cupcfd::geometry::euclidean::EuclideanPoint<T,3> faceVertex1;
+			cupcfd::geometry::euclidean::EuclideanPoint<T,3> faceVertex2;
 
-				cupcfd::geometry::shapes::Triangle3D<T> shape(mesh.getVertexPos(faceVertex0ID), 
-															  mesh.getVertexPos(faceVertex1ID), 
-															  mesh.getVertexPos(faceVertex2ID));
+			for(I j = 0; j < nFaceTriangles; j++) {
+				mesh.getFaceTriangle(faceID, j, faceVertex0, faceVertex1, faceVertex2);
 
 				bool doesIntersectTriangle;
 				bool doesIntersectTriangleOnEdge;
 				cupcfd::geometry::euclidean::EuclideanPoint<T,3> triIntersection;
 				T timeToIntersectTriangle;
-				doesIntersectTriangle = shape.calculateIntersection(v0, velocity, triIntersection, timeToIntersectTriangle, &doesIntersectTriangleOnEdge, verbose);
+				doesIntersectTriangle = cupcfd::geometry::shapes::Triangle3D<T>::calculateIntersection(faceVertex0, faceVertex1, faceVertex2,
+																									  v0, velocity, triIntersection, timeToIntersectTriangle,
+																									  &doesIntersectTriangleOnEdge, verbose);
 				
 				if (doesIntersectTriangle) {
 					if (doesIntersect) {
@@ -301,11 +382,13 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 		
-			// Get Cell Local ID - ToDo: Could store this inside cell - storage overhead vs graph lookup overhead
-			I node = mesh.cellConnGraph->globalToNode[this->cellGlobalID];
-			I localCellID;
-			status = mesh.cellConnGraph->connGraph.getNodeLocalIndex(node, &localCellID);
-			CHECK_ECODE(status)
+			// Get Cell Local ID - this is cached on the particle, so only needs resolving via the
+			// connectivity graph if the particle has not been placed against this mesh yet
+			if(this->cellLocalID == I(-1)) {
+				status = this->resolveCellLocalID(mesh);
+				CHECK_ECODE(status)
+			}
+			I localCellID = this->cellLocalID;
 
 			// ****************************************************** //
 			// Identify which face the exiting vector intersects with //
@@ -323,36 +406,9 @@ namespace cupcfd
 
 			I intersectionCount = 0;
 
-			// Calculate maximum distance across cell, to provide an upper bound on 
+			// Maximum distance across cell, to provide an upper bound on 
 			// valid values for distance-to-intersection:
-			T max_inter_vertex_distance = T(-1);
-			for(I f1 = 0; f1 < nFaces; f1++) {
-				I localFaceID1 = mesh.getCellFaceID(localCellID, f1);
-				I nFaceVertices1 = mesh.getFaceNVertices(localFaceID1);
-				for(I j1 = 0; j1 < nFaceVertices1; j1++) {
-					I faceVertexID1 = mesh.getFaceVertex(localFaceID1, j1);
-
-					for (I f2 = 0; f2 < nFaces; f2++) {
-						I localFaceID2 = mesh.getCellFaceID(localCellID, f2);
-						I nFaceVertices2 = mesh.getFaceNVertices(localFaceID2);
-						for(I j2 = j1+1; j2 < nFaceVertices2; j2++) {
-							I faceVertexID2 = mesh.getFaceVertex(localFaceID2, j2);
-
-							if (faceVertexID1 != faceVertexID2) {
-								T face_edge_length = 
-								( mesh.getVertexPos(faceVertexID1) - mesh.getVertexPos(faceVertexID2) ).length();
-
-								if (max_inter_vertex_distance == T(-1)) {
-									max_inter_vertex_distance = face_edge_length;
-								}
-								else if (max_inter_vertex_distance < face_edge_length) {
-									max_inter_vertex_distance = face_edge_length;
-								}
-							}
-						}
-					}
-				}
-			}
+			T max_inter_vertex_distance = mesh.getCellDiameter(localCellID);
 
 			// Loop over the faces of the cell
 			bool face_was_found = false;
@@ -512,19 +568,20 @@ namespace cupcfd
 				this->print();
 			}
 
-			I cellGlobalID = this->getCellGlobalID();
-			I cellNode = mesh.cellConnGraph->globalToNode[cellGlobalID];
-			I cellLocalID;
-			status = mesh.cellConnGraph->connGraph.getNodeLocalIndex(cellNode, &cellLocalID);
-			CHECK_ECODE(status)
+			if(this->cellLocalID == I(-1)) {
+				status = this->resolveCellLocalID(mesh);
+				CHECK_ECODE(status)
+			}
+
+			I cellLocalID = this->cellLocalID;
 			I cellNumFaces;
 			mesh.getCellNFaces(cellLocalID, &cellNumFaces);
 
-			I lastCellGlobalID = this->lastCellGlobalID;
-			I lastCellNode = mesh.cellConnGraph->globalToNode[lastCellGlobalID];
-			I lastCellLocalID;
-			status = mesh.cellConnGraph->connGraph.getNodeLocalIndex(lastCellNode, &lastCellLocalID);
-			CHECK_ECODE(status)
+			I lastCellLocalID = this->lastCellLocalID;
+			if(lastCellLocalID == I(-1)) {
+				std::cout << "ERROR: Previous cell " << this->lastCellGlobalID << " of particle " << this->particleID << " is not known to this rank" << std::endl;
+				return cupcfd::error::E_ADJACENCY_LIST_NODE_MISSING;
+			}
 			I lastCellNumFaces;
 			mesh.getCellNFaces(lastCellLocalID, &lastCellNumFaces);
 
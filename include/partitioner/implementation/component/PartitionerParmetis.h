@@ -258,6 +258,26 @@ namespace cupcfd
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes partition();
 
+				/**
+				 * Set a weight for each of the locally stored nodes. ParMETIS only accepts integer vertex
+				 * weights, so each weight is rounded to the nearest integer (with a minimum of 1).
+				 *
+				 * Once vertex weights are set, partition() treats the current distribution of the nodes
+				 * as the existing partition and repartitions it with ParMETIS_V3_AdaptiveRepart, which
+				 * balances the weights while limiting how many nodes move to another process.
+				 * This requires nParts to match the size of the work communicator.
+				 *
+				 * @param weights The weight of each node. Every weight must be greater than zero.
+				 * @param nWeights The size of weights in the number of elements of type double. Must be nNodes.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH nWeights does not match the number of nodes
+				 * @retval cupcfd::error::E_PARTITIONER_INVALID_NODE_WEIGHTS One or more weights are not greater than zero
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setNodeWeights(double * weights, I nWeights);
+
 				__attribute__((warn_unused_result))
 				cupcfd::error::eCodes initialise(cupcfd::data_structures::DistributedAdjacencyList<I, T>& graph, I nParts);
 
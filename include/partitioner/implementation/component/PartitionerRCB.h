@@ -0,0 +1,89 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declaration for the PartitionerRCB class
+ */
+
+#ifndef CUPCFD_PARTITIONER_RCB_INCLUDE_H
+#define CUPCFD_PARTITIONER_RCB_INCLUDE_H
+
+#include "PartitionerGeometric.h"
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		/**
+		 * Partitioner that uses Recursive Coordinate Bisection (RCB) of the node coordinates.
+		 *
+		 * Starting with all of the nodes in one group, each group of more than one partition is cut in two
+		 * by a plane normal to the longest side of its bounding box. The cut is placed so that the number of
+		 * nodes (or their total weight, if node weights are set) on each side is proportional to the number of
+		 * partitions on that side, so nParts does not need to be a power of two.
+		 *
+		 * Every level of the bisection orders the nodes of all groups at once with a parallel sample sort, so
+		 * each level is O(n log n), and there are ceil(log2(nParts)) levels. The partitions are box-shaped,
+		 * which suits particle tracking, but the graph connectivity is not used.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the stored array data
+		 */
+		template <class I, class T>
+		class PartitionerRCB : public cupcfd::partitioner::PartitionerGeometric<I,T>
+		{
+			public:
+				// === Members ===
+
+				// === Methods ===
+				// Constructor/Deconstructors
+
+				/**
+				 * Create a default Partitioner object.
+				 *
+				 * @param workComm Communicator of all processes creating a partitioning object that
+				 * could potentially receive partition assignments.
+				 */
+				PartitionerRCB(cupcfd::comm::Communicator& workComm);
+
+				/**
+				 * Create a partitioner object and setup the node storage from the locally owned nodes of the graph.
+				 * The coordinates of the nodes must still be set with setNodeCoordinates before partitioning.
+				 *
+				 * @param sourceGraph The graph to partition
+				 * @param nParts The number of parts to partition the graph into
+				 */
+				PartitionerRCB(cupcfd::data_structures::DistributedAdjacencyList<I,T>& sourceGraph, int nParts);
+
+				/**
+				 * Deconstructor for a PartitionerRCB object.
+				 * This will free up any memory being used to store result, node or coordinate data.
+				 */
+				~PartitionerRCB();
+
+				// === Inherited Overrides ===
+
+				/**
+				 * Partition the stored nodes by recursive coordinate bisection.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_PARTITIONER_NPARTS_UNSET The number of partitions is not set
+				 * @retval cupcfd::error::E_PARTITIONER_MISSING_NODE_DATA No node data is stored
+				 * @retval cupcfd::error::E_PARTITIONER_MISSING_COORDINATE_DATA The node coordinates are not set
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes partition();
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "PartitionerRCB.ipp"
+
+#endif
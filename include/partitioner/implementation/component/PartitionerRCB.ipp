@@ -0,0 +1,24 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the PartitionerRCB class
+ */
+
+#ifndef CUPCFD_PARTITIONER_RCB_IPP_H
+#define CUPCFD_PARTITIONER_RCB_IPP_H
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+	
+	}
+}
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the declaration for the PartitionerSFC class
+ */
+
+#ifndef CUPCFD_PARTITIONER_SFC_INCLUDE_H
+#define CUPCFD_PARTITIONER_SFC_INCLUDE_H
+
+#include "PartitionerGeometric.h"
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		/**
+		 * The space-filling curves that PartitionerSFC can order the nodes along
+		 */
+		enum PartitionerSFCCurve
+		{
+			/** Morton (Z-order) curve **/
+			PARTITIONER_SFC_MORTON,
+
+			/** Hilbert curve **/
+			PARTITIONER_SFC_HILBERT
+		};
+
+		/**
+		 * Partitioner that orders the nodes along a space-filling curve through their coordinates,
+		 * and cuts the curve into nParts contiguous pieces of (as near as possible) equal size. If node weights
+		 * are set, the pieces have equal total weight instead.
+		 *
+		 * The coordinates are quantised onto a grid of 2^21 cells per dimension over the global bounding
+		 * box, and the nodes are ordered across all processes with a parallel sample sort, so the partitioning
+		 * is O(n log n) and does not need the graph connectivity. Nodes that are close along the curve are
+		 * close in space, so each partition is spatially compact, but its boundary is not minimised as a graph
+		 * partitioner would.
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the stored array data
+		 */
+		template <class I, class T>
+		class PartitionerSFC : public cupcfd::partitioner::PartitionerGeometric<I,T>
+		{
+			public:
+				// === Members ===
+
+				/** The space-filling curve used to order the nodes **/
+				PartitionerSFCCurve curve;
+
+				// === Methods ===
+				// Constructor/Deconstructors
+
+				/**
+				 * Create a default Partitioner object.
+				 *
+				 * @param workComm Communicator of all processes creating a partitioning object that
+				 * could potentially receive partition assignments.
+				 * @param curve The space-filling curve used to order the nodes
+				 */
+				PartitionerSFC(cupcfd::comm::Communicator& workComm, PartitionerSFCCurve curve);
+
+				/**
+				 * Create a partitioner object and setup the node storage from the locally owned nodes of the graph.
+				 * The coordinates of the nodes must still be set with setNodeCoordinates before partitioning.
+				 *
+				 * @param sourceGraph The graph to partition
+				 * @param nParts The number of parts to partition the graph into
+				 * @param curve The space-filling curve used to order the nodes
+				 */
+				PartitionerSFC(cupcfd::data_structures::DistributedAdjacencyList<I,T>& sourceGraph, int nParts,
+							   PartitionerSFCCurve curve);
+
+				/**
+				 * Deconstructor for a PartitionerSFC object.
+				 * This will free up any memory being used to store result, node or coordinate data.
+				 */
+				~PartitionerSFC();
+
+				// === Inherited Overrides ===
+
+				/**
+				 * Partition the stored nodes along the space-filling curve.
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_PARTITIONER_NPARTS_UNSET The number of partitions is not set
+				 * @retval cupcfd::error::E_PARTITIONER_MISSING_NODE_DATA No node data is stored
+				 * @retval cupcfd::error::E_PARTITIONER_MISSING_COORDINATE_DATA The node coordinates are not set
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes partition();
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "PartitionerSFC.ipp"
+
+#endif
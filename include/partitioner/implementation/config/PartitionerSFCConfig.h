@@ -0,0 +1,90 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the class declaration for the PartitionerSFCConfig class.
+ */
+
+#ifndef CUPCFD_PARTITIONER_SFC_CONFIG_INCLUDE_H
+#define CUPCFD_PARTITIONER_SFC_CONFIG_INCLUDE_H
+
+#include "PartitionerConfig.h"
+#include "PartitionerSFC.h"
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		/**
+		 * Stores configuration details and builder functions for PartitionerSFC classes
+		 */
+		template <class I, class T>
+		class PartitionerSFCConfig : public PartitionerConfig<I,T>
+		{
+			public:
+				// === Members ===
+
+				/** The space-filling curve used to order the nodes **/
+				PartitionerSFCCurve curve;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Constructor:
+				 * Set up the SFC configuration options
+				 *
+				 * @param curve The space-filling curve used to order the nodes
+				 *
+				 * @tparam I The indexing scheme of the partitioner.
+				 * @tparam T The datatype of the partitioner nodes/graph to be partitioned.
+				 */
+				PartitionerSFCConfig(PartitionerSFCCurve curve);
+
+				/**
+				 * Deconstructor.
+				 *
+				 * Destroys any dynamically allocated memory and/or objects.
+				 *
+				 * @tparam I The indexing scheme of the partitioner.
+				 * @tparam T The datatype of the partitioner nodes/graph to be partitioned.
+				 */
+				~PartitionerSFCConfig();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Get the space-filling curve used to order the nodes
+				 *
+				 * @return The space-filling curve
+				 */
+				__attribute__((warn_unused_result))
+				inline PartitionerSFCCurve getCurve();
+
+				/**
+				 * Set the space-filling curve used to order the nodes
+				 *
+				 * @param curve The space-filling curve
+				 */
+				inline void setCurve(PartitionerSFCCurve curve);
+
+				// === Overridden Inherited Methods ===
+				__attribute__((warn_unused_result))
+				PartitionerSFCConfig<I,T> * clone();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildPartitioner(PartitionerInterface<I,T> ** part);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildPartitioner(PartitionerInterface<I,T> ** part,
+														cupcfd::data_structures::DistributedAdjacencyList<I,T>& partGraph);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "PartitionerSFCConfig.ipp"
+
+#endif
@@ -0,0 +1,32 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the header level definitions for the PartitionerSFCConfig class.
+ */
+
+#ifndef CUPCFD_PARTITIONER_SFC_CONFIG_IPP_H
+#define CUPCFD_PARTITIONER_SFC_CONFIG_IPP_H
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		template <class I, class T>
+		inline PartitionerSFCCurve PartitionerSFCConfig<I,T>::getCurve() {
+			return this->curve;
+		}
+
+		template <class I, class T>
+		inline void PartitionerSFCConfig<I,T>::setCurve(PartitionerSFCCurve curve) {
+			this->curve = curve;
+		}
+	}
+}
+
+#endif
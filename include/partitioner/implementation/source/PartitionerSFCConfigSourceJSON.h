@@ -0,0 +1,87 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Declaration for the PartitionerSFCConfigSourceJSON class.
+ */
+
+#ifndef CUPCFD_PARTITIONER_SFC_CONFIG_SOURCE_JSON_INCLUDE_H
+#define CUPCFD_PARTITIONER_SFC_CONFIG_SOURCE_JSON_INCLUDE_H
+
+// C++ Std Lib
+#include <string>
+#include <vector>
+
+// Error Codes
+#include "Error.h"
+
+// Abstract interface
+#include "PartitionerSFCConfigSource.h"
+
+// JsonCPP - Supplied as standalone in include/io/jsoncpp
+#include "json.h"
+#include "json-forwards.h"
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+	/**
+	 * Defines a interface for accessing SFC partitioner configuration
+	 * options from a JSON data source.
+	 *
+	 * === Fields ===
+	 *
+	 * Required:
+	 * None
+	 *
+	 * Optional:
+	 * Curve: The space-filling curve used to order the nodes, either "Morton" or "Hilbert".
+	 * Defaults to "Hilbert".
+	 */
+		template <class I, class T>
+		class PartitionerSFCConfigSourceJSON : public PartitionerSFCConfigSource<I,T>
+		{
+			public:
+				// === Members ===
+
+				/** Json Data Store containing fields for this JSON source **/
+				Json::Value configData;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Parse the JSON record provided for fields belonging to PartitionerSFC JSON.
+				 * The fields are presumed to start from level 0 (i.e. they are not nested inside other objects)
+				 *
+				 * @param parseJSON The contents of a JSON record with the appropriate fields.
+				 */
+				PartitionerSFCConfigSourceJSON(Json::Value& parseJSON);
+
+				/**
+				 * Deconstructor
+				 */
+				~PartitionerSFCConfigSourceJSON();
+
+				// === Concrete Methods ===
+
+				// === Overloaded Methods ===
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes getCurve(PartitionerSFCCurve * curve);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes buildPartitionerConfig(PartitionerConfig<I,T> ** config);
+
+				// === Pure Virtual Methods ===
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "PartitionerSFCConfigSourceJSON.ipp"
+
+#endif
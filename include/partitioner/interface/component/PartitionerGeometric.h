@@ -0,0 +1,149 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the abstract PartitionerGeometric class
+ */
+
+#ifndef CUPCFD_PARTITIONER_GEOMETRIC_INCLUDE_H
+#define CUPCFD_PARTITIONER_GEOMETRIC_INCLUDE_H
+
+#include "PartitionerInterface.h"
+
+#include <vector>
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		/**
+		 * Abstract base class for partitioners that assign nodes to partitions based on their spatial coordinates
+		 * (e.g. the cell centers of a mesh) rather than the graph connectivity.
+		 *
+		 * In addition to the node and result storage of PartitionerInterface, this stores the coordinates and
+		 * optional weight of each node, and provides a parallel sample sort that the partitioners use to order the nodes across all
+		 * processes in O(n log n).
+		 *
+		 * @tparam I The type of the indexing scheme
+		 * @tparam T The type of the stored array data
+		 */
+		template <class I, class T>
+		class PartitionerGeometric : public cupcfd::partitioner::PartitionerInterface<I,T>
+		{
+			public:
+				// === Members ===
+
+				/** The coordinates of each node in the nodes array, stored as consecutive x, y, z triplets **/
+				double * coords;
+
+				/** Size of coords in the number of elements of type double **/
+				I nCoords;
+
+				/** The weight of each node in the nodes array, or nullptr if every node has a weight of one **/
+				double * weights;
+
+				/** Size of weights in the number of elements of type double **/
+				I nWeights;
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Create a default Partitioner object.
+				 * Any internal data stores will be set to nullptr.
+				 *
+				 * @param workComm Communicator of processes creating the partitioner object that will
+				 * perform the partitioning.
+				 */
+				PartitionerGeometric(cupcfd::comm::Communicator& workComm);
+
+				/**
+				 * Create a partitioner object and setup the node storage from the locally owned nodes of the graph.
+				 * The coordinates of the nodes must still be set with setNodeCoordinates before partitioning.
+				 *
+				 * @param sourceGraph The graph to partition
+				 * @param nParts The number of parts to partition the graph into
+				 */
+				PartitionerGeometric(cupcfd::data_structures::DistributedAdjacencyList<I,T>& sourceGraph, int nParts);
+
+				/**
+				 * Deconstructor.
+				 * This will free up any memory being used to store result, node or coordinate data.
+				 */
+				virtual ~PartitionerGeometric();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Reset any data storage used for storing the node coordinates.
+				 * This will leave the coordinate storage unallocated and set to nullptr.
+				 */
+				void resetCoordinateStorage();
+
+				/**
+				 * Reset any data storage used for storing the node weights.
+				 * This will leave the weight storage unallocated and set to nullptr, so every node has a weight of one.
+				 */
+				void resetWeightStorage();
+
+				/**
+				 * Get the weight of each stored node, in the same order as the nodes array.
+				 * If no weights are set, every node has a weight of one.
+				 *
+				 * @param nodeWeights The vector to store the weights in. It is resized to nNodes.
+				 */
+				void getNodeWeights(std::vector<double>& nodeWeights);
+
+				/**
+				 * Find the position of each key stored on this process in a global ascending order of the
+				 * keys across all processes of workComm, using a parallel sample sort.
+				 *
+				 * Keys are ordered by their primary value, and then by their secondary value. Equal keys
+				 * are ordered by process rank and then by their index on the process, so the ordering is
+				 * deterministic and every key has a distinct position. Each key also carries a weight, and the sum of
+				 * the weights of all keys before it in the global order is found alongside its position.
+				 *
+				 * @param primary The primary value of each key
+				 * @param nPrimary The size of primary in the number of elements of type long
+				 * @param secondary The secondary value of each key
+				 * @param nSecondary The size of secondary in the number of elements of type double
+				 * @param keyWeights The weight of each key
+				 * @param nKeyWeights The size of keyWeights in the number of elements of type double
+				 * @param positions The array to store the global position of each key in.
+				 * @param nPositions The size of positions in the number of elements of type I
+				 * @param weightBefore The array to store the sum of the weights of the keys before each key in.
+				 * @param nWeightBefore The size of weightBefore in the number of elements of type double
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_ARRAY_SIZE_MISMATCH The sizes of the key arrays do not match
+				 * @retval cupcfd::error::E_ARRAY_SIZE_UNDERSIZED positions or weightBefore is too small for the number of keys
+				 */
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes computeSortedPositions(long * primary, I nPrimary, double * secondary, I nSecondary,
+															 double * keyWeights, I nKeyWeights,
+															 I * positions, I nPositions, double * weightBefore, I nWeightBefore);
+
+				// === Inherited Overrides ===
+				void setNodeStorage(T * nodes, I nNodes);
+				void reset();
+				__attribute__((warn_unused_result))
+				bool usesNodeCoordinates();
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setNodeCoordinates(double * coords, I nCoords);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes setNodeWeights(double * weights, I nWeights);
+				__attribute__((warn_unused_result))
+				cupcfd::error::eCodes initialise(cupcfd::data_structures::DistributedAdjacencyList<I, T>& graph, I nParts);
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "PartitionerGeometric.ipp"
+
+#endif
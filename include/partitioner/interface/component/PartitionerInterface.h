@@ -206,6 +206,54 @@ namespace cupcfd
 				virtual cupcfd::error::eCodes assignRankNodes(T** rankNodes,
 																   I * nNodes);
 
+				/**
+				 * Whether this partitioner uses the spatial coordinates of the nodes (e.g. the cell centers)
+				 * rather than, or in addition to, the graph connectivity. If true, the coordinates must be
+				 * provided with setNodeCoordinates before calling partition.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored array data
+				 *
+				 * @return True if the node coordinates are used, false otherwise
+				 */
+				__attribute__((warn_unused_result))
+				virtual bool usesNodeCoordinates();
+
+				/**
+				 * Set the spatial coordinates of the nodes currently stored in the partitioner.
+				 * The coordinates are stored as consecutive x, y, z triplets, in the same order as the nodes array.
+				 *
+				 * @param coords The coordinates of the nodes
+				 * @param nCoords The size of coords in the number of elements of type double. Must be 3 * nNodes.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored array data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_NOT_IMPLEMENTED This partitioner does not use node coordinates
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes setNodeCoordinates(double * coords, I nCoords);
+
+				/**
+				 * Set a weight for each of the nodes currently stored in the partitioner, in the same order as the
+				 * nodes array. Partitioners that support weights balance the sum of the node weights in each
+				 * partition rather than the number of nodes.
+				 *
+				 * @param weights The weight of each node. Every weight must be greater than zero.
+				 * @param nWeights The size of weights in the number of elements of type double. Must be nNodes.
+				 *
+				 * @tparam I The type of the indexing scheme
+				 * @tparam T The type of the stored array data
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_NOT_IMPLEMENTED This partitioner does not support node weights
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes setNodeWeights(double * weights, I nWeights);
+
 				/**
 				 *  Reset all internal data stores and configuration settings for the partitioner.
 				 *
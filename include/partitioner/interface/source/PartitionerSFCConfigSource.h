@@ -0,0 +1,71 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains declarations for the PartitionerSFCConfigSource class.
+ */
+
+#ifndef CUPCFD_PARTITIONER_SFC_CONFIG_SOURCE_INCLUDE_H
+#define CUPCFD_PARTITIONER_SFC_CONFIG_SOURCE_INCLUDE_H
+
+#include "PartitionerConfig.h"
+#include "PartitionerSFC.h"
+#include "Error.h"
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		/**
+		 * Defines a interface for accessing SFC Partitioner Configuration settings
+		 * from a source
+		 */
+		template <class I, class T>
+		class PartitionerSFCConfigSource
+		{
+			public:
+				// === Members ===
+
+				// === Constructors/Deconstructors ===
+
+				/**
+				 * Constructor:
+				 * Currently does nothing
+				 */
+				PartitionerSFCConfigSource();
+
+				/**
+				 * Deconstructor.
+				 */
+				virtual ~PartitionerSFCConfigSource();
+
+				// === Concrete Methods ===
+
+				/**
+				 * Get the space-filling curve used to order the nodes
+				 *
+				 * @param curve A pointer to the location where the curve will be stored
+				 *
+				 * @return An error status indicating the success or failure of the operation
+				 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+				 * @retval cupcfd::error::E_CONFIG_OPT_NOT_FOUND The curve was not specified
+				 * @retval cupcfd::error::E_CONFIG_INVALID_VALUE The curve is not a recognised value
+				 */
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes getCurve(PartitionerSFCCurve * curve) = 0;
+
+				__attribute__((warn_unused_result))
+				virtual cupcfd::error::eCodes buildPartitionerConfig(PartitionerConfig<I,T> ** config) = 0;
+		};
+	}
+}
+
+// Include Header Level Definitions
+#include "PartitionerSFCConfigSource.ipp"
+
+#endif
@@ -0,0 +1,24 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains header level definitions for the PartitionerSFCConfigSource class.
+ */
+
+#ifndef CUPCFD_PARTITIONER_SFC_CONFIG_SOURCE_IPP_H
+#define CUPCFD_PARTITIONER_SFC_CONFIG_SOURCE_IPP_H
+
+namespace cupcfd
+{
+	namespace partitioner
+	{	
+
+	}
+}
+
+#endif
@@ -18,6 +18,7 @@
 #include <memory>
 
 #include "Benchmark.h"
+#include "MeshConfig.h"
 
 namespace cupcfd
 {
@@ -52,8 +53,10 @@ namespace cupcfd
 			 * thus the mesh object is setup separately from this class.
 			 *
 			 * @param jsonFilePath Path to JSON Configuration File
+			 * @param meshPtr The mesh to use in the benchmarks
+			 * @param meshConfig The configuration meshPtr was built from, for benchmarks that rebuild the mesh
 			 */
-			CupCfd(std::string jsonFilePath, std::shared_ptr<M> meshPtr);
+			CupCfd(std::string jsonFilePath, std::shared_ptr<M> meshPtr, cupcfd::geometry::mesh::MeshConfig<I,T,L>& meshConfig);
 
 			/**
 			 *
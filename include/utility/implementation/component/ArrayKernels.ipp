@@ -145,6 +145,11 @@ namespace cupcfd
 
 			template <class I, class T>
 			void distinctArray(T * source, T * dst, I * dupCount, I nEle) {
+				// Return if size is 0 or less
+				if(nEle <= 0) {
+					return;
+				}
+
 				// Assuming a minimum size of 1
 				I ptr = 0;
 				I curCount = 1;
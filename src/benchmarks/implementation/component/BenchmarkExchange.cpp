@@ -11,6 +11,7 @@
  */
 
 #include "BenchmarkExchange.h"
+#include "ExchangePatternMultiField.h"
 
 #include "tt_interface_c.h"
 #include <cstdlib>
@@ -20,9 +21,10 @@ namespace cupcfd
 	namespace benchmark
 	{
 		template <class I, class T>
-		BenchmarkExchange<I,T>::BenchmarkExchange(std::string benchmarkName, I repetitions, std::shared_ptr<cupcfd::comm::ExchangePattern<T>> patternPtr)
+		BenchmarkExchange<I,T>::BenchmarkExchange(std::string benchmarkName, I repetitions, I nFields, std::shared_ptr<cupcfd::comm::ExchangePattern<T>> patternPtr)
 		: Benchmark<I,T>(benchmarkName, repetitions),
-		  patternPtr(patternPtr)
+		  patternPtr(patternPtr),
+		  nFields(nFields)
 		{
 
 		}
@@ -57,41 +59,87 @@ namespace cupcfd
 
 			// ToDo: We would likely want to test vector exchanges too - how to generate a random vector value in a generic way
 			// that is also suitable for primitive types?
-			T * data = (T *) malloc(sizeof(T) * dataSize);
+			I nArrays = (this->nFields > 1) ? this->nFields : 1;
+			T ** data = (T **) malloc(sizeof(T *) * nArrays);
 
-			for(I i = 0; i < dataSize; i++) {
-				// The actual contents of the data array do not matter.
-				data[i] = T(i)/T(23);
+			for(I f = 0; f < nArrays; f++) {
+				data[f] = (T *) malloc(sizeof(T) * dataSize);
+
+				for(I i = 0; i < dataSize; i++) {
+					// The actual contents of the data array do not matter.
+					data[f][i] = T(i + f)/T(23);
+				}
 			}
 
 			this->startBenchmarkBlock(this->benchmarkName);
 			TreeTimerLogParameterInt("Repetitions", this->repetitions);
+			TreeTimerLogParameterInt("NFields", nArrays);
 
-			for(I i = 0; i < this->repetitions; i++) {
-				this->recordParameters();
+			if(nArrays == 1) {
+				for(I i = 0; i < this->repetitions; i++) {
+					this->recordParameters();
 
-				this->startBenchmarkBlock("PackBuffer");
-				status = patternPtr->packSendBuffer(data, dataSize);
-				CHECK_ECODE(status)
-				this->stopBenchmarkBlock("PackBuffer");
+					this->startBenchmarkBlock("PackBuffer");
+					status = patternPtr->packSendBuffer(data[0], dataSize);
+					CHECK_ECODE(status)
+					this->stopBenchmarkBlock("PackBuffer");
 
-				this->startBenchmarkBlock("Exchange");
-				status = patternPtr->exchangeStart(data, dataSize);
-				CHECK_ECODE(status)
+					this->startBenchmarkBlock("Exchange");
+					status = patternPtr->exchangeStart(data[0], dataSize);
+					CHECK_ECODE(status)
 
-				status = patternPtr->exchangeStop(data, dataSize);
-				CHECK_ECODE(status)
-				this->stopBenchmarkBlock("Exchange");
+					status = patternPtr->exchangeStop(data[0], dataSize);
+					CHECK_ECODE(status)
+					this->stopBenchmarkBlock("Exchange");
 
-				this->startBenchmarkBlock("UnpackBuffer");
-				status = patternPtr->unpackRecvBuffer(data, dataSize);
+					this->startBenchmarkBlock("UnpackBuffer");
+					status = patternPtr->unpackRecvBuffer(data[0], dataSize);
+					CHECK_ECODE(status)
+
+					this->stopBenchmarkBlock("UnpackBuffer");
+				}
+			}
+			else {
+				// Batch every array into one message per neighbour
+				cupcfd::comm::ExchangePatternMultiField multiField;
+				status = multiField.init(*patternPtr);
 				CHECK_ECODE(status)
 
-				this->stopBenchmarkBlock("UnpackBuffer");
+				for(I f = 0; f < nArrays; f++) {
+					status = multiField.registerField(data[f], dataSize);
+					CHECK_ECODE(status)
+				}
+
+				for(I i = 0; i < this->repetitions; i++) {
+					this->recordParameters();
+
+					// One exchange per array
+					this->startBenchmarkBlock("SingleFieldExchanges");
+					for(I f = 0; f < nArrays; f++) {
+						status = patternPtr->exchangeStart(data[f], dataSize);
+						CHECK_ECODE(status)
+
+						status = patternPtr->exchangeStop(data[f], dataSize);
+						CHECK_ECODE(status)
+					}
+					this->stopBenchmarkBlock("SingleFieldExchanges");
+
+					// One exchange for all arrays
+					this->startBenchmarkBlock("MultiFieldExchange");
+					status = multiField.exchangeStart();
+					CHECK_ECODE(status)
+
+					status = multiField.exchangeStop();
+					CHECK_ECODE(status)
+					this->stopBenchmarkBlock("MultiFieldExchange");
+				}
 			}
 
 			this->stopBenchmarkBlock(this->benchmarkName);
 
+			for(I f = 0; f < nArrays; f++) {
+				free(data[f]);
+			}
 			free(data);
 
 			return cupcfd::error::E_SUCCESS;
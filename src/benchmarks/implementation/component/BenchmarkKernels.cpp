@@ -18,7 +18,13 @@
 
 #include <cstdlib>
 
+#ifdef _OPENMP
+	#include <omp.h>
+#endif
+
 #include "ArrayKernels.h"
+#include "ExchangePatternConfig.h"
+#include "ExchangeOverlap.h"
 
 // Kernels
 #include "GradientKernels.h"
@@ -34,9 +40,10 @@ namespace cupcfd
 		template <class M, class I, class T, class L>
 		BenchmarkKernels<M,I,T,L>::BenchmarkKernels(std::string benchmarkName,
 																			std::shared_ptr<cupcfd::geometry::mesh::UnstructuredMeshInterface<M,I,T,L>> meshPtr,
-																			I repetitions)
+																			I repetitions, bool colouredFaceLoops)
 		: Benchmark<I,T>(benchmarkName, repetitions),
-		  meshPtr(meshPtr)
+		  meshPtr(meshPtr),
+		  colouredFaceLoops(colouredFaceLoops)
 		{
 
 		}
@@ -61,11 +68,28 @@ namespace cupcfd
 			// Track Number of Repetitions
 			TreeTimerLogParameterInt("Repetitions", this->repetitions);
 
+			// Track the face loop variant, and the number of threads available to the coloured variants
+			TreeTimerLogParameterInt("ColouredFaceLoops", this->colouredFaceLoops ? 1 : 0);
+			#ifdef _OPENMP
+				TreeTimerLogParameterInt("Threads", omp_get_max_threads());
+			#else
+				TreeTimerLogParameterInt("Threads", 1);
+			#endif
+
+			// Track the cell reordering applied when the mesh was finalized, and the locality of the
+			// local cell numbering before and after it (mean cell graph bandwidth)
+			TreeTimerLogParameterInt("CellReordering", int(this->meshPtr->reordering.type));
+			TreeTimerLogParameterDouble("CellBandwidthBefore", double(this->meshPtr->reordering.cellBandwidthBefore));
+			TreeTimerLogParameterDouble("CellBandwidthAfter", double(this->meshPtr->reordering.cellBandwidthAfter));
+
 			for(int i = 0; i < this->repetitions; i++) {
 				// Run each individual kernel benchmark
 				status = this->GradientPhiGaussDolfynBenchmark();
 				CHECK_ECODE(status)
 
+				status = this->GradientPhiGaussDolfynOverlapBenchmark();
+				CHECK_ECODE(status)
+
 				status = this->FluxMassDolfynFaceLoopBenchmark();
 				CHECK_ECODE(status)
 
@@ -173,9 +197,12 @@ namespace cupcfd
 			TreeTimerLogParameterInt("LocalBounds", nBnds);
 			TreeTimerLogParameterInt("LocalFaces", nFaces);
 
+			// Select the serial or thread-parallel (face coloured) version of the kernel
+			auto gradientKernel = this->colouredFaceLoops ? cupcfd::fvm::GradientPhiGaussDolfynColoured<M,I,T,L> : cupcfd::fvm::GradientPhiGaussDolfyn<M,I,T,L>;
+
 			// ToDo: Should add a configuration option to repeat the kernel X times per timing
 			// to reduce impact of overheads at small cell/face counts
-			status = cupcfd::fvm::GradientPhiGaussDolfyn(*meshPtr, nGradient,
+			status = gradientKernel(*meshPtr, nGradient,
 														phiCell, nCells,
 														phiBoundaries, nBnds,
 														dPhidxCell, nCells,
@@ -193,6 +220,90 @@ namespace cupcfd
 			return cupcfd::error::E_SUCCESS;
 		}
 
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes BenchmarkKernels<M,I,T,L>::GradientPhiGaussDolfynOverlapBenchmark() {
+			// As GradientPhiGaussDolfynBenchmark, but the ghost cell values of phi are also exchanged, using
+			// the exchange pattern of the mesh cell connectivity graph
+
+			cupcfd::error::eCodes status;
+
+			// === Setup Data ===
+			// Sizes
+			I nCells = meshPtr->properties.lTCells;
+			I nOwnedCells = meshPtr->properties.lOCells;
+			I nGhostCells = meshPtr->properties.lGhCells;
+			I nBnds = meshPtr->properties.lBoundaries;
+			I nFaces = meshPtr->properties.lFaces;
+
+			// Data needed for the kernel
+			I nGradient = 1;
+
+			// Create Random Phi Data for Cells
+			T * phiCell = (T *) malloc(sizeof(T) * nCells);
+			cupcfd::utility::kernels::randomUniform(phiCell, nCells, (T) 1E-6 , (T) 1E-2);
+
+			// Create RandomPhi Data for Boundaries
+			T * phiBoundaries = (T *) malloc(sizeof(T) * nBnds);
+			cupcfd::utility::kernels::randomUniform(phiBoundaries, nBnds, (T) 1E-6 , (T) 1E-2);
+
+			// Kernel will zero these arrays regardless of contents
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxCell =
+					(cupcfd::geometry::euclidean::EuclideanVector<T,3> *)
+					malloc(sizeof(cupcfd::geometry::euclidean::EuclideanVector<T,3>) * nCells);
+
+			// Kernel will zero these arrays regardless of contents
+			cupcfd::geometry::euclidean::EuclideanVector<T,3> * dPhidxoCell =
+					(cupcfd::geometry::euclidean::EuclideanVector<T,3> *)
+					malloc(sizeof(cupcfd::geometry::euclidean::EuclideanVector<T,3>) * nCells);
+
+			// Exchange pattern for the cell data. Building it is a collective setup cost, so it is not timed.
+			cupcfd::comm::ExchangePatternConfig exchangePatternConfig(cupcfd::comm::EXCHANGE_NONBLOCKING_TWO_SIDED);
+			cupcfd::comm::ExchangePattern<T> * exchangePattern;
+			status = exchangePatternConfig.buildExchangePattern(&exchangePattern, *(meshPtr->cellConnGraph));
+			CHECK_ECODE(status)
+
+			cupcfd::comm::ExchangeOverlapTiming timing;
+
+			// Start Timer
+			TreeTimerEnterLoop("GradientPhiGaussDolfynOverlapBenchmark");
+
+			// Track some parameters
+			TreeTimerLogParameterInt("LocalCells", nCells);
+			TreeTimerLogParameterInt("LocalOwnedCells", nOwnedCells);
+			TreeTimerLogParameterInt("LocalGhostCells", nGhostCells);
+			TreeTimerLogParameterInt("LocalBounds", nBnds);
+			TreeTimerLogParameterInt("LocalFaces", nFaces);
+			TreeTimerLogParameterInt("LocalInteriorFaces", meshPtr->haloFaces.nInteriorFaces);
+			TreeTimerLogParameterInt("LocalHaloFaces", meshPtr->haloFaces.nHaloFaces);
+
+			status = cupcfd::fvm::GradientPhiGaussDolfynOverlap(*meshPtr, *exchangePattern, nGradient,
+														phiCell, nCells,
+														phiBoundaries, nBnds,
+														dPhidxCell, nCells,
+														dPhidxoCell, nCells,
+														&timing);
+			CHECK_ECODE(status)
+
+			// Track how much of the exchange was hidden behind the interior faces
+			TreeTimerLogParameterDouble("ExchangeStartTime", timing.startTime);
+			TreeTimerLogParameterDouble("ExchangeWaitTime", timing.waitTime);
+			TreeTimerLogParameterDouble("InteriorFacesTime", timing.interiorTime);
+			TreeTimerLogParameterDouble("HaloFacesTime", timing.haloTime);
+			TreeTimerLogParameterDouble("OverlapFraction", timing.getOverlapFraction());
+
+			// Stop Timer
+			TreeTimerExit("GradientPhiGaussDolfynOverlapBenchmark");
+
+			delete exchangePattern;
+
+			free(phiCell);
+			free(phiBoundaries);
+			free(dPhidxCell);
+			free(dPhidxoCell);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
 		template <class M, class I, class T, class L>
 		cupcfd::error::eCodes BenchmarkKernels<M,I,T,L>::FluxMassDolfynFaceLoopBenchmark() {
 			cupcfd::error::eCodes status;
@@ -275,9 +386,12 @@ namespace cupcfd
 			TreeTimerLogParameterInt("LocalFaces", nFaces);
 			TreeTimerLogParameterInt("LocalRegions", nRegions);
 
+			// Select the serial or thread-parallel (face coloured) version of the kernel
+			auto faceLoopKernel = this->colouredFaceLoops ? cupcfd::fvm::FluxMassDolfynFaceLoopColoured<M,I,T,L> : cupcfd::fvm::FluxMassDolfynFaceLoop<M,I,T,L>;
+
 			// ToDo: Should add a configuration option to repeat the kernel X times per timing
 			// to reduce impact of overheads at small cell/face counts
-			status = cupcfd::fvm::FluxMassDolfynFaceLoop(*meshPtr,
+			status = faceLoopKernel(*meshPtr,
 						dudx, nCells,
 						dvdx, nCells,
 						dwdx, nCells,
@@ -705,9 +819,12 @@ namespace cupcfd
 			TreeTimerLogParameterInt("LocalFaces", nFaces);
 			TreeTimerLogParameterInt("LocalRegions", nRegions);
 
+			// Select the serial or thread-parallel (face coloured) version of the kernel
+			auto faceLoopKernel = this->colouredFaceLoops ? cupcfd::fvm::FluxScalarDolfynFaceLoopColoured<M,I,T,L> : cupcfd::fvm::FluxScalarDolfynFaceLoop<M,I,T,L>;
+
 			// ToDo: Should add a configuration option to repeat the kernel X times per timing
 			// to reduce impact of overheads at small cell/face counts
-			status = cupcfd::fvm::FluxScalarDolfynFaceLoop(*(this->meshPtr),
+			status = faceLoopKernel(*(this->meshPtr),
 														PhiCell, nCells,
 														PhiBoundary, nBnds,
 														VisEff, nCells,
@@ -830,9 +947,12 @@ namespace cupcfd
 			TreeTimerLogParameterInt("LocalFaces", nFaces);
 			TreeTimerLogParameterInt("LocalRegions", nRegions);
 
+			// Select the serial or thread-parallel (face coloured) version of the kernel
+			auto faceLoopKernel = this->colouredFaceLoops ? cupcfd::fvm::FluxUVWDolfynFaceLoop1Coloured<M,I,T,L> : cupcfd::fvm::FluxUVWDolfynFaceLoop1<M,I,T,L>;
+
 			// ToDo: Should add a configuration option to repeat the kernel X times per timing
 			// to reduce impact of overheads at small cell/face counts
-			status = cupcfd::fvm::FluxUVWDolfynFaceLoop1(*(meshPtr), gammaBlend, small, 
+			status = faceLoopKernel(*(meshPtr), gammaBlend, small, 
 														// large,
 														uCell, nCells,
 														vCell, nCells,
@@ -0,0 +1,128 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the BenchmarkSpMV class.
+ */
+
+#include "BenchmarkSpMV.h"
+
+#include "tt_interface_c.h"
+#include "mpi.h"
+
+#include <vector>
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		template <class C, class I, class T>
+		BenchmarkSpMV<C,I,T>::BenchmarkSpMV(std::string benchmarkName, I repetitions,
+										  std::shared_ptr<cupcfd::data_structures::DistributedSparseMatrixCSR<I,T>> matrixPtr,
+										  std::shared_ptr<C> ownedMatrixPtr, std::shared_ptr<C> ghostMatrixPtr)
+		: Benchmark<I,T>(benchmarkName, repetitions),
+		  matrixPtr(matrixPtr),
+		  ownedMatrixPtr(ownedMatrixPtr),
+		  ghostMatrixPtr(ghostMatrixPtr)
+		{
+
+		}
+
+		template <class C, class I, class T>
+		BenchmarkSpMV<C,I,T>::~BenchmarkSpMV() {
+			// Shared Pointer will cleanup after itself as object is destroyed
+		}
+
+		template <class C, class I, class T>
+		void BenchmarkSpMV<C,I,T>::setupBenchmark() {
+			// Nothing to do here currently
+		}
+
+		template <class C, class I, class T>
+		void BenchmarkSpMV<C,I,T>::recordParameters() {
+			TreeTimerLogParameterInt("LocalRows", this->matrixPtr->mLocal);
+			TreeTimerLogParameterInt("LocalNNZ", this->matrixPtr->localA.nnz);
+			TreeTimerLogParameterInt("GhostColumns", int(this->matrixPtr->ghostGlobalIDs.size()));
+			TreeTimerLogParameterInt("InteriorRows", int(this->matrixPtr->interiorRows.size()));
+			TreeTimerLogParameterInt("HaloRows", int(this->matrixPtr->haloRows.size()));
+			TreeTimerLogParameterInt("StoredNNZ", int(this->ownedMatrixPtr->nnz + this->ghostMatrixPtr->nnz));
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes BenchmarkSpMV<C,I,T>::runBenchmark() {
+			cupcfd::error::eCodes status;
+
+			I mLocal = this->matrixPtr->mLocal;
+
+			// The actual contents of x do not matter
+			std::vector<T> x(mLocal);
+			std::vector<T> y(mLocal);
+
+			for(I i = 0; i < mLocal; i++) {
+				x[i] = T(i + 1)/T(23);
+			}
+
+			// Warm up the caches and the exchange before timing
+			status = this->matrixPtr->multiply(*(this->ownedMatrixPtr), *(this->ghostMatrixPtr), x.data(), mLocal, y.data(), mLocal);
+			CHECK_ECODE(status)
+			this->matrixPtr->timing.reset();
+
+			this->startBenchmarkBlock(this->benchmarkName);
+			TreeTimerLogParameterInt("Repetitions", this->repetitions);
+
+			this->recordParameters();
+
+			this->startBenchmarkBlock("SpMV");
+			double t0 = MPI_Wtime();
+
+			for(I i = 0; i < this->repetitions; i++) {
+				status = this->matrixPtr->multiply(*(this->ownedMatrixPtr), *(this->ghostMatrixPtr), x.data(), mLocal, y.data(), mLocal);
+				CHECK_ECODE(status)
+			}
+
+			double elapsed = MPI_Wtime() - t0;
+			this->stopBenchmarkBlock("SpMV");
+
+			// Achieved rates of this process, averaged over the repetitions
+			double timePerMultiply = (this->repetitions > 0) ? (elapsed / double(this->repetitions)) : 0.0;
+			double gflops = 0.0;
+			double gbPerSecond = 0.0;
+
+			if(timePerMultiply > 0.0) {
+				gflops = this->getFlopsPerMultiply() / (timePerMultiply * 1.0E9);
+				gbPerSecond = this->getBytesPerMultiply() / (timePerMultiply * 1.0E9);
+			}
+
+			TreeTimerLogParameterDouble("SpMVTime", timePerMultiply);
+			TreeTimerLogParameterDouble("GFLOPS", gflops);
+			TreeTimerLogParameterDouble("GBPerSecond", gbPerSecond);
+			TreeTimerLogParameterDouble("ArithmeticIntensity", this->getFlopsPerMultiply() / this->getBytesPerMultiply());
+
+			// Track how much of the exchange was hidden behind the interior rows
+			TreeTimerLogParameterDouble("ExchangeStartTime", this->matrixPtr->timing.startTime);
+			TreeTimerLogParameterDouble("ExchangeWaitTime", this->matrixPtr->timing.waitTime);
+			TreeTimerLogParameterDouble("InteriorRowsTime", this->matrixPtr->timing.interiorTime);
+			TreeTimerLogParameterDouble("HaloRowsTime", this->matrixPtr->timing.haloTime);
+			TreeTimerLogParameterDouble("OverlapFraction", this->matrixPtr->timing.getOverlapFraction());
+
+			this->stopBenchmarkBlock(this->benchmarkName);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::benchmark::BenchmarkSpMV<cupcfd::data_structures::SparseMatrixCSR<int,float>, int, float>;
+template class cupcfd::benchmark::BenchmarkSpMV<cupcfd::data_structures::SparseMatrixCSR<int,double>, int, double>;
+
+template class cupcfd::benchmark::BenchmarkSpMV<cupcfd::data_structures::SparseMatrixSELL<int,float>, int, float>;
+template class cupcfd::benchmark::BenchmarkSpMV<cupcfd::data_structures::SparseMatrixSELL<int,double>, int, double>;
+
+template class cupcfd::benchmark::BenchmarkSpMV<cupcfd::data_structures::SparseMatrixBCSR<int,float>, int, float>;
+template class cupcfd::benchmark::BenchmarkSpMV<cupcfd::data_structures::SparseMatrixBCSR<int,double>, int, double>;
@@ -19,10 +19,11 @@ namespace cupcfd
 		// === Constructors/Deconstructors ===
 
 		template <class I, class T>
-		BenchmarkConfigExchange<I,T>::BenchmarkConfigExchange(std::string benchmarkName, I repetitions, cupcfd::comm::ExchangePatternConfig& patternConfig)
+		BenchmarkConfigExchange<I,T>::BenchmarkConfigExchange(std::string benchmarkName, I repetitions, cupcfd::comm::ExchangePatternConfig& patternConfig, I nFields)
 		: benchmarkName(benchmarkName),
 		  repetitions(repetitions),
-		  patternConfig(patternConfig)
+		  patternConfig(patternConfig),
+		  nFields(nFields)
 		{
 
 		}
@@ -47,6 +48,7 @@ namespace cupcfd
 			this->benchmarkName = source.benchmarkName;
 			this->repetitions = source.repetitions;
 			this->patternConfig = source.patternConfig;
+			this->nFields = source.nFields;
 		}
 
 		template <class I, class T>
@@ -21,9 +21,10 @@ namespace cupcfd
 		// === Constructors/Deconstructors ===
 
 		template <class I, class T>
-		BenchmarkConfigKernels<I,T>::BenchmarkConfigKernels(const std::string benchmarkName, const I repetitions)
+		BenchmarkConfigKernels<I,T>::BenchmarkConfigKernels(const std::string benchmarkName, const I repetitions, const bool colouredFaceLoops)
 		: benchmarkName(benchmarkName),
-		  repetitions(repetitions)
+		  repetitions(repetitions),
+		  colouredFaceLoops(colouredFaceLoops)
 		{
 
 		}
@@ -49,6 +50,7 @@ namespace cupcfd
 		{
 			this->benchmarkName = source.benchmarkName;
 			this->repetitions = source.repetitions;
+			this->colouredFaceLoops = source.colouredFaceLoops;
 		}
 
 		template <class I, class T>
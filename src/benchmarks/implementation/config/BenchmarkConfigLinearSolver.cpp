@@ -23,6 +23,27 @@ namespace cupcfd
 {
 	namespace benchmark
 	{
+		// Replace the contents of a matrix with a set of (row, column, value) triplets in one pass rather than
+		// element by element. A SparseMatrixCSR is built in place, other formats are converted from a CSR
+		// built the same way. Repeated positions keep the last value, as setElement would.
+		template <class C, class I, class T>
+		cupcfd::error::eCodes assembleMatrix(C& matrix, std::vector<I>& rows, std::vector<I>& cols, std::vector<T>& vals) {
+			cupcfd::error::eCodes status;
+			cupcfd::data_structures::SparseMatrixCSR<I,T> * csr = cupcfd::data_structures::getCSRMatrix(matrix);
+
+			if(csr != nullptr) {
+				return csr->buildFromTriplets(rows.data(), cols.data(), vals.data(), I(vals.size()), false);
+			}
+
+			cupcfd::data_structures::SparseMatrixCSR<I,T> built(matrix.m, matrix.n, matrix.baseIndex);
+			status = built.buildFromTriplets(rows.data(), cols.data(), vals.data(), I(vals.size()), false);
+			CHECK_ECODE(status)
+
+			matrix = C(built);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
 		// === Constructors/Deconstructors ===
 		template <class C, class I, class T>
 		BenchmarkConfigLinearSolver<C,I,T>::BenchmarkConfigLinearSolver(std::string benchmarkName, I repetitions,
@@ -99,6 +120,11 @@ namespace cupcfd
 			// Make the new matrix with a base of 0
 			std::shared_ptr<C> matrix = std::make_shared<C>(rows, cols, 0);
 
+			// The loaded rows are gathered as triplets and the matrix is assembled from them in one pass
+			std::vector<I> tripletRows;
+			std::vector<I> tripletCols;
+			std::vector<T> tripletVals;
+
 			// ToDo: Could move this into SparseMatrixSource class
 			if(this->distType == BENCH_SOLVER_DIST_CONCURRENT) {
 				// Load Full Matrix
@@ -120,15 +146,18 @@ namespace cupcfd
 					CHECK_ECODE(status)
 
 					for( I j = 0; j < nColumnIndexes; j++) {
-						// ToDo: Element by Element call is likely v.slow
-						status = matrix->setElement(i, columnIndexes[j] - base, nnzValues[j]);
-						CHECK_ECODE(status)
+						tripletRows.push_back(i);
+						tripletCols.push_back(columnIndexes[j] - base);
+						tripletVals.push_back(nnzValues[j]);
 					}
 
 					free(columnIndexes);
 					free(nnzValues);
 				}
 
+				status = assembleMatrix(*matrix, tripletRows, tripletCols, tripletVals);
+				CHECK_ECODE(status)
+
 				// Perform the initial setup for a linear solver system
 				// All ranks are solving the same matrix independently
 				cupcfd::comm::Communicator solverComm(MPI_COMM_SELF);
@@ -171,15 +200,18 @@ namespace cupcfd
 					CHECK_ECODE(status)
 
 					for( I j = 0; j < nColumnIndexes; j++) {
-						// ToDo: Element by Element call is likely v.slow
-						status = matrix->setElement(i, columnIndexes[j] - base, nnzValues[j]);
-						CHECK_ECODE(status)
+						tripletRows.push_back(i);
+						tripletCols.push_back(columnIndexes[j] - base);
+						tripletVals.push_back(nnzValues[j]);
 					}
 
 					free(columnIndexes);
 					free(nnzValues);
 				}
 
+				status = assembleMatrix(*matrix, tripletRows, tripletCols, tripletVals);
+				CHECK_ECODE(status)
+
 				// Perform the initial setup for a linear solver system
 				// Matrix should be distributed (i.e. each rank has different rows)
 				// This requires a parallel solver, and thus a non-serial communicator.
@@ -26,7 +26,10 @@ namespace cupcfd
 																		  cupcfd::particles::ParticleSystemSimpleConfig<M,I,T,L>& particleSystemConfig)
 		: benchmarkName(benchmarkName),
 		  repetitions(repetitions),
-		  nTimesteps(nTimesteps)
+		  nTimesteps(nTimesteps),
+		  rebalanceThreshold(T(0)),
+		  rebalanceInterval(1),
+		  rebalanceCellCost(T(1))
 		{
 			this->dtDistConfig = dtDistConfig.clone();
 			this->particleSystemConfig = particleSystemConfig.clone();
@@ -47,6 +50,13 @@ namespace cupcfd
 
 		// === Concrete Methods ===
 
+		template <class M, class I, class T, class L>
+		void BenchmarkConfigParticleSystemSimple<M,I,T,L>::setRebalance(T rebalanceThreshold, I rebalanceInterval, T rebalanceCellCost) {
+			this->rebalanceThreshold = rebalanceThreshold;
+			this->rebalanceInterval = rebalanceInterval;
+			this->rebalanceCellCost = rebalanceCellCost;
+		}
+
 		// === Overloaded Inherited Methods ===
 
 		template <class M, class I, class T, class L>
@@ -56,6 +66,9 @@ namespace cupcfd
 			this->nTimesteps = source.nTimesteps;
 			this->dtDistConfig = source.dtDistConfig->clone();
 			this->particleSystemConfig = source.particleSystemConfig->clone();
+			this->rebalanceThreshold = source.rebalanceThreshold;
+			this->rebalanceInterval = source.rebalanceInterval;
+			this->rebalanceCellCost = source.rebalanceCellCost;
 		}
 
 		template <class M, class I, class T, class L>
@@ -87,6 +100,22 @@ namespace cupcfd
 
 			return cupcfd::error::E_SUCCESS;
 		}
+
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes BenchmarkConfigParticleSystemSimple<M,I,T,L>::buildBenchmark(BenchmarkParticleSystemSimple<M,I,T,L> ** bench,
+																								std::shared_ptr<M> meshPtr,
+																								cupcfd::geometry::mesh::MeshConfig<I,T,L>& meshConfig) {
+			cupcfd::error::eCodes status;
+
+			status = this->buildBenchmark(bench, meshPtr);
+			CHECK_ECODE(status)
+
+			if(this->rebalanceThreshold > T(0)) {
+				(*bench)->setRebalance(meshConfig, this->rebalanceThreshold, this->rebalanceInterval, this->rebalanceCellCost);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
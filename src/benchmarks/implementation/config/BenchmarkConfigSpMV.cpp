@@ -0,0 +1,197 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the BenchmarkConfigSpMV class
+ */
+
+#include "BenchmarkConfigSpMV.h"
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixSELL.h"
+#include "SparseMatrixBCSR.h"
+#include "SparseMatrixSource.h"
+#include "Communicator.h"
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		BenchmarkConfigSpMV<I,T>::BenchmarkConfigSpMV(std::string benchmarkName, I repetitions,
+													  cupcfd::data_structures::SparseMatrixSourceConfig<I,T>& matrixSourceConfig,
+													  cupcfd::comm::ExchangePatternConfig& patternConfig,
+													  BenchSpMVMatrixFormat format, I chunkSize, I sigma, I blockSize)
+		: benchmarkName(benchmarkName),
+		  repetitions(repetitions),
+		  patternConfig(patternConfig),
+		  format(format),
+		  chunkSize(chunkSize),
+		  sigma(sigma),
+		  blockSize(blockSize)
+		{
+			this->matrixSourceConfig = matrixSourceConfig.clone();
+		}
+
+		template <class I, class T>
+		BenchmarkConfigSpMV<I,T>::BenchmarkConfigSpMV(const BenchmarkConfigSpMV<I,T>& source)
+		: matrixSourceConfig(nullptr)
+		{
+			*this = source;
+		}
+
+		template <class I, class T>
+		BenchmarkConfigSpMV<I,T>::~BenchmarkConfigSpMV()
+		{
+			delete(this->matrixSourceConfig);
+		}
+
+		// === Overloaded Inherited Methods ===
+
+		template <class I, class T>
+		void BenchmarkConfigSpMV<I,T>::operator=(const BenchmarkConfigSpMV<I,T>& source)
+		{
+			this->benchmarkName = source.benchmarkName;
+			this->repetitions = source.repetitions;
+			this->patternConfig = source.patternConfig;
+			this->format = source.format;
+			this->chunkSize = source.chunkSize;
+			this->sigma = source.sigma;
+			this->blockSize = source.blockSize;
+
+			if(this->matrixSourceConfig != source.matrixSourceConfig) {
+				delete(this->matrixSourceConfig);
+				this->matrixSourceConfig = source.matrixSourceConfig->clone();
+			}
+		}
+
+		template <class I, class T>
+		BenchmarkConfigSpMV<I,T> * BenchmarkConfigSpMV<I,T>::clone()
+		{
+			return new BenchmarkConfigSpMV<I,T>(*this);
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMV<I,T>::buildBenchmark(Benchmark<I,T> ** bench) {
+			cupcfd::error::eCodes status;
+			cupcfd::data_structures::SparseMatrixSource<I,T> * sourcePtr;
+
+			// Check the format options before doing any work, since the format conversions treat them as fatal
+			if((this->format == BENCH_SPMV_FORMAT_SELL && (this->chunkSize < 1 || this->sigma < 1)) ||
+			   (this->format == BENCH_SPMV_FORMAT_BCSR && this->blockSize < 1)) {
+				return cupcfd::error::E_MATRIX_INVALID_BLOCK_SIZE;
+			}
+
+			status = this->matrixSourceConfig->buildSparseMatrixSource(&sourcePtr);
+			CHECK_ECODE(status)
+
+			// Owned here so that it is freed on every return
+			std::unique_ptr<cupcfd::data_structures::SparseMatrixSource<I,T>> matrixSource(sourcePtr);
+
+			I rows, cols, base;
+
+			status = matrixSource->getNRows(&rows);
+			CHECK_ECODE(status)
+
+			status = matrixSource->getNCols(&cols);
+			CHECK_ECODE(status)
+
+			status = matrixSource->getMatrixIndicesBase(&base);
+			CHECK_ECODE(status)
+
+			if(rows != cols) {
+				return cupcfd::error::E_MATRIX_INVALID_COL_SIZE;
+			}
+
+			// Split the rows evenly into contiguous blocks, with the first (rows % size) processes
+			// receiving one extra row
+			cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+			I baseSize = rows / comm.size;
+			I remainder = rows % comm.size;
+			I rowStart = (baseSize * comm.rank) + ((comm.rank < remainder) ? comm.rank : remainder);
+			I rowEnd = rowStart + baseSize + ((comm.rank < remainder) ? 1 : 0);
+
+			// Load the owned rows only as (row, column, value) triplets
+			std::vector<I> tripletRows;
+			std::vector<I> tripletCols;
+			std::vector<T> tripletVals;
+
+			for(I i = rowStart; i < rowEnd; i++) {
+				I * columnIndexes;
+				I nColumnIndexes;
+
+				T * nnzValues;
+				I nNNZValues;
+
+				status = matrixSource->getRowColumnIndexes(i + base, &columnIndexes, &nColumnIndexes);
+				CHECK_ECODE(status)
+
+				status = matrixSource->getRowNNZValues(i + base, &nnzValues, &nNNZValues);
+				if(status != cupcfd::error::E_SUCCESS) {
+					free(columnIndexes);
+					return status;
+				}
+
+				for(I j = 0; j < nColumnIndexes; j++) {
+					tripletRows.push_back(i);
+					tripletCols.push_back(columnIndexes[j] - base);
+					tripletVals.push_back(nnzValues[j]);
+				}
+
+				free(columnIndexes);
+				free(nnzValues);
+			}
+
+			cupcfd::data_structures::SparseMatrixCSR<I,T> matrix(rows, cols, 0);
+
+			status = matrix.buildFromTriplets(tripletRows.data(), tripletCols.data(), tripletVals.data(), I(tripletRows.size()), false);
+			CHECK_ECODE(status)
+
+			std::shared_ptr<cupcfd::data_structures::DistributedSparseMatrixCSR<I,T>> matrixPtr =
+				std::make_shared<cupcfd::data_structures::DistributedSparseMatrixCSR<I,T>>(comm, matrix, rowStart, rowEnd, this->patternConfig);
+
+			// Store the owned and ghost columns of the local rows in the requested format
+			std::shared_ptr<cupcfd::data_structures::SparseMatrixCSR<I,T>> ownedCSR = std::make_shared<cupcfd::data_structures::SparseMatrixCSR<I,T>>();
+			std::shared_ptr<cupcfd::data_structures::SparseMatrixCSR<I,T>> ghostCSR = std::make_shared<cupcfd::data_structures::SparseMatrixCSR<I,T>>();
+
+			status = matrixPtr->splitLocalMatrix(*ownedCSR, *ghostCSR);
+			CHECK_ECODE(status)
+
+			if(this->format == BENCH_SPMV_FORMAT_SELL) {
+				typedef cupcfd::data_structures::SparseMatrixSELL<I,T> SELLMatrix;
+
+				*bench = new BenchmarkSpMV<SELLMatrix,I,T>(this->benchmarkName, this->repetitions, matrixPtr,
+														   std::make_shared<SELLMatrix>(*ownedCSR, this->chunkSize, this->sigma),
+														   std::make_shared<SELLMatrix>(*ghostCSR, this->chunkSize, this->sigma));
+			}
+			else if(this->format == BENCH_SPMV_FORMAT_BCSR) {
+				typedef cupcfd::data_structures::SparseMatrixBCSR<I,T> BCSRMatrix;
+
+				*bench = new BenchmarkSpMV<BCSRMatrix,I,T>(this->benchmarkName, this->repetitions, matrixPtr,
+														   std::make_shared<BCSRMatrix>(*ownedCSR, this->blockSize),
+														   std::make_shared<BCSRMatrix>(*ghostCSR, this->blockSize));
+			}
+			else {
+				*bench = new BenchmarkSpMV<cupcfd::data_structures::SparseMatrixCSR<I,T>,I,T>(this->benchmarkName, this->repetitions,
+																							   matrixPtr, ownedCSR, ghostCSR);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::benchmark::BenchmarkConfigSpMV<int,float>;
+template class cupcfd::benchmark::BenchmarkConfigSpMV<int,double>;
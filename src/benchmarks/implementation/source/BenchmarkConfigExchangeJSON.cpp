@@ -86,12 +86,33 @@ namespace cupcfd
 			return cupcfd::error::E_CONFIG_INVALID_VALUE;
 		}
 
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigExchangeJSON<I,T>::getNFields(I * nFields) {
+			if(this->configData.isMember("NFields")) {
+				const Json::Value dataSourceType = this->configData["NFields"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType.asLargestInt() < 1) {
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+				else {
+					*nFields = dataSourceType.asLargestInt();
+					return cupcfd::error::E_SUCCESS;
+				}
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
 		template <class I, class T>
 		cupcfd::error::eCodes BenchmarkConfigExchangeJSON<I,T>::buildBenchmarkConfig(BenchmarkConfigExchange<I,T> ** config) {
 
 			cupcfd::error::eCodes status;
 			std::string benchmarkName;
 			I repetitions;
+			I nFields;
 			cupcfd::comm::ExchangePatternConfig * patternConfig;
 
 			status = this->getBenchmarkName(benchmarkName);
@@ -100,10 +121,19 @@ namespace cupcfd
 			status = this->getBenchmarkRepetitions(&repetitions);
 			CHECK_ECODE(status)
 
+			// Optional - default to a single field
+			status = this->getNFields(&nFields);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				nFields = 1;
+			}
+			else {
+				CHECK_ECODE(status)
+			}
+
 			status = this->getExchangePatternConfig(&patternConfig);
 			CHECK_ECODE(status)
 
-			*config = new BenchmarkConfigExchange<I,T>(benchmarkName, repetitions, *patternConfig);
+			*config = new BenchmarkConfigExchange<I,T>(benchmarkName, repetitions, *patternConfig, nFields);
 
 			delete patternConfig;
 
@@ -67,11 +67,33 @@ namespace cupcfd
 			return cupcfd::error::E_CONFIG_INVALID_VALUE;
 		}
 
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigKernelsJSON<I,T>::getColouredFaceLoops(bool * colouredFaceLoops) {
+			if(this->configData.isMember("FaceLoop")) {
+				const Json::Value dataSourceType = this->configData["FaceLoop"];
+
+				if(dataSourceType == "Serial") {
+					*colouredFaceLoops = false;
+					return cupcfd::error::E_SUCCESS;
+				}
+				else if(dataSourceType == "Coloured") {
+					*colouredFaceLoops = true;
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
 		template <class I, class T>
 		cupcfd::error::eCodes BenchmarkConfigKernelsJSON<I,T>::buildBenchmarkConfig(BenchmarkConfigKernels<I,T> ** config) {
 			cupcfd::error::eCodes status;
 			std::string benchmarkName;
 			I repetitions;
+			bool colouredFaceLoops;
 
 			status = this->getBenchmarkName(benchmarkName);
 			CHECK_ECODE(status)
@@ -79,7 +101,16 @@ namespace cupcfd
 			status = this->getBenchmarkRepetitions(&repetitions);
 			CHECK_ECODE(status)
 
-			*config = new BenchmarkConfigKernels<I,T>(benchmarkName, repetitions);
+			// Optional - default to the serial kernels
+			status = this->getColouredFaceLoops(&colouredFaceLoops);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				colouredFaceLoops = false;
+			}
+			else {
+				CHECK_ECODE(status)
+			}
+
+			*config = new BenchmarkConfigKernels<I,T>(benchmarkName, repetitions, colouredFaceLoops);
 			return cupcfd::error::E_SUCCESS;
 		}
 	}
@@ -19,7 +19,10 @@
 #include "SparseMatrixCOO.h"
 #include "SparseMatrixCSR.h"
 
+#ifdef CUPCFD_USE_PETSC
 #include "LinearSolverConfigPETScJSON.h"
+#endif
+#include "LinearSolverConfigNativeJSON.h"
 
 #include "SparseMatrixSourceFileConfigJSON.h"
 #include "VectorSourceFileConfigJSON.h"
@@ -92,11 +95,20 @@ namespace cupcfd
 				// Try each of the potential Linear Solver Configuration Sources in Turn till a valid one is found
 
 				// Option 1 - PETSc Linear Solver
+#ifdef CUPCFD_USE_PETSC
 				if(this->configData["LinearSolver"].isMember("LinearSolverPETSc")) {
 					cupcfd::linearsolvers::LinearSolverConfigPETScJSON<C,I,T> solverConfig(this->configData["LinearSolver"]["LinearSolverPETSc"]);
 					status = solverConfig.buildLinearSolverConfig(solverSystemConfig);
 					return status;
 				}
+#endif
+
+				// Option 2 - Native Linear Solver
+				if(this->configData["LinearSolver"].isMember("LinearSolverNative")) {
+					cupcfd::linearsolvers::LinearSolverConfigNativeJSON<C,I,T> solverConfig(this->configData["LinearSolver"]["LinearSolverNative"]);
+					status = solverConfig.buildLinearSolverConfig(solverSystemConfig);
+					return status;
+				}
 
 				// Field not found
 				return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
@@ -182,6 +182,46 @@ namespace cupcfd
 			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
 		}
 
+		template <class M, class I, class T, class L>
+		cupcfd::error::eCodes BenchmarkConfigParticleSystemSimpleJSON<M,I,T,L>::getRebalance(T * rebalanceThreshold, I * rebalanceInterval, T * rebalanceCellCost) {
+			if(!this->configData.isMember("Rebalance")) {
+				return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+			}
+
+			const Json::Value rebalanceData = this->configData["Rebalance"];
+
+			if(!rebalanceData.isObject() || !rebalanceData.isMember("Threshold") || !rebalanceData["Threshold"].isNumeric()) {
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			*rebalanceThreshold = T(rebalanceData["Threshold"].asDouble());
+			*rebalanceInterval = 1;
+			*rebalanceCellCost = T(1);
+
+			if(rebalanceData.isMember("Interval")) {
+				if(!rebalanceData["Interval"].isIntegral()) {
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+
+				*rebalanceInterval = rebalanceData["Interval"].asLargestInt();
+			}
+
+			if(rebalanceData.isMember("CellCost")) {
+				if(!rebalanceData["CellCost"].isNumeric()) {
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+
+				*rebalanceCellCost = T(rebalanceData["CellCost"].asDouble());
+			}
+
+			// The load ratio is never below 1, and each cell must carry some weight for the partitioner
+			if(!(*rebalanceThreshold > T(1)) || *rebalanceInterval < 1 || !(*rebalanceCellCost > T(0))) {
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
 		template <class M, class I, class T, class L>
 		cupcfd::error::eCodes BenchmarkConfigParticleSystemSimpleJSON<M,I,T,L>::buildBenchmarkConfig(BenchmarkConfigParticleSystemSimple<M,I,T,L> ** config) {
 			cupcfd::error::eCodes status;
@@ -207,7 +247,25 @@ namespace cupcfd
 			status = this->getParticleSystemConfig(&particleSystemConfig);
 			CHECK_ECODE(status)
 
+			// Rebalancing is optional
+			T rebalanceThreshold;
+			I rebalanceInterval;
+			T rebalanceCellCost;
+
+			status = this->getRebalance(&rebalanceThreshold, &rebalanceInterval, &rebalanceCellCost);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				rebalanceThreshold = T(0);
+				rebalanceInterval = 1;
+				rebalanceCellCost = T(1);
+			}
+			else if(status != cupcfd::error::E_SUCCESS) {
+				delete dtDistConfig;
+				delete particleSystemConfig;
+				return status;
+			}
+
 			*config = new BenchmarkConfigParticleSystemSimple<M,I,T,L>(benchmarkName, repetitions, nTimesteps, *dtDistConfig, *particleSystemConfig);
+			(*config)->setRebalance(rebalanceThreshold, rebalanceInterval, rebalanceCellCost);
 
 			delete dtDistConfig;
 			delete particleSystemConfig;
@@ -0,0 +1,260 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Definition for the BenchmarkConfigSpMVJSON class.
+ */
+
+// Header for this class
+#include "BenchmarkConfigSpMVJSON.h"
+
+#include "ExchangePatternConfigSourceJSON.h"
+#include "SparseMatrixSourceFileConfigJSON.h"
+
+namespace cupcfd
+{
+	namespace benchmark
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		BenchmarkConfigSpMVJSON<I,T>::BenchmarkConfigSpMVJSON(Json::Value& parseJSON)
+		{
+			this->configData = parseJSON;
+		}
+
+		template <class I, class T>
+		BenchmarkConfigSpMVJSON<I,T>::~BenchmarkConfigSpMVJSON()
+		{
+			// Nothing to do currently
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::getBenchmarkName(std::string& benchmarkName) {
+			const Json::Value dataSourceType = this->configData["BenchmarkName"];
+
+			if(dataSourceType == Json::Value::null) {
+				return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+			}
+
+			benchmarkName = dataSourceType.asString();
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::getBenchmarkRepetitions(I * repetitions) {
+			if(this->configData.isMember("Repetitions")) {
+				const Json::Value dataSourceType = this->configData["Repetitions"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType.asLargestInt() < 0) {
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+				else {
+					*repetitions = dataSourceType.asLargestInt();
+					return cupcfd::error::E_SUCCESS;
+				}
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::getSparseMatrixSourceConfig(cupcfd::data_structures::SparseMatrixSourceConfig<I,T> ** matrixSourceConfig) {
+			cupcfd::error::eCodes status;
+
+			if(this->configData.isMember("SparseMatrix")) {
+				if(this->configData["SparseMatrix"].isMember("SparseMatrixFile")) {
+					cupcfd::data_structures::SparseMatrixSourceFileConfigJSON<I,T> configSource(this->configData["SparseMatrix"]["SparseMatrixFile"]);
+					status = configSource.buildSparseMatrixSourceConfig(matrixSourceConfig);
+					return status;
+				}
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::getExchangePatternConfig(cupcfd::comm::ExchangePatternConfig ** patternConfig) {
+			cupcfd::error::eCodes status;
+
+			if(this->configData.isMember("ExchangePattern")) {
+				cupcfd::comm::ExchangePatternConfigSourceJSON patternConfigSource(this->configData["ExchangePattern"]);
+				status = patternConfigSource.buildExchangePatternConfig(patternConfig);
+				return status;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::getMatrixFormat(BenchSpMVMatrixFormat * format) {
+			if(this->configData.isMember("MatrixFormat")) {
+				const Json::Value dataSourceType = this->configData["MatrixFormat"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType == "CSR") {
+					*format = BENCH_SPMV_FORMAT_CSR;
+					return cupcfd::error::E_SUCCESS;
+				}
+				else if(dataSourceType == "SELL") {
+					*format = BENCH_SPMV_FORMAT_SELL;
+					return cupcfd::error::E_SUCCESS;
+				}
+				else if(dataSourceType == "BCSR") {
+					*format = BENCH_SPMV_FORMAT_BCSR;
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::getSELLChunkSize(I * chunkSize) {
+			if(this->configData.isMember("SELLChunkSize")) {
+				const Json::Value dataSourceType = this->configData["SELLChunkSize"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType.isIntegral() && dataSourceType.asLargestInt() > 0) {
+					*chunkSize = I(dataSourceType.asLargestInt());
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::getSELLSigma(I * sigma) {
+			if(this->configData.isMember("SELLSigma")) {
+				const Json::Value dataSourceType = this->configData["SELLSigma"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType.isIntegral() && dataSourceType.asLargestInt() > 0) {
+					*sigma = I(dataSourceType.asLargestInt());
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::getBlockSize(I * blockSize) {
+			if(this->configData.isMember("BlockSize")) {
+				const Json::Value dataSourceType = this->configData["BlockSize"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType.isIntegral() && dataSourceType.asLargestInt() > 0) {
+					*blockSize = I(dataSourceType.asLargestInt());
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes BenchmarkConfigSpMVJSON<I,T>::buildBenchmarkConfig(BenchmarkConfigSpMV<I,T> ** config) {
+			cupcfd::error::eCodes status;
+			std::string benchmarkName;
+			I repetitions;
+			cupcfd::data_structures::SparseMatrixSourceConfig<I,T> * matrixSourceConfig;
+			cupcfd::comm::ExchangePatternConfig * patternConfig;
+
+			status = this->getBenchmarkName(benchmarkName);
+			CHECK_ECODE(status)
+
+			status = this->getBenchmarkRepetitions(&repetitions);
+			CHECK_ECODE(status)
+
+			status = this->getSparseMatrixSourceConfig(&matrixSourceConfig);
+			CHECK_ECODE(status)
+
+			// Optional - default to a non-blocking two sided exchange
+			status = this->getExchangePatternConfig(&patternConfig);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				patternConfig = new cupcfd::comm::ExchangePatternConfig(cupcfd::comm::EXCHANGE_NONBLOCKING_TWO_SIDED);
+			}
+			else {
+				CHECK_ECODE(status)
+			}
+
+			// Optional - default to CSR, with the format options defaulting to a SELL-8-1 or 3x3 blocks
+			BenchSpMVMatrixFormat format;
+			I chunkSize, sigma, blockSize;
+
+			status = this->getMatrixFormat(&format);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				format = BENCH_SPMV_FORMAT_CSR;
+			}
+			else {
+				CHECK_ECODE(status)
+			}
+
+			status = this->getSELLChunkSize(&chunkSize);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				chunkSize = 8;
+			}
+			else {
+				CHECK_ECODE(status)
+			}
+
+			status = this->getSELLSigma(&sigma);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				sigma = 1;
+			}
+			else {
+				CHECK_ECODE(status)
+			}
+
+			status = this->getBlockSize(&blockSize);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				blockSize = 3;
+			}
+			else {
+				CHECK_ECODE(status)
+			}
+
+			*config = new BenchmarkConfigSpMV<I,T>(benchmarkName, repetitions, *matrixSourceConfig, *patternConfig,
+												   format, chunkSize, sigma, blockSize);
+
+			delete matrixSourceConfig;
+			delete patternConfig;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::benchmark::BenchmarkConfigSpMVJSON<int, float>;
+template class cupcfd::benchmark::BenchmarkConfigSpMVJSON<int, double>;
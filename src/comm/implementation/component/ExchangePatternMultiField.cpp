@@ -0,0 +1,244 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the ExchangePatternMultiField class.
+ */
+
+#include "mpi.h"
+
+#include "ExchangePatternMultiField.h"
+
+#include <cstddef>
+#include <cstdlib>
+
+namespace cupcfd
+{
+	namespace comm
+	{
+		// Round a byte offset up to the next multiple of align
+		static inline int alignOffset(int nBytes, int align) {
+			return ((nBytes + align - 1) / align) * align;
+		}
+
+		// Size of the message holding nElements of every field. Each block is aligned for its field,
+		// and the message is padded so that the following message is aligned for any field type.
+		static int messageSize(const std::vector<std::unique_ptr<ExchangeField>>& fields, int nElements) {
+			int nBytes = 0;
+
+			for(auto& field : fields) {
+				nBytes = alignOffset(nBytes, field->elementAlign) + (nElements * field->elementSize);
+			}
+
+			return alignOffset(nBytes, alignof(std::max_align_t));
+		}
+
+		// === ExchangeField ===
+
+		ExchangeField::ExchangeField(int elementSize, int elementAlign, int nData)
+		: elementSize(elementSize),
+		  elementAlign(elementAlign),
+		  nData(nData)
+		{
+
+		}
+
+		ExchangeField::~ExchangeField() {
+
+		}
+
+		// === ExchangePatternMultiField ===
+
+		ExchangePatternMultiField::ExchangePatternMultiField() {
+			this->sProc = nullptr;
+			this->nSProc = 0;
+			this->sXAdj = nullptr;
+			this->sendLocalIdx = nullptr;
+			this->nSendLocalIdx = 0;
+
+			this->rProc = nullptr;
+			this->nRProc = 0;
+			this->rXAdj = nullptr;
+			this->recvLocalIdx = nullptr;
+			this->nRecvLocalIdx = 0;
+
+			this->nActiveRequests = 0;
+			this->buffersValid = false;
+			this->exchangeActive = false;
+		}
+
+		ExchangePatternMultiField::~ExchangePatternMultiField() {
+			if(this->sProc != nullptr) {
+				free(this->sProc);
+			}
+
+			if(this->sXAdj != nullptr) {
+				free(this->sXAdj);
+			}
+
+			if(this->sendLocalIdx != nullptr) {
+				free(this->sendLocalIdx);
+			}
+
+			if(this->rProc != nullptr) {
+				free(this->rProc);
+			}
+
+			if(this->rXAdj != nullptr) {
+				free(this->rXAdj);
+			}
+
+			if(this->recvLocalIdx != nullptr) {
+				free(this->recvLocalIdx);
+			}
+		}
+
+		cupcfd::error::eCodes ExchangePatternMultiField::clearFields() {
+			// The buffers are in use until the exchange is stopped
+			if(this->exchangeActive) {
+				return cupcfd::error::E_EXCHANGE_ACTIVE;
+			}
+
+			this->fields.clear();
+			this->buffersValid = false;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		void ExchangePatternMultiField::setupBuffers() {
+			this->sendDispls.assign(this->nSProc + 1, 0);
+			for(int i = 0; i < this->nSProc; i++) {
+				int nElements = this->sXAdj[i+1] - this->sXAdj[i];
+				this->sendDispls[i+1] = this->sendDispls[i] + messageSize(this->fields, nElements);
+			}
+
+			this->recvDispls.assign(this->nRProc + 1, 0);
+			for(int i = 0; i < this->nRProc; i++) {
+				int nElements = this->rXAdj[i+1] - this->rXAdj[i];
+				this->recvDispls[i+1] = this->recvDispls[i] + messageSize(this->fields, nElements);
+			}
+
+			this->sendBuffer.resize(this->sendDispls[this->nSProc]);
+			this->recvBuffer.resize(this->recvDispls[this->nRProc]);
+
+			this->buffersValid = true;
+		}
+
+		cupcfd::error::eCodes ExchangePatternMultiField::packSendBuffer() {
+			if(!this->buffersValid) {
+				this->setupBuffers();
+			}
+
+			for(int i = 0; i < this->nSProc; i++) {
+				int nElements = this->sXAdj[i+1] - this->sXAdj[i];
+				const int * localIdx = this->sendLocalIdx + this->sXAdj[i];
+				char * msg = this->sendBuffer.data() + this->sendDispls[i];
+				int offset = 0;
+
+				for(auto& field : this->fields) {
+					offset = alignOffset(offset, field->elementAlign);
+					field->pack(msg + offset, localIdx, nElements);
+					offset += nElements * field->elementSize;
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes ExchangePatternMultiField::unpackRecvBuffer() {
+			if(!this->buffersValid) {
+				this->setupBuffers();
+			}
+
+			for(int i = 0; i < this->nRProc; i++) {
+				int nElements = this->rXAdj[i+1] - this->rXAdj[i];
+				const int * localIdx = this->recvLocalIdx + this->rXAdj[i];
+				const char * msg = this->recvBuffer.data() + this->recvDispls[i];
+				int offset = 0;
+
+				for(auto& field : this->fields) {
+					offset = alignOffset(offset, field->elementAlign);
+					field->unpack(msg + offset, localIdx, nElements);
+					offset += nElements * field->elementSize;
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes ExchangePatternMultiField::exchangeStart() {
+			cupcfd::error::eCodes status;
+			int err;
+			int tag = 79;
+
+			if(this->exchangeActive) {
+				return cupcfd::error::E_EXCHANGE_ACTIVE;
+			}
+
+			if(this->fields.size() == 0) {
+				return cupcfd::error::E_NO_DATA;
+			}
+
+			status = this->packSendBuffer();
+			CHECK_ECODE(status)
+
+			this->nActiveRequests = 0;
+			this->exchangeActive = true;
+
+			// Post the receives - one per neighbour for all fields
+			for(int i = 0; i < this->nRProc; i++) {
+				int nBytes = this->recvDispls[i+1] - this->recvDispls[i];
+
+				if(nBytes > 0) {
+					err = MPI_Irecv(this->recvBuffer.data() + this->recvDispls[i], nBytes, MPI_BYTE,
+									this->rProc[i], tag, this->comm.comm, &(this->requests[this->nActiveRequests]));
+					this->nActiveRequests++;
+
+					if(err != MPI_SUCCESS) {
+						return cupcfd::error::E_MPI_ERR;
+					}
+				}
+			}
+
+			// Post the sends - one per neighbour for all fields
+			for(int i = 0; i < this->nSProc; i++) {
+				int nBytes = this->sendDispls[i+1] - this->sendDispls[i];
+
+				if(nBytes > 0) {
+					err = MPI_Isend(this->sendBuffer.data() + this->sendDispls[i], nBytes, MPI_BYTE,
+									this->sProc[i], tag, this->comm.comm, &(this->requests[this->nActiveRequests]));
+					this->nActiveRequests++;
+
+					if(err != MPI_SUCCESS) {
+						return cupcfd::error::E_MPI_ERR;
+					}
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		cupcfd::error::eCodes ExchangePatternMultiField::exchangeStop() {
+			cupcfd::error::eCodes status;
+			int err;
+
+			err = MPI_Waitall(this->nActiveRequests, this->requests.data(), MPI_STATUSES_IGNORE);
+			this->nActiveRequests = 0;
+			this->exchangeActive = false;
+
+			if(err != MPI_SUCCESS) {
+				return cupcfd::error::E_MPI_ERR;
+			}
+
+			status = this->unpackRecvBuffer();
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
@@ -0,0 +1,195 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the ExchangePatternNeighbourCollective class.
+ */
+
+#include "mpi.h"
+
+#include "ExchangePatternNeighbourCollective.h"
+#include "MPIUtility.h"
+
+namespace cupcfd
+{
+	namespace comm
+	{
+		template <class T>
+		ExchangePatternNeighbourCollective<T>::ExchangePatternNeighbourCollective() : ExchangePattern<T>()
+		{
+			this->nSendBuffer = 0;
+			this->nRecvBuffer = 0;
+			this->nSendCounts = 0;
+			this->nRecvCounts = 0;
+
+			this->sendBuffer = nullptr;
+			this->recvBuffer = nullptr;
+			this->sendCounts = nullptr;
+			this->sendDispls = nullptr;
+			this->recvCounts = nullptr;
+			this->recvDispls = nullptr;
+		}
+
+		template <class T>
+		ExchangePatternNeighbourCollective<T>::~ExchangePatternNeighbourCollective() {
+			if(this->graphComm != MPI_COMM_NULL) {
+				// The communicator can only be released while MPI is still running.
+				int finalized;
+				MPI_Finalized(&finalized);
+
+				if(!finalized) {
+					MPI_Comm_free(&this->graphComm);
+				}
+			}
+
+			if(this->sendBuffer != nullptr) {
+				free(this->sendBuffer);
+			}
+
+			if(this->recvBuffer != nullptr) {
+				free(this->recvBuffer);
+			}
+
+			if(this->sendCounts != nullptr) {
+				free(this->sendCounts);
+			}
+
+			if(this->sendDispls != nullptr) {
+				free(this->sendDispls);
+			}
+
+			if(this->recvCounts != nullptr) {
+				free(this->recvCounts);
+			}
+
+			if(this->recvDispls != nullptr) {
+				free(this->recvDispls);
+			}
+		}
+
+		template <class T>
+		cupcfd::error::eCodes ExchangePatternNeighbourCollective<T>::init(cupcfd::comm::Communicator& comm,
+				  int * mapLocalToExchangeIDX, int nMapLocalToExchangeIDX,
+				  int * exchangeIDXSend, int nExchangeIDXSend,
+				  int * tRanks, int nTRanks) {
+			cupcfd::error::eCodes status;
+			int err;
+
+			// Call the parent init function to set up the exchange pattern
+			status = this->ExchangePattern<T>::init(comm, mapLocalToExchangeIDX, nMapLocalToExchangeIDX,
+											exchangeIDXSend, nExchangeIDXSend,
+											tRanks, nTRanks);
+			CHECK_ECODE(status)
+
+			// Setup the send/recv buffers
+			this->nSendBuffer = this->nSAdjncy;
+			this->sendBuffer = (T *) malloc(sizeof(T) * this->nSendBuffer);
+
+			this->nRecvBuffer = this->nRAdjncy;
+			this->recvBuffer = (T *) malloc(sizeof(T) * this->nRecvBuffer);
+
+			// The counts and displacements for the collective follow directly from the CSR arrays
+			this->nSendCounts = this->nSProc;
+			this->sendCounts = (int *) malloc(sizeof(int) * this->nSendCounts);
+			this->sendDispls = (int *) malloc(sizeof(int) * this->nSendCounts);
+
+			for(int i = 0; i < this->nSendCounts; i++) {
+				this->sendCounts[i] = this->sXAdj[i+1] - this->sXAdj[i];
+				this->sendDispls[i] = this->sXAdj[i];
+			}
+
+			this->nRecvCounts = this->nRProc;
+			this->recvCounts = (int *) malloc(sizeof(int) * this->nRecvCounts);
+			this->recvDispls = (int *) malloc(sizeof(int) * this->nRecvCounts);
+
+			for(int i = 0; i < this->nRecvCounts; i++) {
+				this->recvCounts[i] = this->rXAdj[i+1] - this->rXAdj[i];
+				this->recvDispls[i] = this->rXAdj[i];
+			}
+
+			// Build the distributed graph communicator from the neighbour processes.
+			// Ranks are not reordered, so the ranks in sProc/rProc remain valid.
+			// This is collective over the pattern communicator.
+			err = MPI_Dist_graph_create_adjacent(this->comm.comm,
+												 this->nRProc, this->rProc, MPI_UNWEIGHTED,
+												 this->nSProc, this->sProc, MPI_UNWEIGHTED,
+												 MPI_INFO_NULL, 0, &this->graphComm);
+
+			if(err != MPI_SUCCESS) {
+				return cupcfd::error::E_MPI_ERR;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class T>
+		T * ExchangePatternNeighbourCollective<T>::getSendBuffer() {
+			return this->sendBuffer;
+		}
+
+		template <class T>
+		T * ExchangePatternNeighbourCollective<T>::getRecvBuffer() {
+			return this->recvBuffer;
+		}
+
+		template <class T>
+		cupcfd::error::eCodes ExchangePatternNeighbourCollective<T>::exchangeStart(T * sourceData, int nData) {
+			cupcfd::error::eCodes status;
+			int err;
+
+			// Get MPI DataType
+			MPI_Datatype dType;
+			#pragma GCC diagnostic push
+			#pragma GCC diagnostic ignored "-Wuninitialized"
+			#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+			T dummy;
+			status = cupcfd::comm::mpi::getMPIType(dummy, &dType);
+			CHECK_ECODE(status)
+			#pragma GCC diagnostic pop
+
+			// Pack the buffer
+			status = this->packSendBuffer(sourceData, nData);
+			CHECK_ECODE(status)
+
+			// Start the exchange with every neighbour in the graph
+			err = MPI_Ineighbor_alltoallv(this->sendBuffer, this->sendCounts, this->sendDispls, dType,
+										  this->recvBuffer, this->recvCounts, this->recvDispls, dType,
+										  this->graphComm, &this->request);
+
+			if(err != MPI_SUCCESS) {
+				return cupcfd::error::E_MPI_ERR;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class T>
+		cupcfd::error::eCodes ExchangePatternNeighbourCollective<T>::exchangeStop(T * sinkData, int nData) {
+			cupcfd::error::eCodes status;
+			int err;
+
+			// Complete the exchange
+			err = MPI_Wait(&this->request, MPI_STATUS_IGNORE);
+
+			if(err != MPI_SUCCESS) {
+				return cupcfd::error::E_MPI_ERR;
+			}
+
+			// Unpack the buffer
+			status = this->unpackRecvBuffer(sinkData, nData);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::comm::ExchangePatternNeighbourCollective<int>;
+template class cupcfd::comm::ExchangePatternNeighbourCollective<float>;
+template class cupcfd::comm::ExchangePatternNeighbourCollective<double>;
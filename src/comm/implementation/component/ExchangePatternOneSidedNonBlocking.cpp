@@ -175,50 +175,14 @@ namespace cupcfd
 		}
 
 		template <class T>
-		cupcfd::error::eCodes ExchangePatternOneSidedNonBlocking<T>::packSendBuffer(T * data, int nData) {
-			// Pack from the data array into a send buffer
-
-			// The data is already grouped by process and in rank order in the pattern CSR data.
-			// We can just translate the exchange IDs to elements from the data array
-
-			for(int i = 0; i < this->nSAdjncy; i++) {
-				int exchangeID = this->sAdjncy[i];
-				int localID = this->exchangeToLocal[exchangeID];
-
-				#ifdef DEBUG
-					if (localID < 0 || localID >= nData) {
-						return cupcfd::error::E_INVALID_INDEX;
-					}
-				#endif
-
-				this->sendBuffer[i] = data[localID];
-			}
-
-			return cupcfd::error::E_SUCCESS;
+		T * ExchangePatternOneSidedNonBlocking<T>::getSendBuffer() {
+			return this->sendBuffer;
 		}
 
 		template <class T>
-		cupcfd::error::eCodes ExchangePatternOneSidedNonBlocking<T>::unpackRecvBuffer(T * data, int nData) {
-			// Unpack from window into the data array
-
-			// Data received should be grouped by process in the recv buffer
-			// It should already be ordered in the recv buffer as per the CSR for the pattern,
-			// so we can transfer across by converting the indexes
-
-			for(int i = 0; i < this->nWinData; i++) {
-				int exchangeID = this->rAdjncy[i];
-				int localID = this->exchangeToLocal[exchangeID];
-
-				#ifdef DEBUG
-					if (localID < 0 || localID >= nData) {
-						return cupcfd::error::E_INVALID_INDEX;
-					}
-				#endif
-
-				data[localID] = this->winData[i];
-			}
-
-			return cupcfd::error::E_SUCCESS;
+		T * ExchangePatternOneSidedNonBlocking<T>::getRecvBuffer() {
+			// The other processes put their data directly into the window
+			return this->winData;
 		}
 
 		template <class T>
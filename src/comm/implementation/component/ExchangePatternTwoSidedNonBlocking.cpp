@@ -126,46 +126,13 @@ namespace cupcfd
 		}
 
 		template <class T>
-		cupcfd::error::eCodes ExchangePatternTwoSidedNonBlocking<T>::packSendBuffer(T * data, int nData) {
-			// The data is already grouped by process and in rank order in the pattern CSR data.
-			// We can just translate the exchange IDs to elements from the data array
-
-			for(int i = 0; i < this->nSAdjncy; i++) {
-				int exchangeID = this->sAdjncy[i];
-				int localID = this->exchangeToLocal[exchangeID];
-
-				#ifdef DEBUG
-					if (localID < 0 || localID >= nData) {
-						return cupcfd::error::E_INVALID_INDEX;
-					}
-				#endif
-
-				this->sendBuffer[i] = data[localID];
-			}
-
-			return cupcfd::error::E_SUCCESS;
+		T * ExchangePatternTwoSidedNonBlocking<T>::getSendBuffer() {
+			return this->sendBuffer;
 		}
 
 		template <class T>
-		cupcfd::error::eCodes ExchangePatternTwoSidedNonBlocking<T>::unpackRecvBuffer(T * data, int nData) {
-			// Data received should be grouped by process in the recv buffer
-			// It should already be ordered in the recv buffer as per the CSR for the pattern,
-			// so we can transfer across by converting the indexes
-
-			for(int i = 0; i < this->nRecvBuffer; i++) {
-				int exchangeID = this->rAdjncy[i];
-				int localID = this->exchangeToLocal[exchangeID];
-
-				#ifdef DEBUG
-					if (localID < 0 || localID >= nData) {
-						return cupcfd::error::E_INVALID_INDEX;
-					}
-				#endif
-
-				data[localID] = this->recvBuffer[i];
-			}
-
-			return cupcfd::error::E_SUCCESS;
+		T * ExchangePatternTwoSidedNonBlocking<T>::getRecvBuffer() {
+			return this->recvBuffer;
 		}
 
 		template <class T>
@@ -0,0 +1,173 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the ExchangePatternTwoSidedPersistent class.
+ */
+
+#include "mpi.h"
+
+#include "ExchangePatternTwoSidedPersistent.h"
+#include "ExchangeMPI.h"
+#include "StartallMPI.h"
+#include "WaitallMPI.h"
+
+namespace cupcfd
+{
+	namespace comm
+	{
+		template <class T>
+		ExchangePatternTwoSidedPersistent<T>::ExchangePatternTwoSidedPersistent() : ExchangePattern<T>()
+		{
+			this->nRequests = 0;
+			this->nSendBuffer = 0;
+			this->nRecvBuffer = 0;
+			this->nSendCounts = 0;
+			this->nRecvCounts = 0;
+
+			this->requests = nullptr;
+			this->sendBuffer = nullptr;
+			this->recvBuffer = nullptr;
+			this->sendCounts = nullptr;
+			this->recvCounts = nullptr;
+		}
+
+		template <class T>
+		ExchangePatternTwoSidedPersistent<T>::~ExchangePatternTwoSidedPersistent() {
+			if(this->requests != nullptr) {
+				// Persistent requests must be explicitly released, but this is only
+				// possible while MPI is still running.
+				int finalized;
+				MPI_Finalized(&finalized);
+
+				if(!finalized) {
+					for(int i = 0; i < this->nRequests; i++) {
+						MPI_Request_free(&(this->requests[i]));
+					}
+				}
+
+				free(this->requests);
+			}
+
+			if(this->sendBuffer != nullptr) {
+				free(this->sendBuffer);
+			}
+
+			if(this->recvBuffer != nullptr) {
+				free(this->recvBuffer);
+			}
+
+			if(this->sendCounts != nullptr) {
+				free(this->sendCounts);
+			}
+
+			if(this->recvCounts != nullptr) {
+				free(this->recvCounts);
+			}
+		}
+
+		template <class T>
+		cupcfd::error::eCodes ExchangePatternTwoSidedPersistent<T>::init(cupcfd::comm::Communicator& comm,
+				  int * mapLocalToExchangeIDX, int nMapLocalToExchangeIDX,
+				  int * exchangeIDXSend, int nExchangeIDXSend,
+				  int * tRanks, int nTRanks) {
+			cupcfd::error::eCodes status;
+
+			// Call the parent init function to set up the exchange pattern
+			status = this->ExchangePattern<T>::init(comm, mapLocalToExchangeIDX, nMapLocalToExchangeIDX,
+											exchangeIDXSend, nExchangeIDXSend,
+											tRanks, nTRanks);
+			CHECK_ECODE(status)
+
+			// Setup the send/recv buffers. These are bound to the persistent requests,
+			// so they must remain at the same location for the lifetime of this object.
+			this->nSendBuffer = this->nSAdjncy;
+			this->sendBuffer = (T *) malloc(sizeof(T) * this->nSendBuffer);
+
+			this->nRecvBuffer = this->nRAdjncy;
+			this->recvBuffer = (T *) malloc(sizeof(T) * this->nRecvBuffer);
+
+			// Setup the send/recv counts from the CSR arrays
+			this->nSendCounts = this->nSProc;
+			this->sendCounts = (int *) malloc(sizeof(int) * this->nSendCounts);
+
+			for(int i = 0; i < this->nSendCounts; i++) {
+				this->sendCounts[i] = this->sXAdj[i+1] - this->sXAdj[i];
+			}
+
+			this->nRecvCounts = this->nRProc;
+			this->recvCounts = (int *) malloc(sizeof(int) * this->nRecvCounts);
+
+			for(int i = 0; i < this->nRecvCounts; i++) {
+				this->recvCounts[i] = this->rXAdj[i+1] - this->rXAdj[i];
+			}
+
+			// Create the persistent requests - at most one per sending and receiving process.
+			int nMaxRequests = this->nSProc + this->nRProc;
+			this->requests = (MPI_Request *) malloc(sizeof(MPI_Request) * nMaxRequests);
+
+			status = cupcfd::comm::mpi::ExchangeVMPISendRecvInit(this->sendBuffer, this->nSendBuffer,
+																 this->sendCounts, this->nSendCounts,
+																 this->recvBuffer, this->nRecvBuffer,
+																 this->recvCounts, this->nRecvCounts,
+																 this->sProc, this->nSProc,
+																 this->rProc, this->nRProc,
+																 this->comm.comm,
+																 this->requests, nMaxRequests,
+																 &(this->nRequests));
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class T>
+		T * ExchangePatternTwoSidedPersistent<T>::getSendBuffer() {
+			return this->sendBuffer;
+		}
+
+		template <class T>
+		T * ExchangePatternTwoSidedPersistent<T>::getRecvBuffer() {
+			return this->recvBuffer;
+		}
+
+		template <class T>
+		cupcfd::error::eCodes ExchangePatternTwoSidedPersistent<T>::exchangeStart(T * sourceData, int nData) {
+			cupcfd::error::eCodes status;
+
+			// Pack the buffer
+			status = this->packSendBuffer(sourceData, nData);
+			CHECK_ECODE(status)
+
+			// Restart the persistent requests - no per-exchange request setup is required
+			status = cupcfd::comm::mpi::StartallMPI(this->requests, this->nRequests);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class T>
+		cupcfd::error::eCodes ExchangePatternTwoSidedPersistent<T>::exchangeStop(T * sinkData, int nData) {
+			cupcfd::error::eCodes status;
+
+			// Complete the exchange. The persistent requests become inactive, ready for the next start.
+			status = cupcfd::comm::mpi::WaitallMPI(this->requests, this->nRequests);
+			CHECK_ECODE(status)
+
+			// Unpack the buffer
+			status = this->unpackRecvBuffer(sinkData, nData);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::comm::ExchangePatternTwoSidedPersistent<int>;
+template class cupcfd::comm::ExchangePatternTwoSidedPersistent<float>;
+template class cupcfd::comm::ExchangePatternTwoSidedPersistent<double>;
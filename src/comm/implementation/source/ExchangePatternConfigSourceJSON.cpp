@@ -54,6 +54,14 @@ namespace cupcfd
 				*method = EXCHANGE_NONBLOCKING_TWO_SIDED;
 				return cupcfd::error::E_SUCCESS;
 			}
+			else if(dataSourceType == "NBTwoSidedPersistent") {
+				*method = EXCHANGE_NONBLOCKING_TWO_SIDED_PERSISTENT;
+				return cupcfd::error::E_SUCCESS;
+			}
+			else if(dataSourceType == "NBNeighbourCollective") {
+				*method = EXCHANGE_NONBLOCKING_NEIGHBOUR_COLLECTIVE;
+				return cupcfd::error::E_SUCCESS;
+			}
 
 			// Found, but not a matching value
 			return cupcfd::error::E_CONFIG_INVALID_VALUE;
@@ -0,0 +1,45 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the ExchangeOverlapTiming Class.
+ */
+
+#include "ExchangeOverlap.h"
+
+namespace cupcfd
+{
+	namespace comm
+	{
+		ExchangeOverlapTiming::ExchangeOverlapTiming() {
+			this->reset();
+		}
+
+		ExchangeOverlapTiming::~ExchangeOverlapTiming() {
+
+		}
+
+		void ExchangeOverlapTiming::reset() {
+			this->startTime = 0.0;
+			this->interiorTime = 0.0;
+			this->waitTime = 0.0;
+			this->haloTime = 0.0;
+			this->nExchanges = 0;
+		}
+
+		double ExchangeOverlapTiming::getOverlapFraction() {
+			double window = this->interiorTime + this->waitTime;
+
+			if(window <= 0.0) {
+				return 0.0;
+			}
+
+			return this->interiorTime / window;
+		}
+	}
+}
@@ -34,6 +34,8 @@ namespace cupcfd
 			this->nRProc = 0;
 			this->nRXAdj = 0;
 			this->nRAdjncy = 0;
+			this->nSendLocalIdx = 0;
+			this->nRecvLocalIdx = 0;
 
 			this->sProc = nullptr;
 			this->sXAdj = nullptr;
@@ -41,6 +43,8 @@ namespace cupcfd
 			this->rProc = nullptr;
 			this->rXAdj = nullptr;
 			this->rAdjncy = nullptr;
+			this->sendLocalIdx = nullptr;
+			this->recvLocalIdx = nullptr;
 		}
 
 		template <class T>
@@ -74,6 +78,14 @@ namespace cupcfd
 			if(this->rAdjncy != nullptr) {
 				free(this->rAdjncy);
 			}
+
+			if(this->sendLocalIdx != nullptr) {
+				free(this->sendLocalIdx);
+			}
+
+			if(this->recvLocalIdx != nullptr) {
+				free(this->recvLocalIdx);
+			}
 		}
 
 		template <class T>
@@ -252,9 +264,6 @@ namespace cupcfd
 											comm);
 			CHECK_ECODE(status)
 
-			// Error Check: For every exchange index element we are expecting to receive, have we declared a mapping to
-			// a local index on this rank? If not, we do not know where to store it.
-
 			free(dupCount);
 			free(copyTRanks);
 			free(copyExchangeIDXSend);
@@ -262,6 +271,80 @@ namespace cupcfd
 			free(sendCount);
 			free(recvCount);
 
+			// (4) Resolve the exchange indexes of the send/recv CSR data to local indexes.
+			// The pattern does not change after this point, so doing the map lookups once here means that
+			// the pack/unpack stages of every exchange are a straight gather/scatter over contiguous arrays.
+			this->nSendLocalIdx = this->nSAdjncy;
+			this->sendLocalIdx = (int *) malloc(sizeof(int) * this->nSendLocalIdx);
+
+			for(int i = 0; i < this->nSendLocalIdx; i++) {
+				auto it = this->exchangeToLocal.find(this->sAdjncy[i]);
+
+				// Error Check: We cannot send an exchange index that we have no local data for
+				if(it == this->exchangeToLocal.end()) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				this->sendLocalIdx[i] = it->second;
+			}
+
+			this->nRecvLocalIdx = this->nRAdjncy;
+			this->recvLocalIdx = (int *) malloc(sizeof(int) * this->nRecvLocalIdx);
+
+			for(int i = 0; i < this->nRecvLocalIdx; i++) {
+				auto it = this->exchangeToLocal.find(this->rAdjncy[i]);
+
+				// Error Check: For every exchange index element we are expecting to receive, have we declared a mapping to
+				// a local index on this rank? If not, we do not know where to store it.
+				if(it == this->exchangeToLocal.end()) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				this->recvLocalIdx[i] = it->second;
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class T>
+		cupcfd::error::eCodes ExchangePattern<T>::packSendBuffer(T * data, int nData) {
+			// The local indexes were resolved from the exchange IDs at init, so this is a plain gather.
+			const int * sendLocalIdx = this->sendLocalIdx;
+			T * sendBuffer = this->getSendBuffer();
+
+			#ifdef DEBUG
+				for(int i = 0; i < this->nSendLocalIdx; i++) {
+					if (sendLocalIdx[i] < 0 || sendLocalIdx[i] >= nData) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+				}
+			#endif
+
+			for(int i = 0; i < this->nSendLocalIdx; i++) {
+				sendBuffer[i] = data[sendLocalIdx[i]];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class T>
+		cupcfd::error::eCodes ExchangePattern<T>::unpackRecvBuffer(T * data, int nData) {
+			// The recv buffer is ordered as per the CSR for the pattern, so this is a plain scatter.
+			const int * recvLocalIdx = this->recvLocalIdx;
+			const T * recvBuffer = this->getRecvBuffer();
+
+			#ifdef DEBUG
+				for(int i = 0; i < this->nRecvLocalIdx; i++) {
+					if (recvLocalIdx[i] < 0 || recvLocalIdx[i] >= nData) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+				}
+			#endif
+
+			for(int i = 0; i < this->nRecvLocalIdx; i++) {
+				data[recvLocalIdx[i]] = recvBuffer[i];
+			}
+
 			return cupcfd::error::E_SUCCESS;
 		}
 	}
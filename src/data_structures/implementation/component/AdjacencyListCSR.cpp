@@ -46,8 +46,8 @@ namespace cupcfd
 			this->xadj[0] = 0;
 
 			// Reset Maps to Empty Objects
-			this->nodeToIDX = std::map<T,I>();
-			this->IDXToNode = std::map<I,T>();
+			this->nodeToIDX.clear();
+			this->IDXToNode.clear();
 		}
 
 		// === Concrete Methods ===
@@ -69,8 +69,8 @@ namespace cupcfd
 			this->xadj[0] = 0;
 
 			// Reset Maps to Empty Objects
-			this->nodeToIDX = std::map<T,I>();
-			this->IDXToNode = std::map<I,T>();
+			this->nodeToIDX.clear();
+			this->IDXToNode.clear();
 		}
 
 		template <class I, class T>
@@ -83,7 +83,7 @@ namespace cupcfd
 
 				// Update Mappings
 				this->nodeToIDX[node] = nodeLocalIDX;
-				this->IDXToNode[nodeLocalIDX] = node;
+				this->IDXToNode.push_back(node);
 
 				// Add node, but as yet it does not have any adjacent elements, so the index it
 				// points to is the same as the one below.
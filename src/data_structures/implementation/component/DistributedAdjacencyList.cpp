@@ -18,17 +18,67 @@
 #include "CommError.h"
 #include "Reduce.h"
 #include "Gather.h"
+#include "AllToAll.h"
 
 #include "ArrayDrivers.h"
 #include "SortDrivers.h"
 #include "AdjacencyListCSR.h"
 
 #include <iostream>
+#include <functional>
+#include <unordered_map>
+#include <utility>
 
 namespace cupcfd
 {
 	namespace data_structures
 	{
+		/**
+		 * Exchange variable sized blocks of data with every process, where the amount of data to
+		 * be received is not known in advance. Used by the ghost node ownership directory in finalize.
+		 *
+		 * @param sendData The data to send, grouped by destination process in ascending rank order
+		 * @param sendCounts The number of elements to send to each process (size of communicator)
+		 * @param recvData Resized and populated with the received data, grouped by source process in ascending rank order
+		 * @param recvCounts Resized and populated with the number of elements received from each process
+		 * @param comm The communicator to exchange over
+		 *
+		 * @tparam T The type of the data to exchange
+		 *
+		 * @return An error status indicating the success or failure of the operation
+		 * @retval cupcfd::error::E_SUCCESS The method completed successfully
+		 */
+		template <class T>
+		static cupcfd::error::eCodes directoryExchange(std::vector<T>& sendData, std::vector<int>& sendCounts,
+														std::vector<T>& recvData, std::vector<int>& recvCounts,
+														cupcfd::comm::Communicator& comm) {
+			cupcfd::error::eCodes status;
+
+			// Nothing to communicate with a single process
+			if(comm.size == 1) {
+				recvCounts = sendCounts;
+				recvData = sendData;
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// Notify each process how much data to expect, then exchange the data itself
+			recvCounts.resize(comm.size);
+			status = cupcfd::comm::AllToAll(sendCounts.data(), comm.size, recvCounts.data(), comm.size, 1, comm);
+			CHECK_ECODE(status)
+
+			int nRecv = 0;
+			for(int i = 0; i < comm.size; i++) {
+				nRecv += recvCounts[i];
+			}
+
+			recvData.resize(nRecv);
+			status = cupcfd::comm::AllToAll(sendData.data(), cupcfd::utility::drivers::safeConvertSizeT<int>(sendData.size()), sendCounts.data(), comm.size,
+											recvData.data(), nRecv, recvCounts.data(), comm.size, comm);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
 		template <class I, class T>
 		DistributedAdjacencyList<I, T>::DistributedAdjacencyList(cupcfd::comm::Communicator& comm) {
 			this->comm = comm.clone();
@@ -400,182 +450,223 @@ namespace cupcfd
 				this->globalToNode[base + i] = localNodes[i];
 			}
 
-			// Technically we want an all-to-allv but for now we will take this approach
-			// ToDo: Replace serialised scatters with all-to-allv so MPI can potentially optimise
-
-			I sendAdjncyPtr = 0;
+			// === Resolve the owner and global id of every ghost node ===
+			// Rather than each process taking it in turn to broadcast its ghost nodes to everyone (O(P) collective rounds),
+			// ownership is resolved via a rendezvous directory: each node is assigned a directory process by hashing the node,
+			// owners register their nodes with the directory process, and ghost holders query the directory process.
+			// This requires a fixed number of all-to-all exchanges regardless of the number of processes, and each process only
+			// sends/receives data proportional to the number of nodes it owns, holds as ghosts or is the directory for.
 
+			int nProc = this->comm->size;
+			std::hash<T> nodeHash;
 
-			for(I i = 0; i < this->comm->size; i++) {
-				// ToDo: Should probably be a barrier here
+			// (4a) Register the locally owned nodes (and their global ids) with their directory processes
+			std::vector<int> regSendCounts(nProc, 0);
+			std::vector<int> regSendDispls(nProc + 1, 0);
 
-				// Serialised Scatter - i.e. each process takes it in turn to
-				// (a) Notify the processes of what ghost cells it has
-				// (b) Ask which/any ghost cells the remote processes own as local cells
-				// (c) Store the response from each process
-				// (d) Count to verify that exactly one process has claimed ownership of each and every ghost cell on this process
+			for(I i = 0; i < this->nLONodes; i++) {
+				regSendCounts[nodeHash(localNodes[i]) % nProc] += 1;
+			}
 
-				// ToDo: Ideally we would like to rely on communicating global indexes, rather than nodes (since a node could be quite a large object depending
-				//		 on future extensions to the template). However, we build the graph in the context of nodes. At this stage while we know
-				//		 the global ids of the locally owned nodes, we do not know what global ids were assigned to ghost nodes (since this was done on an unknown remote process,
-				//		 we do not yet know its owner)
+			for(int i = 0; i < nProc; i++) {
+				regSendDispls[i+1] = regSendDispls[i] + regSendCounts[i];
+			}
 
+			std::vector<T> regSendNodes(this->nLONodes);
+			std::vector<I> regSendGIDs(this->nLONodes);
+			std::vector<int> regPtr(regSendDispls.begin(), regSendDispls.end() - 1);
 
-				// (a) Broadcast the ghost cell data from process i in the serial loop to all other processes so they know what cells we're looking for information on.
-				T * recvGhostData = nullptr;
-				I nRecvGhostData;
-				status = cupcfd::comm::Broadcast(ghostNodes, this->nLGhNodes, &recvGhostData, &nRecvGhostData, i, *(this->comm));
-				CHECK_ECODE(status)
+			for(I i = 0; i < this->nLONodes; i++) {
+				int dirRank = nodeHash(localNodes[i]) % nProc;
+				regSendNodes[regPtr[dirRank]] = localNodes[i];
+				regSendGIDs[regPtr[dirRank]] = this->nodeToGlobal[localNodes[i]];
+				regPtr[dirRank] += 1;
+			}
 
-				// (b)/(c) Identify which cells in the ghost cell list are in the local cell list via a set intersect (uses equality on nodes, precaution if extended in future
-				//		   with custom operator)
-				T * intersect = nullptr;
-				I nIntersect;
-				status = cupcfd::utility::drivers::intersectArray(localNodes, this->nLONodes, recvGhostData, nRecvGhostData, &intersect, &nIntersect);
-				CHECK_ECODE(status)
+			std::vector<int> regRecvCounts;
+			std::vector<T> regRecvNodes;
+			std::vector<I> regRecvGIDs;
 
-				// (b)/(c) Gather the results from each process - i.e. the cells that each process has identified from the ghost cell list as ones they 'own'
-				// ToDo: This could possibly be made more efficient by only communicating bits (1/0) for if a cell is owned - but then each process would have to communicate
-				// a bit for every cell rather than just the ones they own.
+			status = directoryExchange(regSendNodes, regSendCounts, regRecvNodes, regRecvCounts, *(this->comm));
+			CHECK_ECODE(status)
 
-				// Storage for gather data - will be created by gather driver (but only on sink process, should be null on others).
-				// Must be initialised to NULL or nullptr for the driver
-				T * ownership = nullptr;
-				I nOwnership = 0;
+			status = directoryExchange(regSendGIDs, regSendCounts, regRecvGIDs, regRecvCounts, *(this->comm));
+			CHECK_ECODE(status)
 
-				T * countOwned = nullptr;
-				I nCountOwned = 0;
+			// Build the directory for the nodes hashed to this process: node -> (owner, global id)
+			// A node claimed by more than one process is marked as having an invalid owner (-1).
+			std::unordered_map<T, std::pair<I, I>> directory;
+			directory.reserve(regRecvNodes.size());
 
-				// Communicate the nodes which we own that have been requested as a ghost node by the root process
-				status = cupcfd::comm::GatherV(intersect, nIntersect, &ownership, &nOwnership, &countOwned, &nCountOwned, i, *(this->comm));
-				CHECK_ECODE(status)
+			I regRecvPtr = 0;
+			for(int i = 0; i < nProc; i++) {
+				for(int j = 0; j < regRecvCounts[i]; j++) {
+					auto inserted = directory.insert({regRecvNodes[regRecvPtr], std::pair<I, I>(i, regRecvGIDs[regRecvPtr])});
 
-				// Also communicate the global IDs for the nodes that we own that have been requested as a ghost node by the root process
-				// Build array of globalIDs
-				I * intersectGID = (I *) malloc(sizeof(I) * nIntersect);	// Each process has some ghost global id data to send
-				I * ghostGID = (I *) malloc(sizeof(I) * this->nLGhNodes);	// Need storage on process i to store ghost node global ids from all process
-																				// Could also use size of ownership?
+					if(!inserted.second) {
+						inserted.first->second.first = -1;
+					}
 
-				for(I j = 0; j < nIntersect; j++) {
-					intersectGID[j] = this->nodeToGlobal[intersect[j]];
+					regRecvPtr = regRecvPtr + 1;
 				}
+			}
 
-				// Can reuse countOwned, since the values should be the same as identified in the previous gatherV.
-				status = cupcfd::comm::GatherV(intersectGID, nIntersect, ghostGID, this->nLGhNodes, countOwned, nCountOwned, i, *(this->comm));
-				CHECK_ECODE(status)
+			// (4b) Query the directory processes for the owner and global id of every ghost node on this process
+			std::vector<int> querySendCounts(nProc, 0);
+			std::vector<int> querySendDispls(nProc + 1, 0);
 
-				// While we're here, make a note of the globalIDs requested from this process for the sink process i.
-				// We'll need this information later to send data during exchanges
-				// Since we loop over the ranks in order, this should also means the ranks will be stored in a sorted fashion.
+			for(I i = 0; i < this->nLGhNodes; i++) {
+				querySendCounts[nodeHash(ghostNodes[i]) % nProc] += 1;
+			}
 
-				if(nIntersect > 0 && this->comm->rank != i) {
-					this->sendRank.push_back(i);
-					this->sendGlobalIDsXAdj.push_back(sendAdjncyPtr);
+			for(int i = 0; i < nProc; i++) {
+				querySendDispls[i+1] = querySendDispls[i] + querySendCounts[i];
+			}
 
-					for(I j = 0; j < nIntersect; j++) {
-						this->sendGlobalIDsAdjncy.push_back(intersectGID[j]);
-						sendAdjncyPtr = sendAdjncyPtr + 1;
-					}
-				}
+			// Remember where each ghost node was placed in the query so the answers can be matched up
+			std::vector<T> querySendNodes(this->nLGhNodes);
+			std::vector<I> queryPos(this->nLGhNodes);
+			std::vector<int> queryPtr(querySendDispls.begin(), querySendDispls.end() - 1);
 
-				// Now the sink/root process should have data of which processes claim ownership over it's ghost nodes, grouped by process (regions indexed by nNodesOwned)
-				// Update local information to store this
-				// ToDo: Should this be in a kernel of some sort
-				if(this->comm->rank == i) {
-					// Error Checks
-					// Check 1: Number of ghost cells stored locally should be same as total sum of ghost cells claimed by other processes
-					if(nOwnership != this->nLGhNodes) {
-						// Error
-						//std::cout << "Error: On Rank " << this->comm.rank << "\n";
-						//std::cout << "Error: Rank " << i << ", Mismatch in local ghost cells and remotely claimed cells\n";
-						//std::cout << "This rank has " << this->nLGhNodes << " registered ghost cells,";
-						//std::cout << "the number of ghost cells on this rank claimed by other processes is " << nOwnership << "\n";
-						return cupcfd::error::E_ADJACENCY_LIST_NODE_CLAIM_MISMATCH;
-					}
+			for(I i = 0; i < this->nLGhNodes; i++) {
+				int dirRank = nodeHash(ghostNodes[i]) % nProc;
+				querySendNodes[queryPtr[dirRank]] = ghostNodes[i];
+				queryPos[i] = queryPtr[dirRank];
+				queryPtr[dirRank] += 1;
+			}
 
-					// Check 2: Every ghost cell should be claimed by another process only once - cannot have two processes both claiming to own
-					// a local cell
-					// ToDo: This error check requires a count of each node id - i.e. group + count - distinctArray can do this.
+			std::vector<int> queryRecvCounts;
+			std::vector<T> queryRecvNodes;
 
-					I * processID = (I *) malloc(sizeof(I) * nOwnership);
+			status = directoryExchange(querySendNodes, querySendCounts, queryRecvNodes, queryRecvCounts, *(this->comm));
+			CHECK_ECODE(status)
 
-					I ptr = 0;
-					// Loop over regions
-					for(I k = 0; k < nCountOwned; k++) {
-						// Loop over number of elements claimed by this region/process
-						for(I j = 0; j < countOwned[k]; j++) {
-							processID[ptr] = k;
-							ptr = ptr + 1;
-						}
-					}
+			// (4c) Answer the queries received by this process as a directory process with (owner, global id) pairs.
+			// Unclaimed nodes are answered with an invalid owner (-1).
+			std::vector<I> answerSend(2 * queryRecvNodes.size());
+			std::vector<int> answerSendCounts(nProc);
 
-					if(ptr != nOwnership) {
-						// Error - fewer process ids were assigned that reported number of claimed nodes
-						// ToDo: Suitable Error Code
-						return cupcfd::error::E_ERROR;
-					}
+			for(std::size_t i = 0; i < queryRecvNodes.size(); i++) {
+				auto entry = directory.find(queryRecvNodes[i]);
 
-					// Can now pair claimed nodes with the process that claims them
-					// Update the local map to store this information
+				if(entry == directory.end()) {
+					answerSend[2*i] = -1;
+					answerSend[2*i+1] = -1;
+				}
+				else {
+					answerSend[2*i] = entry->second.first;
+					answerSend[2*i+1] = entry->second.second;
+				}
+			}
 
-					std::vector<I> neighbourRanksTmp;
+			for(int i = 0; i < nProc; i++) {
+				answerSendCounts[i] = 2 * queryRecvCounts[i];
+			}
 
-					for(I j = 0; j < nOwnership; j++) {
-						this->nodeOwner[ownership[j]] = processID[j];
-						neighbourRanksTmp.push_back(processID[j]);
-					}
+			std::vector<int> answerRecvCounts;
+			std::vector<I> answerRecv;
 
-					if(neighbourRanksTmp.size() > 0) {
-						// Reduce the neighbour list down to distinct ranks
-						I * distinctRanks;
-						I nDistinctRanks;
+			status = directoryExchange(answerSend, answerSendCounts, answerRecv, answerRecvCounts, *(this->comm));
+			CHECK_ECODE(status)
 
-						I tmpSize = neighbourRanksTmp.size();
+			// (4d) Store the owner and global id of each ghost node.
+			// Every ghost node should be claimed by exactly one process. If not, the error is reported once the remaining
+			// communication steps are complete so that no process is left waiting.
+			bool claimMismatch = false;
 
-						status = cupcfd::utility::drivers::distinctArray(&neighbourRanksTmp[0], tmpSize, &distinctRanks, &nDistinctRanks);
-						CHECK_ECODE(status)
+			std::vector<I> ghostOwner(this->nLGhNodes);
+			std::vector<I> ghostGID(this->nLGhNodes);
+			std::vector<I> neighbourRanksTmp;
 
-						for(I k = 0; k < nDistinctRanks; k++) {
-							this->neighbourRanks.push_back(distinctRanks[k]);
-						}
+			for(I i = 0; i < this->nLGhNodes; i++) {
+				ghostOwner[i] = answerRecv[2 * queryPos[i]];
+				ghostGID[i] = answerRecv[2 * queryPos[i] + 1];
 
-						free(distinctRanks);
+				if(ghostOwner[i] < 0) {
+					claimMismatch = true;
+					continue;
+				}
 
-						// Sort the rank order
-						status = cupcfd::utility::drivers::merge_sort(&(this->neighbourRanks[0]), this->neighbourRanks.size());
-						CHECK_ECODE(status)
-					}
+				this->nodeOwner[ghostNodes[i]] = ghostOwner[i];
+				this->nodeToGlobal[ghostNodes[i]] = ghostGID[i];
+				this->globalToNode[ghostGID[i]] = ghostNodes[i];
+				neighbourRanksTmp.push_back(ghostOwner[i]);
+			}
 
-					// Can also assigned global IDs
-					for(I j = 0; j < nOwnership; j++) {
-						this->nodeToGlobal[ownership[j]] = ghostGID[j];
-						this->globalToNode[ghostGID[j]] = ownership[j];
-					}
+			if(neighbourRanksTmp.size() > 0) {
+				// Reduce the neighbour list down to distinct ranks
+				I * distinctRanks;
+				I nDistinctRanks;
 
-					// Cleanup
-					free(processID);
+				I tmpSize = neighbourRanksTmp.size();
+
+				status = cupcfd::utility::drivers::distinctArray(&neighbourRanksTmp[0], tmpSize, &distinctRanks, &nDistinctRanks);
+				CHECK_ECODE(status)
+
+				for(I k = 0; k < nDistinctRanks; k++) {
+					this->neighbourRanks.push_back(distinctRanks[k]);
 				}
 
+				free(distinctRanks);
 
+				// Sort the rank order
+				status = cupcfd::utility::drivers::merge_sort(&(this->neighbourRanks[0]), this->neighbourRanks.size());
+				CHECK_ECODE(status)
+			}
 
-				// The broadcast driver will always allocate these, even on root
-				free(recvGhostData);
-				free(intersect);
-				free(intersectGID);
-				free(ghostGID);
+			// (4e) Notify the owners of the global ids of their nodes that are ghosts on this process.
+			// The owners need this to know which data to send during exchanges.
+			std::vector<int> reqSendCounts(nProc, 0);
+			std::vector<int> reqSendDispls(nProc + 1, 0);
 
-				// These are only allocated by the gather driver on the sink process
-				if(ownership != NULL && ownership != nullptr) {
-					free(ownership);
+			for(I i = 0; i < this->nLGhNodes; i++) {
+				if(ghostOwner[i] >= 0) {
+					reqSendCounts[ghostOwner[i]] += 1;
 				}
+			}
 
-				if(countOwned != NULL && countOwned != nullptr) {
-					free(countOwned);
+			for(int i = 0; i < nProc; i++) {
+				reqSendDispls[i+1] = reqSendDispls[i] + reqSendCounts[i];
+			}
+
+			std::vector<I> reqSendGIDs(reqSendDispls[nProc]);
+			std::vector<int> reqPtr(reqSendDispls.begin(), reqSendDispls.end() - 1);
+
+			for(I i = 0; i < this->nLGhNodes; i++) {
+				if(ghostOwner[i] >= 0) {
+					reqSendGIDs[reqPtr[ghostOwner[i]]] = ghostGID[i];
+					reqPtr[ghostOwner[i]] += 1;
 				}
+			}
+
+			std::vector<int> reqRecvCounts;
+			std::vector<I> reqRecvGIDs;
+
+			status = directoryExchange(reqSendGIDs, reqSendCounts, reqRecvGIDs, reqRecvCounts, *(this->comm));
+			CHECK_ECODE(status)
 
-				// ToDo: Edge Check: If an edge exists on one process, it should exist on the other process
-				// (even if uni-directional, since it should be aware of a neighbouring node)
+			if(claimMismatch) {
+				return cupcfd::error::E_ADJACENCY_LIST_NODE_CLAIM_MISMATCH;
 			}
+
+			// Received data is grouped by requesting process in ascending rank order, so the send ranks will be sorted.
+			I sendAdjncyPtr = 0;
+			I reqRecvPtr = 0;
+
+			for(int i = 0; i < nProc; i++) {
+				if(reqRecvCounts[i] > 0 && this->comm->rank != i) {
+					this->sendRank.push_back(i);
+					this->sendGlobalIDsXAdj.push_back(sendAdjncyPtr);
+
+					for(int j = 0; j < reqRecvCounts[i]; j++) {
+						this->sendGlobalIDsAdjncy.push_back(reqRecvGIDs[reqRecvPtr + j]);
+						sendAdjncyPtr = sendAdjncyPtr + 1;
+					}
+				}
+
+				reqRecvPtr = reqRecvPtr + reqRecvCounts[i];
+			}
+
 			this->sendGlobalIDsXAdj.push_back(sendAdjncyPtr);
 
 			// =========================================================================================================
@@ -700,13 +791,62 @@ namespace cupcfd
 
 			cupcfd::error::eCodes status;
 
-			// New List
-			cupcfd::data_structures::AdjacencyListVector<I, T> sourceList;
-
 			T * localNodes = (T *) malloc(sizeof(T) * this->nLONodes);
 			status = this->getLocalNodes(localNodes, this->nLONodes);
 			CHECK_ECODE(status)
-			for(I i = 0; i < this->nLONodes; i++) {
+
+			status = this->rebuildLocalGraph(localNodes, this->nLONodes);
+			CHECK_ECODE(status)
+
+			free(localNodes);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedAdjacencyList<I, T>::reorderLocalNodes(T * nodes, I nNodes) {
+			cupcfd::error::eCodes status;
+
+			if (!this->finalized) {
+				return cupcfd::error::eCodes::E_DISTGRAPH_UNFINALIZED;
+			}
+
+			if(nNodes != this->nLONodes) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			// Every local node must appear exactly once. Local nodes currently occupy the first nLONodes
+			// local indexes, so track them by their current index.
+			std::vector<bool> seen(this->nLONodes, false);
+			for(I i = 0; i < nNodes; i++) {
+				if(!this->existsLocalNode(nodes[i])) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				I idx;
+				status = this->connGraph.getNodeLocalIndex(nodes[i], &idx);
+				CHECK_ECODE(status)
+
+				if(idx >= this->nLONodes || seen[idx]) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+				seen[idx] = true;
+			}
+
+			status = this->rebuildLocalGraph(nodes, nNodes);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedAdjacencyList<I, T>::rebuildLocalGraph(T * localNodes, I nLocalNodes) {
+			cupcfd::error::eCodes status;
+
+			// New List
+			cupcfd::data_structures::AdjacencyListVector<I, T> sourceList;
+
+			for(I i = 0; i < nLocalNodes; i++) {
 				status = sourceList.addNode(localNodes[i]);
 				CHECK_ECODE(status)
 			}
@@ -721,7 +861,7 @@ namespace cupcfd
 			}
 
 			// (c) For each node, add the edges that were previously stored. There should be no new nodes at this stage.
-			for(I i = 0; i < this->nLONodes; i++) {
+			for(I i = 0; i < nLocalNodes; i++) {
 				I count;
 				status = this->connGraph.getAdjacentNodeCount(localNodes[i], &count);
 				CHECK_ECODE(status)
@@ -763,7 +903,6 @@ namespace cupcfd
 
 			// Cleanup
 			free(ghostNodes);
-			free(localNodes);
 
 			return cupcfd::error::E_SUCCESS;
 		}
@@ -0,0 +1,352 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the DistributedSparseMatrixCSR class
+ *
+ */
+
+#include "DistributedSparseMatrixCSR.h"
+
+#include "AllToAll.h"
+#include "Gather.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		DistributedSparseMatrixCSR<I,T>::DistributedSparseMatrixCSR(cupcfd::comm::Communicator& comm, SparseMatrixCSR<I,T>& matrix,
+																	I rowStart, I rowEnd, cupcfd::comm::ExchangePatternConfig& patternConfig)
+		: comm(comm),
+		  mGlobal(0),
+		  mLocal(0),
+		  haloPattern(nullptr)
+		{
+			cupcfd::error::eCodes status;
+
+			status = this->setup(matrix, rowStart, rowEnd, patternConfig);
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class I, class T>
+		DistributedSparseMatrixCSR<I,T>::~DistributedSparseMatrixCSR() {
+			if(this->haloPattern != nullptr) {
+				delete this->haloPattern;
+			}
+		}
+
+		// === Concrete Methods ===
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedSparseMatrixCSR<I,T>::setup(SparseMatrixCSR<I,T>& matrix, I rowStart, I rowEnd,
+																	 cupcfd::comm::ExchangePatternConfig& patternConfig) {
+			cupcfd::error::eCodes status;
+
+			if(matrix.m != matrix.n) {
+				return cupcfd::error::E_MATRIX_INVALID_COL_SIZE;
+			}
+
+			if(this->haloPattern != nullptr) {
+				delete this->haloPattern;
+				this->haloPattern = nullptr;
+			}
+
+			this->mGlobal = matrix.m;
+
+			// (1) Gather the row range of every process, and check that they cover the matrix in rank order.
+			// Every process reaches the same result, so an error is returned on every process.
+			I range[2] = {rowStart, rowEnd};
+			std::vector<I> ranges(2 * this->comm.size);
+
+			status = cupcfd::comm::AllGather(range, 2, ranges.data(), 2 * this->comm.size, 2, this->comm);
+			CHECK_ECODE(status)
+
+			bool validRanges = true;
+			this->rowRanges.resize(this->comm.size + 1);
+			this->rowRanges[0] = 0;
+
+			for(int r = 0; r < this->comm.size; r++) {
+				if(ranges[2 * r] != this->rowRanges[r] || ranges[(2 * r) + 1] < ranges[2 * r]) {
+					validRanges = false;
+				}
+
+				this->rowRanges[r + 1] = ranges[(2 * r) + 1];
+			}
+
+			if(!validRanges || this->rowRanges[this->comm.size] != this->mGlobal) {
+				return cupcfd::error::E_MATRIX_ROW_OOB;
+			}
+
+			this->mLocal = rowEnd - rowStart;
+
+			// (2) Find the columns of the owned rows whose x entries are owned by another process
+			I base = matrix.baseIndex;
+			I kStart = matrix.IA[rowStart];
+			I kEnd = matrix.IA[rowEnd];
+
+			this->ghostGlobalIDs.clear();
+
+			for(I k = kStart; k < kEnd; k++) {
+				I col = matrix.JA[k] - base;
+
+				if(col < rowStart || col >= rowEnd) {
+					this->ghostGlobalIDs.push_back(col);
+				}
+			}
+
+			std::sort(this->ghostGlobalIDs.begin(), this->ghostGlobalIDs.end());
+			this->ghostGlobalIDs.erase(std::unique(this->ghostGlobalIDs.begin(), this->ghostGlobalIDs.end()), this->ghostGlobalIDs.end());
+
+			I nGhost = I(this->ghostGlobalIDs.size());
+
+			// (3) Build the owned rows with local column indexes, keeping each row sorted by local column
+			// so that the owned columns come before the ghost columns
+			I nnz = kEnd - kStart;
+
+			this->localA.m = this->mLocal;
+			this->localA.n = this->mLocal + nGhost;
+			this->localA.baseIndex = 0;
+			this->localA.nnz = nnz;
+			this->localA.IA.assign(this->mLocal + 1, 0);
+			this->localA.JA.resize(nnz);
+			this->localA.A.resize(nnz);
+			this->valueMap.resize(nnz);
+
+			this->interiorRows.clear();
+			this->haloRows.clear();
+
+			std::vector<std::pair<I,I>> rowEntries;
+			I pos = 0;
+
+			for(I i = 0; i < this->mLocal; i++) {
+				I row = rowStart + i;
+				rowEntries.clear();
+
+				for(I k = matrix.IA[row]; k < matrix.IA[row + 1]; k++) {
+					I col = matrix.JA[k] - base;
+
+					if(col >= rowStart && col < rowEnd) {
+						col = col - rowStart;
+					}
+					else {
+						col = this->mLocal + I(std::lower_bound(this->ghostGlobalIDs.begin(), this->ghostGlobalIDs.end(), col) - this->ghostGlobalIDs.begin());
+					}
+
+					rowEntries.push_back(std::make_pair(col, k - kStart));
+				}
+
+				std::sort(rowEntries.begin(), rowEntries.end());
+
+				for(std::size_t j = 0; j < rowEntries.size(); j++) {
+					this->localA.JA[pos] = rowEntries[j].first;
+					this->localA.A[pos] = matrix.A[kStart + rowEntries[j].second];
+					this->valueMap[rowEntries[j].second] = pos;
+					pos = pos + 1;
+				}
+
+				this->localA.IA[i + 1] = pos;
+
+				if(!rowEntries.empty() && rowEntries.back().first >= this->mLocal) {
+					this->haloRows.push_back(i);
+				}
+				else {
+					this->interiorRows.push_back(i);
+				}
+			}
+
+			this->xHalo.assign(this->mLocal + nGhost, T(0));
+
+			// (4) Build the exchange of the ghost x entries. Each process asks the owner of each of its ghost
+			// columns for the x entry, by sending it (requesting rank, column) pairs.
+			if(this->comm.size > 1) {
+				std::vector<I> requests;
+				std::vector<int> requestRanks;
+
+				for(I i = 0; i < nGhost; i++) {
+					int owner = this->getRowOwner(this->ghostGlobalIDs[i]);
+					requests.push_back(this->comm.rank);
+					requests.push_back(this->ghostGlobalIDs[i]);
+					requestRanks.push_back(owner);
+					requestRanks.push_back(owner);
+				}
+
+				I * recvRequests = nullptr;
+				int nRecvRequests = 0;
+
+				status = cupcfd::comm::AllToAll(requests.data(), int(requests.size()),
+												requestRanks.data(), int(requestRanks.size()),
+												&recvRequests, &nRecvRequests, this->comm);
+				CHECK_ECODE(status)
+
+				std::vector<int> exchangeIDXSend;
+				std::vector<int> tRanks;
+
+				for(int i = 0; i < nRecvRequests; i = i + 2) {
+					tRanks.push_back(recvRequests[i]);
+					exchangeIDXSend.push_back(recvRequests[i + 1]);
+				}
+
+				free(recvRequests);
+
+				// xHalo holds the owned entries followed by the ghost entries, identified by their global index
+				std::vector<int> mapLocalToExchangeIDX(this->mLocal + nGhost);
+
+				for(I i = 0; i < this->mLocal; i++) {
+					mapLocalToExchangeIDX[i] = rowStart + i;
+				}
+
+				for(I i = 0; i < nGhost; i++) {
+					mapLocalToExchangeIDX[this->mLocal + i] = this->ghostGlobalIDs[i];
+				}
+
+				status = patternConfig.createExchangePattern(&(this->haloPattern));
+				CHECK_ECODE(status)
+
+				status = this->haloPattern->init(this->comm,
+												 mapLocalToExchangeIDX.data(), int(mapLocalToExchangeIDX.size()),
+												 exchangeIDXSend.data(), int(exchangeIDXSend.size()),
+												 tRanks.data(), int(tRanks.size()));
+				CHECK_ECODE(status)
+			}
+
+			this->timing.reset();
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedSparseMatrixCSR<I,T>::setValues(SparseMatrixCSR<I,T>& matrix) {
+			I rowStart = this->rowRanges[this->comm.rank];
+			I kStart = matrix.IA[rowStart];
+			I kEnd = matrix.IA[rowStart + this->mLocal];
+
+			if(std::size_t(kEnd - kStart) != this->valueMap.size()) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			for(std::size_t k = 0; k < this->valueMap.size(); k++) {
+				this->localA.A[this->valueMap[k]] = matrix.A[kStart + k];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedSparseMatrixCSR<I,T>::splitLocalMatrix(SparseMatrixCSR<I,T>& ownedA, SparseMatrixCSR<I,T>& ghostA) {
+			I nGhost = I(this->ghostGlobalIDs.size());
+
+			// The local rows are sorted by column, so the owned columns of each row come before its ghost columns
+			ownedA.m = this->mLocal;
+			ownedA.n = this->mLocal;
+			ownedA.baseIndex = 0;
+			ownedA.IA.assign(this->mLocal + 1, 0);
+			ownedA.JA.clear();
+			ownedA.A.clear();
+
+			ghostA.m = this->mLocal;
+			ghostA.n = (nGhost > 0) ? nGhost : 1;
+			ghostA.baseIndex = 0;
+			ghostA.IA.assign(this->mLocal + 1, 0);
+			ghostA.JA.clear();
+			ghostA.A.clear();
+
+			for(I i = 0; i < this->mLocal; i++) {
+				for(I k = this->localA.IA[i]; k < this->localA.IA[i + 1]; k++) {
+					if(this->localA.JA[k] < this->mLocal) {
+						ownedA.JA.push_back(this->localA.JA[k]);
+						ownedA.A.push_back(this->localA.A[k]);
+					}
+					else {
+						ghostA.JA.push_back(this->localA.JA[k] - this->mLocal);
+						ghostA.A.push_back(this->localA.A[k]);
+					}
+				}
+
+				ownedA.IA[i + 1] = I(ownedA.JA.size());
+				ghostA.IA[i + 1] = I(ghostA.JA.size());
+			}
+
+			ownedA.nnz = I(ownedA.JA.size());
+			ghostA.nnz = I(ghostA.JA.size());
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes DistributedSparseMatrixCSR<I,T>::multiply(T * x, I nX, T * y, I nY) {
+			cupcfd::error::eCodes status;
+
+			if(nX != this->mLocal || nY != this->mLocal) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			std::copy(x, x + this->mLocal, this->xHalo.begin());
+
+			const I * IA = this->localA.IA.data();
+			const I * JA = this->localA.JA.data();
+			const T * A = this->localA.A.data();
+			const T * xData = this->xHalo.data();
+
+			auto interiorWork = [&]() -> cupcfd::error::eCodes {
+				for(std::size_t r = 0; r < this->interiorRows.size(); r++) {
+					I i = this->interiorRows[r];
+					T sum = 0;
+
+					for(I k = IA[i]; k < IA[i + 1]; k++) {
+						sum = sum + A[k] * xData[JA[k]];
+					}
+
+					y[i] = sum;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			};
+
+			auto haloWork = [&]() -> cupcfd::error::eCodes {
+				for(std::size_t r = 0; r < this->haloRows.size(); r++) {
+					I i = this->haloRows[r];
+					T sum = 0;
+
+					for(I k = IA[i]; k < IA[i + 1]; k++) {
+						sum = sum + A[k] * xData[JA[k]];
+					}
+
+					y[i] = sum;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			};
+
+			if(this->haloPattern == nullptr) {
+				status = interiorWork();
+				CHECK_ECODE(status)
+
+				status = haloWork();
+				CHECK_ECODE(status)
+			}
+			else {
+				status = cupcfd::comm::exchangeOverlap(*(this->haloPattern), this->xHalo.data(), int(this->xHalo.size()),
+													   interiorWork, haloWork, &(this->timing));
+				CHECK_ECODE(status)
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::data_structures::DistributedSparseMatrixCSR<int, float>;
+template class cupcfd::data_structures::DistributedSparseMatrixCSR<int, double>;
@@ -0,0 +1,104 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the SparseMatrixBCSR class.
+ *
+ */
+
+#include "SparseMatrixBCSR.h"
+
+#include <algorithm>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixBCSR<I,T>::buildFromCSRArrays(const I * rowPtr, const I * cols, const T * vals) {
+			if(this->blockSize < 1) {
+				return cupcfd::error::E_MATRIX_INVALID_BLOCK_SIZE;
+			}
+
+			const I b = this->blockSize;
+			I mb = (this->m + b - 1) / b;
+			I nb = (this->n + b - 1) / b;
+
+			// (1) Find the sorted block columns of each block row. blockSlot records, for the current
+			// block row, the position of each block column in JA (or -1 if it has no block yet).
+			std::vector<I> blockSlot(nb, -1);
+
+			this->IA.assign(mb + 1, 0);
+			this->JA.clear();
+
+			for(I br = 0; br < mb; br++) {
+				I rEnd = std::min(this->m, (br + 1) * b);
+				I blockStart = I(this->JA.size());
+
+				for(I r = br * b; r < rEnd; r++) {
+					for(I k = rowPtr[r]; k < rowPtr[r + 1]; k++) {
+						I bc = (cols[k] - this->baseIndex) / b;
+
+						if(blockSlot[bc] < 0) {
+							blockSlot[bc] = 0;
+							this->JA.push_back(bc);
+						}
+					}
+				}
+
+				std::sort(this->JA.begin() + blockStart, this->JA.end());
+
+				for(I k = blockStart; k < I(this->JA.size()); k++) {
+					blockSlot[this->JA[k]] = -1;
+				}
+
+				this->IA[br + 1] = I(this->JA.size());
+			}
+
+			// (2) Copy the values into their blocks
+			this->A.assign(this->JA.size() * b * b, T(0));
+
+			for(I br = 0; br < mb; br++) {
+				I rEnd = std::min(this->m, (br + 1) * b);
+
+				for(I k = this->IA[br]; k < this->IA[br + 1]; k++) {
+					blockSlot[this->JA[k]] = k;
+				}
+
+				for(I r = br * b; r < rEnd; r++) {
+					for(I k = rowPtr[r]; k < rowPtr[r + 1]; k++) {
+						I c = cols[k] - this->baseIndex;
+						this->A[(blockSlot[c / b] * b * b) + ((r % b) * b) + (c % b)] = vals[k];
+					}
+				}
+
+				for(I k = this->IA[br]; k < this->IA[br + 1]; k++) {
+					blockSlot[this->JA[k]] = -1;
+				}
+			}
+
+			// (3) Every entry of a stored block that lies inside the matrix is part of the non-zero structure
+			this->nnz = 0;
+
+			for(I br = 0; br < mb; br++) {
+				I blockRows = std::min(b, this->m - (br * b));
+
+				for(I k = this->IA[br]; k < this->IA[br + 1]; k++) {
+					this->nnz = this->nnz + (blockRows * std::min(b, this->n - (this->JA[k] * b)));
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::data_structures::SparseMatrixBCSR<int, int>;
+template class cupcfd::data_structures::SparseMatrixBCSR<int, float>;
+template class cupcfd::data_structures::SparseMatrixBCSR<int, double>;
@@ -11,6 +11,7 @@
  */
 
 #include "SparseMatrixCOO.h"
+#include "SparseMatrixCSR.h"
 #include "ArrayDrivers.h"
 
 namespace cupcfd
@@ -13,11 +13,76 @@
 
 #include "SparseMatrixCSR.h"
 
+#include <algorithm>
+
 namespace cupcfd
 {
 	namespace data_structures
 	{
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixCSR<I,T>::buildFromTriplets(const I * rows, const I * cols, const T * vals, I nVals, bool sumDuplicates) {
+			// Check every index first so that the matrix is untouched on error
+			for(I i = 0; i < nVals; i++) {
+				if((rows[i] < this->baseIndex) || (rows[i] >= this->baseIndex + this->m)) {
+					return cupcfd::error::E_MATRIX_ROW_OOB;
+				}
+
+				if((cols[i] < this->baseIndex) || (cols[i] >= this->baseIndex + this->n)) {
+					return cupcfd::error::E_MATRIX_COL_OOB;
+				}
+			}
+
+			// Counting sort of the triplet positions by row, which keeps the given order within a row
+			std::vector<I> rowPtr(this->m + 1, 0);
+
+			for(I i = 0; i < nVals; i++) {
+				rowPtr[(rows[i] - this->baseIndex) + 1] += 1;
+			}
+
+			for(I i = 0; i < this->m; i++) {
+				rowPtr[i + 1] = rowPtr[i + 1] + rowPtr[i];
+			}
+
+			std::vector<I> order(nVals);
+			std::vector<I> fill(rowPtr.begin(), rowPtr.end() - 1);
+
+			for(I i = 0; i < nVals; i++) {
+				I r = rows[i] - this->baseIndex;
+				order[fill[r]] = i;
+				fill[r] = fill[r] + 1;
+			}
+
+			// Sort each row by column. The sort is stable so repeated positions stay in the given order
+			// and the last one given can be kept.
+			this->IA.assign(this->m + 1, 0);
+			this->JA.clear();
+			this->A.clear();
+			this->JA.reserve(nVals);
+			this->A.reserve(nVals);
+
+			for(I r = 0; r < this->m; r++) {
+				std::stable_sort(order.begin() + rowPtr[r], order.begin() + rowPtr[r + 1],
+								 [cols](I a, I b) { return cols[a] < cols[b]; });
+
+				for(I k = rowPtr[r]; k < rowPtr[r + 1]; k++) {
+					I t = order[k];
+
+					if(I(this->JA.size()) > this->IA[r] && this->JA.back() == cols[t]) {
+						this->A.back() = sumDuplicates ? this->A.back() + vals[t] : vals[t];
+					}
+					else {
+						this->JA.push_back(cols[t]);
+						this->A.push_back(vals[t]);
+					}
+				}
+
+				this->IA[r + 1] = I(this->JA.size());
+			}
+
+			this->nnz = I(this->JA.size());
 
+			return cupcfd::error::E_SUCCESS;
+		}
 	}
 }
 
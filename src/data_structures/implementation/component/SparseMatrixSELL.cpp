@@ -0,0 +1,93 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the SparseMatrixSELL class.
+ *
+ */
+
+#include "SparseMatrixSELL.h"
+
+#include <algorithm>
+
+namespace cupcfd
+{
+	namespace data_structures
+	{
+		template <class I, class T>
+		cupcfd::error::eCodes SparseMatrixSELL<I,T>::buildFromCSRArrays(const I * rowPtr, const I * cols, const T * vals) {
+			if(this->chunkSize < 1 || this->sigma < 1) {
+				return cupcfd::error::E_MATRIX_INVALID_BLOCK_SIZE;
+			}
+
+			I nChunks = (this->m + this->chunkSize - 1) / this->chunkSize;
+
+			// (1) Sort the rows inside each sigma window by descending length. The sort is stable so rows
+			// of the same length keep their original order.
+			this->rowLength.resize(this->m);
+			this->rowOrder.resize(this->m);
+			this->rowPosition.resize(this->m);
+
+			for(I i = 0; i < this->m; i++) {
+				this->rowLength[i] = rowPtr[i + 1] - rowPtr[i];
+				this->rowOrder[i] = i;
+			}
+
+			for(I w = 0; w < this->m; w = w + this->sigma) {
+				I wEnd = (this->m - w < this->sigma) ? this->m : (w + this->sigma);
+
+				std::stable_sort(this->rowOrder.begin() + w, this->rowOrder.begin() + wEnd,
+								 [this](I a, I b) { return this->rowLength[a] > this->rowLength[b]; });
+			}
+
+			for(I p = 0; p < this->m; p++) {
+				this->rowPosition[this->rowOrder[p]] = p;
+			}
+
+			// (2) Each chunk is as wide as its longest row
+			this->chunkPtr.assign(nChunks + 1, 0);
+
+			for(I chunk = 0; chunk < nChunks; chunk++) {
+				I width = 0;
+				I pEnd = std::min(this->m, (chunk + 1) * this->chunkSize);
+
+				for(I p = chunk * this->chunkSize; p < pEnd; p++) {
+					width = std::max(width, this->rowLength[this->rowOrder[p]]);
+				}
+
+				this->chunkPtr[chunk + 1] = this->chunkPtr[chunk] + (width * this->chunkSize);
+			}
+
+			// (3) Copy the rows into their chunks, column-major within each chunk
+			this->JA.assign(this->chunkPtr[nChunks], I(0));
+			this->A.assign(this->chunkPtr[nChunks], T(0));
+			this->chunkSum.assign(this->chunkSize, T(0));
+
+			this->nnz = 0;
+
+			for(I p = 0; p < this->m; p++) {
+				I r = this->rowOrder[p];
+				I start = this->chunkPtr[p / this->chunkSize] + (p % this->chunkSize);
+
+				for(I j = 0; j < this->rowLength[r]; j++) {
+					this->JA[start + (j * this->chunkSize)] = cols[rowPtr[r] + j] - this->baseIndex;
+					this->A[start + (j * this->chunkSize)] = vals[rowPtr[r] + j];
+				}
+
+				this->nnz = this->nnz + this->rowLength[r];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::data_structures::SparseMatrixSELL<int, int>;
+template class cupcfd::data_structures::SparseMatrixSELL<int, float>;
+template class cupcfd::data_structures::SparseMatrixSELL<int, double>;
@@ -54,6 +54,8 @@ namespace cupcfd
 			"E_PARTITIONER_MISSING_NODE_DATA",
 			"E_PARTITIONER_NO_RESULTS",
 			"E_PARTITIONER_NPARTS_UNSET",
+			"E_PARTITIONER_MISSING_COORDINATE_DATA",
+			"E_PARTITIONER_INVALID_NODE_WEIGHTS",
 			"E_PARMETIS_NCON_UNSET",
 			"E_PARMETIS_NPARTS_UNSET",
 			"E_PARMETIS_ERROR",
@@ -64,6 +66,7 @@ namespace cupcfd
 			"E_MATRIX_ROW_OOB",
 			"E_MATRIX_INVALID_COL_SIZE",
 			"E_MATRIX_INVALID_ROW_SIZE",
+			"E_MATRIX_INVALID_BLOCK_SIZE",
 			"E_PARMETIS_INVALID_NCON",
 			"E_PARMETIS_INVALID_NPARTS",
 			"E_PARMETIS_INVALID_WORK_ARRAY",
@@ -120,10 +123,12 @@ namespace cupcfd
 			"E_MPI_DATATYPE_UNREGISTERED",
 			"E_MPI_DATATYPE_REGISTERED",
 			"E_MPI_ERR",
+			"E_EXCHANGE_ACTIVE",
 			"E_INVALID_FILE_FORMAT",
 			"E_SPECIALISATION_ERROR",
 			"E_PARTITIONER_INVALID_WORK_ARRAY",
 			"E_PETSC_ERROR",
+			"E_HDF5_ERROR",
 			"E_NOT_IMPLEMENTED"
 		};
 	}
@@ -35,7 +35,6 @@ namespace cupcfd
 			// === Constructors/Deconstructors ===
 			template <class T, unsigned int N>
 			EuclideanVector<T,N>::EuclideanVector()
-			: CustomMPIType()
 			{
 				for(uint i = 0; i < N; i++)
 				{
@@ -45,7 +44,6 @@ namespace cupcfd
 
 			template <class T, unsigned int N>
 			EuclideanVector<T,N>::EuclideanVector(T scalar)
-			: CustomMPIType()
 			{
 				for(uint i = 0; i < N; i++)
 				{
@@ -53,30 +51,14 @@ namespace cupcfd
 				}
 			}
 
-			template <class T, unsigned int N>
-			EuclideanVector<T,N>::EuclideanVector(const EuclideanVector& v)
-			: CustomMPIType()
-			{
-				for(uint i = 0; i < N; i++)
-				{
-					this->cmp[i] = v.cmp[i];
-				}
-			}
-
 			template <class T, unsigned int N>
 			template <class...Args>
 			EuclideanVector<T,N>::EuclideanVector(Args...src)
-			: CustomMPIType(),
-			  cmp{ (src)... }
+			: cmp{ (src)... }
 			{
 				static_assert(sizeof...(Args) == N, "EuclideanVector constructor dimension does not match number of parameters");
 			}
 
-			template <class T, unsigned int N>
-			EuclideanVector<T,N>::~EuclideanVector() {
-
-			}
-
 			// === Concrete Methods ===
 
 			template <class T, unsigned int N>
@@ -124,7 +106,7 @@ namespace cupcfd
 			template <class T, unsigned int N>
 			cupcfd::error::eCodes EuclideanVector<T,N>::registerMPIType() {
 				// Error Check - Only Register if currently unregistered
-				if(this->isRegistered()) {
+				if(EuclideanVector<T,N>::isRegistered()) {
 					return cupcfd::error::E_MPI_DATATYPE_REGISTERED;
 				}
 
@@ -139,11 +121,10 @@ namespace cupcfd
 
 				// Get the mpi type of a euclidean vector component - all components should share the same type
 				MPI_Datatype componentType;
-				cupcfd::comm::mpi::getMPIType(this->cmp[0], &componentType);
+				cupcfd::comm::mpi::getMPIType(T(0), &componentType);
 				structTypes[0] = componentType;
 
-				// displ[0] = (MPI_Aint) offsetof(class EuclideanVector, cmp);
-				displ[0] = (MPI_Aint) ( (char*)&(this->cmp) - (char*)this );
+				displ[0] = (MPI_Aint) offsetOf(&EuclideanVector::cmp);
 
 				MPI_Datatype vecType;
 				MPI_Datatype vecTypeResized;
@@ -194,7 +175,7 @@ namespace cupcfd
 				int mpiErr;
 
 				// Error Check - Only Deregister if currently registered
-				if(!this->isRegistered()) {
+				if(!EuclideanVector<T,N>::isRegistered()) {
 					return cupcfd::error::E_MPI_DATATYPE_UNREGISTERED;
 				}
 
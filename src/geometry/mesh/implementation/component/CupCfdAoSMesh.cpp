@@ -680,15 +680,16 @@ namespace cupcfd
 				// First, let us create useful data stores
 				// (a) A vector of valid Keys (Build Cell IDs)
 				std::vector<I> keys;
-				for(typename std::map<I,I>::iterator iter = this->cellBuildIDToLocalID.begin(); iter != this->cellBuildIDToLocalID.end(); iter++) {
+				for(auto iter = this->cellBuildIDToLocalID.begin(); iter != this->cellBuildIDToLocalID.end(); iter++) {
 					keys.push_back(iter->first);
 				}
 
 
 				// (b) A mapping of the current local cell IDs in the map to their key
-				std::map<I,I> localToBuildID;
+				// The current local cell IDs are the positions the cells were added at, so are dense
 				I iLimit;
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(keys.size());
+				std::vector<I> localToBuildID(iLimit);
 				for(I i = 0; i < iLimit; i++) {
 					I lID = this->cellBuildIDToLocalID[keys[i]];
 					localToBuildID[lID] = keys[i];
@@ -833,6 +834,53 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdAoSMesh<I,T,L>::reorderFaces() {
+				cupcfd::error::eCodes status;
+
+				if(!this->reordering.applied) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				I nFaces = cupcfd::utility::drivers::safeConvertSizeT<I>(this->faces.size());
+
+				std::vector<I> cell1(nFaces);
+				std::vector<I> cell2(nFaces);
+				for(I i = 0; i < nFaces; i++) {
+					cell1[i] = this->faces[i].cell1ID;
+					cell2[i] = this->faces[i].cell2ID;
+				}
+
+				// order[i] is the current local ID of the face that will be numbered i
+				std::vector<I> order(nFaces);
+				status = computeFaceOrderingByCell(cell1.data(), cell2.data(), nFaces, order.data(), nFaces);
+				CHECK_ECODE(status)
+
+				std::vector<I> newFaceID(nFaces);
+				for(I i = 0; i < nFaces; i++) {
+					newFaceID[order[i]] = i;
+				}
+
+				// (1) Shuffle the face data
+				std::vector<CupCfdAoSMeshFace<I,T>> tmpFaces(this->faces);
+				for(I i = 0; i < nFaces; i++) {
+					this->faces[i] = tmpFaces[order[i]];
+				}
+
+				// (2) Update the face build ID mappings
+				for(auto iter = this->faceBuildIDToLocalID.begin(); iter != this->faceBuildIDToLocalID.end(); iter++) {
+					iter->second = newFaceID[iter->second];
+				}
+
+				// (3) Update the boundary -> face mappings
+				I iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(this->boundaries.size());
+				for(I i = 0; i < iLimit; i++) {
+					this->boundaries[i].faceID = newFaceID[this->boundaries[i].faceID];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			template <class I, class T, class L>
 			cupcfd::error::eCodes CupCfdAoSMesh<I,T,L>::finalize() {
 				cupcfd::error::eCodes status;
@@ -855,6 +903,11 @@ namespace cupcfd
 				}
 
 
+				// Renumber the local cells in the connectivity graph if a reordering was selected.
+				// The cell data follows the new numbering in updateCellLocalIndexes.
+				status = this->reorderCells();
+				CHECK_ECODE(status)
+
 				// Now all cells have been added, we need to order the local cell objects
 				// to have the same local indexes as in the connectivity graph
 				// This also requires an update of the face->cell1 and face->cell2 mappings
@@ -865,6 +918,10 @@ namespace cupcfd
 				status = this->updateCellLocalIndexes();
 				CHECK_ECODE(status)
 
+				// If the cells were renumbered, follow the new cell order with the faces
+				status = this->reorderFaces();
+				CHECK_ECODE(status)
+
 				// Most data is stored in AoS structures already. However, we need to update
 				// the Cell -> Face Mapping as it is stored in a separate CSR and is not updated
 				// by any of the add/set functions due to the performance overheads of doing it
@@ -880,6 +937,27 @@ namespace cupcfd
 				status = this->exchangeCellGlobalNFaces();
 				CHECK_ECODE(status)
 
+				// Build the spatial index of the local cells for point location
+				status = this->buildCellIndex();
+				CHECK_ECODE(status)
+
+				// Cache the geometric invariants of the local cells and faces
+				status = this->buildGeometryCache();
+				CHECK_ECODE(status)
+
+				// Colour the faces so that face loops can be threaded without write conflicts
+				status = this->buildFaceColouring();
+				CHECK_ECODE(status)
+
+				// Split the faces that access ghost cells from those that do not, so that face loops can be
+				// overlapped with the exchange of ghost cell data
+				status = this->buildHaloFaces();
+				CHECK_ECODE(status)
+
+				// Copy the geometry read by the finite volume kernels into flat arrays
+				status = this->buildKernelView();
+				CHECK_ECODE(status)
+
 				// Update status
 				this->finalized = true;
 
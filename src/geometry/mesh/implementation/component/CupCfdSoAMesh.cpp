@@ -681,15 +681,16 @@ namespace cupcfd
 				// First, let us create useful data stores
 				// (a) A vector of valid Keys (Build Cell IDs)
 				std::vector<I> keys;
-				for(typename std::map<I,I>::iterator iter = this->cellBuildIDToLocalID.begin(); iter != this->cellBuildIDToLocalID.end(); iter++) {
+				for(auto iter = this->cellBuildIDToLocalID.begin(); iter != this->cellBuildIDToLocalID.end(); iter++) {
 					keys.push_back(iter->first);
 				}
 
 
 				// (b) A mapping of the current local cell IDs in the map to their key
-				std::map<I,I> localToBuildID;
+				// The current local cell IDs are the positions the cells were added at, so are dense
 				I iLimit;
 				iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(keys.size());
+				std::vector<I> localToBuildID(iLimit);
 				for(I i = 0; i < iLimit; i++) {
 					I lID = this->cellBuildIDToLocalID[keys[i]];
 					localToBuildID[lID] = keys[i];
@@ -838,6 +839,60 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes CupCfdSoAMesh<I,T,L>::reorderFaces() {
+				cupcfd::error::eCodes status;
+
+				if(!this->reordering.applied) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				I nFaces = cupcfd::utility::drivers::safeConvertSizeT<I>(this->faceCell1ID.size());
+
+				// order[i] is the current local ID of the face that will be numbered i
+				std::vector<I> order(nFaces);
+				status = computeFaceOrderingByCell(this->faceCell1ID.data(), this->faceCell2ID.data(), nFaces, order.data(), nFaces);
+				CHECK_ECODE(status)
+
+				std::vector<I> newFaceID(nFaces);
+				for(I i = 0; i < nFaces; i++) {
+					newFaceID[order[i]] = i;
+				}
+
+				// (1) Shuffle each of the face data structures
+				auto shuffle = [&order, nFaces](auto& data) {
+					auto tmp = data;
+					for(I i = 0; i < nFaces; i++) {
+						data[i] = tmp[order[i]];
+					}
+				};
+
+				shuffle(this->faceCell1ID);
+				shuffle(this->faceCell2ID);
+				shuffle(this->faceLambda);
+				shuffle(this->faceNorm);
+				shuffle(this->faceCenter);
+				shuffle(this->faceRLencos);
+				shuffle(this->faceArea);
+				shuffle(this->faceXpac);
+				shuffle(this->faceXnac);
+				shuffle(this->faceBoundaryID);
+				shuffle(this->faceVertexID);
+
+				// (2) Update the face build ID mappings
+				for(auto iter = this->faceBuildIDToLocalID.begin(); iter != this->faceBuildIDToLocalID.end(); iter++) {
+					iter->second = newFaceID[iter->second];
+				}
+
+				// (3) Update the boundary -> face mappings
+				I iLimit = cupcfd::utility::drivers::safeConvertSizeT<I>(this->boundaryFaceID.size());
+				for(I i = 0; i < iLimit; i++) {
+					this->boundaryFaceID[i] = newFaceID[this->boundaryFaceID[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			template <class I, class T, class L>
 			cupcfd::error::eCodes CupCfdSoAMesh<I,T,L>::finalize() {
 				cupcfd::error::eCodes status;
@@ -860,6 +915,11 @@ namespace cupcfd
 				}
 
 
+				// Renumber the local cells in the connectivity graph if a reordering was selected.
+				// The cell data follows the new numbering in updateCellLocalIndexes.
+				status = this->reorderCells();
+				CHECK_ECODE(status)
+
 				// Now all cells have been added, we need to order the local cell objects
 				// to have the same local indexes as in the connectivity graph
 				// This also requires an update of the face->cell1 and face->cell2 mappings
@@ -870,6 +930,10 @@ namespace cupcfd
 				status = this->updateCellLocalIndexes();
 				CHECK_ECODE(status)
 
+				// If the cells were renumbered, follow the new cell order with the faces
+				status = this->reorderFaces();
+				CHECK_ECODE(status)
+
 				status = this->updateCellFaceMap();
 				CHECK_ECODE(status)
 
@@ -881,6 +945,27 @@ namespace cupcfd
 				status = this->exchangeCellGlobalNFaces();
 				CHECK_ECODE(status)
 
+				// Build the spatial index of the local cells for point location
+				status = this->buildCellIndex();
+				CHECK_ECODE(status)
+
+				// Cache the geometric invariants of the local cells and faces
+				status = this->buildGeometryCache();
+				CHECK_ECODE(status)
+
+				// Colour the faces so that face loops can be threaded without write conflicts
+				status = this->buildFaceColouring();
+				CHECK_ECODE(status)
+
+				// Split the faces that access ghost cells from those that do not, so that face loops can be
+				// overlapped with the exchange of ghost cell data
+				status = this->buildHaloFaces();
+				CHECK_ECODE(status)
+
+				// Copy the geometry read by the finite volume kernels into flat arrays
+				status = this->buildKernelView();
+				CHECK_ECODE(status)
+
 				// Update status
 				this->finalized = true;
 
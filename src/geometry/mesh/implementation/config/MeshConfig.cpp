@@ -34,6 +34,12 @@ namespace cupcfd
 			template <class I, class T, class L>
 			MeshConfig<I,T,L>::MeshConfig(cupcfd::partitioner::PartitionerConfig<I,I>& partConfig,
 										MeshSourceConfig<I,T,L>& meshSourceConfig)
+			:reorderType(MESH_REORDER_NONE),
+			 checkpointPath(""),
+			 checkpointLoaded(false),
+			 sourceReadRecorded(false),
+			 sourceBytesRead(0),
+			 sourceReadTime(0.0)
 			{
 				// Clone so we maintain the polymorphic type
 				this->partConfig = partConfig.clone();
@@ -43,7 +49,13 @@ namespace cupcfd
 			template <class I, class T, class L>
 			MeshConfig<I,T,L>::MeshConfig(MeshConfig<I,T,L>& source)
 			:partConfig(nullptr),
-			 meshSourceConfig(nullptr)
+			 meshSourceConfig(nullptr),
+			 reorderType(MESH_REORDER_NONE),
+			 checkpointPath(""),
+			 checkpointLoaded(false),
+			 sourceReadRecorded(false),
+			 sourceBytesRead(0),
+			 sourceReadTime(0.0)
 			{
 				*this = source;
 			}
@@ -25,7 +25,9 @@ namespace cupcfd
 			  cellX(cellX), cellY(cellY), cellZ(cellZ),
 			  sMinX(sMinX), sMaxX(sMaxX),
 			  sMinY(sMinY), sMaxY(sMaxY),
-			  sMinZ(sMinZ), sMaxZ(sMaxZ)
+			  sMinZ(sMinZ), sMaxZ(sMaxZ),
+			  blockDecomposition(false),
+			  blockX(0), blockY(0), blockZ(0)
 			{
 				// Nothing else to do beyond member instantiation list
 			}
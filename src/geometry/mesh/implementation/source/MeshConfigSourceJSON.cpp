@@ -14,6 +14,8 @@
 #include "PartitionerMetisConfigSourceJSON.h"
 #include "PartitionerNaiveConfigSourceJSON.h"
 #include "PartitionerParmetisConfigSourceJSON.h"
+#include "PartitionerSFCConfigSourceJSON.h"
+#include "PartitionerRCBConfigSourceJSON.h"
 #include "MeshSourceFileConfigJSON.h"
 #include "MeshSourceStructGenConfigJSON.h"
 
@@ -101,6 +103,20 @@ namespace cupcfd
 						// Return error or success depending on whether the object was built (e.g. missing options causes failure)
 						return status;
 					}
+					else if(partConfigData["Partitioner"].isMember("SFCPartitioner")) {
+						cupcfd::partitioner::PartitionerSFCConfigSourceJSON<I,I> sfcConfigSource(partConfigData["Partitioner"]["SFCPartitioner"]);
+						status = sfcConfigSource.buildPartitionerConfig(partConfig);
+
+						// Return error or success depending on whether the object was built (e.g. missing options causes failure)
+						return status;
+					}
+					else if(partConfigData["Partitioner"].isMember("RCBPartitioner")) {
+						cupcfd::partitioner::PartitionerRCBConfigSourceJSON<I,I> rcbConfigSource(partConfigData["Partitioner"]["RCBPartitioner"]);
+						status = rcbConfigSource.buildPartitionerConfig(partConfig);
+
+						// Return error or success depending on whether the object was built (e.g. missing options causes failure)
+						return status;
+					}
 					else {
 						// No expected Partitioner Field found
 						return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
@@ -154,6 +170,52 @@ namespace cupcfd
 				throw std::runtime_error("MeshConfigSourceJSON<I,T,L>::getMeshSourceConfig() hit edge case");
 			}
 
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshConfigSourceJSON<I,T,L>::getReordering(MeshReorderType * reorderType) {
+				if(this->configData.isMember("Reordering")) {
+					const Json::Value dataSourceType = this->configData["Reordering"];
+
+					if(dataSourceType == "None") {
+						*reorderType = MESH_REORDER_NONE;
+						return cupcfd::error::E_SUCCESS;
+					}
+					else if(dataSourceType == "RCM") {
+						*reorderType = MESH_REORDER_RCM;
+						return cupcfd::error::E_SUCCESS;
+					}
+					else if(dataSourceType == "Morton") {
+						*reorderType = MESH_REORDER_MORTON;
+						return cupcfd::error::E_SUCCESS;
+					}
+					else if(dataSourceType == "Hilbert") {
+						*reorderType = MESH_REORDER_HILBERT;
+						return cupcfd::error::E_SUCCESS;
+					}
+
+					// Found, but not a matching value
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+
+				return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshConfigSourceJSON<I,T,L>::getCheckpointPath(std::string * checkpointPath) {
+				if(this->configData.isMember("Checkpoint")) {
+					const Json::Value dataSourceType = this->configData["Checkpoint"];
+
+					if(dataSourceType.isString() && !dataSourceType.asString().empty()) {
+						*checkpointPath = dataSourceType.asString();
+						return cupcfd::error::E_SUCCESS;
+					}
+
+					// Found, but not a valid value
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+
+				return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+			}
+
 			template <class I, class T, class L>
 			cupcfd::error::eCodes MeshConfigSourceJSON<I,T,L>::buildMeshConfig(MeshConfig<I,T,L> ** config) {
 				cupcfd::error::eCodes status;
@@ -169,7 +231,29 @@ namespace cupcfd
 				status = this->getMeshSourceConfig(&sourceConfig);
 				CHECK_ECODE(status)
 
+				// Optional - default to keeping the cells in label order
+				MeshReorderType reorderType;
+				status = this->getReordering(&reorderType);
+				if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					reorderType = MESH_REORDER_NONE;
+				}
+				else {
+					CHECK_ECODE(status)
+				}
+
+				// Optional - default to always building the mesh from the source
+				std::string checkpointPath;
+				status = this->getCheckpointPath(&checkpointPath);
+				if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					checkpointPath = "";
+				}
+				else {
+					CHECK_ECODE(status)
+				}
+
 				*config = new MeshConfig<I,T,L>(*partConfig, *sourceConfig);
+				(*config)->setReorderType(reorderType);
+				(*config)->setCheckpointPath(checkpointPath);
 
 				delete partConfig;
 				delete sourceConfig;
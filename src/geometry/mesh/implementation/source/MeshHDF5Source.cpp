@@ -26,6 +26,7 @@
 #include "HDF5Access.h"
 #include "HDF5Properties.h"
 #include "HDF5Record.h"
+#include "HDF5File.h"
 
 // ToDo: Most of these accessors could be compressed further into generic HDF5 reads for full datasets etc.
 
@@ -44,11 +45,25 @@ namespace cupcfd
 			{
 				this->fileName = filePath;
 				this->gidBase = 1;
+				this->file = new cupcfd::io::hdf5::HDF5File(filePath);
+			}
+
+			template <class I, class T>
+			MeshHDF5Source<I,T>::MeshHDF5Source(std::string filePath, cupcfd::comm::Communicator& comm)
+			: MeshSource<I,T,I>()
+			{
+				this->fileName = filePath;
+				this->gidBase = 1;
+				this->file = new cupcfd::io::hdf5::HDF5File(filePath, comm.comm, true);
+
+				// Only record reads of the mesh data
+				this->file->resetStatistics();
 			}
 
 			template <class I, class T>
 			MeshHDF5Source<I,T>::~MeshHDF5Source()
 			{
+				delete this->file;
 			}
 
 			template <class I, class T>
@@ -57,7 +72,7 @@ namespace cupcfd
 
 				// This format stores its attributes at the root level
 				cupcfd::io::hdf5::HDF5Record record("/",attrName,true);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				status = access.readData(out);
 				CHECK_ECODE(status)
 				return cupcfd::error::E_SUCCESS;
@@ -69,7 +84,7 @@ namespace cupcfd
 
 				// This format stores its attributes at the root level
 				cupcfd::io::hdf5::HDF5Record record("/",attrName,true);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				status = access.readData(out);
 				CHECK_ECODE(status)
 				return cupcfd::error::E_SUCCESS;
@@ -81,12 +96,19 @@ namespace cupcfd
 
 				// This format stores its attributes at the root level
 				cupcfd::io::hdf5::HDF5Record record("/",attrName,true);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				status = access.readData(out);
 				CHECK_ECODE(status)
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			template <class I, class T>
+			cupcfd::error::eCodes MeshHDF5Source<I,T>::getReadStatistics(unsigned long long * bytesRead, double * readTime) {
+				*bytesRead = this->file->bytesRead;
+				*readTime = this->file->readTime;
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			// === Inherited Overloaded Methods ===
 
 			template <class I, class T>
@@ -225,8 +247,9 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/cell", "nfaces" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
 
 				// Size vs Properties Size Check
 
@@ -254,8 +277,9 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/cell", "vol" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
 
 				// Select Indexes
 				//Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
@@ -280,10 +304,13 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/cell", "x" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties propertiesX(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesY(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesZ(access);
+				propertiesX.selectNone();
+				propertiesY.selectNone();
+				propertiesZ.selectNone();
 
 				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
 				for(I i = 0; i < nCellLabels; i++) {
@@ -349,8 +376,9 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/cell", "cface" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
 
 				// Read Data
 				I * cellFaceIndexes = (I *) malloc(sizeof(I) * maxFaceCount * nCellLabels);
@@ -408,8 +436,9 @@ namespace cupcfd
 				I * cell2Data = (I *) malloc(sizeof(I) * nFaceLabels);
 
 				cupcfd::io::hdf5::HDF5Record record("/face", "cell2" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
 
 				// Select Indexes
 				// Labels in this file are stored as index 1, HDF5 requires index 0, so correct for the offset.
@@ -440,8 +469,9 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/face", "vertices" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties propertiesVert(access);
+				propertiesVert.selectNone();
 
 				// Select Indexes
 				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
@@ -495,8 +525,9 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/face", "bnd" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
 
 				// Labels in this file are stored as index 1, HDF5 requires index 0, so correct for the offset.
 				for(I i = 0; i < nFaceLabels; i++) {
@@ -522,8 +553,9 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/face", "cell1" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
 
 				// Select Indexes
 				// Labels in this file are stored as index 1, HDF5 requires index 0, so correct for the offset.
@@ -550,8 +582,9 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/face", "cell2" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
 
 				// Select Indexes
 				// Labels in this file are stored as index 1, HDF5 requires index 0, so correct for the offset.
@@ -589,8 +622,9 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/face", "area" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
 
 				// Select Indexes
 				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
@@ -617,8 +651,9 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/face", "lambda" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
 
 				// Select Indexes
 				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
@@ -645,10 +680,13 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/face", "n" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties propertiesX(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesY(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesZ(access);
+				propertiesX.selectNone();
+				propertiesY.selectNone();
+				propertiesZ.selectNone();
 
 				// Select Indexes
 				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
@@ -695,10 +733,13 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/face", "x" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties propertiesX(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesY(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesZ(access);
+				propertiesX.selectNone();
+				propertiesY.selectNone();
+				propertiesZ.selectNone();
 
 				// Select Indexes
 				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
@@ -780,11 +821,15 @@ namespace cupcfd
 				I * vert4 = (I *) malloc(sizeof(I) * nFaces);
 
 				cupcfd::io::hdf5::HDF5Record record("/face", "vertices" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties propertiesVert1(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesVert2(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesVert3(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesVert4(access);
+				propertiesVert1.selectNone();
+				propertiesVert2.selectNone();
+				propertiesVert3.selectNone();
+				propertiesVert4.selectNone();
 
 				// Select Indexes
 				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
@@ -842,10 +887,13 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("vert" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties propertiesX(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesY(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesZ(access);
+				propertiesX.selectNone();
+				propertiesY.selectNone();
+				propertiesZ.selectNone();
 
 				// Select Indexes
 				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
@@ -885,28 +933,27 @@ namespace cupcfd
 			cupcfd::error::eCodes MeshHDF5Source<I,T>::getBoundaryFaceLabels(I * boundaryFaceLabels, I nBoundaryFaceLabels, I * boundaryLabels, I nBoundaryLabels) {
 				cupcfd::error::eCodes status;
 				
-				if(nBoundaryLabels > 0) {
-					// Size Check
-					if (nBoundaryLabels != nBoundaryFaceLabels) {
-						return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
-					}
+				// Size Check
+				if (nBoundaryLabels != nBoundaryFaceLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
 
-					// Setup Access
-					cupcfd::io::hdf5::HDF5Record record("/bnd", "face" , false);
-					cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
-					cupcfd::io::hdf5::HDF5Properties properties(access);
+				// Setup Access
+				cupcfd::io::hdf5::HDF5Record record("/bnd", "face" , false);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
+				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
 
-					// Select Indexes
-					// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
-					for(I i = 0; i < nBoundaryLabels; i++) {
-						properties.addIndex(boundaryLabels[i] - 1);
-					}
+				// Select Indexes
+				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
+				for(I i = 0; i < nBoundaryLabels; i++) {
+					properties.addIndex(boundaryLabels[i] - 1);
+				}
 
-					status = access.readData(boundaryFaceLabels, properties);
-					CHECK_ECODE(status)
+				status = access.readData(boundaryFaceLabels, properties);
+				CHECK_ECODE(status)
 
-					// HDF5	Interface Error Check
-				}
+				// HDF5	Interface Error Check
 
 				return cupcfd::error::E_SUCCESS;
 			}
@@ -927,8 +974,9 @@ namespace cupcfd
 
 				// Setup Access
 				cupcfd::io::hdf5::HDF5Record record("/bnd", "vertices" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties propertiesVert(access);
+				propertiesVert.selectNone();
 
 				// Select Indexes
 				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
@@ -957,28 +1005,27 @@ namespace cupcfd
 			cupcfd::error::eCodes MeshHDF5Source<I,T>::getBoundaryRegionLabels(I * boundaryRegionLabels, I nBoundaryRegionLabels, I * boundaryLabels, I nBoundaryLabels) {
 				cupcfd::error::eCodes status;
 				
-				if(nBoundaryLabels > 0) {
-					// Size Check
-					if (nBoundaryRegionLabels != nBoundaryLabels) {
-						return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
-					}
+				// Size Check
+				if (nBoundaryRegionLabels != nBoundaryLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
 
-					// Setup Access
-					cupcfd::io::hdf5::HDF5Record record("/bnd", "rid" , false);
-					cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
-					cupcfd::io::hdf5::HDF5Properties properties(access);
+				// Setup Access
+				cupcfd::io::hdf5::HDF5Record record("/bnd", "rid" , false);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
+				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
 
-					// Select Indexes
-					// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
-					for(I i = 0; i < nBoundaryLabels; i++) {
-						properties.addIndex(boundaryLabels[i] - 1);
-					}
+				// Select Indexes
+				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
+				for(I i = 0; i < nBoundaryLabels; i++) {
+					properties.addIndex(boundaryLabels[i] - 1);
+				}
 
-					status = access.readData(boundaryRegionLabels, properties);
-					CHECK_ECODE(status)
+				status = access.readData(boundaryRegionLabels, properties);
+				CHECK_ECODE(status)
 
-					// HDF5	Interface Error Check
-				}
+				// HDF5	Interface Error Check
 
 				return cupcfd::error::E_SUCCESS;
 			}
@@ -1032,11 +1079,15 @@ namespace cupcfd
 				I * vert4 = (I *) malloc(sizeof(I) * nBoundaries);
 
 				cupcfd::io::hdf5::HDF5Record record("/bnd", "vertices" , false);
-				cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
 				cupcfd::io::hdf5::HDF5Properties propertiesVert1(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesVert2(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesVert3(access);
 				cupcfd::io::hdf5::HDF5Properties propertiesVert4(access);
+				propertiesVert1.selectNone();
+				propertiesVert2.selectNone();
+				propertiesVert3.selectNone();
+				propertiesVert4.selectNone();
 
 				// Select Indexes
 				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
@@ -1087,28 +1138,27 @@ namespace cupcfd
 			cupcfd::error::eCodes MeshHDF5Source<I,T>::getBoundaryDistance(T * boundaryDistance, I nBoundaryDistance, I * boundaryLabels, I nBoundaryLabels) {
 				cupcfd::error::eCodes status;
 				
-				if(nBoundaryLabels > 0) {
-					// Size Check
-					if (nBoundaryDistance != nBoundaryLabels) {
-						return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
-					}
+				// Size Check
+				if (nBoundaryDistance != nBoundaryLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
 
-					// Setup Access
-					cupcfd::io::hdf5::HDF5Record record("/bnd", "distance" , false);
-					cupcfd::io::hdf5::HDF5Access access(this->fileName, record);
-					cupcfd::io::hdf5::HDF5Properties properties(access);
+				// Setup Access
+				cupcfd::io::hdf5::HDF5Record record("/bnd", "distance" , false);
+				cupcfd::io::hdf5::HDF5Access access(*this->file, record);
+				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
 
-					// Select Indexes
-					// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
-					for(I i = 0; i < nBoundaryLabels; i++) {
-						properties.addIndex(boundaryLabels[i] - 1);
-					}
+				// Select Indexes
+				// Labels in this file are index 1, HDF5 requires index 0, so correct for the offset.
+				for(I i = 0; i < nBoundaryLabels; i++) {
+					properties.addIndex(boundaryLabels[i] - 1);
+				}
 
-					status = access.readData(boundaryDistance, properties);
-					CHECK_ECODE(status)
+				status = access.readData(boundaryDistance, properties);
+				CHECK_ECODE(status)
 
-					// HDF5	Interface Error Check
-				}
+				// HDF5	Interface Error Check
 
 				return cupcfd::error::E_SUCCESS;
 			}
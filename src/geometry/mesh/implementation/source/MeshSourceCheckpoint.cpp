@@ -0,0 +1,971 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the MeshSourceCheckpoint Class.
+ */
+
+#include <string>
+#include <fstream>
+#include <stdexcept>
+
+// Function/Class Declarations
+#include "MeshSourceCheckpoint.h"
+
+// For access to HDF5 Interface
+#include "HDF5Access.h"
+#include "HDF5Properties.h"
+#include "HDF5Record.h"
+#include "HDF5File.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			/**
+			 * Read an integer attribute stored at the root of a checkpoint file.
+			 */
+			static cupcfd::error::eCodes readCheckpointAttribute(cupcfd::io::hdf5::HDF5File& file, std::string attrName, int * out) {
+				cupcfd::io::hdf5::HDF5Record record("/", attrName, true);
+				cupcfd::io::hdf5::HDF5Access access(file, record);
+				return access.readData(out);
+			}
+
+			/**
+			 * Read an integer attribute stored at the root of a checkpoint file, if the checkpoint was
+			 * completely written. The rank count is written last, so a checkpoint without it is incomplete.
+			 */
+			static cupcfd::error::eCodes readCompleteCheckpointAttribute(std::string filePath, std::string attrName, int * out) {
+				// Check File is Accessible
+				std::ifstream accessTest(filePath);
+				if(!accessTest.good()) {
+					return cupcfd::error::E_FILE_MISSING;
+				}
+
+				// A truncated or non-HDF5 file can still be accessible, but fails to open. Report this as an
+				// invalid checkpoint rather than throwing, so that every process can agree to reject it.
+				try {
+					cupcfd::io::hdf5::HDF5File file(filePath);
+					if(H5Aexists(file.fileID, "nranks") <= 0) {
+						return cupcfd::error::E_INVALID_FILE_FORMAT;
+					}
+
+					return readCheckpointAttribute(file, attrName, out);
+				}
+				catch(const std::invalid_argument& e) {
+					return cupcfd::error::E_INVALID_FILE_FORMAT;
+				}
+			}
+
+			/**
+			 * Read the block of rows written by this process to a dataset of a checkpoint file.
+			 *
+			 * The size of the block written by each process is read from the "/rank" group, and the block
+			 * of this process starts after the blocks of all lower ranks. Every process reads each dataset,
+			 * even if its own block is empty, so that the reads can be collective.
+			 */
+			template <class D>
+			static cupcfd::error::eCodes readCheckpointBlock(cupcfd::io::hdf5::HDF5File& file, int rank, int nRanks,
+															  std::string rankDataName, std::string groupName, std::string dataName,
+															  unsigned long long nCols, std::vector<D>& sink) {
+				cupcfd::error::eCodes status;
+
+				// (1) Size of the block of every process
+				std::vector<int> rankRows(nRanks);
+				cupcfd::io::hdf5::HDF5Record rankRecord("/rank", rankDataName, false);
+				cupcfd::io::hdf5::HDF5Access rankAccess(file, rankRecord);
+				status = rankAccess.readData(rankRows.data());
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				unsigned long long offset = 0;
+				for(int r = 0; r < rank; r++) {
+					offset = offset + rankRows[r];
+				}
+				unsigned long long nRows = rankRows[rank];
+
+				// (2) Read the block of this process as a single contiguous selection
+				sink.resize(nRows * nCols);
+
+				cupcfd::io::hdf5::HDF5Record record(groupName, dataName, false);
+				cupcfd::io::hdf5::HDF5Access access(file, record);
+				cupcfd::io::hdf5::HDF5Properties properties(access);
+				properties.selectNone();
+
+				for(unsigned long long i = 0; i < nRows; i++) {
+					for(unsigned long long j = 0; j < nCols; j++) {
+						if(nCols == 1) {
+							properties.addIndex(offset + i);
+						}
+						else {
+							properties.addIndex(offset + i, j);
+						}
+					}
+				}
+
+				return access.readData(sink.data(), properties);
+			}
+
+			/**
+			 * Convert a list of component counts into the start of each component in a CSR array.
+			 */
+			template <class I>
+			static void buildCheckpointCSR(const std::vector<I>& counts, std::vector<I>& xadj) {
+				xadj.resize(counts.size() + 1);
+				xadj[0] = 0;
+				for(std::size_t i = 0; i < counts.size(); i++) {
+					xadj[i + 1] = xadj[i] + counts[i];
+				}
+			}
+
+			/**
+			 * Find the position of each label in the data held by this process.
+			 */
+			template <class I>
+			static cupcfd::error::eCodes findCheckpointIndexes(cupcfd::data_structures::IndexMap<I,I>& labelToIndex,
+																I * labels, I nLabels, std::vector<I>& indexes,
+																cupcfd::error::eCodes missing) {
+				indexes.resize(nLabels);
+
+				for(I i = 0; i < nLabels; i++) {
+					auto iter = labelToIndex.find(labels[i]);
+					if(iter == labelToIndex.end()) {
+						return missing;
+					}
+					indexes[i] = iter->second;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I>
+			static void buildCheckpointLabelMap(const std::vector<I>& labels, cupcfd::data_structures::IndexMap<I,I>& labelToIndex) {
+				for(std::size_t i = 0; i < labels.size(); i++) {
+					labelToIndex[labels[i]] = I(i);
+				}
+			}
+
+			template <class I, class T>
+			MeshSourceCheckpoint<I,T>::MeshSourceCheckpoint(std::string filePath, cupcfd::comm::Communicator& comm)
+			: MeshSource<I,T,I>()
+			{
+				cupcfd::error::eCodes status;
+
+				this->fileName = filePath;
+
+				// Every process reads every dataset, so the reads can be collective
+				cupcfd::io::hdf5::HDF5File file(filePath, comm.comm, true);
+
+				int nRanks;
+				status = readCheckpointAttribute(file, "nranks", &nRanks);
+				HARD_CHECK_ECODE(status)
+
+				// The blocks are matched to processes by rank
+				if(nRanks != comm.size) {
+					HARD_CHECK_ECODE(cupcfd::error::E_INVALID_FILE_FORMAT)
+				}
+
+				int attr;
+				status = readCheckpointAttribute(file, "ncells", &attr);
+				HARD_CHECK_ECODE(status)
+				this->nCells = attr;
+
+				status = readCheckpointAttribute(file, "nfaces", &attr);
+				HARD_CHECK_ECODE(status)
+				this->nFaces = attr;
+
+				status = readCheckpointAttribute(file, "nvertices", &attr);
+				HARD_CHECK_ECODE(status)
+				this->nVertices = attr;
+
+				status = readCheckpointAttribute(file, "nboundaries", &attr);
+				HARD_CHECK_ECODE(status)
+				this->nBoundaries = attr;
+
+				status = readCheckpointAttribute(file, "nregions", &attr);
+				HARD_CHECK_ECODE(status)
+				this->nRegions = attr;
+
+				status = readCheckpointAttribute(file, "maxfaces", &attr);
+				HARD_CHECK_ECODE(status)
+				this->nMaxFaces = attr;
+
+				// Only record reads of the mesh data
+				file.resetStatistics();
+
+				int rank = comm.rank;
+				std::vector<I> counts;
+
+				// === Cells ===
+				status = readCheckpointBlock(file, rank, nRanks, "ncells", "/cell", "label", 1, this->cellLabel);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "ncells", "/cell", "center", 3, this->cellCenter);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "ncells", "/cell", "vol", 1, this->cellVolume);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nownedcells", "/cell", "nfaces", 1, counts);
+				HARD_CHECK_ECODE(status)
+				buildCheckpointCSR(counts, this->cellFaceXAdj);
+				status = readCheckpointBlock(file, rank, nRanks, "ncellfaces", "/cell", "cface", 1, this->cellFaceAdj);
+				HARD_CHECK_ECODE(status)
+
+				this->nOwnedCells = I(counts.size());
+
+				// === Faces ===
+				status = readCheckpointBlock(file, rank, nRanks, "nfaces", "/face", "label", 1, this->faceLabel);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nfaces", "/face", "cell1", 1, this->faceCell1);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nfaces", "/face", "cell2", 1, this->faceCell2);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nfaces", "/face", "isbnd", 1, this->faceIsBoundary);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nfaces", "/face", "bnd", 1, this->faceBoundary);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nfaces", "/face", "lambda", 1, this->faceLambda);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nfaces", "/face", "area", 1, this->faceArea);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nfaces", "/face", "center", 3, this->faceCenter);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nfaces", "/face", "norm", 3, this->faceNormal);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nfaces", "/face", "nvertices", 1, counts);
+				HARD_CHECK_ECODE(status)
+				buildCheckpointCSR(counts, this->faceVertexXAdj);
+				status = readCheckpointBlock(file, rank, nRanks, "nfacevertices", "/face", "vertices", 1, this->faceVertexAdj);
+				HARD_CHECK_ECODE(status)
+
+				// === Boundaries ===
+				status = readCheckpointBlock(file, rank, nRanks, "nboundaries", "/boundary", "label", 1, this->boundaryLabel);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nboundaries", "/boundary", "face", 1, this->boundaryFace);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nboundaries", "/boundary", "region", 1, this->boundaryRegion);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nboundaries", "/boundary", "distance", 1, this->boundaryDistance);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nboundaries", "/boundary", "nvertices", 1, counts);
+				HARD_CHECK_ECODE(status)
+				buildCheckpointCSR(counts, this->boundaryVertexXAdj);
+				status = readCheckpointBlock(file, rank, nRanks, "nboundaryvertices", "/boundary", "vertices", 1, this->boundaryVertexAdj);
+				HARD_CHECK_ECODE(status)
+
+				// === Vertices ===
+				status = readCheckpointBlock(file, rank, nRanks, "nvertices", "/vert", "label", 1, this->vertexLabel);
+				HARD_CHECK_ECODE(status)
+				status = readCheckpointBlock(file, rank, nRanks, "nvertices", "/vert", "coords", 3, this->vertexCoords);
+				HARD_CHECK_ECODE(status)
+
+				// === Regions ===
+				status = readCheckpointBlock(file, rank, nRanks, "nregions", "/region", "label", 1, this->regionLabel);
+				HARD_CHECK_ECODE(status)
+
+				this->bytesRead = file.bytesRead;
+				this->readTime = file.readTime;
+
+				// Lookups by label
+				buildCheckpointLabelMap(this->cellLabel, this->cellLabelToIndex);
+				buildCheckpointLabelMap(this->faceLabel, this->faceLabelToIndex);
+				buildCheckpointLabelMap(this->boundaryLabel, this->boundaryLabelToIndex);
+				buildCheckpointLabelMap(this->vertexLabel, this->vertexLabelToIndex);
+			}
+
+			template <class I, class T>
+			MeshSourceCheckpoint<I,T>::~MeshSourceCheckpoint()
+			{
+
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getCheckpointRankCount(std::string filePath, int * nRanks) {
+				return readCompleteCheckpointAttribute(filePath, "nranks", nRanks);
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getCheckpointMeshSize(std::string filePath, int * nCells, int * nFaces) {
+				cupcfd::error::eCodes status;
+
+				status = readCompleteCheckpointAttribute(filePath, "ncells", nCells);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				return readCompleteCheckpointAttribute(filePath, "nfaces", nFaces);
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getOwnedCellLabels(I ** labels, I * nLabels) {
+				*nLabels = this->nOwnedCells;
+				*labels = (I *) malloc(sizeof(I) * this->nOwnedCells);
+
+				for(I i = 0; i < this->nOwnedCells; i++) {
+					(*labels)[i] = this->cellLabel[i];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getReadStatistics(unsigned long long * bytesRead, double * readTime) {
+				*bytesRead = this->bytesRead;
+				*readTime = this->readTime;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::findFaceVertices(I label, const I ** vertices, I * nVertices) {
+				auto iter = this->faceLabelToIndex.find(label);
+				if(iter != this->faceLabelToIndex.end()) {
+					*vertices = this->faceVertexAdj.data() + this->faceVertexXAdj[iter->second];
+					*nVertices = this->faceVertexXAdj[iter->second + 1] - this->faceVertexXAdj[iter->second];
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				iter = this->boundaryLabelToIndex.find(label);
+				if(iter != this->boundaryLabelToIndex.end()) {
+					*vertices = this->boundaryVertexAdj.data() + this->boundaryVertexXAdj[iter->second];
+					*nVertices = this->boundaryVertexXAdj[iter->second + 1] - this->boundaryVertexXAdj[iter->second];
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				return cupcfd::error::E_MESH_INVALID_FACE_LABEL;
+			}
+
+			// === Labels ===
+			// The indexes are positions in the data held by this process
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getCellLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+				if(nLabels != nIndexes) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				for(I i = 0; i < nIndexes; i++) {
+					if(indexes[i] < 0 || indexes[i] >= I(this->cellLabel.size())) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					labels[i] = this->cellLabel[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getFaceLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+				if(nLabels != nIndexes) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				for(I i = 0; i < nIndexes; i++) {
+					if(indexes[i] < 0 || indexes[i] >= I(this->faceLabel.size())) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					labels[i] = this->faceLabel[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getVertexLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+				if(nLabels != nIndexes) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				for(I i = 0; i < nIndexes; i++) {
+					if(indexes[i] < 0 || indexes[i] >= I(this->vertexLabel.size())) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					labels[i] = this->vertexLabel[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getBoundaryLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+				if(nLabels != nIndexes) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				for(I i = 0; i < nIndexes; i++) {
+					if(indexes[i] < 0 || indexes[i] >= I(this->boundaryLabel.size())) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					labels[i] = this->boundaryLabel[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getRegionLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
+				if(nLabels != nIndexes) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				for(I i = 0; i < nIndexes; i++) {
+					if(indexes[i] < 0 || indexes[i] >= I(this->regionLabel.size())) {
+						return cupcfd::error::E_INVALID_INDEX;
+					}
+					labels[i] = this->regionLabel[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// === Counts ===
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getCellCount(I * cellCount) {
+				*cellCount = this->nCells;
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getFaceCount(I * faceCount) {
+				*faceCount = this->nFaces;
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getBoundaryCount(I * boundaryCount) {
+				*boundaryCount = this->nBoundaries;
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getRegionCount(I * regionCount) {
+				*regionCount = this->nRegions;
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getVertexCount(I * vertexCount) {
+				*vertexCount = this->nVertices;
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getMaxFaceCount(I * maxFaceCount) {
+				*maxFaceCount = this->nMaxFaces;
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getMaxVertexCount(I * maxVertexCount) {
+				// Max vertex count per cell/boundary currently always hardcoded at 4
+				*maxVertexCount = 4;
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// === Cells ===
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getCellNFaces(I * nFaces, I nNFaces, I * cellLabels, I nCellLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nNFaces != nCellLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->cellLabelToIndex, cellLabels, nCellLabels, indexes, cupcfd::error::E_MESH_INVALID_CELL_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nCellLabels; i++) {
+					// Faces are only stored for the owned cells
+					if(indexes[i] >= this->nOwnedCells) {
+						return cupcfd::error::E_MESH_INVALID_CELL_LABEL;
+					}
+					nFaces[i] = this->cellFaceXAdj[indexes[i] + 1] - this->cellFaceXAdj[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getCellVolume(T * cellVol, I nCellVol, I * cellLabels, I nCellLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nCellVol != nCellLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->cellLabelToIndex, cellLabels, nCellLabels, indexes, cupcfd::error::E_MESH_INVALID_CELL_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nCellLabels; i++) {
+					cellVol[i] = this->cellVolume[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getCellCenter(euc::EuclideanPoint<T,3> * cellCenter, I nCellCenter, I * cellLabels, I nCellLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nCellCenter != nCellLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->cellLabelToIndex, cellLabels, nCellLabels, indexes, cupcfd::error::E_MESH_INVALID_CELL_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nCellLabels; i++) {
+					cellCenter[i].cmp[0] = this->cellCenter[indexes[i] * 3];
+					cellCenter[i].cmp[1] = this->cellCenter[indexes[i] * 3 + 1];
+					cellCenter[i].cmp[2] = this->cellCenter[indexes[i] * 3 + 2];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getCellFaceLabels(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData, I * cellLabels, I nCellLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nCsrIndices != (nCellLabels + 1)) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->cellLabelToIndex, cellLabels, nCellLabels, indexes, cupcfd::error::E_MESH_INVALID_CELL_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				csrIndices[0] = 0;
+				for(I i = 0; i < nCellLabels; i++) {
+					if(indexes[i] >= this->nOwnedCells) {
+						return cupcfd::error::E_MESH_INVALID_CELL_LABEL;
+					}
+
+					I start = this->cellFaceXAdj[indexes[i]];
+					I n = this->cellFaceXAdj[indexes[i] + 1] - start;
+
+					if(csrIndices[i] + n > nCsrData) {
+						return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+					}
+
+					for(I j = 0; j < n; j++) {
+						csrData[csrIndices[i] + j] = this->cellFaceAdj[start + j];
+					}
+					csrIndices[i + 1] = csrIndices[i] + n;
+				}
+
+				if(csrIndices[nCellLabels] != nCsrData) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// === Faces ===
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getFaceIsBoundary(bool * isBoundary, I nIsBoundary, I * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nIsBoundary != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->faceLabelToIndex, faceLabels, nFaceLabels, indexes, cupcfd::error::E_MESH_INVALID_FACE_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					isBoundary[i] = (this->faceIsBoundary[indexes[i]] != 0);
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getFaceNVertices(I * nVertices, I nNVertices, I * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nNVertices != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					const I * vertices;
+					status = this->findFaceVertices(faceLabels[i], &vertices, nVertices + i);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getFaceBoundaryLabels(I * faceBoundaryLabels, I nFaceBoundaryLabels, I * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nFaceBoundaryLabels != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->faceLabelToIndex, faceLabels, nFaceLabels, indexes, cupcfd::error::E_MESH_INVALID_FACE_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					faceBoundaryLabels[i] = this->faceBoundary[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getFaceCell1Labels(I * faceCell1Labels, I nFaceCell1Labels, I * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nFaceCell1Labels != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->faceLabelToIndex, faceLabels, nFaceLabels, indexes, cupcfd::error::E_MESH_INVALID_FACE_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					faceCell1Labels[i] = this->faceCell1[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getFaceCell2Labels(I * faceCell2Labels, I nFaceCell2Labels, I * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nFaceCell2Labels != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->faceLabelToIndex, faceLabels, nFaceLabels, indexes, cupcfd::error::E_MESH_INVALID_FACE_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					faceCell2Labels[i] = this->faceCell2[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getFaceLambda(T * faceLambda, I nFaceLambda, I * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nFaceLambda != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->faceLabelToIndex, faceLabels, nFaceLabels, indexes, cupcfd::error::E_MESH_INVALID_FACE_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					faceLambda[i] = this->faceLambda[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getFaceArea(T * faceArea, I nFaceArea, I * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nFaceArea != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->faceLabelToIndex, faceLabels, nFaceLabels, indexes, cupcfd::error::E_MESH_INVALID_FACE_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					faceArea[i] = this->faceArea[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getFaceNormal(euc::EuclideanVector<T,3> * faceNormal, I nFaceNormal, I * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nFaceNormal != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->faceLabelToIndex, faceLabels, nFaceLabels, indexes, cupcfd::error::E_MESH_INVALID_FACE_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					faceNormal[i].cmp[0] = this->faceNormal[indexes[i] * 3];
+					faceNormal[i].cmp[1] = this->faceNormal[indexes[i] * 3 + 1];
+					faceNormal[i].cmp[2] = this->faceNormal[indexes[i] * 3 + 2];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getFaceCenter(euc::EuclideanPoint<T,3> * faceCenter, I nFaceCenter, I * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nFaceCenter != nFaceLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->faceLabelToIndex, faceLabels, nFaceLabels, indexes, cupcfd::error::E_MESH_INVALID_FACE_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nFaceLabels; i++) {
+					faceCenter[i].cmp[0] = this->faceCenter[indexes[i] * 3];
+					faceCenter[i].cmp[1] = this->faceCenter[indexes[i] * 3 + 1];
+					faceCenter[i].cmp[2] = this->faceCenter[indexes[i] * 3 + 2];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getFaceVerticesLabelsCSR(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData, I * faceLabels, I nFaceLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nCsrIndices != (nFaceLabels + 1)) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				csrIndices[0] = 0;
+				for(I i = 0; i < nFaceLabels; i++) {
+					const I * vertices;
+					I n;
+
+					status = this->findFaceVertices(faceLabels[i], &vertices, &n);
+					if(status != cupcfd::error::E_SUCCESS) {
+						return status;
+					}
+
+					if(csrIndices[i] + n > nCsrData) {
+						return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+					}
+
+					for(I j = 0; j < n; j++) {
+						csrData[csrIndices[i] + j] = vertices[j];
+					}
+					csrIndices[i + 1] = csrIndices[i] + n;
+				}
+
+				if(csrIndices[nFaceLabels] != nCsrData) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// === Vertices ===
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getVertexCoords(euc::EuclideanPoint<T,3> * vertCoords, I nVertCoords, I * vertexLabels, I nVertexLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nVertCoords != nVertexLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->vertexLabelToIndex, vertexLabels, nVertexLabels, indexes, cupcfd::error::E_MESH_INVALID_VERTEX_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nVertexLabels; i++) {
+					vertCoords[i].cmp[0] = this->vertexCoords[indexes[i] * 3];
+					vertCoords[i].cmp[1] = this->vertexCoords[indexes[i] * 3 + 1];
+					vertCoords[i].cmp[2] = this->vertexCoords[indexes[i] * 3 + 2];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// === Boundaries ===
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getBoundaryFaceLabels(I * boundaryFaceLabels, I nBoundaryFaceLabels, I * boundaryLabels, I nBoundaryLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nBoundaryFaceLabels != nBoundaryLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->boundaryLabelToIndex, boundaryLabels, nBoundaryLabels, indexes, cupcfd::error::E_MESH_INVALID_BOUNDARY_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nBoundaryLabels; i++) {
+					boundaryFaceLabels[i] = this->boundaryFace[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getBoundaryNVertices(I * nVertices, I nNVertices, I * boundaryLabels, I nBoundaryLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nNVertices != nBoundaryLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->boundaryLabelToIndex, boundaryLabels, nBoundaryLabels, indexes, cupcfd::error::E_MESH_INVALID_BOUNDARY_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nBoundaryLabels; i++) {
+					nVertices[i] = this->boundaryVertexXAdj[indexes[i] + 1] - this->boundaryVertexXAdj[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getBoundaryRegionLabels(I * boundaryRegionLabels, I nBoundaryRegionLabels, I * boundaryLabels, I nBoundaryLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nBoundaryRegionLabels != nBoundaryLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->boundaryLabelToIndex, boundaryLabels, nBoundaryLabels, indexes, cupcfd::error::E_MESH_INVALID_BOUNDARY_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nBoundaryLabels; i++) {
+					boundaryRegionLabels[i] = this->boundaryRegion[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getBoundaryVerticesLabelsCSR(I * csrIndices, I nCsrIndices, I * csrData, I nCsrData, I * boundaryLabels, I nBoundaryLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nCsrIndices != (nBoundaryLabels + 1)) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->boundaryLabelToIndex, boundaryLabels, nBoundaryLabels, indexes, cupcfd::error::E_MESH_INVALID_BOUNDARY_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				csrIndices[0] = 0;
+				for(I i = 0; i < nBoundaryLabels; i++) {
+					I start = this->boundaryVertexXAdj[indexes[i]];
+					I n = this->boundaryVertexXAdj[indexes[i] + 1] - start;
+
+					if(csrIndices[i] + n > nCsrData) {
+						return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+					}
+
+					for(I j = 0; j < n; j++) {
+						csrData[csrIndices[i] + j] = this->boundaryVertexAdj[start + j];
+					}
+					csrIndices[i + 1] = csrIndices[i] + n;
+				}
+
+				if(csrIndices[nBoundaryLabels] != nCsrData) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getBoundaryDistance(T * boundaryDistance, I nBoundaryDistance, I * boundaryLabels, I nBoundaryLabels) {
+				cupcfd::error::eCodes status;
+
+				if(nBoundaryDistance != nBoundaryLabels) {
+					return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+				}
+
+				std::vector<I> indexes;
+				status = findCheckpointIndexes(this->boundaryLabelToIndex, boundaryLabels, nBoundaryLabels, indexes, cupcfd::error::E_MESH_INVALID_BOUNDARY_LABEL);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				for(I i = 0; i < nBoundaryLabels; i++) {
+					boundaryDistance[i] = this->boundaryDistance[indexes[i]];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// === Regions ===
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceCheckpoint<I,T>::getRegionName(std::string * names __attribute__((unused)), I nNames __attribute__((unused)), I * regionLabels __attribute__((unused)), I nRegionLabels __attribute__((unused))) {
+				// Region names are not stored in the checkpoint
+				return cupcfd::error::E_NOT_IMPLEMENTED;
+			}
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::geometry::mesh::MeshSourceCheckpoint<int,float>;
+template class cupcfd::geometry::mesh::MeshSourceCheckpoint<int,double>;
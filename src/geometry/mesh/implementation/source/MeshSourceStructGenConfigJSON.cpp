@@ -247,6 +247,46 @@ namespace cupcfd
 				return cupcfd::error::E_CONFIG_INVALID_VALUE;
 			}
 
+			template <class I, class T>
+			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T>::getMeshBlockDecomposition(bool * enabled, I * blockX, I * blockY, I * blockZ) {
+				const Json::Value dataSourceType = this->configData["BlockDecomposition"];
+
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+
+				if(dataSourceType.isBool()) {
+					// Block counts are chosen automatically
+					*enabled = dataSourceType.asBool();
+					*blockX = 0;
+					*blockY = 0;
+					*blockZ = 0;
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				if(dataSourceType.isObject()) {
+					const Json::Value countX = dataSourceType["BlockX"];
+					const Json::Value countY = dataSourceType["BlockY"];
+					const Json::Value countZ = dataSourceType["BlockZ"];
+
+					if(!countX.isIntegral() || !countY.isIntegral() || !countZ.isIntegral() ||
+					   countX.asLargestInt() < 1 || countY.asLargestInt() < 1 || countZ.asLargestInt() < 1) {
+						return cupcfd::error::E_CONFIG_INVALID_VALUE;
+					}
+
+					*enabled = true;
+					*blockX = I(countX.asLargestInt());
+					*blockY = I(countY.asLargestInt());
+					*blockZ = I(countZ.asLargestInt());
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
 			template <class I, class T>
 			cupcfd::error::eCodes MeshSourceStructGenConfigJSON<I,T>::buildMeshSourceConfig(MeshSourceConfig<I,T,I> ** meshSourceConfig) {
 				cupcfd::error::eCodes status;
@@ -280,7 +320,24 @@ namespace cupcfd
 				status = this->getMeshSpatialZMax(&sMaxZ);
 				CHECK_ECODE(status)
 
-				*meshSourceConfig = new MeshSourceStructGenConfig<I,T>(cellX, cellY, cellZ, sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ);
+				// Optional - default to assigning the cells with the partitioner
+				bool blockDecomposition;
+				I blockX, blockY, blockZ;
+				status = this->getMeshBlockDecomposition(&blockDecomposition, &blockX, &blockY, &blockZ);
+				if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+					blockDecomposition = false;
+				}
+				else {
+					CHECK_ECODE(status)
+				}
+
+				MeshSourceStructGenConfig<I,T> * structGenConfig = new MeshSourceStructGenConfig<I,T>(cellX, cellY, cellZ, sMinX, sMaxX, sMinY, sMaxY, sMinZ, sMaxZ);
+
+				if(blockDecomposition) {
+					structGenConfig->setBlockDecomposition(blockX, blockY, blockZ);
+				}
+
+				*meshSourceConfig = structGenConfig;
 
 				return cupcfd::error::E_SUCCESS;
 			}
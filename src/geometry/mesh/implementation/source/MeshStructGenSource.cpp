@@ -39,7 +39,11 @@ namespace cupcfd
 			 sMinZ(sMinZ),
 			 sMaxX(sMaxX),
 			 sMaxY(sMaxY),
-			 sMaxZ(sMaxZ)
+			 sMaxZ(sMaxZ),
+			 blockDecomposition(false),
+			 pX(0),
+			 pY(0),
+			 pZ(0)
 			{
 				// Compute Spatial Division
 				this->dSx = (this->sMaxX - this->sMinX) / T(this->nX);
@@ -97,8 +101,188 @@ namespace cupcfd
 			}
 
 
+			template <class I, class T>
+			void MeshStructGenSource<I,T>::setBlockDecomposition(I pX, I pY, I pZ) {
+				this->blockDecomposition = true;
+				this->pX = pX;
+				this->pY = pY;
+				this->pZ = pZ;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshStructGenSource<I,T>::getBlockGrid(I nRanks, I * pX, I * pY, I * pZ) {
+				if(this->pX > 0 || this->pY > 0 || this->pZ > 0) {
+					// Use the set block counts, as long as there is one block per process and no block is empty
+					if((this->pX * this->pY * this->pZ) != nRanks ||
+					   this->pX > this->nX || this->pY > this->nY || this->pZ > this->nZ) {
+						return cupcfd::error::E_CONFIG_INVALID_VALUE;
+					}
+
+					*pX = this->pX;
+					*pY = this->pY;
+					*pZ = this->pZ;
+
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Try every factorisation of nRanks into three block counts, and keep the one with the fewest
+				// faces between blocks (i.e. the smallest halo).
+				bool found = false;
+				long long bestCut = 0;
+
+				for(I x = 1; x <= nRanks && x <= this->nX; x++) {
+					if(nRanks % x != 0) {
+						continue;
+					}
+
+					for(I y = 1; y <= (nRanks / x) && y <= this->nY; y++) {
+						if((nRanks / x) % y != 0) {
+							continue;
+						}
+
+						I z = nRanks / (x * y);
+						if(z > this->nZ) {
+							continue;
+						}
+
+						long long cut = ((long long) this->nY) * this->nZ * (x - 1) +
+										((long long) this->nX) * this->nZ * (y - 1) +
+										((long long) this->nX) * this->nY * (z - 1);
+
+						if(!found || cut < bestCut) {
+							found = true;
+							bestCut = cut;
+							*pX = x;
+							*pY = y;
+							*pZ = z;
+						}
+					}
+				}
+
+				if(!found) {
+					return cupcfd::error::E_CONFIG_INVALID_VALUE;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			void MeshStructGenSource<I,T>::getBlockRange(I block, I nBlocks, I nCells, I * start, I * end) {
+				I base = nCells / nBlocks;
+				I r = nCells % nBlocks;
+
+				*start = (block * base) + ((block < r) ? block : r);
+				*end = *start + base + ((block < r) ? 1 : 0);
+			}
+
 			// === Overloaded Inherited Virtual Methods ===
 
+			template <class I, class T>
+			cupcfd::error::eCodes MeshStructGenSource<I,T>::buildDistributedAdjacencyList(cupcfd::data_structures::DistributedAdjacencyList<I,I>& graph,
+																						 I * cellLabels, I nCellLabels) {
+				cupcfd::error::eCodes status;
+
+				graph.reset();
+
+				if(nCellLabels > 0) {
+					// Add the cells in sorted order, as the generic method does
+					I * sortedCellLabels = (I *) malloc(sizeof(I) * nCellLabels);
+					status = cupcfd::utility::drivers::merge_sort(cellLabels, sortedCellLabels, nCellLabels);
+					CHECK_ECODE(status)
+
+					for(I i = 0; i < nCellLabels; i++) {
+						status = graph.addLocalNode(sortedCellLabels[i]);
+						CHECK_ECODE(status)
+					}
+
+					// The neighbours of a cell are the cells either side of it in each dimension, visited in the same
+					// order as the faces of the cell (low/high YZ, XZ, then XY face). Any neighbour that was not added as a
+					// local node is added as a ghost node.
+					for(I i = 0; i < nCellLabels; i++) {
+						I label = sortedCellLabels[i];
+						I xCoord = calculateXCoord(label, 0, this->nX - 1);
+						I yCoord = calculateYCoord(label, 0, this->nX - 1, 0, this->nY - 1);
+						I zCoord = calculateZCoord(label, 0, this->nX - 1, 0, this->nY - 1, 0, this->nZ - 1);
+
+						I neighbours[6];
+						I nNeighbours = 0;
+
+						if(xCoord > 0) {
+							neighbours[nNeighbours++] = label - 1;
+						}
+						if(xCoord < this->nX - 1) {
+							neighbours[nNeighbours++] = label + 1;
+						}
+						if(yCoord > 0) {
+							neighbours[nNeighbours++] = label - this->nX;
+						}
+						if(yCoord < this->nY - 1) {
+							neighbours[nNeighbours++] = label + this->nX;
+						}
+						if(zCoord > 0) {
+							neighbours[nNeighbours++] = label - (this->nX * this->nY);
+						}
+						if(zCoord < this->nZ - 1) {
+							neighbours[nNeighbours++] = label + (this->nX * this->nY);
+						}
+
+						for(I j = 0; j < nNeighbours; j++) {
+							status = graph.addUndirectedEdge(label, neighbours[j]);
+							if (status != cupcfd::error::E_SUCCESS && status != cupcfd::error::E_ADJACENCY_LIST_EDGE_EXISTS) {
+								CHECK_ECODE(status)
+							}
+						}
+					}
+
+					free(sortedCellLabels);
+				}
+
+				status = graph.finalize();
+				CHECK_ECODE(status)
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes MeshStructGenSource<I,T>::getCellDecomposition(I ** cellLabels, I * nCellLabels, cupcfd::comm::Communicator& comm) {
+				cupcfd::error::eCodes status;
+
+				if(!this->blockDecomposition) {
+					return cupcfd::error::E_NOT_IMPLEMENTED;
+				}
+
+				I gridX, gridY, gridZ;
+				status = this->getBlockGrid(comm.size, &gridX, &gridY, &gridZ);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				// Blocks are numbered by rank in the same X, Y, Z order as the cells
+				I blockX = comm.rank % gridX;
+				I blockY = (comm.rank / gridX) % gridY;
+				I blockZ = comm.rank / (gridX * gridY);
+
+				I xStart, xEnd, yStart, yEnd, zStart, zEnd;
+				this->getBlockRange(blockX, gridX, this->nX, &xStart, &xEnd);
+				this->getBlockRange(blockY, gridY, this->nY, &yStart, &yEnd);
+				this->getBlockRange(blockZ, gridZ, this->nZ, &zStart, &zEnd);
+
+				*nCellLabels = (xEnd - xStart) * (yEnd - yStart) * (zEnd - zStart);
+				*cellLabels = (I *) malloc(sizeof(I) * (*nCellLabels));
+
+				I ptr = 0;
+				for(I z = zStart; z < zEnd; z++) {
+					for(I y = yStart; y < yEnd; y++) {
+						for(I x = xStart; x < xEnd; x++) {
+							(*cellLabels)[ptr] = calculateLabel(x, y, z, 0, this->nX - 1, 0, this->nY - 1, 0);
+							ptr = ptr + 1;
+						}
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
 			template <class I, class T>
 			cupcfd::error::eCodes MeshStructGenSource<I,T>::getCellLabels(I * labels, I nLabels, I * indexes, I nIndexes) {
 				if (nLabels != nIndexes) {
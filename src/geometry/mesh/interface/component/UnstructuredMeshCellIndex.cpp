@@ -0,0 +1,213 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the UnstructuredMeshCellIndex Class
+ */
+
+#include "UnstructuredMeshCellIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T>
+			UnstructuredMeshCellIndex<I,T>::UnstructuredMeshCellIndex()
+			: cellBounds(nullptr),
+			  nCellBounds(0),
+			  binXAdj(nullptr),
+			  nBinXAdj(0),
+			  binCells(nullptr),
+			  nBinCells(0)
+			{
+				this->reset();
+			}
+
+			template <class I, class T>
+			UnstructuredMeshCellIndex<I,T>::~UnstructuredMeshCellIndex() {
+				this->reset();
+			}
+
+			template <class I, class T>
+			void UnstructuredMeshCellIndex<I,T>::reset() {
+				if(this->cellBounds != nullptr) {
+					free(this->cellBounds);
+				}
+
+				if(this->binXAdj != nullptr) {
+					free(this->binXAdj);
+				}
+
+				if(this->binCells != nullptr) {
+					free(this->binCells);
+				}
+
+				this->cellBounds = nullptr;
+				this->nCellBounds = 0;
+				this->binXAdj = nullptr;
+				this->nBinXAdj = 0;
+				this->binCells = nullptr;
+				this->nBinCells = 0;
+
+				this->nCells = 0;
+
+				for(int d = 0; d < 3; d++) {
+					this->lower[d] = T(0);
+					this->upper[d] = T(0);
+					this->nBins[d] = 1;
+					this->binScale[d] = T(0);
+				}
+
+				this->built = false;
+			}
+
+			template <class I, class T>
+			cupcfd::error::eCodes UnstructuredMeshCellIndex<I,T>::build(const T * bounds, I nBounds) {
+				if((nBounds % 6) != 0) {
+					return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+				}
+
+				this->reset();
+
+				this->nCells = nBounds / 6;
+
+				// (1) Store a copy of the cell bounds for the bounding box tests
+				this->nCellBounds = nBounds;
+				this->cellBounds = (T *) malloc(sizeof(T) * (nBounds > 0 ? nBounds : 1));
+				if(nBounds > 0) {
+					std::memcpy(this->cellBounds, bounds, sizeof(T) * nBounds);
+				}
+
+				// (2) Find the bounds of all cells
+				if(this->nCells > 0) {
+					for(int d = 0; d < 3; d++) {
+						this->lower[d] = bounds[d];
+						this->upper[d] = bounds[d + 3];
+					}
+				}
+
+				for(I i = 1; i < this->nCells; i++) {
+					for(int d = 0; d < 3; d++) {
+						this->lower[d] = std::min(this->lower[d], bounds[(i * 6) + d]);
+						this->upper[d] = std::max(this->upper[d], bounds[(i * 6) + d + 3]);
+					}
+				}
+
+				// (3) Size the bins such that there is roughly one cell per bin.
+				// Dimensions with no extent (e.g. a 2D slab of cells) only use a single bin.
+				T extent[3];
+				T volume = T(1);
+				int nDims = 0;
+
+				for(int d = 0; d < 3; d++) {
+					extent[d] = this->upper[d] - this->lower[d];
+					if(extent[d] > T(0)) {
+						volume = volume * extent[d];
+						nDims++;
+					}
+				}
+
+				T binWidth = T(0);
+				if(nDims > 0 && this->nCells > 0) {
+					binWidth = std::pow(volume / T(this->nCells), T(1) / T(nDims));
+				}
+
+				I nBinsTotal = 1;
+				for(int d = 0; d < 3; d++) {
+					if(extent[d] > T(0) && binWidth > T(0)) {
+						T nDimBins = std::ceil(extent[d] / binWidth);
+						this->nBins[d] = (nDimBins > T(this->nCells)) ? this->nCells : std::max((I) nDimBins, (I) 1);
+						this->binScale[d] = T(this->nBins[d]) / extent[d];
+					}
+					else {
+						this->nBins[d] = 1;
+						this->binScale[d] = T(0);
+					}
+
+					nBinsTotal = nBinsTotal * this->nBins[d];
+				}
+
+				// (4) Count the number of cells that overlap each bin
+				this->nBinXAdj = nBinsTotal + 1;
+				this->binXAdj = (I *) malloc(sizeof(I) * this->nBinXAdj);
+
+				for(I i = 0; i < this->nBinXAdj; i++) {
+					this->binXAdj[i] = 0;
+				}
+
+				I binMin[3];
+				I binMax[3];
+
+				for(I i = 0; i < this->nCells; i++) {
+					for(int d = 0; d < 3; d++) {
+						binMin[d] = this->getBinCoord(d, bounds[(i * 6) + d]);
+						binMax[d] = this->getBinCoord(d, bounds[(i * 6) + d + 3]);
+					}
+
+					for(I z = binMin[2]; z <= binMax[2]; z++) {
+						for(I y = binMin[1]; y <= binMax[1]; y++) {
+							for(I x = binMin[0]; x <= binMax[0]; x++) {
+								I bin = (((z * this->nBins[1]) + y) * this->nBins[0]) + x;
+								this->binXAdj[bin + 1] += 1;
+							}
+						}
+					}
+				}
+
+				for(I i = 0; i < nBinsTotal; i++) {
+					this->binXAdj[i + 1] += this->binXAdj[i];
+				}
+
+				// (5) Store the cell IDs in each bin. Cells are visited in ascending order,
+				// so the IDs within each bin are also in ascending order.
+				this->nBinCells = this->binXAdj[nBinsTotal];
+				this->binCells = (I *) malloc(sizeof(I) * (this->nBinCells > 0 ? this->nBinCells : 1));
+
+				I * binPtr = (I *) malloc(sizeof(I) * nBinsTotal);
+				std::memcpy(binPtr, this->binXAdj, sizeof(I) * nBinsTotal);
+
+				for(I i = 0; i < this->nCells; i++) {
+					for(int d = 0; d < 3; d++) {
+						binMin[d] = this->getBinCoord(d, bounds[(i * 6) + d]);
+						binMax[d] = this->getBinCoord(d, bounds[(i * 6) + d + 3]);
+					}
+
+					for(I z = binMin[2]; z <= binMax[2]; z++) {
+						for(I y = binMin[1]; y <= binMax[1]; y++) {
+							for(I x = binMin[0]; x <= binMax[0]; x++) {
+								I bin = (((z * this->nBins[1]) + y) * this->nBins[0]) + x;
+								this->binCells[binPtr[bin]] = i;
+								binPtr[bin] += 1;
+							}
+						}
+					}
+				}
+
+				free(binPtr);
+
+				this->built = true;
+
+				return cupcfd::error::E_SUCCESS;
+			}
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::geometry::mesh::UnstructuredMeshCellIndex<int, float>;
+template class cupcfd::geometry::mesh::UnstructuredMeshCellIndex<int, double>;
+
+template class cupcfd::geometry::mesh::UnstructuredMeshCellIndex<long, float>;
+template class cupcfd::geometry::mesh::UnstructuredMeshCellIndex<long, double>;
@@ -0,0 +1,74 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the UnstructuredMeshFaceColouring Class
+ */
+
+#include "UnstructuredMeshFaceColouring.h"
+
+#include <cstdlib>
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I>
+			UnstructuredMeshFaceColouring<I>::UnstructuredMeshFaceColouring()
+			: colourXAdj(nullptr),
+			  colourFaces(nullptr)
+			{
+				this->reset();
+			}
+
+			template <class I>
+			UnstructuredMeshFaceColouring<I>::~UnstructuredMeshFaceColouring() {
+				this->reset();
+			}
+
+			template <class I>
+			void UnstructuredMeshFaceColouring<I>::reset() {
+				if(this->colourXAdj != nullptr) {
+					free(this->colourXAdj);
+				}
+
+				if(this->colourFaces != nullptr) {
+					free(this->colourFaces);
+				}
+
+				this->nColours = 0;
+				this->colourXAdj = nullptr;
+				this->nColourXAdj = 0;
+				this->colourFaces = nullptr;
+				this->nColourFaces = 0;
+
+				this->built = false;
+			}
+
+			template <class I>
+			void UnstructuredMeshFaceColouring<I>::allocate(I nFaces, I nColours) {
+				this->reset();
+
+				this->nColours = nColours;
+
+				this->nColourXAdj = nColours + 1;
+				this->colourXAdj = (I *) malloc(sizeof(I) * this->nColourXAdj);
+
+				// Always allocate at least one element so that empty meshes still have valid arrays
+				this->nColourFaces = nFaces;
+				this->colourFaces = (I *) malloc(sizeof(I) * (nFaces > 0 ? nFaces : 1));
+			}
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::geometry::mesh::UnstructuredMeshFaceColouring<int>;
+template class cupcfd::geometry::mesh::UnstructuredMeshFaceColouring<long>;
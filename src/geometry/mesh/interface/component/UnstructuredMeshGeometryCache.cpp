@@ -0,0 +1,104 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the UnstructuredMeshGeometryCache Class
+ */
+
+#include "UnstructuredMeshGeometryCache.h"
+
+#include <cstdlib>
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T>
+			UnstructuredMeshGeometryCache<I,T>::UnstructuredMeshGeometryCache()
+			: cellDiameter(nullptr),
+			  faceTriXAdj(nullptr),
+			  triVertices(nullptr),
+			  faceNormalUnit(nullptr),
+			  faceEdgeLength(nullptr)
+			{
+				this->reset();
+			}
+
+			template <class I, class T>
+			UnstructuredMeshGeometryCache<I,T>::~UnstructuredMeshGeometryCache() {
+				this->reset();
+			}
+
+			template <class I, class T>
+			void UnstructuredMeshGeometryCache<I,T>::reset() {
+				if(this->cellDiameter != nullptr) {
+					free(this->cellDiameter);
+				}
+
+				if(this->faceTriXAdj != nullptr) {
+					free(this->faceTriXAdj);
+				}
+
+				if(this->triVertices != nullptr) {
+					free(this->triVertices);
+				}
+
+				if(this->faceNormalUnit != nullptr) {
+					free(this->faceNormalUnit);
+				}
+
+				if(this->faceEdgeLength != nullptr) {
+					free(this->faceEdgeLength);
+				}
+
+				this->cellDiameter = nullptr;
+				this->nCellDiameter = 0;
+				this->faceTriXAdj = nullptr;
+				this->nFaceTriXAdj = 0;
+				this->triVertices = nullptr;
+				this->nTriVertices = 0;
+				this->faceNormalUnit = nullptr;
+				this->nFaceNormalUnit = 0;
+				this->faceEdgeLength = nullptr;
+				this->nFaceEdgeLength = 0;
+
+				this->built = false;
+			}
+
+			template <class I, class T>
+			void UnstructuredMeshGeometryCache<I,T>::allocate(I nCells, I nFaces, I nTriangles) {
+				this->reset();
+
+				// Always allocate at least one element so that empty meshes still have valid arrays
+				this->nCellDiameter = nCells;
+				this->cellDiameter = (T *) malloc(sizeof(T) * (nCells > 0 ? nCells : 1));
+
+				this->nFaceTriXAdj = nFaces + 1;
+				this->faceTriXAdj = (I *) malloc(sizeof(I) * this->nFaceTriXAdj);
+
+				this->nTriVertices = nTriangles * 9;
+				this->triVertices = (T *) malloc(sizeof(T) * (nTriangles > 0 ? this->nTriVertices : 1));
+
+				this->nFaceNormalUnit = nFaces * 3;
+				this->faceNormalUnit = (T *) malloc(sizeof(T) * (nFaces > 0 ? this->nFaceNormalUnit : 1));
+
+				this->nFaceEdgeLength = nFaces;
+				this->faceEdgeLength = (T *) malloc(sizeof(T) * (nFaces > 0 ? nFaces : 1));
+			}
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::geometry::mesh::UnstructuredMeshGeometryCache<int, float>;
+template class cupcfd::geometry::mesh::UnstructuredMeshGeometryCache<int, double>;
+
+template class cupcfd::geometry::mesh::UnstructuredMeshGeometryCache<long, float>;
+template class cupcfd::geometry::mesh::UnstructuredMeshGeometryCache<long, double>;
@@ -0,0 +1,71 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the UnstructuredMeshHaloFaces Class
+ */
+
+#include "UnstructuredMeshHaloFaces.h"
+
+#include <cstdlib>
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I>
+			UnstructuredMeshHaloFaces<I>::UnstructuredMeshHaloFaces()
+			: interiorFaces(nullptr),
+			  haloFaces(nullptr)
+			{
+				this->reset();
+			}
+
+			template <class I>
+			UnstructuredMeshHaloFaces<I>::~UnstructuredMeshHaloFaces() {
+				this->reset();
+			}
+
+			template <class I>
+			void UnstructuredMeshHaloFaces<I>::reset() {
+				if(this->interiorFaces != nullptr) {
+					free(this->interiorFaces);
+				}
+
+				if(this->haloFaces != nullptr) {
+					free(this->haloFaces);
+				}
+
+				this->interiorFaces = nullptr;
+				this->nInteriorFaces = 0;
+				this->haloFaces = nullptr;
+				this->nHaloFaces = 0;
+
+				this->built = false;
+			}
+
+			template <class I>
+			void UnstructuredMeshHaloFaces<I>::allocate(I nInteriorFaces, I nHaloFaces) {
+				this->reset();
+
+				// Always allocate at least one element so that empty lists still have valid arrays
+				this->nInteriorFaces = nInteriorFaces;
+				this->interiorFaces = (I *) malloc(sizeof(I) * (nInteriorFaces > 0 ? nInteriorFaces : 1));
+
+				this->nHaloFaces = nHaloFaces;
+				this->haloFaces = (I *) malloc(sizeof(I) * (nHaloFaces > 0 ? nHaloFaces : 1));
+			}
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::geometry::mesh::UnstructuredMeshHaloFaces<int>;
+template class cupcfd::geometry::mesh::UnstructuredMeshHaloFaces<long>;
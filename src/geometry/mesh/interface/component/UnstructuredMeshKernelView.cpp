@@ -0,0 +1,226 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the UnstructuredMeshKernelView Class
+ */
+
+#include "UnstructuredMeshKernelView.h"
+
+#include <cstdlib>
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T>
+			UnstructuredMeshKernelView<I,T>::UnstructuredMeshKernelView()
+			: faceCell1(nullptr),
+			  faceCell2(nullptr),
+			  faceBoundaryID(nullptr),
+			  faceIsBoundary(nullptr),
+			  faceLambda(nullptr),
+			  faceArea(nullptr),
+			  faceRLencos(nullptr),
+			  faceNormX(nullptr),
+			  faceNormY(nullptr),
+			  faceNormZ(nullptr),
+			  faceCenterX(nullptr),
+			  faceCenterY(nullptr),
+			  faceCenterZ(nullptr),
+			  faceXpacX(nullptr),
+			  faceXpacY(nullptr),
+			  faceXpacZ(nullptr),
+			  faceXnacX(nullptr),
+			  faceXnacY(nullptr),
+			  faceXnacZ(nullptr),
+			  cellCenterX(nullptr),
+			  cellCenterY(nullptr),
+			  cellCenterZ(nullptr),
+			  cellVolume(nullptr)
+			{
+				this->reset();
+			}
+
+			template <class I, class T>
+			UnstructuredMeshKernelView<I,T>::~UnstructuredMeshKernelView() {
+				this->reset();
+			}
+
+			template <class I, class T>
+			void UnstructuredMeshKernelView<I,T>::reset() {
+				if(this->faceCell1 != nullptr) {
+					free(this->faceCell1);
+				}
+
+				if(this->faceCell2 != nullptr) {
+					free(this->faceCell2);
+				}
+
+				if(this->faceBoundaryID != nullptr) {
+					free(this->faceBoundaryID);
+				}
+
+				if(this->faceIsBoundary != nullptr) {
+					free(this->faceIsBoundary);
+				}
+
+				if(this->faceLambda != nullptr) {
+					free(this->faceLambda);
+				}
+
+				if(this->faceArea != nullptr) {
+					free(this->faceArea);
+				}
+
+				if(this->faceRLencos != nullptr) {
+					free(this->faceRLencos);
+				}
+
+				if(this->faceNormX != nullptr) {
+					free(this->faceNormX);
+				}
+
+				if(this->faceNormY != nullptr) {
+					free(this->faceNormY);
+				}
+
+				if(this->faceNormZ != nullptr) {
+					free(this->faceNormZ);
+				}
+
+				if(this->faceCenterX != nullptr) {
+					free(this->faceCenterX);
+				}
+
+				if(this->faceCenterY != nullptr) {
+					free(this->faceCenterY);
+				}
+
+				if(this->faceCenterZ != nullptr) {
+					free(this->faceCenterZ);
+				}
+
+				if(this->faceXpacX != nullptr) {
+					free(this->faceXpacX);
+				}
+
+				if(this->faceXpacY != nullptr) {
+					free(this->faceXpacY);
+				}
+
+				if(this->faceXpacZ != nullptr) {
+					free(this->faceXpacZ);
+				}
+
+				if(this->faceXnacX != nullptr) {
+					free(this->faceXnacX);
+				}
+
+				if(this->faceXnacY != nullptr) {
+					free(this->faceXnacY);
+				}
+
+				if(this->faceXnacZ != nullptr) {
+					free(this->faceXnacZ);
+				}
+
+				if(this->cellCenterX != nullptr) {
+					free(this->cellCenterX);
+				}
+
+				if(this->cellCenterY != nullptr) {
+					free(this->cellCenterY);
+				}
+
+				if(this->cellCenterZ != nullptr) {
+					free(this->cellCenterZ);
+				}
+
+				if(this->cellVolume != nullptr) {
+					free(this->cellVolume);
+				}
+
+				this->faceCell1 = nullptr;
+				this->faceCell2 = nullptr;
+				this->faceBoundaryID = nullptr;
+				this->faceIsBoundary = nullptr;
+				this->faceLambda = nullptr;
+				this->faceArea = nullptr;
+				this->faceRLencos = nullptr;
+				this->faceNormX = nullptr;
+				this->faceNormY = nullptr;
+				this->faceNormZ = nullptr;
+				this->faceCenterX = nullptr;
+				this->faceCenterY = nullptr;
+				this->faceCenterZ = nullptr;
+				this->faceXpacX = nullptr;
+				this->faceXpacY = nullptr;
+				this->faceXpacZ = nullptr;
+				this->faceXnacX = nullptr;
+				this->faceXnacY = nullptr;
+				this->faceXnacZ = nullptr;
+				this->cellCenterX = nullptr;
+				this->cellCenterY = nullptr;
+				this->cellCenterZ = nullptr;
+				this->cellVolume = nullptr;
+
+				this->nFaces = 0;
+				this->nCells = 0;
+
+				this->built = false;
+			}
+
+			template <class I, class T>
+			void UnstructuredMeshKernelView<I,T>::allocate(I nFaces, I nCells) {
+				this->reset();
+
+				this->nFaces = nFaces;
+				this->nCells = nCells;
+
+				// Always allocate at least one element so that empty meshes still have valid arrays
+				I faceSize = (nFaces > 0 ? nFaces : 1);
+				I cellSize = (nCells > 0 ? nCells : 1);
+
+				this->faceCell1 = (I *) malloc(sizeof(I) * faceSize);
+				this->faceCell2 = (I *) malloc(sizeof(I) * faceSize);
+				this->faceBoundaryID = (I *) malloc(sizeof(I) * faceSize);
+				this->faceIsBoundary = (bool *) malloc(sizeof(bool) * faceSize);
+				this->faceLambda = (T *) malloc(sizeof(T) * faceSize);
+				this->faceArea = (T *) malloc(sizeof(T) * faceSize);
+				this->faceRLencos = (T *) malloc(sizeof(T) * faceSize);
+				this->faceNormX = (T *) malloc(sizeof(T) * faceSize);
+				this->faceNormY = (T *) malloc(sizeof(T) * faceSize);
+				this->faceNormZ = (T *) malloc(sizeof(T) * faceSize);
+				this->faceCenterX = (T *) malloc(sizeof(T) * faceSize);
+				this->faceCenterY = (T *) malloc(sizeof(T) * faceSize);
+				this->faceCenterZ = (T *) malloc(sizeof(T) * faceSize);
+				this->faceXpacX = (T *) malloc(sizeof(T) * faceSize);
+				this->faceXpacY = (T *) malloc(sizeof(T) * faceSize);
+				this->faceXpacZ = (T *) malloc(sizeof(T) * faceSize);
+				this->faceXnacX = (T *) malloc(sizeof(T) * faceSize);
+				this->faceXnacY = (T *) malloc(sizeof(T) * faceSize);
+				this->faceXnacZ = (T *) malloc(sizeof(T) * faceSize);
+
+				this->cellCenterX = (T *) malloc(sizeof(T) * cellSize);
+				this->cellCenterY = (T *) malloc(sizeof(T) * cellSize);
+				this->cellCenterZ = (T *) malloc(sizeof(T) * cellSize);
+				this->cellVolume = (T *) malloc(sizeof(T) * cellSize);
+			}
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::geometry::mesh::UnstructuredMeshKernelView<int, float>;
+template class cupcfd::geometry::mesh::UnstructuredMeshKernelView<int, double>;
+
+template class cupcfd::geometry::mesh::UnstructuredMeshKernelView<long, float>;
+template class cupcfd::geometry::mesh::UnstructuredMeshKernelView<long, double>;
@@ -0,0 +1,47 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Definitions for the UnstructuredMeshReordering Class
+ */
+
+#include "UnstructuredMeshReordering.h"
+
+namespace cupcfd
+{
+	namespace geometry
+	{
+		namespace mesh
+		{
+			template <class I, class T>
+			UnstructuredMeshReordering<I,T>::UnstructuredMeshReordering()
+			: type(MESH_REORDER_NONE)
+			{
+				this->reset();
+			}
+
+			template <class I, class T>
+			UnstructuredMeshReordering<I,T>::~UnstructuredMeshReordering() {
+
+			}
+
+			template <class I, class T>
+			void UnstructuredMeshReordering<I,T>::reset() {
+				this->applied = false;
+				this->cellBandwidthBefore = T(0);
+				this->cellBandwidthAfter = T(0);
+			}
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::geometry::mesh::UnstructuredMeshReordering<int, float>;
+template class cupcfd::geometry::mesh::UnstructuredMeshReordering<int, double>;
+template class cupcfd::geometry::mesh::UnstructuredMeshReordering<long, float>;
+template class cupcfd::geometry::mesh::UnstructuredMeshReordering<long, double>;
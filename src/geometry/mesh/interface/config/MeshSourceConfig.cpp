@@ -31,6 +31,13 @@ namespace cupcfd
 			{
 
 			}
+
+			template <class I, class T, class L>
+			cupcfd::error::eCodes MeshSourceConfig<I,T,L>::buildMeshSource(MeshSource<I,T,L> ** source,
+																		   cupcfd::comm::Communicator& comm __attribute__((unused)))
+			{
+				return this->buildMeshSource(source);
+			}
 		}
 	}
 }
@@ -14,6 +14,10 @@
 #include "HDF5Record.h"
 #include "HDF5Properties.h"
 #include <stdexcept>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <chrono>
 
 namespace cupcfd
 {
@@ -24,15 +28,51 @@ namespace cupcfd
 			HDF5Access::HDF5Access(std::string fileName, HDF5Record& record)
 			 : record(record)
 			{
-				this->fileID = 0;
-				this->groupID = 0;
-				this->datasetID = 0;
-				this->dataspaceID = 0;
-				this->memspaceID = 0;
-				this->attrID = 0;
+				this->fileID = -1;
+				this->groupID = -1;
+				this->datasetID = -1;
+				this->dataspaceID = -1;
+				this->memspaceID = -1;
+				this->attrID = -1;
 
 				this->fileName = fileName;
+				this->file = nullptr;
+
+				this->openRecord();
+			}
+
+			HDF5Access::HDF5Access(HDF5File& file, HDF5Record& record)
+			 : record(record)
+			{
+				this->fileID = -1;
+				this->groupID = -1;
+				this->datasetID = -1;
+				this->dataspaceID = -1;
+				this->memspaceID = -1;
+				this->attrID = -1;
+
+				this->fileName = file.fileName;
+				this->file = &file;
+
+				this->openRecord();
+			}
+
+			HDF5Access::~HDF5Access() {
+				cupcfd::error::eCodes status;
+
+				status = record.closeDataSpace(*this);
+				DBG_PRINT_BAD_ECODE(status)
+				status = record.closeAttribute(*this);
+				DBG_PRINT_BAD_ECODE(status)
+				status = record.closeDataSet(*this);
+				DBG_PRINT_BAD_ECODE(status)
+				status = record.closeGroup(*this);
+				DBG_PRINT_BAD_ECODE(status)
+				status = this->closeFile();
+				DBG_PRINT_BAD_ECODE(status)
+			}
 
+			void HDF5Access::openRecord() {
 				cupcfd::error::eCodes status;
 
 				status = this->openFile();
@@ -53,19 +93,6 @@ namespace cupcfd
 				HARD_CHECK_ECODE(status)
 			}
 
-			HDF5Access::~HDF5Access() {
-				cupcfd::error::eCodes status;
-
-				status = record.closeDataSpace(*this);
-				DBG_PRINT_BAD_ECODE(status)
-				status = record.closeDataSet(*this);
-				DBG_PRINT_BAD_ECODE(status)
-				status = record.closeGroup(*this);
-				DBG_PRINT_BAD_ECODE(status)
-				status = this->closeFile();
-				DBG_PRINT_BAD_ECODE(status) 
-			}
-
 			cupcfd::error::eCodes HDF5Access::openFile() {
 				cupcfd::error::eCodes status;
 				hid_t fileID;
@@ -77,7 +104,14 @@ namespace cupcfd
 					CHECK_ECODE(status)
 				}
 
-				fileID = H5Fopen(this->fileName.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+				// Reuse the already open file
+				if(this->file != nullptr) {
+					this->fileID = this->file->fileID;
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Only reads are made through this interface, so the file is opened read-only
+				fileID = H5Fopen(this->fileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
 				if(fileID < 0) {
 					throw( std::invalid_argument("HDF5Interface: openFile: HDF5 unable to open file '" + this->fileName + "'"));
 				}
@@ -92,6 +126,12 @@ namespace cupcfd
 					throw( std::invalid_argument("HDF5Interface: closeFile: Invalid fileID - must be greater than zero."));
 				}
 
+				// The file is owned by the HDF5File object, leave it open
+				if(this->file != nullptr) {
+					this->fileID = -1;
+					return cupcfd::error::E_SUCCESS;
+				}
+
 				err = H5Fclose(this->fileID);
 				this->fileID = -1;
 
@@ -104,445 +144,296 @@ namespace cupcfd
 
 			// Important ToDo: The handling of type checking for these vs the file storage type should be improved to prevent errors.
 
-			cupcfd::error::eCodes HDF5Access::readData(int * sink) {
-				hid_t err;
-
-				if(this->record.attr == false) {
-					// Begin Data Read into arrays
-					err = H5Dread(this->datasetID, H5T_NATIVE_INT, H5S_ALL,
-								  this->dataspaceID, H5P_DEFAULT, sink);
-					if (err < 0) {
-						throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-					}
-				}
-				else if(this->record. attr == true) {
-					err = H5Aread(this->attrID, H5T_NATIVE_INT, sink);
-					if (err < 0) {
-						throw(std::invalid_argument("HDF5Interface: readData: H5Aread() failed"));
-					}
+			/**
+			 * Read the selected elements of the dataset, recording the read against the open file (if any).
+			 *
+			 * @param access The access to read through
+			 * @param memType The HDF5 type of the elements of sink
+			 * @param memspaceID The memory space to read into
+			 * @param filespaceID The selection of the dataset to read
+			 * @param nElements The number of elements selected
+			 * @param sink The array to store the data in
+			 *
+			 * @tparam T The type of the elements of sink
+			 */
+			template <class T>
+			void readSelection(HDF5Access& access, hid_t memType, hid_t memspaceID, hid_t filespaceID,
+							   unsigned long long nElements, T * sink) {
+				hid_t xferID = (access.file != nullptr) ? access.file->xferID : H5P_DEFAULT;
+
+				auto t0 = std::chrono::steady_clock::now();
+
+				hid_t err = H5Dread(access.datasetID, memType, memspaceID, filespaceID, xferID, sink);
+				if (err < 0) {
+					throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
 				}
 
-				return cupcfd::error::E_SUCCESS;
+				auto t1 = std::chrono::steady_clock::now();
+
+				if(access.file != nullptr) {
+					access.file->recordRead(nElements * sizeof(T), std::chrono::duration<double>(t1 - t0).count());
+				}
 			}
 
-			cupcfd::error::eCodes HDF5Access::readData(float * sink) {
+			/**
+			 * Read the entire record (dataset or attribute).
+			 *
+			 * @param access The access to read through
+			 * @param memType The HDF5 type of the elements of sink
+			 * @param sink The array to store the data in
+			 *
+			 * @tparam T The type of the elements of sink
+			 */
+			template <class T>
+			void readAll(HDF5Access& access, hid_t memType, T * sink) {
 				hid_t err;
 
-				if(this->record.attr == false) {
+				hssize_t nElements = H5Sget_simple_extent_npoints(access.dataspaceID);
+				if (nElements < 0) {
+					throw(std::invalid_argument("HDF5Interface: readData: H5Sget_simple_extent_npoints() failed"));
+				}
+
+				if(access.record.attr == false) {
 					// Begin Data Read into arrays
-					err = H5Dread(this->datasetID, H5T_NATIVE_FLOAT, H5S_ALL,
-								  this->dataspaceID, H5P_DEFAULT, sink);
-					if (err < 0) {
-						throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-					}
+					readSelection(access, memType, H5S_ALL, access.dataspaceID, nElements, sink);
 				}
-				else if(this->record. attr == true) {
-					err = H5Aread(this->attrID, H5T_NATIVE_FLOAT, sink);
+				else if(access.record.attr == true) {
+					auto t0 = std::chrono::steady_clock::now();
+
+					err = H5Aread(access.attrID, memType, sink);
 					if (err < 0) {
 						throw(std::invalid_argument("HDF5Interface: readData: H5Aread() failed"));
 					}
-				}
-
-				return cupcfd::error::E_SUCCESS;
-			}
 
-			cupcfd::error::eCodes HDF5Access::readData(double * sink) {
-				hid_t err;
+					auto t1 = std::chrono::steady_clock::now();
 
-				if(this->record.attr == false) {
-					// Begin Data Read into arrays
-					err = H5Dread(this->datasetID, H5T_NATIVE_DOUBLE, H5S_ALL,
-								  this->dataspaceID, H5P_DEFAULT, sink);
-					if (err < 0) {
-						throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
+					if(access.file != nullptr) {
+						access.file->recordRead(nElements * sizeof(T), std::chrono::duration<double>(t1 - t0).count());
 					}
 				}
-				else if(this->record. attr == true) {
-					err = H5Aread(this->attrID, H5T_NATIVE_DOUBLE, sink);
-					if (err < 0) {
-						throw(std::invalid_argument("HDF5Interface: readData: H5Aread() failed"));
-					}
-				}
-
-				return cupcfd::error::E_SUCCESS;
 			}
 
-			cupcfd::error::eCodes HDF5Access::readData(int * sink, HDF5Properties& properties) {
+			/**
+			 * Read the data at a list of indexes of a dataset, in strictly ascending row-major order.
+			 * The indexes are coalesced into hyperslab blocks where this reduces the size of the selection.
+			 *
+			 * @param access The access to read through
+			 * @param memType The HDF5 type of the elements of sink
+			 * @param dim The dimension sizes of the dataset
+			 * @param idx The indexes in serialised form
+			 * @param nidx The number of indexes
+			 * @param sink The array to store the data in
+			 *
+			 * @tparam T The type of the elements of sink
+			 */
+			template <class T>
+			void readSortedIndexes(HDF5Access& access, hid_t memType, const std::vector<unsigned long long>& dim,
+								   const unsigned long long * idx, unsigned long long nidx, T * sink) {
 				hid_t err;
+				size_t ndim = dim.size();
 
-				if(this->record.attr == false) {
-					// Begin Data Read into arrays
-					if(properties.nidx > 0) {
-						// Indexed Read
-
-						err = H5Sselect_elements(	this->dataspaceID,
-													H5S_SELECT_SET,
-													properties.nidx,
-													&properties.idx[0]);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_elements() failed"));
-						}
-
-						// ToDo - Move this out and associate it with the properties objects?
-						hid_t memspaceID = H5Screate_simple(1,&(properties.nidx), NULL);
-						if (memspaceID < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Screate_simple() failed"));
-						}
-
-						err = H5Dread(this->datasetID, H5T_NATIVE_INT, memspaceID,
-									  this->dataspaceID, H5P_DEFAULT, sink);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-						}
-
-						err = H5Sclose(memspaceID);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sclose() failed"));
-						}
-
-						// Cleanup Indexing into Dataspace.
-						err = H5Sselect_none(this->dataspaceID);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_none() failed"));
-						}
-					}
-					else
-					{
-						// Full Read
-						err = H5Dread(this->datasetID, H5T_NATIVE_INT, H5S_ALL,
-									  this->dataspaceID, H5P_DEFAULT, sink);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-						}
-					}
-				}
-				else if(this->record. attr == true) {
-					err = H5Aread(this->attrID, H5T_NATIVE_INT, sink);
+				if(nidx == 0) {
+					// Nothing to read, but still make the read in case the transfer is collective
+					err = H5Sselect_none(access.dataspaceID);
 					if (err < 0) {
-						throw(std::invalid_argument("HDF5Interface: readData: H5Aread() failed"));
+						throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_none() failed"));
 					}
 				}
-
-				return cupcfd::error::E_SUCCESS;
-			}
-
-			cupcfd::error::eCodes HDF5Access::readData(float * sink, HDF5Properties& properties) {
-				hid_t err;
-
-				if(this->record.attr == false) {
-					// Begin Data Read into arrays
-					if(properties.nidx > 0) {
-						// Indexed Read
-
-						err = H5Sselect_elements(	this->dataspaceID,
-													H5S_SELECT_SET,
-													properties.nidx,
-													&properties.idx[0]);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_elements() failed"));
-						}
-
-						// ToDo - Move this out and associate it with the properties objects?
-						hid_t memspaceID = H5Screate_simple(1,&(properties.nidx), NULL);
-						if (memspaceID < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Screate_simple() failed"));
-						}
-
-						err = H5Dread(this->datasetID, H5T_NATIVE_FLOAT, memspaceID,
-									  this->dataspaceID, H5P_DEFAULT, sink);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-						}
-
-						err = H5Sclose(memspaceID);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sclose() failed"));
-						}
-
-						// Cleanup Indexing into Dataspace.
-						err = H5Sselect_none(this->dataspaceID);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_none() failed"));
+				else {
+					std::vector<unsigned long long> start;
+					std::vector<unsigned long long> count;
+					coalesceHyperslabBlocks(dim, idx, nidx, start, count);
+
+					size_t nBlocks = start.size() / ndim;
+
+					if(nBlocks < nidx) {
+						// Hyperslab Read
+						for(size_t b = 0; b < nBlocks; b++) {
+							err = H5Sselect_hyperslab(access.dataspaceID,
+													  (b == 0) ? H5S_SELECT_SET : H5S_SELECT_OR,
+													  &start[b * ndim], NULL, &count[b * ndim], NULL);
+							if (err < 0) {
+								throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_hyperslab() failed"));
+							}
 						}
 					}
-					else
-					{
-						// Full Read
-						err = H5Dread(this->datasetID, H5T_NATIVE_FLOAT, H5S_ALL,
-									  this->dataspaceID, H5P_DEFAULT, sink);
+					else {
+						// Nothing to coalesce, so a point selection is smaller
+						err = H5Sselect_elements(access.dataspaceID, H5S_SELECT_SET, nidx, idx);
 						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
+							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_elements() failed"));
 						}
 					}
 				}
-				else if(this->record. attr == true) {
-					err = H5Aread(this->attrID, H5T_NATIVE_FLOAT, sink);
+
+				// ToDo - Move this out and associate it with the properties objects?
+				hsize_t memSize = (nidx > 0) ? nidx : 1;
+				hid_t memspaceID = H5Screate_simple(1, &memSize, NULL);
+				if (memspaceID < 0) {
+					throw(std::invalid_argument("HDF5Interface: readData: H5Screate_simple() failed"));
+				}
+
+				if(nidx == 0) {
+					err = H5Sselect_none(memspaceID);
 					if (err < 0) {
-						throw(std::invalid_argument("HDF5Interface: readData: H5Aread() failed"));
+						throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_none() failed"));
 					}
 				}
 
-				return cupcfd::error::E_SUCCESS;
-			}
-
-			cupcfd::error::eCodes HDF5Access::readData(double * sink, HDF5Properties& properties) {
-				hid_t err;
+				readSelection(access, memType, memspaceID, access.dataspaceID, nidx, sink);
 
-				if(this->record.attr == false) {
-					// Begin Data Read into arrays
-					if(properties.nidx > 0) {
-						// Indexed Read
+				err = H5Sclose(memspaceID);
+				if (err < 0) {
+					throw(std::invalid_argument("HDF5Interface: readData: H5Sclose() failed"));
+				}
 
-						err = H5Sselect_elements(	this->dataspaceID,
-													H5S_SELECT_SET,
-													properties.nidx,
-													&properties.idx[0]);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_elements() failed"));
-						}
+				// Cleanup Indexing into Dataspace.
+				err = H5Sselect_none(access.dataspaceID);
+				if (err < 0) {
+					throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_none() failed"));
+				}
+			}
 
-						// ToDo - Move this out and associate it with the properties objects?
-						hid_t memspaceID = H5Screate_simple(1,&(properties.nidx), NULL);
-						if (memspaceID < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Screate_simple() failed"));
-						}
+			/**
+			 * Read the data of a record, restricted to the indexes of a properties object if it has any.
+			 *
+			 * @param access The access to read through
+			 * @param memType The HDF5 type of the elements of sink
+			 * @param sink The array to store the data in
+			 * @param properties The properties object for the record, specifying which indexes to load
+			 *
+			 * @tparam T The type of the elements of sink
+			 */
+			template <class T>
+			void readIndexes(HDF5Access& access, hid_t memType, T * sink, HDF5Properties& properties) {
+				if(access.record.attr == true || properties.indexed == false) {
+					// Full Read
+					readAll(access, memType, sink);
+					return;
+				}
 
-						err = H5Dread(this->datasetID, H5T_NATIVE_DOUBLE, memspaceID,
-									  this->dataspaceID, H5P_DEFAULT, sink);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-						}
+				// Indexed Read
+				const std::vector<unsigned long long>& dim = properties.dim;
+				size_t ndim = dim.size();
+				unsigned long long nidx = properties.nidx;
+				const unsigned long long * idx = properties.idx.data();
 
-						err = H5Sclose(memspaceID);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sclose() failed"));
-						}
+				// Position of each index in row-major order
+				std::vector<unsigned long long> offset(nidx);
+				bool sorted = true;
 
-						// Cleanup Indexing into Dataspace.
-						err = H5Sselect_none(this->dataspaceID);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_none() failed"));
-						}
-					}
-					else
-					{
-						// Full Read
-						err = H5Dread(this->datasetID, H5T_NATIVE_DOUBLE, H5S_ALL,
-									  this->dataspaceID, H5P_DEFAULT, sink);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-						}
+				for(unsigned long long i = 0; i < nidx; i++) {
+					unsigned long long pos = 0;
+					for(size_t d = 0; d < ndim; d++) {
+						pos = (pos * dim[d]) + idx[(i * ndim) + d];
 					}
-				}
-				else if(this->record. attr == true) {
-					err = H5Aread(this->attrID, H5T_NATIVE_DOUBLE, sink);
-					if (err < 0) {
-						throw(std::invalid_argument("HDF5Interface: readData: H5Aread() failed"));
+					offset[i] = pos;
+
+					if(i > 0 && offset[i] <= offset[i - 1]) {
+						sorted = false;
 					}
 				}
 
-				return cupcfd::error::E_SUCCESS;
-			}
-
-			cupcfd::error::eCodes HDF5Access::readData(int ** sink, HDF5Properties& properties) {
-				hid_t err;
-
-				int cap = 1;
-				for(int i = 0; i < properties.ndim; i++) {
-					cap = cap * properties.dim[i];
+				if(sorted) {
+					readSortedIndexes(access, memType, dim, idx, nidx, sink);
+					return;
 				}
 
-				*sink = (int *) malloc(sizeof(int) * cap);
-
-				if(this->record.attr == false) {
-					// Begin Data Read into arrays
-					if(properties.nidx > 0) {
-						// Indexed Read
+				// Read each distinct index once in ascending order, then place the data in the requested order
+				std::vector<std::pair<unsigned long long, unsigned long long>> order(nidx);
+				for(unsigned long long i = 0; i < nidx; i++) {
+					order[i] = std::make_pair(offset[i], i);
+				}
+				std::sort(order.begin(), order.end());
 
-						err = H5Sselect_elements(	this->dataspaceID,
-													H5S_SELECT_SET,
-													properties.nidx,
-													&properties.idx[0]);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_elements() failed"));
-						}
+				std::vector<unsigned long long> uniqueIdx;
+				std::vector<unsigned long long> uniquePos(nidx);
+				unsigned long long nUnique = 0;
 
-						// ToDo - Move this out and associate it with the properties objects?
-						hid_t memspaceID = H5Screate_simple(1,&(properties.nidx), NULL);
-						if (memspaceID < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Screate_simple() failed"));
-						}
+				for(unsigned long long i = 0; i < nidx; i++) {
+					if(i == 0 || order[i].first != order[i - 1].first) {
+						const unsigned long long * point = idx + (order[i].second * ndim);
+						uniqueIdx.insert(uniqueIdx.end(), point, point + ndim);
+						nUnique++;
+					}
 
-						err = H5Dread(this->datasetID, H5T_NATIVE_INT, memspaceID,
-									  this->dataspaceID, H5P_DEFAULT, *sink);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-						}
+					uniquePos[order[i].second] = nUnique - 1;
+				}
 
-						err = H5Sclose(memspaceID);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sclose() failed"));
-						}
+				std::vector<T> buffer(nUnique);
+				readSortedIndexes(access, memType, dim, uniqueIdx.data(), nUnique, buffer.data());
 
-						// Cleanup Indexing into Dataspace.
-						err = H5Sselect_none(this->dataspaceID);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_none() failed"));
-						}
-					}
-					else
-					{
-						// Full Read
-						err = H5Dread(this->datasetID, H5T_NATIVE_INT, H5S_ALL,
-									  this->dataspaceID, H5P_DEFAULT, *sink);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-						}
-					}
-				}
-				else if(this->record. attr == true) {
-					err = H5Aread(this->attrID, H5T_NATIVE_INT, *sink);
-					if (err < 0) {
-						throw(std::invalid_argument("HDF5Interface: readData: H5Aread() failed"));
-					}
+				for(unsigned long long i = 0; i < nidx; i++) {
+					sink[i] = buffer[uniquePos[i]];
 				}
-
-				return cupcfd::error::E_SUCCESS;
 			}
 
-			cupcfd::error::eCodes HDF5Access::readData(float ** sink, HDF5Properties& properties) {
-				hid_t err;
-
+			/**
+			 * Create an array large enough to hold the entire record, and read into it.
+			 *
+			 * @param access The access to read through
+			 * @param memType The HDF5 type of the elements of sink
+			 * @param sink A pointer to the location where the created array will be stored
+			 * @param properties The properties object for the record, specifying which indexes to load
+			 *
+			 * @tparam T The type of the elements of sink
+			 */
+			template <class T>
+			void readIndexesAlloc(HDF5Access& access, hid_t memType, T ** sink, HDF5Properties& properties) {
 				int cap = 1;
 				for(int i = 0; i < properties.ndim; i++) {
 					cap = cap * properties.dim[i];
 				}
 
-				*sink = (float *) malloc(sizeof(int) * cap);
-
-				if(this->record.attr == false) {
-					// Begin Data Read into arrays
-					if(properties.nidx > 0) {
-						// Indexed Read
-
-						err = H5Sselect_elements(	this->dataspaceID,
-													H5S_SELECT_SET,
-													properties.nidx,
-													&properties.idx[0]);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_elements() failed"));
-						}
-
-						// ToDo - Move this out and associate it with the properties objects?
-						hid_t memspaceID = H5Screate_simple(1,&(properties.nidx), NULL);
-						if (memspaceID < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Screate_simple() failed"));
-						}
-
-						err = H5Dread(this->datasetID, H5T_NATIVE_FLOAT, memspaceID,
-									  this->dataspaceID, H5P_DEFAULT, *sink);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-						}
+				*sink = (T *) malloc(sizeof(T) * cap);
 
-						err = H5Sclose(memspaceID);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sclose() failed"));
-						}
-
-						// Cleanup Indexing into Dataspace.
-						err = H5Sselect_none(this->dataspaceID);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_none() failed"));
-						}
-					}
-					else
-					{
-						// Full Read
-						err = H5Dread(this->datasetID, H5T_NATIVE_FLOAT, H5S_ALL,
-									  this->dataspaceID, H5P_DEFAULT, *sink);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-						}
-					}
-				}
-				else if(this->record. attr == true) {
-					err = H5Aread(this->attrID, H5T_NATIVE_FLOAT, *sink);
-					if (err < 0) {
-						throw(std::invalid_argument("HDF5Interface: readData: H5Aread() failed"));
-					}
-				}
+				readIndexes(access, memType, *sink, properties);
+			}
 
+			cupcfd::error::eCodes HDF5Access::readData(int * sink) {
+				readAll(*this, H5T_NATIVE_INT, sink);
 				return cupcfd::error::E_SUCCESS;
 			}
 
-			cupcfd::error::eCodes HDF5Access::readData(double ** sink, HDF5Properties& properties) {
-				hid_t err;
-
-				int cap = 1;
-				for(int i = 0; i < properties.ndim; i++) {
-					cap = cap * properties.dim[i];
-				}
-
-				*sink = (double *) malloc(sizeof(int) * cap);
+			cupcfd::error::eCodes HDF5Access::readData(float * sink) {
+				readAll(*this, H5T_NATIVE_FLOAT, sink);
+				return cupcfd::error::E_SUCCESS;
+			}
 
-				if(this->record.attr == false) {
-					// Begin Data Read into arrays
-					if(properties.nidx > 0) {
-						// Indexed Read
+			cupcfd::error::eCodes HDF5Access::readData(double * sink) {
+				readAll(*this, H5T_NATIVE_DOUBLE, sink);
+				return cupcfd::error::E_SUCCESS;
+			}
 
-						err = H5Sselect_elements(	this->dataspaceID,
-													H5S_SELECT_SET,
-													properties.nidx,
-													&properties.idx[0]);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_elements() failed"));
-						}
+			cupcfd::error::eCodes HDF5Access::readData(int * sink, HDF5Properties& properties) {
+				readIndexes(*this, H5T_NATIVE_INT, sink, properties);
+				return cupcfd::error::E_SUCCESS;
+			}
 
-						// ToDo - Move this out and associate it with the properties objects?
-						hid_t memspaceID = H5Screate_simple(1,&(properties.nidx), NULL);
-						if (memspaceID < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Screate_simple() failed"));
-						}
+			cupcfd::error::eCodes HDF5Access::readData(float * sink, HDF5Properties& properties) {
+				readIndexes(*this, H5T_NATIVE_FLOAT, sink, properties);
+				return cupcfd::error::E_SUCCESS;
+			}
 
-						err = H5Dread(this->datasetID, H5T_NATIVE_DOUBLE, memspaceID,
-									  this->dataspaceID, H5P_DEFAULT, *sink);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-						}
+			cupcfd::error::eCodes HDF5Access::readData(double * sink, HDF5Properties& properties) {
+				readIndexes(*this, H5T_NATIVE_DOUBLE, sink, properties);
+				return cupcfd::error::E_SUCCESS;
+			}
 
-						err = H5Sclose(memspaceID);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sclose() failed"));
-						}
+			cupcfd::error::eCodes HDF5Access::readData(int ** sink, HDF5Properties& properties) {
+				readIndexesAlloc(*this, H5T_NATIVE_INT, sink, properties);
+				return cupcfd::error::E_SUCCESS;
+			}
 
-						// Cleanup Indexing into Dataspace.
-						err = H5Sselect_none(this->dataspaceID);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Sselect_none() failed"));
-						}
-					}
-					else
-					{
-						// Full Read
-						err = H5Dread(this->datasetID, H5T_NATIVE_DOUBLE, H5S_ALL,
-									  this->dataspaceID, H5P_DEFAULT, *sink);
-						if (err < 0) {
-							throw(std::invalid_argument("HDF5Interface: readData: H5Dread() failed"));
-						}
-					}
-				}
-				else if(this->record. attr == true) {
-					err = H5Aread(this->attrID, H5T_NATIVE_DOUBLE, *sink);
-					if (err < 0) {
-						throw(std::invalid_argument("HDF5Interface: readData: H5Aread() failed"));
-					}
-				}
+			cupcfd::error::eCodes HDF5Access::readData(float ** sink, HDF5Properties& properties) {
+				readIndexesAlloc(*this, H5T_NATIVE_FLOAT, sink, properties);
+				return cupcfd::error::E_SUCCESS;
+			}
 
+			cupcfd::error::eCodes HDF5Access::readData(double ** sink, HDF5Properties& properties) {
+				readIndexesAlloc(*this, H5T_NATIVE_DOUBLE, sink, properties);
 				return cupcfd::error::E_SUCCESS;
 			}
 		}
 	}
 }
-
-
@@ -0,0 +1,118 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Definitions for HDF5File class.
+ */
+
+#include "HDF5File.h"
+#include <stdexcept>
+
+namespace cupcfd
+{
+	namespace io
+	{
+		namespace hdf5
+		{
+			HDF5File::HDF5File(std::string fileName)
+			: fileID(-1),
+			  xferID(H5P_DEFAULT),
+			  fileName(fileName),
+			  collective(false)
+			{
+				this->resetStatistics();
+				this->openFile(H5P_DEFAULT);
+			}
+
+			HDF5File::HDF5File(std::string fileName, MPI_Comm comm, bool collective)
+			: fileID(-1),
+			  xferID(H5P_DEFAULT),
+			  fileName(fileName),
+			  collective(false)
+			{
+				this->resetStatistics();
+
+				#ifdef H5_HAVE_PARALLEL
+					hid_t faplID = H5Pcreate(H5P_FILE_ACCESS);
+					if(faplID < 0) {
+						throw(std::invalid_argument("HDF5File: HDF5File: H5Pcreate() failed"));
+					}
+
+					if(H5Pset_fapl_mpio(faplID, comm, MPI_INFO_NULL) < 0) {
+						throw(std::invalid_argument("HDF5File: HDF5File: H5Pset_fapl_mpio() failed"));
+					}
+
+					// Every rank reads the same attributes, so have one rank read the metadata and share it
+					#if H5_VERSION_GE(1,10,0)
+						if(H5Pset_all_coll_metadata_ops(faplID, true) < 0) {
+							throw(std::invalid_argument("HDF5File: HDF5File: H5Pset_all_coll_metadata_ops() failed"));
+						}
+					#endif
+
+					this->openFile(faplID);
+					H5Pclose(faplID);
+
+					this->xferID = H5Pcreate(H5P_DATASET_XFER);
+					if(this->xferID < 0) {
+						throw(std::invalid_argument("HDF5File: HDF5File: H5Pcreate() failed"));
+					}
+
+					if(H5Pset_dxpl_mpio(this->xferID, collective ? H5FD_MPIO_COLLECTIVE : H5FD_MPIO_INDEPENDENT) < 0) {
+						throw(std::invalid_argument("HDF5File: HDF5File: H5Pset_dxpl_mpio() failed"));
+					}
+
+					this->collective = collective;
+				#else
+					// Serial HDF5 - every process opens the file independently
+					(void) comm;
+					(void) collective;
+					this->openFile(H5P_DEFAULT);
+				#endif
+			}
+
+			HDF5File::~HDF5File() {
+				if(this->xferID != H5P_DEFAULT) {
+					H5Pclose(this->xferID);
+				}
+
+				if(this->fileID >= 0) {
+					H5Fclose(this->fileID);
+				}
+			}
+
+			void HDF5File::openFile(hid_t faplID) {
+				// Reads only, so open read-only. This also permits reading from read-only filesystems,
+				// and does not require a write lock on the file.
+				this->fileID = H5Fopen(this->fileName.c_str(), H5F_ACC_RDONLY, faplID);
+				if(this->fileID < 0) {
+					throw(std::invalid_argument("HDF5File: openFile: HDF5 unable to open file '" + this->fileName + "'"));
+				}
+			}
+
+			void HDF5File::recordRead(unsigned long long bytes, double time) {
+				this->bytesRead = this->bytesRead + bytes;
+				this->readTime = this->readTime + time;
+				this->nReads = this->nReads + 1;
+			}
+
+			void HDF5File::resetStatistics() {
+				this->bytesRead = 0;
+				this->readTime = 0.0;
+				this->nReads = 0;
+			}
+
+			double HDF5File::getReadRate() {
+				if(this->readTime > 0.0) {
+					return double(this->bytesRead) / this->readTime;
+				}
+
+				return 0.0;
+			}
+		}
+	}
+}
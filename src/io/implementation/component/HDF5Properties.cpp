@@ -58,15 +58,23 @@ namespace cupcfd
 
 				this->nidx = 0;
 				this->memspaceID = H5S_ALL;
+				this->indexed = false;
 			}
 
 			HDF5Properties::~HDF5Properties() {
 
 			}
 
+			void HDF5Properties::selectNone() {
+				this->idx.clear();
+				this->nidx = 0;
+				this->indexed = true;
+			}
+
 			void HDF5Properties::addIndex(unsigned long long x) {
 				this->idx.push_back(x);
 				this->nidx = this->nidx + 1;
+				this->indexed = true;
 			}
 
 			void HDF5Properties::addIndex(unsigned long long x,
@@ -74,6 +82,7 @@ namespace cupcfd
 				this->idx.push_back(x);
 				this->idx.push_back(y);
 				this->nidx = this->nidx + 1;
+				this->indexed = true;
 			}
 
 			void HDF5Properties::addIndex(unsigned long long x,
@@ -83,6 +92,7 @@ namespace cupcfd
 				this->idx.push_back(y);
 				this->idx.push_back(z);
 				this->nidx = this->nidx + 1;
+				this->indexed = true;
 			}
 
 			void HDF5Properties::addIndex(unsigned long long x,
@@ -94,6 +104,7 @@ namespace cupcfd
 				this->idx.push_back(z);
 				this->idx.push_back(u);
 				this->nidx = this->nidx + 1;
+				this->indexed = true;
 			}
 
 			void HDF5Properties::addIndex(unsigned long long x,
@@ -107,6 +118,7 @@ namespace cupcfd
 				this->idx.push_back(u);
 				this->idx.push_back(v);
 				this->nidx = this->nidx + 1;
+				this->indexed = true;
 			}
 
 			void HDF5Properties::addIndex(unsigned long long x,
@@ -122,8 +134,92 @@ namespace cupcfd
 				this->idx.push_back(v);
 				this->idx.push_back(w);
 				this->nidx = this->nidx + 1;
+				this->indexed = true;
 			}
 
+
+			void coalesceHyperslabBlocks(const std::vector<unsigned long long>& dim,
+										 const unsigned long long * idx, unsigned long long nidx,
+										 std::vector<unsigned long long>& start,
+										 std::vector<unsigned long long>& count) {
+				size_t ndim = dim.size();
+
+				start.clear();
+				count.clear();
+
+				if(ndim == 0 || nidx == 0) {
+					return;
+				}
+
+				size_t last = ndim - 1;
+
+				// (1) Merge runs of indexes along the last dimension into segments
+				std::vector<unsigned long long> segStart;
+				std::vector<unsigned long long> segCount;
+
+				for(unsigned long long i = 0; i < nidx; i++) {
+					const unsigned long long * point = idx + (i * ndim);
+					size_t nSeg = segStart.size() / ndim;
+
+					if(nSeg > 0) {
+						unsigned long long * prevStart = &segStart[(nSeg - 1) * ndim];
+						unsigned long long * prevCount = &segCount[(nSeg - 1) * ndim];
+
+						bool extend = (point[last] == prevStart[last] + prevCount[last]);
+						for(size_t d = 0; d < last && extend; d++) {
+							extend = (point[d] == prevStart[d]);
+						}
+
+						if(extend) {
+							prevCount[last] = prevCount[last] + 1;
+							continue;
+						}
+					}
+
+					for(size_t d = 0; d < ndim; d++) {
+						segStart.push_back(point[d]);
+						segCount.push_back(1);
+					}
+				}
+
+				if(ndim == 1) {
+					start.swap(segStart);
+					count.swap(segCount);
+					return;
+				}
+
+				// (2) Merge segments that match along the last dimension, and are consecutive
+				// along the second to last dimension, into blocks
+				size_t outer = ndim - 2;
+				size_t nSeg = segStart.size() / ndim;
+
+				for(size_t s = 0; s < nSeg; s++) {
+					const unsigned long long * sStart = &segStart[s * ndim];
+					const unsigned long long * sCount = &segCount[s * ndim];
+					size_t nBlock = start.size() / ndim;
+
+					if(nBlock > 0) {
+						unsigned long long * bStart = &start[(nBlock - 1) * ndim];
+						unsigned long long * bCount = &count[(nBlock - 1) * ndim];
+
+						bool extend = (sStart[last] == bStart[last]) && (sCount[last] == bCount[last]) &&
+									  (sStart[outer] == bStart[outer] + bCount[outer]);
+						for(size_t d = 0; d < outer && extend; d++) {
+							extend = (sStart[d] == bStart[d]);
+						}
+
+						if(extend) {
+							bCount[outer] = bCount[outer] + 1;
+							continue;
+						}
+					}
+
+					for(size_t d = 0; d < ndim; d++) {
+						start.push_back(sStart[d]);
+						count.push_back(sCount[d]);
+					}
+				}
+			}
 		}
 	}
 }
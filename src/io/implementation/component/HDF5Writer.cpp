@@ -0,0 +1,349 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Definitions for HDF5Writer class.
+ */
+
+#include "HDF5Writer.h"
+#include <vector>
+
+namespace cupcfd
+{
+	namespace io
+	{
+		namespace hdf5
+		{
+			/**
+			 * Open a group of the file, creating it if it does not exist.
+			 */
+			static cupcfd::error::eCodes openGroup(hid_t fileID, const std::string& groupName, hid_t * groupID) {
+				if(groupName.empty() || groupName == "/") {
+					*groupID = H5Gopen(fileID, "/", H5P_DEFAULT);
+				}
+				else if(H5Lexists(fileID, groupName.c_str(), H5P_DEFAULT) > 0) {
+					*groupID = H5Gopen(fileID, groupName.c_str(), H5P_DEFAULT);
+				}
+				else {
+					*groupID = H5Gcreate(fileID, groupName.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+				}
+
+				if(*groupID < 0) {
+					return cupcfd::error::E_HDF5_ERROR;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			/**
+			 * Create a dataset of nTotalRows rows of nCols values.
+			 */
+			static cupcfd::error::eCodes createDataSet(hid_t fileID, const std::string& groupName, const std::string& dataName, hid_t typeID,
+													   unsigned long long nTotalRows, unsigned long long nCols) {
+				cupcfd::error::eCodes status;
+				hsize_t dims[2] = {nTotalRows, nCols};
+				int ndim = (nCols == 1) ? 1 : 2;
+
+				hid_t groupID;
+				status = openGroup(fileID, groupName, &groupID);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				hid_t dataspaceID = H5Screate_simple(ndim, dims, NULL);
+				if(dataspaceID < 0) {
+					H5Gclose(groupID);
+					return cupcfd::error::E_HDF5_ERROR;
+				}
+
+				hid_t datasetID = H5Dcreate(groupID, dataName.c_str(), typeID, dataspaceID, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+				if(datasetID >= 0) {
+					H5Dclose(datasetID);
+				}
+
+				H5Sclose(dataspaceID);
+				H5Gclose(groupID);
+
+				if(datasetID < 0) {
+					return cupcfd::error::E_HDF5_ERROR;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			/**
+			 * Write nRows rows to an existing dataset, starting at row offset.
+			 * If nRows is zero nothing is selected, so that this process can still take part in a collective write.
+			 */
+			static cupcfd::error::eCodes writeRows(hid_t fileID, const std::string& groupName, const std::string& dataName, hid_t typeID,
+												   const void * data, unsigned long long offset, unsigned long long nRows, unsigned long long nCols,
+												   hid_t xferID) {
+				cupcfd::error::eCodes status;
+				hsize_t start[2] = {offset, 0};
+				hsize_t count[2] = {nRows, nCols};
+				int ndim = (nCols == 1) ? 1 : 2;
+
+				hid_t groupID;
+				status = openGroup(fileID, groupName, &groupID);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				hid_t datasetID = H5Dopen(groupID, dataName.c_str(), H5P_DEFAULT);
+				if(datasetID < 0) {
+					H5Gclose(groupID);
+					return cupcfd::error::E_HDF5_ERROR;
+				}
+
+				hid_t filespaceID = H5Dget_space(datasetID);
+				hid_t memspaceID = H5Screate_simple(ndim, count, NULL);
+
+				if(nRows > 0) {
+					H5Sselect_hyperslab(filespaceID, H5S_SELECT_SET, start, NULL, count, NULL);
+				}
+				else {
+					H5Sselect_none(filespaceID);
+					H5Sselect_none(memspaceID);
+				}
+
+				herr_t err = H5Dwrite(datasetID, typeID, memspaceID, filespaceID, xferID, data);
+
+				H5Sclose(memspaceID);
+				H5Sclose(filespaceID);
+				H5Dclose(datasetID);
+				H5Gclose(groupID);
+
+				if(err < 0) {
+					return cupcfd::error::E_HDF5_ERROR;
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			HDF5Writer::HDF5Writer(std::string fileName, MPI_Comm comm)
+			: fileName(fileName),
+			  comm(comm),
+			  fileID(-1),
+			  xferID(H5P_DEFAULT),
+			  status(cupcfd::error::E_SUCCESS)
+			{
+				cupcfd::error::eCodes localStatus = cupcfd::error::E_SUCCESS;
+
+				MPI_Comm_rank(comm, &this->rank);
+				MPI_Comm_size(comm, &this->size);
+
+				#ifdef H5_HAVE_PARALLEL
+					hid_t faplID = H5Pcreate(H5P_FILE_ACCESS);
+
+					if(faplID < 0 || H5Pset_fapl_mpio(faplID, comm, MPI_INFO_NULL) < 0) {
+						localStatus = cupcfd::error::E_HDF5_ERROR;
+					}
+
+					// Creating the file is collective, so only go ahead if every process has its property list
+					localStatus = this->agreeStatus(localStatus);
+
+					if(localStatus == cupcfd::error::E_SUCCESS) {
+						this->fileID = H5Fcreate(this->fileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, faplID);
+
+						if(this->fileID < 0) {
+							localStatus = cupcfd::error::E_HDF5_ERROR;
+						}
+					}
+
+					if(faplID >= 0) {
+						H5Pclose(faplID);
+					}
+
+					this->xferID = H5Pcreate(H5P_DATASET_XFER);
+					if(this->xferID < 0 || H5Pset_dxpl_mpio(this->xferID, H5FD_MPIO_COLLECTIVE) < 0) {
+						localStatus = cupcfd::error::E_HDF5_ERROR;
+					}
+
+					if(this->xferID < 0) {
+						this->xferID = H5P_DEFAULT;
+					}
+				#else
+					// Serial HDF5 - create the file on one process, and have each process reopen it when it is their turn
+					// to write
+					if(this->rank == 0) {
+						hid_t createID = H5Fcreate(this->fileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+						if(createID < 0) {
+							localStatus = cupcfd::error::E_HDF5_ERROR;
+						}
+						else {
+							H5Fclose(createID);
+						}
+					}
+				#endif
+
+				// Any failure is stored in status, so later writes return it
+				this->agreeStatus(localStatus);
+			}
+
+			HDF5Writer::~HDF5Writer() {
+				if(this->xferID != H5P_DEFAULT) {
+					H5Pclose(this->xferID);
+				}
+
+				if(this->fileID >= 0) {
+					H5Fclose(this->fileID);
+				}
+			}
+
+			cupcfd::error::eCodes HDF5Writer::agreeStatus(cupcfd::error::eCodes localStatus) {
+				int localOK = (localStatus == cupcfd::error::E_SUCCESS) ? 1 : 0;
+				int ok;
+
+				MPI_Allreduce(&localOK, &ok, 1, MPI_INT, MPI_MIN, this->comm);
+
+				if(ok == 1) {
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				this->status = (localStatus != cupcfd::error::E_SUCCESS) ? localStatus : cupcfd::error::E_HDF5_ERROR;
+
+				return this->status;
+			}
+
+			cupcfd::error::eCodes HDF5Writer::writeAttribute(std::string attrName, int value) {
+				// An earlier failure was agreed on every process, so every process returns here
+				if(this->status != cupcfd::error::E_SUCCESS) {
+					return this->status;
+				}
+
+				herr_t err = -1;
+
+				#ifdef H5_HAVE_PARALLEL
+					hid_t writeFileID = this->fileID;
+				#else
+					// Only one process needs to write the attribute
+					hid_t writeFileID = -1;
+
+					if(this->rank == 0) {
+						writeFileID = H5Fopen(this->fileName.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+					}
+				#endif
+
+				if(writeFileID >= 0) {
+					hid_t groupID = H5Gopen(writeFileID, "/", H5P_DEFAULT);
+					hid_t dataspaceID = H5Screate(H5S_SCALAR);
+					hid_t attrID = H5Acreate(groupID, attrName.c_str(), H5T_NATIVE_INT, dataspaceID, H5P_DEFAULT, H5P_DEFAULT);
+
+					if(attrID >= 0) {
+						err = H5Awrite(attrID, H5T_NATIVE_INT, &value);
+						H5Aclose(attrID);
+					}
+
+					H5Sclose(dataspaceID);
+					H5Gclose(groupID);
+
+					#ifndef H5_HAVE_PARALLEL
+						H5Fclose(writeFileID);
+					#endif
+				}
+
+				#ifndef H5_HAVE_PARALLEL
+					// The other processes have nothing to write
+					if(this->rank != 0) {
+						err = 0;
+					}
+				#endif
+
+				return this->agreeStatus((err < 0) ? cupcfd::error::E_HDF5_ERROR : cupcfd::error::E_SUCCESS);
+			}
+
+			cupcfd::error::eCodes HDF5Writer::writeDataSet(std::string groupName, std::string dataName, hid_t typeID, const void * data,
+														   unsigned long long nRows, unsigned long long nCols) {
+				cupcfd::error::eCodes localStatus = cupcfd::error::E_SUCCESS;
+
+				// An earlier failure was agreed on every process, so every process returns here
+				if(this->status != cupcfd::error::E_SUCCESS) {
+					return this->status;
+				}
+
+				// Find where the rows of this process start, and the total number of rows
+				std::vector<unsigned long long> rankRows(this->size);
+				MPI_Allgather(&nRows, 1, MPI_UNSIGNED_LONG_LONG, rankRows.data(), 1, MPI_UNSIGNED_LONG_LONG, this->comm);
+
+				unsigned long long offset = 0;
+				unsigned long long nTotalRows = 0;
+				for(int r = 0; r < this->size; r++) {
+					if(r < this->rank) {
+						offset = offset + rankRows[r];
+					}
+					nTotalRows = nTotalRows + rankRows[r];
+				}
+
+				#ifdef H5_HAVE_PARALLEL
+					localStatus = createDataSet(this->fileID, groupName, dataName, typeID, nTotalRows, nCols);
+
+					// The write is collective, so only go ahead if the dataset was created everywhere
+					localStatus = this->agreeStatus(localStatus);
+					if(localStatus != cupcfd::error::E_SUCCESS) {
+						return localStatus;
+					}
+
+					localStatus = writeRows(this->fileID, groupName, dataName, typeID, data, offset, nRows, nCols, this->xferID);
+				#else
+					if(this->rank == 0) {
+						hid_t writeFileID = H5Fopen(this->fileName.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+
+						if(writeFileID < 0) {
+							localStatus = cupcfd::error::E_HDF5_ERROR;
+						}
+						else {
+							localStatus = createDataSet(writeFileID, groupName, dataName, typeID, nTotalRows, nCols);
+							H5Fclose(writeFileID);
+						}
+					}
+
+					localStatus = this->agreeStatus(localStatus);
+					if(localStatus != cupcfd::error::E_SUCCESS) {
+						return localStatus;
+					}
+
+					// Take turns to write, in rank order. Every process reaches every barrier, even if its own
+					// write fails, so that a failure can not leave the other processes waiting.
+					for(int r = 0; r < this->size; r++) {
+						MPI_Barrier(this->comm);
+
+						if(r == this->rank && nRows > 0) {
+							hid_t writeFileID = H5Fopen(this->fileName.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+
+							if(writeFileID < 0) {
+								localStatus = cupcfd::error::E_HDF5_ERROR;
+							}
+							else {
+								localStatus = writeRows(writeFileID, groupName, dataName, typeID, data, offset, nRows, nCols, H5P_DEFAULT);
+								H5Fclose(writeFileID);
+							}
+						}
+					}
+				#endif
+
+				return this->agreeStatus(localStatus);
+			}
+
+			cupcfd::error::eCodes HDF5Writer::writeDataSet(std::string groupName, std::string dataName, const int * data,
+														   unsigned long long nRows, unsigned long long nCols) {
+				return this->writeDataSet(groupName, dataName, H5T_NATIVE_INT, data, nRows, nCols);
+			}
+
+			cupcfd::error::eCodes HDF5Writer::writeDataSet(std::string groupName, std::string dataName, const float * data,
+														   unsigned long long nRows, unsigned long long nCols) {
+				return this->writeDataSet(groupName, dataName, H5T_NATIVE_FLOAT, data, nRows, nCols);
+			}
+
+			cupcfd::error::eCodes HDF5Writer::writeDataSet(std::string groupName, std::string dataName, const double * data,
+														   unsigned long long nRows, unsigned long long nCols) {
+				return this->writeDataSet(groupName, dataName, H5T_NATIVE_DOUBLE, data, nRows, nCols);
+			}
+		}
+	}
+}
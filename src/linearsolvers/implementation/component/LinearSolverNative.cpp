@@ -0,0 +1,1221 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the LinearSolverNative class
+ */
+
+#include "LinearSolverNative.h"
+
+// SparseMatrix Implementation Classes
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixCOO.h"
+
+#include "Gather.h"
+#include "Reduce.h"
+#include "AllToAll.h"
+#include "ExchangePatternConfig.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		// Visit every value stored in a matrix as (row, column, value) with base zero global indexes.
+		// A SparseMatrixCSR is read from its arrays in place, other formats row by row through the SparseMatrix interface.
+		// Visiting stops at the first error returned by visit.
+		template <class C, class I, class T, class F>
+		cupcfd::error::eCodes visitMatrixEntries(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix, F visit) {
+			cupcfd::error::eCodes status = cupcfd::error::E_SUCCESS;
+
+			cupcfd::data_structures::SparseMatrixCSR<I,T> * csr = cupcfd::data_structures::getCSRMatrix(static_cast<C&>(matrix));
+
+			if(csr != nullptr) {
+				for(I row = 0; row < csr->m; row++) {
+					for(I k = csr->IA[row]; k < csr->IA[row + 1]; k++) {
+						status = visit(row, csr->JA[k] - csr->baseIndex, csr->A[k]);
+						if(status != cupcfd::error::E_SUCCESS) {
+							return status;
+						}
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			I * rowIndexes;
+			I nRowIndexes;
+			status = matrix.getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
+			CHECK_ECODE(status)
+
+			for(I i = 0; i < nRowIndexes && status == cupcfd::error::E_SUCCESS; i++) {
+				I * columnIndexes;
+				I nColumnIndexes;
+				status = matrix.getRowColumnIndexes(rowIndexes[i], &columnIndexes, &nColumnIndexes);
+				CHECK_ECODE(status)
+
+				T * nnzValues;
+				I nNNZValues;
+				status = matrix.getRowNNZValues(rowIndexes[i], &nnzValues, &nNNZValues);
+				CHECK_ECODE(status)
+
+				for(I j = 0; j < nColumnIndexes && status == cupcfd::error::E_SUCCESS; j++) {
+					status = visit(rowIndexes[i] - matrix.baseIndex, columnIndexes[j] - matrix.baseIndex, nnzValues[j]);
+				}
+
+				free(columnIndexes);
+				free(nnzValues);
+			}
+
+			free(rowIndexes);
+
+			return status;
+		}
+
+		// === Constructors/Deconstructors ===
+
+		template <class C, class I, class T>
+		LinearSolverNative<C,I,T>::LinearSolverNative(cupcfd::comm::Communicator& comm, NativeSolverMethod method,
+													  NativePreconditioner preconditioner, T rTol, T eTol, I maxIterations,
+													  cupcfd::data_structures::SparseMatrix<C,I,T>& matrix)
+		:LinearSolverInterface<C,I,T>(comm, matrix.m, matrix.n),
+		 method(method),
+		 preconditioner(preconditioner),
+		 rTol(rTol),
+		 eTol(eTol),
+		 maxIterations(maxIterations),
+		 vectorXSetup(false),
+		 vectorBSetup(false),
+		 matrixASetup(false),
+		 distA(nullptr),
+		 remoteRows(false),
+		 csrMapped(false),
+		 pcSetup(false),
+		 iterations(0),
+		 residualNorm(0),
+		 converged(false)
+		{
+			cupcfd::error::eCodes status;
+
+			// Split the rows into contiguous blocks, with the first (mGlobal % size) ranks having one extra row
+			I size = this->comm.size;
+			I blockSize = this->mGlobal / size;
+			I nLarge = this->mGlobal % size;
+
+			this->rowRanges.resize(size + 1);
+			this->rowRanges[0] = 0;
+
+			for(I i = 0; i < size; i++) {
+				this->rowRanges[i + 1] = this->rowRanges[i] + blockSize + ((i < nLarge) ? 1 : 0);
+			}
+
+			this->mLocal = this->rowRanges[this->comm.rank + 1] - this->rowRanges[this->comm.rank];
+
+			status = this->setupVectorX();
+			HARD_CHECK_ECODE(status)
+			status = this->setupVectorB();
+			HARD_CHECK_ECODE(status)
+			status = this->setupMatrixA(matrix);
+			HARD_CHECK_ECODE(status)
+		}
+
+		template <class C, class I, class T>
+		LinearSolverNative<C,I,T>::~LinearSolverNative()
+		{
+			this->reset();
+		}
+
+		// === Concrete Methods ===
+
+		template <class C, class I, class T>
+		I LinearSolverNative<C,I,T>::getLocalPosition(I row, I col) {
+			if(col < 0 || col >= this->nGlobal) {
+				return -1;
+			}
+
+			I rowStart = this->rowRanges[this->comm.rank];
+			I localCol;
+
+			if(col >= rowStart && col < (rowStart + this->mLocal)) {
+				localCol = col - rowStart;
+			}
+			else {
+				std::vector<I>& ghostGlobalIDs = this->distA->ghostGlobalIDs;
+				typename std::vector<I>::iterator ghost = std::lower_bound(ghostGlobalIDs.begin(), ghostGlobalIDs.end(), col);
+
+				if(ghost == ghostGlobalIDs.end() || *ghost != col) {
+					return -1;
+				}
+
+				localCol = this->mLocal + I(ghost - ghostGlobalIDs.begin());
+			}
+
+			cupcfd::data_structures::SparseMatrixCSR<I,T>& localA = this->distA->localA;
+
+			typename std::vector<I>::iterator first = localA.JA.begin() + localA.IA[row];
+			typename std::vector<I>::iterator last = localA.JA.begin() + localA.IA[row + 1];
+			typename std::vector<I>::iterator pos = std::lower_bound(first, last, localCol);
+
+			if(pos == last || *pos != localCol) {
+				return -1;
+			}
+
+			return I(pos - localA.JA.begin());
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::multiplyMatrixA(std::vector<T>& vec, std::vector<T>& result) {
+			cupcfd::error::eCodes status;
+
+			status = this->distA->multiply(vec.data(), this->mLocal, result.data(), this->mLocal);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setupPreconditioner() {
+			cupcfd::error::eCodes status;
+			cupcfd::data_structures::SparseMatrixCSR<I,T>& localA = this->distA->localA;
+
+			// A missing or zero diagonal may only be found on some processes, so the error is recorded and agreed
+			// before returning, rather than leaving the other processes waiting in the solve
+			int localError = 0;
+
+			if(this->preconditioner == NATIVE_PC_JACOBI) {
+				this->pcInvDiag.resize(this->mLocal);
+
+				for(I i = 0; i < this->mLocal; i++) {
+					if(this->diagPos[i] < 0 || localA.A[this->diagPos[i]] == T(0)) {
+						localError = 1;
+						break;
+					}
+
+					this->pcInvDiag[i] = T(1) / localA.A[this->diagPos[i]];
+				}
+			}
+			else if(this->preconditioner == NATIVE_PC_BJACOBI_ILU0) {
+				// Factorise the local columns of the local rows in place (IKJ ordering), keeping the
+				// non-zero structure. The ghost columns are left out, so each process has its own block.
+				this->pcILU = localA.A;
+
+				// Position of each local column in the current row, or -1
+				std::vector<I> colPos(this->mLocal, -1);
+
+				for(I i = 0; i < this->mLocal && localError == 0; i++) {
+					for(I k = localA.IA[i]; k < this->ghostStart[i]; k++) {
+						colPos[localA.JA[k]] = k;
+					}
+
+					for(I k = localA.IA[i]; k < this->ghostStart[i] && localA.JA[k] < i; k++) {
+						I row = localA.JA[k];
+
+						this->pcILU[k] = this->pcILU[k] / this->pcILU[this->diagPos[row]];
+
+						for(I q = this->diagPos[row] + 1; q < this->ghostStart[row]; q++) {
+							I pos = colPos[localA.JA[q]];
+
+							if(pos >= 0) {
+								this->pcILU[pos] = this->pcILU[pos] - (this->pcILU[k] * this->pcILU[q]);
+							}
+						}
+					}
+
+					for(I k = localA.IA[i]; k < this->ghostStart[i]; k++) {
+						colPos[localA.JA[k]] = -1;
+					}
+
+					if(this->diagPos[i] < 0 || this->pcILU[this->diagPos[i]] == T(0)) {
+						localError = 1;
+					}
+				}
+			}
+
+			int globalError;
+			status = cupcfd::comm::allReduceMax(&localError, 1, &globalError, 1, this->comm);
+			CHECK_ECODE(status)
+
+			if(globalError > 0) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+			}
+
+			this->pcSetup = true;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::applyPreconditioner(std::vector<T>& vec, std::vector<T>& result) {
+			cupcfd::data_structures::SparseMatrixCSR<I,T>& localA = this->distA->localA;
+
+			if(this->preconditioner == NATIVE_PC_JACOBI) {
+				for(I i = 0; i < this->mLocal; i++) {
+					result[i] = this->pcInvDiag[i] * vec[i];
+				}
+			}
+			else if(this->preconditioner == NATIVE_PC_BJACOBI_ILU0) {
+				// Forward substitution with the unit lower triangle
+				for(I i = 0; i < this->mLocal; i++) {
+					T sum = vec[i];
+
+					for(I k = localA.IA[i]; k < this->diagPos[i]; k++) {
+						sum = sum - (this->pcILU[k] * result[localA.JA[k]]);
+					}
+
+					result[i] = sum;
+				}
+
+				// Back substitution with the upper triangle
+				for(I i = this->mLocal - 1; i >= 0; i--) {
+					T sum = result[i];
+
+					for(I k = this->diagPos[i] + 1; k < this->ghostStart[i]; k++) {
+						sum = sum - (this->pcILU[k] * result[localA.JA[k]]);
+					}
+
+					result[i] = sum / this->pcILU[this->diagPos[i]];
+				}
+			}
+			else {
+				std::copy(vec.begin(), vec.begin() + this->mLocal, result.begin());
+			}
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::dotProducts(std::vector<T> ** vecA, std::vector<T> ** vecB, int nPairs, T * results) {
+			cupcfd::error::eCodes status;
+
+			std::vector<T> localResults(nPairs, T(0));
+
+			for(int j = 0; j < nPairs; j++) {
+				std::vector<T>& a = *(vecA[j]);
+				std::vector<T>& b = *(vecB[j]);
+
+				for(I i = 0; i < this->mLocal; i++) {
+					localResults[j] = localResults[j] + (a[i] * b[i]);
+				}
+			}
+
+			status = cupcfd::comm::allReduceAdd(localResults.data(), nPairs, results, nPairs, this->comm);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::solveCG() {
+			cupcfd::error::eCodes status;
+
+			// r: residual, workPHat: preconditioned residual (z), workP: search direction, workV: A * p
+			this->workR.resize(this->mLocal);
+			this->workPHat.resize(this->mLocal);
+			this->workP.resize(this->mLocal);
+			this->workV.resize(this->mLocal);
+
+			// r = b - Ax
+			std::copy(this->x.begin(), this->x.end(), this->workP.begin());
+
+			status = this->multiplyMatrixA(this->workP, this->workV);
+			CHECK_ECODE(status)
+
+			for(I i = 0; i < this->mLocal; i++) {
+				this->workR[i] = this->b[i] - this->workV[i];
+			}
+
+			this->applyPreconditioner(this->workR, this->workPHat);
+
+			// ||b||^2, ||r||^2 and (r, z) in one reduction
+			T dots[3];
+			std::vector<T> * dotA[3] = {&this->b, &this->workR, &this->workR};
+			std::vector<T> * dotB[3] = {&this->b, &this->workR, &this->workPHat};
+
+			status = this->dotProducts(dotA, dotB, 3, dots);
+			CHECK_ECODE(status)
+
+			T tol = std::max(this->rTol * std::sqrt(dots[0]), this->eTol);
+			T rNorm = std::sqrt(dots[1]);
+			T rz = dots[2];
+
+			this->iterations = 0;
+			this->converged = (rNorm <= tol);
+
+			std::copy(this->workPHat.begin(), this->workPHat.end(), this->workP.begin());
+
+			while(!this->converged && this->iterations < this->maxIterations) {
+				status = this->multiplyMatrixA(this->workP, this->workV);
+				CHECK_ECODE(status)
+
+				T pq;
+				std::vector<T> * pqA[1] = {&this->workP};
+				std::vector<T> * pqB[1] = {&this->workV};
+
+				status = this->dotProducts(pqA, pqB, 1, &pq);
+				CHECK_ECODE(status)
+
+				// Breakdown - the search direction is zero, or the matrix is not positive definite
+				if(pq <= T(0)) {
+					break;
+				}
+
+				T alpha = rz / pq;
+
+				for(I i = 0; i < this->mLocal; i++) {
+					this->x[i] = this->x[i] + (alpha * this->workP[i]);
+					this->workR[i] = this->workR[i] - (alpha * this->workV[i]);
+				}
+
+				this->applyPreconditioner(this->workR, this->workPHat);
+
+				status = this->dotProducts(dotA + 1, dotB + 1, 2, dots);
+				CHECK_ECODE(status)
+
+				this->iterations = this->iterations + 1;
+				rNorm = std::sqrt(dots[0]);
+
+				if(rNorm <= tol) {
+					this->converged = true;
+					break;
+				}
+
+				T beta = dots[1] / rz;
+				rz = dots[1];
+
+				for(I i = 0; i < this->mLocal; i++) {
+					this->workP[i] = this->workPHat[i] + (beta * this->workP[i]);
+				}
+			}
+
+			this->residualNorm = rNorm;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::solveBiCGStab() {
+			cupcfd::error::eCodes status;
+
+			this->workR.resize(this->mLocal);
+			this->workRHat.resize(this->mLocal);
+			this->workP.resize(this->mLocal);
+			this->workPHat.resize(this->mLocal);
+			this->workV.resize(this->mLocal);
+			this->workS.resize(this->mLocal);
+			this->workSHat.resize(this->mLocal);
+			this->workT.resize(this->mLocal);
+
+			// r = b - Ax, and the shadow residual rHat = r
+			std::copy(this->x.begin(), this->x.end(), this->workPHat.begin());
+
+			status = this->multiplyMatrixA(this->workPHat, this->workV);
+			CHECK_ECODE(status)
+
+			for(I i = 0; i < this->mLocal; i++) {
+				this->workR[i] = this->b[i] - this->workV[i];
+				this->workRHat[i] = this->workR[i];
+			}
+
+			// ||b||^2 and ||r||^2 in one reduction
+			T dots[2];
+			std::vector<T> * initA[2] = {&this->b, &this->workR};
+			std::vector<T> * initB[2] = {&this->b, &this->workR};
+
+			status = this->dotProducts(initA, initB, 2, dots);
+			CHECK_ECODE(status)
+
+			T tol = std::max(this->rTol * std::sqrt(dots[0]), this->eTol);
+			T rNorm = std::sqrt(dots[1]);
+
+			// rHat = r, so (rHat, r) = ||r||^2
+			T rhoNew = dots[1];
+			T rho = 1;
+			T alpha = 1;
+			T omega = 1;
+
+			this->iterations = 0;
+			this->converged = (rNorm <= tol);
+
+			std::vector<T> * rHatVA[1] = {&this->workRHat};
+			std::vector<T> * rHatVB[1] = {&this->workV};
+			std::vector<T> * ssA[1] = {&this->workS};
+			std::vector<T> * tsA[2] = {&this->workT, &this->workT};
+			std::vector<T> * tsB[2] = {&this->workS, &this->workT};
+			std::vector<T> * rrA[2] = {&this->workR, &this->workRHat};
+			std::vector<T> * rrB[2] = {&this->workR, &this->workR};
+
+			while(!this->converged && this->iterations < this->maxIterations) {
+				// Breakdown - rHat is orthogonal to r
+				if(rhoNew == T(0)) {
+					break;
+				}
+
+				if(this->iterations == 0) {
+					std::copy(this->workR.begin(), this->workR.end(), this->workP.begin());
+				}
+				else {
+					T beta = (rhoNew / rho) * (alpha / omega);
+
+					for(I i = 0; i < this->mLocal; i++) {
+						this->workP[i] = this->workR[i] + (beta * (this->workP[i] - (omega * this->workV[i])));
+					}
+				}
+
+				rho = rhoNew;
+
+				// v = A M^-1 p
+				this->applyPreconditioner(this->workP, this->workPHat);
+
+				status = this->multiplyMatrixA(this->workPHat, this->workV);
+				CHECK_ECODE(status)
+
+				T rHatV;
+				status = this->dotProducts(rHatVA, rHatVB, 1, &rHatV);
+				CHECK_ECODE(status)
+
+				if(rHatV == T(0)) {
+					break;
+				}
+
+				alpha = rho / rHatV;
+
+				for(I i = 0; i < this->mLocal; i++) {
+					this->workS[i] = this->workR[i] - (alpha * this->workV[i]);
+				}
+
+				T ss;
+				status = this->dotProducts(ssA, ssA, 1, &ss);
+				CHECK_ECODE(status)
+
+				this->iterations = this->iterations + 1;
+
+				if(std::sqrt(ss) <= tol) {
+					for(I i = 0; i < this->mLocal; i++) {
+						this->x[i] = this->x[i] + (alpha * this->workPHat[i]);
+					}
+
+					rNorm = std::sqrt(ss);
+					this->converged = true;
+					break;
+				}
+
+				// t = A M^-1 s
+				this->applyPreconditioner(this->workS, this->workSHat);
+
+				status = this->multiplyMatrixA(this->workSHat, this->workT);
+				CHECK_ECODE(status)
+
+				status = this->dotProducts(tsA, tsB, 2, dots);
+				CHECK_ECODE(status)
+
+				omega = (dots[1] == T(0)) ? T(0) : (dots[0] / dots[1]);
+
+				for(I i = 0; i < this->mLocal; i++) {
+					this->x[i] = this->x[i] + (alpha * this->workPHat[i]) + (omega * this->workSHat[i]);
+					this->workR[i] = this->workS[i] - (omega * this->workT[i]);
+				}
+
+				// ||r||^2 and the next (rHat, r) in one reduction
+				status = this->dotProducts(rrA, rrB, 2, dots);
+				CHECK_ECODE(status)
+
+				rNorm = std::sqrt(dots[0]);
+				rhoNew = dots[1];
+
+				if(rNorm <= tol) {
+					this->converged = true;
+					break;
+				}
+
+				// Breakdown - the iteration can not continue with omega = 0
+				if(omega == T(0)) {
+					break;
+				}
+			}
+
+			this->residualNorm = rNorm;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setLocalVectorValues(std::vector<T>& vec, T * scalars, I nScalars,
+																			   I * indexes, I nIndexes, I indexBase) {
+			cupcfd::error::eCodes status;
+
+			// Error Check - Are nScalars and nIndexes the same
+			if(nScalars != nIndexes) {
+				return cupcfd::error::E_ARRAY_MISMATCH_SIZE;
+			}
+
+			I rowStart = this->rowRanges[this->comm.rank];
+
+			// Values for rows owned by other processes, and their owners
+			std::vector<I> remoteIndexes;
+			std::vector<T> remoteValues;
+			std::vector<int> remoteRanks;
+
+			for(I i = 0; i < nIndexes; i++) {
+				I index = indexes[i] - indexBase;
+
+				if(index < 0 || index >= this->mGlobal) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				if(index >= rowStart && index < (rowStart + this->mLocal)) {
+					vec[index - rowStart] = scalars[i];
+				}
+				else {
+					remoteIndexes.push_back(index);
+					remoteValues.push_back(scalars[i]);
+					remoteRanks.push_back(this->getRowOwner(index));
+				}
+			}
+
+			if(this->comm.size > 1) {
+				int localRemote = (remoteIndexes.size() > 0) ? 1 : 0;
+				int globalRemote;
+
+				status = cupcfd::comm::allReduceMax(&localRemote, 1, &globalRemote, 1, this->comm);
+				CHECK_ECODE(status)
+
+				if(globalRemote > 0) {
+					I * recvIndexes = nullptr;
+					int nRecvIndexes = 0;
+					T * recvValues = nullptr;
+					int nRecvValues = 0;
+
+					status = cupcfd::comm::AllToAll(remoteIndexes.data(), int(remoteIndexes.size()),
+													remoteRanks.data(), int(remoteRanks.size()),
+													&recvIndexes, &nRecvIndexes, this->comm);
+					CHECK_ECODE(status)
+
+					status = cupcfd::comm::AllToAll(remoteValues.data(), int(remoteValues.size()),
+													remoteRanks.data(), int(remoteRanks.size()),
+													&recvValues, &nRecvValues, this->comm);
+					CHECK_ECODE(status)
+
+					for(int i = 0; i < nRecvIndexes; i++) {
+						vec[recvIndexes[i] - rowStart] = recvValues[i];
+					}
+
+					free(recvIndexes);
+					free(recvValues);
+				}
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getLocalVectorValues(std::vector<T>& vec, T ** result, I * nResult) {
+			cupcfd::error::eCodes status;
+
+			if(this->comm.size == 1) {
+				*nResult = this->mLocal;
+				*result = (T *) malloc(sizeof(T) * (*nResult));
+				std::copy(vec.begin(), vec.begin() + this->mLocal, *result);
+			}
+			else {
+				// The rows are split in rank order, so gathering the local rows in rank order gives the full vector
+				I * recvCounts = nullptr;
+				I nRecvCounts;
+
+				*result = nullptr;
+
+				status = cupcfd::comm::AllGatherV(vec.data(), this->mLocal, result, nResult, &recvCounts, &nRecvCounts, this->comm);
+				CHECK_ECODE(status)
+
+				free(recvCounts);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getLocalVectorValues(std::vector<T>& vec, T ** result, I * nResult,
+																			   I * indexes, I nIndexes, I indexBase) {
+			cupcfd::error::eCodes status;
+
+			I rowStart = this->rowRanges[this->comm.rank];
+			I nOffNodeCount = 0;
+
+			for(I i = 0; i < nIndexes; i++) {
+				I index = indexes[i] - indexBase;
+
+				if(index < 0 || index >= this->mGlobal) {
+					return cupcfd::error::E_INVALID_INDEX;
+				}
+
+				if(index < rowStart || index >= (rowStart + this->mLocal)) {
+					nOffNodeCount = nOffNodeCount + 1;
+				}
+			}
+
+			I nTotalOffNodeCount = nOffNodeCount;
+
+			if(this->comm.size > 1) {
+				status = cupcfd::comm::allReduceAdd(&nOffNodeCount, 1, &nTotalOffNodeCount, 1, this->comm);
+				CHECK_ECODE(status)
+			}
+
+			*nResult = nIndexes;
+			*result = (T *) malloc(sizeof(T) * (*nResult));
+
+			if(nTotalOffNodeCount == 0) {
+				// All indexes are local across all processes, so no need for further comms
+				for(I i = 0; i < nIndexes; i++) {
+					(*result)[i] = vec[indexes[i] - indexBase - rowStart];
+				}
+			}
+			else {
+				// Expensive - every process gets a copy of the full vector to pick the values from
+				T * fullVec;
+				I nFullVec;
+
+				status = this->getLocalVectorValues(vec, &fullVec, &nFullVec);
+				CHECK_ECODE(status)
+
+				for(I i = 0; i < nIndexes; i++) {
+					(*result)[i] = fullVec[indexes[i] - indexBase];
+				}
+
+				free(fullVec);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		// === Overloaded Inherited Methods ===
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::resetVectorX() {
+			this->x.clear();
+			this->vectorXSetup = false;
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::resetVectorB() {
+			this->b.clear();
+			this->vectorBSetup = false;
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::resetMatrixA() {
+			if(this->distA != nullptr) {
+				delete this->distA;
+				this->distA = nullptr;
+			}
+
+			this->ghostStart.clear();
+			this->diagPos.clear();
+
+			this->remoteRows = false;
+			this->csrValueMap.clear();
+			this->csrMapped = false;
+
+			this->pcSetup = false;
+			this->pcInvDiag.clear();
+			this->pcILU.clear();
+
+			this->matrixASetup = false;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setValuesVectorX(T scalar) {
+			// Error Check that the vector has been setup
+			if(!this->vectorXSetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			std::fill(this->x.begin(), this->x.end(), scalar);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setValuesVectorX(T * scalars, I nScalars,
+																		   I * indexes, I nIndexes, I indexBase) {
+			// Error Check - Has the Vector X been setup
+			if(!this->vectorXSetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			return this->setLocalVectorValues(this->x, scalars, nScalars, indexes, nIndexes, indexBase);
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setValuesVectorB(T scalar) {
+			// Error Check that the vector has been setup
+			if(!this->vectorBSetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			std::fill(this->b.begin(), this->b.end(), scalar);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setValuesVectorB(T * scalars, I nScalars,
+																		   I * indexes, I nIndexes, I indexBase) {
+			// Error Check - Has the Vector B been setup
+			if(!this->vectorBSetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			return this->setLocalVectorValues(this->b, scalars, nScalars, indexes, nIndexes, indexBase);
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::clearVectorX() {
+			return this->setValuesVectorX(T(0));
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::clearVectorB() {
+			return this->setValuesVectorB(T(0));
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverNative<C,I,T>::reset() {
+			this->resetVectorX();
+			this->resetVectorB();
+			this->resetMatrixA();
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setupVectorX() {
+			this->resetVectorX();
+
+			this->x.assign(this->mLocal, T(0));
+			this->vectorXSetup = true;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setupVectorB() {
+			this->resetVectorB();
+
+			this->b.assign(this->mLocal, T(0));
+			this->vectorBSetup = true;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setupMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix) {
+			cupcfd::error::eCodes status;
+
+			// Reset any current matrix
+			this->resetMatrixA();
+
+			if(this->mGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_ROW_SIZE_UNSET;
+			}
+
+			if(this->nGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_COL_SIZE_UNSET;
+			}
+
+			// The Krylov methods need a square system
+			if(this->mGlobal != this->nGlobal) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+			}
+
+			I rowStart = this->rowRanges[this->comm.rank];
+			I rowEnd = this->rowRanges[this->comm.rank + 1];
+
+			// (1) Collect the non-zero positions of the local rows. Positions in rows owned by other processes
+			// are stored as (row, column) pairs to send to their owner.
+			std::vector<I> entryRows;
+			std::vector<I> entryCols;
+			std::vector<I> remoteEntries;
+			std::vector<int> remoteRanks;
+
+			status = visitMatrixEntries(matrix, [&](I row, I col, T) -> cupcfd::error::eCodes {
+				if(row < 0 || row >= this->mGlobal || col < 0 || col >= this->nGlobal) {
+					return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+				}
+
+				if(row >= rowStart && row < rowEnd) {
+					entryRows.push_back(row);
+					entryCols.push_back(col);
+				}
+				else {
+					int owner = this->getRowOwner(row);
+					remoteEntries.push_back(row);
+					remoteEntries.push_back(col);
+					remoteRanks.push_back(owner);
+					remoteRanks.push_back(owner);
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			});
+
+			// Every process must agree on an invalid entry before the collectives below, so the error
+			// is reduced along with whether any process stores rows it does not own
+			if(this->comm.size > 1) {
+				int localFlags[2] = {(status != cupcfd::error::E_SUCCESS) ? 1 : 0, (remoteEntries.size() > 0) ? 1 : 0};
+				int globalFlags[2];
+				cupcfd::error::eCodes visitStatus = status;
+
+				status = cupcfd::comm::allReduceMax(localFlags, 2, globalFlags, 2, this->comm);
+				CHECK_ECODE(status)
+
+				if(globalFlags[0] > 0) {
+					return (visitStatus != cupcfd::error::E_SUCCESS) ? visitStatus : cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+				}
+
+				this->remoteRows = (globalFlags[1] > 0);
+			}
+			else if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			if(this->remoteRows) {
+				I * recvEntries = nullptr;
+				int nRecvEntries = 0;
+
+				status = cupcfd::comm::AllToAll(remoteEntries.data(), int(remoteEntries.size()),
+												remoteRanks.data(), int(remoteRanks.size()),
+												&recvEntries, &nRecvEntries, this->comm);
+				CHECK_ECODE(status)
+
+				for(int i = 0; i < nRecvEntries; i = i + 2) {
+					entryRows.push_back(recvEntries[i]);
+					entryCols.push_back(recvEntries[i + 1]);
+				}
+
+				free(recvEntries);
+			}
+
+			// (2) Build the local rows with global indexes. The values are set later, so the structure is
+			// built with zeroes and repeated positions are merged.
+			cupcfd::data_structures::SparseMatrixCSR<I,T> ownedA(this->mGlobal, this->nGlobal, 0);
+			std::vector<T> entryValues(entryRows.size(), T(0));
+
+			status = ownedA.buildFromTriplets(entryRows.data(), entryCols.data(), entryValues.data(), I(entryRows.size()), false);
+			CHECK_ECODE(status)
+
+			// (3) Distribute the local rows. This renumbers the columns so the ghost columns come last in each
+			// row, and builds the exchange of the ghost column values of a vector.
+			cupcfd::comm::ExchangePatternConfig patternConfig(cupcfd::comm::EXCHANGE_NONBLOCKING_TWO_SIDED);
+			this->distA = new cupcfd::data_structures::DistributedSparseMatrixCSR<I,T>(this->comm, ownedA, rowStart, rowEnd, patternConfig);
+
+			// (4) Find where the ghost columns and the diagonal of each local row are, for the preconditioners
+			cupcfd::data_structures::SparseMatrixCSR<I,T>& localA = this->distA->localA;
+
+			this->ghostStart.resize(this->mLocal);
+			this->diagPos.assign(this->mLocal, -1);
+
+			for(I i = 0; i < this->mLocal; i++) {
+				this->ghostStart[i] = localA.IA[i + 1];
+
+				for(I k = localA.IA[i]; k < localA.IA[i + 1]; k++) {
+					if(localA.JA[k] == i) {
+						this->diagPos[i] = k;
+					}
+
+					if(localA.JA[k] >= this->mLocal) {
+						this->ghostStart[i] = k;
+						break;
+					}
+				}
+			}
+
+			// (5) If the matrix is a SparseMatrixCSR that only stores local rows, record where each of its values
+			// is placed so later matrices of the same structure can be copied in one pass
+			cupcfd::data_structures::SparseMatrixCSR<I,T> * csr = cupcfd::data_structures::getCSRMatrix(static_cast<C&>(matrix));
+
+			if(csr != nullptr && !this->remoteRows && csr->m == this->mGlobal) {
+				this->csrValueMap.resize(csr->JA.size());
+
+				for(I row = rowStart; row < rowEnd; row++) {
+					for(I k = csr->IA[row]; k < csr->IA[row + 1]; k++) {
+						this->csrValueMap[k] = this->getLocalPosition(row - rowStart, csr->JA[k] - csr->baseIndex);
+					}
+				}
+
+				this->csrMapped = true;
+			}
+
+			this->matrixASetup = true;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setup(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix) {
+			cupcfd::error::eCodes status;
+
+			// Create the vector X and zero it
+			status = setupVectorX();
+			CHECK_ECODE(status)
+
+			// Create the vector B and zero it
+			status = setupVectorB();
+			CHECK_ECODE(status)
+
+			// Create the matrix A, using the input Matrix to define the non-zero positions
+			status = setupMatrixA(matrix);
+			CHECK_ECODE(status)
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::setValuesMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix) {
+			cupcfd::error::eCodes status;
+
+			if(!this->matrixASetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+			}
+
+			// The preconditioner must be recomputed for the new values
+			this->pcSetup = false;
+
+			I rowStart = this->rowRanges[this->comm.rank];
+			I rowEnd = this->rowRanges[this->comm.rank + 1];
+
+			cupcfd::data_structures::SparseMatrixCSR<I,T> * csr = cupcfd::data_structures::getCSRMatrix(static_cast<C&>(matrix));
+
+			if(this->csrMapped && csr != nullptr && csr->m == this->mGlobal && csr->JA.size() == this->csrValueMap.size()
+			   && csr->IA[rowStart] == 0 && std::size_t(csr->IA[rowEnd]) == csr->JA.size()) {
+				// Same local structure as the setup matrix - copy the values straight into place
+				for(std::size_t k = 0; k < this->csrValueMap.size(); k++) {
+					this->distA->localA.A[this->csrValueMap[k]] = csr->A[k];
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			std::vector<I> remoteEntries;
+			std::vector<T> remoteValues;
+			std::vector<int> remoteEntryRanks;
+			std::vector<int> remoteValueRanks;
+
+			status = visitMatrixEntries(matrix, [&](I row, I col, T val) -> cupcfd::error::eCodes {
+				if(row >= rowStart && row < rowEnd) {
+					I pos = this->getLocalPosition(row - rowStart, col);
+
+					if(pos < 0) {
+						return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+					}
+
+					this->distA->localA.A[pos] = val;
+				}
+				else {
+					// Rows owned by another process can only be sent on if the setup matrix also had them
+					if(!this->remoteRows || row < 0 || row >= this->mGlobal) {
+						return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+					}
+
+					int owner = this->getRowOwner(row);
+					remoteEntries.push_back(row);
+					remoteEntries.push_back(col);
+					remoteEntryRanks.push_back(owner);
+					remoteEntryRanks.push_back(owner);
+					remoteValues.push_back(val);
+					remoteValueRanks.push_back(owner);
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			});
+
+			if(this->remoteRows) {
+				// Every process must agree on an invalid entry before sending on the remote entries
+				int localError = (status != cupcfd::error::E_SUCCESS) ? 1 : 0;
+				int globalError;
+				cupcfd::error::eCodes visitStatus = status;
+
+				status = cupcfd::comm::allReduceMax(&localError, 1, &globalError, 1, this->comm);
+				CHECK_ECODE(status)
+
+				if(globalError > 0) {
+					return (visitStatus != cupcfd::error::E_SUCCESS) ? visitStatus : cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+				}
+			}
+			else if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			if(this->remoteRows) {
+				I * recvEntries = nullptr;
+				int nRecvEntries = 0;
+				T * recvValues = nullptr;
+				int nRecvValues = 0;
+
+				status = cupcfd::comm::AllToAll(remoteEntries.data(), int(remoteEntries.size()),
+												remoteEntryRanks.data(), int(remoteEntryRanks.size()),
+												&recvEntries, &nRecvEntries, this->comm);
+				CHECK_ECODE(status)
+
+				status = cupcfd::comm::AllToAll(remoteValues.data(), int(remoteValues.size()),
+												remoteValueRanks.data(), int(remoteValueRanks.size()),
+												&recvValues, &nRecvValues, this->comm);
+				CHECK_ECODE(status)
+
+				for(int i = 0; i < nRecvValues; i++) {
+					I pos = this->getLocalPosition(recvEntries[i * 2] - rowStart, recvEntries[(i * 2) + 1]);
+
+					if(pos < 0) {
+						free(recvEntries);
+						free(recvValues);
+						return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+					}
+
+					this->distA->localA.A[pos] = recvValues[i];
+				}
+
+				free(recvEntries);
+				free(recvValues);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getValuesVectorX(T ** result, I * nResult) {
+			// Check the global row count is greater than 0
+			if(this->mGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_ROW_SIZE_UNSET;
+			}
+
+			// Check the Vector has been setup
+			if(!this->vectorXSetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			return this->getLocalVectorValues(this->x, result, nResult);
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getValuesVectorX(T ** result, I * nResult,
+																		   I * indexes, I nIndexes, I indexBase) {
+			// Check the global row count is greater than 0
+			if(this->mGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_ROW_SIZE_UNSET;
+			}
+
+			// Check the Vector has been setup
+			if(!this->vectorXSetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			return this->getLocalVectorValues(this->x, result, nResult, indexes, nIndexes, indexBase);
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getValuesVectorB(T ** result, I * nResult) {
+			// Check the global row count is greater than 0
+			if(this->mGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_ROW_SIZE_UNSET;
+			}
+
+			// Check the Vector has been setup
+			if(!this->vectorBSetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			return this->getLocalVectorValues(this->b, result, nResult);
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getValuesVectorB(T ** result, I * nResult,
+																		   I * indexes, I nIndexes, I indexBase) {
+			// Check the global row count is greater than 0
+			if(this->mGlobal <= 0) {
+				return cupcfd::error::E_LINEARSOLVER_ROW_SIZE_UNSET;
+			}
+
+			// Check the Vector has been setup
+			if(!this->vectorBSetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			return this->getLocalVectorValues(this->b, result, nResult, indexes, nIndexes, indexBase);
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::getValuesMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix) {
+			if(!this->matrixASetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+			}
+
+			I rowStart = this->rowRanges[this->comm.rank];
+			I rowEnd = this->rowRanges[this->comm.rank + 1];
+
+			return visitMatrixEntries(matrix, [&](I row, I col, T) -> cupcfd::error::eCodes {
+				if(row >= rowStart && row < rowEnd) {
+					I pos = this->getLocalPosition(row - rowStart, col);
+
+					if(pos >= 0) {
+						// The position already exists, so this does not change the structure being visited
+						return matrix.setElement(row + matrix.baseIndex, col + matrix.baseIndex, this->distA->localA.A[pos]);
+					}
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			});
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::clearMatrixA() {
+			if(!this->matrixASetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+			}
+
+			std::fill(this->distA->localA.A.begin(), this->distA->localA.A.end(), T(0));
+			this->pcSetup = false;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverNative<C,I,T>::solve() {
+			cupcfd::error::eCodes status;
+
+			if(!this->vectorXSetup || !this->vectorBSetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+			}
+
+			if(!this->matrixASetup) {
+				return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
+			}
+
+			if(!this->pcSetup) {
+				status = this->setupPreconditioner();
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+			}
+
+			if(this->method == NATIVE_SOLVER_BICGSTAB) {
+				status = this->solveBiCGStab();
+				CHECK_ECODE(status)
+			}
+			else {
+				status = this->solveCG();
+				CHECK_ECODE(status)
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::linearsolvers::LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, float>, int, float>;
+template class cupcfd::linearsolvers::LinearSolverNative<cupcfd::data_structures::SparseMatrixCOO<int, float>, int, float>;
+
+template class cupcfd::linearsolvers::LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double>;
+template class cupcfd::linearsolvers::LinearSolverNative<cupcfd::data_structures::SparseMatrixCOO<int, double>, int, double>;
@@ -23,15 +23,81 @@
 #include "DistributedAdjacencyList.h"
 
 #include "Reduce.h"
+#include "AllToAll.h"
 #include "ExchangePatternTwoSidedNonBlocking.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <type_traits>
+#include <vector>
 
 namespace cupcfd
 {
 	namespace linearsolvers
 	{
+		// === CSR Handoff Helpers ===
+
+		// Whether the CSR matrix stores exactly the rows rowStart to rowEnd - 1 of a matrix of mGlobal rows
+		// with zero based indexes, so that its arrays are in the form expected by MatCreateMPIAIJWithArrays.
+		template <class I, class T>
+		bool isCSRHandoffMatrix(cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix, PetscInt mGlobal,
+								PetscInt rowStart, PetscInt rowEnd) {
+			if(matrix.baseIndex != 0 || PetscInt(matrix.m) != mGlobal) {
+				return false;
+			}
+
+			if(matrix.IA.size() != std::size_t(matrix.m + 1) || matrix.A.size() != matrix.JA.size()) {
+				return false;
+			}
+
+			// No values may be stored in the rows before or after the local rows
+			return (matrix.IA[rowStart] == 0) && (std::size_t(matrix.IA[rowEnd]) == matrix.JA.size());
+		}
+
+		// Get the row pointers (starting from rowStart) and column indexes of the CSR matrix as PETSc indexes.
+		// They point into the matrix itself if the index types match, else the arrays are copied into the buffers.
+		template <class I, class T>
+		void getCSRHandoffIndexes(cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix, PetscInt rowStart, PetscInt rowEnd,
+								  std::vector<PetscInt>& rowPtrBuffer, std::vector<PetscInt>& colIndexBuffer,
+								  const PetscInt ** rowPtr, const PetscInt ** colIndexes) {
+			if(std::is_same<I, PetscInt>::value) {
+				*rowPtr = reinterpret_cast<const PetscInt *>(matrix.IA.data() + rowStart);
+				*colIndexes = reinterpret_cast<const PetscInt *>(matrix.JA.data());
+			}
+			else {
+				rowPtrBuffer.resize(rowEnd - rowStart + 1);
+				for(PetscInt i = rowStart; i <= rowEnd; i++) {
+					rowPtrBuffer[i - rowStart] = PetscInt(matrix.IA[i]);
+				}
+
+				colIndexBuffer.resize(matrix.JA.size());
+				for(std::size_t i = 0; i < matrix.JA.size(); i++) {
+					colIndexBuffer[i] = PetscInt(matrix.JA[i]);
+				}
+
+				*rowPtr = rowPtrBuffer.data();
+				*colIndexes = colIndexBuffer.data();
+			}
+		}
+
+		// Get the non-zero values of the CSR matrix as PETSc scalars. They point into the matrix itself
+		// if the data types match, else the values are copied into the buffer.
+		template <class I, class T>
+		const PetscScalar * getCSRHandoffValues(cupcfd::data_structures::SparseMatrixCSR<I,T>& matrix,
+												 std::vector<PetscScalar>& valueBuffer) {
+			if(std::is_same<T, PetscScalar>::value) {
+				return reinterpret_cast<const PetscScalar *>(matrix.A.data());
+			}
+
+			valueBuffer.resize(matrix.A.size());
+			for(std::size_t i = 0; i < matrix.A.size(); i++) {
+				valueBuffer[i] = PetscScalar(matrix.A[i]);
+			}
+
+			return valueBuffer.data();
+		}
+
 		// === Constructors/Deconstructors ===
 
 		template <class C, class I, class T>
@@ -54,6 +120,9 @@ namespace cupcfd
 			this->xRanges = nullptr;
 			this->aRanges = nullptr;
 
+			this->csrHandoff = false;
+			this->csrNNZ = 0;
+
 			status = this->setupVectorX();
 			HARD_CHECK_ECODE(status)
 			status = this->setupVectorB();
@@ -118,6 +187,12 @@ namespace cupcfd
 				// otherwise this would be a memory leak.
 				this->aRanges = nullptr;
 			}
+
+			this->csrHandoff = false;
+			this->csrNNZ = 0;
+			this->csrRowPtr.clear();
+			this->csrColIndexes.clear();
+			this->csrValues.clear();
 		}
 
 
@@ -403,8 +478,12 @@ namespace cupcfd
 
 		template <class C, class I, class T>
 		cupcfd::error::eCodes LinearSolverPETSc<C,I,T>::setupMatrixA(cupcfd::data_structures::SparseMatrix<C,I,T>& matrix) {
+			cupcfd::error::eCodes status;
 			PetscErrorCode err;
 
+			// Reset any current matrix
+			this->resetMatrixA();
+
 			// ToDo: Error Check - The Matrix Global Sizes must match the global sizes of the linear solver
 			// (even if it doesn't store that much data)
 
@@ -528,133 +607,197 @@ namespace cupcfd
 				free(indices);
 			}
 			else if(this->comm.size > 1) {
-				// Retrieve the non-zero structure from the SparseMatrix object and pass through to
-				// the PETSc matrix initialisation routine to help with preallocation.
-				// ToDo: This functionality should probably be moved to the SparseMatrix object itself, since it will
-				// probably be used more than once.
+				// Error Check: The local rows and columns of the matrix follow the ownership ranges of the vectors
+				if(this->bRanges == nullptr || this->xRanges == nullptr) {
+					return cupcfd::error::E_LINEARSOLVER_INVALID_VECTOR;
+				}
 
-				// Get the indexes of rows with non-zero values
-				int * nnzRows;
-				int nNNZRows;
-				// int nnzCount = 0;
-				err = matrix.getNonZeroRowIndexes(&nnzRows, &nNNZRows);
-				if (err != 0) {
-					return cupcfd::error::E_PETSC_ERROR;
+				PetscInt rowStart = this->bRanges[this->comm.rank];
+				PetscInt rowEnd = this->bRanges[this->comm.rank + 1];
+				PetscInt nLocal = this->xRanges[this->comm.rank + 1] - this->xRanges[this->comm.rank];
+
+				cupcfd::data_structures::SparseMatrixCSR<I,T> * csr = cupcfd::data_structures::getCSRMatrix(static_cast<C&>(matrix));
+
+				// (1) Check whether the CSR arrays can be handed to PETSc as they are. Creating the matrix is
+				// collective, so this must hold on every rank.
+				int localHandoff = 0;
+				if(csr != nullptr && isCSRHandoffMatrix(*csr, this->mGlobal, rowStart, rowEnd)) {
+					localHandoff = 1;
 				}
 
-				// Get the matrix local data sizes...
-				// I mLocal = 0;
+				int handoff;
+				status = cupcfd::comm::allReduceMin(&localHandoff, 1, &handoff, 1, this->comm);
+				CHECK_ECODE(status)
 
-				// Diagonal Count
-				int * d_nnz = (PetscInt *) malloc(sizeof(PetscInt) * this->mLocal);
+				if(handoff == 1) {
+					// (2a) Create the matrix directly from the CSR arrays. PETSc computes the exact diagonal and
+					// off-diagonal preallocation from them, and copies the values in one pass.
+					const PetscInt * rowPtr;
+					const PetscInt * colIndexes;
+					getCSRHandoffIndexes(*csr, rowStart, rowEnd, this->csrRowPtr, this->csrColIndexes, &rowPtr, &colIndexes);
+					const PetscScalar * values = getCSRHandoffValues(*csr, this->csrValues);
 
-				// Off-Diagonal Count
-				int * o_nnz = (PetscInt *) malloc(sizeof(PetscInt) * this->mLocal);
+					err = MatCreateMPIAIJWithArrays(this->comm.comm, this->mLocal, nLocal, this->mGlobal, this->nGlobal,
+													rowPtr, colIndexes, values, &(this->a));
+					if (err != 0) {
+						return cupcfd::error::E_PETSC_ERROR;
+					}
 
-				for(int i = 0; i < this->mLocal; i++) {
-					d_nnz[i] = 0;
-					o_nnz[i] = 0;
+					this->csrHandoff = true;
+					this->csrNNZ = csr->nnz;
 				}
+				else {
+					// (2b) Count the number of non-zero values of each local row in the diagonal and off-diagonal
+					// blocks for preallocation. This is best described at
+					// https://www.mcs.anl.gov/petsc/petsc-current/docs/manualpages/MatMPIAIJSetPreallocation
+					// A value of row r is in the diagonal block if its column lies in the column range of the rank
+					// that owns row r.
+					std::vector<PetscInt> dNNZ(this->mLocal, 0);
+					std::vector<PetscInt> oNNZ(this->mLocal, 0);
+
+					// Counts for rows that are stored here but owned by another rank, as (row, diagonal, off-diagonal)
+					std::vector<I> remoteCounts;
+					std::vector<int> remoteRanks;
+
+					// A failure to read the local rows is only agreed after the loop, so that every rank still
+					// reaches the collectives below. rowsStatus keeps the local error to return.
+					int localRowsValid = 1;
+					cupcfd::error::eCodes rowsStatus = cupcfd::error::E_SUCCESS;
+
+					I * nnzRows = nullptr;
+					I nNNZRows = 0;
+					status = matrix.getNonZeroRowIndexes(&nnzRows, &nNNZRows);
+					if(status != cupcfd::error::E_SUCCESS) {
+						localRowsValid = 0;
+						rowsStatus = status;
+						nnzRows = nullptr;
+						nNNZRows = 0;
+					}
 
-				// We need to count the number of diagonal and off-diagonal nnz values
-				// This is bet described at https://www.mcs.anl.gov/petsc/petsc-current/docs/manualpages/MatMPIAIJSetPreallocation
-				// but the intent is basically to subdivide the matrix into submatrices. If a non-zero occurs in the sub-matrix that
-				// sits on the diagonal of the global submatrices, then it is a diagonal nnz, else it is a off-diagonal non-zero value
+					for(I i = 0; i < nNNZRows; i++) {
+						I row = nnzRows[i] - matrix.baseIndex;
 
-				// IMPORTANT NOTE: This only works if we are assuming a couple of things, namely that the matrix rows are sequentially
-				// grouped across the ranks (i.e. Rank 0 has 0-4, Rank 1 has 5-7, Rank 2 has 8-10 etc) and we enforce the allocation
-				// of a local row size that is equivalent to this value. If not, we have a dilema since if we let PETSc decide the local
-				// size, or if the local space we are allocated is greater than the rows we have, then we don't have the information
-				// necessary to determine what the diagonal/non-diagonal components will look like
+						if(row < 0 || row >= this->mGlobal) {
+							localRowsValid = 0;
+							rowsStatus = cupcfd::error::E_MATRIX_ROW_OOB;
+							break;
+						}
 
-				// As such, this currently relies on the provided matrix following this pattern, but it is not enforced.
+						// The column indexes of a CSR matrix are read in place
+						I * nnzCols;
+						I nNNZCols;
 
-				/*
-				for(int i = 0; i < nNNZRows; i++) {
-					// For each row, get the column indexes and the number of columns (what we're actually interested in)
-					int * nnzCols;
-					int nNNZCols;
-					matrix.getRowColumnIndexes(nnzRows[i], &nnzCols, &nNNZCols);
-					nnzCount = nnzCount + nNNZCols;
+						if(csr != nullptr) {
+							nnzCols = csr->JA.data() + csr->IA[row];
+							nNNZCols = csr->IA[row + 1] - csr->IA[row];
+						}
+						else {
+							status = matrix.getRowColumnIndexes(nnzRows[i], &nnzCols, &nNNZCols);
+							if(status != cupcfd::error::E_SUCCESS) {
+								localRowsValid = 0;
+								rowsStatus = status;
+								break;
+							}
+						}
 
-					// Loop over the column indices of the non-zero values for this row.
-					// Determine whether a column lies in the diagonal sub-matrix, or one of the off-diagonal matrices
-					// The documentation suggests 3x3 matrices, so I presume that applies regardless of matrix size
-					// To do this, we take the column ID, and if it lies
+						int owner = int(std::upper_bound(this->bRanges, this->bRanges + this->comm.size + 1, PetscInt(row)) - this->bRanges) - 1;
+						PetscInt colStart = this->xRanges[owner];
+						PetscInt colEnd = this->xRanges[owner + 1];
 
-					int rowBaseZero = nnzRows[i] - matrix.baseIndex;
+						I dCount = 0;
+						I oCount = 0;
 
-					for(int j = 0; j < nNNZCols; j++) {
-						int colBaseZero = nnzCols[j] - matrix.baseIndex;
+						for(I j = 0; j < nNNZCols; j++) {
+							PetscInt col = nnzCols[j] - matrix.baseIndex;
+
+							if(col >= colStart && col < colEnd) {
+								dCount = dCount + 1;
+							}
+							else {
+								oCount = oCount + 1;
+							}
+						}
 
-						// Integer division important here
-						if((rowBaseZero/3) == (colBaseZero/3)) {
-							// NZ lies in diagonal matrix, increase count for this row by 1
-							d_nnz[i] = d_nnz[i] + 1;
+						if(csr == nullptr) {
+							free(nnzCols);
+						}
+
+						if(owner == this->comm.rank) {
+							dNNZ[row - rowStart] = dNNZ[row - rowStart] + dCount;
+							oNNZ[row - rowStart] = oNNZ[row - rowStart] + oCount;
 						}
 						else {
-							// NZ lies in off-diagonal matrix, increase count for this row by 1
-							o_nnz[i] = o_nnz[i] + 1;
+							remoteCounts.push_back(row);
+							remoteCounts.push_back(dCount);
+							remoteCounts.push_back(oCount);
+
+							for(int k = 0; k < 3; k++) {
+								remoteRanks.push_back(owner);
+							}
 						}
 					}
 
-					// Cleanup
-					free(nnzCols);
-				}
-				 */
+					free(nnzRows);
 
-				// Create the PETSc Matrix Object based on the input matrix object
-				// nz is set to PETSC_DEFAULT, but it should ignore it if nnz is set
+					// Sending the counts on is collective, so every rank must agree on a row outside the matrix
+					// (or a row that could not be read) first
+					int rowsValid;
+					status = cupcfd::comm::allReduceMin(&localRowsValid, 1, &rowsValid, 1, this->comm);
+					CHECK_ECODE(status)
 
-				// Create the Matrix Object
-				// Use the communicator assigned during setup
-				err = MatCreate(this->comm.comm, &(this->a));
-				if (err != 0) {
-					return cupcfd::error::E_PETSC_ERROR;
-				}
+					if(rowsValid == 0) {
+						return (rowsStatus != cupcfd::error::E_SUCCESS) ? rowsStatus : cupcfd::error::E_MATRIX_ROW_OOB;
+					}
 
-				// Set the Matrix Type to a Parallel MPI Matrix
-				err = MatSetType(this->a, MATMPIAIJ);
-				if (err != 0) {
-					return cupcfd::error::E_PETSC_ERROR;
-				}
+					// Send the counts of rows stored on the wrong rank to their owners. The order within
+					// each group is kept, so each count stays together.
+					I * recvCounts = nullptr;
+					int nRecvCounts;
+					status = cupcfd::comm::AllToAll(remoteCounts.data(), int(remoteCounts.size()),
+													remoteRanks.data(), int(remoteRanks.size()),
+													&recvCounts, &nRecvCounts, this->comm);
+					CHECK_ECODE(status)
 
-				// Set the global size of the matrix, leave the local size to PETSc
-				// Set the local rows to the rows of the matrix we have
-				// Set the local columns to be equivalent to the rows we have (since this affects the x vector)
-				err = MatSetSizes(this->a, PETSC_DECIDE, PETSC_DECIDE, this->mGlobal, this->nGlobal);
-				if (err != 0) {
-					return cupcfd::error::E_PETSC_ERROR;
-				}
+					for(int i = 0; i < nRecvCounts; i = i + 3) {
+						I row = recvCounts[i] - rowStart;
+						dNNZ[row] = dNNZ[row] + recvCounts[i + 1];
+						oNNZ[row] = oNNZ[row] + recvCounts[i + 2];
+					}
 
-				// IMPORTANT TODO: Fix the preallocation, setting of local sizes
+					free(recvCounts);
 
-				// Set the number of non-zero values per row for preallocation purposes
-				// For MPIAIJ we need to consider diagonal and off-diagonal values separately
+					// A row stored on more than one rank may count the same column twice, so keep each
+					// count within the size of its block.
+					for(PetscInt i = 0; i < this->mLocal; i++) {
+						dNNZ[i] = std::min(dNNZ[i], nLocal);
+						oNNZ[i] = std::min(oNNZ[i], PetscInt(this->nGlobal) - nLocal);
+					}
 
-				//MatMPIAIJSetPreallocation(this->a, NULL, d_nnz, NULL, o_nnz);
-				// Ideally want to use Preallocation, but just do basic setup for now
-				err = MatSetUp(this->a);
-				if (err != 0) {
-					return cupcfd::error::E_PETSC_ERROR;
-				}
+					// Create the Matrix Object
+					// Use the communicator assigned during setup
+					err = MatCreate(this->comm.comm, &(this->a));
+					if (err != 0) {
+						return cupcfd::error::E_PETSC_ERROR;
+					}
 
-				// Since introducing new non-zero location is expensive, disable their inclusion
-				// by ignoring the values and introducing a PETSc error
-				// Ideally all reuse of the matrix should have the same non-zero structure - new
-				// structures should create a different matrix to use.
-				// ToDo: Do we want to have a PETSc error - if we can catch the error we can introduce
-				// an error code....
-				// Remove this for now
-				//MatSetOption(this->a, MAT_NEW_NONZERO_LOCATIONS, PETSC_FALSE);
-				//MatSetOption(this->a, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
+					// Set the Matrix Type to a Parallel MPI Matrix
+					err = MatSetType(this->a, MATMPIAIJ);
+					if (err != 0) {
+						return cupcfd::error::E_PETSC_ERROR;
+					}
 
-				// Cleanup temporary storage
-				free(d_nnz);
-				free(o_nnz);
+					// Set the local sizes to match the vectors, so the counts above line up with the matrix rows
+					err = MatSetSizes(this->a, this->mLocal, nLocal, this->mGlobal, this->nGlobal);
+					if (err != 0) {
+						return cupcfd::error::E_PETSC_ERROR;
+					}
 
-				// Get Ownership Range for the Matrix
-				//MatGetOwnershipRanges(this->a, &(this->aRanges));
+					// For MPIAIJ the diagonal and off-diagonal values are preallocated separately
+					err = MatMPIAIJSetPreallocation(this->a, 0, dNNZ.data(), 0, oNNZ.data());
+					if (err != 0) {
+						return cupcfd::error::E_PETSC_ERROR;
+					}
+				}
 			}
 			else {
 				// Comm Size is less than 1 - Error
@@ -711,43 +854,118 @@ namespace cupcfd
 			}
 
 			cupcfd::error::eCodes status;
+			PetscErrorCode err;
 
-			// Get an array of the unique row indexes - we will set the values for these rows one by one
-			int * rowIndexes;
-			int nRowIndexes;
-			status = matrix.getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
-			CHECK_ECODE(status)
+			cupcfd::data_structures::SparseMatrixCSR<I,T> * csr = cupcfd::data_structures::getCSRMatrix(static_cast<C&>(matrix));
 
-			for(int i = 0; i < nRowIndexes; i++) {
-				// Get the columns ids for the row
-				int * columnIndexes;
-				int nColumnIndexes;
-				status = matrix.getRowColumnIndexes(rowIndexes[i], &columnIndexes, &nColumnIndexes);
-				CHECK_ECODE(status)
+			if(this->csrHandoff) {
+				// Matrix A was created from CSR arrays with the same structure, so only the values need to be
+				// passed on. MatUpdateMPIAIJWithArrays also assembles the matrix.
+				PetscInt rowStart = this->aRanges[this->comm.rank];
+				PetscInt rowEnd = this->aRanges[this->comm.rank + 1];
+				PetscInt nLocal = this->xRanges[this->comm.rank + 1] - this->xRanges[this->comm.rank];
 
-				// Get the nnz values for the row
-				T * nnzValues;
-				PetscScalar * petscNNZValues;
-				int nNNZValues;
-				status = matrix.getRowNNZValues(rowIndexes[i], &nnzValues, &nNNZValues);
+				// Updating the matrix is collective, so the structure must match on every rank, as in setupMatrixA
+				int localHandoff = 0;
+				if(csr != nullptr && csr->nnz == this->csrNNZ && isCSRHandoffMatrix(*csr, this->mGlobal, rowStart, rowEnd)) {
+					localHandoff = 1;
+				}
+
+				int handoff;
+				status = cupcfd::comm::allReduceMin(&localHandoff, 1, &handoff, 1, this->comm);
 				CHECK_ECODE(status)
 
-				// ToDo: Would like to omit this copy, and place data in array directly
-				// Could create new instance of getRowNNZValues, but would have to include PETSc header
-				petscNNZValues = (PetscScalar *) malloc(sizeof(PetscScalar) * nNNZValues);
-				for(int j = 0; j < nNNZValues; j++) {
-					petscNNZValues[j] = nnzValues[j];
+				if(handoff == 0) {
+					return cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX;
 				}
 
-				// Set the values in the PETSc matrix for this row
-				// ToDo: Is v. likely more efficient to do all rows at once -> build up a 2D array of values instead?
-				MatSetValues(this->a, 1, &rowIndexes[i], nColumnIndexes, columnIndexes, petscNNZValues, INSERT_VALUES);
+				// The indexes copied during setup can be reused, since the structure has not changed
+				const PetscInt * rowPtr = this->csrRowPtr.data();
+				const PetscInt * colIndexes = this->csrColIndexes.data();
+
+				if(std::is_same<I, PetscInt>::value) {
+					getCSRHandoffIndexes(*csr, rowStart, rowEnd, this->csrRowPtr, this->csrColIndexes, &rowPtr, &colIndexes);
+				}
+
+				const PetscScalar * values = getCSRHandoffValues(*csr, this->csrValues);
+
+				err = MatUpdateMPIAIJWithArrays(this->a, this->mLocal, nLocal, this->mGlobal, this->nGlobal,
+												rowPtr, colIndexes, values);
+				if (err != 0) {
+					return cupcfd::error::E_PETSC_ERROR;
+				}
 
-				free(columnIndexes);
-				free(nnzValues);
+				return cupcfd::error::E_SUCCESS;
 			}
 
-			free(rowIndexes);
+			if(csr != nullptr) {
+				// Read each row from the CSR arrays in place, only converting to the PETSc index/data types and
+				// removing the base index. The buffers are reused for every row.
+				std::vector<PetscInt> colBuffer;
+				std::vector<PetscScalar> valueBuffer;
+
+				for(I row = 0; row < csr->m; row++) {
+					I start = csr->IA[row];
+					I nCols = csr->IA[row + 1] - start;
+
+					if(nCols == 0) {
+						continue;
+					}
+
+					colBuffer.resize(nCols);
+					valueBuffer.resize(nCols);
+
+					for(I j = 0; j < nCols; j++) {
+						colBuffer[j] = PetscInt(csr->JA[start + j] - csr->baseIndex);
+						valueBuffer[j] = PetscScalar(csr->A[start + j]);
+					}
+
+					PetscInt petscRow = row;
+					err = MatSetValues(this->a, 1, &petscRow, nCols, colBuffer.data(), valueBuffer.data(), INSERT_VALUES);
+					if (err != 0) {
+						return cupcfd::error::E_PETSC_ERROR;
+					}
+				}
+			}
+			else {
+				// Get an array of the unique row indexes - we will set the values for these rows one by one
+				int * rowIndexes;
+				int nRowIndexes;
+				status = matrix.getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
+				CHECK_ECODE(status)
+
+				for(int i = 0; i < nRowIndexes; i++) {
+					// Get the columns ids for the row
+					int * columnIndexes;
+					int nColumnIndexes;
+					status = matrix.getRowColumnIndexes(rowIndexes[i], &columnIndexes, &nColumnIndexes);
+					CHECK_ECODE(status)
+
+					// Get the nnz values for the row
+					T * nnzValues;
+					PetscScalar * petscNNZValues;
+					int nNNZValues;
+					status = matrix.getRowNNZValues(rowIndexes[i], &nnzValues, &nNNZValues);
+					CHECK_ECODE(status)
+
+					// ToDo: Would like to omit this copy, and place data in array directly
+					// Could create new instance of getRowNNZValues, but would have to include PETSc header
+					petscNNZValues = (PetscScalar *) malloc(sizeof(PetscScalar) * nNNZValues);
+					for(int j = 0; j < nNNZValues; j++) {
+						petscNNZValues[j] = nnzValues[j];
+					}
+
+					// Set the values in the PETSc matrix for this row
+					// ToDo: Is v. likely more efficient to do all rows at once -> build up a 2D array of values instead?
+					MatSetValues(this->a, 1, &rowIndexes[i], nColumnIndexes, columnIndexes, petscNNZValues, INSERT_VALUES);
+
+					free(columnIndexes);
+					free(nnzValues);
+					free(petscNNZValues);
+				}
+
+				free(rowIndexes);
+			}
 
 			// ToDo: Do we want to use MAT_FINAL_ASSEMBLY here?
 			// Presumably this will be more expensive
@@ -0,0 +1,83 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the definitions for the LinearSolverConfigNative class
+ */
+
+#include "LinearSolverConfigNative.h"
+#include "Communicator.h"
+
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixCOO.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		template <class C, class I, class T>
+		LinearSolverConfigNative<C,I,T>::LinearSolverConfigNative(NativeSolverMethod method, NativePreconditioner preconditioner,
+																  T eTol, T rTol, I maxIterations)
+		: LinearSolverConfig<C,I,T>(),
+		  method(method),
+		  preconditioner(preconditioner),
+		  rTol(rTol),
+		  eTol(eTol),
+		  maxIterations(maxIterations)
+		{
+
+		}
+
+		template <class C, class I, class T>
+		LinearSolverConfigNative<C,I,T>::LinearSolverConfigNative(const LinearSolverConfigNative<C,I,T>& source)
+		{
+			*this = source;
+		}
+
+		template <class C, class I, class T>
+		LinearSolverConfigNative<C,I,T>::~LinearSolverConfigNative()
+		{
+
+		}
+
+		template <class C, class I, class T>
+		void LinearSolverConfigNative<C,I,T>::operator=(const LinearSolverConfigNative<C,I,T>& source)
+		{
+			this->method = source.method;
+			this->preconditioner = source.preconditioner;
+			this->eTol = source.eTol;
+			this->rTol = source.rTol;
+			this->maxIterations = source.maxIterations;
+		}
+
+		template <class C, class I, class T>
+		LinearSolverConfigNative<C,I,T> * LinearSolverConfigNative<C,I,T>::clone()
+		{
+			return new LinearSolverConfigNative<C,I,T>(*this);
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNative<C,I,T>::buildLinearSolver(LinearSolverInterface<C,I,T> ** solverSystem,
+																					  cupcfd::data_structures::SparseMatrix<C,I,T>& matrix,
+																					  cupcfd::comm::Communicator& solverComm)
+		{
+			// Create the Native Linear Solver Object
+			*solverSystem = new LinearSolverNative<C,I,T>(solverComm, this->method, this->preconditioner,
+														  this->rTol, this->eTol, this->maxIterations, matrix);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::linearsolvers::LinearSolverConfigNative<cupcfd::data_structures::SparseMatrixCSR<int,float>, int, float>;
+template class cupcfd::linearsolvers::LinearSolverConfigNative<cupcfd::data_structures::SparseMatrixCSR<int,double>, int, double>;
+
+template class cupcfd::linearsolvers::LinearSolverConfigNative<cupcfd::data_structures::SparseMatrixCOO<int,float>, int, float>;
+template class cupcfd::linearsolvers::LinearSolverConfigNative<cupcfd::data_structures::SparseMatrixCOO<int,double>, int, double>;
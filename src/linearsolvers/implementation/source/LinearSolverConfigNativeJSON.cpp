@@ -0,0 +1,206 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Definitions for the LinearSolverConfigNativeJSON class.
+ */
+
+#include "LinearSolverConfigNativeJSON.h"
+
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixCOO.h"
+
+namespace cupcfd
+{
+	namespace linearsolvers
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class C, class I, class T>
+		LinearSolverConfigNativeJSON<C,I,T>::LinearSolverConfigNativeJSON(Json::Value& parseJSON)
+		:LinearSolverConfigSource<C,I,T>()
+		{
+			this->configData = parseJSON;
+		}
+
+		template <class C, class I, class T>
+		LinearSolverConfigNativeJSON<C,I,T>::~LinearSolverConfigNativeJSON()
+		{
+			// Nothing to do currently
+		}
+
+		// === Concrete Methods ===
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getMethod(NativeSolverMethod * method) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("Method")) {
+				// Access the correct field
+				dataSourceType = this->configData["Method"];
+
+				// Check the value and return the appropriate ID
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType == "CG") {
+					*method = NATIVE_SOLVER_CG;
+					return cupcfd::error::E_SUCCESS;
+				}
+				else if(dataSourceType == "BiCGStab") {
+					*method = NATIVE_SOLVER_BICGSTAB;
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getPreconditioner(NativePreconditioner * preconditioner) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("Preconditioner")) {
+				// Access the correct field
+				dataSourceType = this->configData["Preconditioner"];
+
+				// Check the value and return the appropriate ID
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType == "None") {
+					*preconditioner = NATIVE_PC_NONE;
+					return cupcfd::error::E_SUCCESS;
+				}
+				else if(dataSourceType == "Jacobi") {
+					*preconditioner = NATIVE_PC_JACOBI;
+					return cupcfd::error::E_SUCCESS;
+				}
+				else if(dataSourceType == "BlockJacobiILU0") {
+					*preconditioner = NATIVE_PC_BJACOBI_ILU0;
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getETol(T * eTol) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("eTol")) {
+				// Access the correct field
+				dataSourceType = this->configData["eTol"];
+
+				// Check the value and return the appropriate ID
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					*eTol = T(dataSourceType.asDouble());
+					return cupcfd::error::E_SUCCESS;
+				}
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getRTol(T * rTol) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("rTol")) {
+				// Access the correct field
+				dataSourceType = this->configData["rTol"];
+
+				// Check the value and return the appropriate ID
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else {
+					*rTol = T(dataSourceType.asDouble());
+					return cupcfd::error::E_SUCCESS;
+				}
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::getMaxIterations(I * maxIterations) {
+			Json::Value dataSourceType;
+
+			if(this->configData.isMember("MaxIterations")) {
+				// Access the correct field
+				dataSourceType = this->configData["MaxIterations"];
+
+				// Check the value and return the appropriate ID
+				if(dataSourceType == Json::Value::null) {
+					return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+				}
+				else if(dataSourceType.isIntegral() && dataSourceType.asLargestInt() > 0) {
+					*maxIterations = I(dataSourceType.asLargestInt());
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class C, class I, class T>
+		cupcfd::error::eCodes LinearSolverConfigNativeJSON<C,I,T>::buildLinearSolverConfig(LinearSolverConfig<C,I,T> ** linearSolverConfig) {
+			cupcfd::error::eCodes status;
+
+			NativeSolverMethod method;
+			NativePreconditioner preconditioner;
+			T eTol, rTol;
+			I maxIterations;
+
+			status = this->getMethod(&method);
+			CHECK_ECODE(status)
+
+			status = this->getPreconditioner(&preconditioner);
+			CHECK_ECODE(status)
+
+			status = this->getETol(&eTol);
+			CHECK_ECODE(status)
+
+			status = this->getRTol(&rTol);
+			CHECK_ECODE(status)
+
+			// Optional - use the default if not present
+			status = this->getMaxIterations(&maxIterations);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				maxIterations = 10000;
+			}
+			else if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			*linearSolverConfig = new LinearSolverConfigNative<C,I,T>(method, preconditioner, eTol, rTol, maxIterations);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+template class cupcfd::linearsolvers::LinearSolverConfigNativeJSON<cupcfd::data_structures::SparseMatrixCSR<int,float>, int, float>;
+template class cupcfd::linearsolvers::LinearSolverConfigNativeJSON<cupcfd::data_structures::SparseMatrixCSR<int,double>, int, double>;
+
+template class cupcfd::linearsolvers::LinearSolverConfigNativeJSON<cupcfd::data_structures::SparseMatrixCOO<int,float>, int, float>;
+template class cupcfd::linearsolvers::LinearSolverConfigNativeJSON<cupcfd::data_structures::SparseMatrixCOO<int,double>, int, double>;
@@ -14,6 +14,9 @@
 #include "PartitionerParmetis.h"
 #include "AllToAll.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace cupcfd
 {
 	namespace partitioner
@@ -287,8 +290,7 @@ namespace cupcfd
 			this->nAdjwgt = 0;
 
 			// Set to 0 to indicate neither vertex or edges are weighted
-			// ToDo: Reviewing later - I declared this as local - not used??
-			// idx_t wgtflag = 0;
+			this->wgtflag = 0;
 		}
 
 		template <class I, class T>
@@ -409,22 +411,60 @@ namespace cupcfd
 
 			// === Run Partitioner ===
 			// This is an external function call to the PARMETIS library - it computes the partition.
-			int ret = ParMETIS_V3_PartKway(this->vtxdist,
-										   this->xadj,
-										   this->adjncy,
-										   vwgt,
-										   adjwgt,
-										   &this->wgtflag,
-										   &this->numflag,
-										   &this->nCon,
-										   &this->nParts,
-										   this->tpwgts.data(),
-										   this->ubvec.data(),
-										   this->options,
-										   &this->edgecut,
-										   this->result,
-										   &(this->workComm.comm)
-										   );
+			int ret;
+
+			if(vwgt != NULL) {
+				// Vertex weights are set, so the nodes are being rebalanced from their current distribution.
+				// AdaptiveRepart takes the current process of each node as the existing partition, and
+				// trades the edge cut against the number of nodes that move.
+				// ipc2redist is the ratio of the inter-process communication cost to the redistribution cost.
+				if(this->nParts != this->workComm.size) {
+					return cupcfd::error::E_PARMETIS_INVALID_NPARTS;
+				}
+
+				real_t ipc2redist = 1000.0;
+
+				for(I i = 0; i < this->nNodes; i++) {
+					this->result[i] = this->workComm.rank;
+				}
+
+				ret = ParMETIS_V3_AdaptiveRepart(this->vtxdist,
+												 this->xadj,
+												 this->adjncy,
+												 vwgt,
+												 NULL,
+												 adjwgt,
+												 &this->wgtflag,
+												 &this->numflag,
+												 &this->nCon,
+												 &this->nParts,
+												 this->tpwgts.data(),
+												 this->ubvec.data(),
+												 &ipc2redist,
+												 this->options,
+												 &this->edgecut,
+												 this->result,
+												 &(this->workComm.comm)
+												 );
+			}
+			else {
+				ret = ParMETIS_V3_PartKway(this->vtxdist,
+											   this->xadj,
+											   this->adjncy,
+											   vwgt,
+											   adjwgt,
+											   &this->wgtflag,
+											   &this->numflag,
+											   &this->nCon,
+											   &this->nParts,
+											   this->tpwgts.data(),
+											   this->ubvec.data(),
+											   this->options,
+											   &this->edgecut,
+											   this->result,
+											   &(this->workComm.comm)
+											   );
+			}
 
 			// N.B.Parmetis manual states this is METIS_ERROR (i.e. not PARMETIS_ERROR)
 			if(ret == METIS_ERROR) {
@@ -434,6 +474,33 @@ namespace cupcfd
 			return cupcfd::error::E_SUCCESS;
 		}
 
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerParmetis<I,T>::setNodeWeights(double * weights, I nWeights) {
+			if(nWeights != this->nNodes) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			for(I i = 0; i < nWeights; i++) {
+				if(!(weights[i] > 0.0)) {
+					return cupcfd::error::E_PARTITIONER_INVALID_NODE_WEIGHTS;
+				}
+			}
+
+			this->resetVertexEdgeWeights();
+
+			this->vwgt = (idx_t *) malloc(sizeof(idx_t) * nWeights);
+			this->nVwgt = nWeights;
+
+			for(I i = 0; i < nWeights; i++) {
+				this->vwgt[i] = std::max(idx_t(1), idx_t(std::llround(weights[i])));
+			}
+
+			// Only the vertices are weighted
+			this->wgtflag = 2;
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
 		template <class I, class T>
 		cupcfd::error::eCodes PartitionerParmetis<I,T>::initialise(cupcfd::data_structures::DistributedAdjacencyList<I, T>& graph, I nParts) {
 			cupcfd::error::eCodes status;
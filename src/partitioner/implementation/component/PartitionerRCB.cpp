@@ -0,0 +1,214 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the PartitionerRCB class
+ */
+
+#include "PartitionerRCB.h"
+#include "Reduce.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		template <class I, class T>
+		PartitionerRCB<I,T>::PartitionerRCB(cupcfd::comm::Communicator& workComm)
+		: PartitionerGeometric<I,T>(workComm)
+		{
+
+		}
+
+		template <class I, class T>
+		PartitionerRCB<I,T>::PartitionerRCB(cupcfd::data_structures::DistributedAdjacencyList<I,T>& sourceGraph, int nParts)
+		: PartitionerGeometric<I,T>(sourceGraph, nParts)
+		{
+
+		}
+
+		template <class I, class T>
+		PartitionerRCB<I,T>::~PartitionerRCB()
+		{
+			// Nothing to do in this subclass.
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerRCB<I,T>::partition() {
+			cupcfd::error::eCodes status;
+
+			// Error Check: Check that nParts is set
+			if(this->getNParts() == 0) {
+				return cupcfd::error::E_PARTITIONER_NPARTS_UNSET;
+			}
+
+			// Error Check: Ensure that there is data in the node store.
+			if(this->nodes == nullptr) {
+				return cupcfd::error::E_PARTITIONER_MISSING_NODE_DATA;
+			}
+
+			// Error Check: Ensure that every node has coordinates
+			if(this->nCoords != this->nNodes * 3) {
+				return cupcfd::error::E_PARTITIONER_MISSING_COORDINATE_DATA;
+			}
+
+			I nParts = this->nParts;
+
+			// Each group of nodes is identified by the first partition it covers. groups holds the first partition
+			// and the number of partitions of every group - these only depend on nParts, so every process holds
+			// the same list.
+			std::vector<std::pair<I,I>> groups(1, std::make_pair(I(0), nParts));
+
+			// The group of each node, and the number of partitions that group covers
+			std::vector<I> nodeGroup(this->nNodes, 0);
+			std::vector<I> nodeGroupNParts(this->nNodes, nParts);
+
+			std::vector<double> localLower(nParts * 3);
+			std::vector<double> localUpper(nParts * 3);
+			std::vector<double> localWeight(nParts);
+			std::vector<double> lower(nParts * 3);
+			std::vector<double> upper(nParts * 3);
+			std::vector<double> weight(nParts);
+			std::vector<double> groupStart(nParts);
+			std::vector<int> groupAxis(nParts);
+
+			std::vector<double> nodeWeights;
+			this->getNodeWeights(nodeWeights);
+
+			std::vector<long> primary(this->nNodes);
+			std::vector<double> secondary(this->nNodes);
+			std::vector<I> positions(this->nNodes);
+			std::vector<double> weightBefore(this->nNodes);
+
+			bool split = (nParts > 1);
+
+			while(split) {
+				// (1) Find the bounding box and the total node weight of each group across all processes
+				std::fill(localLower.begin(), localLower.end(), std::numeric_limits<double>::max());
+				std::fill(localUpper.begin(), localUpper.end(), std::numeric_limits<double>::lowest());
+				std::fill(localWeight.begin(), localWeight.end(), 0.0);
+
+				for(I i = 0; i < this->nNodes; i++) {
+					I g = nodeGroup[i];
+					localWeight[g] = localWeight[g] + nodeWeights[i];
+
+					for(int d = 0; d < 3; d++) {
+						localLower[g * 3 + d] = std::min(localLower[g * 3 + d], this->coords[i * 3 + d]);
+						localUpper[g * 3 + d] = std::max(localUpper[g * 3 + d], this->coords[i * 3 + d]);
+					}
+				}
+
+				status = cupcfd::comm::allReduceMin(localLower.data(), nParts * 3, lower.data(), nParts * 3, this->workComm);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				status = cupcfd::comm::allReduceMax(localUpper.data(), nParts * 3, upper.data(), nParts * 3, this->workComm);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				status = cupcfd::comm::allReduceAdd(localWeight.data(), nParts, weight.data(), nParts, this->workComm);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				// (2) Cut each group normal to the longest side of its bounding box
+				for(std::size_t k = 0; k < groups.size(); k++) {
+					I g = groups[k].first;
+					groupAxis[g] = 0;
+
+					for(int d = 1; d < 3; d++) {
+						if((upper[g * 3 + d] - lower[g * 3 + d]) > (upper[g * 3 + groupAxis[g]] - lower[g * 3 + groupAxis[g]])) {
+							groupAxis[g] = d;
+						}
+					}
+				}
+
+				// (3) Order the nodes of every group along its axis in one sort. Sorting by group first keeps
+				// the nodes of each group together, starting after the nodes of all lower groups.
+				for(I i = 0; i < this->nNodes; i++) {
+					primary[i] = long(nodeGroup[i]);
+					secondary[i] = this->coords[i * 3 + groupAxis[nodeGroup[i]]];
+				}
+
+				status = this->computeSortedPositions(primary.data(), this->nNodes, secondary.data(), this->nNodes,
+													  nodeWeights.data(), this->nNodes,
+													  positions.data(), this->nNodes, weightBefore.data(), this->nNodes);
+				if(status != cupcfd::error::E_SUCCESS) {
+					return status;
+				}
+
+				double start = 0.0;
+				for(I g = 0; g < nParts; g++) {
+					groupStart[g] = start;
+					start = start + weight[g];
+				}
+
+				// (4) Nodes below the cut move to the lower half of the partitions of their group, the rest
+				// to the upper half. The cut is placed so that the weight on each side is in proportion to the
+				// number of partitions on that side, and each node goes to the side that holds the middle of its weight.
+				for(I i = 0; i < this->nNodes; i++) {
+					I g = nodeGroup[i];
+					I groupNParts = nodeGroupNParts[i];
+
+					if(groupNParts > 1) {
+						I lowerNParts = groupNParts / 2;
+						double cut = (weight[g] * lowerNParts) / groupNParts;
+
+						if((weightBefore[i] - groupStart[g] + 0.5 * nodeWeights[i]) < cut) {
+							nodeGroupNParts[i] = lowerNParts;
+						}
+						else {
+							nodeGroup[i] = g + lowerNParts;
+							nodeGroupNParts[i] = groupNParts - lowerNParts;
+						}
+					}
+				}
+
+				std::vector<std::pair<I,I>> nextGroups;
+				split = false;
+
+				for(std::size_t k = 0; k < groups.size(); k++) {
+					I g = groups[k].first;
+					I groupNParts = groups[k].second;
+
+					if(groupNParts > 1) {
+						I lowerNParts = groupNParts / 2;
+						nextGroups.push_back(std::make_pair(g, lowerNParts));
+						nextGroups.push_back(std::make_pair(g + lowerNParts, groupNParts - lowerNParts));
+						split = split || (lowerNParts > 1) || ((groupNParts - lowerNParts) > 1);
+					}
+					else {
+						nextGroups.push_back(groups[k]);
+					}
+				}
+
+				groups = nextGroups;
+			}
+
+			// Once every group covers a single partition, the group identifier is the partition
+			this->resetResultStorage();
+			this->result = (I *) malloc(sizeof(I) * this->nNodes);
+			this->nResult = this->nNodes;
+
+			for(I i = 0; i < this->nNodes; i++) {
+				this->result[i] = nodeGroup[i];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::partitioner::PartitionerRCB<int,int>;
@@ -0,0 +1,164 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the PartitionerSFC class
+ */
+
+#include "PartitionerSFC.h"
+#include "Reduce.h"
+#include "UnstructuredMeshReordering.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		template <class I, class T>
+		PartitionerSFC<I,T>::PartitionerSFC(cupcfd::comm::Communicator& workComm, PartitionerSFCCurve curve)
+		: PartitionerGeometric<I,T>(workComm),
+		  curve(curve)
+		{
+
+		}
+
+		template <class I, class T>
+		PartitionerSFC<I,T>::PartitionerSFC(cupcfd::data_structures::DistributedAdjacencyList<I,T>& sourceGraph, int nParts,
+											PartitionerSFCCurve curve)
+		: PartitionerGeometric<I,T>(sourceGraph, nParts),
+		  curve(curve)
+		{
+
+		}
+
+		template <class I, class T>
+		PartitionerSFC<I,T>::~PartitionerSFC()
+		{
+			// Nothing to do in this subclass.
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerSFC<I,T>::partition() {
+			cupcfd::error::eCodes status;
+
+			// Error Check: Check that nParts is set
+			if(this->getNParts() == 0) {
+				return cupcfd::error::E_PARTITIONER_NPARTS_UNSET;
+			}
+
+			// Error Check: Ensure that there is data in the node store.
+			if(this->nodes == nullptr) {
+				return cupcfd::error::E_PARTITIONER_MISSING_NODE_DATA;
+			}
+
+			// Error Check: Ensure that every node has coordinates
+			if(this->nCoords != this->nNodes * 3) {
+				return cupcfd::error::E_PARTITIONER_MISSING_COORDINATE_DATA;
+			}
+
+			// (1) Find the bounding box of the nodes across all processes
+			double localLower[3];
+			double localUpper[3];
+			for(int d = 0; d < 3; d++) {
+				localLower[d] = std::numeric_limits<double>::max();
+				localUpper[d] = std::numeric_limits<double>::lowest();
+			}
+
+			for(I i = 0; i < this->nNodes; i++) {
+				for(int d = 0; d < 3; d++) {
+					localLower[d] = std::min(localLower[d], this->coords[i * 3 + d]);
+					localUpper[d] = std::max(localUpper[d], this->coords[i * 3 + d]);
+				}
+			}
+
+			double lower[3];
+			double upper[3];
+
+			status = cupcfd::comm::allReduceMin(localLower, 3, lower, 3, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			status = cupcfd::comm::allReduceMax(localUpper, 3, upper, 3, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			std::vector<double> nodeWeights;
+			this->getNodeWeights(nodeWeights);
+
+			double localWeight = 0.0;
+			for(I i = 0; i < this->nNodes; i++) {
+				localWeight = localWeight + nodeWeights[i];
+			}
+
+			double totalWeight;
+			status = cupcfd::comm::allReduceAdd(&localWeight, 1, &totalWeight, 1, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			// (2) Find the position of each node along the curve. The same scale is used in every dimension so
+			// that the curve is not distorted for elongated domains.
+			const int nBits = 21;
+			const double maxCoord = double((std::uint32_t(1) << nBits) - 1);
+
+			double extent = 0.0;
+			for(int d = 0; d < 3; d++) {
+				extent = std::max(extent, upper[d] - lower[d]);
+			}
+
+			double scale = (extent > 0.0) ? (maxCoord / extent) : 0.0;
+
+			std::vector<long> curveKey(this->nNodes);
+			std::vector<double> secondary(this->nNodes, 0.0);
+			std::vector<double> weightBefore(this->nNodes);
+
+			for(I i = 0; i < this->nNodes; i++) {
+				std::uint32_t X[3];
+
+				for(int d = 0; d < 3; d++) {
+					double pos = (this->coords[i * 3 + d] - lower[d]) * scale;
+					X[d] = std::uint32_t(std::min(std::max(pos, 0.0), maxCoord));
+				}
+
+				// The key has at most 63 bits, so it fits in a signed long
+				curveKey[i] = long(cupcfd::geometry::mesh::computeCurveKey(X, nBits, this->curve == PARTITIONER_SFC_HILBERT));
+			}
+
+			// (3) Order the nodes along the curve across all processes
+			std::vector<I> positions(this->nNodes);
+			status = this->computeSortedPositions(curveKey.data(), this->nNodes, secondary.data(), this->nNodes,
+												  nodeWeights.data(), this->nNodes,
+												  positions.data(), this->nNodes, weightBefore.data(), this->nNodes);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			// (4) Cut the curve into nParts pieces of equal weight. Each node goes to the piece that holds the
+			// middle of its weight, so with unit weights the pieces differ in size by at most one node.
+			this->resetResultStorage();
+			this->result = (I *) malloc(sizeof(I) * this->nNodes);
+			this->nResult = this->nNodes;
+
+			for(I i = 0; i < this->nNodes; i++) {
+				I part = I(((weightBefore[i] + 0.5 * nodeWeights[i]) * this->nParts) / totalWeight);
+				this->result[i] = std::min(part, this->nParts - 1);
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::partitioner::PartitionerSFC<int,int>;
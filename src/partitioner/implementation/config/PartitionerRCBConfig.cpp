@@ -0,0 +1,71 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the class definitions for the PartitionerRCBConfig class.
+ */
+
+// Base Class
+#include "PartitionerRCBConfig.h"
+
+// Partitioner Specialisation Class
+#include "PartitionerRCB.h"
+
+// Communicator
+#include "Communicator.h"
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		PartitionerRCBConfig<I,T>::PartitionerRCBConfig()
+		:PartitionerConfig<I,T>()
+		{
+			// Nothing to do currently
+		}
+
+		template <class I, class T>
+		PartitionerRCBConfig<I,T>::~PartitionerRCBConfig()
+		{
+			// Nothing to do currently
+		}
+
+		template <class I, class T>
+		PartitionerRCBConfig<I,T> * PartitionerRCBConfig<I,T>::clone()
+		{
+			return new PartitionerRCBConfig(*this);
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerRCBConfig<I,T>::buildPartitioner(PartitionerInterface<I,T> ** part)
+		{
+			// Currently hard-coded to use clone of MPI_COMM_WORLD
+			cupcfd::comm::Communicator workComm(MPI_COMM_WORLD);
+
+			*part = new PartitionerRCB<I,T>(workComm);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerRCBConfig<I,T>::buildPartitioner(PartitionerInterface<I,T> ** part,
+																				 cupcfd::data_structures::DistributedAdjacencyList<I,T>& partGraph)
+		{
+			*part = new PartitionerRCB<I,T>(partGraph, partGraph.comm->size);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::partitioner::PartitionerRCBConfig<int, int>;
+
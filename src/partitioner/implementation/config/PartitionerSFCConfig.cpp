@@ -0,0 +1,72 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains the class definitions for the PartitionerSFCConfig class.
+ */
+
+// Base Class
+#include "PartitionerSFCConfig.h"
+
+// Partitioner Specialisation Class
+#include "PartitionerSFC.h"
+
+// Communicator
+#include "Communicator.h"
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		PartitionerSFCConfig<I,T>::PartitionerSFCConfig(PartitionerSFCCurve curve)
+		:PartitionerConfig<I,T>(),
+		 curve(curve)
+		{
+
+		}
+
+		template <class I, class T>
+		PartitionerSFCConfig<I,T>::~PartitionerSFCConfig()
+		{
+			// Nothing to do currently
+		}
+
+		template <class I, class T>
+		PartitionerSFCConfig<I,T> * PartitionerSFCConfig<I,T>::clone()
+		{
+			return new PartitionerSFCConfig(*this);
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerSFCConfig<I,T>::buildPartitioner(PartitionerInterface<I,T> ** part)
+		{
+			// Currently hard-coded to use clone of MPI_COMM_WORLD
+			cupcfd::comm::Communicator workComm(MPI_COMM_WORLD);
+
+			*part = new PartitionerSFC<I,T>(workComm, this->curve);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerSFCConfig<I,T>::buildPartitioner(PartitionerInterface<I,T> ** part,
+																				 cupcfd::data_structures::DistributedAdjacencyList<I,T>& partGraph)
+		{
+			*part = new PartitionerSFC<I,T>(partGraph, partGraph.comm->size, this->curve);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::partitioner::PartitionerSFCConfig<int, int>;
+
@@ -0,0 +1,90 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Definition for the PartitionerSFCConfigSourceJSON class.
+ */
+
+// Header for this class
+#include "PartitionerSFCConfigSourceJSON.h"
+#include "PartitionerSFCConfig.h"
+
+// File access for reading into JSON structures
+#include <fstream>
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		PartitionerSFCConfigSourceJSON<I,T>::PartitionerSFCConfigSourceJSON(Json::Value& parseJSON)
+		{
+			this->configData = parseJSON;
+		}
+
+		template <class I, class T>
+		PartitionerSFCConfigSourceJSON<I,T>::~PartitionerSFCConfigSourceJSON()
+		{
+			// Nothing to do currently
+		}
+
+		// === Concrete Methods ===
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerSFCConfigSourceJSON<I,T>::getCurve(PartitionerSFCCurve * curve)
+		{
+			if(this->configData.isMember("Curve")) {
+				const Json::Value curveType = this->configData["Curve"];
+
+				if(curveType == "Morton") {
+					*curve = PARTITIONER_SFC_MORTON;
+					return cupcfd::error::E_SUCCESS;
+				}
+				else if(curveType == "Hilbert") {
+					*curve = PARTITIONER_SFC_HILBERT;
+					return cupcfd::error::E_SUCCESS;
+				}
+
+				// Found, but not a matching value
+				return cupcfd::error::E_CONFIG_INVALID_VALUE;
+			}
+
+			return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerSFCConfigSourceJSON<I,T>::buildPartitionerConfig(PartitionerConfig<I,T> ** config)
+		{
+			cupcfd::error::eCodes status;
+
+			// Check that at least a valid JSON record was passed.
+			if(this->configData == Json::Value::null)
+			{
+				return cupcfd::error::E_CONFIG_OPT_NOT_FOUND;
+			}
+
+			// Optional - default to the Hilbert curve
+			PartitionerSFCCurve curve;
+			status = this->getCurve(&curve);
+			if(status == cupcfd::error::E_CONFIG_OPT_NOT_FOUND) {
+				curve = PARTITIONER_SFC_HILBERT;
+			}
+			else if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			*config = new PartitionerSFCConfig<I,T>(curve);
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::partitioner::PartitionerSFCConfigSourceJSON<int,int>;
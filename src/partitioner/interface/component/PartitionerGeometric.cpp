@@ -0,0 +1,447 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Contains definitions for the PartitionerGeometric class
+ */
+
+#include "PartitionerGeometric.h"
+#include "ArrayDrivers.h"
+#include "Gather.h"
+#include "AllToAll.h"
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		PartitionerGeometric<I,T>::PartitionerGeometric(cupcfd::comm::Communicator& workComm)
+		: PartitionerInterface<I,T>(workComm),
+		  coords(nullptr),
+		  nCoords(0),
+		  weights(nullptr),
+		  nWeights(0)
+		{
+
+		}
+
+		template <class I, class T>
+		PartitionerGeometric<I,T>::PartitionerGeometric(cupcfd::data_structures::DistributedAdjacencyList<I,T>& sourceGraph, int nParts)
+		: PartitionerInterface<I,T>(sourceGraph, nParts),
+		  coords(nullptr),
+		  nCoords(0),
+		  weights(nullptr),
+		  nWeights(0)
+		{
+			// Nothing to do beyond base class - the coordinates are not known by the graph
+		}
+
+		template <class I, class T>
+		PartitionerGeometric<I,T>::~PartitionerGeometric()
+		{
+			this->resetCoordinateStorage();
+			this->resetWeightStorage();
+		}
+
+		// === Concrete Methods ===
+
+		template <class I, class T>
+		void PartitionerGeometric<I,T>::resetCoordinateStorage() {
+			if(this->coords != nullptr) {
+				free(this->coords);
+			}
+
+			this->coords = nullptr;
+			this->nCoords = 0;
+		}
+
+		template <class I, class T>
+		void PartitionerGeometric<I,T>::resetWeightStorage() {
+			if(this->weights != nullptr) {
+				free(this->weights);
+			}
+
+			this->weights = nullptr;
+			this->nWeights = 0;
+		}
+
+		template <class I, class T>
+		void PartitionerGeometric<I,T>::getNodeWeights(std::vector<double>& nodeWeights) {
+			nodeWeights.assign(this->nNodes, 1.0);
+
+			if(this->weights != nullptr) {
+				for(I i = 0; i < this->nNodes; i++) {
+					nodeWeights[i] = this->weights[i];
+				}
+			}
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerGeometric<I,T>::computeSortedPositions(long * primary, I nPrimary,
+																				double * secondary, I nSecondary,
+																				double * keyWeights, I nKeyWeights,
+																				I * positions, I nPositions,
+																				double * weightBefore, I nWeightBefore) {
+			// Keys are compared by primary value, then secondary value, then by their global index.
+			// The weight of the key is carried with it, but is not compared.
+			typedef std::tuple<long, double, I, double> SortKey;
+
+			auto keyLess = [](const SortKey& a, const SortKey& b) {
+				return std::tie(std::get<0>(a), std::get<1>(a), std::get<2>(a)) <
+					   std::tie(std::get<0>(b), std::get<1>(b), std::get<2>(b));
+			};
+
+			cupcfd::error::eCodes status;
+
+			if(nPrimary != nSecondary || nPrimary != nKeyWeights) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			if(nPositions < nPrimary || nWeightBefore < nPrimary) {
+				return cupcfd::error::E_ARRAY_SIZE_UNDERSIZED;
+			}
+
+			I nKeys = nPrimary;
+			int commSize = this->workComm.size;
+			int commRank = this->workComm.rank;
+
+			// (1) Give each key a global index from the number of keys on each process. This breaks ties
+			// between equal keys, and identifies which process a key came from.
+			std::vector<I> rankNKeys(commSize);
+			status = cupcfd::comm::AllGather(&nKeys, 1, rankNKeys.data(), commSize, 1, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			std::vector<I> rankOffset(commSize + 1, 0);
+			for(int r = 0; r < commSize; r++) {
+				rankOffset[r + 1] = rankOffset[r] + rankNKeys[r];
+			}
+
+			std::vector<SortKey> keys(nKeys);
+			for(I i = 0; i < nKeys; i++) {
+				keys[i] = SortKey(primary[i], secondary[i], rankOffset[commRank] + i, keyWeights[i]);
+			}
+
+			std::sort(keys.begin(), keys.end(), keyLess);
+
+			if(commSize == 1) {
+				double sum = 0.0;
+
+				for(I i = 0; i < nKeys; i++) {
+					positions[std::get<2>(keys[i])] = i;
+					weightBefore[std::get<2>(keys[i])] = sum;
+					sum = sum + std::get<3>(keys[i]);
+				}
+
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			if(rankOffset[commSize] == 0) {
+				// No keys on any process
+				return cupcfd::error::E_SUCCESS;
+			}
+
+			// (2) Each process takes commSize - 1 evenly spaced samples of its sorted keys, and every
+			// process chooses the same commSize - 1 splitters from the combined samples.
+			// The buffers are sized to hold at least one element so that they are never null.
+			int nSamples = (nKeys > 0) ? commSize - 1 : 0;
+			std::vector<long> samplePrimary(std::max(nSamples, 1));
+			std::vector<double> sampleSecondary(std::max(nSamples, 1));
+			std::vector<I> sampleIndex(std::max(nSamples, 1));
+
+			for(int j = 0; j < nSamples; j++) {
+				const SortKey& sample = keys[((long long) (j + 1) * nKeys) / commSize];
+				samplePrimary[j] = std::get<0>(sample);
+				sampleSecondary[j] = std::get<1>(sample);
+				sampleIndex[j] = std::get<2>(sample);
+			}
+
+			std::vector<int> sampleCounts(commSize);
+			status = cupcfd::comm::AllGather(&nSamples, 1, sampleCounts.data(), commSize, 1, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			int nAllSamples = 0;
+			for(int r = 0; r < commSize; r++) {
+				nAllSamples = nAllSamples + sampleCounts[r];
+			}
+
+			std::vector<long> allPrimary(nAllSamples);
+			std::vector<double> allSecondary(nAllSamples);
+			std::vector<I> allIndex(nAllSamples);
+
+			status = cupcfd::comm::AllGatherV(samplePrimary.data(), nSamples, allPrimary.data(), nAllSamples,
+											  sampleCounts.data(), commSize, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			status = cupcfd::comm::AllGatherV(sampleSecondary.data(), nSamples, allSecondary.data(), nAllSamples,
+											  sampleCounts.data(), commSize, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			status = cupcfd::comm::AllGatherV(sampleIndex.data(), nSamples, allIndex.data(), nAllSamples,
+											  sampleCounts.data(), commSize, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			std::vector<SortKey> allSamples(nAllSamples);
+			for(int j = 0; j < nAllSamples; j++) {
+				allSamples[j] = SortKey(allPrimary[j], allSecondary[j], allIndex[j], 0.0);
+			}
+
+			std::sort(allSamples.begin(), allSamples.end(), keyLess);
+
+			std::vector<SortKey> splitters(commSize - 1);
+			for(int k = 1; k < commSize; k++) {
+				splitters[k - 1] = allSamples[((long long) k * nAllSamples) / commSize];
+			}
+
+			// (3) Send each key to the process that owns its range of splitters. The keys are sorted, so they are
+			// already grouped by destination.
+			std::vector<int> sendCounts(commSize, 0);
+			std::vector<long> sendPrimary(std::max(nKeys, I(1)));
+			std::vector<double> sendSecondary(std::max(nKeys, I(1)));
+			std::vector<I> sendIndex(std::max(nKeys, I(1)));
+			std::vector<double> sendWeight(std::max(nKeys, I(1)));
+
+			for(I i = 0; i < nKeys; i++) {
+				int dest = std::upper_bound(splitters.begin(), splitters.end(), keys[i], keyLess) - splitters.begin();
+				sendCounts[dest] = sendCounts[dest] + 1;
+
+				sendPrimary[i] = std::get<0>(keys[i]);
+				sendSecondary[i] = std::get<1>(keys[i]);
+				sendIndex[i] = std::get<2>(keys[i]);
+				sendWeight[i] = std::get<3>(keys[i]);
+			}
+
+			std::vector<int> recvCounts(commSize, 0);
+			status = cupcfd::comm::AllToAll(sendCounts.data(), commSize, recvCounts.data(), commSize, 1, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			int nRecv = 0;
+			for(int r = 0; r < commSize; r++) {
+				nRecv = nRecv + recvCounts[r];
+			}
+
+			std::vector<long> recvPrimary(std::max(nRecv, 1));
+			std::vector<double> recvSecondary(std::max(nRecv, 1));
+			std::vector<I> recvIndex(std::max(nRecv, 1));
+			std::vector<double> recvWeight(std::max(nRecv, 1));
+
+			status = cupcfd::comm::AllToAll(sendPrimary.data(), nKeys, sendCounts.data(), commSize,
+											recvPrimary.data(), nRecv, recvCounts.data(), commSize, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			status = cupcfd::comm::AllToAll(sendSecondary.data(), nKeys, sendCounts.data(), commSize,
+											recvSecondary.data(), nRecv, recvCounts.data(), commSize, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			status = cupcfd::comm::AllToAll(sendIndex.data(), nKeys, sendCounts.data(), commSize,
+											recvIndex.data(), nRecv, recvCounts.data(), commSize, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			status = cupcfd::comm::AllToAll(sendWeight.data(), nKeys, sendCounts.data(), commSize,
+											recvWeight.data(), nRecv, recvCounts.data(), commSize, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			// (4) Sort the received keys. Their global positions and preceding weights follow on from the keys
+			// held by lower ranks.
+			std::vector<SortKey> recvKeys(nRecv);
+			double recvWeightSum = 0.0;
+			for(int j = 0; j < nRecv; j++) {
+				recvKeys[j] = SortKey(recvPrimary[j], recvSecondary[j], recvIndex[j], recvWeight[j]);
+				recvWeightSum = recvWeightSum + recvWeight[j];
+			}
+
+			std::sort(recvKeys.begin(), recvKeys.end(), keyLess);
+
+			std::vector<int> rankNRecv(commSize);
+			status = cupcfd::comm::AllGather(&nRecv, 1, rankNRecv.data(), commSize, 1, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			std::vector<double> rankRecvWeight(commSize);
+			status = cupcfd::comm::AllGather(&recvWeightSum, 1, rankRecvWeight.data(), commSize, 1, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			I base = 0;
+			double baseWeight = 0.0;
+			for(int r = 0; r < commRank; r++) {
+				base = base + rankNRecv[r];
+				baseWeight = baseWeight + rankRecvWeight[r];
+			}
+
+			// (5) Return the position of each key to the process it came from, grouped by that process
+			std::vector<int> returnCounts(commSize, 0);
+			std::vector<int> returnRank(nRecv);
+			for(int j = 0; j < nRecv; j++) {
+				I index = std::get<2>(recvKeys[j]);
+				returnRank[j] = (std::upper_bound(rankOffset.begin(), rankOffset.end(), index) - rankOffset.begin()) - 1;
+				returnCounts[returnRank[j]] = returnCounts[returnRank[j]] + 1;
+			}
+
+			std::vector<int> returnDispl(commSize, 0);
+			for(int r = 1; r < commSize; r++) {
+				returnDispl[r] = returnDispl[r - 1] + returnCounts[r - 1];
+			}
+
+			std::vector<I> returnIndex(std::max(nRecv, 1));
+			std::vector<I> returnPosition(std::max(nRecv, 1));
+			std::vector<double> returnWeight(std::max(nRecv, 1));
+			double sum = baseWeight;
+			for(int j = 0; j < nRecv; j++) {
+				int pos = returnDispl[returnRank[j]];
+				returnDispl[returnRank[j]] = pos + 1;
+
+				returnIndex[pos] = std::get<2>(recvKeys[j]);
+				returnPosition[pos] = base + j;
+				returnWeight[pos] = sum;
+				sum = sum + std::get<3>(recvKeys[j]);
+			}
+
+			std::vector<int> resultCounts(commSize, 0);
+			status = cupcfd::comm::AllToAll(returnCounts.data(), commSize, resultCounts.data(), commSize, 1, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			std::vector<I> resultIndex(std::max(nKeys, I(1)));
+			std::vector<I> resultPosition(std::max(nKeys, I(1)));
+			std::vector<double> resultWeight(std::max(nKeys, I(1)));
+
+			status = cupcfd::comm::AllToAll(returnIndex.data(), nRecv, returnCounts.data(), commSize,
+											resultIndex.data(), nKeys, resultCounts.data(), commSize, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			status = cupcfd::comm::AllToAll(returnPosition.data(), nRecv, returnCounts.data(), commSize,
+											resultPosition.data(), nKeys, resultCounts.data(), commSize, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			status = cupcfd::comm::AllToAll(returnWeight.data(), nRecv, returnCounts.data(), commSize,
+											resultWeight.data(), nKeys, resultCounts.data(), commSize, this->workComm);
+			if(status != cupcfd::error::E_SUCCESS) {
+				return status;
+			}
+
+			for(I i = 0; i < nKeys; i++) {
+				positions[resultIndex[i] - rankOffset[commRank]] = resultPosition[i];
+				weightBefore[resultIndex[i] - rankOffset[commRank]] = resultWeight[i];
+			}
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		// === Inherited Overrides ===
+
+		template <class I, class T>
+		void PartitionerGeometric<I,T>::setNodeStorage(T * nodes, I nNodes) {
+			// Any stored coordinates and weights belong to the old nodes
+			this->resetCoordinateStorage();
+			this->resetWeightStorage();
+			this->PartitionerInterface<I,T>::setNodeStorage(nodes, nNodes);
+		}
+
+		template <class I, class T>
+		void PartitionerGeometric<I,T>::reset() {
+			this->resetCoordinateStorage();
+			this->resetWeightStorage();
+			this->PartitionerInterface<I,T>::reset();
+		}
+
+		template <class I, class T>
+		bool PartitionerGeometric<I,T>::usesNodeCoordinates() {
+			return true;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerGeometric<I,T>::setNodeCoordinates(double * coords, I nCoords) {
+			if(nCoords != this->nNodes * 3) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			this->resetCoordinateStorage();
+			this->nCoords = nCoords;
+			this->coords = cupcfd::utility::drivers::duplicate(coords, nCoords);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerGeometric<I,T>::setNodeWeights(double * weights, I nWeights) {
+			if(nWeights != this->nNodes) {
+				return cupcfd::error::E_ARRAY_SIZE_MISMATCH;
+			}
+
+			for(I i = 0; i < nWeights; i++) {
+				if(!(weights[i] > 0.0)) {
+					return cupcfd::error::E_PARTITIONER_INVALID_NODE_WEIGHTS;
+				}
+			}
+
+			this->resetWeightStorage();
+			this->nWeights = nWeights;
+			this->weights = cupcfd::utility::drivers::duplicate(weights, nWeights);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerGeometric<I,T>::initialise(cupcfd::data_structures::DistributedAdjacencyList<I, T>& graph, I nParts) {
+			cupcfd::error::eCodes status;
+
+			this->setNParts(nParts);
+
+			// === Set the node data ===
+			I nNodes = graph.nLONodes;
+			T * nodes = (T *) malloc(sizeof(T) * nNodes);
+
+			// Make a copy of locally owned nodes from the graph
+			status = graph.getLocalNodes(nodes, nNodes);
+			CHECK_ECODE(status)
+
+			// Set the nodes in the partitioner. The coordinates must be set separately before partitioning.
+			this->setNodeStorage(nodes, nNodes);
+
+			free(nodes);
+
+			return cupcfd::error::E_SUCCESS;
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::partitioner::PartitionerGeometric<int,int>;
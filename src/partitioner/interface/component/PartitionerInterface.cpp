@@ -158,6 +158,24 @@ namespace cupcfd
 			return cupcfd::error::E_SUCCESS;
 		}
 
+		template <class I, class T>
+		bool PartitionerInterface<I,T>::usesNodeCoordinates() {
+			// Graph based partitioners do not need any coordinates
+			return false;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerInterface<I,T>::setNodeCoordinates(double * coords __attribute__((unused)),
+																			I nCoords __attribute__((unused))) {
+			return cupcfd::error::E_NOT_IMPLEMENTED;
+		}
+
+		template <class I, class T>
+		cupcfd::error::eCodes PartitionerInterface<I,T>::setNodeWeights(double * weights __attribute__((unused)),
+																		I nWeights __attribute__((unused))) {
+			return cupcfd::error::E_NOT_IMPLEMENTED;
+		}
+
 		template <class I, class T>
 		void PartitionerInterface<I,T>::reset() {
 			resetNodeStorage();
@@ -0,0 +1,38 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Implementation for the PartitionerRCBConfigSource class.
+ */
+
+#include "PartitionerRCBConfigSource.h"
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		PartitionerRCBConfigSource<I,T>::PartitionerRCBConfigSource()
+		{
+			// Nothing to do currently
+		}
+
+		template <class I, class T>
+		PartitionerRCBConfigSource<I,T>::~PartitionerRCBConfigSource()
+		{
+			// Nothing to do currently
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::partitioner::PartitionerRCBConfigSource<int, int>;
+template class cupcfd::partitioner::PartitionerRCBConfigSource<int, float>;
+template class cupcfd::partitioner::PartitionerRCBConfigSource<int, double>;
@@ -0,0 +1,38 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Class Implementation for the PartitionerSFCConfigSource class.
+ */
+
+#include "PartitionerSFCConfigSource.h"
+
+namespace cupcfd
+{
+	namespace partitioner
+	{
+		// === Constructors/Deconstructors ===
+
+		template <class I, class T>
+		PartitionerSFCConfigSource<I,T>::PartitionerSFCConfigSource()
+		{
+			// Nothing to do currently
+		}
+
+		template <class I, class T>
+		PartitionerSFCConfigSource<I,T>::~PartitionerSFCConfigSource()
+		{
+			// Nothing to do currently
+		}
+	}
+}
+
+// Explicit Instantiation
+template class cupcfd::partitioner::PartitionerSFCConfigSource<int, int>;
+template class cupcfd::partitioner::PartitionerSFCConfigSource<int, float>;
+template class cupcfd::partitioner::PartitionerSFCConfigSource<int, double>;
@@ -32,6 +32,10 @@
 #include "BenchmarkConfigLinearSolver.h"
 #include "BenchmarkConfigLinearSolverJSON.h"
 
+#include "BenchmarkSpMV.h"
+#include "BenchmarkConfigSpMV.h"
+#include "BenchmarkConfigSpMVJSON.h"
+
 #include "BenchmarkParticleSystemSimple.h"
 #include "BenchmarkConfigParticleSystemSimple.h"
 #include "BenchmarkConfigParticleSystemSimpleJSON.h"
@@ -43,7 +47,7 @@
 namespace cupcfd
 {
 	template <class M, class I, class T, class L>
-	CupCfd<M,I,T,L>::CupCfd(std::string jsonFilePath, std::shared_ptr<M> meshPtr)
+	CupCfd<M,I,T,L>::CupCfd(std::string jsonFilePath, std::shared_ptr<M> meshPtr, cupcfd::geometry::mesh::MeshConfig<I,T,L>& meshConfig)
 	: meshPtr(meshPtr)
 	{
 		cupcfd::error::eCodes status;
@@ -165,6 +169,36 @@ namespace cupcfd
 					}
 				}
 
+				// === SpMV Benchmarks ===
+				if(benchmarkConfigData.isMember("BenchmarkSpMV")) {
+					if(comm.rank == 0) {
+						std::cout << "Building SpMV Benchmark\n";
+					}
+
+					cupcfd::benchmark::BenchmarkConfigSpMVJSON<I,T> spmvBenchJSON(benchmarkConfigData["BenchmarkSpMV"]);
+					cupcfd::benchmark::BenchmarkConfigSpMV<I,T> * spmvBenchConfig;
+					status = spmvBenchJSON.buildBenchmarkConfig(&spmvBenchConfig);
+
+					if(status != cupcfd::error::E_SUCCESS) {
+						std::cout << "Cannot Parse a SpMV Benchmark Config at " << jsonFilePath << ". Skipping.\n";
+					}
+					else {
+						cupcfd::benchmark::Benchmark<I,T> * spmvBench;
+						status = spmvBenchConfig->buildBenchmark(&spmvBench);
+
+						if(status != cupcfd::error::E_SUCCESS) {
+							std::cout << "Error Encountered: Failed to build SpMV Benchmark with current configuration. Please check the provided configuration is correct.\n";
+						}
+						else {
+							status = spmvBench->runBenchmark();
+							HARD_CHECK_ECODE(status)
+							delete(spmvBench);
+						}
+
+						delete(spmvBenchConfig);
+					}
+				}
+
 				// === Particle Benchmarks ===
 				if(benchmarkConfigData.isMember("BenchmarkParticleSystem")) {
 					if(comm.rank == 0) {
@@ -183,7 +217,7 @@ namespace cupcfd
 					}
 					else {
 						cupcfd::benchmark::BenchmarkParticleSystemSimple<M,I,T,L> * benchmarkParticleSystem;
-						status = particleSystemConfig->buildBenchmark(&benchmarkParticleSystem, meshPtr);
+						status = particleSystemConfig->buildBenchmark(&benchmarkParticleSystem, meshPtr, meshConfig);
 
 						if(status != cupcfd::error::E_SUCCESS) {
 							std::cout << "Error Encountered: Failed to build Simple Particle Benchmark with current configuration. Please check the provided configuration is correct.\n";
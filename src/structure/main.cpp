@@ -50,7 +50,9 @@
 // Timer Interface
 #include "tt_interface_c.h"
 
+#ifdef CUPCFD_USE_PETSC
 #include "petscsys.h"
+#endif
 
 // JsonCPP - Supplied as standalone in include/io/jsoncpp
 #include "json.h"
@@ -67,14 +69,55 @@
 
 namespace mesh = cupcfd::geometry::mesh;
 
+// PETSc is only initialised if it is built in - the native linear solver does not need it
+void initLinearSolverLibs(int * argc, char *** argv) {
+#ifdef CUPCFD_USE_PETSC
+	PetscInitialize(argc, argv, NULL, NULL);
+#else
+	(void) argc;
+	(void) argv;
+#endif
+}
+
+void finalizeLinearSolverLibs() {
+#ifdef CUPCFD_USE_PETSC
+	PetscFinalize();
+#endif
+}
+
+// Build the mesh inside a BuildMesh timer block, and log the rate at which this rank read the mesh source.
+// The timer block is exited whether or not the build succeeds.
+template <class M, class I, class T, class L>
+cupcfd::error::eCodes buildMesh(mesh::MeshConfig<I,T,L>& meshConfig, M ** meshOut, cupcfd::comm::Communicator& comm) {
+	cupcfd::error::eCodes status;
+
+	TreeTimerEnterMethod("BuildMesh");
+
+	status = meshConfig.buildUnstructuredMesh(meshOut, comm);
+
+	if(status == cupcfd::error::E_SUCCESS) {
+		unsigned long long meshBytesRead;
+		double meshReadTime;
+
+		if(meshConfig.getSourceReadStatistics(&meshBytesRead, &meshReadTime) == cupcfd::error::E_SUCCESS) {
+			TreeTimerLogParameterDouble("MeshBytesRead", double(meshBytesRead));
+			TreeTimerLogParameterDouble("MeshReadTime", meshReadTime);
+			TreeTimerLogParameterDouble("MeshReadBytesPerSecond", (meshReadTime > 0.0) ? (double(meshBytesRead) / meshReadTime) : 0.0);
+		}
+	}
+
+	TreeTimerExit("BuildMesh");
+
+	return status;
+}
+
 int main (int argc, char ** argv)
 {
 	cupcfd::error::eCodes status;
 
 	MPI_Init(&argc, &argv);
 
-	// Add ifdef for petsc?
-	PetscInitialize(&argc, &argv, NULL, NULL);
+	initLinearSolverLibs(&argc, &argv);
 
 	TreeTimerInit();
 
@@ -92,7 +135,7 @@ int main (int argc, char ** argv)
 	if (status != cupcfd::error::E_SUCCESS) {
 		std::cout << "MPI registration of 'EuclideanPoint' class failed" << std::endl;
 		TreeTimerFinalize();
-		PetscFinalize();
+		finalizeLinearSolverLibs();
 		MPI_Abort(MPI_COMM_WORLD, status);
 		return -1;
 	}
@@ -103,7 +146,7 @@ int main (int argc, char ** argv)
 	if (status != cupcfd::error::E_SUCCESS) {
 		std::cout << "MPI registration of 'EuclideanVector' class failed" << std::endl;
 		TreeTimerFinalize();
-		PetscFinalize();
+		finalizeLinearSolverLibs();
 		MPI_Abort(MPI_COMM_WORLD, status);
 		return -1;
 	}
@@ -114,7 +157,7 @@ int main (int argc, char ** argv)
 	if (status != cupcfd::error::E_SUCCESS) {
 		std::cout << "MPI registration of 'ParticleSimple' class failed" << std::endl;
 		TreeTimerFinalize();
-		PetscFinalize();
+		finalizeLinearSolverLibs();
 		MPI_Abort(MPI_COMM_WORLD, status);
 		return -1;
 	}
@@ -186,7 +229,7 @@ int main (int argc, char ** argv)
 			std::cout << "Ending Benchmarking\n";
 			int ierr = -1;
 			TreeTimerFinalize();
-			PetscFinalize();
+			finalizeLinearSolverLibs();
 			MPI_Abort(MPI_COMM_WORLD, ierr);
 			return -1;
 		}
@@ -197,13 +240,13 @@ int main (int argc, char ** argv)
 		}
 
 		mesh::CupCfdAoSMesh<int, double, int> * mesh;
-		status = meshConfig->buildUnstructuredMesh(&mesh, comm);
+		status = buildMesh(*meshConfig, &mesh, comm);
 		if(status != cupcfd::error::E_SUCCESS) {
 			std::cout << "Error Encountered: Failed to build Mesh with current configuration. Please check the provided configuration is correct.\n";
 			std::cout << "Ending Benchmarking\n";
 			int ierr = -1;
 			TreeTimerFinalize();
-			PetscFinalize();
+			finalizeLinearSolverLibs();
 			MPI_Abort(MPI_COMM_WORLD, ierr);
 			return -1;
 		}
@@ -218,7 +261,7 @@ int main (int argc, char ** argv)
 		// ToDo: For now, it is hard-coded to read from a JSON file (by passing the path), but it should technically
 		// be moved out to get input from a generic 'source' structure.
 
-		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSMesh<int,double,int>,int,double,int> run(configPath, meshPtr);
+		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSMesh<int,double,int>,int,double,int> run(configPath, meshPtr, *meshConfig);
 
 		delete meshConfig;
 	}
@@ -235,7 +278,7 @@ int main (int argc, char ** argv)
 			std::cout << "Ending Benchmarking\n";
 			int ierr = -1;
 			TreeTimerFinalize();
-			PetscFinalize();
+			finalizeLinearSolverLibs();
 			MPI_Abort(MPI_COMM_WORLD, ierr);
 			return -1;
 		}
@@ -246,13 +289,13 @@ int main (int argc, char ** argv)
 		}
 
 		mesh::CupCfdAoSMesh<int, float, int> * mesh;
-		status = meshConfig->buildUnstructuredMesh(&mesh, comm);
+		status = buildMesh(*meshConfig, &mesh, comm);
 		if(status != cupcfd::error::E_SUCCESS) {
 			std::cout << "Error Encountered: Failed to build Mesh with current configuration. Please check the provided configuration is correct.\n";
 			std::cout << "Ending Benchmarking\n";
 			int ierr = -1;
 			TreeTimerFinalize();
-			PetscFinalize();
+			finalizeLinearSolverLibs();
 			MPI_Abort(MPI_COMM_WORLD, ierr);
 			return -1;
 		}
@@ -267,7 +310,7 @@ int main (int argc, char ** argv)
 		// ToDo: For now, it is hard-coded to read from a JSON file (by passing the path), but it should technically
 		// be moved out to get input from a generic 'source' structure.
 
-		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSMesh<int,float,int>,int,float,int> run(configPath, meshPtr);
+		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdAoSMesh<int,float,int>,int,float,int> run(configPath, meshPtr, *meshConfig);
 
 		delete meshConfig;
 	}
@@ -284,7 +327,7 @@ int main (int argc, char ** argv)
 			std::cout << "Ending Benchmarking\n";
 			int ierr = -1;
 			TreeTimerFinalize();
-			PetscFinalize();
+			finalizeLinearSolverLibs();
 			MPI_Abort(MPI_COMM_WORLD, ierr);
 			return -1;
 		}
@@ -295,13 +338,13 @@ int main (int argc, char ** argv)
 		}
 
 		mesh::CupCfdSoAMesh<int, double, int> * mesh;
-		status = meshConfig->buildUnstructuredMesh(&mesh, comm);
+		status = buildMesh(*meshConfig, &mesh, comm);
 		if(status != cupcfd::error::E_SUCCESS) {
 			std::cout << "Error Encountered: Failed to build Mesh with current configuration. Please check the provided configuration is correct.\n";
 			std::cout << "Ending Benchmarking\n";
 			int ierr = -1;
 			TreeTimerFinalize();
-			PetscFinalize();
+			finalizeLinearSolverLibs();
 			MPI_Abort(MPI_COMM_WORLD, ierr);
 			return -1;
 		}
@@ -316,7 +359,7 @@ int main (int argc, char ** argv)
 		// ToDo: For now, it is hard-coded to read from a JSON file (by passing the path), but it should technically
 		// be moved out to get input from a generic 'source' structure.
 
-		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdSoAMesh<int,double,int>,int,double,int> run(configPath, meshPtr);
+		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdSoAMesh<int,double,int>,int,double,int> run(configPath, meshPtr, *meshConfig);
 
 		delete meshConfig;
 	}
@@ -333,7 +376,7 @@ int main (int argc, char ** argv)
 			std::cout << "Ending Benchmarking\n";
 			int ierr = -1;
 			TreeTimerFinalize();
-			PetscFinalize();
+			finalizeLinearSolverLibs();
 			MPI_Abort(MPI_COMM_WORLD, ierr);
 			return -1;
 		}
@@ -344,13 +387,13 @@ int main (int argc, char ** argv)
 		}
 
 		mesh::CupCfdSoAMesh<int, float, int> * mesh;
-		status = meshConfig->buildUnstructuredMesh(&mesh, comm);
+		status = buildMesh(*meshConfig, &mesh, comm);
 		if(status != cupcfd::error::E_SUCCESS) {
 			std::cout << "Error Encountered: Failed to build Mesh with current configuration. Please check the provided configuration is correct.\n";
 			std::cout << "Ending Benchmarking\n";
 			int ierr = -1;
 			TreeTimerFinalize();
-			PetscFinalize();
+			finalizeLinearSolverLibs();
 			MPI_Abort(MPI_COMM_WORLD, ierr);
 			return -1;
 		}
@@ -365,7 +408,7 @@ int main (int argc, char ** argv)
 		// ToDo: For now, it is hard-coded to read from a JSON file (by passing the path), but it should technically
 		// be moved out to get input from a generic 'source' structure.
 
-		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdSoAMesh<int,float,int>,int,float,int> run(configPath, meshPtr);
+		cupcfd::CupCfd<cupcfd::geometry::mesh::CupCfdSoAMesh<int,float,int>,int,float,int> run(configPath, meshPtr, *meshConfig);
 
 		delete meshConfig;
 	}
@@ -375,7 +418,7 @@ int main (int argc, char ** argv)
 	if (status != cupcfd::error::E_SUCCESS) {
 		std::cout << "MPI de-registration of 'ParticleSimple' class failed" << std::endl;
 		TreeTimerFinalize();
-		PetscFinalize();
+		finalizeLinearSolverLibs();
 		MPI_Abort(MPI_COMM_WORLD, status);
 		return -1;
 	}
@@ -383,7 +426,7 @@ int main (int argc, char ** argv)
 	if (status != cupcfd::error::E_SUCCESS) {
 		std::cout << "MPI de-registration of 'EuclideanPoint' class failed" << std::endl;
 		TreeTimerFinalize();
-		PetscFinalize();
+		finalizeLinearSolverLibs();
 		MPI_Abort(MPI_COMM_WORLD, status);
 		return -1;
 	}
@@ -391,13 +434,12 @@ int main (int argc, char ** argv)
 	if (status != cupcfd::error::E_SUCCESS) {
 		std::cout << "MPI de-registration of 'EuclideanVector' class failed" << std::endl;
 		TreeTimerFinalize();
-		PetscFinalize();
+		finalizeLinearSolverLibs();
 		MPI_Abort(MPI_COMM_WORLD, status);
 		return -1;
 	}
 
-	// Add ifdef for petsc?
-	PetscFinalize();
+	finalizeLinearSolverLibs();
 
 	TreeTimerFinalize();
 	
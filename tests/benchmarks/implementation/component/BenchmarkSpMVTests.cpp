@@ -0,0 +1,168 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the BenchmarkSpMV class
+ */
+
+#define BOOST_TEST_MODULE BenchmarkSpMV
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+
+#include "BenchmarkSpMV.h"
+#include "Communicator.h"
+#include "Error.h"
+#include "ExchangePatternConfig.h"
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixSELL.h"
+#include "SparseMatrixBCSR.h"
+#include "tt_interface_c.h"
+
+#include <memory>
+
+using namespace cupcfd::benchmark;
+
+// Build a distributed tridiagonal matrix of 5 rows per process
+std::shared_ptr<cupcfd::data_structures::DistributedSparseMatrixCSR<int,double>> buildMatrix(cupcfd::comm::Communicator& comm) {
+	cupcfd::error::eCodes status;
+	int nRows = 5 * comm.size;
+	cupcfd::data_structures::SparseMatrixCSR<int,double> matrix(nRows, nRows, 0);
+
+	for(int i = 0; i < nRows; i++) {
+		status = matrix.setElement(i, i, 2.0);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		if(i > 0) {
+			status = matrix.setElement(i, i - 1, -1.0);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+
+		if(i < nRows - 1) {
+			status = matrix.setElement(i, i + 1, -1.0);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+	}
+
+	cupcfd::comm::ExchangePatternConfig patternConfig(cupcfd::comm::EXCHANGE_NONBLOCKING_TWO_SIDED);
+
+	return std::make_shared<cupcfd::data_structures::DistributedSparseMatrixCSR<int,double>>(comm, matrix, 5 * comm.rank, 5 * (comm.rank + 1), patternConfig);
+}
+
+// Build a SpMV benchmark of the distributed tridiagonal matrix with the local matrices stored as CSR
+std::shared_ptr<BenchmarkSpMV<cupcfd::data_structures::SparseMatrixCSR<int,double>,int,double>> buildCSRBenchmark(cupcfd::comm::Communicator& comm) {
+	typedef cupcfd::data_structures::SparseMatrixCSR<int,double> CSRMatrix;
+
+	cupcfd::error::eCodes status;
+	std::shared_ptr<cupcfd::data_structures::DistributedSparseMatrixCSR<int,double>> matrixPtr = buildMatrix(comm);
+	std::shared_ptr<CSRMatrix> ownedPtr = std::make_shared<CSRMatrix>();
+	std::shared_ptr<CSRMatrix> ghostPtr = std::make_shared<CSRMatrix>();
+
+	status = matrixPtr->splitLocalMatrix(*ownedPtr, *ghostPtr);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	return std::make_shared<BenchmarkSpMV<CSRMatrix,int,double>>("SpMVBench", 10, matrixPtr, ownedPtr, ghostPtr);
+}
+
+// These tests require MPI
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+    MPI_Init(&argc, &argv);
+	TreeTimerInit();
+}
+
+// === getFlopsPerMultiply ===
+// Test 1: Two operations per local non-zero
+BOOST_AUTO_TEST_CASE(getFlopsPerMultiply_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	std::shared_ptr<BenchmarkSpMV<cupcfd::data_structures::SparseMatrixCSR<int,double>,int,double>> benchmark = buildCSRBenchmark(comm);
+
+	// The first and last processes own one boundary row with two non-zeroes
+	int nnz = 15 - ((comm.rank == 0) ? 1 : 0) - ((comm.rank == comm.size - 1) ? 1 : 0);
+
+	BOOST_CHECK_EQUAL(benchmark->getFlopsPerMultiply(), 2.0 * nnz);
+}
+
+// === getBytesPerMultiply ===
+// Test 1: Values, column indexes and row pointers of the owned and ghost column matrices, x including the ghost entries, and y
+BOOST_AUTO_TEST_CASE(getBytesPerMultiply_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	std::shared_ptr<BenchmarkSpMV<cupcfd::data_structures::SparseMatrixCSR<int,double>,int,double>> benchmark = buildCSRBenchmark(comm);
+
+	int nnz = 15 - ((comm.rank == 0) ? 1 : 0) - ((comm.rank == comm.size - 1) ? 1 : 0);
+	int nGhost = ((comm.rank == 0) ? 0 : 1) + ((comm.rank == comm.size - 1) ? 0 : 1);
+
+	double bytes = (nnz * (sizeof(double) + sizeof(int))) + (2 * 6 * sizeof(int)) + ((5 + nGhost) * sizeof(double)) + (5 * sizeof(double));
+
+	BOOST_CHECK_EQUAL(benchmark->getBytesPerMultiply(), bytes);
+}
+
+// === runBenchmark ===
+// Test 1: Run the benchmark
+BOOST_AUTO_TEST_CASE(runBenchmark_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	std::shared_ptr<BenchmarkSpMV<cupcfd::data_structures::SparseMatrixCSR<int,double>,int,double>> benchmark = buildCSRBenchmark(comm);
+
+	status = benchmark->runBenchmark();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// The warm up product is not included in the timing
+	if(comm.size > 1) {
+		BOOST_CHECK_EQUAL(benchmark->matrixPtr->timing.nExchanges, 10);
+	}
+}
+
+// Test 2: Run the benchmark with the local matrices stored as SELL and BCSR
+BOOST_AUTO_TEST_CASE(runBenchmark_test2)
+{
+	typedef cupcfd::data_structures::SparseMatrixSELL<int,double> SELLMatrix;
+	typedef cupcfd::data_structures::SparseMatrixBCSR<int,double> BCSRMatrix;
+
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	std::shared_ptr<cupcfd::data_structures::DistributedSparseMatrixCSR<int,double>> matrixPtr = buildMatrix(comm);
+	cupcfd::data_structures::SparseMatrixCSR<int,double> ownedA;
+	cupcfd::data_structures::SparseMatrixCSR<int,double> ghostA;
+
+	status = matrixPtr->splitLocalMatrix(ownedA, ghostA);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BenchmarkSpMV<SELLMatrix,int,double> sellBenchmark("SpMVBenchSELL", 10, matrixPtr,
+													   std::make_shared<SELLMatrix>(ownedA, 4, 1),
+													   std::make_shared<SELLMatrix>(ghostA, 4, 1));
+
+	// The flops only count the non-zeroes, so they do not depend on the format
+	BOOST_CHECK_EQUAL(sellBenchmark.getFlopsPerMultiply(), 2.0 * matrixPtr->localA.nnz);
+
+	status = sellBenchmark.runBenchmark();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BenchmarkSpMV<BCSRMatrix,int,double> bcsrBenchmark("SpMVBenchBCSR", 10, matrixPtr,
+													   std::make_shared<BCSRMatrix>(ownedA, 3),
+													   std::make_shared<BCSRMatrix>(ghostA, 3));
+
+	BOOST_CHECK_EQUAL(bcsrBenchmark.getFlopsPerMultiply(), 2.0 * matrixPtr->localA.nnz);
+
+	status = bcsrBenchmark.runBenchmark();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+}
+
+// Finalize MPI
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    // Cleanup MPI Environment
+	TreeTimerFinalize();
+    MPI_Finalize();
+}
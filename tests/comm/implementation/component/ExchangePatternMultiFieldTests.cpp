@@ -0,0 +1,424 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ */
+
+#define BOOST_TEST_MODULE ExchangePatternMultiField
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+
+#include <stdexcept>
+#include <iostream>
+
+#include "mpi.h"
+
+#include "Communicator.h"
+#include "ExchangePatternTwoSidedNonBlocking.h"
+#include "ExchangePatternMultiField.h"
+#include "EuclideanVector.h"
+
+using namespace cupcfd::comm;
+
+namespace euc = cupcfd::geometry::euclidean;
+
+// Setup
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+    MPI_Init(&argc, &argv);
+}
+
+// Exchange IDs for a 4 rank pattern. Each rank receives values for every ghost ID
+// from the owning rank.
+// Rank 0 owns 1-5, Rank 1 owns 6-10, Rank 2 owns 11-15, Rank 3 owns 16-20.
+static int exchangeIDX0[7] = {1, 2, 3, 4, 5, 6, 7};
+static int exchangeIDXSend0[2] = {4, 5};
+static int rankSend0[2] = {1, 1};
+
+static int exchangeIDX1[9] = {6, 7, 8, 9, 10, 4, 5, 11, 12};
+static int exchangeIDXSend1[4] = {6, 7, 9, 10};
+static int rankSend1[4] = {0, 0, 2, 2};
+
+static int exchangeIDX2[9] = {15, 13, 11, 12, 14, 10, 9, 17, 16};
+static int exchangeIDXSend2[5] = {12, 14, 11, 15, 13};
+static int rankSend2[5] = {1, 3, 1, 3, 3};
+
+static int exchangeIDX3[8] = {14, 15, 16, 17, 18, 19, 20, 13};
+static int exchangeIDXSend3[2] = {16, 17};
+static int rankSend3[2] = {2, 2};
+
+// Whether an exchange ID is owned by the current rank
+static bool isOwned(cupcfd::comm::Communicator& comm, int id) {
+	return ((id - 1) / 5) == comm.rank;
+}
+
+// Initialise the pattern for the current rank, and return the exchange IDs of the local data
+static void initPattern(cupcfd::comm::Communicator& comm, ExchangePatternTwoSidedNonBlocking<int>& pattern,
+						int ** exchangeIDX, int * nExchangeIDX) {
+	cupcfd::error::eCodes status;
+
+	if(comm.rank == 0) {
+		status = pattern.init(comm, exchangeIDX0, 7, exchangeIDXSend0, 2, rankSend0, 2);
+		*exchangeIDX = exchangeIDX0;
+		*nExchangeIDX = 7;
+	}
+	else if(comm.rank == 1) {
+		status = pattern.init(comm, exchangeIDX1, 9, exchangeIDXSend1, 4, rankSend1, 4);
+		*exchangeIDX = exchangeIDX1;
+		*nExchangeIDX = 9;
+	}
+	else if(comm.rank == 2) {
+		status = pattern.init(comm, exchangeIDX2, 9, exchangeIDXSend2, 5, rankSend2, 5);
+		*exchangeIDX = exchangeIDX2;
+		*nExchangeIDX = 9;
+	}
+	else {
+		status = pattern.init(comm, exchangeIDX3, 8, exchangeIDXSend3, 2, rankSend3, 2);
+		*exchangeIDX = exchangeIDX3;
+		*nExchangeIDX = 8;
+	}
+
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+}
+
+// === init ===
+// Test 1: Check the exchange information is copied from the source pattern
+BOOST_AUTO_TEST_CASE(init_test1)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    ExchangePatternTwoSidedNonBlocking<int> pattern;
+    int * exchangeIDX;
+    int nExchangeIDX;
+    initPattern(comm, pattern, &exchangeIDX, &nExchangeIDX);
+
+    ExchangePatternMultiField multiField;
+    status = multiField.init(pattern);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    BOOST_CHECK_EQUAL(multiField.comm.rank, comm.rank);
+    BOOST_CHECK_EQUAL(multiField.comm.size, comm.size);
+
+    BOOST_CHECK_EQUAL(multiField.nSProc, pattern.nSProc);
+    BOOST_CHECK_EQUAL_COLLECTIONS(multiField.sProc, multiField.sProc + multiField.nSProc, pattern.sProc, pattern.sProc + pattern.nSProc);
+    BOOST_CHECK_EQUAL_COLLECTIONS(multiField.sXAdj, multiField.sXAdj + multiField.nSProc + 1, pattern.sXAdj, pattern.sXAdj + pattern.nSXAdj);
+    BOOST_CHECK_EQUAL(multiField.nSendLocalIdx, pattern.nSendLocalIdx);
+    BOOST_CHECK_EQUAL_COLLECTIONS(multiField.sendLocalIdx, multiField.sendLocalIdx + multiField.nSendLocalIdx,
+    							  pattern.sendLocalIdx, pattern.sendLocalIdx + pattern.nSendLocalIdx);
+
+    BOOST_CHECK_EQUAL(multiField.nRProc, pattern.nRProc);
+    BOOST_CHECK_EQUAL_COLLECTIONS(multiField.rProc, multiField.rProc + multiField.nRProc, pattern.rProc, pattern.rProc + pattern.nRProc);
+    BOOST_CHECK_EQUAL_COLLECTIONS(multiField.rXAdj, multiField.rXAdj + multiField.nRProc + 1, pattern.rXAdj, pattern.rXAdj + pattern.nRXAdj);
+    BOOST_CHECK_EQUAL(multiField.nRecvLocalIdx, pattern.nRecvLocalIdx);
+    BOOST_CHECK_EQUAL_COLLECTIONS(multiField.recvLocalIdx, multiField.recvLocalIdx + multiField.nRecvLocalIdx,
+    							  pattern.recvLocalIdx, pattern.recvLocalIdx + pattern.nRecvLocalIdx);
+
+    BOOST_CHECK_EQUAL(multiField.getNFields(), 0);
+}
+
+// Test 2: Error Case: Initialising twice
+BOOST_AUTO_TEST_CASE(init_test2)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    ExchangePatternTwoSidedNonBlocking<int> pattern;
+    int * exchangeIDX;
+    int nExchangeIDX;
+    initPattern(comm, pattern, &exchangeIDX, &nExchangeIDX);
+
+    ExchangePatternMultiField multiField;
+    status = multiField.init(pattern);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    status = multiField.init(pattern);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_FINALIZED);
+}
+
+// === registerField ===
+// Test 1: Register fields of different types
+BOOST_AUTO_TEST_CASE(registerField_test1)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    ExchangePatternTwoSidedNonBlocking<int> pattern;
+    int * exchangeIDX;
+    int nExchangeIDX;
+    initPattern(comm, pattern, &exchangeIDX, &nExchangeIDX);
+
+    ExchangePatternMultiField multiField;
+    status = multiField.init(pattern);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    int intData[9];
+    double doubleData[9];
+
+    status = multiField.registerField(intData, nExchangeIDX);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+    BOOST_CHECK_EQUAL(multiField.getNFields(), 1);
+
+    status = multiField.registerField(doubleData, nExchangeIDX);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+    BOOST_CHECK_EQUAL(multiField.getNFields(), 2);
+    BOOST_CHECK_EQUAL(multiField.fields[0]->elementSize, sizeof(int));
+    BOOST_CHECK_EQUAL(multiField.fields[1]->elementSize, sizeof(double));
+
+    BOOST_CHECK_EQUAL(multiField.fields[0]->elementAlign, alignof(int));
+    BOOST_CHECK_EQUAL(multiField.fields[1]->elementAlign, alignof(double));
+
+    status = multiField.clearFields();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+    BOOST_CHECK_EQUAL(multiField.getNFields(), 0);
+}
+
+// Test 2: Error Case: nullptr
+BOOST_AUTO_TEST_CASE(registerField_test2)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    ExchangePatternTwoSidedNonBlocking<int> pattern;
+    int * exchangeIDX;
+    int nExchangeIDX;
+    initPattern(comm, pattern, &exchangeIDX, &nExchangeIDX);
+
+    ExchangePatternMultiField multiField;
+    status = multiField.init(pattern);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    int * data = nullptr;
+    status = multiField.registerField(data, nExchangeIDX);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_NULL_PTR);
+    BOOST_CHECK_EQUAL(multiField.getNFields(), 0);
+}
+
+// Test 3: Error Case: Array too small for the local indexes of the pattern
+BOOST_AUTO_TEST_CASE(registerField_test3)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    ExchangePatternTwoSidedNonBlocking<int> pattern;
+    int * exchangeIDX;
+    int nExchangeIDX;
+    initPattern(comm, pattern, &exchangeIDX, &nExchangeIDX);
+
+    ExchangePatternMultiField multiField;
+    status = multiField.init(pattern);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    // Every rank receives into the last local index
+    double data[9];
+    status = multiField.registerField(data, nExchangeIDX - 1);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_INDEX);
+    BOOST_CHECK_EQUAL(multiField.getNFields(), 0);
+}
+
+// === exchangeStart ===
+// Test 1: Error Case: No registered fields
+BOOST_AUTO_TEST_CASE(exchangeStart_test1)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    ExchangePatternTwoSidedNonBlocking<int> pattern;
+    int * exchangeIDX;
+    int nExchangeIDX;
+    initPattern(comm, pattern, &exchangeIDX, &nExchangeIDX);
+
+    ExchangePatternMultiField multiField;
+    status = multiField.init(pattern);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    status = multiField.exchangeStart();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_NO_DATA);
+}
+
+// === exchange ===
+// Test 1: Exchange an int, double and EuclideanVector field in one round of messages
+BOOST_AUTO_TEST_CASE(exchange_test1)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    ExchangePatternTwoSidedNonBlocking<int> pattern;
+    int * exchangeIDX;
+    int nExchangeIDX;
+    initPattern(comm, pattern, &exchangeIDX, &nExchangeIDX);
+
+    ExchangePatternMultiField multiField;
+    status = multiField.init(pattern);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    // Owned values are derived from the exchange ID, ghost values are unset
+    int intData[9];
+    double doubleData[9];
+    euc::EuclideanVector<double,3> vecData[9];
+
+    for(int i = 0; i < nExchangeIDX; i++) {
+    	int id = exchangeIDX[i];
+    	if(isOwned(comm, id)) {
+    		intData[i] = id * 10;
+    		doubleData[i] = id + 0.5;
+    		vecData[i] = euc::EuclideanVector<double,3>(id * 1.0, id * 2.0, id * 3.0);
+    	}
+    	else {
+    		intData[i] = -1;
+    		doubleData[i] = -1.0;
+    		vecData[i] = euc::EuclideanVector<double,3>(-1.0, -1.0, -1.0);
+    	}
+    }
+
+    status = multiField.registerField(intData, nExchangeIDX);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+    status = multiField.registerField(doubleData, nExchangeIDX);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+    status = multiField.registerField(vecData, nExchangeIDX);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    status = multiField.exchangeStart();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    // One message per neighbour regardless of the number of fields
+    BOOST_CHECK_EQUAL(multiField.nActiveRequests, multiField.nSProc + multiField.nRProc);
+
+    status = multiField.exchangeStop();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    // Every ghost should now hold the value of its owner
+    for(int i = 0; i < nExchangeIDX; i++) {
+    	int id = exchangeIDX[i];
+    	BOOST_CHECK_EQUAL(intData[i], id * 10);
+    	BOOST_CHECK_EQUAL(doubleData[i], id + 0.5);
+    	BOOST_CHECK_EQUAL(vecData[i].cmp[0], id * 1.0);
+    	BOOST_CHECK_EQUAL(vecData[i].cmp[1], id * 2.0);
+    	BOOST_CHECK_EQUAL(vecData[i].cmp[2], id * 3.0);
+    }
+}
+
+// Test 2: Repeated exchanges, changing the registered fields between exchanges
+BOOST_AUTO_TEST_CASE(exchange_test2)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    ExchangePatternTwoSidedNonBlocking<int> pattern;
+    int * exchangeIDX;
+    int nExchangeIDX;
+    initPattern(comm, pattern, &exchangeIDX, &nExchangeIDX);
+
+    ExchangePatternMultiField multiField;
+    status = multiField.init(pattern);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    int intData[9];
+    double doubleData[9];
+
+    for(int i = 0; i < nExchangeIDX; i++) {
+    	intData[i] = isOwned(comm, exchangeIDX[i]) ? exchangeIDX[i] : -1;
+    	doubleData[i] = isOwned(comm, exchangeIDX[i]) ? exchangeIDX[i] * 0.25 : -1.0;
+    }
+
+    status = multiField.registerField(intData, nExchangeIDX);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    status = multiField.exchangeStart();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+    status = multiField.exchangeStop();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    for(int i = 0; i < nExchangeIDX; i++) {
+    	BOOST_CHECK_EQUAL(intData[i], exchangeIDX[i]);
+    	BOOST_CHECK_EQUAL(doubleData[i], isOwned(comm, exchangeIDX[i]) ? exchangeIDX[i] * 0.25 : -1.0);
+    }
+
+    // Update owned values and swap the registered fields
+    status = multiField.clearFields();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    for(int i = 0; i < nExchangeIDX; i++) {
+    	if(isOwned(comm, exchangeIDX[i])) {
+    		intData[i] = exchangeIDX[i] * 100;
+    	}
+    }
+
+    status = multiField.registerField(doubleData, nExchangeIDX);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+    status = multiField.registerField(intData, nExchangeIDX);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    status = multiField.exchangeStart();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+    status = multiField.exchangeStop();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    for(int i = 0; i < nExchangeIDX; i++) {
+    	BOOST_CHECK_EQUAL(intData[i], exchangeIDX[i] * 100);
+    	BOOST_CHECK_EQUAL(doubleData[i], exchangeIDX[i] * 0.25);
+    }
+}
+
+// Test 3: Error Case: The registered fields cannot change while an exchange is active
+BOOST_AUTO_TEST_CASE(exchange_test3)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    ExchangePatternTwoSidedNonBlocking<int> pattern;
+    int * exchangeIDX;
+    int nExchangeIDX;
+    initPattern(comm, pattern, &exchangeIDX, &nExchangeIDX);
+
+    ExchangePatternMultiField multiField;
+    status = multiField.init(pattern);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    int intData[9];
+    double doubleData[9];
+
+    for(int i = 0; i < nExchangeIDX; i++) {
+    	intData[i] = isOwned(comm, exchangeIDX[i]) ? exchangeIDX[i] : -1;
+    	doubleData[i] = 0.0;
+    }
+
+    status = multiField.registerField(intData, nExchangeIDX);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    status = multiField.exchangeStart();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    status = multiField.registerField(doubleData, nExchangeIDX);
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_EXCHANGE_ACTIVE);
+    status = multiField.clearFields();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_EXCHANGE_ACTIVE);
+    status = multiField.exchangeStart();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_EXCHANGE_ACTIVE);
+    BOOST_CHECK_EQUAL(multiField.getNFields(), 1);
+
+    status = multiField.exchangeStop();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    for(int i = 0; i < nExchangeIDX; i++) {
+    	BOOST_CHECK_EQUAL(intData[i], exchangeIDX[i]);
+    }
+
+    // Once the exchange is stopped the fields can change again
+    status = multiField.clearFields();
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+}
+
+// Cleanup
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    // Cleanup MPI Environment
+    MPI_Finalize();
+}
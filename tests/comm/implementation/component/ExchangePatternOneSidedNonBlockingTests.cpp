@@ -189,7 +189,7 @@ BOOST_AUTO_TEST_CASE(init_test1)
     	int exchangeIDXSend[2] = {16, 17};
     	int rankSend[2] = {2, 2};
 
-    	status = pattern.init(comm, exchangeIDX, 7, exchangeIDXSend, 2, rankSend, 2);
+    	status = pattern.init(comm, exchangeIDX, 8, exchangeIDXSend, 2, rankSend, 2);
     	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 
     	// Check the data has been set up correctly
@@ -397,7 +397,7 @@ BOOST_AUTO_TEST_CASE(packSendBuffer_test1)
     	int exchangeIDXSend[2] = {16, 17};
     	int rankSend[2] = {2, 2};
 
-    	status = pattern.init(comm, exchangeIDX, 7, exchangeIDXSend, 2, rankSend, 2);
+    	status = pattern.init(comm, exchangeIDX, 8, exchangeIDXSend, 2, rankSend, 2);
     	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 
     	// Check the data has been set up correctly
@@ -923,16 +923,16 @@ BOOST_AUTO_TEST_CASE(exchange_test2)
 	    int rAdjncyCmp[5] = {6, 7, 14, 15, 13};
 	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.rAdjncy , pattern.rAdjncy + 5, rAdjncyCmp, rAdjncyCmp + 5);
 
-	    int data[8] = {220, 230, 240 ,250 ,260 ,270 ,280, 290};
-	    status = pattern.packSendBuffer(data, 8);
+	    int data[10] = {220, 230, 240 ,250 ,260 ,270 ,280, 290, 300, 310};
+	    status = pattern.packSendBuffer(data, 10);
 	    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 
 	    int sendBufferCmp[2] = {240, 250};
 	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendBuffer , pattern.sendBuffer + 2, sendBufferCmp, sendBufferCmp + 2);
 
-	    status = pattern.exchangeStart(data, 8);
+	    status = pattern.exchangeStart(data, 10);
 	    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
-	    status = pattern.exchangeStop(data, 8);
+	    status = pattern.exchangeStop(data, 10);
 	    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 
 	    // Check that the data buffer has been updated with the contents of the recvBuffer in the correct locations
@@ -0,0 +1,262 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ */
+
+#define BOOST_TEST_MODULE ExchangePatternTwoSidedPersistent
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+
+#include <stdexcept>
+#include <iostream>
+
+#include "mpi.h"
+
+#include "Communicator.h"
+#include "ExchangePatternTwoSidedPersistent.h"
+
+using namespace cupcfd::comm;
+
+// Setup
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+    MPI_Init(&argc, &argv);
+}
+
+// Exchange IDs for a 4 rank pattern. Each rank receives values for every ghost ID
+// from the owning rank.
+// Rank 0 owns 1-5, Rank 1 owns 6-10, Rank 2 owns 11-15, Rank 3 owns 16-20.
+static int exchangeIDX0[7] = {1, 2, 3, 4, 5, 6, 7};
+static int exchangeIDXSend0[2] = {4, 5};
+static int rankSend0[2] = {1, 1};
+
+static int exchangeIDX1[9] = {6, 7, 8, 9, 10, 4, 5, 11, 12};
+static int exchangeIDXSend1[4] = {6, 7, 9, 10};
+static int rankSend1[4] = {0, 0, 2, 2};
+
+static int exchangeIDX2[9] = {15, 13, 11, 12, 14, 10, 9, 17, 16};
+static int exchangeIDXSend2[5] = {12, 14, 11, 15, 13};
+static int rankSend2[5] = {1, 3, 1, 3, 3};
+
+static int exchangeIDX3[8] = {14, 15, 16, 17, 18, 19, 20, 13};
+static int exchangeIDXSend3[2] = {16, 17};
+static int rankSend3[2] = {2, 2};
+
+// Whether an exchange ID is owned by the current rank
+static bool isOwned(cupcfd::comm::Communicator& comm, int id) {
+	return ((id - 1) / 5) == comm.rank;
+}
+
+// === init ===
+// Test 1: Check the buffers, counts and persistent requests are set up
+BOOST_AUTO_TEST_CASE(init_test1)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    ExchangePatternTwoSidedPersistent<int> pattern;
+
+    if(comm.rank == 0)
+    {
+    	status = pattern.init(comm, exchangeIDX0, 7, exchangeIDXSend0, 2, rankSend0, 2);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    BOOST_CHECK_EQUAL(pattern.nSendBuffer, 2);
+	    BOOST_CHECK_EQUAL(pattern.nRecvBuffer, 2);
+
+	    int sendCountsCmp[1] = {2};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendCounts, pattern.sendCounts + pattern.nSendCounts, sendCountsCmp, sendCountsCmp + 1);
+
+	    int recvCountsCmp[1] = {2};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.recvCounts, pattern.recvCounts + pattern.nRecvCounts, recvCountsCmp, recvCountsCmp + 1);
+
+	    // 1 for send, 1 for recv
+	    BOOST_CHECK_EQUAL(pattern.nRequests, 2);
+	    BOOST_CHECK(pattern.requests);
+    }
+    else if(comm.rank == 1)
+    {
+    	status = pattern.init(comm, exchangeIDX1, 9, exchangeIDXSend1, 4, rankSend1, 4);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    BOOST_CHECK_EQUAL(pattern.nSendBuffer, 4);
+	    BOOST_CHECK_EQUAL(pattern.nRecvBuffer, 4);
+
+	    int sendCountsCmp[2] = {2, 2};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendCounts, pattern.sendCounts + pattern.nSendCounts, sendCountsCmp, sendCountsCmp + 2);
+
+	    int recvCountsCmp[2] = {2, 2};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.recvCounts, pattern.recvCounts + pattern.nRecvCounts, recvCountsCmp, recvCountsCmp + 2);
+
+	    // 2 for send, 2 for recv (process count)
+	    BOOST_CHECK_EQUAL(pattern.nRequests, 4);
+	    BOOST_CHECK(pattern.requests);
+    }
+    else if(comm.rank == 2)
+    {
+    	status = pattern.init(comm, exchangeIDX2, 9, exchangeIDXSend2, 5, rankSend2, 5);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    BOOST_CHECK_EQUAL(pattern.nSendBuffer, 5);
+	    BOOST_CHECK_EQUAL(pattern.nRecvBuffer, 4);
+
+	    int sendCountsCmp[2] = {2, 3};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendCounts, pattern.sendCounts + pattern.nSendCounts, sendCountsCmp, sendCountsCmp + 2);
+
+	    int recvCountsCmp[2] = {2, 2};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.recvCounts, pattern.recvCounts + pattern.nRecvCounts, recvCountsCmp, recvCountsCmp + 2);
+
+	    // 2 for send, 2 for recv (process count)
+	    BOOST_CHECK_EQUAL(pattern.nRequests, 4);
+	    BOOST_CHECK(pattern.requests);
+    }
+    else if(comm.rank == 3)
+    {
+    	status = pattern.init(comm, exchangeIDX3, 8, exchangeIDXSend3, 2, rankSend3, 2);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    BOOST_CHECK_EQUAL(pattern.nSendBuffer, 2);
+	    BOOST_CHECK_EQUAL(pattern.nRecvBuffer, 3);
+
+	    int sendCountsCmp[1] = {2};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendCounts, pattern.sendCounts + pattern.nSendCounts, sendCountsCmp, sendCountsCmp + 1);
+
+	    int recvCountsCmp[1] = {3};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.recvCounts, pattern.recvCounts + pattern.nRecvCounts, recvCountsCmp, recvCountsCmp + 1);
+
+	    // 1 for send, 1 for recv (process count)
+	    BOOST_CHECK_EQUAL(pattern.nRequests, 2);
+	    BOOST_CHECK(pattern.requests);
+    }
+}
+
+// === packSendBuffer ===
+// Test 1: Check the send buffer is packed in pattern order
+BOOST_AUTO_TEST_CASE(packSendBuffer_test1)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    ExchangePatternTwoSidedPersistent<int> pattern;
+
+    if(comm.rank == 0)
+    {
+    	status = pattern.init(comm, exchangeIDX0, 7, exchangeIDXSend0, 2, rankSend0, 2);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    int data[7] = {42, 52, 12, 32, 1032, 201, 876};
+	    status = pattern.packSendBuffer(data, 7);
+	    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    int sendBufferCmp[2] = {32, 1032};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendBuffer, pattern.sendBuffer + 2, sendBufferCmp, sendBufferCmp + 2);
+    }
+    else if(comm.rank == 1)
+    {
+    	status = pattern.init(comm, exchangeIDX1, 9, exchangeIDXSend1, 4, rankSend1, 4);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    int data[9] = {20, 30, 40, 50, 60, 70, 80, 90, 100};
+	    status = pattern.packSendBuffer(data, 9);
+	    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    int sendBufferCmp[4] = {20, 30, 50, 60};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendBuffer, pattern.sendBuffer + 4, sendBufferCmp, sendBufferCmp + 4);
+    }
+    else if(comm.rank == 2)
+    {
+    	status = pattern.init(comm, exchangeIDX2, 9, exchangeIDXSend2, 5, rankSend2, 5);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    int data[9] = {150, 130, 110, 120, 140, 100, 90, 170, 160};
+	    status = pattern.packSendBuffer(data, 9);
+	    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    int sendBufferCmp[5] = {120, 110, 140, 150, 130};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendBuffer, pattern.sendBuffer + 5, sendBufferCmp, sendBufferCmp + 5);
+    }
+    else if(comm.rank == 3)
+    {
+    	status = pattern.init(comm, exchangeIDX3, 8, exchangeIDXSend3, 2, rankSend3, 2);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    int data[8] = {140, 150, 160, 170, 180, 190, 200, 130};
+	    status = pattern.packSendBuffer(data, 8);
+	    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    int sendBufferCmp[2] = {160, 170};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendBuffer, pattern.sendBuffer + 2, sendBufferCmp, sendBufferCmp + 2);
+    }
+}
+
+// === exchangeStart/exchangeStop ===
+// Test 1: Repeated exchanges reuse the same persistent requests
+BOOST_AUTO_TEST_CASE(exchange_test1)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    ExchangePatternTwoSidedPersistent<double> pattern;
+    int * exchangeIDX;
+    int nExchangeIDX;
+
+    if(comm.rank == 0) {
+    	status = pattern.init(comm, exchangeIDX0, 7, exchangeIDXSend0, 2, rankSend0, 2);
+    	exchangeIDX = exchangeIDX0;
+    	nExchangeIDX = 7;
+    }
+    else if(comm.rank == 1) {
+    	status = pattern.init(comm, exchangeIDX1, 9, exchangeIDXSend1, 4, rankSend1, 4);
+    	exchangeIDX = exchangeIDX1;
+    	nExchangeIDX = 9;
+    }
+    else if(comm.rank == 2) {
+    	status = pattern.init(comm, exchangeIDX2, 9, exchangeIDXSend2, 5, rankSend2, 5);
+    	exchangeIDX = exchangeIDX2;
+    	nExchangeIDX = 9;
+    }
+    else {
+    	status = pattern.init(comm, exchangeIDX3, 8, exchangeIDXSend3, 2, rankSend3, 2);
+    	exchangeIDX = exchangeIDX3;
+    	nExchangeIDX = 8;
+    }
+    BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    MPI_Request * requests = pattern.requests;
+    double data[9];
+
+    for(int iteration = 1; iteration <= 3; iteration++) {
+    	// Owned values change every iteration, ghosts are reset
+    	for(int i = 0; i < nExchangeIDX; i++) {
+    		data[i] = isOwned(comm, exchangeIDX[i]) ? exchangeIDX[i] * iteration + 0.5 : -1.0;
+    	}
+
+    	status = pattern.exchangeStart(data, nExchangeIDX);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    	status = pattern.exchangeStop(data, nExchangeIDX);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+    	for(int i = 0; i < nExchangeIDX; i++) {
+    		BOOST_CHECK_EQUAL(data[i], exchangeIDX[i] * iteration + 0.5);
+    	}
+
+    	// No new requests should be created between exchanges
+    	BOOST_CHECK_EQUAL(pattern.requests, requests);
+    }
+}
+
+// Cleanup
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    // Cleanup MPI Environment
+    MPI_Finalize();
+}
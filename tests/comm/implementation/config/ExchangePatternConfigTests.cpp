@@ -65,6 +65,24 @@ BOOST_AUTO_TEST_CASE(setgetExchangeMethod_test1, * utf::tolerance(0.00001))
 	BOOST_CHECK_EQUAL(config.getExchangeMethod(), EXCHANGE_NONBLOCKING_ONE_SIDED);
 }
 
+// Test 2: Test correct set/get of the persistent two sided method
+BOOST_AUTO_TEST_CASE(setgetExchangeMethod_test2, * utf::tolerance(0.00001))
+{
+	ExchangePatternConfig config;
+
+	config.setExchangeMethod(EXCHANGE_NONBLOCKING_TWO_SIDED_PERSISTENT);
+	BOOST_CHECK_EQUAL(config.getExchangeMethod(), EXCHANGE_NONBLOCKING_TWO_SIDED_PERSISTENT);
+}
+
+// Test 3: Test correct set/get of the neighbourhood collective method
+BOOST_AUTO_TEST_CASE(setgetExchangeMethod_test3, * utf::tolerance(0.00001))
+{
+	ExchangePatternConfig config;
+
+	config.setExchangeMethod(EXCHANGE_NONBLOCKING_NEIGHBOUR_COLLECTIVE);
+	BOOST_CHECK_EQUAL(config.getExchangeMethod(), EXCHANGE_NONBLOCKING_NEIGHBOUR_COLLECTIVE);
+}
+
 // === operator= ===
 BOOST_AUTO_TEST_CASE(operator_equals_test1, * utf::tolerance(0.00001))
 {
@@ -82,6 +100,19 @@ BOOST_AUTO_TEST_CASE(operator_equals_test1, * utf::tolerance(0.00001))
 	BOOST_CHECK_EQUAL(config.getExchangeMethod(), EXCHANGE_NONBLOCKING_ONE_SIDED);
 }
 
+// === createExchangePattern ===
+// Test 1: Check that an unrecognised exchange method is rejected
+BOOST_AUTO_TEST_CASE(createExchangePattern_test1)
+{
+	cupcfd::error::eCodes status;
+	ExchangePatternConfig config((ExchangeMethod) 100);
+	ExchangePattern<double> * pattern = nullptr;
+
+	status = config.createExchangePattern(&pattern);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_CONFIG_INVALID_OPTION);
+	BOOST_CHECK(pattern == nullptr);
+}
+
 // === buildExchangePattern ===
 // Test 1: Create a OneSidedPattern and populate it with data
 BOOST_AUTO_TEST_CASE(buildExchangePattern_test1, * utf::tolerance(0.00001))
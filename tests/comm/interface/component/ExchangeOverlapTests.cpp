@@ -0,0 +1,142 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for overlapping computation with an ExchangePattern data exchange
+ */
+
+#define BOOST_TEST_MODULE ExchangeOverlap
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+#include "mpi.h"
+
+#include "Communicator.h"
+#include "ExchangeOverlap.h"
+#include "ExchangePatternTwoSidedNonBlocking.h"
+
+using namespace cupcfd::comm;
+
+// Setup
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+    MPI_Init(&argc, &argv);
+}
+
+// Set up a ring pattern where each rank owns one element (local index 0) and
+// receives the element of the next rank (local index 1)
+void buildRingPattern(Communicator& comm, ExchangePatternTwoSidedNonBlocking<int>& pattern) {
+	cupcfd::error::eCodes status;
+
+	int next = (comm.rank + 1) % comm.size;
+	int prev = (comm.rank + comm.size - 1) % comm.size;
+
+	int exchangeIDX[2] = {comm.rank + 1, next + 1};
+	int exchangeIDXSend[1] = {comm.rank + 1};
+	int rankSend[1] = {prev};
+
+	status = pattern.init(comm, exchangeIDX, 2, exchangeIDXSend, 1, rankSend, 1);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+}
+
+// === ExchangeOverlapTiming ===
+// Test 1: The overlap fraction is the share of the exchange window spent on interior work
+BOOST_AUTO_TEST_CASE(getOverlapFraction_test1)
+{
+	ExchangeOverlapTiming timing;
+
+	BOOST_CHECK_EQUAL(timing.nExchanges, 0);
+	BOOST_CHECK_EQUAL(timing.getOverlapFraction(), 0.0);
+
+	timing.interiorTime = 3.0;
+	timing.waitTime = 1.0;
+	BOOST_CHECK_EQUAL(timing.getOverlapFraction(), 0.75);
+
+	timing.waitTime = 0.0;
+	BOOST_CHECK_EQUAL(timing.getOverlapFraction(), 1.0);
+
+	timing.reset();
+	BOOST_CHECK_EQUAL(timing.interiorTime, 0.0);
+	BOOST_CHECK_EQUAL(timing.waitTime, 0.0);
+	BOOST_CHECK_EQUAL(timing.getOverlapFraction(), 0.0);
+}
+
+// === exchangeOverlap ===
+// Test 1: The interior work runs before the exchanged data is available, and the halo work after
+BOOST_AUTO_TEST_CASE(exchangeOverlap_test1)
+{
+	Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+
+	ExchangePatternTwoSidedNonBlocking<int> pattern;
+	buildRingPattern(comm, pattern);
+
+	int next = (comm.rank + 1) % comm.size;
+	int data[2] = {comm.rank * 10, -1};
+	std::vector<int> stages;
+
+	ExchangeOverlapTiming timing;
+
+	status = exchangeOverlap(pattern, data, 2,
+							 [&]() { stages.push_back(0); return cupcfd::error::E_SUCCESS; },
+							 [&]() { stages.push_back(1); BOOST_CHECK_EQUAL(data[1], next * 10); return cupcfd::error::E_SUCCESS; },
+							 &timing);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_REQUIRE_EQUAL(stages.size(), 2);
+	BOOST_CHECK_EQUAL(stages[0], 0);
+	BOOST_CHECK_EQUAL(stages[1], 1);
+
+	BOOST_CHECK_EQUAL(data[0], comm.rank * 10);
+	BOOST_CHECK_EQUAL(data[1], next * 10);
+
+	BOOST_CHECK_EQUAL(timing.nExchanges, 1);
+	BOOST_CHECK(timing.getOverlapFraction() >= 0.0);
+	BOOST_CHECK(timing.getOverlapFraction() <= 1.0);
+
+	// Timing is optional
+	data[1] = -1;
+	status = exchangeOverlap(pattern, data, 2,
+							 [&]() { return cupcfd::error::E_SUCCESS; },
+							 [&]() { return cupcfd::error::E_SUCCESS; },
+							 nullptr);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(data[1], next * 10);
+}
+
+// Test 2: An error in the interior work is returned after the exchange completes, and the halo work is skipped
+BOOST_AUTO_TEST_CASE(exchangeOverlap_test2)
+{
+	Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+
+	ExchangePatternTwoSidedNonBlocking<int> pattern;
+	buildRingPattern(comm, pattern);
+
+	int next = (comm.rank + 1) % comm.size;
+	int data[2] = {comm.rank * 10, -1};
+	bool haloRun = false;
+
+	status = exchangeOverlap(pattern, data, 2,
+							 [&]() { return cupcfd::error::E_INVALID_INDEX; },
+							 [&]() { haloRun = true; return cupcfd::error::E_SUCCESS; },
+							 nullptr);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_INDEX);
+	BOOST_CHECK_EQUAL(haloRun, false);
+	BOOST_CHECK_EQUAL(data[1], next * 10);
+}
+
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    MPI_Finalize();
+}
@@ -45,6 +45,14 @@ namespace cupcfd
 				return cupcfd::error::E_SUCCESS;
 			}
 
+			T * getSendBuffer() {
+				return nullptr;
+			}
+
+			T * getRecvBuffer() {
+				return nullptr;
+			}
+
 			cupcfd::error::eCodes exchangeStart(
 				T * sourceData __attribute__((unused)), 
 				int nData __attribute__((unused))) {
@@ -136,6 +144,15 @@ BOOST_AUTO_TEST_CASE(init_test1)
 	    int rAdjncyCmp[2] = {6, 7};
 	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.rAdjncy , pattern.rAdjncy + 2, rAdjncyCmp, rAdjncyCmp + 2);
 
+	    // Local indexes should be resolved from the exchange indexes
+	    BOOST_CHECK_EQUAL(pattern.nSendLocalIdx, 2);
+	    int sendLocalIdxCmp[2] = {3, 4};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendLocalIdx , pattern.sendLocalIdx + 2, sendLocalIdxCmp, sendLocalIdxCmp + 2);
+
+	    BOOST_CHECK_EQUAL(pattern.nRecvLocalIdx, 2);
+	    int recvLocalIdxCmp[2] = {5, 6};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.recvLocalIdx , pattern.recvLocalIdx + 2, recvLocalIdxCmp, recvLocalIdxCmp + 2);
+
     }
     else if(comm.rank == 1)
     {
@@ -176,6 +193,14 @@ BOOST_AUTO_TEST_CASE(init_test1)
 	    int rAdjncyCmp[4] = {4, 5, 12, 11};
 	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.rAdjncy , pattern.rAdjncy + 4, rAdjncyCmp, rAdjncyCmp + 4);
 
+	    BOOST_CHECK_EQUAL(pattern.nSendLocalIdx, 4);
+	    int sendLocalIdxCmp[4] = {0, 1, 3, 4};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendLocalIdx , pattern.sendLocalIdx + 4, sendLocalIdxCmp, sendLocalIdxCmp + 4);
+
+	    BOOST_CHECK_EQUAL(pattern.nRecvLocalIdx, 4);
+	    int recvLocalIdxCmp[4] = {5, 6, 8, 7};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.recvLocalIdx , pattern.recvLocalIdx + 4, recvLocalIdxCmp, recvLocalIdxCmp + 4);
+
     }
     else if(comm.rank == 2)
     {
@@ -220,6 +245,14 @@ BOOST_AUTO_TEST_CASE(init_test1)
 	    int rAdjncyCmp[4] = {9, 10, 16, 17};
 	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.rAdjncy , pattern.rAdjncy + 4, rAdjncyCmp, rAdjncyCmp + 4);
 
+	    BOOST_CHECK_EQUAL(pattern.nSendLocalIdx, 5);
+	    int sendLocalIdxCmp[5] = {3, 2, 4, 0, 1};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendLocalIdx , pattern.sendLocalIdx + 5, sendLocalIdxCmp, sendLocalIdxCmp + 5);
+
+	    BOOST_CHECK_EQUAL(pattern.nRecvLocalIdx, 4);
+	    int recvLocalIdxCmp[4] = {6, 5, 8, 7};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.recvLocalIdx , pattern.recvLocalIdx + 4, recvLocalIdxCmp, recvLocalIdxCmp + 4);
+
     }
     else if(comm.rank == 3)
     {
@@ -228,7 +261,7 @@ BOOST_AUTO_TEST_CASE(init_test1)
     	int exchangeIDXSend[2] = {16, 17};
     	int rankSend[2] = {2, 2};
 
-    	status = pattern.init(comm, exchangeIDX, 7, exchangeIDXSend, 2, rankSend, 2);
+    	status = pattern.init(comm, exchangeIDX, 8, exchangeIDXSend, 2, rankSend, 2);
     	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 
     	// Check the data has been set up correctly
@@ -257,6 +290,58 @@ BOOST_AUTO_TEST_CASE(init_test1)
 
 	    int rAdjncyCmp[3] = {14, 15, 13};
 	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.rAdjncy , pattern.rAdjncy + 3, rAdjncyCmp, rAdjncyCmp + 3);
+
+	    BOOST_CHECK_EQUAL(pattern.nSendLocalIdx, 2);
+	    int sendLocalIdxCmp[2] = {2, 3};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.sendLocalIdx , pattern.sendLocalIdx + 2, sendLocalIdxCmp, sendLocalIdxCmp + 2);
+
+	    BOOST_CHECK_EQUAL(pattern.nRecvLocalIdx, 3);
+	    int recvLocalIdxCmp[3] = {0, 1, 7};
+	    BOOST_CHECK_EQUAL_COLLECTIONS(pattern.recvLocalIdx , pattern.recvLocalIdx + 3, recvLocalIdxCmp, recvLocalIdxCmp + 3);
+    }
+}
+
+// Test 2: Receiving an exchange index that has no local mapping should be detected at init
+BOOST_AUTO_TEST_CASE(init_test2)
+{
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+    cupcfd::error::eCodes status;
+
+    cupcfd::comm::ExchangePatternTest<int> pattern;
+
+    if(comm.rank == 0)
+    {
+    	// Rank 0 owns exchange ids 1-3, but has no space for 4
+    	int exchangeIDX[3] = {1, 2, 3};
+    	int exchangeIDXSend[1] = {3};
+    	int rankSend[1] = {1};
+
+    	status = pattern.init(comm, exchangeIDX, 3, exchangeIDXSend, 1, rankSend, 1);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_INDEX);
+    }
+    else if(comm.rank == 1)
+    {
+    	// Rank 1 owns exchange id 4, with space for 3, and sends 4 to rank 0
+    	int exchangeIDX[2] = {4, 3};
+    	int exchangeIDXSend[1] = {4};
+    	int rankSend[1] = {0};
+
+    	status = pattern.init(comm, exchangeIDX, 2, exchangeIDXSend, 1, rankSend, 1);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	    BOOST_CHECK_EQUAL(pattern.nRecvLocalIdx, 1);
+	    BOOST_CHECK_EQUAL(pattern.recvLocalIdx[0], 1);
+    }
+    else
+    {
+    	// Ranks 2 and 3 exchange a single correctly mapped element with each other
+    	int other = (comm.rank == 2) ? 3 : 2;
+    	int exchangeIDX[2] = {comm.rank * 100, other * 100};
+    	int exchangeIDXSend[1] = {comm.rank * 100};
+    	int rankSend[1] = {other};
+
+    	status = pattern.init(comm, exchangeIDX, 2, exchangeIDXSend, 1, rankSend, 1);
+    	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
     }
 }
 
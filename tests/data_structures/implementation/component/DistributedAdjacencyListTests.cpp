@@ -1511,9 +1511,208 @@ BOOST_AUTO_TEST_CASE(driver_finalize)
 
 }
 
+// Test: Check the send/recv exchange lists built by finalize are consistent across processes
+BOOST_AUTO_TEST_CASE(driver_finalize_exchange_lists)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	DistributedAdjacencyList<int, int> graph(comm);
+	cupcfd::error::eCodes status;
+
+	// Each process owns a ring segment of 5 nodes, with a ghost node at either end
+	// owned by the neighbouring processes.
+	int base = comm.rank * 5;
+	for(int i = 0; i < 5; i++) {
+		status = graph.addLocalNode(base + i);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	int prev = (base + (comm.size * 5) - 1) % (comm.size * 5);
+	int next = (base + 5) % (comm.size * 5);
+
+	status = graph.addGhostNode(prev);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = graph.addGhostNode(next);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = graph.addUndirectedEdge(base, prev);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = graph.addUndirectedEdge(base + 4, next);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = graph.finalize();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int prevRank = (comm.rank + comm.size - 1) % comm.size;
+	int nextRank = (comm.rank + 1) % comm.size;
+
+	BOOST_CHECK_EQUAL(graph.nodeOwner[prev], prevRank);
+	BOOST_CHECK_EQUAL(graph.nodeOwner[next], nextRank);
+
+	// Global IDs are assigned sequentially by rank, so match the node ids here
+	BOOST_CHECK_EQUAL(graph.nodeToGlobal[prev], prev);
+	BOOST_CHECK_EQUAL(graph.nodeToGlobal[next], next);
+
+	// Ranks are sorted in ascending order
+	int minRank = std::min(prevRank, nextRank);
+	int maxRank = std::max(prevRank, nextRank);
+
+	BOOST_REQUIRE_EQUAL(graph.neighbourRanks.size(), 2);
+	BOOST_CHECK_EQUAL(graph.neighbourRanks[0], minRank);
+	BOOST_CHECK_EQUAL(graph.neighbourRanks[1], maxRank);
+
+	// Receive the ghost node from each neighbour
+	BOOST_REQUIRE_EQUAL(graph.recvRank.size(), 2);
+	BOOST_CHECK_EQUAL(graph.recvRank[0], minRank);
+	BOOST_CHECK_EQUAL(graph.recvRank[1], maxRank);
+	BOOST_CHECK_EQUAL(graph.recvGlobalIDsAdjncy[0], (minRank == prevRank) ? prev : next);
+	BOOST_CHECK_EQUAL(graph.recvGlobalIDsAdjncy[1], (maxRank == prevRank) ? prev : next);
+
+	// Send the end node of the segment to the neighbour that holds it as a ghost
+	BOOST_REQUIRE_EQUAL(graph.sendRank.size(), 2);
+	BOOST_CHECK_EQUAL(graph.sendRank[0], minRank);
+	BOOST_CHECK_EQUAL(graph.sendRank[1], maxRank);
+	BOOST_CHECK_EQUAL(graph.sendGlobalIDsAdjncy[0], (minRank == prevRank) ? base : base + 4);
+	BOOST_CHECK_EQUAL(graph.sendGlobalIDsAdjncy[1], (maxRank == prevRank) ? base : base + 4);
+
+	int sendXAdjCmp[3] = {0, 1, 2};
+	BOOST_CHECK_EQUAL_COLLECTIONS(graph.sendGlobalIDsXAdj.begin(), graph.sendGlobalIDsXAdj.end(), sendXAdjCmp, sendXAdjCmp + 3);
+}
+
+// Test: Error Case: A ghost node that is not owned by any process
+BOOST_AUTO_TEST_CASE(driver_finalize_unclaimed_ghost)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	DistributedAdjacencyList<int, int> graph(comm);
+	cupcfd::error::eCodes status;
+
+	status = graph.addLocalNode(comm.rank);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	if(comm.rank == 0) {
+		// No process owns this node
+		status = graph.addGhostNode(1000);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	// Every process must still complete finalize rather than waiting on the failed process
+	status = graph.finalize();
+
+	if(comm.rank == 0) {
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_ADJACENCY_LIST_NODE_CLAIM_MISMATCH);
+	}
+	else {
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+}
+
+// Test: Finalize with a single process communicator
+BOOST_AUTO_TEST_CASE(driver_finalize_serial)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_SELF);
+	DistributedAdjacencyList<int, int> graph(comm);
+	cupcfd::error::eCodes status;
+
+	for(int i = 0; i < 4; i++) {
+		status = graph.addLocalNode(10 + i);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	status = graph.addUndirectedEdge(10, 11);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = graph.finalize();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(graph.nGNodes, 4);
+	BOOST_CHECK_EQUAL(graph.nGGhNodes, 0);
+	BOOST_CHECK_EQUAL(graph.neighbourRanks.size(), 0);
+	BOOST_CHECK_EQUAL(graph.sendRank.size(), 0);
+	BOOST_CHECK_EQUAL(graph.recvRank.size(), 0);
+	BOOST_CHECK_EQUAL(graph.nodeToGlobal[13], 3);
+}
+
 // === sortNodesByLocal ===
 // ToDo: Add Tests (although indirectly tested in finalize)
 
+// === reorderLocalNodes ===
+// Test 1: Local indexes follow the order provided, and the edges are kept
+BOOST_AUTO_TEST_CASE(reorderLocalNodes_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_SELF);
+	DistributedAdjacencyList<int, int> graph(comm);
+	cupcfd::error::eCodes status;
+
+	for(int i = 0; i < 4; i++) {
+		status = graph.addLocalNode(10 + i);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	status = graph.addUndirectedEdge(10, 11);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = graph.addUndirectedEdge(11, 13);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Not finalized
+	int nodes[4] = {13, 11, 10, 12};
+	status = graph.reorderLocalNodes(nodes, 4);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_DISTGRAPH_UNFINALIZED);
+
+	status = graph.finalize();
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = graph.reorderLocalNodes(nodes, 4);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < 4; i++) {
+		int idx;
+		status = graph.connGraph.getNodeLocalIndex(nodes[i], &idx);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(idx, i);
+	}
+
+	bool exists;
+	status = graph.connGraph.existsEdge(10, 11, &exists);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(exists, true);
+	status = graph.connGraph.existsEdge(13, 11, &exists);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(exists, true);
+	status = graph.connGraph.existsEdge(10, 13, &exists);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(exists, false);
+
+	// Global IDs are unchanged
+	BOOST_CHECK_EQUAL(graph.nodeToGlobal[13], 3);
+}
+
+// Test 2: Error if the nodes provided are not every local node exactly once
+BOOST_AUTO_TEST_CASE(reorderLocalNodes_test2)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_SELF);
+	DistributedAdjacencyList<int, int> graph(comm);
+	cupcfd::error::eCodes status;
+
+	for(int i = 0; i < 3; i++) {
+		status = graph.addLocalNode(10 + i);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	status = graph.finalize();
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int tooFew[2] = {10, 11};
+	status = graph.reorderLocalNodes(tooFew, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+
+	int duplicate[3] = {10, 11, 10};
+	status = graph.reorderLocalNodes(duplicate, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_INDEX);
+
+	int missing[3] = {10, 11, 20};
+	status = graph.reorderLocalNodes(missing, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_INDEX);
+}
+
 // === getGhostNodes ===
 // ToDo: Add Tests (although indirectly tested in finalize)
 
@@ -0,0 +1,461 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the DistributedSparseMatrixCSR class
+ */
+
+#define BOOST_TEST_MODULE DistributedSparseMatrixCSR
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+
+#include "DistributedSparseMatrixCSR.h"
+#include "SparseMatrixSELL.h"
+#include "SparseMatrixBCSR.h"
+#include "Communicator.h"
+#include "Error.h"
+
+namespace utf = boost::unit_test;
+using namespace cupcfd::data_structures;
+
+typedef DistributedSparseMatrixCSR<int,double> DistMatrix;
+
+// Set the rows rowStart to rowEnd - 1 of an 8x8 tridiagonal matrix with 2 on the diagonal and -1 off the diagonal
+void setTridiagonal(SparseMatrixCSR<int,double>& matrix, int rowStart, int rowEnd)
+{
+	cupcfd::error::eCodes status;
+
+	for(int row = rowStart; row < rowEnd; row++)
+	{
+		if(row > 0)
+		{
+			status = matrix.setElement(row + matrix.baseIndex, row - 1 + matrix.baseIndex, -1.0);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+
+		status = matrix.setElement(row + matrix.baseIndex, row + matrix.baseIndex, 2.0);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		if(row < 7)
+		{
+			status = matrix.setElement(row + matrix.baseIndex, row + 1 + matrix.baseIndex, -1.0);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+	}
+}
+
+// These tests require MPI
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+    MPI_Init(&argc, &argv);
+}
+
+// === Constructors/Deconstructors ===
+// Test 1: Distribute a tridiagonal matrix, two rows per process, and check the ghost columns and row split
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::comm::ExchangePatternConfig patternConfig;
+
+	SparseMatrixCSR<int,double> matrix(8, 8, 0);
+	setTridiagonal(matrix, comm.rank * 2, (comm.rank * 2) + 2);
+
+	DistributedSparseMatrixCSR<int,double> distMatrix(comm, matrix, comm.rank * 2, (comm.rank * 2) + 2, patternConfig);
+
+	int rangeCmp[5] = {0, 2, 4, 6, 8};
+	BOOST_CHECK_EQUAL_COLLECTIONS(rangeCmp, rangeCmp + 5, distMatrix.rowRanges.begin(), distMatrix.rowRanges.end());
+	BOOST_CHECK_EQUAL(distMatrix.mGlobal, 8);
+	BOOST_CHECK_EQUAL(distMatrix.mLocal, 2);
+	BOOST_CHECK(distMatrix.haloPattern != nullptr);
+
+	for(int row = 0; row < 8; row++)
+	{
+		BOOST_CHECK_EQUAL(distMatrix.getRowOwner(row), row / 2);
+	}
+
+	if(comm.rank == 0)
+	{
+		int ghostCmp[1] = {2};
+		int interiorCmp[1] = {0};
+		int haloCmp[1] = {1};
+		BOOST_CHECK_EQUAL_COLLECTIONS(ghostCmp, ghostCmp + 1, distMatrix.ghostGlobalIDs.begin(), distMatrix.ghostGlobalIDs.end());
+		BOOST_CHECK_EQUAL_COLLECTIONS(interiorCmp, interiorCmp + 1, distMatrix.interiorRows.begin(), distMatrix.interiorRows.end());
+		BOOST_CHECK_EQUAL_COLLECTIONS(haloCmp, haloCmp + 1, distMatrix.haloRows.begin(), distMatrix.haloRows.end());
+
+		// Row 1 has the owned columns 0 and 1, then the ghost column (global column 2)
+		int IACmp[3] = {0, 2, 5};
+		int JACmp[5] = {0, 1, 0, 1, 2};
+		double ACmp[5] = {2.0, -1.0, -1.0, 2.0, -1.0};
+		BOOST_CHECK_EQUAL_COLLECTIONS(IACmp, IACmp + 3, distMatrix.localA.IA.begin(), distMatrix.localA.IA.end());
+		BOOST_CHECK_EQUAL_COLLECTIONS(JACmp, JACmp + 5, distMatrix.localA.JA.begin(), distMatrix.localA.JA.end());
+		BOOST_CHECK_EQUAL_COLLECTIONS(ACmp, ACmp + 5, distMatrix.localA.A.begin(), distMatrix.localA.A.end());
+	}
+	else if(comm.rank == 3)
+	{
+		int ghostCmp[1] = {5};
+		int interiorCmp[1] = {1};
+		int haloCmp[1] = {0};
+		BOOST_CHECK_EQUAL_COLLECTIONS(ghostCmp, ghostCmp + 1, distMatrix.ghostGlobalIDs.begin(), distMatrix.ghostGlobalIDs.end());
+		BOOST_CHECK_EQUAL_COLLECTIONS(interiorCmp, interiorCmp + 1, distMatrix.interiorRows.begin(), distMatrix.interiorRows.end());
+		BOOST_CHECK_EQUAL_COLLECTIONS(haloCmp, haloCmp + 1, distMatrix.haloRows.begin(), distMatrix.haloRows.end());
+
+		// The ghost column of row 0 (global column 5) moves after the owned columns
+		int JACmp[5] = {0, 1, 2, 0, 1};
+		double ACmp[5] = {2.0, -1.0, -1.0, -1.0, 2.0};
+		BOOST_CHECK_EQUAL_COLLECTIONS(JACmp, JACmp + 5, distMatrix.localA.JA.begin(), distMatrix.localA.JA.end());
+		BOOST_CHECK_EQUAL_COLLECTIONS(ACmp, ACmp + 5, distMatrix.localA.A.begin(), distMatrix.localA.A.end());
+	}
+	else
+	{
+		int ghostCmp[2] = {(comm.rank * 2) - 1, (comm.rank * 2) + 2};
+		int haloCmp[2] = {0, 1};
+		BOOST_CHECK_EQUAL_COLLECTIONS(ghostCmp, ghostCmp + 2, distMatrix.ghostGlobalIDs.begin(), distMatrix.ghostGlobalIDs.end());
+		BOOST_CHECK_EQUAL(distMatrix.interiorRows.size(), 0);
+		BOOST_CHECK_EQUAL_COLLECTIONS(haloCmp, haloCmp + 2, distMatrix.haloRows.begin(), distMatrix.haloRows.end());
+	}
+}
+
+// Test 2: Check that row ranges that do not cover the matrix in rank order are rejected on every process
+BOOST_AUTO_TEST_CASE(constructor_test2)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::comm::ExchangePatternConfig patternConfig;
+
+	SparseMatrixCSR<int,double> matrix(8, 8, 0);
+	setTridiagonal(matrix, 0, 8);
+
+	// Every process claims the first two rows
+	BOOST_CHECK_THROW(DistMatrix distMatrix(comm, matrix, 0, 2, patternConfig), std::runtime_error);
+}
+
+// Test 3: Check that a non-square matrix is rejected
+BOOST_AUTO_TEST_CASE(constructor_test3)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::comm::ExchangePatternConfig patternConfig;
+
+	SparseMatrixCSR<int,double> matrix(8, 9, 0);
+
+	BOOST_CHECK_THROW(DistMatrix distMatrix(comm, matrix, comm.rank * 2, (comm.rank * 2) + 2, patternConfig), std::runtime_error);
+}
+
+// === multiply ===
+// Test 1: Multiply with a distributed tridiagonal matrix using each exchange method
+BOOST_AUTO_TEST_CASE(multiply_test1, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	SparseMatrixCSR<int,double> matrix(8, 8, 0);
+	setTridiagonal(matrix, comm.rank * 2, (comm.rank * 2) + 2);
+
+	cupcfd::comm::ExchangeMethod methods[4] = {cupcfd::comm::EXCHANGE_NONBLOCKING_ONE_SIDED,
+											   cupcfd::comm::EXCHANGE_NONBLOCKING_TWO_SIDED,
+											   cupcfd::comm::EXCHANGE_NONBLOCKING_TWO_SIDED_PERSISTENT,
+											   cupcfd::comm::EXCHANGE_NONBLOCKING_NEIGHBOUR_COLLECTIVE};
+
+	// x[i] = (i+1)^2, so y is -2 except for the last row
+	double x[2] = {double(((comm.rank * 2) + 1) * ((comm.rank * 2) + 1)), double(((comm.rank * 2) + 2) * ((comm.rank * 2) + 2))};
+	double yCmp[8] = {-2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, 79.0};
+
+	for(int m = 0; m < 4; m++)
+	{
+		cupcfd::comm::ExchangePatternConfig patternConfig(methods[m]);
+		DistributedSparseMatrixCSR<int,double> distMatrix(comm, matrix, comm.rank * 2, (comm.rank * 2) + 2, patternConfig);
+
+		double y[2];
+
+		// Repeat to check the exchange can be reused
+		for(int repeat = 0; repeat < 2; repeat++)
+		{
+			status = distMatrix.multiply(x, 2, y, 2);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+			BOOST_TEST(y[0] == yCmp[comm.rank * 2]);
+			BOOST_TEST(y[1] == yCmp[(comm.rank * 2) + 1]);
+		}
+
+		BOOST_CHECK_EQUAL(distMatrix.timing.nExchanges, 2);
+	}
+}
+
+// Test 2: Multiply with a matrix with a base index of 1, uneven row ranges (including a process
+// with no rows) and columns far from the diagonal, comparing against a serial product
+BOOST_AUTO_TEST_CASE(multiply_test2, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::comm::ExchangePatternConfig patternConfig;
+
+	int starts[5] = {0, 3, 3, 4, 8};
+	int rowStart = starts[comm.rank];
+	int rowEnd = starts[comm.rank + 1];
+
+	// Every process stores the full matrix, only the owned rows are used
+	SparseMatrixCSR<int,double> matrix(8, 8, 1);
+	double dense[8][8] = {};
+
+	for(int row = 0; row < 8; row++)
+	{
+		int cols[3] = {row, (row * 3) % 8, 7 - row};
+
+		for(int j = 0; j < 3; j++)
+		{
+			dense[row][cols[j]] = double(row + cols[j] + 1);
+			status = matrix.setElement(row + 1, cols[j] + 1, dense[row][cols[j]]);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+	}
+
+	DistributedSparseMatrixCSR<int,double> distMatrix(comm, matrix, rowStart, rowEnd, patternConfig);
+	BOOST_CHECK_EQUAL(distMatrix.mLocal, rowEnd - rowStart);
+
+	double xGlobal[8] = {0.5, -1.0, 2.0, 3.5, -0.25, 1.0, 4.0, -2.0};
+	double y[8];
+
+	status = distMatrix.multiply(xGlobal + rowStart, rowEnd - rowStart, y, rowEnd - rowStart);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int row = rowStart; row < rowEnd; row++)
+	{
+		double yCmp = 0.0;
+
+		for(int col = 0; col < 8; col++)
+		{
+			yCmp = yCmp + dense[row][col] * xGlobal[col];
+		}
+
+		BOOST_TEST(y[row - rowStart] == yCmp);
+	}
+}
+
+// Test 3: Multiply with a diagonal matrix, where no process has ghost columns
+BOOST_AUTO_TEST_CASE(multiply_test3, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::comm::ExchangePatternConfig patternConfig;
+
+	SparseMatrixCSR<int,double> matrix(8, 8, 0);
+
+	for(int row = comm.rank * 2; row < (comm.rank * 2) + 2; row++)
+	{
+		status = matrix.setElement(row, row, double(row + 1));
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	DistributedSparseMatrixCSR<int,double> distMatrix(comm, matrix, comm.rank * 2, (comm.rank * 2) + 2, patternConfig);
+	BOOST_CHECK_EQUAL(distMatrix.ghostGlobalIDs.size(), 0);
+	BOOST_CHECK_EQUAL(distMatrix.haloRows.size(), 0);
+
+	double x[2] = {1.0, 2.0};
+	double y[2];
+
+	status = distMatrix.multiply(x, 2, y, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_TEST(y[0] == double((comm.rank * 2) + 1));
+	BOOST_TEST(y[1] == 2.0 * double((comm.rank * 2) + 2));
+}
+
+// Test 4: Multiply with a serial matrix
+BOOST_AUTO_TEST_CASE(multiply_test4, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_SELF);
+	cupcfd::comm::ExchangePatternConfig patternConfig;
+
+	SparseMatrixCSR<int,double> matrix(8, 8, 0);
+	setTridiagonal(matrix, 0, 8);
+
+	DistributedSparseMatrixCSR<int,double> distMatrix(comm, matrix, 0, 8, patternConfig);
+	BOOST_CHECK(distMatrix.haloPattern == nullptr);
+	BOOST_CHECK_EQUAL(distMatrix.interiorRows.size(), 8);
+
+	double x[8] = {1.0, 4.0, 9.0, 16.0, 25.0, 36.0, 49.0, 64.0};
+	double y[8];
+	double yCmp[8] = {-2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, 79.0};
+
+	status = distMatrix.multiply(x, 8, y, 8);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < 8; i++)
+	{
+		BOOST_TEST(y[i] == yCmp[i]);
+	}
+}
+
+// Test 5: Check that vectors of the wrong size are rejected
+BOOST_AUTO_TEST_CASE(multiply_test5)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_SELF);
+	cupcfd::comm::ExchangePatternConfig patternConfig;
+
+	SparseMatrixCSR<int,double> matrix(8, 8, 0);
+	setTridiagonal(matrix, 0, 8);
+
+	DistributedSparseMatrixCSR<int,double> distMatrix(comm, matrix, 0, 8, patternConfig);
+
+	double x[8] = {};
+	double y[8];
+
+	status = distMatrix.multiply(x, 7, y, 8);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+}
+
+// === setValues ===
+// Test 1: Copy in new values for the same structure
+BOOST_AUTO_TEST_CASE(setValues_test1, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::comm::ExchangePatternConfig patternConfig;
+
+	SparseMatrixCSR<int,double> matrix(8, 8, 0);
+	setTridiagonal(matrix, comm.rank * 2, (comm.rank * 2) + 2);
+
+	DistributedSparseMatrixCSR<int,double> distMatrix(comm, matrix, comm.rank * 2, (comm.rank * 2) + 2, patternConfig);
+
+	// Scale the matrix by 3
+	for(std::size_t k = 0; k < matrix.A.size(); k++)
+	{
+		matrix.A[k] = matrix.A[k] * 3.0;
+	}
+
+	status = distMatrix.setValues(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double x[2] = {double(((comm.rank * 2) + 1) * ((comm.rank * 2) + 1)), double(((comm.rank * 2) + 2) * ((comm.rank * 2) + 2))};
+	double yCmp[8] = {-6.0, -6.0, -6.0, -6.0, -6.0, -6.0, -6.0, 237.0};
+	double y[2];
+
+	status = distMatrix.multiply(x, 2, y, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_TEST(y[0] == yCmp[comm.rank * 2]);
+	BOOST_TEST(y[1] == yCmp[(comm.rank * 2) + 1]);
+}
+
+// Test 2: Check that a matrix with a different structure is rejected
+BOOST_AUTO_TEST_CASE(setValues_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_SELF);
+	cupcfd::comm::ExchangePatternConfig patternConfig;
+
+	SparseMatrixCSR<int,double> matrix(8, 8, 0);
+	setTridiagonal(matrix, 0, 8);
+
+	DistributedSparseMatrixCSR<int,double> distMatrix(comm, matrix, 0, 8, patternConfig);
+
+	status = matrix.setElement(0, 7, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = distMatrix.setValues(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_MISMATCH_SIZE);
+}
+
+// === splitLocalMatrix ===
+// Test 1: Split the owned rows into the owned and ghost columns, and multiply with them in each
+// sparse matrix format, with uneven row ranges (including a process with no rows)
+BOOST_AUTO_TEST_CASE(splitLocalMatrix_test1, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::comm::ExchangePatternConfig patternConfig;
+
+	int starts[5] = {0, 3, 3, 4, 8};
+	int rowStart = starts[comm.rank];
+	int rowEnd = starts[comm.rank + 1];
+	int mLocal = rowEnd - rowStart;
+
+	SparseMatrixCSR<int,double> matrix(8, 8, 0);
+	double dense[8][8] = {};
+
+	for(int row = 0; row < 8; row++)
+	{
+		int cols[3] = {row, (row * 3) % 8, 7 - row};
+
+		for(int j = 0; j < 3; j++)
+		{
+			dense[row][cols[j]] = double(row + cols[j] + 1);
+			status = matrix.setElement(row, cols[j], dense[row][cols[j]]);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+	}
+
+	DistributedSparseMatrixCSR<int,double> distMatrix(comm, matrix, rowStart, rowEnd, patternConfig);
+
+	SparseMatrixCSR<int,double> ownedA;
+	SparseMatrixCSR<int,double> ghostA;
+
+	status = distMatrix.splitLocalMatrix(ownedA, ghostA);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int nGhost = int(distMatrix.ghostGlobalIDs.size());
+
+	BOOST_CHECK_EQUAL(ownedA.m, mLocal);
+	BOOST_CHECK_EQUAL(ownedA.n, mLocal);
+	BOOST_CHECK_EQUAL(ghostA.m, mLocal);
+	BOOST_CHECK_EQUAL(ghostA.n, (nGhost > 0) ? nGhost : 1);
+	BOOST_CHECK_EQUAL(ownedA.nnz + ghostA.nnz, distMatrix.localA.nnz);
+
+	double xGlobal[8] = {0.5, -1.0, 2.0, 3.5, -0.25, 1.0, 4.0, -2.0};
+	double yCmp[8];
+
+	for(int row = rowStart; row < rowEnd; row++)
+	{
+		yCmp[row - rowStart] = 0.0;
+
+		for(int col = 0; col < 8; col++)
+		{
+			yCmp[row - rowStart] = yCmp[row - rowStart] + dense[row][col] * xGlobal[col];
+		}
+	}
+
+	double y[8];
+
+	status = distMatrix.multiply(ownedA, ghostA, xGlobal + rowStart, mLocal, y, mLocal);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < mLocal; i++)
+	{
+		BOOST_TEST(y[i] == yCmp[i]);
+	}
+
+	SparseMatrixSELL<int,double> ownedSELL(ownedA, 2, 4);
+	SparseMatrixSELL<int,double> ghostSELL(ghostA, 2, 4);
+
+	status = distMatrix.multiply(ownedSELL, ghostSELL, xGlobal + rowStart, mLocal, y, mLocal);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < mLocal; i++)
+	{
+		BOOST_TEST(y[i] == yCmp[i]);
+	}
+
+	SparseMatrixBCSR<int,double> ownedBCSR(ownedA, 2);
+	SparseMatrixBCSR<int,double> ghostBCSR(ghostA, 2);
+
+	status = distMatrix.multiply(ownedBCSR, ghostBCSR, xGlobal + rowStart, mLocal, y, mLocal);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < mLocal; i++)
+	{
+		BOOST_TEST(y[i] == yCmp[i]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    MPI_Finalize();
+}
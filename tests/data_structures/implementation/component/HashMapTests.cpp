@@ -0,0 +1,181 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the HashMap class
+ */
+
+#define BOOST_TEST_MODULE HashMap
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+#include <map>
+
+#include "HashMap.h"
+
+using namespace cupcfd::data_structures;
+
+// === Constructors/Deconstructors ===
+// Test 1: Empty Constructor
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	HashMap<int, int> map;
+
+	BOOST_CHECK_EQUAL(map.size(), 0);
+	BOOST_CHECK(map.empty());
+	BOOST_CHECK(map.begin() == map.end());
+	BOOST_CHECK(map.find(10) == map.end());
+	BOOST_CHECK_EQUAL(map.count(10), 0);
+}
+
+// === operator[] ===
+// Test 1: Insert and retrieve values
+BOOST_AUTO_TEST_CASE(operator_brackets_test1)
+{
+	HashMap<int, int> map;
+
+	map[20] = 1;
+	map[40] = 2;
+	map[-60] = 3;
+
+	BOOST_CHECK_EQUAL(map.size(), 3);
+	BOOST_CHECK_EQUAL(map[20], 1);
+	BOOST_CHECK_EQUAL(map[40], 2);
+	BOOST_CHECK_EQUAL(map[-60], 3);
+
+	// Overwrite an existing key
+	map[40] = 5;
+	BOOST_CHECK_EQUAL(map.size(), 3);
+	BOOST_CHECK_EQUAL(map[40], 5);
+}
+
+// Test 2: Access of a missing key inserts a default value, as per std::map
+BOOST_AUTO_TEST_CASE(operator_brackets_test2)
+{
+	HashMap<int, long> map;
+
+	BOOST_CHECK_EQUAL(map[7], 0);
+	BOOST_CHECK_EQUAL(map.size(), 1);
+	BOOST_CHECK_EQUAL(map.count(7), 1);
+}
+
+// === find ===
+// Test 1: Find entries across several rehashes, matching a std::map with the same content
+BOOST_AUTO_TEST_CASE(find_test1)
+{
+	HashMap<int, int> map;
+	std::map<int, int> cmp;
+
+	// Strided keys, to check these do not all probe to the same slots
+	for(int i = 0; i < 10000; i++) {
+		map[i * 64] = i;
+		cmp[i * 64] = i;
+	}
+
+	BOOST_CHECK_EQUAL(map.size(), cmp.size());
+
+	for(int i = 0; i < 10000; i++) {
+		auto it = map.find(i * 64);
+		BOOST_REQUIRE(it != map.end());
+		BOOST_CHECK_EQUAL(it->first, i * 64);
+		BOOST_CHECK_EQUAL(it->second, i);
+	}
+
+	// Keys that are not present
+	BOOST_CHECK(map.find(1) == map.end());
+	BOOST_CHECK(map.find(-64) == map.end());
+	BOOST_CHECK(map.find(10000 * 64) == map.end());
+
+	// Iteration visits every entry exactly once
+	std::size_t nVisited = 0;
+	for(auto it = map.begin(); it != map.end(); it++) {
+		BOOST_CHECK_EQUAL(cmp[it->first], it->second);
+		nVisited++;
+	}
+	BOOST_CHECK_EQUAL(nVisited, cmp.size());
+}
+
+// Test 2: Find with floating point keys
+BOOST_AUTO_TEST_CASE(find_test2)
+{
+	HashMap<double, int> map;
+
+	map[0.5] = 1;
+	map[1.5] = 2;
+
+	BOOST_CHECK_EQUAL(map.find(0.5)->second, 1);
+	BOOST_CHECK_EQUAL(map.find(1.5)->second, 2);
+	BOOST_CHECK(map.find(2.5) == map.end());
+}
+
+// === at ===
+// Test 1: Retrieve present keys, and throw on missing keys without inserting
+BOOST_AUTO_TEST_CASE(at_test1)
+{
+	HashMap<int, int> map;
+	map[3] = 30;
+
+	BOOST_CHECK_EQUAL(map.at(3), 30);
+	BOOST_CHECK_THROW(map.at(4), std::out_of_range);
+	BOOST_CHECK_EQUAL(map.size(), 1);
+
+	const HashMap<int, int>& constMap = map;
+	BOOST_CHECK_EQUAL(constMap.at(3), 30);
+	BOOST_CHECK_THROW(constMap.at(4), std::out_of_range);
+}
+
+// === clear ===
+// Test 1: Clear removes all entries, and the map can be reused
+BOOST_AUTO_TEST_CASE(clear_test1)
+{
+	HashMap<int, int> map;
+
+	for(int i = 0; i < 100; i++) {
+		map[i] = i;
+	}
+
+	map.clear();
+	BOOST_CHECK_EQUAL(map.size(), 0);
+	BOOST_CHECK(map.begin() == map.end());
+	BOOST_CHECK(map.find(5) == map.end());
+
+	map[5] = 6;
+	BOOST_CHECK_EQUAL(map.size(), 1);
+	BOOST_CHECK_EQUAL(map[5], 6);
+}
+
+// === reserve ===
+// Test 1: Reserving does not change the content
+BOOST_AUTO_TEST_CASE(reserve_test1)
+{
+	HashMap<int, int> map;
+
+	map[1] = 2;
+	map.reserve(1000);
+
+	BOOST_CHECK_EQUAL(map.size(), 1);
+	BOOST_CHECK_EQUAL(map[1], 2);
+	BOOST_CHECK(map.slots.size() >= 2000);
+}
+
+// === Copy ===
+// Test 1: Copies are independent
+BOOST_AUTO_TEST_CASE(copy_test1)
+{
+	HashMap<int, int> map;
+	map[1] = 2;
+
+	HashMap<int, int> copy = map;
+	copy[1] = 3;
+	copy[2] = 4;
+
+	BOOST_CHECK_EQUAL(map[1], 2);
+	BOOST_CHECK_EQUAL(map.count(2), 0);
+	BOOST_CHECK_EQUAL(copy[1], 3);
+	BOOST_CHECK_EQUAL(copy[2], 4);
+}
@@ -0,0 +1,343 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the SparseMatrixBCSR class
+ */
+
+#define BOOST_TEST_MODULE SparseMatrixBCSR
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+
+#include "SparseMatrixBCSR.h"
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixCOO.h"
+#include "Error.h"
+
+using namespace cupcfd::data_structures;
+
+// Rows of length 1, 3, 0, 2, 4, 1 for a 6x6 matrix
+static int testRows[11] = {0, 1, 1, 1, 3, 3, 4, 4, 4, 4, 5};
+static int testCols[11] = {2, 0, 3, 5, 1, 4, 0, 2, 3, 5, 5};
+static int testVals[11] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+// =========================================================================
+// === Constructor Tests ===
+// =========================================================================
+// Test 1: Default Constructor
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	SparseMatrixBCSR<int, int> matrix;
+
+	BOOST_CHECK_EQUAL(matrix.m, 1);
+	BOOST_CHECK_EQUAL(matrix.n, 1);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 0);
+	BOOST_CHECK_EQUAL(matrix.nnz, 0);
+	BOOST_CHECK_EQUAL(matrix.blockSize, 1);
+	BOOST_CHECK_EQUAL(matrix.getNBlocks(), 0);
+}
+
+// Test 2: Size, base index and block size
+BOOST_AUTO_TEST_CASE(constructor_test2)
+{
+	SparseMatrixBCSR<int, int> matrix(7, 9, 5, 3);
+
+	BOOST_CHECK_EQUAL(matrix.m, 7);
+	BOOST_CHECK_EQUAL(matrix.n, 9);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 5);
+	BOOST_CHECK_EQUAL(matrix.nnz, 0);
+	BOOST_CHECK_EQUAL(matrix.blockSize, 3);
+	BOOST_CHECK_EQUAL(matrix.IA.size(), 4u);
+}
+
+// Test 3: Build from a CSR matrix
+BOOST_AUTO_TEST_CASE(constructor_test3)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixCSR<int, int> csr(6, 6, 0);
+
+	for(int i = 0; i < 11; i++)
+	{
+		status = csr.setElement(testRows[i], testCols[i], testVals[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	SparseMatrixBCSR<int, int> matrix(csr, 2);
+
+	// Every entry of the 8 stored 2x2 blocks is part of the structure
+	BOOST_CHECK_EQUAL(matrix.nnz, 32);
+	BOOST_CHECK_EQUAL(matrix.getNBlocks(), 8);
+
+	int IACmp[4] = {0, 3, 5, 8};
+	int JACmp[8] = {0, 1, 2, 0, 2, 0, 1, 2};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.IA.begin(), matrix.IA.end(), IACmp, IACmp + 4);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.JA.begin(), matrix.JA.end(), JACmp, JACmp + 8);
+
+	// First two blocks, row-major
+	int ACmp[8] = {0, 0, 2, 0, 1, 0, 0, 3};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.A.begin(), matrix.A.begin() + 8, ACmp, ACmp + 8);
+}
+
+// Test 4: Build from a COO matrix with a size that is not a multiple of the block size
+BOOST_AUTO_TEST_CASE(constructor_test4)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixCOO<int, int> coo(6, 6, 1);
+
+	for(int i = 0; i < 11; i++)
+	{
+		status = coo.setElement(testRows[i] + 1, testCols[i] + 1, testVals[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	SparseMatrixBCSR<int, int> matrix(coo, 4);
+
+	// Blocks (0,0), (0,1), (1,0) and (1,1) - the last block row/column only have 2 rows/columns
+	BOOST_CHECK_EQUAL(matrix.getNBlocks(), 4);
+	BOOST_CHECK_EQUAL(matrix.nnz, 36);
+
+	for(int i = 0; i < 11; i++)
+	{
+		int val;
+		status = matrix.getElement(testRows[i] + 1, testCols[i] + 1, &val);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(val, testVals[i]);
+	}
+}
+
+// Test 5: Error for an invalid block size
+BOOST_AUTO_TEST_CASE(constructor_test5)
+{
+	typedef SparseMatrixBCSR<int, int> BCSRMatrix;
+
+	BOOST_CHECK_THROW(BCSRMatrix matrix(4, 4, 0, 0), std::runtime_error);
+}
+
+// === setElement Tests ===
+// Test 1: Setting a value adds the whole block, clipped to the edge of the matrix
+BOOST_AUTO_TEST_CASE(setElement_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixBCSR<int, int> matrix(5, 5, 0, 2);
+
+	status = matrix.setElement(4, 4, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 1);
+
+	status = matrix.setElement(0, 3, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 5);
+
+	status = matrix.setElement(1, 0, 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 9);
+
+	// Overwriting a value in an existing block does not add to the structure
+	status = matrix.setElement(0, 2, 6);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 9);
+
+	int IACmp[4] = {0, 2, 2, 3};
+	int JACmp[3] = {0, 1, 2};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.IA.begin(), matrix.IA.end(), IACmp, IACmp + 4);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.JA.begin(), matrix.JA.end(), JACmp, JACmp + 3);
+
+	int ACmp[12] = {0, 0, 1, 0, 6, 2, 0, 0, 3, 0, 0, 0};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.A.begin(), matrix.A.end(), ACmp, ACmp + 12);
+}
+
+// Test 2: Out of bounds rows and columns
+BOOST_AUTO_TEST_CASE(setElement_test2)
+{
+	SparseMatrixBCSR<int, int> matrix(3, 3, 1, 2);
+
+	BOOST_CHECK_EQUAL(matrix.setElement(0, 1, 2), cupcfd::error::E_MATRIX_ROW_OOB);
+	BOOST_CHECK_EQUAL(matrix.setElement(4, 1, 2), cupcfd::error::E_MATRIX_ROW_OOB);
+	BOOST_CHECK_EQUAL(matrix.setElement(1, 0, 2), cupcfd::error::E_MATRIX_COL_OOB);
+	BOOST_CHECK_EQUAL(matrix.setElement(1, 4, 2), cupcfd::error::E_MATRIX_COL_OOB);
+}
+
+// === getElement Tests ===
+// Test 1: Zero values are returned for entries that are not stored
+BOOST_AUTO_TEST_CASE(getElement_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixBCSR<int, int> matrix(4, 4, 0, 2);
+
+	status = matrix.setElement(1, 2, 5);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int val;
+	status = matrix.getElement(0, 3, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 0);
+
+	status = matrix.getElement(3, 0, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 0);
+
+	status = matrix.getElement(1, 2, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 5);
+
+	BOOST_CHECK_EQUAL(matrix.getElement(4, 0, &val), cupcfd::error::E_MATRIX_ROW_OOB);
+	BOOST_CHECK_EQUAL(matrix.getElement(0, 4, &val), cupcfd::error::E_MATRIX_COL_OOB);
+}
+
+// === clear/resize Tests ===
+// Test 1: Clear removes all entries, resize sets the new size
+BOOST_AUTO_TEST_CASE(resize_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixBCSR<int, int> matrix(4, 4, 0, 2);
+
+	status = matrix.setElement(1, 2, 5);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = matrix.resize(7, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.m, 7);
+	BOOST_CHECK_EQUAL(matrix.n, 3);
+	BOOST_CHECK_EQUAL(matrix.nnz, 0);
+	BOOST_CHECK_EQUAL(matrix.IA.size(), 5u);
+	BOOST_CHECK_EQUAL(matrix.getNBlocks(), 0);
+
+	BOOST_CHECK_EQUAL(matrix.resize(0, 4), cupcfd::error::E_MATRIX_INVALID_ROW_SIZE);
+	BOOST_CHECK_EQUAL(matrix.resize(4, 0), cupcfd::error::E_MATRIX_INVALID_COL_SIZE);
+}
+
+// === Row Access Tests ===
+// Test 1: Non-zero rows, columns and values include every entry of the stored blocks
+BOOST_AUTO_TEST_CASE(getRowNNZValues_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixBCSR<int, int> matrix(5, 5, 1, 2);
+
+	status = matrix.setElement(1, 4, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(5, 5, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(2, 1, 4);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int * rowIndexes;
+	int nRowIndexes;
+	int rowsCmp[3] = {1, 2, 5};
+
+	status = matrix.getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(rowIndexes, rowIndexes + nRowIndexes, rowsCmp, rowsCmp + 3);
+	free(rowIndexes);
+
+	int * columnIndexes;
+	int nColumnIndexes;
+	int colsCmp[4] = {1, 2, 3, 4};
+
+	status = matrix.getRowColumnIndexes(2, &columnIndexes, &nColumnIndexes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(columnIndexes, columnIndexes + nColumnIndexes, colsCmp, colsCmp + 4);
+	free(columnIndexes);
+
+	int * nnzValues;
+	int nNNZValues;
+	int valsCmp[4] = {4, 0, 0, 0};
+
+	status = matrix.getRowNNZValues(2, &nnzValues, &nNNZValues);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(nnzValues, nnzValues + nNNZValues, valsCmp, valsCmp + 4);
+	free(nnzValues);
+
+	// The last block is clipped to a single column
+	int colsCmp2[1] = {5};
+	int valsCmp2[1] = {3};
+
+	status = matrix.getRowColumnIndexes(5, &columnIndexes, &nColumnIndexes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(columnIndexes, columnIndexes + nColumnIndexes, colsCmp2, colsCmp2 + 1);
+	free(columnIndexes);
+
+	status = matrix.getRowNNZValues(5, &nnzValues, &nNNZValues);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(nnzValues, nnzValues + nNNZValues, valsCmp2, valsCmp2 + 1);
+	free(nnzValues);
+
+	BOOST_CHECK_EQUAL(matrix.getRowColumnIndexes(6, &columnIndexes, &nColumnIndexes), cupcfd::error::E_MATRIX_ROW_OOB);
+	BOOST_CHECK_EQUAL(matrix.getRowNNZValues(0, &nnzValues, &nNNZValues), cupcfd::error::E_MATRIX_ROW_OOB);
+}
+
+// === multiply Tests ===
+// Test 1: The product matches the CSR product for the fixed and general block kernels
+BOOST_AUTO_TEST_CASE(multiply_test1)
+{
+	cupcfd::error::eCodes status;
+	int sizes[2] = {60, 61};
+
+	for(int s = 0; s < 2; s++)
+	{
+		int size = sizes[s];
+		SparseMatrixCSR<int, double> csr(size, size, 0);
+
+		for(int i = 0; i < size; i++)
+		{
+			for(int j = 0; j < size; j++)
+			{
+				if(((i * 7) + (j * 3)) % 11 == 0 || i == j)
+				{
+					status = csr.setElement(i, j, double(i + (2 * j) + 1));
+					BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+				}
+			}
+		}
+
+		std::vector<double> x(size);
+		std::vector<double> yCmp(size);
+
+		for(int i = 0; i < size; i++)
+		{
+			x[i] = 1.0 + (0.5 * (i % 7));
+		}
+
+		status = csr.multiply(x.data(), size, yCmp.data(), size);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		for(int b = 1; b <= 6; b++)
+		{
+			SparseMatrixBCSR<int, double> matrix(csr, b);
+			std::vector<double> y(size);
+
+			status = matrix.multiply(x.data(), size, y.data(), size);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+			for(int i = 0; i < size; i++)
+			{
+				BOOST_CHECK_CLOSE(y[i], yCmp[i], 1e-12);
+			}
+
+			status = matrix.multiplyAdd(x.data(), size, y.data(), size);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+			for(int i = 0; i < size; i++)
+			{
+				BOOST_CHECK_CLOSE(y[i], 2.0 * yCmp[i], 1e-12);
+			}
+		}
+	}
+}
+
+// Test 2: Check for error if the vector sizes do not match the matrix
+BOOST_AUTO_TEST_CASE(multiply_test2)
+{
+	SparseMatrixBCSR<int, double> matrix(4, 6, 0, 2);
+
+	double x[6];
+	double y[6];
+
+	BOOST_CHECK_EQUAL(matrix.multiply(x, 4, y, 4), cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+	BOOST_CHECK_EQUAL(matrix.multiplyAdd(x, 6, y, 6), cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+}
@@ -16,6 +16,7 @@
 #include <stdexcept>
 
 #include "SparseMatrixCOO.h"
+#include "SparseMatrixCSR.h"
 #include "Error.h"
 
 #include <iostream>
@@ -58,6 +59,45 @@ BOOST_AUTO_TEST_CASE(constructor_test3)
 	BOOST_CHECK_EQUAL(matrix.nnz, 0);
 }
 
+// Test 4: Convert from a CSR matrix
+BOOST_AUTO_TEST_CASE(constructor_test4)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, int> csr(3, 4, 1);
+
+	int elements[5] = {2, 3, 4, 5, 6};
+	int rows[5] = {3, 1, 3, 1, 2};
+	int columns[5] = {3, 4, 1, 1, 2};
+
+	status = csr.buildFromTriplets(rows, columns, elements, 5, false);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	SparseMatrixCOO<int, int> matrix(csr);
+
+	BOOST_CHECK_EQUAL(matrix.m, 3);
+	BOOST_CHECK_EQUAL(matrix.n, 4);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 1);
+	BOOST_CHECK_EQUAL(matrix.nnz, 5);
+
+	int rowsCmp[5] = {1, 1, 2, 3, 3};
+	int colsCmp[5] = {1, 4, 2, 1, 3};
+	int valCmp[5] = {5, 3, 6, 4, 2};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.row.begin(), matrix.row.end(), rowsCmp, rowsCmp + 5);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.col.begin(), matrix.col.end(), colsCmp, colsCmp + 5);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.val.begin(), matrix.val.end(), valCmp, valCmp + 5);
+
+	// The converted matrix can still be updated element by element
+	status = matrix.setElement(2, 3, 7);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int val;
+	status = matrix.getElement(2, 3, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 7);
+}
+
 // === SetElement Tests ===
 // Test 1: Add non-existing entry
 BOOST_AUTO_TEST_CASE(setElement_test1)
@@ -720,3 +760,74 @@ BOOST_AUTO_TEST_CASE(getRowNNZValues_test3)
 	status = matrix.getRowNNZValues(8, &nnzValues, &nNNZValues);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
 }
+
+// === multiply Tests ===
+// Test 1: Compute y = Ax with a non-zero base index
+BOOST_AUTO_TEST_CASE(multiply_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCOO<int, int> matrix(3, 4, 1);
+
+	int elements[5] = {2, 3, 4, 5, 6};
+	int rows[5] = {1, 1, 2, 3, 3};
+	int columns[5] = {1, 4, 2, 1, 3};
+
+	for(int i = 0; i < 5; i++)
+	{
+		status = matrix.setElement(rows[i], columns[i], elements[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	int x[4] = {1, 2, 3, 4};
+	int y[3] = {-1, -1, -1};
+	int yCmp[3] = {14, 8, 23};
+
+	status = matrix.multiply(x, 4, y, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(y, y + 3, yCmp, yCmp + 3);
+}
+
+// Test 2: Check for error if the vector sizes do not match the matrix
+BOOST_AUTO_TEST_CASE(multiply_test2)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCOO<int, int> matrix(3, 4, 0);
+
+	int x[4] = {1, 2, 3, 4};
+	int y[4];
+
+	status = matrix.multiply(x, 3, y, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+
+	status = matrix.multiply(x, 4, y, 4);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+}
+
+// === multiplyAdd Tests ===
+// Test 1: Compute y = y + Ax
+BOOST_AUTO_TEST_CASE(multiplyAdd_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCOO<int, int> matrix(3, 4, 0);
+
+	int elements[5] = {2, 3, 4, 5, 6};
+	int rows[5] = {0, 0, 1, 2, 2};
+	int columns[5] = {0, 3, 1, 0, 2};
+
+	for(int i = 0; i < 5; i++)
+	{
+		status = matrix.setElement(rows[i], columns[i], elements[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	int x[4] = {1, 2, 3, 4};
+	int y[3] = {1, 2, 3};
+	int yCmp[3] = {15, 10, 26};
+
+	status = matrix.multiplyAdd(x, 4, y, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(y, y + 3, yCmp, yCmp + 3);
+}
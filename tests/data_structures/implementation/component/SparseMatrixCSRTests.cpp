@@ -56,6 +56,123 @@ BOOST_AUTO_TEST_CASE(constructor_test3)
 	BOOST_CHECK_EQUAL(matrix.nnz, 0);
 }
 
+// Test 4: Convert from a COO matrix
+BOOST_AUTO_TEST_CASE(constructor_test4)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCOO<int, int> coo(3, 4, 1);
+
+	int elements[5] = {2, 3, 4, 5, 6};
+	int rows[5] = {3, 1, 3, 1, 2};
+	int columns[5] = {3, 4, 1, 1, 2};
+
+	for(int i = 0; i < 5; i++)
+	{
+		status = coo.setElement(rows[i], columns[i], elements[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	SparseMatrixCSR<int, int> matrix(coo);
+
+	BOOST_CHECK_EQUAL(matrix.m, 3);
+	BOOST_CHECK_EQUAL(matrix.n, 4);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 1);
+	BOOST_CHECK_EQUAL(matrix.nnz, 5);
+
+	int rowsCmp[4] = {0, 2, 3, 5};
+	int colsCmp[5] = {1, 4, 2, 1, 3};
+	int valCmp[5] = {5, 3, 6, 4, 2};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.IA.begin(), matrix.IA.end(), rowsCmp, rowsCmp + 4);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.JA.begin(), matrix.JA.end(), colsCmp, colsCmp + 5);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.A.begin(), matrix.A.end(), valCmp, valCmp + 5);
+}
+
+// === buildFromTriplets Tests ===
+// Test 1: Build from unsorted triplets, keeping the last value of a repeated position
+BOOST_AUTO_TEST_CASE(buildFromTriplets_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, int> matrix(3, 4, 0);
+
+	// An existing value should be replaced
+	status = matrix.setElement(1, 1, 9);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int elements[6] = {6, 2, 3, 4, 7, 5};
+	int rows[6] = {2, 0, 0, 2, 0, 2};
+	int columns[6] = {2, 3, 0, 0, 3, 1};
+
+	status = matrix.buildFromTriplets(rows, columns, elements, 6, false);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 5);
+
+	int rowsCmp[4] = {0, 2, 2, 5};
+	int colsCmp[5] = {0, 3, 0, 1, 2};
+	int valCmp[5] = {3, 7, 4, 5, 6};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.IA.begin(), matrix.IA.end(), rowsCmp, rowsCmp + 4);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.JA.begin(), matrix.JA.end(), colsCmp, colsCmp + 5);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.A.begin(), matrix.A.end(), valCmp, valCmp + 5);
+}
+
+// Test 2: Sum the values of repeated positions, with a non-zero base index
+BOOST_AUTO_TEST_CASE(buildFromTriplets_test2)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, double> matrix(2, 2, 1);
+
+	int rows[5] = {2, 1, 2, 1, 2};
+	int columns[5] = {1, 2, 1, 2, 2};
+	double elements[5] = {1.0, 2.0, 3.0, 4.0, 5.0};
+
+	status = matrix.buildFromTriplets(rows, columns, elements, 5, true);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.nnz, 3);
+
+	int rowsCmp[3] = {0, 1, 3};
+	int colsCmp[3] = {2, 1, 2};
+	double valCmp[3] = {6.0, 4.0, 5.0};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.IA.begin(), matrix.IA.end(), rowsCmp, rowsCmp + 3);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.JA.begin(), matrix.JA.end(), colsCmp, colsCmp + 3);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.A.begin(), matrix.A.end(), valCmp, valCmp + 3);
+}
+
+// Test 3: Check for errors on out of range indexes, leaving the matrix unchanged
+BOOST_AUTO_TEST_CASE(buildFromTriplets_test3)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, int> matrix(2, 3, 1);
+
+	status = matrix.setElement(1, 2, 8);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int elements[2] = {1, 2};
+	int badRows[2] = {1, 3};
+	int goodColumns[2] = {1, 3};
+
+	status = matrix.buildFromTriplets(badRows, goodColumns, elements, 2, false);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
+
+	int goodRows[2] = {1, 2};
+	int badColumns[2] = {0, 3};
+
+	status = matrix.buildFromTriplets(goodRows, badColumns, elements, 2, false);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_COL_OOB);
+
+	BOOST_CHECK_EQUAL(matrix.nnz, 1);
+
+	int val;
+	status = matrix.getElement(1, 2, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 8);
+}
+
 // === setElement Tests ===
 // Test 1: Add non-existing entry
 BOOST_AUTO_TEST_CASE(setElement_test1)
@@ -718,3 +835,74 @@ BOOST_AUTO_TEST_CASE(getRowNNZValues_test3)
 	status = matrix.getRowNNZValues(8, &nnzValues, &nNNZValues);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MATRIX_ROW_OOB);
 }
+
+// === multiply Tests ===
+// Test 1: Compute y = Ax with a non-zero base index
+BOOST_AUTO_TEST_CASE(multiply_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, int> matrix(3, 4, 1);
+
+	int elements[5] = {2, 3, 4, 5, 6};
+	int rows[5] = {1, 1, 2, 3, 3};
+	int columns[5] = {1, 4, 2, 1, 3};
+
+	for(int i = 0; i < 5; i++)
+	{
+		status = matrix.setElement(rows[i], columns[i], elements[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	int x[4] = {1, 2, 3, 4};
+	int y[3] = {-1, -1, -1};
+	int yCmp[3] = {14, 8, 23};
+
+	status = matrix.multiply(x, 4, y, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(y, y + 3, yCmp, yCmp + 3);
+}
+
+// Test 2: Check for error if the vector sizes do not match the matrix
+BOOST_AUTO_TEST_CASE(multiply_test2)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, int> matrix(3, 4, 0);
+
+	int x[4] = {1, 2, 3, 4};
+	int y[4];
+
+	status = matrix.multiply(x, 3, y, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+
+	status = matrix.multiply(x, 4, y, 4);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+}
+
+// === multiplyAdd Tests ===
+// Test 1: Compute y = y + Ax
+BOOST_AUTO_TEST_CASE(multiplyAdd_test1)
+{
+	cupcfd::error::eCodes status;
+
+	SparseMatrixCSR<int, int> matrix(3, 4, 0);
+
+	int elements[5] = {2, 3, 4, 5, 6};
+	int rows[5] = {0, 0, 1, 2, 2};
+	int columns[5] = {0, 3, 1, 0, 2};
+
+	for(int i = 0; i < 5; i++)
+	{
+		status = matrix.setElement(rows[i], columns[i], elements[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	int x[4] = {1, 2, 3, 4};
+	int y[3] = {1, 2, 3};
+	int yCmp[3] = {15, 10, 26};
+
+	status = matrix.multiplyAdd(x, 4, y, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(y, y + 3, yCmp, yCmp + 3);
+}
@@ -0,0 +1,342 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the SparseMatrixSELL class
+ */
+
+#define BOOST_TEST_MODULE SparseMatrixSELL
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+
+#include "SparseMatrixSELL.h"
+#include "SparseMatrixCSR.h"
+#include "SparseMatrixCOO.h"
+#include "Error.h"
+
+using namespace cupcfd::data_structures;
+
+// Rows of length 1, 3, 0, 2, 4, 1 for a 6x6 matrix
+static int testRows[11] = {0, 1, 1, 1, 3, 3, 4, 4, 4, 4, 5};
+static int testCols[11] = {2, 0, 3, 5, 1, 4, 0, 2, 3, 5, 5};
+static int testVals[11] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+// =========================================================================
+// === Constructor Tests ===
+// =========================================================================
+// Test 1: Default Constructor
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	SparseMatrixSELL<int, int> matrix;
+
+	BOOST_CHECK_EQUAL(matrix.m, 1);
+	BOOST_CHECK_EQUAL(matrix.n, 1);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 0);
+	BOOST_CHECK_EQUAL(matrix.nnz, 0);
+	BOOST_CHECK_EQUAL(matrix.chunkSize, 8);
+	BOOST_CHECK_EQUAL(matrix.sigma, 1);
+	BOOST_CHECK_EQUAL(matrix.getNStoredEntries(), 0);
+}
+
+// Test 2: Size, base index, chunk size and sigma
+BOOST_AUTO_TEST_CASE(constructor_test2)
+{
+	SparseMatrixSELL<int, int> matrix(6, 9, 5, 4, 2);
+
+	BOOST_CHECK_EQUAL(matrix.m, 6);
+	BOOST_CHECK_EQUAL(matrix.n, 9);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 5);
+	BOOST_CHECK_EQUAL(matrix.nnz, 0);
+	BOOST_CHECK_EQUAL(matrix.chunkSize, 4);
+	BOOST_CHECK_EQUAL(matrix.sigma, 2);
+	BOOST_CHECK_EQUAL(matrix.chunkPtr.size(), 3u);
+}
+
+// Test 3: Build from a CSR matrix with sigma of 1 (original row order)
+BOOST_AUTO_TEST_CASE(constructor_test3)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixCSR<int, int> csr(6, 6, 0);
+
+	for(int i = 0; i < 11; i++)
+	{
+		status = csr.setElement(testRows[i], testCols[i], testVals[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	SparseMatrixSELL<int, int> matrix(csr, 2, 1);
+
+	BOOST_CHECK_EQUAL(matrix.nnz, 11);
+
+	// Chunk widths are 3, 2 and 4
+	int chunkPtrCmp[4] = {0, 6, 10, 18};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.chunkPtr.begin(), matrix.chunkPtr.end(), chunkPtrCmp, chunkPtrCmp + 4);
+
+	int rowOrderCmp[6] = {0, 1, 2, 3, 4, 5};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.rowOrder.begin(), matrix.rowOrder.end(), rowOrderCmp, rowOrderCmp + 6);
+
+	// First chunk, column-major: row 0 = {2}, row 1 = {0, 3, 5}
+	int JACmp[6] = {2, 0, 0, 3, 0, 5};
+	int ACmp[6] = {1, 2, 0, 3, 0, 4};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.JA.begin(), matrix.JA.begin() + 6, JACmp, JACmp + 6);
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.A.begin(), matrix.A.begin() + 6, ACmp, ACmp + 6);
+}
+
+// Test 4: Build from a COO matrix with sorting windows of the whole matrix
+BOOST_AUTO_TEST_CASE(constructor_test4)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixCOO<int, int> coo(6, 6, 1);
+
+	for(int i = 0; i < 11; i++)
+	{
+		status = coo.setElement(testRows[i] + 1, testCols[i] + 1, testVals[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	SparseMatrixSELL<int, int> matrix(coo, 2, 6);
+
+	BOOST_CHECK_EQUAL(matrix.nnz, 11);
+	BOOST_CHECK_EQUAL(matrix.baseIndex, 1);
+
+	// Rows sorted by descending length, ties kept in order
+	int rowOrderCmp[6] = {4, 1, 3, 0, 5, 2};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.rowOrder.begin(), matrix.rowOrder.end(), rowOrderCmp, rowOrderCmp + 6);
+
+	// Chunk widths are 4, 2 and 1, so sorting removes padding
+	int chunkPtrCmp[4] = {0, 8, 12, 14};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.chunkPtr.begin(), matrix.chunkPtr.end(), chunkPtrCmp, chunkPtrCmp + 4);
+
+	for(int i = 0; i < 11; i++)
+	{
+		int val;
+		status = matrix.getElement(testRows[i] + 1, testCols[i] + 1, &val);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(val, testVals[i]);
+	}
+}
+
+// Test 5: Error for an invalid chunk size
+BOOST_AUTO_TEST_CASE(constructor_test5)
+{
+	typedef SparseMatrixSELL<int, int> SELLMatrix;
+
+	BOOST_CHECK_THROW(SELLMatrix matrix(4, 4, 0, 0, 1), std::runtime_error);
+	BOOST_CHECK_THROW(SELLMatrix matrix(4, 4, 0, 2, 0), std::runtime_error);
+}
+
+// === setElement Tests ===
+// Test 1: Add entries in any order, widening chunks as needed
+BOOST_AUTO_TEST_CASE(setElement_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixSELL<int, int> matrix(6, 6, 0, 2, 1);
+
+	for(int i = 10; i >= 0; i--)
+	{
+		status = matrix.setElement(testRows[i], testCols[i], testVals[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	BOOST_CHECK_EQUAL(matrix.nnz, 11);
+
+	int chunkPtrCmp[4] = {0, 6, 10, 18};
+	BOOST_CHECK_EQUAL_COLLECTIONS(matrix.chunkPtr.begin(), matrix.chunkPtr.end(), chunkPtrCmp, chunkPtrCmp + 4);
+
+	int * columnIndexes;
+	int nColumnIndexes;
+	int colsCmp[4] = {0, 2, 3, 5};
+
+	status = matrix.getRowColumnIndexes(4, &columnIndexes, &nColumnIndexes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(columnIndexes, columnIndexes + nColumnIndexes, colsCmp, colsCmp + 4);
+	free(columnIndexes);
+}
+
+// Test 2: Overwrite an existing entry
+BOOST_AUTO_TEST_CASE(setElement_test2)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixSELL<int, int> matrix(2, 2, 0, 2, 1);
+
+	status = matrix.setElement(1, 1, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = matrix.setElement(1, 1, 7);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int val;
+	status = matrix.getElement(1, 1, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 7);
+	BOOST_CHECK_EQUAL(matrix.nnz, 1);
+}
+
+// Test 3: Out of bounds rows and columns
+BOOST_AUTO_TEST_CASE(setElement_test3)
+{
+	SparseMatrixSELL<int, int> matrix(2, 2, 1);
+
+	BOOST_CHECK_EQUAL(matrix.setElement(0, 1, 2), cupcfd::error::E_MATRIX_ROW_OOB);
+	BOOST_CHECK_EQUAL(matrix.setElement(3, 1, 2), cupcfd::error::E_MATRIX_ROW_OOB);
+	BOOST_CHECK_EQUAL(matrix.setElement(1, 0, 2), cupcfd::error::E_MATRIX_COL_OOB);
+	BOOST_CHECK_EQUAL(matrix.setElement(1, 3, 2), cupcfd::error::E_MATRIX_COL_OOB);
+}
+
+// === getElement Tests ===
+// Test 1: Zero values are returned for entries that are not stored
+BOOST_AUTO_TEST_CASE(getElement_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixSELL<int, int> matrix(3, 3, 0);
+
+	status = matrix.setElement(1, 2, 5);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int val;
+	status = matrix.getElement(1, 0, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 0);
+
+	status = matrix.getElement(1, 2, &val);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(val, 5);
+
+	BOOST_CHECK_EQUAL(matrix.getElement(3, 0, &val), cupcfd::error::E_MATRIX_ROW_OOB);
+	BOOST_CHECK_EQUAL(matrix.getElement(0, 3, &val), cupcfd::error::E_MATRIX_COL_OOB);
+}
+
+// === clear/resize Tests ===
+// Test 1: Clear removes all entries, resize sets the new size
+BOOST_AUTO_TEST_CASE(resize_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixSELL<int, int> matrix(3, 3, 0, 2, 1);
+
+	status = matrix.setElement(1, 2, 5);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = matrix.resize(5, 4);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(matrix.m, 5);
+	BOOST_CHECK_EQUAL(matrix.n, 4);
+	BOOST_CHECK_EQUAL(matrix.nnz, 0);
+	BOOST_CHECK_EQUAL(matrix.chunkPtr.size(), 4u);
+	BOOST_CHECK_EQUAL(matrix.getNStoredEntries(), 0);
+
+	BOOST_CHECK_EQUAL(matrix.resize(0, 4), cupcfd::error::E_MATRIX_INVALID_ROW_SIZE);
+	BOOST_CHECK_EQUAL(matrix.resize(4, 0), cupcfd::error::E_MATRIX_INVALID_COL_SIZE);
+}
+
+// === Row Access Tests ===
+// Test 1: Non-zero rows, columns and values with a non-zero base index
+BOOST_AUTO_TEST_CASE(getRowNNZValues_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixCSR<int, int> csr(6, 6, 2);
+
+	for(int i = 0; i < 11; i++)
+	{
+		status = csr.setElement(testRows[i] + 2, testCols[i] + 2, testVals[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	SparseMatrixSELL<int, int> matrix(csr, 4, 4);
+
+	int * rowIndexes;
+	int nRowIndexes;
+	int rowsCmp[5] = {2, 3, 5, 6, 7};
+
+	status = matrix.getNonZeroRowIndexes(&rowIndexes, &nRowIndexes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(rowIndexes, rowIndexes + nRowIndexes, rowsCmp, rowsCmp + 5);
+	free(rowIndexes);
+
+	int * columnIndexes;
+	int nColumnIndexes;
+	int colsCmp[3] = {2, 5, 7};
+
+	status = matrix.getRowColumnIndexes(3, &columnIndexes, &nColumnIndexes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(columnIndexes, columnIndexes + nColumnIndexes, colsCmp, colsCmp + 3);
+	free(columnIndexes);
+
+	int * nnzValues;
+	int nNNZValues;
+	int valsCmp[3] = {2, 3, 4};
+
+	status = matrix.getRowNNZValues(3, &nnzValues, &nNNZValues);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(nnzValues, nnzValues + nNNZValues, valsCmp, valsCmp + 3);
+	free(nnzValues);
+
+	status = matrix.getRowNNZValues(4, &nnzValues, &nNNZValues);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nNNZValues, 0);
+	free(nnzValues);
+
+	BOOST_CHECK_EQUAL(matrix.getRowColumnIndexes(8, &columnIndexes, &nColumnIndexes), cupcfd::error::E_MATRIX_ROW_OOB);
+	BOOST_CHECK_EQUAL(matrix.getRowNNZValues(1, &nnzValues, &nNNZValues), cupcfd::error::E_MATRIX_ROW_OOB);
+}
+
+// === multiply Tests ===
+// Test 1: The product matches the CSR product, for several chunk sizes and sigmas
+BOOST_AUTO_TEST_CASE(multiply_test1)
+{
+	cupcfd::error::eCodes status;
+	SparseMatrixCSR<int, double> csr(6, 6, 0);
+
+	for(int i = 0; i < 11; i++)
+	{
+		status = csr.setElement(testRows[i], testCols[i], testVals[i]);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	double x[6] = {1.0, -2.0, 3.0, 0.5, 4.0, -1.0};
+	double yCmp[6];
+
+	status = csr.multiply(x, 6, yCmp, 6);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int chunkSizes[4] = {1, 2, 4, 8};
+	int sigmas[4] = {1, 2, 6, 3};
+
+	for(int c = 0; c < 4; c++)
+	{
+		SparseMatrixSELL<int, double> matrix(csr, chunkSizes[c], sigmas[c]);
+		double y[6];
+
+		status = matrix.multiply(x, 6, y, 6);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		for(int i = 0; i < 6; i++)
+		{
+			BOOST_CHECK_CLOSE(y[i], yCmp[i], 1e-12);
+		}
+
+		status = matrix.multiplyAdd(x, 6, y, 6);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		for(int i = 0; i < 6; i++)
+		{
+			BOOST_CHECK_CLOSE(y[i], 2.0 * yCmp[i], 1e-12);
+		}
+	}
+}
+
+// Test 2: Check for error if the vector sizes do not match the matrix
+BOOST_AUTO_TEST_CASE(multiply_test2)
+{
+	SparseMatrixSELL<int, double> matrix(3, 4, 0);
+
+	double x[4];
+	double y[4];
+
+	BOOST_CHECK_EQUAL(matrix.multiply(x, 3, y, 3), cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+	BOOST_CHECK_EQUAL(matrix.multiplyAdd(x, 4, y, 4), cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+}
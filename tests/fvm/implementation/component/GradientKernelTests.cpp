@@ -22,6 +22,8 @@
 #include "MeshSourceStructGenConfig.h"
 #include "CupCfdAoSMesh.h"
 #include "EuclideanVector.h"
+#include "ExchangePatternConfig.h"
+#include "ExchangeOverlap.h"
 
 #include "PartitionerNaiveConfig.h"
 #include "PartitionerConfig.h"
@@ -87,6 +89,157 @@ BOOST_AUTO_TEST_CASE(GradientPhiGaussDolfyn_test1)
 	delete(mesh);
 }
 
+// === GradientPhiGaussDolfynColoured ===
+// Test 1: Test the thread-parallel version matches the serial version on populated data
+BOOST_AUTO_TEST_CASE(GradientPhiGaussDolfynColoured_test1, * utf::tolerance(1e-10))
+{
+	cupcfd::error::eCodes status;
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// Create a small test mesh
+    cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+    meshgeo::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+    meshgeo::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+    meshgeo::CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_REQUIRE_EQUAL(mesh->faceColouring.built, true);
+
+	int nCells = mesh->properties.lTCells;
+	int nBnds = mesh->properties.lBoundaries;
+
+	double * phiCell = (double *) malloc(sizeof(double) * nCells);
+	double * phiBoundary = (double *) malloc(sizeof(double) * nBnds);
+	euc::EuclideanVector<double,3> * dPhidxCell = (euc::EuclideanVector<double,3> *) malloc(sizeof(euc::EuclideanVector<double,3>) * nCells);
+	euc::EuclideanVector<double,3> * dPhidxoCell  = (euc::EuclideanVector<double,3> *) malloc(sizeof(euc::EuclideanVector<double,3>) * nCells);
+	euc::EuclideanVector<double,3> * dPhidxCellColoured = (euc::EuclideanVector<double,3> *) malloc(sizeof(euc::EuclideanVector<double,3>) * nCells);
+	euc::EuclideanVector<double,3> * dPhidxoCellColoured  = (euc::EuclideanVector<double,3> *) malloc(sizeof(euc::EuclideanVector<double,3>) * nCells);
+
+	for(int i = 0; i < nCells; i++) {
+		phiCell[i] = 1.0 + (0.1 * (i % 7));
+	}
+
+	for(int i = 0; i < nBnds; i++) {
+		phiBoundary[i] = 2.0 - (0.1 * (i % 5));
+	}
+
+	status = GradientPhiGaussDolfyn(*mesh, 2, phiCell, nCells,
+			phiBoundary, nBnds,
+			dPhidxCell, nCells,
+			dPhidxoCell, nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = GradientPhiGaussDolfynColoured(*mesh, 2, phiCell, nCells,
+			phiBoundary, nBnds,
+			dPhidxCellColoured, nCells,
+			dPhidxoCellColoured, nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// The order of accumulation into a cell may differ, so compare within a tolerance
+	for(int i = 0; i < mesh->properties.lOCells; i++) {
+		for(int j = 0; j < 3; j++) {
+			BOOST_TEST(dPhidxCellColoured[i].cmp[j] == dPhidxCell[i].cmp[j]);
+			BOOST_TEST(dPhidxoCellColoured[i].cmp[j] == dPhidxoCell[i].cmp[j]);
+		}
+	}
+
+	free(phiCell);
+	free(phiBoundary);
+	free(dPhidxCell);
+	free(dPhidxoCell);
+	free(dPhidxCellColoured);
+	free(dPhidxoCellColoured);
+	delete(mesh);
+}
+
+// === GradientPhiGaussDolfynOverlap ===
+// Test 1: Test the overlapped version updates the ghost cells, and matches the serial version run on
+// data where the ghost cells are already up to date
+BOOST_AUTO_TEST_CASE(GradientPhiGaussDolfynOverlap_test1, * utf::tolerance(1e-10))
+{
+	cupcfd::error::eCodes status;
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// Create a small test mesh
+    cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+    meshgeo::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+    meshgeo::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+    meshgeo::CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_REQUIRE_EQUAL(mesh->haloFaces.built, true);
+
+	int nCells = mesh->properties.lTCells;
+	int nOwnedCells = mesh->properties.lOCells;
+	int nBnds = mesh->properties.lBoundaries;
+
+	double * phiCell = (double *) malloc(sizeof(double) * nCells);
+	double * phiCellRef = (double *) malloc(sizeof(double) * nCells);
+	double * phiBoundary = (double *) malloc(sizeof(double) * nBnds);
+	euc::EuclideanVector<double,3> * dPhidxCell = (euc::EuclideanVector<double,3> *) malloc(sizeof(euc::EuclideanVector<double,3>) * nCells);
+	euc::EuclideanVector<double,3> * dPhidxoCell  = (euc::EuclideanVector<double,3> *) malloc(sizeof(euc::EuclideanVector<double,3>) * nCells);
+	euc::EuclideanVector<double,3> * dPhidxCellRef = (euc::EuclideanVector<double,3> *) malloc(sizeof(euc::EuclideanVector<double,3>) * nCells);
+	euc::EuclideanVector<double,3> * dPhidxoCellRef  = (euc::EuclideanVector<double,3> *) malloc(sizeof(euc::EuclideanVector<double,3>) * nCells);
+
+	// Phi is a function of the cell label, so the expected ghost cell values are known
+	for(int i = 0; i < nCells; i++) {
+		int label = mesh->cellConnGraph->connGraph.IDXToNode[i];
+		phiCellRef[i] = 1.0 + (0.1 * (label % 7));
+		phiCell[i] = (i < nOwnedCells) ? phiCellRef[i] : -100.0;
+	}
+
+	for(int i = 0; i < nBnds; i++) {
+		phiBoundary[i] = 2.0 - (0.1 * (i % 5));
+	}
+
+	cupcfd::comm::ExchangePatternConfig exchangePatternConfig(cupcfd::comm::EXCHANGE_NONBLOCKING_TWO_SIDED);
+	cupcfd::comm::ExchangePattern<double> * exchangePattern;
+	status = exchangePatternConfig.buildExchangePattern(&exchangePattern, *(mesh->cellConnGraph));
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	cupcfd::comm::ExchangeOverlapTiming timing;
+
+	status = GradientPhiGaussDolfynOverlap(*mesh, *exchangePattern, 2, phiCell, nCells,
+			phiBoundary, nBnds,
+			dPhidxCell, nCells,
+			dPhidxoCell, nCells,
+			&timing);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Only the first gradient iteration exchanges data
+	BOOST_CHECK_EQUAL(timing.nExchanges, 1);
+
+	for(int i = 0; i < nCells; i++) {
+		BOOST_CHECK_EQUAL(phiCell[i], phiCellRef[i]);
+	}
+
+	status = GradientPhiGaussDolfyn(*mesh, 2, phiCellRef, nCells,
+			phiBoundary, nBnds,
+			dPhidxCellRef, nCells,
+			dPhidxoCellRef, nCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// The order of accumulation into a cell may differ, so compare within a tolerance
+	for(int i = 0; i < nOwnedCells; i++) {
+		for(int j = 0; j < 3; j++) {
+			BOOST_TEST(dPhidxCell[i].cmp[j] == dPhidxCellRef[i].cmp[j]);
+			BOOST_TEST(dPhidxoCell[i].cmp[j] == dPhidxoCellRef[i].cmp[j]);
+		}
+	}
+
+	delete exchangePattern;
+	free(phiCell);
+	free(phiCellRef);
+	free(phiBoundary);
+	free(dPhidxCell);
+	free(dPhidxoCell);
+	free(dPhidxCellRef);
+	free(dPhidxoCellRef);
+	delete(mesh);
+}
+
 BOOST_AUTO_TEST_CASE(cleanup)
 {
     MPI_Finalize();
@@ -16,6 +16,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "ScalarKernels.h"
 #include "MeshConfig.h"
@@ -151,6 +152,107 @@ BOOST_AUTO_TEST_CASE(FluxScalarDolfynFaceLoop_test1)
 	delete(mesh);
 }
 
+// === FluxScalarDolfynFaceLoopColoured ===
+// Test 1: Test the thread-parallel version matches the serial version on populated data
+BOOST_AUTO_TEST_CASE(FluxScalarDolfynFaceLoopColoured_test1, * utf::tolerance(1e-10))
+{
+	cupcfd::error::eCodes status;
+    cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// Create a small test mesh
+    cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+    meshgeo::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+    meshgeo::MeshConfig<int, double, int> meshConfig(partConfig, meshSourceConfig);
+
+    meshgeo::CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_REQUIRE_EQUAL(mesh->faceColouring.built, true);
+
+	int nCells = mesh->properties.lTCells;
+	int nBnds = mesh->properties.lBoundaries;
+	int nFaces = mesh->properties.lFaces;
+
+	std::vector<double> PhiCell(nCells), VisEff(nCells), Den(nCells), TE(nCells);
+	std::vector<double> PhiBoundary(nBnds), CpBoundary(nBnds), visEffBoundary(nBnds);
+	std::vector<double> MassFlux(nFaces);
+	std::vector<euc::EuclideanVector<double,3>> dPhidx(nCells);
+
+	for(int i = 0; i < nCells; i++) {
+		PhiCell[i] = 1.0 + (0.1 * (i % 7));
+		VisEff[i] = 1.0E-3 * (1 + (i % 3));
+		Den[i] = 1.2;
+		TE[i] = 0.5;
+		dPhidx[i] = euc::EuclideanVector<double,3>(0.1 * (i % 2), 0.2, -0.1 * (i % 5));
+	}
+
+	for(int i = 0; i < nBnds; i++) {
+		PhiBoundary[i] = 2.0 - (0.1 * (i % 5));
+		CpBoundary[i] = 1000.0;
+		visEffBoundary[i] = 1.0E-3;
+	}
+
+	for(int i = 0; i < nFaces; i++) {
+		MassFlux[i] = 0.01 * ((i % 11) - 5);
+	}
+
+	// Outputs - one set for each version
+	std::vector<double> Au(nCells, 0.0), Su(nCells, 0.0), RFace(nFaces * 2, 0.0);
+	std::vector<double> AuColoured(nCells, 0.0), SuColoured(nCells, 0.0), RFaceColoured(nFaces * 2, 0.0);
+
+	status = cupcfd::fvm::FluxScalarDolfynFaceLoop(*mesh,
+										PhiCell.data(), nCells,
+										PhiBoundary.data(), nBnds,
+										VisEff.data(), nCells,
+										Au.data(), nCells,
+										Su.data(), nCells,
+										Den.data(), nCells,
+										MassFlux.data(), nFaces,
+										TE.data(), nCells,
+										CpBoundary.data(), nBnds,
+										visEffBoundary.data(), nBnds,
+										RFace.data(), nFaces * 2,
+										dPhidx.data(), nCells,
+										true, false,
+										1.3,
+										1, 2, 1.4, 1.2E-3,
+										3, 1.5, 4, 1.6,
+										1.7, 1.4E-3, 1.1, 1E-18, 1E+18, 1.8);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = cupcfd::fvm::FluxScalarDolfynFaceLoopColoured(*mesh,
+										PhiCell.data(), nCells,
+										PhiBoundary.data(), nBnds,
+										VisEff.data(), nCells,
+										AuColoured.data(), nCells,
+										SuColoured.data(), nCells,
+										Den.data(), nCells,
+										MassFlux.data(), nFaces,
+										TE.data(), nCells,
+										CpBoundary.data(), nBnds,
+										visEffBoundary.data(), nBnds,
+										RFaceColoured.data(), nFaces * 2,
+										dPhidx.data(), nCells,
+										true, false,
+										1.3,
+										1, 2, 1.4, 1.2E-3,
+										3, 1.5, 4, 1.6,
+										1.7, 1.4E-3, 1.1, 1E-18, 1E+18, 1.8);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// The order of accumulation into a cell may differ, so compare within a tolerance
+	for(int i = 0; i < nCells; i++) {
+		BOOST_TEST(AuColoured[i] == Au[i]);
+		BOOST_TEST(SuColoured[i] == Su[i]);
+	}
+
+	for(int i = 0; i < nFaces * 2; i++) {
+		BOOST_TEST(RFaceColoured[i] == RFace[i]);
+	}
+
+	delete(mesh);
+}
+
 BOOST_AUTO_TEST_CASE(cleanup)
 {
     MPI_Finalize();
@@ -13,6 +13,8 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/output_test_stream.hpp>
 #include <stdexcept>
+#include <cstring>
+#include <type_traits>
 
 #include "EuclideanVector.h"
 #include "EuclideanVector3D.h"
@@ -1267,6 +1269,50 @@ BOOST_AUTO_TEST_CASE(getMPIType_test3, * utf::tolerance(0.00001))
 
 }
 
+// Test 4: Test the type is found through the comm utility lookup used by the communication methods
+BOOST_AUTO_TEST_CASE(getMPIType_test4, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	EuclideanVector<double,3> vec;
+	MPI_Datatype dType;
+	MPI_Datatype lookupType;
+
+	status = cupcfd::comm::mpi::getMPIType(vec, &lookupType);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MPI_DATATYPE_UNREGISTERED);
+
+	status = EuclideanVector<double,3>::registerMPIType();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = EuclideanVector<double,3>::getMPIType(&dType);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = cupcfd::comm::mpi::getMPIType(vec, &lookupType);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK(dType == lookupType);
+
+	// Cleanup for future tests since we use a static variable!
+	status = EuclideanVector<double,3>::deregisterMPIType();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+}
+
+// === Layout ===
+// Test 1: Check the class holds only its components, so arrays of it can be copied as raw memory
+BOOST_AUTO_TEST_CASE(layout_test1)
+{
+	BOOST_CHECK_EQUAL(sizeof(EuclideanVector<double,3>), 3 * sizeof(double));
+	BOOST_CHECK_EQUAL(sizeof(EuclideanVector<float,2>), 2 * sizeof(float));
+	BOOST_CHECK((std::is_trivially_copyable<EuclideanVector<double,3>>::value));
+	BOOST_CHECK((std::is_trivially_copyable<EuclideanVector<float,3>>::value));
+
+	EuclideanVector<double,3> src[2] = {EuclideanVector<double,3>(1.0, 2.0, 3.0), EuclideanVector<double,3>(4.0, 5.0, 6.0)};
+	EuclideanVector<double,3> dst[2];
+	std::memcpy(dst, src, sizeof(src));
+
+	BOOST_CHECK_EQUAL(dst[0].cmp[0], 1.0);
+	BOOST_CHECK_EQUAL(dst[0].cmp[2], 3.0);
+	BOOST_CHECK_EQUAL(dst[1].cmp[1], 5.0);
+}
+
 // === MPI: Vector Broadcast ===
 // Test 1: Testing the the MPI Type was setup correctly, and able to broadcast two vectors
 // This should establish that the custom MPI type has the right sizes
@@ -362,6 +362,79 @@ BOOST_AUTO_TEST_CASE(getCellVolume_test1)
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 }
 
+// Test 2: Read through a file opened across the communicator, with labels out of order
+BOOST_AUTO_TEST_CASE(getCellVolume_test2)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
+	MeshHDF5Source<int, double> file(filePath, comm);
+	cupcfd::error::eCodes status;
+
+	int nLabels[3] = {4,1,3};
+
+	double vol[3];
+	double volCmp[3] = {4.0, 1.0, 3.0};
+
+	status = file.getCellVolume(vol, 3, nLabels, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(vol, vol + 3, volCmp, volCmp + 3);
+}
+
+// Test 3: Every rank takes part in the read, even if it has no labels to read
+BOOST_AUTO_TEST_CASE(getCellVolume_test3)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
+	MeshHDF5Source<int, double> file(filePath, comm);
+	cupcfd::error::eCodes status;
+
+	int nLabels[2] = {1, 2};
+	double vol[2] = {-1.0, -1.0};
+	int nRead = (comm.rank == 0) ? 2 : 0;
+
+	status = file.getCellVolume(vol, nRead, nLabels, nRead);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	if(comm.rank == 0) {
+		BOOST_CHECK_EQUAL(vol[0], 1.0);
+		BOOST_CHECK_EQUAL(vol[1], 2.0);
+	}
+	else {
+		BOOST_CHECK_EQUAL(vol[0], -1.0);
+		BOOST_CHECK_EQUAL(vol[1], -1.0);
+	}
+}
+
+// === getReadStatistics ===
+// Test 1: Only the mesh data read since construction is recorded
+BOOST_AUTO_TEST_CASE(getReadStatistics_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	std::string filePath = "../tests/geometry/mesh/data/MeshHDF5.hdf5";
+	MeshHDF5Source<int, double> file(filePath, comm);
+	cupcfd::error::eCodes status;
+
+	unsigned long long bytesRead;
+	double readTime;
+
+	status = file.getReadStatistics(&bytesRead, &readTime);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(bytesRead, 0);
+
+	int nLabels[3] = {1,2,3};
+	double vol[3];
+	status = file.getCellVolume(vol, 3, nLabels, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = file.getReadStatistics(&bytesRead, &readTime);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(bytesRead, 3 * sizeof(double));
+	BOOST_CHECK(readTime >= 0.0);
+}
+
 // === getCellCenter ===
 BOOST_AUTO_TEST_CASE(getCellCenter_test1)
 {
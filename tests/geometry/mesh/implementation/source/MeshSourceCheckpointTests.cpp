@@ -0,0 +1,347 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the MeshSourceCheckpoint Class
+ */
+
+#define BOOST_TEST_MODULE MeshSourceCheckpoint
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "MeshSourceCheckpoint.h"
+#include "PartitionerNaiveConfig.h"
+#include "MeshSourceStructGenConfig.h"
+#include "MeshConfig.h"
+#include "CupCfdAoSMesh.h"
+#include "CupCfdSoAMesh.h"
+#include "EuclideanPoint.h"
+#include "HDF5Writer.h"
+#include "Reduce.h"
+
+using namespace cupcfd::geometry::mesh;
+
+namespace euc = cupcfd::geometry::euclidean;
+
+// Setup
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+
+    MPI_Init(&argc, &argv);
+}
+
+// === getCheckpointRankCount ===
+// Test 1: Error case - the file does not exist
+BOOST_AUTO_TEST_CASE(getCheckpointRankCount_test1)
+{
+	int nRanks;
+	cupcfd::error::eCodes status;
+
+	status = MeshSourceCheckpoint<int,double>::getCheckpointRankCount("MeshSourceCheckpointMissing.h5", &nRanks);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_FILE_MISSING);
+}
+
+// Test 2: Error case - the checkpoint was not completely written, so has no rank count
+BOOST_AUTO_TEST_CASE(getCheckpointRankCount_test2)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+	std::string filePath = "MeshSourceCheckpointIncomplete.h5";
+
+	{
+		cupcfd::io::hdf5::HDF5Writer writer(filePath, comm.comm);
+		BOOST_CHECK_EQUAL(writer.status, cupcfd::error::E_SUCCESS);
+
+		status = writer.writeAttribute("ncells", 125);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = writer.writeAttribute("nfaces", 450);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	int nRanks;
+	status = MeshSourceCheckpoint<int,double>::getCheckpointRankCount(filePath, &nRanks);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_FILE_FORMAT);
+
+	int nCells;
+	int nFaces;
+	status = MeshSourceCheckpoint<int,double>::getCheckpointMeshSize(filePath, &nCells, &nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_FILE_FORMAT);
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	if(comm.rank == 0) {
+		std::remove(filePath.c_str());
+	}
+}
+
+// Test 3: Error case - the file exists but is not a HDF5 file
+BOOST_AUTO_TEST_CASE(getCheckpointRankCount_test3)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+	std::string filePath = "MeshSourceCheckpointTruncated.h5";
+
+	if(comm.rank == 0) {
+		std::ofstream file(filePath);
+		file << "Not a checkpoint";
+	}
+	MPI_Barrier(MPI_COMM_WORLD);
+
+	int nRanks;
+	status = MeshSourceCheckpoint<int,double>::getCheckpointRankCount(filePath, &nRanks);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_INVALID_FILE_FORMAT);
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	if(comm.rank == 0) {
+		std::remove(filePath.c_str());
+	}
+}
+
+// === writeCheckpoint ===
+// Test 1: Error case - the mesh has not been finalized
+BOOST_AUTO_TEST_CASE(writeCheckpoint_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	CupCfdAoSMesh<int,double,int> mesh(comm);
+	cupcfd::error::eCodes status;
+
+	status = MeshSourceCheckpoint<int,double>::writeCheckpoint(mesh, "MeshSourceCheckpointUnfinalized.h5");
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_UNFINALIZED);
+}
+
+// Test 2: Write a finalized mesh, and read the block of each process back with the source
+BOOST_AUTO_TEST_CASE(writeCheckpoint_test2)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+	std::string filePath = "MeshSourceCheckpointTest2.h5";
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double> meshSourceConfig(5,5,5,0.0,1.0,0.0,1.0,0.0,1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = MeshSourceCheckpoint<int,double>::writeCheckpoint(*mesh, filePath);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int nRanks;
+	status = MeshSourceCheckpoint<int,double>::getCheckpointRankCount(filePath, &nRanks);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nRanks, comm.size);
+
+	int nCells;
+	int nFaces;
+	status = MeshSourceCheckpoint<int,double>::getCheckpointMeshSize(filePath, &nCells, &nFaces);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nCells, 125);
+	BOOST_CHECK_EQUAL(nFaces, mesh->properties.nFaces);
+
+	MeshSourceCheckpoint<int,double> source(filePath, comm);
+
+	int count;
+	status = source.getCellCount(&count);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(count, mesh->properties.nCells);
+
+	status = source.getFaceCount(&count);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(count, mesh->properties.nFaces);
+
+	status = source.getVertexCount(&count);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(count, mesh->properties.nVertices);
+
+	// The owned cells of this process should be the same as the owned cells of the mesh
+	int * ownedLabels;
+	int nOwnedLabels;
+	status = source.getOwnedCellLabels(&ownedLabels, &nOwnedLabels);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nOwnedLabels, mesh->properties.lOCells);
+
+	for(int i = 0; i < nOwnedLabels; i++) {
+		int localID = mesh->getCellID(ownedLabels[i]);
+		BOOST_CHECK(localID >= 0);
+		BOOST_CHECK(localID < mesh->properties.lOCells);
+
+		double vol;
+		euc::EuclideanPoint<double,3> center;
+		euc::EuclideanPoint<double,3> meshCenter;
+
+		status = source.getCellVolume(&vol, 1, ownedLabels + i, 1);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(vol, mesh->getCellVolume(localID));
+
+		status = source.getCellCenter(&center, 1, ownedLabels + i, 1);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		mesh->getCellCenter(localID, meshCenter);
+		BOOST_CHECK(center == meshCenter);
+	}
+
+	// Labels that were not on this process are not in its block
+	int missingLabel = -1;
+	double vol;
+	status = source.getCellVolume(&vol, 1, &missingLabel, 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_MESH_INVALID_CELL_LABEL);
+
+	free(ownedLabels);
+	delete mesh;
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	if(comm.rank == 0) {
+		std::remove(filePath.c_str());
+	}
+}
+
+// Test 3: Error case - the checkpoint file can not be created, so every process returns the error
+BOOST_AUTO_TEST_CASE(writeCheckpoint_test3)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double> meshSourceConfig(5,5,5,0.0,1.0,0.0,1.0,0.0,1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = MeshSourceCheckpoint<int,double>::writeCheckpoint(*mesh, "MeshSourceCheckpointMissingDir/MeshSourceCheckpoint.h5");
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_HDF5_ERROR);
+
+	delete mesh;
+}
+
+// === buildUnstructuredMesh with a checkpoint ===
+// Test 1: The first build writes the checkpoint, the second build reloads the same partition from it
+BOOST_AUTO_TEST_CASE(buildUnstructuredMesh_checkpoint_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+	std::string filePath = "MeshSourceCheckpointBuild.h5";
+
+	if(comm.rank == 0) {
+		std::remove(filePath.c_str());
+	}
+	MPI_Barrier(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double> meshSourceConfig(5,5,5,0.0,1.0,0.0,1.0,0.0,1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+	meshConfig.setCheckpointPath(filePath);
+
+	CupCfdSoAMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(meshConfig.checkpointLoaded, false);
+
+	CupCfdSoAMesh<int,double,int> * reloaded;
+	status = meshConfig.buildUnstructuredMesh(&reloaded, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(meshConfig.checkpointLoaded, true);
+
+	BOOST_CHECK_EQUAL(reloaded->properties.nCells, mesh->properties.nCells);
+	BOOST_CHECK_EQUAL(reloaded->properties.nFaces, mesh->properties.nFaces);
+	BOOST_CHECK_EQUAL(reloaded->properties.nVertices, mesh->properties.nVertices);
+	BOOST_CHECK_EQUAL(reloaded->properties.nBoundaries, mesh->properties.nBoundaries);
+	BOOST_CHECK_EQUAL(reloaded->properties.lOCells, mesh->properties.lOCells);
+	BOOST_CHECK_EQUAL(reloaded->properties.lTCells, mesh->properties.lTCells);
+	BOOST_CHECK_EQUAL(reloaded->properties.lFaces, mesh->properties.lFaces);
+	BOOST_CHECK_EQUAL(reloaded->properties.lBoundaries, mesh->properties.lBoundaries);
+	BOOST_CHECK_EQUAL(reloaded->properties.lVertices, mesh->properties.lVertices);
+
+	// Every cell of the original mesh should be on the same process, with the same geometry
+	for(auto iter = mesh->cellBuildIDToLocalID.begin(); iter != mesh->cellBuildIDToLocalID.end(); iter++) {
+		int localID = iter->second;
+		int reloadedID = reloaded->getCellID(iter->first);
+
+		BOOST_CHECK(reloadedID >= 0);
+		BOOST_CHECK_EQUAL((localID < mesh->properties.lOCells), (reloadedID < reloaded->properties.lOCells));
+		BOOST_CHECK_EQUAL(reloaded->getCellVolume(reloadedID), mesh->getCellVolume(localID));
+
+		euc::EuclideanPoint<double,3> center;
+		euc::EuclideanPoint<double,3> reloadedCenter;
+		mesh->getCellCenter(localID, center);
+		reloaded->getCellCenter(reloadedID, reloadedCenter);
+		BOOST_CHECK(center == reloadedCenter);
+
+		if(localID < mesh->properties.lOCells) {
+			BOOST_CHECK_EQUAL(reloaded->getCellNFaces(reloadedID), mesh->getCellNFaces(localID));
+		}
+	}
+
+	delete mesh;
+	delete reloaded;
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	if(comm.rank == 0) {
+		std::remove(filePath.c_str());
+	}
+}
+
+// Test 2: A checkpoint of a mesh of a different size to the mesh source is not reloaded
+BOOST_AUTO_TEST_CASE(buildUnstructuredMesh_checkpoint_test2)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+	std::string filePath = "MeshSourceCheckpointMismatch.h5";
+
+	if(comm.rank == 0) {
+		std::remove(filePath.c_str());
+	}
+	MPI_Barrier(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double> meshSourceConfig(5,5,5,0.0,1.0,0.0,1.0,0.0,1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+	meshConfig.setCheckpointPath(filePath);
+
+	CupCfdSoAMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(meshConfig.checkpointLoaded, false);
+
+	MeshSourceStructGenConfig<int,double> largerSourceConfig(6,6,6,0.0,1.0,0.0,1.0,0.0,1.0);
+	MeshConfig<int,double,int> largerConfig(partConfig, largerSourceConfig);
+	largerConfig.setCheckpointPath(filePath);
+
+	CupCfdSoAMesh<int,double,int> * larger;
+	status = largerConfig.buildUnstructuredMesh(&larger, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(largerConfig.checkpointLoaded, false);
+	BOOST_CHECK_EQUAL(larger->properties.nCells, 216);
+
+	int nOwnedCells;
+	status = cupcfd::comm::allReduceAdd(&(larger->properties.lOCells), 1, &nOwnedCells, 1, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nOwnedCells, 216);
+
+	delete mesh;
+	delete larger;
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	if(comm.rank == 0) {
+		std::remove(filePath.c_str());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    MPI_Finalize();
+}
@@ -319,6 +319,37 @@ BOOST_AUTO_TEST_CASE(getMeshSpatialZMax_test4)
 
 }
 
+// === getMeshBlockDecomposition ===
+// Test 1: The block counts are read from the BlockDecomposition object
+BOOST_AUTO_TEST_CASE(getMeshBlockDecomposition_test1)
+{
+	cupcfd::error::eCodes status;
+	bool enabled;
+	int blockX, blockY, blockZ;
+
+	std::string topLevel[0] = {};
+	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfigBlock.json", topLevel, 0);
+	status = configFile.getMeshBlockDecomposition(&enabled, &blockX, &blockY, &blockZ);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(enabled, true);
+	BOOST_CHECK_EQUAL(blockX, 2);
+	BOOST_CHECK_EQUAL(blockY, 2);
+	BOOST_CHECK_EQUAL(blockZ, 1);
+}
+
+// Test 2: Error Case - E_CONFIG_OPT_NOT_FOUND
+BOOST_AUTO_TEST_CASE(getMeshBlockDecomposition_test2)
+{
+	cupcfd::error::eCodes status;
+	bool enabled;
+	int blockX, blockY, blockZ;
+
+	std::string topLevel[0] = {};
+	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfig.json", topLevel, 0);
+	status = configFile.getMeshBlockDecomposition(&enabled, &blockX, &blockY, &blockZ);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_CONFIG_OPT_NOT_FOUND);
+}
+
 // === buildMeshSourceConfig ===
 BOOST_AUTO_TEST_CASE(buildMeshSourceConfig)
 {
@@ -332,3 +363,22 @@ BOOST_AUTO_TEST_CASE(buildMeshSourceConfig)
 	status = configFile1.buildMeshSourceConfig(&config);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 }
+
+// Test 2: The block decomposition is passed on to the config
+BOOST_AUTO_TEST_CASE(buildMeshSourceConfig_test2)
+{
+	cupcfd::error::eCodes status;
+
+	std::string topLevel[0] = {};
+	MeshSourceStructGenConfigJSON<int, double> configFile("../tests/geometry/mesh/data/MeshSourceStructGenConfigBlock.json", topLevel, 0);
+
+	MeshSourceConfig<int,double,int> * config;
+	status = configFile.buildMeshSourceConfig(&config);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	MeshSourceStructGenConfig<int,double> * structGenConfig = dynamic_cast<MeshSourceStructGenConfig<int,double> *>(config);
+	BOOST_REQUIRE(structGenConfig != nullptr);
+	BOOST_CHECK_EQUAL(structGenConfig->getBlockDecomposition(), true);
+
+	delete config;
+}
@@ -16,6 +16,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "MeshStructGenSource.h"
 #include "EuclideanPoint.h"
@@ -23,6 +24,13 @@
 #include "EuclideanPoint.h"
 
 #include "DistributedAdjacencyList.h"
+#include "PartitionerNaiveConfig.h"
+#include "PartitionerSFCConfig.h"
+#include "PartitionerRCBConfig.h"
+#include "MeshSourceStructGenConfig.h"
+#include "MeshConfig.h"
+#include "CupCfdAoSMesh.h"
+#include "Reduce.h"
 
 using namespace cupcfd::geometry::mesh;
 
@@ -996,8 +1004,8 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 	status = source.getCellLabels(cellLabels, 6, indices, 6);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 
-	cupcfd::data_structures::DistributedAdjacencyList<int,int> * graph;
-	status = source.buildDistributedAdjacencyList(&graph, comm, cellLabels, 6);
+	cupcfd::data_structures::DistributedAdjacencyList<int,int> graph(comm);
+	status = source.buildDistributedAdjacencyList(graph, cellLabels, 6);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 
 	// Check Local Nodes
@@ -1005,7 +1013,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 	{
 		int localNodes[6];
 		int localNodesCmp[6] = {0, 1, 2, 3, 4, 5};
-		status = graph->getLocalNodes(localNodes, 6);
+		status = graph.getLocalNodes(localNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(localNodes, localNodes + 6, localNodesCmp, localNodesCmp + 6);
 	}
@@ -1013,7 +1021,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 	{
 		int localNodes[6];
 		int localNodesCmp[6] = {6, 7, 8, 9, 10, 11};
-		status = graph->getLocalNodes(localNodes, 6);
+		status = graph.getLocalNodes(localNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(localNodes, localNodes + 6, localNodesCmp, localNodesCmp + 6);
 	}
@@ -1021,7 +1029,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 	{
 		int localNodes[6];
 		int localNodesCmp[6] = {12, 13, 14, 15, 16, 17};
-		status = graph->getLocalNodes(localNodes, 6);
+		status = graph.getLocalNodes(localNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(localNodes, localNodes + 6, localNodesCmp, localNodesCmp + 6);
 	}
@@ -1029,7 +1037,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 	{
 		int localNodes[6];
 		int localNodesCmp[6] = {18, 19, 20, 21, 22, 23};
-		status = graph->getLocalNodes(localNodes, 6);
+		status = graph.getLocalNodes(localNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(localNodes, localNodes + 6, localNodesCmp, localNodesCmp + 6);
 	}
@@ -1039,7 +1047,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 	{
 		int ghostNodes[6];
 		int ghostNodesCmp[6] = {6, 7, 8, 9, 10, 11};
-		status = graph->getGhostNodes(ghostNodes, 6);
+		status = graph.getGhostNodes(ghostNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes, ghostNodes + 6, ghostNodesCmp, ghostNodesCmp + 6);
 	}
@@ -1047,7 +1055,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 	{
 		int ghostNodes[12];
 		int ghostNodesCmp[12] = {0, 1, 2, 3, 4, 5, 12, 13, 14, 15, 16, 17};
-		status = graph->getGhostNodes(ghostNodes, 12);
+		status = graph.getGhostNodes(ghostNodes, 12);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes, ghostNodes + 12, ghostNodesCmp, ghostNodesCmp + 12);
 	}
@@ -1055,7 +1063,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 	{
 		int ghostNodes[12];
 		int ghostNodesCmp[12] = {6, 7, 8, 9, 10, 11, 18, 19, 20, 21, 22, 23};
-		status = graph->getGhostNodes(ghostNodes, 12);
+		status = graph.getGhostNodes(ghostNodes, 12);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes, ghostNodes + 12, ghostNodesCmp, ghostNodesCmp + 12);
 	}
@@ -1063,7 +1071,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 	{
 		int ghostNodes[6];
 		int ghostNodesCmp[6] = {12, 13, 14, 15, 16, 17};
-		status = graph->getGhostNodes(ghostNodes, 6);
+		status = graph.getGhostNodes(ghostNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes, ghostNodes + 6, ghostNodesCmp, ghostNodesCmp + 6);
 	}
@@ -1077,7 +1085,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 		for(int i = 0; i < 20; i++)
 		{
 			bool check = false;
-			status = graph->existsEdge(edgeCell1[i], edgeCell2[i], &check);
+			status = graph.existsEdge(edgeCell1[i], edgeCell2[i], &check);
 			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 			BOOST_CHECK_EQUAL(check, true);
 		}
@@ -1090,7 +1098,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 		for(int i = 0; i < 26; i++)
 		{
 			bool check = false;
-			status = graph->existsEdge(edgeCell1[i], edgeCell2[i], &check);
+			status = graph.existsEdge(edgeCell1[i], edgeCell2[i], &check);
 			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 			BOOST_CHECK_EQUAL(check, true);
 		}
@@ -1103,7 +1111,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 		for(int i = 0; i < 26; i++)
 		{
 			bool check = false;
-			status = graph->existsEdge(edgeCell1[i], edgeCell2[i], &check);
+			status = graph.existsEdge(edgeCell1[i], edgeCell2[i], &check);
 			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 			BOOST_CHECK_EQUAL(check, true);
 		}
@@ -1116,7 +1124,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList1_test1)
 		for(int i = 0; i < 20; i++)
 		{
 			bool check = false;
-			status = graph->existsEdge(edgeCell1[i], edgeCell2[i], &check);
+			status = graph.existsEdge(edgeCell1[i], edgeCell2[i], &check);
 			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 			BOOST_CHECK_EQUAL(check, true);
 		}
@@ -1133,8 +1141,8 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(2, 3, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
-	cupcfd::data_structures::DistributedAdjacencyList<int,int> * graph;
-	status = source.buildDistributedAdjacencyList(&graph, comm);
+	cupcfd::data_structures::DistributedAdjacencyList<int,int> graph(comm);
+	status = source.buildDistributedAdjacencyList(graph, comm);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 
 	// Check Local Nodes
@@ -1142,7 +1150,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 	{
 		int localNodes[6];
 		int localNodesCmp[6] = {0, 1, 2, 3, 4, 5};
-		status = graph->getLocalNodes(localNodes, 6);
+		status = graph.getLocalNodes(localNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(localNodes, localNodes + 6, localNodesCmp, localNodesCmp + 6);
 	}
@@ -1150,7 +1158,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 	{
 		int localNodes[6];
 		int localNodesCmp[6] = {6, 7, 8, 9, 10, 11};
-		status = graph->getLocalNodes(localNodes, 6);
+		status = graph.getLocalNodes(localNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(localNodes, localNodes + 6, localNodesCmp, localNodesCmp + 6);
 	}
@@ -1158,7 +1166,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 	{
 		int localNodes[6];
 		int localNodesCmp[6] = {12, 13, 14, 15, 16, 17};
-		status = graph->getLocalNodes(localNodes, 6);
+		status = graph.getLocalNodes(localNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(localNodes, localNodes + 6, localNodesCmp, localNodesCmp + 6);
 	}
@@ -1166,7 +1174,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 	{
 		int localNodes[6];
 		int localNodesCmp[6] = {18, 19, 20, 21, 22, 23};
-		status = graph->getLocalNodes(localNodes, 6);
+		status = graph.getLocalNodes(localNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(localNodes, localNodes + 6, localNodesCmp, localNodesCmp + 6);
 	}
@@ -1176,7 +1184,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 	{
 		int ghostNodes[6];
 		int ghostNodesCmp[6] = {6, 7, 8, 9, 10, 11};
-		status = graph->getGhostNodes(ghostNodes, 6);
+		status = graph.getGhostNodes(ghostNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes, ghostNodes + 6, ghostNodesCmp, ghostNodesCmp + 6);
 	}
@@ -1184,7 +1192,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 	{
 		int ghostNodes[12];
 		int ghostNodesCmp[12] = {0, 1, 2, 3, 4, 5, 12, 13, 14, 15, 16, 17};
-		status = graph->getGhostNodes(ghostNodes, 12);
+		status = graph.getGhostNodes(ghostNodes, 12);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes, ghostNodes + 12, ghostNodesCmp, ghostNodesCmp + 12);
 	}
@@ -1192,7 +1200,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 	{
 		int ghostNodes[12];
 		int ghostNodesCmp[12] = {6, 7, 8, 9, 10, 11, 18, 19, 20, 21, 22, 23};
-		status = graph->getGhostNodes(ghostNodes, 12);
+		status = graph.getGhostNodes(ghostNodes, 12);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes, ghostNodes + 12, ghostNodesCmp, ghostNodesCmp + 12);
 	}
@@ -1200,7 +1208,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 	{
 		int ghostNodes[6];
 		int ghostNodesCmp[6] = {12, 13, 14, 15, 16, 17};
-		status = graph->getGhostNodes(ghostNodes, 6);
+		status = graph.getGhostNodes(ghostNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes, ghostNodes + 6, ghostNodesCmp, ghostNodesCmp + 6);
 	}
@@ -1214,7 +1222,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 		for(int i = 0; i < 20; i++)
 		{
 			bool check = false;
-			status = graph->existsEdge(edgeCell1[i], edgeCell2[i], &check);
+			status = graph.existsEdge(edgeCell1[i], edgeCell2[i], &check);
 			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 			BOOST_CHECK_EQUAL(check, true);
 		}
@@ -1227,7 +1235,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 		for(int i = 0; i < 26; i++)
 		{
 			bool check = false;
-			status = graph->existsEdge(edgeCell1[i], edgeCell2[i], &check);
+			status = graph.existsEdge(edgeCell1[i], edgeCell2[i], &check);
 			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 			BOOST_CHECK_EQUAL(check, true);
 		}
@@ -1240,7 +1248,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 		for(int i = 0; i < 26; i++)
 		{
 			bool check = false;
-			status = graph->existsEdge(edgeCell1[i], edgeCell2[i], &check);
+			status = graph.existsEdge(edgeCell1[i], edgeCell2[i], &check);
 			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 			BOOST_CHECK_EQUAL(check, true);
 		}
@@ -1253,7 +1261,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test1)
 		for(int i = 0; i < 20; i++)
 		{
 			bool check = false;
-			status = graph->existsEdge(edgeCell1[i], edgeCell2[i], &check);
+			status = graph.existsEdge(edgeCell1[i], edgeCell2[i], &check);
 			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 			BOOST_CHECK_EQUAL(check, true);
 		}
@@ -1268,18 +1276,18 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
 	cupcfd::error::eCodes status;
 
-	cupcfd::data_structures::DistributedAdjacencyList<int,int> * graph;
-	status = source.buildDistributedAdjacencyList(&graph, comm);
+	cupcfd::data_structures::DistributedAdjacencyList<int,int> graph(comm);
+	status = source.buildDistributedAdjacencyList(graph, comm);
 	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 
-	std::cout << "Number of local nodes:" << graph->nLONodes << "\n";
+	std::cout << "Number of local nodes:" << graph.nLONodes << "\n";
 
 	// Check Local Nodes
 	if(comm.rank == 0)
 	{
 		int localNodes[6];
 		int localNodesCmp[6] = {0, 1, 2, 3, 4, 5};
-		status = graph->getLocalNodes(localNodes, 6);
+		status = graph.getLocalNodes(localNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(localNodes, localNodes + 6, localNodesCmp, localNodesCmp + 6);
 	}
@@ -1287,7 +1295,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 	{
 		int localNodes[6];
 		int localNodesCmp[6] = {6, 7, 8, 9, 10, 11};
-		status = graph->getLocalNodes(localNodes, 6);
+		status = graph.getLocalNodes(localNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(localNodes, localNodes + 6, localNodesCmp, localNodesCmp + 6);
 	}
@@ -1295,7 +1303,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 	{
 		int localNodes[6];
 		int localNodesCmp[6] = {12, 13, 14, 15, 16, 17};
-		status = graph->getLocalNodes(localNodes, 6);
+		status = graph.getLocalNodes(localNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(localNodes, localNodes + 6, localNodesCmp, localNodesCmp + 6);
 	}
@@ -1303,7 +1311,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 	{
 		int localNodes[6];
 		int localNodesCmp[6] = {18, 19, 20, 21, 22, 23};
-		status = graph->getLocalNodes(localNodes, 6);
+		status = graph.getLocalNodes(localNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(localNodes, localNodes + 6, localNodesCmp, localNodesCmp + 6);
 	}
@@ -1313,7 +1321,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 	{
 		int ghostNodes[6];
 		int ghostNodesCmp[6] = {6, 7, 8, 9, 10, 11};
-		status = graph->getGhostNodes(ghostNodes, 6);
+		status = graph.getGhostNodes(ghostNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes, ghostNodes + 6, ghostNodesCmp, ghostNodesCmp + 6);
 	}
@@ -1321,7 +1329,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 	{
 		int ghostNodes[12];
 		int ghostNodesCmp[12] = {0, 1, 2, 3, 4, 5, 12, 13, 14, 15, 16, 17};
-		status = graph->getGhostNodes(ghostNodes, 12);
+		status = graph.getGhostNodes(ghostNodes, 12);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes, ghostNodes + 12, ghostNodesCmp, ghostNodesCmp + 12);
 	}
@@ -1329,7 +1337,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 	{
 		int ghostNodes[12];
 		int ghostNodesCmp[12] = {6, 7, 8, 9, 10, 11, 18, 19, 20, 21, 22, 23};
-		status = graph->getGhostNodes(ghostNodes, 12);
+		status = graph.getGhostNodes(ghostNodes, 12);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes, ghostNodes + 12, ghostNodesCmp, ghostNodesCmp + 12);
 	}
@@ -1337,7 +1345,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 	{
 		int ghostNodes[6];
 		int ghostNodesCmp[6] = {12, 13, 14, 15, 16, 17};
-		status = graph->getGhostNodes(ghostNodes, 6);
+		status = graph.getGhostNodes(ghostNodes, 6);
 		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 		BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes, ghostNodes + 6, ghostNodesCmp, ghostNodesCmp + 6);
 	}
@@ -1351,7 +1359,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 		for(int i = 0; i < 20; i++)
 		{
 			bool check = false;
-			status = graph->existsEdge(edgeCell1[i], edgeCell2[i], &check);
+			status = graph.existsEdge(edgeCell1[i], edgeCell2[i], &check);
 			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 			BOOST_CHECK_EQUAL(check, true);
 		}
@@ -1364,7 +1372,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 		for(int i = 0; i < 26; i++)
 		{
 			bool check = false;
-			status = graph->existsEdge(edgeCell1[i], edgeCell2[i], &check);
+			status = graph.existsEdge(edgeCell1[i], edgeCell2[i], &check);
 			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 			BOOST_CHECK_EQUAL(check, true);
 		}
@@ -1377,7 +1385,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 		for(int i = 0; i < 26; i++)
 		{
 			bool check = false;
-			status = graph->existsEdge(edgeCell1[i], edgeCell2[i], &check);
+			status = graph.existsEdge(edgeCell1[i], edgeCell2[i], &check);
 			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 			BOOST_CHECK_EQUAL(check, true);
 		}
@@ -1390,7 +1398,7 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 		for(int i = 0; i < 20; i++)
 		{
 			bool check = false;
-			status = graph->existsEdge(edgeCell1[i], edgeCell2[i], &check);
+			status = graph.existsEdge(edgeCell1[i], edgeCell2[i], &check);
 			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 			BOOST_CHECK_EQUAL(check, true);
 		}
@@ -1398,6 +1406,369 @@ BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList2_test2)
 }
 	*/
 
+// === getBlockGrid ===
+// Test 1: Choose the block counts with the fewest faces between blocks
+BOOST_AUTO_TEST_CASE(getBlockGrid_test1)
+{
+	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(12, 4, 2, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::error::eCodes status;
+	int pX, pY, pZ;
+
+	source.setBlockDecomposition(0, 0, 0);
+	status = source.getBlockGrid(4, &pX, &pY, &pZ);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(pX, 4);
+	BOOST_CHECK_EQUAL(pY, 1);
+	BOOST_CHECK_EQUAL(pZ, 1);
+}
+
+// Test 2: Use the set block counts
+BOOST_AUTO_TEST_CASE(getBlockGrid_test2)
+{
+	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(12, 4, 2, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::error::eCodes status;
+	int pX, pY, pZ;
+
+	source.setBlockDecomposition(1, 2, 2);
+	status = source.getBlockGrid(4, &pX, &pY, &pZ);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(pX, 1);
+	BOOST_CHECK_EQUAL(pY, 2);
+	BOOST_CHECK_EQUAL(pZ, 2);
+}
+
+// Test 3: Error Case - the set block counts do not match the number of processes
+BOOST_AUTO_TEST_CASE(getBlockGrid_test3)
+{
+	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(12, 4, 2, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::error::eCodes status;
+	int pX, pY, pZ;
+
+	source.setBlockDecomposition(2, 2, 2);
+	status = source.getBlockGrid(4, &pX, &pY, &pZ);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_CONFIG_INVALID_VALUE);
+}
+
+// Test 4: Error Case - more processes than can be given a non-empty block
+BOOST_AUTO_TEST_CASE(getBlockGrid_test4)
+{
+	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(2, 1, 1, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::error::eCodes status;
+	int pX, pY, pZ;
+
+	source.setBlockDecomposition(0, 0, 0);
+	status = source.getBlockGrid(4, &pX, &pY, &pZ);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_CONFIG_INVALID_VALUE);
+}
+
+// === getBlockRange ===
+// Test 1: The remainder is spread across the lowest blocks
+BOOST_AUTO_TEST_CASE(getBlockRange_test1)
+{
+	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(5, 5, 5, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	int start, end;
+
+	source.getBlockRange(0, 3, 11, &start, &end);
+	BOOST_CHECK_EQUAL(start, 0);
+	BOOST_CHECK_EQUAL(end, 4);
+
+	source.getBlockRange(1, 3, 11, &start, &end);
+	BOOST_CHECK_EQUAL(start, 4);
+	BOOST_CHECK_EQUAL(end, 8);
+
+	source.getBlockRange(2, 3, 11, &start, &end);
+	BOOST_CHECK_EQUAL(start, 8);
+	BOOST_CHECK_EQUAL(end, 11);
+}
+
+// === getCellDecomposition ===
+// Test 1: Error Case - the block decomposition is not enabled
+BOOST_AUTO_TEST_CASE(getCellDecomposition_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(4, 4, 1, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::error::eCodes status;
+
+	int * cellLabels;
+	int nCellLabels;
+	status = source.getCellDecomposition(&cellLabels, &nCellLabels, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_NOT_IMPLEMENTED);
+}
+
+// Test 2: Each process is given a 2x2 block of a 4x4 grid
+BOOST_AUTO_TEST_CASE(getCellDecomposition_test2)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(4, 4, 1, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::error::eCodes status;
+
+	source.setBlockDecomposition(2, 2, 1);
+
+	int * cellLabels;
+	int nCellLabels;
+	status = source.getCellDecomposition(&cellLabels, &nCellLabels, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nCellLabels, 4);
+
+	int cmp[4][4] = {{0, 1, 4, 5}, {2, 3, 6, 7}, {8, 9, 12, 13}, {10, 11, 14, 15}};
+	BOOST_CHECK_EQUAL_COLLECTIONS(cellLabels, cellLabels + 4, cmp[comm.rank], cmp[comm.rank] + 4);
+
+	free(cellLabels);
+}
+
+// === buildDistributedAdjacencyList (Block Decomposition) ===
+// Test 1: The graph built from the cell coordinates matches the graph built from the cell faces
+BOOST_AUTO_TEST_CASE(buildDistributedAdjacencyList3_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::geometry::mesh::MeshStructGenSource<int, double> source(6, 5, 4, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	cupcfd::error::eCodes status;
+
+	source.setBlockDecomposition(0, 0, 0);
+
+	int * cellLabels;
+	int nCellLabels;
+	status = source.getCellDecomposition(&cellLabels, &nCellLabels, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	cupcfd::data_structures::DistributedAdjacencyList<int,int> graph(comm);
+	status = source.buildDistributedAdjacencyList(graph, cellLabels, nCellLabels);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	cupcfd::data_structures::DistributedAdjacencyList<int,int> faceGraph(comm);
+	status = source.MeshSource<int,double,int>::buildDistributedAdjacencyList(faceGraph, cellLabels, nCellLabels);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(graph.nLONodes, faceGraph.nLONodes);
+	BOOST_REQUIRE_EQUAL(graph.nLGhNodes, faceGraph.nLGhNodes);
+
+	std::vector<int> localNodes(graph.nLONodes);
+	std::vector<int> localNodesCmp(faceGraph.nLONodes);
+	status = graph.getLocalNodes(localNodes.data(), graph.nLONodes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = faceGraph.getLocalNodes(localNodesCmp.data(), faceGraph.nLONodes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(localNodes.begin(), localNodes.end(), localNodesCmp.begin(), localNodesCmp.end());
+
+	std::vector<int> ghostNodes(graph.nLGhNodes);
+	std::vector<int> ghostNodesCmp(faceGraph.nLGhNodes);
+	status = graph.getGhostNodes(ghostNodes.data(), graph.nLGhNodes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = faceGraph.getGhostNodes(ghostNodesCmp.data(), faceGraph.nLGhNodes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(ghostNodes.begin(), ghostNodes.end(), ghostNodesCmp.begin(), ghostNodesCmp.end());
+
+	// Every edge of the face graph should be in the graph built from the coordinates, and vice versa
+	for(int i = 0; i < nCellLabels; i++) {
+		int nAdj, nAdjCmp;
+		status = graph.connGraph.getAdjacentNodeCount(cellLabels[i], &nAdj);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		status = faceGraph.connGraph.getAdjacentNodeCount(cellLabels[i], &nAdjCmp);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_REQUIRE_EQUAL(nAdj, nAdjCmp);
+
+		std::vector<int> adjCmp(nAdjCmp);
+		status = faceGraph.connGraph.getAdjacentNodes(cellLabels[i], adjCmp.data(), nAdjCmp);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		for(int j = 0; j < nAdjCmp; j++) {
+			bool found = false;
+			status = graph.existsEdge(cellLabels[i], adjCmp[j], &found);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+			BOOST_CHECK_EQUAL(found, true);
+		}
+	}
+
+	free(cellLabels);
+}
+
+// === Block decomposition through the mesh config ===
+// Test 1: The mesh is built with the cells of the block decomposition, without partitioning
+BOOST_AUTO_TEST_CASE(blockDecomposition_meshConfig_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double> meshSourceConfig(4, 4, 3, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	meshSourceConfig.setBlockDecomposition(2, 2, 1);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Each process owns a 2x2x3 block, with a 1x2x3 ghost layer from each of its two neighbours
+	BOOST_CHECK_EQUAL(mesh->properties.lOCells, 12);
+	BOOST_CHECK_EQUAL(mesh->properties.lTCells, 24);
+
+	MeshStructGenSource<int,double> source(4, 4, 3, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	source.setBlockDecomposition(2, 2, 1);
+
+	int * cellLabels;
+	int nCellLabels;
+	status = source.getCellDecomposition(&cellLabels, &nCellLabels, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < nCellLabels; i++) {
+		int localID = mesh->getCellID(cellLabels[i]);
+		BOOST_CHECK(localID >= 0);
+		BOOST_CHECK(localID < mesh->properties.lOCells);
+	}
+
+	free(cellLabels);
+	delete mesh;
+}
+
+// === Geometric partitioning through the mesh config ===
+// Test 1: The cells are partitioned along a space-filling curve through the cell centers
+BOOST_AUTO_TEST_CASE(geometricPartitioner_meshConfig_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+
+	cupcfd::partitioner::PartitionerSFCConfig<int,int> partConfig(cupcfd::partitioner::PARTITIONER_SFC_HILBERT);
+	MeshSourceStructGenConfig<int,double> meshSourceConfig(4, 4, 4, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(mesh->properties.lOCells, 64 / comm.size);
+
+	delete mesh;
+}
+
+// Test 2: The cells are partitioned by recursive coordinate bisection of the cell centers
+BOOST_AUTO_TEST_CASE(geometricPartitioner_meshConfig_test2)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+
+	cupcfd::partitioner::PartitionerRCBConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double> meshSourceConfig(4, 4, 4, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(mesh->properties.lOCells, 64 / comm.size);
+
+	delete mesh;
+}
+
+// === repartitionUnstructuredMesh ===
+// Test 1: Weight the cells in the lowest x layer more heavily, and check that the mesh rebuilt with the
+// new cell ranks keeps every cell and balances the cell weight across the processes
+BOOST_AUTO_TEST_CASE(repartitionUnstructuredMesh_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+
+	cupcfd::partitioner::PartitionerRCBConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double> meshSourceConfig(4, 4, 4, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int nOwnedCells = mesh->properties.lOCells;
+	std::vector<double> cellWeights(nOwnedCells);
+	std::vector<int> cellRanks(nOwnedCells);
+
+	for(int i = 0; i < nOwnedCells; i++) {
+		cellWeights[i] = (mesh->getCellCenter(i).cmp[0] < 0.25) ? 7.0 : 1.0;
+	}
+
+	status = meshConfig.repartitionUnstructuredMesh(*mesh, cellWeights.data(), nOwnedCells, cellRanks.data(), nOwnedCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	CupCfdAoSMesh<int,double,int> * newMesh;
+	status = meshConfig.buildUnstructuredMesh(&newMesh, *mesh, cellRanks.data(), nOwnedCells, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int nNewOwnedCells = newMesh->properties.lOCells;
+	double localWeight = 0.0;
+
+	for(int i = 0; i < nNewOwnedCells; i++) {
+		localWeight = localWeight + ((newMesh->getCellCenter(i).cmp[0] < 0.25) ? 7.0 : 1.0);
+	}
+
+	int totalCells;
+	double maxWeight;
+
+	status = cupcfd::comm::allReduceAdd(&nNewOwnedCells, 1, &totalCells, 1, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(totalCells, 64);
+
+	// The total weight is 160, and the weight of each process is within one heavy cell of the average
+	status = cupcfd::comm::allReduceMax(&localWeight, 1, &maxWeight, 1, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK(maxWeight <= (160.0 / comm.size) + 7.0);
+
+	delete newMesh;
+	delete mesh;
+}
+
+// Test 2: Test that repartitioning with a partitioner that does not support node weights returns an error
+BOOST_AUTO_TEST_CASE(repartitionUnstructuredMesh_test2)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int,double> meshSourceConfig(4, 4, 4, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int nOwnedCells = mesh->properties.lOCells;
+	std::vector<double> cellWeights(nOwnedCells, 1.0);
+	std::vector<int> cellRanks(nOwnedCells);
+
+	status = meshConfig.repartitionUnstructuredMesh(*mesh, cellWeights.data(), nOwnedCells, cellRanks.data(), nOwnedCells);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_NOT_IMPLEMENTED);
+
+	delete mesh;
+}
+
+// === Adding data to a mesh on a process that owns no cells ===
+// Test 1: Split the cells between all but the last process, and check the last process still goes through
+// the reads from the source without error
+BOOST_AUTO_TEST_CASE(addData_emptyProcess_test1)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	cupcfd::error::eCodes status;
+
+	MeshStructGenSource<int,double> source(4, 4, 4, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+
+	int nParts = (comm.size > 1) ? comm.size - 1 : 1;
+	std::vector<int> cellLabels;
+
+	for(int i = 0; i < 64; i++) {
+		if((i * nParts) / 64 == comm.rank) {
+			cellLabels.push_back(i);
+		}
+	}
+
+	if(comm.size > 1 && comm.rank == comm.size - 1) {
+		BOOST_CHECK_EQUAL(cellLabels.size(), 0u);
+	}
+
+	CupCfdAoSMesh<int,double,int> mesh(comm);
+	status = mesh.addData(source, cellLabels.data(), int(cellLabels.size()));
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int nOwnedCells = mesh.properties.lOCells;
+	int totalCells;
+	status = cupcfd::comm::allReduceAdd(&nOwnedCells, 1, &totalCells, 1, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(totalCells, 64);
+}
+
 BOOST_AUTO_TEST_CASE(cleanup)
 {
     MPI_Finalize();
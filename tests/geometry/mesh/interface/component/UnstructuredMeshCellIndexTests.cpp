@@ -0,0 +1,217 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the UnstructuredMeshCellIndex Class
+ */
+
+#define BOOST_TEST_MODULE UnstructuredMeshCellIndex
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+
+#include "UnstructuredMeshCellIndex.h"
+#include "EuclideanPoint.h"
+#include "Error.h"
+
+using namespace cupcfd::geometry::mesh;
+
+// === Constructors ===
+// Test 1: Test Default Constructor
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	UnstructuredMeshCellIndex<int, double> index;
+
+	BOOST_CHECK_EQUAL(index.built, false);
+	BOOST_CHECK_EQUAL(index.nCells, 0);
+	BOOST_CHECK_EQUAL(index.nCellBounds, 0);
+	BOOST_CHECK_EQUAL(index.nBinXAdj, 0);
+	BOOST_CHECK_EQUAL(index.nBinCells, 0);
+	BOOST_CHECK(index.cellBounds == nullptr);
+	BOOST_CHECK(index.binXAdj == nullptr);
+	BOOST_CHECK(index.binCells == nullptr);
+}
+
+// === build ===
+// Test 1: Build an index over a 4x4x4 grid of unit cubes
+BOOST_AUTO_TEST_CASE(build_test1)
+{
+	UnstructuredMeshCellIndex<int, double> index;
+	cupcfd::error::eCodes status;
+
+	double bounds[64 * 6];
+	for(int k = 0; k < 4; k++) {
+		for(int j = 0; j < 4; j++) {
+			for(int i = 0; i < 4; i++) {
+				double * cell = bounds + ((((k * 4) + j) * 4) + i) * 6;
+				cell[0] = i; cell[1] = j; cell[2] = k;
+				cell[3] = i + 1; cell[4] = j + 1; cell[5] = k + 1;
+			}
+		}
+	}
+
+	status = index.build(bounds, 64 * 6);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(index.built, true);
+	BOOST_CHECK_EQUAL(index.nCells, 64);
+
+	BOOST_CHECK_EQUAL(index.lower[0], 0.0);
+	BOOST_CHECK_EQUAL(index.lower[1], 0.0);
+	BOOST_CHECK_EQUAL(index.lower[2], 0.0);
+	BOOST_CHECK_EQUAL(index.upper[0], 4.0);
+	BOOST_CHECK_EQUAL(index.upper[1], 4.0);
+	BOOST_CHECK_EQUAL(index.upper[2], 4.0);
+
+	// One bin per cell
+	BOOST_CHECK_EQUAL(index.nBins[0], 4);
+	BOOST_CHECK_EQUAL(index.nBins[1], 4);
+	BOOST_CHECK_EQUAL(index.nBins[2], 4);
+	BOOST_CHECK_EQUAL(index.nBinXAdj, 65);
+}
+
+// Test 2: Error Case: Bounds array is not a multiple of 6
+BOOST_AUTO_TEST_CASE(build_test2)
+{
+	UnstructuredMeshCellIndex<int, double> index;
+	cupcfd::error::eCodes status;
+
+	double bounds[7] = {0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 2.0};
+
+	status = index.build(bounds, 7);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+	BOOST_CHECK_EQUAL(index.built, false);
+}
+
+// Test 3: Build an index over cells with no extent in one dimension
+BOOST_AUTO_TEST_CASE(build_test3)
+{
+	UnstructuredMeshCellIndex<int, double> index;
+	cupcfd::error::eCodes status;
+
+	double bounds[12] = {0.0, 0.0, 0.0, 1.0, 1.0, 0.0,
+						 1.0, 0.0, 0.0, 2.0, 1.0, 0.0};
+
+	status = index.build(bounds, 12);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(index.nBins[2], 1);
+
+	const int * cells;
+	int nCandidates;
+	cupcfd::geometry::euclidean::EuclideanPoint<double,3> point(1.5, 0.5, 0.0);
+
+	index.getCandidateCells(point, &cells, &nCandidates);
+	BOOST_REQUIRE(nCandidates > 0);
+
+	bool found = false;
+	for(int i = 0; i < nCandidates; i++) {
+		if(cells[i] == 1) {
+			found = true;
+		}
+	}
+	BOOST_CHECK(found);
+}
+
+// === getCandidateCells ===
+// Test 1: Candidates always include the cell containing the point, in ascending order
+BOOST_AUTO_TEST_CASE(getCandidateCells_test1)
+{
+	UnstructuredMeshCellIndex<int, double> index;
+	cupcfd::error::eCodes status;
+
+	// Irregular widths in x so that bins and cells do not line up
+	double xEdges[6] = {0.0, 0.1, 0.5, 0.6, 1.7, 2.0};
+	double bounds[5 * 3 * 6];
+	for(int j = 0; j < 3; j++) {
+		for(int i = 0; i < 5; i++) {
+			double * cell = bounds + ((j * 5) + i) * 6;
+			cell[0] = xEdges[i]; cell[1] = j; cell[2] = 0.0;
+			cell[3] = xEdges[i + 1]; cell[4] = j + 1; cell[5] = 1.0;
+		}
+	}
+
+	status = index.build(bounds, 5 * 3 * 6);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int j = 0; j < 3; j++) {
+		for(int i = 0; i < 5; i++) {
+			int cellID = (j * 5) + i;
+			cupcfd::geometry::euclidean::EuclideanPoint<double,3> point((xEdges[i] + xEdges[i + 1]) / 2.0, j + 0.5, 0.5);
+
+			const int * cells;
+			int nCandidates;
+			index.getCandidateCells(point, &cells, &nCandidates);
+
+			bool found = false;
+			for(int k = 0; k < nCandidates; k++) {
+				if(cells[k] == cellID) {
+					found = true;
+				}
+
+				if(k > 0) {
+					BOOST_CHECK(cells[k - 1] < cells[k]);
+				}
+			}
+			BOOST_CHECK(found);
+
+			BOOST_CHECK(index.isPointInCellBounds(cellID, point));
+		}
+	}
+}
+
+// Test 2: Points outside of the indexed bounds have no candidates
+BOOST_AUTO_TEST_CASE(getCandidateCells_test2)
+{
+	UnstructuredMeshCellIndex<int, double> index;
+	cupcfd::error::eCodes status;
+
+	double bounds[6] = {0.0, 0.0, 0.0, 1.0, 1.0, 1.0};
+
+	status = index.build(bounds, 6);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	const int * cells;
+	int nCandidates;
+	cupcfd::geometry::euclidean::EuclideanPoint<double,3> point(1.5, 0.5, 0.5);
+
+	index.getCandidateCells(point, &cells, &nCandidates);
+	BOOST_CHECK_EQUAL(nCandidates, 0);
+	BOOST_CHECK_EQUAL(index.isPointInCellBounds(0, point), false);
+}
+
+// Test 3: An unbuilt index has no candidates
+BOOST_AUTO_TEST_CASE(getCandidateCells_test3)
+{
+	UnstructuredMeshCellIndex<int, double> index;
+
+	const int * cells;
+	int nCandidates;
+	cupcfd::geometry::euclidean::EuclideanPoint<double,3> point(0.5, 0.5, 0.5);
+
+	index.getCandidateCells(point, &cells, &nCandidates);
+	BOOST_CHECK_EQUAL(nCandidates, 0);
+}
+
+// === reset ===
+// Test 1: Reset returns the index to the unbuilt state
+BOOST_AUTO_TEST_CASE(reset_test1)
+{
+	UnstructuredMeshCellIndex<int, double> index;
+	cupcfd::error::eCodes status;
+
+	double bounds[6] = {0.0, 0.0, 0.0, 1.0, 1.0, 1.0};
+
+	status = index.build(bounds, 6);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	index.reset();
+	BOOST_CHECK_EQUAL(index.built, false);
+	BOOST_CHECK_EQUAL(index.nCells, 0);
+	BOOST_CHECK(index.cellBounds == nullptr);
+	BOOST_CHECK(index.binXAdj == nullptr);
+	BOOST_CHECK(index.binCells == nullptr);
+}
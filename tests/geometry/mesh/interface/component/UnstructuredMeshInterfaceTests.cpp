@@ -14,8 +14,17 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/output_test_stream.hpp>
 #include <stdexcept>
+#include <vector>
+#include <cmath>
+#include <algorithm>
 
 #include "UnstructuredMeshInterface.h"
+#include "PartitionerNaiveConfig.h"
+#include "MeshSourceStructGenConfig.h"
+#include "MeshConfig.h"
+#include "CupCfdAoSMesh.h"
+#include "CupCfdSoAMesh.h"
+#include "EuclideanPoint.h"
 
 using namespace cupcfd::geometry::mesh;
 
@@ -29,6 +38,570 @@ BOOST_AUTO_TEST_CASE(setup)
     MPI_Init(&argc, &argv);
 }
 
+// === findCellID ===
+// Test 1: Every cell center of a generated mesh is found on exactly one rank, with the
+// same result regardless of whether the spatial index is used
+BOOST_AUTO_TEST_CASE(findCellID_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// The index is built as part of finalize
+	BOOST_CHECK_EQUAL(mesh->cellIndex.built, true);
+	BOOST_CHECK_EQUAL(mesh->cellIndex.nCells, mesh->properties.lOCells);
+
+	for(int k = 0; k < 5; k++) {
+		for(int j = 0; j < 5; j++) {
+			for(int i = 0; i < 5; i++) {
+				cupcfd::geometry::euclidean::EuclideanPoint<double,3> point(0.1 + (i * 0.2), 0.1 + (j * 0.2), 0.1 + (k * 0.2));
+
+				int localCellID;
+				int globalCellID;
+				status = mesh->findCellID(point, &localCellID, &globalCellID);
+
+				int found = (status == cupcfd::error::E_SUCCESS) ? 1 : 0;
+				int nFound;
+				MPI_Allreduce(&found, &nFound, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+				BOOST_CHECK_EQUAL(nFound, 1);
+
+				if(found) {
+					BOOST_CHECK(localCellID >= 0 && localCellID < mesh->properties.lOCells);
+					BOOST_CHECK(mesh->isPointInCell(localCellID, point));
+
+					// The center of the found cell should match the point
+					cupcfd::geometry::euclidean::EuclideanPoint<double,3> center = mesh->getCellCenter(localCellID);
+					BOOST_CHECK_CLOSE(center.cmp[0], point.cmp[0], 1e-8);
+					BOOST_CHECK_CLOSE(center.cmp[1], point.cmp[1], 1e-8);
+					BOOST_CHECK_CLOSE(center.cmp[2], point.cmp[2], 1e-8);
+				}
+			}
+		}
+	}
+
+	// Without the index every local cell is searched - results should be unchanged
+	int indexLocalCellID;
+	int indexGlobalCellID;
+	cupcfd::geometry::euclidean::EuclideanPoint<double,3> point(0.33, 0.47, 0.91);
+	cupcfd::error::eCodes indexStatus = mesh->findCellID(point, &indexLocalCellID, &indexGlobalCellID);
+
+	mesh->cellIndex.reset();
+
+	int localCellID;
+	int globalCellID;
+	status = mesh->findCellID(point, &localCellID, &globalCellID);
+	BOOST_CHECK_EQUAL(status, indexStatus);
+
+	if(status == cupcfd::error::E_SUCCESS) {
+		BOOST_CHECK_EQUAL(localCellID, indexLocalCellID);
+		BOOST_CHECK_EQUAL(globalCellID, indexGlobalCellID);
+	}
+
+	delete mesh;
+}
+
+// Test 2: A point outside of the mesh is not found on any rank
+BOOST_AUTO_TEST_CASE(findCellID_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	cupcfd::geometry::euclidean::EuclideanPoint<double,3> point(1.5, 0.5, 0.5);
+
+	int localCellID;
+	int globalCellID;
+	status = mesh->findCellID(point, &localCellID, &globalCellID);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_GEOMETRY_NO_VALID_CELL);
+
+	delete mesh;
+}
+
+// === findCellIDs ===
+// Test 1: Batched lookup matches individual lookups
+BOOST_AUTO_TEST_CASE(findCellIDs_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	const int nPoints = 4;
+	cupcfd::geometry::euclidean::EuclideanPoint<double,3> points[nPoints] = {
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3>(0.11, 0.12, 0.13),
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3>(0.95, 0.55, 0.35),
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3>(-1.0, 0.5, 0.5),
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3>(0.51, 0.93, 0.77)
+	};
+
+	int localCellIDs[nPoints];
+	int globalCellIDs[nPoints];
+	int nFound;
+
+	status = mesh->findCellIDs(points, nPoints, localCellIDs, globalCellIDs, &nFound);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int nFoundCmp = 0;
+	for(int i = 0; i < nPoints; i++) {
+		int localCellID;
+		int globalCellID;
+		status = mesh->findCellID(points[i], &localCellID, &globalCellID);
+
+		if(status == cupcfd::error::E_SUCCESS) {
+			BOOST_CHECK_EQUAL(localCellIDs[i], localCellID);
+			BOOST_CHECK_EQUAL(globalCellIDs[i], globalCellID);
+			nFoundCmp++;
+		}
+		else {
+			BOOST_CHECK_EQUAL(localCellIDs[i], -1);
+			BOOST_CHECK_EQUAL(globalCellIDs[i], -1);
+		}
+	}
+
+	BOOST_CHECK_EQUAL(nFound, nFoundCmp);
+
+	// Point outside of the mesh is never found
+	BOOST_CHECK_EQUAL(localCellIDs[2], -1);
+
+	// Every point inside the mesh is found on exactly one rank
+	int nFoundTotal;
+	MPI_Allreduce(&nFound, &nFoundTotal, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+	BOOST_CHECK_EQUAL(nFoundTotal, 3);
+
+	delete mesh;
+}
+
+// === buildGeometryCache ===
+// Test 1: Cached geometric values match those computed directly from the mesh
+BOOST_AUTO_TEST_CASE(buildGeometryCache_test1, * boost::unit_test::tolerance(1e-12))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// The cache is built as part of finalize
+	BOOST_REQUIRE_EQUAL(mesh->geometryCache.built, true);
+	BOOST_CHECK_EQUAL(mesh->geometryCache.nCellDiameter, mesh->properties.lOCells);
+	BOOST_CHECK_EQUAL(mesh->geometryCache.nFaceTriXAdj, mesh->properties.lFaces + 1);
+
+	int nCells = mesh->properties.lOCells;
+	int nFaces = mesh->properties.lFaces;
+
+	double * cachedDiameter = (double *) malloc(sizeof(double) * nCells);
+	for(int i = 0; i < nCells; i++) {
+		cachedDiameter[i] = mesh->getCellDiameter(i);
+
+		// Cells are cubes of width 0.2
+		BOOST_TEST(cachedDiameter[i] == std::sqrt(3.0) * 0.2);
+	}
+
+	// Cached triangle fans, recorded before the cache is cleared
+	int nTriangles = mesh->geometryCache.faceTriXAdj[nFaces];
+	BOOST_CHECK_EQUAL(nTriangles, nFaces * 2);
+
+	cupcfd::geometry::euclidean::EuclideanVector<double,3> xDir(1.0, 0.0, 0.0);
+	bool * cachedParallel = (bool *) malloc(sizeof(bool) * nFaces);
+	for(int i = 0; i < nFaces; i++) {
+		BOOST_CHECK_EQUAL(mesh->getFaceNTriangles(i), 2);
+		cachedParallel[i] = mesh->isVectorParallelToFace(i, xDir);
+	}
+
+	cupcfd::geometry::euclidean::EuclideanPoint<double,3> a, b, c;
+	cupcfd::geometry::euclidean::EuclideanPoint<double,3> a2, b2, c2;
+
+	mesh->getFaceTriangle(0, 1, a, b, c);
+
+	// Clear the cache, and check that the directly computed values match
+	mesh->geometryCache.reset();
+
+	for(int i = 0; i < nCells; i++) {
+		BOOST_TEST(mesh->getCellDiameter(i) == cachedDiameter[i]);
+	}
+
+	for(int i = 0; i < nFaces; i++) {
+		BOOST_CHECK_EQUAL(mesh->getFaceNTriangles(i), 2);
+		BOOST_CHECK_EQUAL(mesh->isVectorParallelToFace(i, xDir), cachedParallel[i]);
+	}
+
+	mesh->getFaceTriangle(0, 1, a2, b2, c2);
+	for(int d = 0; d < 3; d++) {
+		BOOST_TEST(a.cmp[d] == a2.cmp[d]);
+		BOOST_TEST(b.cmp[d] == b2.cmp[d]);
+		BOOST_TEST(c.cmp[d] == c2.cmp[d]);
+	}
+
+	free(cachedDiameter);
+	free(cachedParallel);
+	delete mesh;
+}
+
+// === buildFaceColouring ===
+// Test 1: Every face is coloured exactly once, and no two faces of the same colour share a cell
+BOOST_AUTO_TEST_CASE(buildFaceColouring_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// The colouring is built as part of finalize
+	BOOST_REQUIRE_EQUAL(mesh->faceColouring.built, true);
+
+	int nFaces = mesh->properties.lFaces;
+	int nCells = mesh->properties.lTCells;
+	int nColours = mesh->faceColouring.nColours;
+
+	BOOST_CHECK_EQUAL(mesh->faceColouring.nColourFaces, nFaces);
+	BOOST_CHECK_EQUAL(mesh->faceColouring.nColourXAdj, nColours + 1);
+	BOOST_CHECK_EQUAL(mesh->faceColouring.colourXAdj[0], 0);
+	BOOST_CHECK_EQUAL(mesh->faceColouring.colourXAdj[nColours], nFaces);
+
+	// A hexahedral mesh has at most 6 faces per cell, so a greedy colouring needs at most 11 colours
+	BOOST_CHECK(nColours >= 6);
+	BOOST_CHECK(nColours <= 11);
+
+	std::vector<int> faceCount(nFaces, 0);
+	std::vector<int> cellColour(nCells, -1);
+
+	for(int c = 0; c < nColours; c++) {
+		for(int i = mesh->faceColouring.colourXAdj[c]; i < mesh->faceColouring.colourXAdj[c+1]; i++) {
+			int faceID = mesh->faceColouring.colourFaces[i];
+			BOOST_REQUIRE(faceID >= 0 && faceID < nFaces);
+			faceCount[faceID]++;
+
+			int cell1 = mesh->getFaceCell1ID(faceID);
+			BOOST_CHECK(cellColour[cell1] != c);
+			cellColour[cell1] = c;
+
+			if(!mesh->getFaceIsBoundary(faceID)) {
+				int cell2 = mesh->getFaceCell2ID(faceID);
+				BOOST_CHECK(cellColour[cell2] != c);
+				cellColour[cell2] = c;
+			}
+		}
+	}
+
+	for(int i = 0; i < nFaces; i++) {
+		BOOST_CHECK_EQUAL(faceCount[i], 1);
+	}
+
+	mesh->faceColouring.reset();
+	BOOST_CHECK_EQUAL(mesh->faceColouring.built, false);
+	BOOST_CHECK(mesh->faceColouring.colourFaces == nullptr);
+
+	delete mesh;
+}
+
+// === buildHaloFaces ===
+// Test 1: Every face is in exactly one of the lists, and only the halo faces access ghost cells
+BOOST_AUTO_TEST_CASE(buildHaloFaces_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// The split is built as part of finalize
+	BOOST_REQUIRE_EQUAL(mesh->haloFaces.built, true);
+
+	int nFaces = mesh->properties.lFaces;
+	int nOwnedCells = mesh->properties.lOCells;
+
+	BOOST_CHECK_EQUAL(mesh->haloFaces.nInteriorFaces + mesh->haloFaces.nHaloFaces, nFaces);
+
+	// The mesh is split over several ranks, so each rank has some halo faces
+	if(comm.size > 1) {
+		BOOST_CHECK(mesh->haloFaces.nHaloFaces > 0);
+	}
+
+	std::vector<int> faceCount(nFaces, 0);
+
+	for(int j = 0; j < mesh->haloFaces.nInteriorFaces; j++) {
+		int i = mesh->haloFaces.interiorFaces[j];
+		faceCount[i]++;
+
+		BOOST_CHECK(mesh->getFaceCell1ID(i) < nOwnedCells);
+		if(!mesh->getFaceIsBoundary(i)) {
+			BOOST_CHECK(mesh->getFaceCell2ID(i) < nOwnedCells);
+		}
+
+		if(j > 0) {
+			BOOST_CHECK(mesh->haloFaces.interiorFaces[j-1] < i);
+		}
+	}
+
+	for(int j = 0; j < mesh->haloFaces.nHaloFaces; j++) {
+		int i = mesh->haloFaces.haloFaces[j];
+		faceCount[i]++;
+
+		BOOST_REQUIRE_EQUAL(mesh->getFaceIsBoundary(i), false);
+		BOOST_CHECK(mesh->getFaceCell1ID(i) >= nOwnedCells || mesh->getFaceCell2ID(i) >= nOwnedCells);
+
+		if(j > 0) {
+			BOOST_CHECK(mesh->haloFaces.haloFaces[j-1] < i);
+		}
+	}
+
+	for(int i = 0; i < nFaces; i++) {
+		BOOST_CHECK_EQUAL(faceCount[i], 1);
+	}
+
+	mesh->haloFaces.reset();
+	BOOST_CHECK_EQUAL(mesh->haloFaces.built, false);
+	BOOST_CHECK(mesh->haloFaces.interiorFaces == nullptr);
+	BOOST_CHECK(mesh->haloFaces.haloFaces == nullptr);
+
+	delete mesh;
+}
+
+// === buildKernelView ===
+// Test 1: The flat kernel view matches the values returned by the mesh accessors, for both mesh layouts
+BOOST_AUTO_TEST_CASE(buildKernelView_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	CupCfdSoAMesh<int,double,int> * soaMesh;
+	status = meshConfig.buildUnstructuredMesh(&soaMesh, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// The view is built as part of finalize
+	BOOST_REQUIRE_EQUAL(mesh->kernelView.built, true);
+	BOOST_REQUIRE_EQUAL(soaMesh->kernelView.built, true);
+
+	UnstructuredMeshKernelView<int,double>& view = mesh->kernelView;
+	UnstructuredMeshKernelView<int,double>& soaView = soaMesh->kernelView;
+
+	int nFaces = mesh->properties.lFaces;
+	int nCells = mesh->properties.lTCells;
+
+	BOOST_CHECK_EQUAL(view.nFaces, nFaces);
+	BOOST_CHECK_EQUAL(view.nCells, nCells);
+	BOOST_REQUIRE_EQUAL(soaView.nFaces, nFaces);
+	BOOST_REQUIRE_EQUAL(soaView.nCells, nCells);
+
+	for(int i = 0; i < nFaces; i++) {
+		BOOST_CHECK_EQUAL(view.faceCell1[i], mesh->getFaceCell1ID(i));
+		BOOST_CHECK_EQUAL(view.faceIsBoundary[i], mesh->getFaceIsBoundary(i));
+
+		if(view.faceIsBoundary[i]) {
+			BOOST_CHECK_EQUAL(view.faceBoundaryID[i], mesh->getFaceBoundaryID(i));
+		}
+		else {
+			BOOST_CHECK_EQUAL(view.faceCell2[i], mesh->getFaceCell2ID(i));
+		}
+
+		BOOST_CHECK_EQUAL(view.faceLambda[i], mesh->getFaceLambda(i));
+		BOOST_CHECK_EQUAL(view.faceArea[i], mesh->getFaceArea(i));
+		BOOST_CHECK_EQUAL(view.faceRLencos[i], mesh->getFaceRLencos(i));
+
+		cupcfd::geometry::euclidean::EuclideanVector3D<double> norm = mesh->getFaceNorm(i);
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> center = mesh->getFaceCenter(i);
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> xpac = mesh->getFaceXpac(i);
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> xnac = mesh->getFaceXnac(i);
+
+		BOOST_CHECK_EQUAL(view.faceNormX[i], norm.cmp[0]);
+		BOOST_CHECK_EQUAL(view.faceNormY[i], norm.cmp[1]);
+		BOOST_CHECK_EQUAL(view.faceNormZ[i], norm.cmp[2]);
+
+		for(int d = 0; d < 3; d++) {
+			BOOST_CHECK_EQUAL(view.faceNorm(i).cmp[d], norm.cmp[d]);
+			BOOST_CHECK_EQUAL(view.faceCenter(i).cmp[d], center.cmp[d]);
+			BOOST_CHECK_EQUAL(view.faceXpac(i).cmp[d], xpac.cmp[d]);
+			BOOST_CHECK_EQUAL(view.faceXnac(i).cmp[d], xnac.cmp[d]);
+		}
+
+		// Both layouts produce the same view
+		BOOST_CHECK_EQUAL(soaView.faceCell1[i], view.faceCell1[i]);
+		BOOST_CHECK_EQUAL(soaView.faceCell2[i], view.faceCell2[i]);
+		BOOST_CHECK_EQUAL(soaView.faceLambda[i], view.faceLambda[i]);
+		BOOST_CHECK_EQUAL(soaView.faceNormX[i], view.faceNormX[i]);
+		BOOST_CHECK_EQUAL(soaView.faceNormY[i], view.faceNormY[i]);
+		BOOST_CHECK_EQUAL(soaView.faceNormZ[i], view.faceNormZ[i]);
+	}
+
+	for(int i = 0; i < nCells; i++) {
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> center = mesh->getCellCenter(i);
+
+		BOOST_CHECK_EQUAL(view.cellCenterX[i], center.cmp[0]);
+		BOOST_CHECK_EQUAL(view.cellCenterY[i], center.cmp[1]);
+		BOOST_CHECK_EQUAL(view.cellCenterZ[i], center.cmp[2]);
+		BOOST_CHECK_EQUAL(view.cellVolume[i], mesh->getCellVolume(i));
+
+		BOOST_CHECK_EQUAL(soaView.cellVolume[i], view.cellVolume[i]);
+	}
+
+	mesh->kernelView.reset();
+	BOOST_CHECK_EQUAL(mesh->kernelView.built, false);
+	BOOST_CHECK(mesh->kernelView.faceCell1 == nullptr);
+	BOOST_CHECK(mesh->kernelView.cellVolume == nullptr);
+
+	delete mesh;
+	delete soaMesh;
+}
+
+// === reorderCells ===
+// Test 1: Renumbering the cells and faces during finalize keeps the same data for every
+// cell and face label, for each reordering type and both mesh layouts
+template <class M>
+void checkReorderedMesh(M& mesh, CupCfdAoSMesh<int,double,int>& reference, MeshReorderType type) {
+	BOOST_CHECK_EQUAL(mesh.reordering.type, type);
+	BOOST_CHECK_EQUAL(mesh.reordering.applied, true);
+	BOOST_CHECK(mesh.reordering.cellBandwidthAfter > 0.0);
+
+	BOOST_REQUIRE_EQUAL(mesh.properties.lTCells, reference.properties.lTCells);
+	BOOST_REQUIRE_EQUAL(mesh.properties.lOCells, reference.properties.lOCells);
+	BOOST_REQUIRE_EQUAL(mesh.properties.lFaces, reference.properties.lFaces);
+
+	int nCells = mesh.properties.lTCells;
+	int nFaces = mesh.properties.lFaces;
+
+	// Cells
+	for(auto it = reference.cellBuildIDToLocalID.begin(); it != reference.cellBuildIDToLocalID.end(); it++) {
+		int cellID = mesh.cellBuildIDToLocalID[it->first];
+		BOOST_REQUIRE(cellID >= 0 && cellID < nCells);
+
+		// The mesh local IDs match the connectivity graph
+		BOOST_CHECK_EQUAL(mesh.cellConnGraph->connGraph.IDXToNode[cellID], it->first);
+
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> center = mesh.getCellCenter(cellID);
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> refCenter = reference.getCellCenter(it->second);
+
+		for(int d = 0; d < 3; d++) {
+			BOOST_CHECK_EQUAL(center.cmp[d], refCenter.cmp[d]);
+		}
+
+		BOOST_CHECK_EQUAL(mesh.getCellVolume(cellID), reference.getCellVolume(it->second));
+		BOOST_CHECK_EQUAL(mesh.getCellNFaces(cellID), reference.getCellNFaces(it->second));
+	}
+
+	// Faces
+	int lastCell = -1;
+	for(auto it = reference.faceBuildIDToLocalID.begin(); it != reference.faceBuildIDToLocalID.end(); it++) {
+		int faceID = mesh.faceBuildIDToLocalID[it->first];
+		int refFaceID = it->second;
+		BOOST_REQUIRE(faceID >= 0 && faceID < nFaces);
+
+		BOOST_CHECK_EQUAL(mesh.getFaceArea(faceID), reference.getFaceArea(refFaceID));
+		BOOST_CHECK_EQUAL(mesh.getFaceIsBoundary(faceID), reference.getFaceIsBoundary(refFaceID));
+
+		int cell1 = mesh.getFaceCell1ID(faceID);
+		int refCell1 = reference.getFaceCell1ID(refFaceID);
+		BOOST_CHECK_EQUAL(mesh.cellConnGraph->connGraph.IDXToNode[cell1], reference.cellConnGraph->connGraph.IDXToNode[refCell1]);
+
+		if(mesh.getFaceIsBoundary(faceID)) {
+			int boundaryID = mesh.getFaceBoundaryID(faceID);
+			BOOST_CHECK_EQUAL(mesh.getBoundaryFaceID(boundaryID), faceID);
+		}
+		else {
+			int cell2 = mesh.getFaceCell2ID(faceID);
+			int refCell2 = reference.getFaceCell2ID(refFaceID);
+			BOOST_CHECK_EQUAL(mesh.cellConnGraph->connGraph.IDXToNode[cell2], reference.cellConnGraph->connGraph.IDXToNode[refCell2]);
+		}
+	}
+
+	// Faces are grouped by their lower numbered cell
+	for(int i = 0; i < nFaces; i++) {
+		int cell = mesh.getFaceCell1ID(i);
+		if(!mesh.getFaceIsBoundary(i)) {
+			cell = std::min(cell, mesh.getFaceCell2ID(i));
+		}
+
+		BOOST_CHECK(cell >= lastCell);
+		lastCell = cell;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(reorderCells_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	// No reordering by default
+	BOOST_CHECK_EQUAL(meshConfig.getReorderType(), MESH_REORDER_NONE);
+
+	CupCfdAoSMesh<int,double,int> * reference;
+	status = meshConfig.buildUnstructuredMesh(&reference, comm);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(reference->reordering.type, MESH_REORDER_NONE);
+	BOOST_CHECK_EQUAL(reference->reordering.applied, false);
+	BOOST_CHECK_EQUAL(reference->reordering.cellBandwidthBefore, reference->reordering.cellBandwidthAfter);
+
+	MeshReorderType types[3] = {MESH_REORDER_RCM, MESH_REORDER_MORTON, MESH_REORDER_HILBERT};
+
+	for(int t = 0; t < 3; t++) {
+		meshConfig.setReorderType(types[t]);
+
+		CupCfdAoSMesh<int,double,int> * mesh;
+		status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+		BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+		checkReorderedMesh(*mesh, *reference, types[t]);
+		BOOST_CHECK_EQUAL(mesh->reordering.cellBandwidthBefore, reference->reordering.cellBandwidthBefore);
+
+		CupCfdSoAMesh<int,double,int> * soaMesh;
+		status = meshConfig.buildUnstructuredMesh(&soaMesh, comm);
+		BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+		checkReorderedMesh(*soaMesh, *reference, types[t]);
+
+		delete mesh;
+		delete soaMesh;
+	}
+
+	delete reference;
+}
+
 BOOST_AUTO_TEST_CASE(cleanup)
 {
     MPI_Finalize();
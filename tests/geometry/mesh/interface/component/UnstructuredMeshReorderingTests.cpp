@@ -0,0 +1,321 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the UnstructuredMeshReordering Class and the cell ordering methods
+ */
+
+#define BOOST_TEST_MODULE UnstructuredMeshReordering
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "UnstructuredMeshReordering.h"
+#include "Error.h"
+
+using namespace cupcfd::geometry::mesh;
+
+// Build the CSR graph of an nx * ny 2D grid, with the nodes numbered in a shuffled order
+void buildShuffledGrid(int nx, int ny, std::vector<int>& xadj, std::vector<int>& adjncy, std::vector<int>& label) {
+	int nNodes = nx * ny;
+
+	// label[n] is the node index of grid position n. 7 is coprime with the grid sizes used.
+	label.resize(nNodes);
+	for(int n = 0; n < nNodes; n++) {
+		label[n] = (n * 7) % nNodes;
+	}
+
+	std::vector<std::vector<int>> adj(nNodes);
+	for(int j = 0; j < ny; j++) {
+		for(int i = 0; i < nx; i++) {
+			int n = j * nx + i;
+
+			if(i > 0) {
+				adj[label[n]].push_back(label[n - 1]);
+			}
+			if(i < nx - 1) {
+				adj[label[n]].push_back(label[n + 1]);
+			}
+			if(j > 0) {
+				adj[label[n]].push_back(label[n - nx]);
+			}
+			if(j < ny - 1) {
+				adj[label[n]].push_back(label[n + nx]);
+			}
+		}
+	}
+
+	xadj.clear();
+	adjncy.clear();
+	xadj.push_back(0);
+	for(int n = 0; n < nNodes; n++) {
+		adjncy.insert(adjncy.end(), adj[n].begin(), adj[n].end());
+		xadj.push_back(adjncy.size());
+	}
+}
+
+// Check that order is a permutation of 0..n-1
+void checkPermutation(std::vector<int>& order) {
+	std::vector<int> count(order.size(), 0);
+
+	for(std::size_t i = 0; i < order.size(); i++) {
+		BOOST_REQUIRE(order[i] >= 0 && order[i] < int(order.size()));
+		count[order[i]]++;
+	}
+
+	for(std::size_t i = 0; i < order.size(); i++) {
+		BOOST_CHECK_EQUAL(count[i], 1);
+	}
+}
+
+// Apply an ordering to a CSR graph
+void applyOrder(std::vector<int>& order, std::vector<int>& xadj, std::vector<int>& adjncy,
+				std::vector<int>& newXAdj, std::vector<int>& newAdjncy) {
+	std::vector<int> newID(order.size());
+	for(std::size_t i = 0; i < order.size(); i++) {
+		newID[order[i]] = i;
+	}
+
+	newXAdj.clear();
+	newAdjncy.clear();
+	newXAdj.push_back(0);
+	for(std::size_t i = 0; i < order.size(); i++) {
+		for(int j = xadj[order[i]]; j < xadj[order[i] + 1]; j++) {
+			newAdjncy.push_back(newID[adjncy[j]]);
+		}
+		newXAdj.push_back(newAdjncy.size());
+	}
+}
+
+// === Constructors ===
+// Test 1: Test Default Constructor
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	UnstructuredMeshReordering<int, double> reordering;
+
+	BOOST_CHECK_EQUAL(reordering.type, MESH_REORDER_NONE);
+	BOOST_CHECK_EQUAL(reordering.applied, false);
+	BOOST_CHECK_EQUAL(reordering.cellBandwidthBefore, 0.0);
+	BOOST_CHECK_EQUAL(reordering.cellBandwidthAfter, 0.0);
+}
+
+// === reset ===
+// Test 1: Reset returns to the unapplied state but keeps the type
+BOOST_AUTO_TEST_CASE(reset_test1)
+{
+	UnstructuredMeshReordering<int, double> reordering;
+
+	reordering.type = MESH_REORDER_HILBERT;
+	reordering.applied = true;
+	reordering.cellBandwidthBefore = 4.0;
+	reordering.cellBandwidthAfter = 2.0;
+
+	reordering.reset();
+
+	BOOST_CHECK_EQUAL(reordering.type, MESH_REORDER_HILBERT);
+	BOOST_CHECK_EQUAL(reordering.applied, false);
+	BOOST_CHECK_EQUAL(reordering.cellBandwidthBefore, 0.0);
+	BOOST_CHECK_EQUAL(reordering.cellBandwidthAfter, 0.0);
+}
+
+// === computeGraphBandwidth ===
+// Test 1: Mean bandwidth of a path graph, with an edge to a node outside of the range
+BOOST_AUTO_TEST_CASE(computeGraphBandwidth_test1)
+{
+	cupcfd::error::eCodes status;
+
+	// 0 - 2 - 1, with an edge from 1 to node 3 that is not counted
+	int xadj[4] = {0, 1, 3, 5};
+	int adjncy[5] = {2, 2, 3, 0, 1};
+	double bandwidth;
+
+	status = computeGraphBandwidth(xadj, 4, adjncy, 5, 3, &bandwidth);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Edges 0-2 (2), 1-2 (1), each counted in both directions
+	BOOST_CHECK_EQUAL(bandwidth, 1.5);
+}
+
+// Test 2: Error if xadj is too small
+BOOST_AUTO_TEST_CASE(computeGraphBandwidth_test2)
+{
+	cupcfd::error::eCodes status;
+
+	int xadj[3] = {0, 1, 2};
+	int adjncy[2] = {1, 0};
+	double bandwidth;
+
+	status = computeGraphBandwidth(xadj, 3, adjncy, 2, 3, &bandwidth);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_UNDERSIZED);
+}
+
+// === computeOrderingRCM ===
+// Test 1: The ordering of a shuffled grid is a permutation that reduces the bandwidth
+BOOST_AUTO_TEST_CASE(computeOrderingRCM_test1)
+{
+	cupcfd::error::eCodes status;
+	std::vector<int> xadj, adjncy, label;
+	buildShuffledGrid(8, 6, xadj, adjncy, label);
+	int nNodes = 48;
+
+	std::vector<int> order(nNodes);
+	status = computeOrderingRCM(xadj.data(), int(xadj.size()), adjncy.data(), int(adjncy.size()), order.data(), nNodes);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkPermutation(order);
+
+	std::vector<int> newXAdj, newAdjncy;
+	applyOrder(order, xadj, adjncy, newXAdj, newAdjncy);
+
+	double before, after;
+	status = computeGraphBandwidth(xadj.data(), int(xadj.size()), adjncy.data(), int(adjncy.size()), nNodes, &before);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = computeGraphBandwidth(newXAdj.data(), int(newXAdj.size()), newAdjncy.data(), int(newAdjncy.size()), nNodes, &after);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK(after < before);
+
+	// Starting from a corner, the level sets are the grid diagonals (at most 6 nodes), and neighbours are
+	// always in the same or adjacent level sets, so no edge can span more than two level sets
+	for(int i = 0; i < nNodes; i++) {
+		for(int j = newXAdj[i]; j < newXAdj[i + 1]; j++) {
+			BOOST_CHECK(std::abs(newAdjncy[j] - i) <= 11);
+		}
+	}
+}
+
+// Test 2: Disconnected nodes are still included
+BOOST_AUTO_TEST_CASE(computeOrderingRCM_test2)
+{
+	cupcfd::error::eCodes status;
+
+	// 0 - 1, 2 isolated
+	int xadj[4] = {0, 1, 2, 2};
+	int adjncy[2] = {1, 0};
+	std::vector<int> order(3);
+
+	status = computeOrderingRCM(xadj, 4, adjncy, 2, order.data(), 3);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkPermutation(order);
+}
+
+// Test 3: Error if xadj is too small
+BOOST_AUTO_TEST_CASE(computeOrderingRCM_test3)
+{
+	cupcfd::error::eCodes status;
+
+	int xadj[2] = {0, 1};
+	int adjncy[1] = {1};
+	int order[2];
+
+	status = computeOrderingRCM(xadj, 2, adjncy, 1, order, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_UNDERSIZED);
+}
+
+// === computeOrderingMorton ===
+// Test 1: Points on a 2x2x2 lattice are ordered in Z-order
+BOOST_AUTO_TEST_CASE(computeOrderingMorton_test1)
+{
+	cupcfd::error::eCodes status;
+
+	// Points stored in reverse Z-order, z varying fastest in the Morton key
+	double x[8], y[8], z[8];
+	for(int n = 0; n < 8; n++) {
+		int m = 7 - n;
+		x[n] = (m >> 2) & 1;
+		y[n] = (m >> 1) & 1;
+		z[n] = m & 1;
+	}
+
+	int order[8];
+	status = computeOrderingMorton(x, y, z, 8, order, 8);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < 8; i++) {
+		BOOST_CHECK_EQUAL(order[i], 7 - i);
+	}
+}
+
+// Test 2: Error if the sizes do not match
+BOOST_AUTO_TEST_CASE(computeOrderingMorton_test2)
+{
+	cupcfd::error::eCodes status;
+
+	double x[2] = {0.0, 1.0};
+	int order[3];
+
+	status = computeOrderingMorton(x, x, x, 2, order, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+}
+
+// === computeOrderingHilbert ===
+// Test 1: Consecutive points along the curve over a 4x4x4 lattice are always neighbours
+BOOST_AUTO_TEST_CASE(computeOrderingHilbert_test1)
+{
+	cupcfd::error::eCodes status;
+
+	std::vector<double> x, y, z;
+	for(int n = 0; n < 64; n++) {
+		// Shuffle the storage order
+		int m = (n * 37) % 64;
+		x.push_back(m % 4);
+		y.push_back((m / 4) % 4);
+		z.push_back(m / 16);
+	}
+
+	std::vector<int> order(64);
+	status = computeOrderingHilbert(x.data(), y.data(), z.data(), 64, order.data(), 64);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+	checkPermutation(order);
+
+	for(int i = 1; i < 64; i++) {
+		double dist = std::abs(x[order[i]] - x[order[i-1]]) +
+					  std::abs(y[order[i]] - y[order[i-1]]) +
+					  std::abs(z[order[i]] - z[order[i-1]]);
+		BOOST_CHECK_EQUAL(dist, 1.0);
+	}
+}
+
+// Test 2: Identical points are ordered by their current index
+BOOST_AUTO_TEST_CASE(computeOrderingHilbert_test2)
+{
+	cupcfd::error::eCodes status;
+
+	double x[3] = {1.0, 1.0, 1.0};
+	int order[3];
+
+	status = computeOrderingHilbert(x, x, x, 3, order, 3);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	BOOST_CHECK_EQUAL(order[0], 0);
+	BOOST_CHECK_EQUAL(order[1], 1);
+	BOOST_CHECK_EQUAL(order[2], 2);
+}
+
+// === computeFaceOrderingByCell ===
+// Test 1: Faces are grouped by their lower cell, then by their other cell with boundaries first
+BOOST_AUTO_TEST_CASE(computeFaceOrderingByCell_test1)
+{
+	cupcfd::error::eCodes status;
+
+	int cell1[5] = {2, 1, 0, 0, 2};
+	int cell2[5] = {0, 2, -1, 1, -1};
+	int order[5];
+
+	status = computeFaceOrderingByCell(cell1, cell2, 5, order, 5);
+	BOOST_REQUIRE_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// (0,-1), (0,1), (0,2), (1,2), (2,-1)
+	BOOST_CHECK_EQUAL(order[0], 2);
+	BOOST_CHECK_EQUAL(order[1], 3);
+	BOOST_CHECK_EQUAL(order[2], 0);
+	BOOST_CHECK_EQUAL(order[3], 1);
+	BOOST_CHECK_EQUAL(order[4], 4);
+}
@@ -16,10 +16,12 @@
 #include <stdexcept>
 #include <string>
 #include <iostream>
+#include <vector>
 
 #include "HDF5Access.h"
 #include "HDF5Properties.h"
 #include "HDF5Record.h"
+#include "HDF5File.h"
 
 // Note: Three separate classes are tested here, since the current design has a bit
 // of an interdependence between them. It would be good to resolve this at some point
@@ -386,7 +388,36 @@ BOOST_AUTO_TEST_CASE(readData_indexed_test1)
 // Test 2: Read 2D integer array from indexes in a 2D integer dataset
 BOOST_AUTO_TEST_CASE(readData_indexed_test2)
 {
+	HDF5Record record("/TestGroup1", "TestDataSetInt2D", false);
+	HDF5Access access("../tests/io/data/TestReadSource.h5", record);
+	HDF5Properties properties(access);
+
+	BOOST_REQUIRE_EQUAL(properties.ndim, 2);
+	BOOST_REQUIRE_EQUAL(properties.dim[0], 20);
+	BOOST_REQUIRE_EQUAL(properties.dim[1], 4);
+
+	// A run down one column, then two whole rows
+	properties.addIndex(2, 1);
+	properties.addIndex(3, 1);
+	properties.addIndex(4, 1);
+	properties.addIndex(10, 0);
+	properties.addIndex(10, 1);
+	properties.addIndex(10, 2);
+	properties.addIndex(10, 3);
+	properties.addIndex(11, 0);
+	properties.addIndex(11, 1);
+	properties.addIndex(11, 2);
+	properties.addIndex(11, 3);
+
+	int result[11];
+
+	cupcfd::error::eCodes status;
+	status = access.readData(result, properties);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
 
+	int cmp[11] = {109, 113, 117, 140, 141, 142, 143, 144, 145, 146, 147};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(result, result + 11, cmp, cmp + 11);
 }
 
 // Test 3: Read 1D integer array from indexes in a 1D float dataset (while identifying loss of precision)
@@ -427,6 +458,157 @@ BOOST_AUTO_TEST_CASE(readData_indexed_test2)
 // Test 18: Read 2D double array from indexes in a 2D double dataset (while identifying loss of precision)
 
 
+// === HDF5Access - readData + properties, unsorted and empty index lists ===
+
+// Test 1: Indexes out of order and with duplicates are returned in the requested order
+BOOST_AUTO_TEST_CASE(readData_indexed_unsorted_test1)
+{
+	HDF5Record record("/TestGroup1", "TestDataSetInt1D", false);
+	HDF5Access access("../tests/io/data/TestReadSource.h5", record);
+	HDF5Properties properties(access);
+
+	unsigned long long indexes[8] = {9, 3, 4, 5, 3, 19, 0, 9};
+
+	for(int i = 0; i < 8; i++)
+	{
+		properties.addIndex(indexes[i]);
+	}
+
+	int result[8];
+
+	cupcfd::error::eCodes status;
+	status = access.readData(result, properties);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int cmp[8] = {9, 3, 4, 5, 3, 19, 0, 9};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(result, result + 8, cmp, cmp + 8);
+}
+
+// Test 2: Selecting no indexes reads nothing, rather than the whole dataset
+BOOST_AUTO_TEST_CASE(readData_indexed_none_test1)
+{
+	HDF5Record record("/TestGroup1", "TestDataSetInt1D", false);
+	HDF5Access access("../tests/io/data/TestReadSource.h5", record);
+	HDF5Properties properties(access);
+
+	properties.selectNone();
+
+	int result[2] = {-1, -1};
+
+	cupcfd::error::eCodes status;
+	status = access.readData(result, properties);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	int cmp[2] = {-1, -1};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(result, result + 2, cmp, cmp + 2);
+}
+
+// === coalesceHyperslabBlocks ===
+
+// Test 1: Runs of 1D indexes are merged into blocks
+BOOST_AUTO_TEST_CASE(coalesceHyperslabBlocks_test1)
+{
+	std::vector<unsigned long long> dim = {20};
+	unsigned long long idx[7] = {0, 1, 2, 5, 7, 8, 19};
+
+	std::vector<unsigned long long> start;
+	std::vector<unsigned long long> count;
+	coalesceHyperslabBlocks(dim, idx, 7, start, count);
+
+	std::vector<unsigned long long> startCmp = {0, 5, 7, 19};
+	std::vector<unsigned long long> countCmp = {3, 1, 2, 1};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(start.begin(), start.end(), startCmp.begin(), startCmp.end());
+	BOOST_CHECK_EQUAL_COLLECTIONS(count.begin(), count.end(), countCmp.begin(), countCmp.end());
+}
+
+// Test 2: A run down a column of a 2D dataset is merged into a single block
+BOOST_AUTO_TEST_CASE(coalesceHyperslabBlocks_test2)
+{
+	std::vector<unsigned long long> dim = {20, 3};
+	unsigned long long idx[8] = {4, 2,
+								 5, 2,
+								 6, 2,
+								 9, 2};
+
+	std::vector<unsigned long long> start;
+	std::vector<unsigned long long> count;
+	coalesceHyperslabBlocks(dim, idx, 4, start, count);
+
+	std::vector<unsigned long long> startCmp = {4, 2, 9, 2};
+	std::vector<unsigned long long> countCmp = {3, 1, 1, 1};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(start.begin(), start.end(), startCmp.begin(), startCmp.end());
+	BOOST_CHECK_EQUAL_COLLECTIONS(count.begin(), count.end(), countCmp.begin(), countCmp.end());
+}
+
+// Test 3: Consecutive whole rows are merged into a single block, a partial row is kept separate
+BOOST_AUTO_TEST_CASE(coalesceHyperslabBlocks_test3)
+{
+	std::vector<unsigned long long> dim = {20, 3};
+	unsigned long long idx[16] = {1, 0, 1, 1, 1, 2,
+								  2, 0, 2, 1, 2, 2,
+								  3, 0, 3, 1};
+
+	std::vector<unsigned long long> start;
+	std::vector<unsigned long long> count;
+	coalesceHyperslabBlocks(dim, idx, 8, start, count);
+
+	std::vector<unsigned long long> startCmp = {1, 0, 3, 0};
+	std::vector<unsigned long long> countCmp = {2, 3, 1, 2};
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(start.begin(), start.end(), startCmp.begin(), startCmp.end());
+	BOOST_CHECK_EQUAL_COLLECTIONS(count.begin(), count.end(), countCmp.begin(), countCmp.end());
+}
+
+// === HDF5File ===
+
+// Test 1: Records opened through an open file share its handle, and their reads are recorded
+BOOST_AUTO_TEST_CASE(file_readStatistics_test1)
+{
+	HDF5File file("../tests/io/data/TestReadSource.h5");
+	cupcfd::error::eCodes status;
+
+	BOOST_CHECK(file.fileID >= 0);
+	BOOST_CHECK_EQUAL(file.collective, false);
+
+	{
+		HDF5Record record("/TestGroup1", "TestDataSetInt1D", false);
+		HDF5Access access(file, record);
+		BOOST_CHECK_EQUAL(access.fileID, file.fileID);
+
+		int result[20];
+		status = access.readData(result);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(result[19], 19);
+	}
+
+	{
+		HDF5Record record("/TestGroup1", "TestDataSetInt1D", false);
+		HDF5Access access(file, record);
+		HDF5Properties properties(access);
+		properties.addIndex(3);
+		properties.addIndex(4);
+
+		double result[2];
+		status = access.readData(result, properties);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(result[0], 3.0);
+		BOOST_CHECK_EQUAL(result[1], 4.0);
+	}
+
+	BOOST_CHECK_EQUAL(file.nReads, 2);
+	BOOST_CHECK_EQUAL(file.bytesRead, (20 * sizeof(int)) + (2 * sizeof(double)));
+	BOOST_CHECK(file.readTime >= 0.0);
+
+	file.resetStatistics();
+	BOOST_CHECK_EQUAL(file.nReads, 0);
+	BOOST_CHECK_EQUAL(file.bytesRead, 0);
+	BOOST_CHECK_EQUAL(file.getReadRate(), 0.0);
+}
+
 // === HDF5Access - readData int** sink + properties ===
 // Test reading from various data sources/types into a integer array
 // using indexes to access specific locations in the record.
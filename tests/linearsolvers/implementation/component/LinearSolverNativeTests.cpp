@@ -0,0 +1,460 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the LinearSolverNative class
+ */
+
+#define BOOST_TEST_MODULE LinearSolverNative
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+
+#include "Communicator.h"
+#include "LinearSolverNative.h"
+#include "Error.h"
+#include "SparseMatrixCOO.h"
+#include "SparseMatrixCSR.h"
+
+// ========================================
+// ============== Tests ===================
+// ========================================
+
+namespace utf = boost::unit_test;
+using namespace cupcfd::linearsolvers;
+
+// Set the rows rowStart to rowEnd - 1 of an 8x8 tridiagonal matrix with diag on the diagonal,
+// lower on the sub-diagonal and upper on the super-diagonal
+template <class M>
+void setTridiagonal(M& matrix, int rowStart, int rowEnd, double diag, double lower, double upper)
+{
+	cupcfd::error::eCodes status;
+
+	for(int row = rowStart; row < rowEnd; row++)
+	{
+		if(row > 0)
+		{
+			status = matrix.setElement(row, row - 1, lower);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+
+		status = matrix.setElement(row, row, diag);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		if(row < 7)
+		{
+			status = matrix.setElement(row, row + 1, upper);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+	}
+}
+
+// Setup
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+
+    MPI_Init(&argc, &argv);
+}
+
+// === Constructors ===
+// Test 1: Create a Serial Native Linear Solver
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	// This default to MPI_COMM_SELF
+	cupcfd::comm::Communicator comm;
+
+	cupcfd::data_structures::SparseMatrixCOO<int, double> matrix(8, 8, 0);
+	setTridiagonal(matrix, 0, 8, 2.0, -1.0, -1.0);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCOO<int, double>, int, double> solver(comm, NATIVE_SOLVER_CG, NATIVE_PC_NONE, 1E-8, 1E-8, 100, matrix);
+
+	BOOST_CHECK_EQUAL(solver.mLocal, 8);
+	BOOST_CHECK_EQUAL(solver.matrixASetup, true);
+	BOOST_CHECK_EQUAL(solver.vectorXSetup, true);
+	BOOST_CHECK_EQUAL(solver.vectorBSetup, true);
+	BOOST_CHECK_EQUAL(solver.distA->localA.nnz, 22);
+	BOOST_CHECK_EQUAL(solver.distA->ghostGlobalIDs.size(), 0);
+	BOOST_CHECK(solver.distA->haloPattern == nullptr);
+}
+
+// Test 2: Create a Parallel Native Linear Solver, and check the ghost columns of each rank
+BOOST_AUTO_TEST_CASE(constructor_test2)
+{
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(8, 8, 0);
+	setTridiagonal(matrix, comm.rank * 2, (comm.rank * 2) + 2, 2.0, -1.0, -1.0);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, NATIVE_SOLVER_CG, NATIVE_PC_NONE, 1E-8, 1E-8, 100, matrix);
+
+	int rangeCmp[5] = {0, 2, 4, 6, 8};
+	BOOST_CHECK_EQUAL_COLLECTIONS(rangeCmp, rangeCmp + 5, solver.rowRanges.begin(), solver.rowRanges.end());
+	BOOST_CHECK_EQUAL(solver.mLocal, 2);
+	BOOST_CHECK_EQUAL(solver.remoteRows, false);
+	BOOST_CHECK_EQUAL(solver.csrMapped, true);
+	BOOST_CHECK(solver.distA->haloPattern != nullptr);
+
+	if(comm.rank == 0)
+	{
+		int ghostCmp[1] = {2};
+		BOOST_CHECK_EQUAL_COLLECTIONS(ghostCmp, ghostCmp + 1, solver.distA->ghostGlobalIDs.begin(), solver.distA->ghostGlobalIDs.end());
+	}
+	else if(comm.rank == 3)
+	{
+		int ghostCmp[1] = {5};
+		BOOST_CHECK_EQUAL_COLLECTIONS(ghostCmp, ghostCmp + 1, solver.distA->ghostGlobalIDs.begin(), solver.distA->ghostGlobalIDs.end());
+	}
+	else
+	{
+		int ghostCmp[2] = {(comm.rank * 2) - 1, (comm.rank * 2) + 2};
+		BOOST_CHECK_EQUAL_COLLECTIONS(ghostCmp, ghostCmp + 2, solver.distA->ghostGlobalIDs.begin(), solver.distA->ghostGlobalIDs.end());
+	}
+
+	// Local columns come before the ghost columns in each row
+	int ghostStartCmp[2] = {2, (comm.rank == 0) ? 4 : 5};
+	BOOST_CHECK_EQUAL_COLLECTIONS(ghostStartCmp, ghostStartCmp + 2, solver.ghostStart.begin(), solver.ghostStart.end());
+}
+
+// === setValuesVectorX/getValuesVectorX ===
+// Test 1: Set values of rows owned by other ranks, and get the full vector on every rank
+BOOST_AUTO_TEST_CASE(set_getValuesVectorX_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(8, 8, 0);
+	setTridiagonal(matrix, comm.rank * 2, (comm.rank * 2) + 2, 2.0, -1.0, -1.0);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, NATIVE_SOLVER_CG, NATIVE_PC_NONE, 1E-8, 1E-8, 100, matrix);
+
+	int indexes[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+	double values[8] = {1.5, 2.5, 3.5, 4.5, 5.5, 6.5, 7.5, 8.5};
+
+	// Only rank 0 sets values, with a base index of 1
+	if(comm.rank == 0)
+	{
+		status = solver.setValuesVectorX(values, 8, indexes, 8, 1);
+	}
+	else
+	{
+		status = solver.setValuesVectorX(values, 0, indexes, 0, 1);
+	}
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double * vecX;
+	int nVecX;
+
+	status = solver.getValuesVectorX(&vecX, &nVecX);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(values, values + 8, vecX, vecX + nVecX);
+	free(vecX);
+
+	// Get a selection of indexes, including ones owned by other ranks
+	int getIndexes[3] = {7, 0, comm.rank * 2};
+	double cmp[3] = {8.5, 1.5, values[comm.rank * 2]};
+
+	status = solver.getValuesVectorX(&vecX, &nVecX, getIndexes, 3, 0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(cmp, cmp + 3, vecX, vecX + nVecX);
+	free(vecX);
+}
+
+// === solve ===
+// Test 1: Test that a serial CG solve runs without error on a diagonal matrix
+BOOST_AUTO_TEST_CASE(solve_test1, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm;
+
+	cupcfd::data_structures::SparseMatrixCOO<int, double> matrix(8, 8, 0);
+
+	for(int i = 0; i < 8; i++)
+	{
+		status = matrix.setElement(i, i, 0.1 * (i + 1));
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCOO<int, double>, int, double> solver(comm, NATIVE_SOLVER_CG, NATIVE_PC_NONE, 1E-8, 1E-8, 100, matrix);
+
+	status = solver.setValuesMatrixA(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.setValuesVectorB(0.1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.clearVectorX();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.solve();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(solver.converged, true);
+
+	double * vecX;
+	int nVecX;
+
+	status = solver.getValuesVectorX(&vecX, &nVecX);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double cmp[8] = {1, 0.5, 0.33333333333333337, 0.25, 0.2, 0.16666666666666669, 0.14285714285714288, 0.125};
+
+	for(int i = 0; i < 8; i++)
+	{
+		BOOST_TEST(cmp[i] == vecX[i]);
+	}
+
+	free(vecX);
+}
+
+// Test 2: Test a parallel CG solve of a 1D Laplacian with each preconditioner
+BOOST_AUTO_TEST_CASE(solve_test2, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(8, 8, 0);
+	setTridiagonal(matrix, comm.rank * 2, (comm.rank * 2) + 2, 2.0, -1.0, -1.0);
+
+	NativePreconditioner preconditioners[3] = {NATIVE_PC_NONE, NATIVE_PC_JACOBI, NATIVE_PC_BJACOBI_ILU0};
+	double cmp[8] = {4, 7, 9, 10, 10, 9, 7, 4};
+
+	for(int i = 0; i < 3; i++)
+	{
+		LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, NATIVE_SOLVER_CG, preconditioners[i], 1E-10, 1E-10, 100, matrix);
+
+		status = solver.setValuesMatrixA(matrix);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = solver.setValuesVectorB(1.0);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = solver.clearVectorX();
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = solver.solve();
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(solver.converged, true);
+
+		double * vecX;
+		int nVecX;
+
+		status = solver.getValuesVectorX(&vecX, &nVecX);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(nVecX, 8);
+
+		for(int j = 0; j < 8; j++)
+		{
+			BOOST_TEST(cmp[j] == vecX[j]);
+		}
+
+		free(vecX);
+	}
+}
+
+// Test 3: Test a parallel BiCGStab solve of a non-symmetric system with each preconditioner,
+// by checking the residual of the solution
+BOOST_AUTO_TEST_CASE(solve_test3, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(8, 8, 0);
+	setTridiagonal(matrix, comm.rank * 2, (comm.rank * 2) + 2, 3.0, -1.5, -0.5);
+
+	NativePreconditioner preconditioners[3] = {NATIVE_PC_NONE, NATIVE_PC_JACOBI, NATIVE_PC_BJACOBI_ILU0};
+	double b[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+	int indexes[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+	for(int i = 0; i < 3; i++)
+	{
+		LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, NATIVE_SOLVER_BICGSTAB, preconditioners[i], 1E-12, 1E-12, 100, matrix);
+
+		status = solver.setValuesMatrixA(matrix);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = solver.setValuesVectorB(b + (comm.rank * 2), 2, indexes + (comm.rank * 2), 2, 0);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = solver.clearVectorX();
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = solver.solve();
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(solver.converged, true);
+
+		double * vecX;
+		int nVecX;
+
+		status = solver.getValuesVectorX(&vecX, &nVecX);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		for(int row = 0; row < 8; row++)
+		{
+			double ax = 3.0 * vecX[row];
+
+			if(row > 0)
+			{
+				ax = ax - (1.5 * vecX[row - 1]);
+			}
+
+			if(row < 7)
+			{
+				ax = ax - (0.5 * vecX[row + 1]);
+			}
+
+			BOOST_TEST(ax == b[row]);
+		}
+
+		free(vecX);
+	}
+}
+
+// Test 4: Test a parallel solve where all matrix values are stored on one process, and that
+// new matrix values are picked up by later solves
+BOOST_AUTO_TEST_CASE(solve_test4, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::data_structures::SparseMatrixCOO<int, double> matrix(8, 8, 0);
+
+	if(comm.rank == 0)
+	{
+		setTridiagonal(matrix, 0, 8, 2.0, -1.0, -1.0);
+	}
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCOO<int, double>, int, double> solver(comm, NATIVE_SOLVER_CG, NATIVE_PC_BJACOBI_ILU0, 1E-10, 1E-10, 100, matrix);
+
+	BOOST_CHECK_EQUAL(solver.remoteRows, true);
+	BOOST_CHECK_EQUAL(solver.distA->localA.nnz, (comm.rank == 0 || comm.rank == 3) ? 5 : 6);
+
+	double cmp[8] = {4, 7, 9, 10, 10, 9, 7, 4};
+
+	// Solve twice, doubling the matrix values for the second solve
+	for(int solveCount = 1; solveCount <= 2; solveCount++)
+	{
+		if(comm.rank == 0)
+		{
+			setTridiagonal(matrix, 0, 8, 2.0 * solveCount, -1.0 * solveCount, -1.0 * solveCount);
+		}
+
+		status = solver.setValuesMatrixA(matrix);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = solver.setValuesVectorB(1.0);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = solver.clearVectorX();
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = solver.solve();
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		double * vecX;
+		int nVecX;
+
+		status = solver.getValuesVectorX(&vecX, &nVecX);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		for(int i = 0; i < 8; i++)
+		{
+			BOOST_TEST((cmp[i] / solveCount) == vecX[i]);
+		}
+
+		free(vecX);
+	}
+}
+
+// Test 5: Test that a solve with a zero diagonal fails for the Jacobi preconditioner
+BOOST_AUTO_TEST_CASE(solve_test5)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm;
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(8, 8, 0);
+	setTridiagonal(matrix, 0, 8, 2.0, -1.0, -1.0);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, NATIVE_SOLVER_CG, NATIVE_PC_JACOBI, 1E-10, 1E-10, 100, matrix);
+
+	status = matrix.setElement(3, 3, 0.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.setValuesMatrixA(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.solve();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX);
+}
+
+// Test 6: Test that a zero ILU(0) pivot on one process fails the solve on every process
+BOOST_AUTO_TEST_CASE(solve_test6)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(8, 8, 0);
+	setTridiagonal(matrix, comm.rank * 2, (comm.rank * 2) + 2, 2.0, -1.0, -1.0);
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, NATIVE_SOLVER_CG, NATIVE_PC_BJACOBI_ILU0, 1E-10, 1E-10, 100, matrix);
+
+	// Row 2 is the first row owned by rank 1, so its pivot is the diagonal value
+	if(comm.rank == 1)
+	{
+		status = matrix.setElement(2, 2, 0.0);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	status = solver.setValuesMatrixA(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.setValuesVectorB(1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.clearVectorX();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.solve();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX);
+}
+
+// Test 7: Test that an invalid matrix entry on one process fails setValuesMatrixA on every process
+// when the values are sent on to their owners
+BOOST_AUTO_TEST_CASE(setValuesMatrixA_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	cupcfd::data_structures::SparseMatrixCOO<int, double> matrix(8, 8, 0);
+
+	if(comm.rank == 0)
+	{
+		setTridiagonal(matrix, 0, 8, 2.0, -1.0, -1.0);
+	}
+
+	LinearSolverNative<cupcfd::data_structures::SparseMatrixCOO<int, double>, int, double> solver(comm, NATIVE_SOLVER_CG, NATIVE_PC_NONE, 1E-10, 1E-10, 100, matrix);
+
+	BOOST_CHECK_EQUAL(solver.remoteRows, true);
+
+	// Row 2 is owned by rank 1, and (2, 7) is not in the non-zero structure
+	cupcfd::data_structures::SparseMatrixCOO<int, double> badMatrix(8, 8, 0);
+
+	if(comm.rank == 1)
+	{
+		status = badMatrix.setElement(2, 7, 1.0);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	status = solver.setValuesMatrixA(badMatrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_LINEARSOLVER_INVALID_MATRIX);
+}
+
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    MPI_Finalize();
+}
@@ -19,6 +19,7 @@
 #include "LinearSolverPETSc.h"
 #include "Error.h"
 #include "SparseMatrixCOO.h"
+#include "SparseMatrixCSR.h"
 
 // ========================================
 // ============== Tests ===================
@@ -2117,6 +2118,120 @@ BOOST_AUTO_TEST_CASE(solve_test3, * utf::tolerance(0.00001))
 	}
 }
 
+// Test 4: Test that a CSR matrix whose rows match the PETSc ownership ranges is handed to PETSc directly,
+// and that new values are picked up by later solves
+BOOST_AUTO_TEST_CASE(solve_test4, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// Create a simple SparseMatrix, with each rank holding the rows PETSc will assign it
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(8, 8, 0);
+
+	for(int i = 0; i < 2; i++)
+	{
+		int row = (comm.rank * 2) + i;
+		status = matrix.setElement(row, row, 0.1 * (row + 1));
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	LinearSolverPETSc<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, PETSC_KSP_CGAMG, 1E-6, 1E-6, matrix);
+
+	BOOST_CHECK_EQUAL(solver.csrHandoff, true);
+
+	PetscInt rangeCmp[5] = {0, 2, 4, 6, 8};
+	BOOST_CHECK_EQUAL_COLLECTIONS(rangeCmp, rangeCmp + 5, solver.aRanges, solver.aRanges + 5);
+
+	double cmp[8] = {1, 0.5, 0.33333333333333337, 0.25, 0.2, 0.16666666666666669, 0.14285714285714288, 0.125};
+
+	// Solve twice, doubling the matrix values for the second solve
+	for(int solveCount = 1; solveCount <= 2; solveCount++)
+	{
+		for(int i = 0; i < 2; i++)
+		{
+			int row = (comm.rank * 2) + i;
+			status = matrix.setElement(row, row, 0.1 * (row + 1) * solveCount);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+
+		status = solver.setValuesMatrixA(matrix);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = solver.setValuesVectorB(0.1);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = solver.clearVectorX();
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = solver.solve();
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		double * vecX;
+		int nVecX;
+
+		status = solver.getValuesVectorX(&vecX, &nVecX);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		for(int i = 0; i < 8; i++)
+		{
+			BOOST_TEST((cmp[i] / solveCount) == vecX[i]);
+		}
+
+		free(vecX);
+	}
+}
+
+// Test 5: Test that a CSR matrix with all rows on one process is preallocated and solved
+// without the direct handoff
+BOOST_AUTO_TEST_CASE(solve_test5, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// Create a simple SparseMatrix
+	cupcfd::data_structures::SparseMatrixCSR<int, double> matrix(8, 8, 0);
+
+	if(comm.rank == 0)
+	{
+		for(int i = 0; i < 8; i++)
+		{
+			status = matrix.setElement(i, i, 0.1 * (i + 1));
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+	}
+
+	LinearSolverPETSc<cupcfd::data_structures::SparseMatrixCSR<int, double>, int, double> solver(comm, PETSC_KSP_CGAMG, 1E-6, 1E-6, matrix);
+
+	BOOST_CHECK_EQUAL(solver.csrHandoff, false);
+
+	status = solver.setValuesMatrixA(matrix);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.setValuesVectorB(0.1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.clearVectorX();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = solver.solve();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double * vecX;
+	int nVecX;
+
+	status = solver.getValuesVectorX(&vecX, &nVecX);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	double cmp[8] = {1, 0.5, 0.33333333333333337, 0.25, 0.2, 0.16666666666666669, 0.14285714285714288, 0.125};
+
+	for(int i = 0; i < 8; i++)
+	{
+		BOOST_TEST(cmp[i] == vecX[i]);
+	}
+
+	free(vecX);
+}
+
 BOOST_AUTO_TEST_CASE(cleanup)
 {
 	PetscFinalize();
@@ -712,6 +712,65 @@ BOOST_AUTO_TEST_CASE(updateNonBoundaryFace_test3, * utf::tolerance(0.00001))
 	}
 }
 
+// Test 4: Test that the cached local cell ID follows the global cell ID, including into a ghost cell
+BOOST_AUTO_TEST_CASE(updateNonBoundaryFace_test4, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// === Create a small test mesh ===
+	// Setup the configurations
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	// Build the mesh
+	cupcfd::geometry::mesh::CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	if(comm.rank == 0)
+	{
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> pos(0.97, 0.86, 0.121);
+		cupcfd::geometry::euclidean::EuclideanVector<double,3> velocity(0.0, 0.0, 1.0);
+		cupcfd::geometry::euclidean::EuclideanVector<double,3> acceleration(0.0, 0.0, 0.0);
+		cupcfd::geometry::euclidean::EuclideanVector<double,3> jerk(0.0, 0.0, 0.0);
+		uint pID=0, cellID=24, rank=0;
+		ParticleSimple<int,double> particle(pos, velocity, acceleration, jerk, pID, cellID, rank, 0.0, 1.0, 0.3);
+
+		// Not resolved until the particle is used with a mesh
+		BOOST_CHECK_EQUAL(particle.getCellLocalID(), -1);
+
+		int cell24LocalID, cell49LocalID;
+		status = mesh->cellConnGraph->connGraph.getNodeLocalIndex(mesh->cellConnGraph->globalToNode[24], &cell24LocalID);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		status = mesh->cellConnGraph->connGraph.getNodeLocalIndex(mesh->cellConnGraph->globalToNode[49], &cell49LocalID);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		double dt;
+		int localFaceID;
+		status = particle.updatePositionAtomic(*mesh, &dt, &localFaceID, false);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(particle.getCellLocalID(), cell24LocalID);
+
+		status = particle.updateNonBoundaryFace(*mesh, localFaceID);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(particle.getCellGlobalID(), 49);
+		BOOST_CHECK_EQUAL(particle.getCellLocalID(), cell49LocalID);
+		BOOST_TEST(particle.getCellLocalID() >= mesh->properties.lOCells);
+
+		// Copies carry the cached ID with them
+		ParticleSimple<int,double> copy;
+		copy = particle;
+		BOOST_CHECK_EQUAL(copy.getCellLocalID(), cell49LocalID);
+
+		// Resolving again from the global IDs gives the same result
+		status = copy.resolveCellLocalID(*mesh);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		BOOST_CHECK_EQUAL(copy.getCellLocalID(), cell49LocalID);
+	}
+}
+
 // === updateBoundaryFaceWall ===
 BOOST_AUTO_TEST_CASE(updateBoundaryFaceWall_test1, * utf::tolerance(0.00001))
 {
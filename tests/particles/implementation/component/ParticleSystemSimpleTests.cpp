@@ -19,6 +19,7 @@
 #include "EuclideanPoint.h"
 #include "PartitionerConfig.h"
 #include "PartitionerNaiveConfig.h"
+#include "PartitionerRCBConfig.h"
 #include "MeshSourceStructGenConfig.h"
 #include "MeshConfig.h"
 #include "CupCfdAoSMesh.h"
@@ -29,6 +30,7 @@
 #include <memory>
 #include "ParticleSimple.h"
 #include "ParticleSystemSimple.h"
+#include "Reduce.h"
 
 namespace utf = boost::unit_test;
 namespace euc = cupcfd::geometry::euclidean;
@@ -243,6 +245,78 @@ BOOST_AUTO_TEST_CASE(removeInactiveParticles_test1, * utf::tolerance(0.00001))
 	BOOST_TEST(system.particles[2].pos.cmp[0] == 0.16);
 }
 
+// Test 2: Inactive particles at the start and end of the system, no inactive particles, and all inactive particles
+BOOST_AUTO_TEST_CASE(removeInactiveParticles_test2, * utf::tolerance(0.00001))
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// === Create a small test mesh ===
+	// Setup the configurations
+	cupcfd::partitioner::PartitionerNaiveConfig<int,int> partConfig;
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	// Build the mesh
+	cupcfd::geometry::mesh::CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	std::shared_ptr<meshgeo::CupCfdAoSMesh<int,double,int>> meshPtr(mesh);
+
+	// Create the particle system
+	ParticleSystemSimple<meshgeo::CupCfdAoSMesh<int,double,int>, int, double, int> system(meshPtr);
+
+	cupcfd::geometry::euclidean::EuclideanVector<double,3> velocity1(1.0, 1.1, 1.2);
+	cupcfd::geometry::euclidean::EuclideanVector<double,3> acceleration1(0.0, 0.0, 0.0);
+	cupcfd::geometry::euclidean::EuclideanVector<double,3> jerk1(0.0, 0.0, 0.0);
+
+	uint cellID=0, rank=0;
+	for(int i = 0; i < 6; i++) {
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> pos(0.1 + (i * 0.01), 0.11, 0.14);
+		ParticleSimple<int,double> particle(pos, velocity1, acceleration1, jerk1, i, cellID, rank, 1000.0, 0.0, 0.0);
+		status = system.addParticle(particle);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	// Set the first, last and a middle particle to inactive
+	status = system.setParticleInactive(0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = system.setParticleInactive(3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	status = system.setParticleInactive(5);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = system.removeInactiveParticles();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(system.getNParticles(), 3);
+	BOOST_CHECK_EQUAL(system.getNActiveParticles(), 3);
+
+	// Remaining particles keep their order
+	BOOST_CHECK_EQUAL(system.particles[0].getParticleID(), 1);
+	BOOST_CHECK_EQUAL(system.particles[1].getParticleID(), 2);
+	BOOST_CHECK_EQUAL(system.particles[2].getParticleID(), 4);
+	BOOST_TEST(system.particles[0].pos.cmp[0] == 0.11);
+	BOOST_TEST(system.particles[1].pos.cmp[0] == 0.12);
+	BOOST_TEST(system.particles[2].pos.cmp[0] == 0.14);
+
+	// Nothing inactive - no change
+	status = system.removeInactiveParticles();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(system.getNParticles(), 3);
+	BOOST_CHECK_EQUAL(system.particles[2].getParticleID(), 4);
+
+	// Everything inactive - system is emptied
+	for(int i = 0; i < 3; i++) {
+		status = system.setParticleInactive(i);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	}
+
+	status = system.removeInactiveParticles();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(system.getNParticles(), 0);
+	BOOST_CHECK_EQUAL(system.getNActiveParticles(), 0);
+}
+
 // === generateEmitterParticles ===
 
 
@@ -549,6 +623,117 @@ BOOST_AUTO_TEST_CASE(updateSystem_test3, * utf::tolerance(0.00001))
 	}
 }
 
+// === rebalance ===
+// Test 1: Every particle and emitter follows its cell to the new distribution of the mesh
+BOOST_AUTO_TEST_CASE(rebalance_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	// === Create a small test mesh ===
+	// Setup the configurations. The repartition weights cells by their load, so needs a partitioner
+	// that supports node weights.
+	cupcfd::partitioner::PartitionerRCBConfig<int,int> partConfig;
+	cupcfd::geometry::mesh::MeshSourceStructGenConfig<int, double> meshSourceConfig(5, 5, 5, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0);
+	cupcfd::geometry::mesh::MeshConfig<int,double,int> meshConfig(partConfig, meshSourceConfig);
+
+	// Build the mesh
+	cupcfd::geometry::mesh::CupCfdAoSMesh<int,double,int> * mesh;
+	status = meshConfig.buildUnstructuredMesh(&mesh, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	std::shared_ptr<meshgeo::CupCfdAoSMesh<int,double,int>> meshPtr(mesh);
+
+	// Create the particle system
+	ParticleSystemSimple<meshgeo::CupCfdAoSMesh<int,double,int>, int, double, int> system(meshPtr);
+
+	// Rank 0 has four particles in each of its cells, so it holds all of the load. The particle ID
+	// records the label of the cell the particle is in.
+	cupcfd::geometry::euclidean::EuclideanVector<double,3> velocity(0.0, 0.0, 0.0);
+	cupcfd::geometry::euclidean::EuclideanVector<double,3> acceleration(0.0, 0.0, 0.0);
+	cupcfd::geometry::euclidean::EuclideanVector<double,3> jerk(0.0, 0.0, 0.0);
+
+	int emitterLabel = -1;
+
+	for(auto iter = mesh->cellBuildIDToLocalID.begin(); iter != mesh->cellBuildIDToLocalID.end(); iter++) {
+		int label = iter->first;
+		int localID = iter->second;
+
+		if(localID >= mesh->properties.lOCells) {
+			continue;
+		}
+
+		int globalID = mesh->cellConnGraph->nodeToGlobal[label];
+		cupcfd::geometry::euclidean::EuclideanPoint<double,3> center;
+		mesh->getCellCenter(localID, center);
+
+		if(comm.rank == 0) {
+			for(int k = 0; k < 4; k++) {
+				ParticleSimple<int,double> particle(center, velocity, acceleration, jerk, label * 4 + k, globalID, 0, 1000.0, 0.0, 0.0);
+				status = system.addParticle(particle);
+				BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+			}
+		}
+
+		// Each process has an emitter in one of its cells
+		if(emitterLabel == -1) {
+			emitterLabel = label;
+
+			dist::DistributionFixed<int,double> rate(2.3);
+			ParticleEmitterSimple<int,double> emitter(localID, globalID, comm.rank, comm.rank, center, &rate, &rate, &rate, &rate,
+													  &rate, &rate, &rate, &rate, &rate, &rate, &rate, &rate);
+			status = system.addParticleEmitter(emitter);
+			BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+		}
+	}
+
+	int nParticles = system.getNParticles();
+	int nGlobalParticles;
+	status = cupcfd::comm::allReduceAdd(&nParticles, 1, &nGlobalParticles, 1, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// Test and Check
+	status = system.rebalance(meshConfig, 1.0);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// No particles are lost or duplicated
+	nParticles = system.getNParticles();
+	int nRebalancedParticles;
+	status = cupcfd::comm::allReduceAdd(&nParticles, 1, &nRebalancedParticles, 1, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nRebalancedParticles, nGlobalParticles);
+	BOOST_CHECK_EQUAL(system.getNActiveParticles(), nParticles);
+
+	// The cells with particles are spread over the processes
+	if(comm.rank == 0 && comm.size > 1) {
+		BOOST_CHECK(nParticles < nGlobalParticles);
+	}
+
+	// Every cell is owned by exactly one process
+	int nOwnedCells = system.mesh->properties.lOCells;
+	int nGlobalOwnedCells;
+	status = cupcfd::comm::allReduceAdd(&nOwnedCells, 1, &nGlobalOwnedCells, 1, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(nGlobalOwnedCells, 125);
+
+	// Each particle is on the process that now owns its cell
+	for(int i = 0; i < nParticles; i++) {
+		int localID = system.particles[i].getCellLocalID();
+		BOOST_CHECK(localID >= 0);
+		BOOST_CHECK(localID < nOwnedCells);
+		BOOST_CHECK_EQUAL(system.particles[i].getRank(), comm.rank);
+		BOOST_CHECK_EQUAL(system.mesh->cellConnGraph->globalToNode[system.particles[i].getCellGlobalID()],
+						  system.particles[i].getParticleID() / 4);
+	}
+
+	// The emitters stay on their process, in the same cell
+	BOOST_CHECK_EQUAL(system.emitters.size(), 1);
+	int localID = system.emitters[0].localCellID;
+	BOOST_CHECK(localID >= 0);
+	BOOST_CHECK(localID < nOwnedCells);
+	BOOST_CHECK_EQUAL(system.mesh->getCellID(emitterLabel), localID);
+	BOOST_CHECK_EQUAL(system.mesh->cellConnGraph->globalToNode[system.emitters[0].globalCellID], emitterLabel);
+}
+
 // Cleanup
 BOOST_AUTO_TEST_CASE(cleanup)
 {
@@ -0,0 +1,257 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the PartitionerRCB class
+ */
+
+#define BOOST_TEST_MODULE PartitionerRCB
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+
+#include "PartitionerRCB.h"
+#include "Error.h"
+#include "Reduce.h"
+
+#include <vector>
+
+// ========================================
+// ============== Tests ===================
+// ========================================
+
+// ======= Setup ========
+// Some tests require MPI
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+    MPI_Init(&argc, &argv);
+}
+
+using namespace cupcfd::partitioner;
+
+// === partition ===
+// Test 1: Test that the nodes of a line are cut into contiguous blocks of equal size.
+// The nodes are dealt out to the processes in turn so that each block spans every process.
+BOOST_AUTO_TEST_CASE(partition_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerRCB<int,int> partitioner(comm);
+
+	int nNodes = 16;
+	std::vector<int> nodes(nNodes);
+	std::vector<double> coords(nNodes * 3, 0.0);
+
+	for(int i = 0; i < nNodes; i++) {
+		nodes[i] = comm.rank + comm.size * i;
+		coords[i * 3] = double(nodes[i]);
+	}
+
+	partitioner.setNodeStorage(nodes.data(), nNodes);
+	partitioner.setNParts(comm.size);
+	status = partitioner.setNodeCoordinates(coords.data(), nNodes * 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = partitioner.partition();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(partitioner.nResult, nNodes);
+
+	for(int i = 0; i < nNodes; i++) {
+		BOOST_CHECK_EQUAL(partitioner.result[i], nodes[i] / nNodes);
+	}
+}
+
+// Test 2: Test that a number of parts that is not a power of two is cut in proportion
+BOOST_AUTO_TEST_CASE(partition_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerRCB<int,int> partitioner(comm);
+
+	int nNodes = 16;
+	std::vector<int> nodes(nNodes);
+	std::vector<double> coords(nNodes * 3, 0.0);
+
+	for(int i = 0; i < nNodes; i++) {
+		nodes[i] = comm.rank + comm.size * i;
+		coords[i * 3 + 1] = double(nodes[i]);
+	}
+
+	partitioner.setNodeStorage(nodes.data(), nNodes);
+	partitioner.setNParts(3);
+	status = partitioner.setNodeCoordinates(coords.data(), nNodes * 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = partitioner.partition();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	// 64 nodes: the first part takes 64 / 3 = 21 nodes, the remaining 43 are split 21 and 22
+	for(int i = 0; i < nNodes; i++) {
+		int expected = (nodes[i] < 21) ? 0 : ((nodes[i] < 42) ? 1 : 2);
+		BOOST_CHECK_EQUAL(partitioner.result[i], expected);
+	}
+}
+
+// Test 3: Test that a 3D grid of nodes is partitioned into parts of equal size
+BOOST_AUTO_TEST_CASE(partition_test3)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerRCB<int,int> partitioner(comm);
+
+	int nNodes = 16;
+	std::vector<int> nodes(nNodes);
+	std::vector<double> coords(nNodes * 3);
+
+	for(int i = 0; i < nNodes; i++) {
+		nodes[i] = comm.rank + comm.size * i;
+		coords[i * 3] = double(nodes[i] % 4);
+		coords[i * 3 + 1] = double((nodes[i] / 4) % 4);
+		coords[i * 3 + 2] = double(nodes[i] / 16);
+	}
+
+	partitioner.setNodeStorage(nodes.data(), nNodes);
+	partitioner.setNParts(comm.size);
+	status = partitioner.setNodeCoordinates(coords.data(), nNodes * 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = partitioner.partition();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	std::vector<int> localCount(comm.size, 0);
+	std::vector<int> count(comm.size);
+
+	for(int i = 0; i < nNodes; i++) {
+		localCount[partitioner.result[i]] += 1;
+	}
+
+	status = cupcfd::comm::allReduceAdd(localCount.data(), comm.size, count.data(), comm.size, comm);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int p = 0; p < comm.size; p++) {
+		BOOST_CHECK_EQUAL(count[p], 16);
+	}
+}
+
+// Test 4: Test that partitioning without the number of parts set returns an error
+BOOST_AUTO_TEST_CASE(partition_test4)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerRCB<int,int> partitioner(comm);
+
+	int nodes[2] = {comm.rank * 2, comm.rank * 2 + 1};
+	double coords[6] = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+
+	partitioner.setNodeStorage(nodes, 2);
+	status = partitioner.setNodeCoordinates(coords, 6);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = partitioner.partition();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_PARTITIONER_NPARTS_UNSET);
+}
+
+// Test 5: Test that partitioning without the node coordinates returns an error
+BOOST_AUTO_TEST_CASE(partition_test5)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerRCB<int,int> partitioner(comm);
+
+	int nodes[2] = {comm.rank * 2, comm.rank * 2 + 1};
+
+	partitioner.setNodeStorage(nodes, 2);
+	partitioner.setNParts(comm.size);
+
+	status = partitioner.partition();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_PARTITIONER_MISSING_COORDINATE_DATA);
+}
+
+// Test 6: Test that node weights move the cuts so that each part has the same total weight.
+// The first 16 nodes of the line weigh 3 and the rest 1, so the total weight is 96 and each of the 4 parts holds 24.
+BOOST_AUTO_TEST_CASE(partition_test6)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerRCB<int,int> partitioner(comm);
+
+	int nNodes = 16;
+	std::vector<int> nodes(nNodes);
+	std::vector<double> coords(nNodes * 3, 0.0);
+	std::vector<double> weights(nNodes);
+
+	for(int i = 0; i < nNodes; i++) {
+		nodes[i] = comm.rank + comm.size * i;
+		coords[i * 3] = double(nodes[i]);
+		weights[i] = (nodes[i] < 16) ? 3.0 : 1.0;
+	}
+
+	partitioner.setNodeStorage(nodes.data(), nNodes);
+	partitioner.setNParts(4);
+	status = partitioner.setNodeCoordinates(coords.data(), nNodes * 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = partitioner.setNodeWeights(weights.data(), nNodes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = partitioner.partition();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < nNodes; i++) {
+		int expected = (nodes[i] < 8) ? 0 : (nodes[i] < 16) ? 1 : (nodes[i] < 40) ? 2 : 3;
+		BOOST_CHECK_EQUAL(partitioner.result[i], expected);
+	}
+}
+
+// === setNodeCoordinates ===
+// Test 1: Test that coordinates that do not match the number of nodes are rejected
+BOOST_AUTO_TEST_CASE(setNodeCoordinates_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerRCB<int,int> partitioner(comm);
+
+	int nodes[2] = {comm.rank * 2, comm.rank * 2 + 1};
+	double coords[3] = {0.0, 0.0, 0.0};
+
+	partitioner.setNodeStorage(nodes, 2);
+
+	BOOST_CHECK_EQUAL(partitioner.usesNodeCoordinates(), true);
+	status = partitioner.setNodeCoordinates(coords, 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+}
+
+// === setNodeWeights ===
+// Test 1: Test that weights that do not match the number of nodes, or are not positive, are rejected
+BOOST_AUTO_TEST_CASE(setNodeWeights_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerRCB<int,int> partitioner(comm);
+
+	int nodes[2] = {comm.rank * 2, comm.rank * 2 + 1};
+	double weights[2] = {1.0, 0.0};
+
+	partitioner.setNodeStorage(nodes, 2);
+
+	status = partitioner.setNodeWeights(weights, 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+
+	status = partitioner.setNodeWeights(weights, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_PARTITIONER_INVALID_NODE_WEIGHTS);
+}
+
+// ======= Cleanup ========
+// Finalize MPI
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    // Cleanup MPI Environment
+    MPI_Finalize();
+}
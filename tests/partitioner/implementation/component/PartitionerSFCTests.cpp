@@ -0,0 +1,217 @@
+/*
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Unit Tests for the PartitionerSFC class
+ */
+
+#define BOOST_TEST_MODULE PartitionerSFC
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+
+#include "PartitionerSFC.h"
+#include "Error.h"
+#include "Reduce.h"
+
+#include <vector>
+
+// ========================================
+// ============== Tests ===================
+// ========================================
+
+// ======= Setup ========
+// Some tests require MPI
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+    MPI_Init(&argc, &argv);
+}
+
+using namespace cupcfd::partitioner;
+
+// === partition ===
+// Test 1: Test that the nodes of a line are cut into contiguous blocks of equal size along a Morton curve.
+// The nodes are dealt out to the processes in turn so that each block spans every process.
+BOOST_AUTO_TEST_CASE(partition_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerSFC<int,int> partitioner(comm, PARTITIONER_SFC_MORTON);
+
+	int nNodes = 16;
+	std::vector<int> nodes(nNodes);
+	std::vector<double> coords(nNodes * 3, 0.0);
+
+	for(int i = 0; i < nNodes; i++) {
+		nodes[i] = comm.rank + comm.size * i;
+		coords[i * 3] = double(nodes[i]);
+	}
+
+	partitioner.setNodeStorage(nodes.data(), nNodes);
+	partitioner.setNParts(comm.size);
+	status = partitioner.setNodeCoordinates(coords.data(), nNodes * 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = partitioner.partition();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	BOOST_CHECK_EQUAL(partitioner.nResult, nNodes);
+
+	for(int i = 0; i < nNodes; i++) {
+		BOOST_CHECK_EQUAL(partitioner.result[i], nodes[i] / nNodes);
+	}
+}
+
+// Test 2: Test that a 3D grid of nodes is partitioned into parts of equal size along a Hilbert curve,
+// including a number of parts that does not divide the number of nodes
+BOOST_AUTO_TEST_CASE(partition_test2)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+
+	int nNodes = 16;
+	std::vector<int> nodes(nNodes);
+	std::vector<double> coords(nNodes * 3);
+
+	for(int i = 0; i < nNodes; i++) {
+		nodes[i] = comm.rank + comm.size * i;
+		coords[i * 3] = double(nodes[i] % 4);
+		coords[i * 3 + 1] = double((nodes[i] / 4) % 4);
+		coords[i * 3 + 2] = double(nodes[i] / 16);
+	}
+
+	int testNParts[2] = {4, 5};
+
+	for(int t = 0; t < 2; t++) {
+		PartitionerSFC<int,int> partitioner(comm, PARTITIONER_SFC_HILBERT);
+		int nParts = testNParts[t];
+
+		partitioner.setNodeStorage(nodes.data(), nNodes);
+		partitioner.setNParts(nParts);
+		status = partitioner.setNodeCoordinates(coords.data(), nNodes * 3);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		status = partitioner.partition();
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		std::vector<int> localCount(nParts, 0);
+		std::vector<int> count(nParts);
+
+		for(int i = 0; i < nNodes; i++) {
+			localCount[partitioner.result[i]] += 1;
+		}
+
+		status = cupcfd::comm::allReduceAdd(localCount.data(), nParts, count.data(), nParts, comm);
+		BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+		// Parts differ in size by at most one node
+		for(int p = 0; p < nParts; p++) {
+			BOOST_CHECK(count[p] >= 64 / nParts);
+			BOOST_CHECK(count[p] <= (64 + nParts - 1) / nParts);
+		}
+	}
+}
+
+// Test 3: Test that partitioning without the number of parts set returns an error
+BOOST_AUTO_TEST_CASE(partition_test3)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerSFC<int,int> partitioner(comm, PARTITIONER_SFC_HILBERT);
+
+	int nodes[2] = {comm.rank * 2, comm.rank * 2 + 1};
+	double coords[6] = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+
+	partitioner.setNodeStorage(nodes, 2);
+	status = partitioner.setNodeCoordinates(coords, 6);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = partitioner.partition();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_PARTITIONER_NPARTS_UNSET);
+}
+
+// Test 4: Test that partitioning without the node coordinates returns an error
+BOOST_AUTO_TEST_CASE(partition_test4)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerSFC<int,int> partitioner(comm, PARTITIONER_SFC_HILBERT);
+
+	int nodes[2] = {comm.rank * 2, comm.rank * 2 + 1};
+
+	partitioner.setNodeStorage(nodes, 2);
+	partitioner.setNParts(comm.size);
+
+	status = partitioner.partition();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_PARTITIONER_MISSING_COORDINATE_DATA);
+}
+
+// Test 5: Test that node weights move the cuts so that each part has the same total weight.
+// The first 16 nodes of the line weigh 3 and the rest 1, so the total weight is 96 and each of the 4 parts holds 24.
+BOOST_AUTO_TEST_CASE(partition_test5)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerSFC<int,int> partitioner(comm, PARTITIONER_SFC_MORTON);
+
+	int nNodes = 16;
+	std::vector<int> nodes(nNodes);
+	std::vector<double> coords(nNodes * 3, 0.0);
+	std::vector<double> weights(nNodes);
+
+	for(int i = 0; i < nNodes; i++) {
+		nodes[i] = comm.rank + comm.size * i;
+		coords[i * 3] = double(nodes[i]);
+		weights[i] = (nodes[i] < 16) ? 3.0 : 1.0;
+	}
+
+	partitioner.setNodeStorage(nodes.data(), nNodes);
+	partitioner.setNParts(4);
+	status = partitioner.setNodeCoordinates(coords.data(), nNodes * 3);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = partitioner.setNodeWeights(weights.data(), nNodes);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	status = partitioner.partition();
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+
+	for(int i = 0; i < nNodes; i++) {
+		int expected = (nodes[i] < 8) ? 0 : (nodes[i] < 16) ? 1 : (nodes[i] < 40) ? 2 : 3;
+		BOOST_CHECK_EQUAL(partitioner.result[i], expected);
+	}
+}
+
+// === setNodeWeights ===
+// Test 1: Test that weights that do not match the number of nodes, or are not positive, are rejected
+BOOST_AUTO_TEST_CASE(setNodeWeights_test1)
+{
+	cupcfd::error::eCodes status;
+	cupcfd::comm::Communicator comm(MPI_COMM_WORLD);
+	PartitionerSFC<int,int> partitioner(comm, PARTITIONER_SFC_HILBERT);
+
+	int nodes[2] = {comm.rank * 2, comm.rank * 2 + 1};
+	double weights[2] = {1.0, 0.0};
+
+	partitioner.setNodeStorage(nodes, 2);
+
+	status = partitioner.setNodeWeights(weights, 1);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_ARRAY_SIZE_MISMATCH);
+
+	status = partitioner.setNodeWeights(weights, 2);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_PARTITIONER_INVALID_NODE_WEIGHTS);
+}
+
+// ======= Cleanup ========
+// Finalize MPI
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    // Cleanup MPI Environment
+    MPI_Finalize();
+}
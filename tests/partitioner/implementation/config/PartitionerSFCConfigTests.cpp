@@ -0,0 +1,85 @@
+/**
+ * @file
+ * @author University of Warwick
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ * @section DESCRIPTION
+ *
+ * Tests for the concrete methods of the PartitionerSFCConfig class.
+ */
+
+#define BOOST_TEST_MODULE PartitionerSFCConfig
+
+// Boost setup
+#include <boost/test/unit_test.hpp>
+#include <boost/test/output_test_stream.hpp>
+#include <stdexcept>
+
+#include "PartitionerSFCConfig.h"
+#include "PartitionerSFC.h"
+#include "Error.h"
+#include "PartitionerInterface.h"
+
+// Namespaces
+namespace utf = boost::unit_test;
+
+using namespace cupcfd::partitioner;
+
+// ======= Setup ========
+// Some tests require MPI
+BOOST_AUTO_TEST_CASE(setup)
+{
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char ** argv = boost::unit_test::framework::master_test_suite().argv;
+    MPI_Init(&argc, &argv);
+}
+
+// === Constructor ===
+// Test 1: Create using the constructor
+BOOST_AUTO_TEST_CASE(constructor_test1)
+{
+	PartitionerSFCConfig<int,int> config(PARTITIONER_SFC_MORTON);
+}
+
+// === buildPartitioner ===
+// Test 1: Build a partitioner of the SFC partitioner type
+BOOST_AUTO_TEST_CASE(buildPartitioner_test1)
+{
+	cupcfd::error::eCodes status;
+	PartitionerSFCConfig<int,int> config(PARTITIONER_SFC_MORTON);
+	PartitionerInterface<int,int> * part;
+
+	status = config.buildPartitioner(&part);
+	BOOST_CHECK_EQUAL(status, cupcfd::error::E_SUCCESS);
+	PartitionerSFC<int,int> * sfcPart = dynamic_cast<PartitionerSFC<int,int> *>(part);
+	BOOST_CHECK(sfcPart != nullptr);
+	BOOST_CHECK_EQUAL(part->usesNodeCoordinates(), true);
+	BOOST_CHECK_EQUAL(sfcPart->curve, PARTITIONER_SFC_MORTON);
+
+	delete part;
+}
+
+// === getCurve/setCurve ===
+// Test 1: Change the curve
+BOOST_AUTO_TEST_CASE(setCurve_test1)
+{
+	PartitionerSFCConfig<int,int> config(PARTITIONER_SFC_MORTON);
+	BOOST_CHECK_EQUAL(config.getCurve(), PARTITIONER_SFC_MORTON);
+
+	config.setCurve(PARTITIONER_SFC_HILBERT);
+	BOOST_CHECK_EQUAL(config.getCurve(), PARTITIONER_SFC_HILBERT);
+
+	PartitionerSFCConfig<int,int> * copy = config.clone();
+	BOOST_CHECK_EQUAL(copy->getCurve(), PARTITIONER_SFC_HILBERT);
+	delete copy;
+}
+
+// ======= Cleanup ========
+// Finalize MPI
+BOOST_AUTO_TEST_CASE(cleanup)
+{
+    // Cleanup MPI Environment
+    MPI_Finalize();
+}